@@ -1510,549 +1510,714 @@
  */
 #define FM_DIRECTORY_ESTIMATE_ERR_EID 104
 
-/** -------------------------------------------------------------
- *  NOTE: From here on, the event IDs will take the form of a
- *  "base" EID + an offset.  This is done to allow unique event
- *  IDs to be sent from utility functions.
- ** --------------------------------------------------------------*/
-
-#define FM_FNAME_INVALID_EID_OFFSET  0
-#define FM_FNAME_DNE_EID_OFFSET      1
-#define FM_FNAME_EXIST_EID_OFFSET    1 /* mutually exclusive with DNE */
-#define FM_FNAME_ISDIR_EID_OFFSET    2
-#define FM_FNAME_ISFILE_EID_OFFSET   2 /* mutually exclusive with ISDIR */
-#define FM_FNAME_ISOPEN_EID_OFFSET   3
-#define FM_FNAME_ISCLOSED_EID_OFFSET 4
-/* Unused EID offset 5 */
-#define FM_FNAME_NUM_OFFSETS 6
-
-#define FM_CHILD_DISABLED_EID_OFFSET 0
-#define FM_CHILD_Q_FULL_EID_OFFSET   1
-#define FM_CHILD_BROKEN_EID_OFFSET   2
-#define FM_CHILD_NUM_OFFSETS         3
-
 /**
- * \brief FM Child Task Copy File Source Filename Error Base ID
+ * \brief FM Child Task Initialization Create Decompress Semaphore Failed Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This is the base for a number of error events generated when the
- *  /FM_Copy is received with an unusable source filename.
+ *  This event message indicates an unsuccessful attempt to create the mutex
+ *  semaphore that serializes access to the decompressor state between the FM
+ *  child tasks. Commands which would have otherwise been handed off to the child
+ *  tasks for execution, will now be rejected by the main FM application.
  */
-#define FM_COPY_SRC_BASE_EID 151
+#define FM_CHILD_INIT_DSEM_ERR_EID 105
 
 /**
- * \brief FM Child Task Copy File Source Name Invalid Event ID
+ * \brief FM Set Copy Block Size Command Length Invalid Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Copy
- *  command packet with an invalid source filename.
- *
- *  Value: 151
+ *  This event message is generated upon receipt of a /FM_SetCopyBlockSize
+ *  command packet with an invalid length.
  */
-#define FM_COPY_SRC_INVALID_ERR_EID (FM_COPY_SRC_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+#define FM_SET_COPY_BLOCK_PKT_ERR_EID 106
 
 /**
- * \brief FM Child Task Copy File Source File Does Not Exist Event ID
+ * \brief FM Set Copy Block Size Command Argument Invalid Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Copy
- *  command packet with a source filename that does not exist.
- *
- *  Value: 152
+ *  This event message is generated upon receipt of a /FM_SetCopyBlockSize
+ *  command packet with a block size smaller than #FM_CHILD_FILE_BLOCK_SIZE
+ *  or larger than the child task copy buffer (#FM_CHILD_COPY_BUFFER_SIZE).
  */
-#define FM_COPY_SRC_DNE_ERR_EID (FM_COPY_SRC_BASE_EID + FM_FNAME_DNE_EID_OFFSET)
+#define FM_SET_COPY_BLOCK_ARG_ERR_EID 107
 
 /**
- * \brief FM Child Task Copy File Source File Name Is Directory Event ID
+ * \brief FM Set Copy Block Size Command Event ID
  *
- *  \par Type: ERROR
+ *  \par Type: INFORMATION
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Copy
- *  command packet with a source filename that is a directory.
- *
- *  Value: 153
+ *  This event message signals the successful completion of a
+ *  /FM_SetCopyBlockSize command.
  */
-#define FM_COPY_SRC_ISDIR_ERR_EID (FM_COPY_SRC_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
+#define FM_SET_COPY_BLOCK_CMD_INF_EID 108
 
 /**
- * \brief FM Child Task Copy File Target Filename Error Base ID
+ * \brief FM Child Task Initialization Writer Task Failed Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This is the base EID for a number of error events related to the
- *  target file in an /FM_COPY command.
- *
- *  Value: 157
+ *  This event message indicates an unsuccessful attempt to create one of the
+ *  copy buffer semaphores or the copy writer task of a child task.  Commands
+ *  which would have otherwise been handed off to the child task for execution,
+ *  will now be processed by the main FM application.
  */
-#define FM_COPY_TGT_BASE_EID (FM_COPY_SRC_BASE_EID + FM_FNAME_NUM_OFFSETS)
+#define FM_CHILD_INIT_WRITER_ERR_EID 109
 
 /**
- * \brief FM Child Task Copy File Target Filename Invalid Event ID
+ * \brief FM Child Writer Task Termination Error Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Copy
- *  command packet with an invalid target filename.
- *
- *  Value: 157
+ *  This event message indicates that the copy writer task of a child task has
+ *  suffered a fatal error and has terminated.  The error occurred when trying
+ *  to take the filled copy buffer semaphore.  Later copies made by that child
+ *  task read and write the source and target files in turn.
  */
-#define FM_COPY_TGT_INVALID_ERR_EID (FM_COPY_TGT_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+#define FM_CHILD_WRITER_TERM_ERR_EID 110
 
 /**
- * \brief FM Child Task Copy File Target File Already Exists Event ID
+ * \brief FM Concat List Command Length Invalid Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Copy
- *  command packet with a target filename that already exists.
- *
- *  Value: 158
+ *  This event message is generated upon receipt of a /FM_ConcatList
+ *  command packet with an invalid length.
  */
-#define FM_COPY_TGT_EXIST_ERR_EID (FM_COPY_TGT_BASE_EID + FM_FNAME_EXIST_EID_OFFSET)
+#define FM_CONCAT_LIST_PKT_ERR_EID 111
 
 /**
- * \brief FM Child Task Copy File Target Filename Is A Directory Event ID
+ * \brief FM Concat List Command Source Count Invalid Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Copy
- *  command packet with a target filename that is a directory.
- *
- *  Value: 159
+ *  This event message is generated upon receipt of a /FM_ConcatList
+ *  command packet without a list file and with an inline source count that is
+ *  zero or greater than #FM_CONCAT_LIST_INLINE_MAX.
  */
-#define FM_COPY_TGT_ISDIR_ERR_EID (FM_COPY_TGT_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
+#define FM_CONCAT_LIST_ARG_ERR_EID 112
 
 /**
- * \brief FM Child Task Copy File Target Filename Exists As Open File Event ID
+ * \brief FM Child Task Concat List Command Event ID
  *
- *  \par Type: ERROR
+ *  \par Type: INFORMATION
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Copy
- *  command packet with a target filename that is open.
- *
- *  Value: 160
+ *  This event message signals the successful completion of a
+ *  /FM_ConcatList command.  The event reports the number of source files
+ *  and the number of bytes written to the target file.
  */
-#define FM_COPY_TGT_ISOPEN_ERR_EID (FM_COPY_TGT_BASE_EID + FM_FNAME_ISOPEN_EID_OFFSET)
+#define FM_CONCAT_LIST_CMD_INF_EID 113
 
 /**
- * \brief FM Child Task Copy File Child Task Error Base ID
+ * \brief FM Child Task Concat List Open List File Failed Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This is the base for any of several messages that are  generated when
- *  the FM child task command queue interface cannot be used.
- *
- *  Value: 163
+ *  This event message is generated when the child task cannot open the
+ *  /FM_ConcatList source list file.
  */
-#define FM_COPY_CHILD_BASE_EID (FM_COPY_TGT_BASE_EID + FM_FNAME_NUM_OFFSETS)
+#define FM_CONCAT_LIST_OPEN_LIST_ERR_EID 114
 
 /**
- * \brief FM Child Task Copy File Child Task Disabled Event ID
+ * \brief FM Child Task Concat List Read List Failed Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated when the FM child task command queue
- *  interface cannot be used because the child task is disabled.
- *
- *  Value: 163
+ *  This event message is generated when the /FM_ConcatList source list
+ *  cannot be used: a read of the list file failed, a listed name is too long,
+ *  a listed name is the target file or the list holds no names.
  */
-#define FM_COPY_CHILD_DISABLED_ERR_EID (FM_COPY_CHILD_BASE_EID + FM_CHILD_DISABLED_EID_OFFSET)
+#define FM_CONCAT_LIST_READ_LIST_ERR_EID 115
 
 /**
- * \brief FM Child Task Copy File Child Task Queue Full Event ID
+ * \brief FM Child Task Concat List Open Source File Failed Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated when the FM child task command queue
- *  interface cannot be used because the child task comand queue is full.
- *
- *  If the child task command queue is full, the problem may be temporary,
- *  caused by sending too many FM commands too quickly.  If the command
- *  queue does not empty itself within a reasonable amount of time then
- *  the child task may be hung. It may be possible to use CFE commands to
- *  terminate the child task, which should then cause FM to process all
- *  commands in the main task.
- *
- *  Value: 164
+ *  This event message is generated when the child task cannot open one of
+ *  the /FM_ConcatList source files.
  */
-#define FM_COPY_CHILD_FULL_ERR_EID (FM_COPY_CHILD_BASE_EID + FM_CHILD_Q_FULL_EID_OFFSET)
+#define FM_CONCAT_LIST_OPEN_SRC_ERR_EID 116
 
 /**
- * \brief FM Child Task Copy File Child Task Interface Broken Event ID
+ * \brief FM Child Task Concat List Open Target File Failed Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated when the FM child task command queue
- *  interface cannot be used because the interface between the main task
- *  and child task is broken.
- *
- *  If the child task queue is broken then either the handshake interface
- *  logic is flawed, or there has been some sort of data corruption that
- *  affected the interface control variables.  In either case, it may be
- *  necessary to restart the FM application to resync the interface.
- *
- *  Value: 165
- *
+ *  This event message is generated when the child task cannot create the
+ *  /FM_ConcatList target file.
  */
-#define FM_COPY_CHILD_BROKEN_ERR_EID (FM_COPY_CHILD_BASE_EID + FM_CHILD_BROKEN_EID_OFFSET)
+#define FM_CONCAT_LIST_OPEN_TGT_ERR_EID 117
 
 /**
- * \brief FM Child Task Move File Source Filename Error Base ID
+ * \brief FM Child Task Concat List Source File Read Failed Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Move
- *  command packet with a source filename that is unusable for one
- *  of several reasons.
- *
- *  Value: 166
+ *  This event message is generated when a read of one of the
+ *  /FM_ConcatList source files fails.
  */
-#define FM_MOVE_SRC_BASE_EID (FM_COPY_CHILD_BASE_EID + FM_CHILD_NUM_OFFSETS)
+#define FM_CONCAT_LIST_OSRD_ERR_EID 118
 
 /**
- * \brief FM Child Task Move File Source Filename Invalid Event ID
+ * \brief FM Child Task Concat List Target File Write Failed Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Move
- *  command packet with an invalid source filename.
- *
- *  Value: 166
+ *  This event message is generated when a write to the /FM_ConcatList
+ *  target file fails.
  */
-#define FM_MOVE_SRC_INVALID_ERR_EID (FM_MOVE_SRC_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+#define FM_CONCAT_LIST_OSWR_ERR_EID 119
 
 /**
- * \brief FM Child Task Move File Source File Does Not Exist Event ID
+ * \brief FM Child Task Initialization Create Throttle Semaphore Failed Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Move
- *  command packet with a source filename that does not exist.
- *
- *  Value: 167
+ *  This event message indicates an unsuccessful attempt to create the mutex
+ *  semaphore that serializes access to the child task throttle buckets.
+ *  Commands which would have otherwise been handed off to the child tasks
+ *  for execution, will now be rejected by the main FM application.
  */
-#define FM_MOVE_SRC_DNE_ERR_EID (FM_MOVE_SRC_BASE_EID + FM_FNAME_DNE_EID_OFFSET)
+#define FM_CHILD_INIT_TSEM_ERR_EID 120
 
 /**
- * \brief FM Child Task Move File Source Filename Is A Directory Event ID
+ * \brief FM Set Throttle Command Length Invalid Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Move
- *  command packet with a source filename that is a directory.
- *
- *  Value: 168
+ *  This event message is generated upon receipt of a /FM_SetThrottle
+ *  command packet with an invalid length.
  */
-#define FM_MOVE_SRC_ISDIR_ERR_EID (FM_MOVE_SRC_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
+#define FM_SET_THROTTLE_PKT_ERR_EID 121
 
 /**
- * \brief FM Child Task Move File Target Filename Error Base ID
+ * \brief FM Set Throttle Command Argument Invalid Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Move
- *  command packet with a target filename that is unusable for one
- *  of several reasons.
- *
- *  Value: 172
+ *  This event message is generated upon receipt of a /FM_SetThrottle
+ *  command packet with an invalid volume or rate, or with a new volume
+ *  when all #FM_CHILD_THROTTLE_VOLUME_COUNT volume entries are in use.
  */
-#define FM_MOVE_TGT_BASE_EID (FM_MOVE_SRC_BASE_EID + FM_FNAME_NUM_OFFSETS)
+#define FM_SET_THROTTLE_ARG_ERR_EID 122
 
 /**
- * \brief FM Child Task Move File Target Filename Invalid Event ID
+ * \brief FM Set Throttle Command Event ID
  *
- *  \par Type: ERROR
+ *  \par Type: INFORMATION
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Move
- *  command packet with an invalid target filename.
- *
- *  Value: 172
+ *  This event message signals the successful completion of a
+ *  /FM_SetThrottle command.
  */
-#define FM_MOVE_TGT_INVALID_ERR_EID (FM_MOVE_TGT_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+#define FM_SET_THROTTLE_CMD_INF_EID 123
 
 /**
- * \brief FM Child Task Move File Target File Already Exists Event ID
+ * \brief FM Abort Command Length Invalid Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Move
- *  command packet with a target filename that already exists
- *
- *  Value: 173
+ *  This event message is generated upon receipt of a /FM_Abort
+ *  command packet with an invalid length.
  */
-#define FM_MOVE_TGT_EXIST_ERR_EID (FM_MOVE_TGT_BASE_EID + FM_FNAME_EXIST_EID_OFFSET)
+#define FM_ABORT_PKT_ERR_EID 124
 
 /**
- * \brief FM Child Task Move File Target Filename Is A Directory Event ID
+ * \brief FM Abort Command Argument Invalid Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Move
- *  command packet with a target filename that is a directory.
- *
- *  Value: 174
+ *  This event message is generated upon receipt of a /FM_Abort
+ *  command packet with an invalid child task index.
  */
-#define FM_MOVE_TGT_ISDIR_ERR_EID (FM_MOVE_TGT_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
+#define FM_ABORT_ARG_ERR_EID 125
 
 /**
- * \brief FM Child Task Move File Target File Exists As An Open File Event ID
+ * \brief FM Abort Command Event ID
  *
- *  \par Type: ERROR
+ *  \par Type: INFORMATION
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Move
- *  command packet with a target filename that is open.
- *
- *  Value: 175
+ *  This event message signals the successful completion of a
+ *  /FM_Abort command.  The event reports the number of child task
+ *  commands that were asked to stop.
  */
-#define FM_MOVE_TGT_ISOPEN_ERR_EID (FM_MOVE_TGT_BASE_EID + FM_FNAME_ISOPEN_EID_OFFSET)
+#define FM_ABORT_CMD_INF_EID 126
 
 /**
- * \brief FM Child Task Move File Child Task Error Base ID
+ * \brief FM Flush Queue Command Length Invalid Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This is the base for any of several messages that are  generated when
- *  the FM child task command queue interface cannot be used.
- *
- *  Value: 178
+ *  This event message is generated upon receipt of a /FM_FlushQueue
+ *  command packet with an invalid length.
  */
-#define FM_MOVE_CHILD_BASE_EID (FM_MOVE_TGT_BASE_EID + FM_FNAME_NUM_OFFSETS)
+#define FM_FLUSH_QUEUE_PKT_ERR_EID 127
 
 /**
- * \brief FM Child Task Move File Child Task Disabled Event ID
+ * \brief FM Flush Queue Command Event ID
  *
- *  \par Type: ERROR
+ *  \par Type: INFORMATION
  *
  *  \par Cause
  *
- *  This event message is generated when the FM child task command queue
- *  interface cannot be used because the child task is disabled.
- *
- *  Value: 178
+ *  This event message signals the successful completion of a
+ *  /FM_FlushQueue command.  The event reports the number of queued
+ *  commands that were dropped.
  */
-#define FM_MOVE_CHILD_DISABLED_ERR_EID (FM_MOVE_CHILD_BASE_EID + FM_CHILD_DISABLED_EID_OFFSET)
+#define FM_FLUSH_QUEUE_CMD_INF_EID 128
 
 /**
- * \brief FM Child Task Move File Child Task Queue Full Event ID
+ * \brief FM Child Task Command Aborted Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated when the FM child task command queue
- *  interface cannot be used because the child task comand queue is full.
- *
- *  If the child task command queue is full, the problem may be temporary,
- *  caused by sending too many FM commands too quickly.  If the command
- *  queue does not empty itself within a reasonable amount of time then
- *  the child task may be hung. It may be possible to use CFE commands to
- *  terminate the child task, which should then cause FM to process all
- *  commands in the main task.
- *
- *  Value: 179
+ *  This event message is generated by a child task when it stops the
+ *  command it is executing at the request of a /FM_Abort command.
  */
-#define FM_MOVE_CHILD_FULL_ERR_EID (FM_MOVE_CHILD_BASE_EID + FM_CHILD_Q_FULL_EID_OFFSET)
+#define FM_CHILD_ABORT_ERR_EID 129
 
 /**
- * \brief FM Child Task Move File Child Task Inteface Broken Event ID
+ * \brief FM Child Task Command Resumed Event ID
  *
- *  \par Type: ERROR
+ *  \par Type: INFORMATION
  *
  *  \par Cause
  *
- *  This event message is generated when the FM child task command queue
- *  interface cannot be used because the interface between the main task
- *  and child task is broken.
- *
- *  If the child task queue is broken then either the handshake interface
- *  logic is flawed, or there has been some sort of data corruption that
- *  affected the interface control variables.  In either case, it may be
- *  necessary to restart the FM application to resync the interface.
- *
- *  Value: 180
- *
+ *  This event message is generated when a child task resumes a copy,
+ *  move or concat command from the offset saved in its checkpoint file.
  */
-#define FM_MOVE_CHILD_BROKEN_ERR_EID (FM_MOVE_CHILD_BASE_EID + FM_CHILD_BROKEN_EID_OFFSET)
+#define FM_CHILD_RESUME_INF_EID 130
 
 /**
- * \brief FM Child Task Rename File Source Filename Error Base ID
+ * \brief FM Child Task Checkpoint Error Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Rename
- *  command packet with a source filename that is unusable for one
- *  of several reasons.
- *
- *  Value: 181
+ *  This event message is generated when a child task checkpoint file
+ *  cannot be used - the file is not a valid checkpoint record, or the
+ *  source or target file no longer matches the checkpoint, or the files
+ *  cannot be positioned at the checkpoint offset.  The interrupted
+ *  command is failed and its partial target file is removed.
  */
-#define FM_RENAME_SRC_BASE_EID (FM_MOVE_CHILD_BASE_EID + FM_CHILD_NUM_OFFSETS)
+#define FM_CHILD_CHECKPOINT_ERR_EID 131
 
 /**
- * \brief FM Child Task Rename File Source Filename Invalid Event ID
+ * \brief FM Child Task Checkpoint Save Failed Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Rename
- *  command packet with an invalid source filename.
- *
- *  Value: 181
+ *  This event message is generated when a child task cannot write its
+ *  checkpoint file.  The command continues without further checkpoints.
  */
-#define FM_RENAME_SRC_INVALID_ERR_EID (FM_RENAME_SRC_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+#define FM_CHILD_CHECKPOINT_SAVE_ERR_EID 132
 
 /**
- * \brief FM Child Task Rename File Source File Does Not Exist Event ID
+ * \brief FM Send Latency Command Length Invalid Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Rename
- *  command packet with a source filename that does not exist.
- *
- *  Value: 182
+ *  This event message is generated upon receipt of a /FM_SendLatency
+ *  command packet with an invalid length.
  */
-#define FM_RENAME_SRC_DNE_ERR_EID (FM_RENAME_SRC_BASE_EID + FM_FNAME_DNE_EID_OFFSET)
+#define FM_SEND_LATENCY_PKT_ERR_EID 133
 
 /**
- * \brief FM Child Task Rename File Source Filename Is Directory Event ID
+ * \brief FM Send Latency Command Event ID
  *
- *  \par Type: ERROR
+ *  \par Type: INFORMATION
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Rename
- *  command packet with a source filename that is a directory.
- *
- *  Value: 183
+ *  This event message signals the successful completion of a
+ *  /FM_SendLatency command.
  */
-#define FM_RENAME_SRC_ISDIR_ERR_EID (FM_RENAME_SRC_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
+#define FM_SEND_LATENCY_CMD_INF_EID 134
 
 /**
- * \brief FM Child Task Rename File Target Filename Error Base ID
+ * \brief FM Reset Latency Command Length Invalid Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Rename
- *  command packet with a target filename that is unusable for one
- *  of several reasons.
+ *  This event message is generated upon receipt of a /FM_ResetLatency
+ *  command packet with an invalid length.
+ */
+#define FM_RESET_LATENCY_PKT_ERR_EID 135
+
+/**
+ * \brief FM Reset Latency Command Event ID
  *
- *  Value: 187
+ *  \par Type: INFORMATION
+ *
+ *  \par Cause
+ *
+ *  This event message signals the successful completion of a
+ *  /FM_ResetLatency command.
  */
-#define FM_RENAME_TGT_BASE_EID (FM_RENAME_SRC_BASE_EID + FM_FNAME_NUM_OFFSETS)
+#define FM_RESET_LATENCY_CMD_INF_EID 136
 
 /**
- * \brief FM Child Task Rename File Target Filename Invalid Event ID
+ * \brief FM Set Verify Mode Command Length Invalid Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Rename
+ *  This event message is generated upon receipt of a /FM_SetVerifyMode
+ *  command packet with an invalid length.
+ */
+#define FM_SET_VERIFY_MODE_PKT_ERR_EID 137
+
+/**
+ * \brief FM Set Verify Mode Command Argument Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_SetVerifyMode
+ *  command packet with a mode other than #FM_VERIFY_MODE_MAIN or
+ *  #FM_VERIFY_MODE_CHILD.
+ */
+#define FM_SET_VERIFY_MODE_ARG_ERR_EID 138
+
+/**
+ * \brief FM Set Verify Mode Command Event ID
+ *
+ *  \par Type: INFORMATION
+ *
+ *  \par Cause
+ *
+ *  This event message signals the successful completion of a
+ *  /FM_SetVerifyMode command.
+ */
+#define FM_SET_VERIFY_MODE_CMD_INF_EID 139
+
+/**
+ * \brief FM Delete Directory Tree Command Length Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_DeleteTree
+ *  command packet with an invalid length.
+ */
+#define FM_DELETE_TREE_PKT_ERR_EID 140
+
+/**
+ * \brief FM Delete Directory Tree Command Event ID
+ *
+ *  \par Type: INFORMATION
+ *
+ *  \par Cause
+ *
+ *  This event message signals the successful completion of a
+ *  /FM_DeleteTree command.  The message text includes the number of
+ *  files and directories deleted, including the directory named in the
+ *  command.
+ */
+#define FM_DELETE_TREE_CMD_INF_EID 141
+
+/**
+ * \brief FM Delete Directory Tree Incomplete Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated when a /FM_DeleteTree command could
+ *  not delete the directory named in the command.  Files that are open
+ *  are not deleted, nor are sub-directories found while the child task
+ *  stack of #FM_CHILD_TREE_STACK_SIZE directories was full.  The message
+ *  text includes the number of files and directories deleted and not
+ *  deleted.
+ */
+#define FM_DELETE_TREE_INCOMPLETE_ERR_EID 142
+
+/**
+ * \brief FM Filter Files Command Length Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_FilterFiles
+ *  command packet with an invalid length.
+ */
+#define FM_FILTER_FILES_PKT_ERR_EID 143
+
+/**
+ * \brief FM Filter Files Command Action Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_FilterFiles
+ *  command packet with an action other than #FM_FILTER_ACTION_DELETE,
+ *  #FM_FILTER_ACTION_MOVE or #FM_FILTER_ACTION_COPY.
+ */
+#define FM_FILTER_FILES_ACTION_ERR_EID 144
+
+/**
+ * \brief FM Filter Files Command Overwrite Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_FilterFiles
+ *  command packet with an invalid overwrite argument.  Overwrite
+ *  must be set to TRUE (one) or FALSE (zero).
+ */
+#define FM_FILTER_FILES_OVR_ERR_EID 145
+
+/**
+ * \brief FM Filter Files Command Event ID
+ *
+ *  \par Type: INFORMATION
+ *
+ *  \par Cause
+ *
+ *  This event message signals the successful completion of a
+ *  /FM_FilterFiles command.  The message text includes the number of
+ *  files deleted, moved or copied.
+ */
+#define FM_FILTER_FILES_CMD_INF_EID 146
+
+/**
+ * \brief FM Filter Files Command Files Not Handled Event ID
+ *
+ *  \par Type: INFORMATION
+ *
+ *  \par Cause
+ *
+ *  This general event message is issued when files that passed the
+ *  filter were not deleted, moved or copied.  The files may be open,
+ *  the target file may exist and overwrite was not allowed, or an OS
+ *  function may have failed.
+ */
+#define FM_FILTER_FILES_WARNING_EID 147
+
+/**
+ * \brief FM Filter Files Command OS Error Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated due to an OS function error that
+ *  occurred after preliminary command argument verification tests
+ *  indicated that the directories exist. Refer to the OS-specific
+ *  return value for an indication of what might have caused this
+ *  error.
+ */
+#define FM_FILTER_FILES_OS_ERR_EID 148
+
+/** -------------------------------------------------------------
+ *  NOTE: From here on, the event IDs will take the form of a
+ *  "base" EID + an offset.  This is done to allow unique event
+ *  IDs to be sent from utility functions.
+ ** --------------------------------------------------------------*/
+
+#define FM_FNAME_INVALID_EID_OFFSET  0
+#define FM_FNAME_DNE_EID_OFFSET      1
+#define FM_FNAME_EXIST_EID_OFFSET    1 /* mutually exclusive with DNE */
+#define FM_FNAME_ISDIR_EID_OFFSET    2
+#define FM_FNAME_ISFILE_EID_OFFSET   2 /* mutually exclusive with ISDIR */
+#define FM_FNAME_ISOPEN_EID_OFFSET   3
+#define FM_FNAME_ISCLOSED_EID_OFFSET 4
+/* Unused EID offset 5 */
+#define FM_FNAME_NUM_OFFSETS 6
+
+#define FM_CHILD_DISABLED_EID_OFFSET 0
+#define FM_CHILD_Q_FULL_EID_OFFSET   1
+#define FM_CHILD_BROKEN_EID_OFFSET   2
+#define FM_CHILD_NUM_OFFSETS         3
+
+/**
+ * \brief FM Child Task Copy File Source Filename Error Base ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This is the base for a number of error events generated when the
+ *  /FM_Copy is received with an unusable source filename.
+ */
+#define FM_COPY_SRC_BASE_EID 151
+
+/**
+ * \brief FM Child Task Copy File Source Name Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Copy
+ *  command packet with an invalid source filename.
+ *
+ *  Value: 151
+ */
+#define FM_COPY_SRC_INVALID_ERR_EID (FM_COPY_SRC_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Copy File Source File Does Not Exist Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Copy
+ *  command packet with a source filename that does not exist.
+ *
+ *  Value: 152
+ */
+#define FM_COPY_SRC_DNE_ERR_EID (FM_COPY_SRC_BASE_EID + FM_FNAME_DNE_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Copy File Source File Name Is Directory Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Copy
+ *  command packet with a source filename that is a directory.
+ *
+ *  Value: 153
+ */
+#define FM_COPY_SRC_ISDIR_ERR_EID (FM_COPY_SRC_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Copy File Target Filename Error Base ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This is the base EID for a number of error events related to the
+ *  target file in an /FM_COPY command.
+ *
+ *  Value: 157
+ */
+#define FM_COPY_TGT_BASE_EID (FM_COPY_SRC_BASE_EID + FM_FNAME_NUM_OFFSETS)
+
+/**
+ * \brief FM Child Task Copy File Target Filename Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Copy
  *  command packet with an invalid target filename.
  *
- *  Value: 187
+ *  Value: 157
  */
-#define FM_RENAME_TGT_INVALID_ERR_EID (FM_RENAME_TGT_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+#define FM_COPY_TGT_INVALID_ERR_EID (FM_COPY_TGT_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
 
 /**
- * \brief FM Child Task Rename File Target File Already Exists Event ID
+ * \brief FM Child Task Copy File Target File Already Exists Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Rename
+ *  This event message is generated upon receipt of a /FM_Copy
  *  command packet with a target filename that already exists.
  *
- *  Value: 188
+ *  Value: 158
  */
-#define FM_RENAME_TGT_EXIST_ERR_EID (FM_RENAME_TGT_BASE_EID + FM_FNAME_EXIST_EID_OFFSET)
+#define FM_COPY_TGT_EXIST_ERR_EID (FM_COPY_TGT_BASE_EID + FM_FNAME_EXIST_EID_OFFSET)
 
 /**
- * \brief FM Child Task Rename File Target Filename Is Directory Event ID
+ * \brief FM Child Task Copy File Target Filename Is A Directory Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Rename
+ *  This event message is generated upon receipt of a /FM_Copy
  *  command packet with a target filename that is a directory.
  *
- *  Value: 189
+ *  Value: 159
  */
-#define FM_RENAME_TGT_ISDIR_ERR_EID (FM_RENAME_TGT_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
+#define FM_COPY_TGT_ISDIR_ERR_EID (FM_COPY_TGT_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
 
 /**
- * \brief FM Child Task Rename File Target Filename Exists As Open File Event ID
+ * \brief FM Child Task Copy File Target Filename Exists As Open File Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Rename
+ *  This event message is generated upon receipt of a /FM_Copy
  *  command packet with a target filename that is open.
  *
- *  Value: 190
+ *  Value: 160
  */
-#define FM_RENAME_TGT_ISOPEN_ERR_EID (FM_RENAME_TGT_BASE_EID + FM_FNAME_ISOPEN_EID_OFFSET)
+#define FM_COPY_TGT_ISOPEN_ERR_EID (FM_COPY_TGT_BASE_EID + FM_FNAME_ISOPEN_EID_OFFSET)
 
 /**
- * \brief FM Child Task Rename File Child Task Error Base ID
+ * \brief FM Child Task Copy File Child Task Error Base ID
  *
  *  \par Type: ERROR
  *
@@ -2061,12 +2226,1453 @@
  *  This is the base for any of several messages that are  generated when
  *  the FM child task command queue interface cannot be used.
  *
- *  Value: 193
+ *  Value: 163
  */
-#define FM_RENAME_CHILD_BASE_EID (FM_RENAME_TGT_BASE_EID + FM_FNAME_NUM_OFFSETS)
+#define FM_COPY_CHILD_BASE_EID (FM_COPY_TGT_BASE_EID + FM_FNAME_NUM_OFFSETS)
+
+/**
+ * \brief FM Child Task Copy File Child Task Disabled Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the child task is disabled.
+ *
+ *  Value: 163
+ */
+#define FM_COPY_CHILD_DISABLED_ERR_EID (FM_COPY_CHILD_BASE_EID + FM_CHILD_DISABLED_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Copy File Child Task Queue Full Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the child task comand queue is full.
+ *
+ *  If the child task command queue is full, the problem may be temporary,
+ *  caused by sending too many FM commands too quickly.  If the command
+ *  queue does not empty itself within a reasonable amount of time then
+ *  the child task may be hung. It may be possible to use CFE commands to
+ *  terminate the child task, which should then cause FM to process all
+ *  commands in the main task.
+ *
+ *  Value: 164
+ */
+#define FM_COPY_CHILD_FULL_ERR_EID (FM_COPY_CHILD_BASE_EID + FM_CHILD_Q_FULL_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Copy File Child Task Interface Broken Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the interface between the main task
+ *  and child task is broken.
+ *
+ *  If the child task queue is broken then either the handshake interface
+ *  logic is flawed, or there has been some sort of data corruption that
+ *  affected the interface control variables.  In either case, it may be
+ *  necessary to restart the FM application to resync the interface.
+ *
+ *  Value: 165
+ *
+ */
+#define FM_COPY_CHILD_BROKEN_ERR_EID (FM_COPY_CHILD_BASE_EID + FM_CHILD_BROKEN_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Move File Source Filename Error Base ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Move
+ *  command packet with a source filename that is unusable for one
+ *  of several reasons.
+ *
+ *  Value: 166
+ */
+#define FM_MOVE_SRC_BASE_EID (FM_COPY_CHILD_BASE_EID + FM_CHILD_NUM_OFFSETS)
+
+/**
+ * \brief FM Child Task Move File Source Filename Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Move
+ *  command packet with an invalid source filename.
+ *
+ *  Value: 166
+ */
+#define FM_MOVE_SRC_INVALID_ERR_EID (FM_MOVE_SRC_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Move File Source File Does Not Exist Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Move
+ *  command packet with a source filename that does not exist.
+ *
+ *  Value: 167
+ */
+#define FM_MOVE_SRC_DNE_ERR_EID (FM_MOVE_SRC_BASE_EID + FM_FNAME_DNE_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Move File Source Filename Is A Directory Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Move
+ *  command packet with a source filename that is a directory.
+ *
+ *  Value: 168
+ */
+#define FM_MOVE_SRC_ISDIR_ERR_EID (FM_MOVE_SRC_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Move File Target Filename Error Base ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Move
+ *  command packet with a target filename that is unusable for one
+ *  of several reasons.
+ *
+ *  Value: 172
+ */
+#define FM_MOVE_TGT_BASE_EID (FM_MOVE_SRC_BASE_EID + FM_FNAME_NUM_OFFSETS)
+
+/**
+ * \brief FM Child Task Move File Target Filename Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Move
+ *  command packet with an invalid target filename.
+ *
+ *  Value: 172
+ */
+#define FM_MOVE_TGT_INVALID_ERR_EID (FM_MOVE_TGT_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Move File Target File Already Exists Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Move
+ *  command packet with a target filename that already exists
+ *
+ *  Value: 173
+ */
+#define FM_MOVE_TGT_EXIST_ERR_EID (FM_MOVE_TGT_BASE_EID + FM_FNAME_EXIST_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Move File Target Filename Is A Directory Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Move
+ *  command packet with a target filename that is a directory.
+ *
+ *  Value: 174
+ */
+#define FM_MOVE_TGT_ISDIR_ERR_EID (FM_MOVE_TGT_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Move File Target File Exists As An Open File Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Move
+ *  command packet with a target filename that is open.
+ *
+ *  Value: 175
+ */
+#define FM_MOVE_TGT_ISOPEN_ERR_EID (FM_MOVE_TGT_BASE_EID + FM_FNAME_ISOPEN_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Move File Child Task Error Base ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This is the base for any of several messages that are  generated when
+ *  the FM child task command queue interface cannot be used.
+ *
+ *  Value: 178
+ */
+#define FM_MOVE_CHILD_BASE_EID (FM_MOVE_TGT_BASE_EID + FM_FNAME_NUM_OFFSETS)
+
+/**
+ * \brief FM Child Task Move File Child Task Disabled Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the child task is disabled.
+ *
+ *  Value: 178
+ */
+#define FM_MOVE_CHILD_DISABLED_ERR_EID (FM_MOVE_CHILD_BASE_EID + FM_CHILD_DISABLED_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Move File Child Task Queue Full Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the child task comand queue is full.
+ *
+ *  If the child task command queue is full, the problem may be temporary,
+ *  caused by sending too many FM commands too quickly.  If the command
+ *  queue does not empty itself within a reasonable amount of time then
+ *  the child task may be hung. It may be possible to use CFE commands to
+ *  terminate the child task, which should then cause FM to process all
+ *  commands in the main task.
+ *
+ *  Value: 179
+ */
+#define FM_MOVE_CHILD_FULL_ERR_EID (FM_MOVE_CHILD_BASE_EID + FM_CHILD_Q_FULL_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Move File Child Task Inteface Broken Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the interface between the main task
+ *  and child task is broken.
+ *
+ *  If the child task queue is broken then either the handshake interface
+ *  logic is flawed, or there has been some sort of data corruption that
+ *  affected the interface control variables.  In either case, it may be
+ *  necessary to restart the FM application to resync the interface.
+ *
+ *  Value: 180
+ *
+ */
+#define FM_MOVE_CHILD_BROKEN_ERR_EID (FM_MOVE_CHILD_BASE_EID + FM_CHILD_BROKEN_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Rename File Source Filename Error Base ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Rename
+ *  command packet with a source filename that is unusable for one
+ *  of several reasons.
+ *
+ *  Value: 181
+ */
+#define FM_RENAME_SRC_BASE_EID (FM_MOVE_CHILD_BASE_EID + FM_CHILD_NUM_OFFSETS)
+
+/**
+ * \brief FM Child Task Rename File Source Filename Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Rename
+ *  command packet with an invalid source filename.
+ *
+ *  Value: 181
+ */
+#define FM_RENAME_SRC_INVALID_ERR_EID (FM_RENAME_SRC_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Rename File Source File Does Not Exist Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Rename
+ *  command packet with a source filename that does not exist.
+ *
+ *  Value: 182
+ */
+#define FM_RENAME_SRC_DNE_ERR_EID (FM_RENAME_SRC_BASE_EID + FM_FNAME_DNE_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Rename File Source Filename Is Directory Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Rename
+ *  command packet with a source filename that is a directory.
+ *
+ *  Value: 183
+ */
+#define FM_RENAME_SRC_ISDIR_ERR_EID (FM_RENAME_SRC_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Rename File Target Filename Error Base ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Rename
+ *  command packet with a target filename that is unusable for one
+ *  of several reasons.
+ *
+ *  Value: 187
+ */
+#define FM_RENAME_TGT_BASE_EID (FM_RENAME_SRC_BASE_EID + FM_FNAME_NUM_OFFSETS)
+
+/**
+ * \brief FM Child Task Rename File Target Filename Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Rename
+ *  command packet with an invalid target filename.
+ *
+ *  Value: 187
+ */
+#define FM_RENAME_TGT_INVALID_ERR_EID (FM_RENAME_TGT_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Rename File Target File Already Exists Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Rename
+ *  command packet with a target filename that already exists.
+ *
+ *  Value: 188
+ */
+#define FM_RENAME_TGT_EXIST_ERR_EID (FM_RENAME_TGT_BASE_EID + FM_FNAME_EXIST_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Rename File Target Filename Is Directory Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Rename
+ *  command packet with a target filename that is a directory.
+ *
+ *  Value: 189
+ */
+#define FM_RENAME_TGT_ISDIR_ERR_EID (FM_RENAME_TGT_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Rename File Target Filename Exists As Open File Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Rename
+ *  command packet with a target filename that is open.
+ *
+ *  Value: 190
+ */
+#define FM_RENAME_TGT_ISOPEN_ERR_EID (FM_RENAME_TGT_BASE_EID + FM_FNAME_ISOPEN_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Rename File Child Task Error Base ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This is the base for any of several messages that are  generated when
+ *  the FM child task command queue interface cannot be used.
+ *
+ *  Value: 193
+ */
+#define FM_RENAME_CHILD_BASE_EID (FM_RENAME_TGT_BASE_EID + FM_FNAME_NUM_OFFSETS)
+
+/**
+ * \brief FM Child Task Rename File Child Task Disabled Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the child task is disabled.
+ *
+ *  Value: 193
+ */
+#define FM_RENAME_CHILD_DISABLED_ERR_EID (FM_RENAME_CHILD_BASE_EID + FM_CHILD_DISABLED_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Rename File Child Task Queue Full Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the child task comand queue is full.
+ *
+ *  If the child task command queue is full, the problem may be temporary,
+ *  caused by sending too many FM commands too quickly.  If the command
+ *  queue does not empty itself within a reasonable amount of time then
+ *  the child task may be hung. It may be possible to use CFE commands to
+ *  terminate the child task, which should then cause FM to process all
+ *  commands in the main task.
+ *
+ *  Value: 194
+ */
+#define FM_RENAME_CHILD_FULL_ERR_EID (FM_RENAME_CHILD_BASE_EID + FM_CHILD_Q_FULL_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Rename File Child Task Inteface Broken Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the interface between the main task
+ *  and child task is broken.
+ *
+ *  If the child task queue is broken then either the handshake interface
+ *  logic is flawed, or there has been some sort of data corruption that
+ *  affected the interface control variables.  In either case, it may be
+ *  necessary to restart the FM application to resync the interface.
+ *
+ *  Value: 195
+ *
+ */
+#define FM_RENAME_CHILD_BROKEN_ERR_EID (FM_RENAME_CHILD_BASE_EID + FM_CHILD_BROKEN_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Delete File Source Filename Error Base ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Delete
+ *  command packet with a source filename that is unusable for one
+ *  of several reasons.
+ *
+ *  Value: 196
+ */
+#define FM_DELETE_SRC_BASE_EID (FM_RENAME_CHILD_BASE_EID + FM_CHILD_NUM_OFFSETS)
+
+/**
+ * \brief FM Child Task Delete File Source Filename Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Delete
+ *  command packet with an invalid source filename.
+ *
+ *  Value: 196
+ */
+#define FM_DELETE_SRC_INVALID_ERR_EID (FM_DELETE_SRC_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Delete File Source File Does Not Exist Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Delete
+ *  command packet with a source filename that does not exist.
+ *
+ *  Value: 197
+ */
+#define FM_DELETE_SRC_DNE_ERR_EID (FM_DELETE_SRC_BASE_EID + FM_FNAME_DNE_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Delete File Source Filename Is Directory Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Delete
+ *  command packet with a source filename that is a directory.
+ *
+ *  Value: 198
+ */
+#define FM_DELETE_SRC_ISDIR_ERR_EID (FM_DELETE_SRC_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Delete File File Is Open Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Delete
+ *  command packet with a source filename that is already open.
+ *
+ *  Value: 199
+ */
+#define FM_DELETE_SRC_OPEN_ERR_EID (FM_DELETE_SRC_BASE_EID + FM_FNAME_ISOPEN_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Delete File Child Task Error Base ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This is the base for any of several messages that are  generated when
+ *  the FM child task command queue interface cannot be used.
+ *
+ *  Value: 202
+ */
+#define FM_DELETE_CHILD_BASE_EID (FM_DELETE_SRC_BASE_EID + FM_FNAME_NUM_OFFSETS)
+
+/**
+ * \brief FM Child Task Delete File Child Task Disabled Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the child task is disabled.
+ *
+ *  Value: 202
+ */
+#define FM_DELETE_CHILD_DISABLED_ERR_EID (FM_DELETE_CHILD_BASE_EID + FM_CHILD_DISABLED_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Delete File Child Task Queue Full Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the child task comand queue is full.
+ *
+ *  If the child task command queue is full, the problem may be temporary,
+ *  caused by sending too many FM commands too quickly.  If the command
+ *  queue does not empty itself within a reasonable amount of time then
+ *  the child task may be hung. It may be possible to use CFE commands to
+ *  terminate the child task, which should then cause FM to process all
+ *  commands in the main task.
+ *
+ *  Value: 203
+ */
+#define FM_DELETE_CHILD_FULL_ERR_EID (FM_DELETE_CHILD_BASE_EID + FM_CHILD_Q_FULL_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Delete File Child Task Inteface Broken Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the interface between the main task
+ *  and child task is broken.
+ *
+ *  If the child task queue is broken then either the handshake interface
+ *  logic is flawed, or there has been some sort of data corruption that
+ *  affected the interface control variables.  In either case, it may be
+ *  necessary to restart the FM application to resync the interface.
+ *
+ *  Value: 204
+ *
+ */
+#define FM_DELETE_CHILD_BROKEN_ERR_EID (FM_DELETE_CHILD_BASE_EID + FM_CHILD_BROKEN_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Delete All Files Directory Error Base ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_DeleteAll
+ *  command packet with a directory name that is unusable for one
+ *  of several reasons.
+ *
+ *  Value: 205
+ */
+#define FM_DELETE_ALL_SRC_BASE_EID (FM_DELETE_CHILD_BASE_EID + FM_CHILD_NUM_OFFSETS)
+
+/**
+ * \brief FM Child Task Delete All Files Directory Name Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Delete
+ *  command packet with an invalid source filename.
+ *
+ *  Value: 205
+ */
+#define FM_DELETE_ALL_SRC_INVALID_ERR_EID (FM_DELETE_ALL_SRC_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Delete All Files Directory Does Not Exist Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_DeleteAll
+ *  command packet with a directory name that does not exist.
+ *
+ *  Value: 206
+ */
+#define FM_DELETE_ALL_SRC_DNE_ERR_EID (FM_DELETE_ALL_SRC_BASE_EID + FM_FNAME_DNE_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Delete All Files Directory Name Is A File Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Delete
+ *  command packet with a directory name that is a file.
+ *
+ *  Value: 207
+ */
+#define FM_DELETE_ALL_SRC_FILE_ERR_EID (FM_DELETE_ALL_SRC_BASE_EID + FM_FNAME_ISFILE_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Delete All Files Child Task Error Base ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This is the base for any of several messages that are  generated when
+ *  the FM child task command queue interface cannot be used.
+ *
+ *  Value: 211
+ */
+#define FM_DELETE_ALL_CHILD_BASE_EID (FM_DELETE_ALL_SRC_BASE_EID + FM_FNAME_NUM_OFFSETS)
+
+/**
+ * \brief FM Child Task Delete All Files Child Task Disabled Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the child task is disabled.
+ *
+ *  Value: 211
+ */
+#define FM_DELETE_ALL_CHILD_DISABLED_ERR_EID (FM_DELETE_ALL_CHILD_BASE_EID + FM_CHILD_DISABLED_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Delete All Files Child Task Queue Full Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the child task comand queue is full.
+ *
+ *  If the child task command queue is full, the problem may be temporary,
+ *  caused by sending too many FM commands too quickly.  If the command
+ *  queue does not empty itself within a reasonable amount of time then
+ *  the child task may be hung. It may be possible to use CFE commands to
+ *  terminate the child task, which should then cause FM to process all
+ *  commands in the main task.
+ *
+ *  Value: 212
+ */
+#define FM_DELETE_ALL_CHILD_FULL_ERR_EID (FM_DELETE_ALL_CHILD_BASE_EID + FM_CHILD_Q_FULL_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Delete All Files Child Task Inteface Broken Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the interface between the main task
+ *  and child task is broken.
+ *
+ *  If the child task queue is broken then either the handshake interface
+ *  logic is flawed, or there has been some sort of data corruption that
+ *  affected the interface control variables.  In either case, it may be
+ *  necessary to restart the FM application to resync the interface.
+ *
+ *  Value: 213
+ *
+ */
+#define FM_DELETE_ALL_CHILD_BROKEN_ERR_EID (FM_DELETE_ALL_CHILD_BASE_EID + FM_CHILD_BROKEN_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Decompress File Source Filename Error Base ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Decompress
+ *  command packet with a source filename that is unusable for one
+ *  of several reasons.
+ *
+ *  Value: 214
+ */
+#define FM_DECOM_SRC_BASE_EID (FM_DELETE_ALL_CHILD_BASE_EID + FM_CHILD_NUM_OFFSETS)
+
+/**
+ * \brief FM Child Task Decompress File Source Filename Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Decompress
+ *  command packet with an invalid source filename.
+ *
+ *  Value: 214
+ */
+#define FM_DECOM_SRC_INVALID_ERR_EID (FM_DECOM_SRC_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Decompress File Source Filename Does Not Exist Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Decompress
+ *  command packet with a source filename that does not exist.
+ *
+ *  Value: 215
+ */
+#define FM_DECOM_SRC_DNE_ERR_EID (FM_DECOM_SRC_BASE_EID + FM_FNAME_DNE_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Decompress File Source Filename Is A Directory Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Decompress
+ *  command packet with a source filename that is a directory.
+ *
+ *  Value: 216
+ */
+#define FM_DECOM_SRC_ISDIR_ERR_EID (FM_DECOM_SRC_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Decompress File Source File Is Open Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Decompress
+ *  command packet with a source filename that is already open.
+ *
+ *  Value: 217
+ */
+#define FM_DECOM_SRC_OPEN_ERR_EID (FM_DECOM_SRC_BASE_EID + FM_FNAME_ISOPEN_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Decompress File Target Filename Error Base ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Decompress
+ *  command packet with a target filename that is unusable for one
+ *  of several reasons.
+ *
+ *  Value: 220
+ */
+#define FM_DECOM_TGT_BASE_EID (FM_DECOM_SRC_BASE_EID + FM_FNAME_NUM_OFFSETS)
+
+/**
+ * \brief FM Child Task Decompress File Target Filename Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Decompress
+ *  command packet with an invalid target filename.
+ *
+ *  Value: 220
+ */
+#define FM_DECOM_TGT_INVALID_ERR_EID (FM_DECOM_TGT_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Decompress File Target File Already Exists Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Decompress
+ *  command packet with a target filename that already exists.
+ *
+ *  Value: 221
+ */
+#define FM_DECOM_TGT_EXIST_ERR_EID (FM_DECOM_TGT_BASE_EID + FM_FNAME_EXIST_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Decompress File Target Filename Is Directory Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Decompress
+ *  command packet with a target filename that is a directory.
+ *
+ *  Value: 222
+ */
+#define FM_DECOM_TGT_ISDIR_ERR_EID (FM_DECOM_TGT_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Decompress File Child Task Error Base ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This is the base for any of several messages that are  generated when
+ *  the FM child task command queue interface cannot be used.
+ *
+ *  Value: 226
+ */
+#define FM_DECOM_CHILD_BASE_EID (FM_DECOM_TGT_BASE_EID + FM_FNAME_NUM_OFFSETS)
+
+/**
+ * \brief FM Child Task Decompress File Child Task Disabled Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the child task is disabled.
+ *
+ *  Value: 226
+ */
+#define FM_DECOM_CHILD_DISABLED_ERR_EID (FM_DECOM_CHILD_BASE_EID + FM_CHILD_DISABLED_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Decompress File Child Task Queue Full Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the child task comand queue is full.
+ *
+ *  If the child task command queue is full, the problem may be temporary,
+ *  caused by sending too many FM commands too quickly.  If the command
+ *  queue does not empty itself within a reasonable amount of time then
+ *  the child task may be hung. It may be possible to use CFE commands to
+ *  terminate the child task, which should then cause FM to process all
+ *  commands in the main task.
+ *
+ *  Value: 227
+ */
+#define FM_DECOM_CHILD_FULL_ERR_EID (FM_DECOM_CHILD_BASE_EID + FM_CHILD_Q_FULL_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Decompress File Child Task Inteface Broken Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the interface between the main task
+ *  and child task is broken.
+ *
+ *  If the child task queue is broken then either the handshake interface
+ *  logic is flawed, or there has been some sort of data corruption that
+ *  affected the interface control variables.  In either case, it may be
+ *  necessary to restart the FM application to resync the interface.
+ *
+ *  Value: 228
+ *
+ */
+#define FM_DECOM_CHILD_BROKEN_ERR_EID (FM_DECOM_CHILD_BASE_EID + FM_CHILD_BROKEN_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Concat Files Source 1 Filename Error Base ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Concat
+ *  command packet with a source 1 filename that is unusable for one
+ *  of several reasons.
+ *
+ *  Value: 229
+ */
+#define FM_CONCAT_SRC1_BASE_EID (FM_DECOM_CHILD_BASE_EID + FM_CHILD_NUM_OFFSETS)
+
+/**
+ * \brief FM Child Task Concat Files Source 1 Filename Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Concat
+ *  command packet with an invalid source 1 filename.
+ *
+ *  Value: 229
+ */
+#define FM_CONCAT_SRC1_INVALID_ERR_EID (FM_CONCAT_SRC1_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Concat Files Source 1 File Does Not Exist Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Concat
+ *  command packet with a source 1 filename that does not exist.
+ *
+ *  Value: 230
+ */
+#define FM_CONCAT_SRC1_DNE_ERR_EID (FM_CONCAT_SRC1_BASE_EID + FM_FNAME_DNE_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Concat Files Source 1 Filename Is Directory Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Concat
+ *  command packet with a source filename that is a directory.
+ *
+ *  Value: 231
+ */
+#define FM_CONCAT_SRC1_ISDIR_ERR_EID (FM_CONCAT_SRC1_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Concat Files Source 1 File Already Open Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Concat
+ *  command packet with a source filename that is already open.
+ *
+ *  Value: 232
+ */
+#define FM_CONCAT_SRC1_OPEN_ERR_EID (FM_CONCAT_SRC1_BASE_EID + FM_FNAME_ISOPEN_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Concat Files Source 2 Filename Error Base ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Concat
+ *  command packet with a source 2 filename that is unusable for one
+ *  of several reasons.
+ *
+ *  Value: 235
+ */
+#define FM_CONCAT_SRC2_BASE_EID (FM_CONCAT_SRC1_BASE_EID + FM_FNAME_NUM_OFFSETS)
+
+/**
+ * \brief FM Child Task Concat Files Source 2 Filename Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Concat
+ *  command packet with an invalid source 2 filename.
+ *
+ *  Value: 235
+ */
+#define FM_CONCAT_SRC2_INVALID_ERR_EID (FM_CONCAT_SRC2_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Concat Files Source 2 File Does Not Exist Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Concat
+ *  command packet with a source 2 filename that does not exist.
+ *
+ *  Value: 236
+ */
+#define FM_CONCAT_SRC2_DNE_ERR_EID (FM_CONCAT_SRC2_BASE_EID + FM_FNAME_DNE_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Concat Files Source 2 Filename Is Directory Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Concat
+ *  command packet with a source filename that is a directory.
+ *
+ *  Value: 237
+ */
+#define FM_CONCAT_SRC2_ISDIR_ERR_EID (FM_CONCAT_SRC2_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Concat Files Source 2 File Already Open Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Concat
+ *  command packet with a source filename that is already open.
+ *
+ *  Value: 238
+ */
+#define FM_CONCAT_SRC2_OPEN_ERR_EID (FM_CONCAT_SRC2_BASE_EID + FM_FNAME_ISOPEN_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Concat Files Target Filename Error Base ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Concat
+ *  command packet with a target filename that is unusable for one
+ *  of several reasons.
+ *
+ *  Value: 241
+ */
+#define FM_CONCAT_TGT_BASE_EID (FM_CONCAT_SRC2_BASE_EID + FM_FNAME_NUM_OFFSETS)
+
+/**
+ * \brief FM Child Task Concat Files Target Filename Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Concat
+ *  command packet with an invalid target filename.
+ *
+ *  Value: 241
+ */
+#define FM_CONCAT_TGT_INVALID_ERR_EID (FM_CONCAT_TGT_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Concat Files Target Filename Already Exists Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Concat
+ *  command packet with a target filename that already exists.
+ *
+ *  Value: 242
+ */
+#define FM_CONCAT_TGT_EXIST_ERR_EID (FM_CONCAT_TGT_BASE_EID + FM_FNAME_EXIST_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Concat Files Target Filename Is Directory Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Concat
+ *  command packet with a target filename that is a directory.
+ *
+ *  Value: 243
+ */
+#define FM_CONCAT_TGT_ISDIR_ERR_EID (FM_CONCAT_TGT_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Concat Files Child Task Error Base ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This is the base for any of several messages that are generated when
+ *  the FM child task command queue interface cannot be used.
+ *
+ *  Value: 247
+ */
+#define FM_CONCAT_CHILD_BASE_EID (FM_CONCAT_TGT_BASE_EID + FM_FNAME_NUM_OFFSETS)
+
+/**
+ * \brief FM Child Task Concat Files Child Task Disabled Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the child task is disabled.
+ *
+ *  Value: 247
+ */
+#define FM_CONCAT_CHILD_DISABLED_ERR_EID (FM_CONCAT_CHILD_BASE_EID + FM_CHILD_DISABLED_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Concat Files Child Task Queue Full Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the child task comand queue is full.
+ *
+ *  If the child task command queue is full, the problem may be temporary,
+ *  caused by sending too many FM commands too quickly.  If the command
+ *  queue does not empty itself within a reasonable amount of time then
+ *  the child task may be hung. It may be possible to use CFE commands to
+ *  terminate the child task, which should then cause FM to process all
+ *  commands in the main task.
+ *
+ *  Value: 248
+ */
+#define FM_CONCAT_CHILD_FULL_ERR_EID (FM_CONCAT_CHILD_BASE_EID + FM_CHILD_Q_FULL_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Concat Files Child Task Inteface Broken Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the interface between the main task
+ *  and child task is broken.
+ *
+ *  If the child task queue is broken then either the handshake interface
+ *  logic is flawed, or there has been some sort of data corruption that
+ *  affected the interface control variables.  In either case, it may be
+ *  necessary to restart the FM application to resync the interface.
+ *
+ *  Value: 249
+ *
+ */
+#define FM_CONCAT_CHILD_BROKEN_ERR_EID (FM_CONCAT_CHILD_BASE_EID + FM_CHILD_BROKEN_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Get File Info Child Task Error Base ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This is the base for any of several messages that are generated when
+ *  the FM child task command queue interface cannot be used.
+ *
+ *  Value: 250
+ */
+#define FM_FILE_INFO_CHILD_BASE_EID (FM_CONCAT_CHILD_BASE_EID + FM_CHILD_NUM_OFFSETS)
+
+/**
+ * \brief FM Child Task Get File Info Child Task Disabled Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the child task is disabled.
+ *
+ *  Value: 250
+ */
+#define FM_FILE_INFO_CHILD_DISABLED_ERR_EID (FM_FILE_INFO_CHILD_BASE_EID + FM_CHILD_DISABLED_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Get File Info Child Task Queue Full Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the child task comand queue is full.
+ *
+ *  If the child task command queue is full, the problem may be temporary,
+ *  caused by sending too many FM commands too quickly.  If the command
+ *  queue does not empty itself within a reasonable amount of time then
+ *  the child task may be hung. It may be possible to use CFE commands to
+ *  terminate the child task, which should then cause FM to process all
+ *  commands in the main task.
+ *
+ *  Value: 251
+ */
+#define FM_FILE_INFO_CHILD_FULL_ERR_EID (FM_FILE_INFO_CHILD_BASE_EID + FM_CHILD_Q_FULL_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Get File Info Child Task Inteface Broken Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the interface between the main task
+ *  and child task is broken.
+ *
+ *  If the child task queue is broken then either the handshake interface
+ *  logic is flawed, or there has been some sort of data corruption that
+ *  affected the interface control variables.  In either case, it may be
+ *  necessary to restart the FM application to resync the interface.
+ *
+ *  Value: 252
+ *
+ */
+#define FM_FILE_INFO_CHILD_BROKEN_ERR_EID (FM_FILE_INFO_CHILD_BASE_EID + FM_CHILD_BROKEN_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Create Directory, Directory Error Base ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Create
+ *  command packet with a directory name that is unusable for one
+ *  of several reasons.
+ *
+ *  Value: 253
+ */
+#define FM_CREATE_DIR_SRC_BASE_EID (FM_FILE_INFO_CHILD_BASE_EID + FM_CHILD_NUM_OFFSETS)
+
+/**
+ * \brief FM Child Task Create Directory Name Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Create
+ *  command packet with an invalid directory name.
+ *
+ *  Value: 253
+ */
+#define FM_CREATE_DIR_SRC_INVALID_ERR_EID (FM_CREATE_DIR_SRC_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Create Directory Name Exists As File Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Create
+ *  command packet with a directory name that exists as a file.
+ *
+ *  Value: 254
+ */
+#define FM_CREATE_DIR_SRC_DNE_ERR_EID (FM_CREATE_DIR_SRC_BASE_EID + FM_FNAME_DNE_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Create Directory Already Exists Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_Create
+ *  command pasket with a directory that already exists.
+ *
+ *  Value: 255
+ */
+#define FM_CREATE_DIR_SRC_ISDIR_ERR_EID (FM_CREATE_DIR_SRC_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Create Directory Child Task Error Base ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This is the base for any of several messages that are generated when
+ *  the FM child task command queue interface cannot be used.
+ *
+ *  Value: 259
+ */
+#define FM_CREATE_DIR_CHILD_BASE_EID (FM_CREATE_DIR_SRC_BASE_EID + FM_FNAME_NUM_OFFSETS)
+
+/**
+ * \brief FM Child Task Create Directory Child Task Disabled Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the child task is disabled.
+ *
+ *  Value: 259
+ */
+#define FM_CREATE_DIR_CHILD_DISABLED_ERR_EID (FM_CREATE_DIR_CHILD_BASE_EID + FM_CHILD_DISABLED_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Create Directory Child Task Queue Full Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the child task comand queue is full.
+ *
+ *  If the child task command queue is full, the problem may be temporary,
+ *  caused by sending too many FM commands too quickly.  If the command
+ *  queue does not empty itself within a reasonable amount of time then
+ *  the child task may be hung. It may be possible to use CFE commands to
+ *  terminate the child task, which should then cause FM to process all
+ *  commands in the main task.
+ *
+ *  Value: 260
+ */
+#define FM_CREATE_DIR_CHILD_FULL_ERR_EID (FM_CREATE_DIR_CHILD_BASE_EID + FM_CHILD_Q_FULL_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Create Directory Child Task Inteface Broken Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the interface between the main task
+ *  and child task is broken.
+ *
+ *  If the child task queue is broken then either the handshake interface
+ *  logic is flawed, or there has been some sort of data corruption that
+ *  affected the interface control variables.  In either case, it may be
+ *  necessary to restart the FM application to resync the interface.
+ *
+ *  Value: 261
+ *
+ */
+#define FM_CREATE_DIR_CHILD_BROKEN_ERR_EID (FM_CREATE_DIR_CHILD_BASE_EID + FM_CHILD_BROKEN_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Delete Directory, Directory Error Base ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_DeleteDir
+ *  command packet with a directory name that is unusable for one
+ *  of several reasons.
+ *
+ *  Value: 262
+ */
+#define FM_DELETE_DIR_SRC_BASE_EID (FM_CREATE_DIR_CHILD_BASE_EID + FM_CHILD_NUM_OFFSETS)
+
+/**
+ * \brief FM Child Task Delete Directory Name Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_DeleteDir
+ *  command packet with an invalid directory name.
+ *
+ *  Value: 262
+ */
+#define FM_DELETE_DIR_SRC_INVALID_ERR_EID (FM_DELETE_DIR_SRC_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Delete Directory Name Exists As File Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_DeleteDir
+ *  command packet with a directory name that exists as a file.
+ *
+ *  Value: 263
+ */
+#define FM_DELETE_DIR_SRC_DNE_ERR_EID (FM_DELETE_DIR_SRC_BASE_EID + FM_FNAME_DNE_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Delete Directory Child Task Error Base ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This is the base for any of several messages that are generated when
+ *  the FM child task command queue interface cannot be used.
+ *
+ *  Value: 268
+ */
+#define FM_DELETE_DIR_CHILD_BASE_EID (FM_DELETE_DIR_SRC_BASE_EID + FM_FNAME_NUM_OFFSETS)
 
 /**
- * \brief FM Child Task Rename File Child Task Disabled Event ID
+ * \brief FM Child Task Delete Directory Child Task Disabled Event ID
  *
  *  \par Type: ERROR
  *
@@ -2075,12 +3681,12 @@
  *  This event message is generated when the FM child task command queue
  *  interface cannot be used because the child task is disabled.
  *
- *  Value: 193
+ *  Value: 268
  */
-#define FM_RENAME_CHILD_DISABLED_ERR_EID (FM_RENAME_CHILD_BASE_EID + FM_CHILD_DISABLED_EID_OFFSET)
+#define FM_DELETE_DIR_CHILD_DISABLED_ERR_EID (FM_DELETE_DIR_CHILD_BASE_EID + FM_CHILD_DISABLED_EID_OFFSET)
 
 /**
- * \brief FM Child Task Rename File Child Task Queue Full Event ID
+ * \brief FM Child Task Delete Directory Child Task Queue Full Event ID
  *
  *  \par Type: ERROR
  *
@@ -2096,12 +3702,12 @@
  *  terminate the child task, which should then cause FM to process all
  *  commands in the main task.
  *
- *  Value: 194
+ *  Value: 269
  */
-#define FM_RENAME_CHILD_FULL_ERR_EID (FM_RENAME_CHILD_BASE_EID + FM_CHILD_Q_FULL_EID_OFFSET)
+#define FM_DELETE_DIR_CHILD_FULL_ERR_EID (FM_DELETE_DIR_CHILD_BASE_EID + FM_CHILD_Q_FULL_EID_OFFSET)
 
 /**
- * \brief FM Child Task Rename File Child Task Inteface Broken Event ID
+ * \brief FM Child Task Delete Directory Child Task Inteface Broken Event ID
  *
  *  \par Type: ERROR
  *
@@ -2116,84 +3722,113 @@
  *  affected the interface control variables.  In either case, it may be
  *  necessary to restart the FM application to resync the interface.
  *
- *  Value: 195
+ *  Value: 270
  *
  */
-#define FM_RENAME_CHILD_BROKEN_ERR_EID (FM_RENAME_CHILD_BASE_EID + FM_CHILD_BROKEN_EID_OFFSET)
+#define FM_DELETE_DIR_CHILD_BROKEN_ERR_EID (FM_DELETE_DIR_CHILD_BASE_EID + FM_CHILD_BROKEN_EID_OFFSET)
 
 /**
- * \brief FM Child Task Delete File Source Filename Error Base ID
+ * \brief FM Child Task Directory List to File Source Filename Error Base ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Delete
- *  command packet with a source filename that is unusable for one
+ *  This event message is generated upon receipt of a /FM_GetDirFile
+ *  command packet with a source directory name that is unusable for one
  *  of several reasons.
  *
- *  Value: 196
+ *  Value: 271
  */
-#define FM_DELETE_SRC_BASE_EID (FM_RENAME_CHILD_BASE_EID + FM_CHILD_NUM_OFFSETS)
+#define FM_GET_DIR_FILE_SRC_BASE_EID (FM_DELETE_DIR_CHILD_BASE_EID + FM_CHILD_NUM_OFFSETS)
 
 /**
- * \brief FM Child Task Delete File Source Filename Invalid Event ID
+ * \brief FM Child Task Directory List to File Directory Name Invalid Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Delete
- *  command packet with an invalid source filename.
+ *  This event message is generated upon receipt of a /FM_GetDirFile
+ *  command packet with an invalid source directory name.
  *
- *  Value: 196
+ *  Value: 271
  */
-#define FM_DELETE_SRC_INVALID_ERR_EID (FM_DELETE_SRC_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+#define FM_GET_DIR_FILE_SRC_INVALID_ERR_EID (FM_GET_DIR_FILE_SRC_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
 
 /**
- * \brief FM Child Task Delete File Source File Does Not Exist Event ID
+ * \brief FM Child Task Directory List to File Directory Does Not Exist Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Delete
- *  command packet with a source filename that does not exist.
+ *  This event message is generated upon receipt of a /FM_GetDirFile
+ *  command packet with a source directory name that does not exist.
  *
- *  Value: 197
+ *  Value: 272
  */
-#define FM_DELETE_SRC_DNE_ERR_EID (FM_DELETE_SRC_BASE_EID + FM_FNAME_DNE_EID_OFFSET)
+#define FM_GET_DIR_FILE_SRC_DNE_ERR_EID (FM_GET_DIR_FILE_SRC_BASE_EID + FM_FNAME_DNE_EID_OFFSET)
 
 /**
- * \brief FM Child Task Delete File Source Filename Is Directory Event ID
+ * \brief FM Child Task Directory List to File Directory Name Is File Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Delete
- *  command packet with a source filename that is a directory.
+ *  This event message is generated upon receipt of a /FM_GetDirFile
+ *  command packet with a source directory name that is a file.
  *
- *  Value: 198
+ *  Value: 273
  */
-#define FM_DELETE_SRC_ISDIR_ERR_EID (FM_DELETE_SRC_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
+#define FM_GET_DIR_FILE_SRC_ISDIR_ERR_EID (FM_GET_DIR_FILE_SRC_BASE_EID + FM_FNAME_ISFILE_EID_OFFSET)
 
 /**
- * \brief FM Child Task Delete File File Is Open Event ID
+ * \brief FM Child Task Directory List to File Target Error Base ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Delete
- *  command packet with a source filename that is already open.
+ *  This event message is generated upon receipt of a /FM_GetDirFile
+ *  command packet with a target filename that is unusable for one
+ *  of several reasons.
  *
- *  Value: 199
+ *  Value: 277
  */
-#define FM_DELETE_SRC_OPEN_ERR_EID (FM_DELETE_SRC_BASE_EID + FM_FNAME_ISOPEN_EID_OFFSET)
+#define FM_GET_DIR_FILE_TGT_BASE_EID (FM_GET_DIR_FILE_SRC_BASE_EID + FM_FNAME_NUM_OFFSETS)
 
 /**
- * \brief FM Child Task Delete File Child Task Error Base ID
+ * \brief FM Child Task Directory List to File Target Filename Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_GetDirFile
+ *  command packet with an invalid target file name.
+ *
+ *  Value: 277
+ */
+#define FM_GET_DIR_FILE_TGT_INVALID_ERR_EID (FM_GET_DIR_FILE_TGT_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Directory List to File Target Filename Is Directory Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_GetDirFile
+ *  command packet with a target filename that is a directory.
+ *
+ *  Value: 279
+ */
+#define FM_GET_DIR_FILE_TGT_ISDIR_ERR_EID (FM_GET_DIR_FILE_TGT_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Directory List to File Child Task Error Base ID
  *
  *  \par Type: ERROR
  *
@@ -2202,12 +3837,12 @@
  *  This is the base for any of several messages that are  generated when
  *  the FM child task command queue interface cannot be used.
  *
- *  Value: 202
+ *  Value: 283
  */
-#define FM_DELETE_CHILD_BASE_EID (FM_DELETE_SRC_BASE_EID + FM_FNAME_NUM_OFFSETS)
+#define FM_GET_DIR_FILE_CHILD_BASE_EID (FM_GET_DIR_FILE_TGT_BASE_EID + FM_FNAME_NUM_OFFSETS)
 
 /**
- * \brief FM Child Task Delete File Child Task Disabled Event ID
+ * \brief FM Child Task Directory List to File Child Task Disabled Event ID
  *
  *  \par Type: ERROR
  *
@@ -2216,12 +3851,12 @@
  *  This event message is generated when the FM child task command queue
  *  interface cannot be used because the child task is disabled.
  *
- *  Value: 202
+ *  Value: 283
  */
-#define FM_DELETE_CHILD_DISABLED_ERR_EID (FM_DELETE_CHILD_BASE_EID + FM_CHILD_DISABLED_EID_OFFSET)
+#define FM_GET_DIR_FILE_CHILD_DISABLED_ERR_EID (FM_GET_DIR_FILE_CHILD_BASE_EID + FM_CHILD_DISABLED_EID_OFFSET)
 
 /**
- * \brief FM Child Task Delete File Child Task Queue Full Event ID
+ * \brief FM Child Task Directory List to File Child Task Queue Full Event ID
  *
  *  \par Type: ERROR
  *
@@ -2237,12 +3872,12 @@
  *  terminate the child task, which should then cause FM to process all
  *  commands in the main task.
  *
- *  Value: 203
+ *  Value: 284
  */
-#define FM_DELETE_CHILD_FULL_ERR_EID (FM_DELETE_CHILD_BASE_EID + FM_CHILD_Q_FULL_EID_OFFSET)
+#define FM_GET_DIR_FILE_CHILD_FULL_ERR_EID (FM_GET_DIR_FILE_CHILD_BASE_EID + FM_CHILD_Q_FULL_EID_OFFSET)
 
 /**
- * \brief FM Child Task Delete File Child Task Inteface Broken Event ID
+ * \brief FM Child Task Directory List to File Child Task Inteface Broken Event ID
  *
  *  \par Type: ERROR
  *
@@ -2257,70 +3892,70 @@
  *  affected the interface control variables.  In either case, it may be
  *  necessary to restart the FM application to resync the interface.
  *
- *  Value: 204
+ *  Value: 285
  *
  */
-#define FM_DELETE_CHILD_BROKEN_ERR_EID (FM_DELETE_CHILD_BASE_EID + FM_CHILD_BROKEN_EID_OFFSET)
+#define FM_GET_DIR_FILE_CHILD_BROKEN_ERR_EID (FM_GET_DIR_FILE_CHILD_BASE_EID + FM_CHILD_BROKEN_EID_OFFSET)
 
 /**
- * \brief FM Child Task Delete All Files Directory Error Base ID
+ * \brief FM Child Task Directory List to Packet Directory Error Base ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_DeleteAll
- *  command packet with a directory name that is unusable for one
+ *  This event message is generated upon receipt of a /FM_GetDirPkt
+ *  command packet with a source directory name that is unusable for one
  *  of several reasons.
  *
- *  Value: 205
+ *  Value: 286
  */
-#define FM_DELETE_ALL_SRC_BASE_EID (FM_DELETE_CHILD_BASE_EID + FM_CHILD_NUM_OFFSETS)
+#define FM_GET_DIR_PKT_SRC_BASE_EID (FM_GET_DIR_FILE_CHILD_BASE_EID + FM_CHILD_NUM_OFFSETS)
 
 /**
- * \brief FM Child Task Delete All Files Directory Name Invalid Event ID
+ * \brief FM Child Task Directory List to Packet Directory Name Invalid Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Delete
- *  command packet with an invalid source filename.
+ *  This event message is generated upon receipt of a /FM_GetDirPkt
+ *  command packet with an invalid source directory name.
  *
- *  Value: 205
+ *  Value: 286
  */
-#define FM_DELETE_ALL_SRC_INVALID_ERR_EID (FM_DELETE_ALL_SRC_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+#define FM_GET_DIR_PKT_SRC_INVALID_ERR_EID (FM_GET_DIR_PKT_SRC_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
 
 /**
- * \brief FM Child Task Delete All Files Directory Does Not Exist Event ID
+ * \brief FM Child Task Directory List to Packet Directory Does Not Exist Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_DeleteAll
- *  command packet with a directory name that does not exist.
+ *  This event message is generated upon receipt of a /FM_GetDirPkt
+ *  command packet with a source directory name that does not exist.
  *
- *  Value: 206
+ *  Value: 287
  */
-#define FM_DELETE_ALL_SRC_DNE_ERR_EID (FM_DELETE_ALL_SRC_BASE_EID + FM_FNAME_DNE_EID_OFFSET)
+#define FM_GET_DIR_PKT_SRC_DNE_ERR_EID (FM_GET_DIR_PKT_SRC_BASE_EID + FM_FNAME_DNE_EID_OFFSET)
 
 /**
- * \brief FM Child Task Delete All Files Directory Name Is A File Event ID
+ * \brief FM Child Task Directory List to Packet Directory Is File Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Delete
- *  command packet with a directory name that is a file.
+ *  This event message is generated upon receipt of a /FM_GetDirPkt
+ *  command packet with a source directory name that is a file.
  *
- *  Value: 207
+ *  Value: 288
  */
-#define FM_DELETE_ALL_SRC_FILE_ERR_EID (FM_DELETE_ALL_SRC_BASE_EID + FM_FNAME_ISFILE_EID_OFFSET)
+#define FM_GET_DIR_PKT_SRC_ISDIR_ERR_EID (FM_GET_DIR_PKT_SRC_BASE_EID + FM_FNAME_ISFILE_EID_OFFSET)
 
 /**
- * \brief FM Child Task Delete All Files Child Task Error Base ID
+ * \brief FM Child Task Directory List to Packet Child Task Error Base ID
  *
  *  \par Type: ERROR
  *
@@ -2329,12 +3964,12 @@
  *  This is the base for any of several messages that are  generated when
  *  the FM child task command queue interface cannot be used.
  *
- *  Value: 211
+ *  Value: 292
  */
-#define FM_DELETE_ALL_CHILD_BASE_EID (FM_DELETE_ALL_SRC_BASE_EID + FM_FNAME_NUM_OFFSETS)
+#define FM_GET_DIR_PKT_CHILD_BASE_EID (FM_GET_DIR_PKT_SRC_BASE_EID + FM_FNAME_NUM_OFFSETS)
 
 /**
- * \brief FM Child Task Delete All Files Child Task Disabled Event ID
+ * \brief FM Child Task Directory List to Packet Child Task Disabled Event ID
  *
  *  \par Type: ERROR
  *
@@ -2343,12 +3978,12 @@
  *  This event message is generated when the FM child task command queue
  *  interface cannot be used because the child task is disabled.
  *
- *  Value: 211
+ *  Value: 292
  */
-#define FM_DELETE_ALL_CHILD_DISABLED_ERR_EID (FM_DELETE_ALL_CHILD_BASE_EID + FM_CHILD_DISABLED_EID_OFFSET)
+#define FM_GET_DIR_PKT_CHILD_DISABLED_ERR_EID (FM_GET_DIR_PKT_CHILD_BASE_EID + FM_CHILD_DISABLED_EID_OFFSET)
 
 /**
- * \brief FM Child Task Delete All Files Child Task Queue Full Event ID
+ * \brief FM Child Task Directory List to Packet Child Task Queue Full Event ID
  *
  *  \par Type: ERROR
  *
@@ -2364,12 +3999,12 @@
  *  terminate the child task, which should then cause FM to process all
  *  commands in the main task.
  *
- *  Value: 212
+ *  Value: 293
  */
-#define FM_DELETE_ALL_CHILD_FULL_ERR_EID (FM_DELETE_ALL_CHILD_BASE_EID + FM_CHILD_Q_FULL_EID_OFFSET)
+#define FM_GET_DIR_PKT_CHILD_FULL_ERR_EID (FM_GET_DIR_PKT_CHILD_BASE_EID + FM_CHILD_Q_FULL_EID_OFFSET)
 
 /**
- * \brief FM Child Task Delete All Files Child Task Inteface Broken Event ID
+ * \brief FM Child Task Directory List to Packet Child Task Inteface Broken Event ID
  *
  *  \par Type: ERROR
  *
@@ -2384,141 +4019,212 @@
  *  affected the interface control variables.  In either case, it may be
  *  necessary to restart the FM application to resync the interface.
  *
- *  Value: 213
+ *  Value: 294
  *
  */
-#define FM_DELETE_ALL_CHILD_BROKEN_ERR_EID (FM_DELETE_ALL_CHILD_BASE_EID + FM_CHILD_BROKEN_EID_OFFSET)
+#define FM_GET_DIR_PKT_CHILD_BROKEN_ERR_EID (FM_GET_DIR_PKT_CHILD_BASE_EID + FM_CHILD_BROKEN_EID_OFFSET)
 
 /**
- * \brief FM Child Task Decompress File Source Filename Error Base ID
+ * \brief FM Child Task Concat List List Filename Error Base ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Decompress
+ *  This event message is generated upon receipt of a /FM_ConcatList
+ *  command packet with a list filename that is unusable for one
+ *  of several reasons.
+ *
+ *  Value: 295
+ */
+#define FM_CONCAT_LIST_LIST_BASE_EID (FM_GET_DIR_PKT_CHILD_BASE_EID + FM_CHILD_NUM_OFFSETS)
+
+/**
+ * \brief FM Child Task Concat List List Filename Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_ConcatList
+ *  command packet with a list filename that is invalid.
+ *
+ *  Value: 295
+ */
+#define FM_CONCAT_LIST_LIST_INVALID_ERR_EID (FM_CONCAT_LIST_LIST_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Concat List List Filename Does Not Exist Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_ConcatList
+ *  command packet with a list filename that does not exist.
+ *
+ *  Value: 296
+ */
+#define FM_CONCAT_LIST_LIST_DNE_ERR_EID (FM_CONCAT_LIST_LIST_BASE_EID + FM_FNAME_DNE_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Concat List List Filename Is Directory Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_ConcatList
+ *  command packet with a list filename that is a directory.
+ *
+ *  Value: 297
+ */
+#define FM_CONCAT_LIST_LIST_ISDIR_ERR_EID (FM_CONCAT_LIST_LIST_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Concat List List Filename Is Open Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_ConcatList
+ *  command packet with a list filename that is open.
+ *
+ *  Value: 298
+ */
+#define FM_CONCAT_LIST_LIST_OPEN_ERR_EID (FM_CONCAT_LIST_LIST_BASE_EID + FM_FNAME_ISOPEN_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Concat List Source Filename Error Base ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_ConcatList
  *  command packet with a source filename that is unusable for one
  *  of several reasons.
  *
- *  Value: 214
+ *  Value: 301
  */
-#define FM_DECOM_SRC_BASE_EID (FM_DELETE_ALL_CHILD_BASE_EID + FM_CHILD_NUM_OFFSETS)
+#define FM_CONCAT_LIST_SRC_BASE_EID (FM_CONCAT_LIST_LIST_BASE_EID + FM_FNAME_NUM_OFFSETS)
 
 /**
- * \brief FM Child Task Decompress File Source Filename Invalid Event ID
+ * \brief FM Child Task Concat List Source Filename Invalid Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Decompress
- *  command packet with an invalid source filename.
+ *  This event message is generated upon receipt of a /FM_ConcatList
+ *  command packet with a source filename that is invalid.
  *
- *  Value: 214
+ *  Value: 301
  */
-#define FM_DECOM_SRC_INVALID_ERR_EID (FM_DECOM_SRC_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+#define FM_CONCAT_LIST_SRC_INVALID_ERR_EID (FM_CONCAT_LIST_SRC_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
 
 /**
- * \brief FM Child Task Decompress File Source Filename Does Not Exist Event ID
+ * \brief FM Child Task Concat List Source Filename Does Not Exist Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Decompress
+ *  This event message is generated upon receipt of a /FM_ConcatList
  *  command packet with a source filename that does not exist.
  *
- *  Value: 215
+ *  Value: 302
  */
-#define FM_DECOM_SRC_DNE_ERR_EID (FM_DECOM_SRC_BASE_EID + FM_FNAME_DNE_EID_OFFSET)
+#define FM_CONCAT_LIST_SRC_DNE_ERR_EID (FM_CONCAT_LIST_SRC_BASE_EID + FM_FNAME_DNE_EID_OFFSET)
 
 /**
- * \brief FM Child Task Decompress File Source Filename Is A Directory Event ID
+ * \brief FM Child Task Concat List Source Filename Is Directory Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Decompress
+ *  This event message is generated upon receipt of a /FM_ConcatList
  *  command packet with a source filename that is a directory.
  *
- *  Value: 216
+ *  Value: 303
  */
-#define FM_DECOM_SRC_ISDIR_ERR_EID (FM_DECOM_SRC_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
+#define FM_CONCAT_LIST_SRC_ISDIR_ERR_EID (FM_CONCAT_LIST_SRC_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
 
 /**
- * \brief FM Child Task Decompress File Source File Is Open Event ID
+ * \brief FM Child Task Concat List Source Filename Is Open Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Decompress
- *  command packet with a source filename that is already open.
+ *  This event message is generated upon receipt of a /FM_ConcatList
+ *  command packet with a source filename that is open.
  *
- *  Value: 217
+ *  Value: 304
  */
-#define FM_DECOM_SRC_OPEN_ERR_EID (FM_DECOM_SRC_BASE_EID + FM_FNAME_ISOPEN_EID_OFFSET)
+#define FM_CONCAT_LIST_SRC_OPEN_ERR_EID (FM_CONCAT_LIST_SRC_BASE_EID + FM_FNAME_ISOPEN_EID_OFFSET)
 
 /**
- * \brief FM Child Task Decompress File Target Filename Error Base ID
+ * \brief FM Child Task Concat List Target Filename Error Base ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Decompress
+ *  This event message is generated upon receipt of a /FM_ConcatList
  *  command packet with a target filename that is unusable for one
  *  of several reasons.
  *
- *  Value: 220
+ *  Value: 307
  */
-#define FM_DECOM_TGT_BASE_EID (FM_DECOM_SRC_BASE_EID + FM_FNAME_NUM_OFFSETS)
+#define FM_CONCAT_LIST_TGT_BASE_EID (FM_CONCAT_LIST_SRC_BASE_EID + FM_FNAME_NUM_OFFSETS)
 
 /**
- * \brief FM Child Task Decompress File Target Filename Invalid Event ID
+ * \brief FM Child Task Concat List Target Filename Invalid Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Decompress
- *  command packet with an invalid target filename.
+ *  This event message is generated upon receipt of a /FM_ConcatList
+ *  command packet with a target filename that is invalid.
  *
- *  Value: 220
+ *  Value: 307
  */
-#define FM_DECOM_TGT_INVALID_ERR_EID (FM_DECOM_TGT_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+#define FM_CONCAT_LIST_TGT_INVALID_ERR_EID (FM_CONCAT_LIST_TGT_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
 
 /**
- * \brief FM Child Task Decompress File Target File Already Exists Event ID
+ * \brief FM Child Task Concat List Target Filename Exists Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Decompress
+ *  This event message is generated upon receipt of a /FM_ConcatList
  *  command packet with a target filename that already exists.
  *
- *  Value: 221
+ *  Value: 308
  */
-#define FM_DECOM_TGT_EXIST_ERR_EID (FM_DECOM_TGT_BASE_EID + FM_FNAME_EXIST_EID_OFFSET)
+#define FM_CONCAT_LIST_TGT_EXIST_ERR_EID (FM_CONCAT_LIST_TGT_BASE_EID + FM_FNAME_EXIST_EID_OFFSET)
 
 /**
- * \brief FM Child Task Decompress File Target Filename Is Directory Event ID
+ * \brief FM Child Task Concat List Target Filename Is Directory Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Decompress
+ *  This event message is generated upon receipt of a /FM_ConcatList
  *  command packet with a target filename that is a directory.
  *
- *  Value: 222
+ *  Value: 309
  */
-#define FM_DECOM_TGT_ISDIR_ERR_EID (FM_DECOM_TGT_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
+#define FM_CONCAT_LIST_TGT_ISDIR_ERR_EID (FM_CONCAT_LIST_TGT_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
 
 /**
- * \brief FM Child Task Decompress File Child Task Error Base ID
+ * \brief FM Child Task Concat List Child Task Error Base ID
  *
  *  \par Type: ERROR
  *
@@ -2527,12 +4233,12 @@
  *  This is the base for any of several messages that are  generated when
  *  the FM child task command queue interface cannot be used.
  *
- *  Value: 226
+ *  Value: 313
  */
-#define FM_DECOM_CHILD_BASE_EID (FM_DECOM_TGT_BASE_EID + FM_FNAME_NUM_OFFSETS)
+#define FM_CONCAT_LIST_CHILD_BASE_EID (FM_CONCAT_LIST_TGT_BASE_EID + FM_FNAME_NUM_OFFSETS)
 
 /**
- * \brief FM Child Task Decompress File Child Task Disabled Event ID
+ * \brief FM Child Task Concat List Child Task Disabled Event ID
  *
  *  \par Type: ERROR
  *
@@ -2541,19 +4247,20 @@
  *  This event message is generated when the FM child task command queue
  *  interface cannot be used because the child task is disabled.
  *
- *  Value: 226
+ *  Value: 313
  */
-#define FM_DECOM_CHILD_DISABLED_ERR_EID (FM_DECOM_CHILD_BASE_EID + FM_CHILD_DISABLED_EID_OFFSET)
+#define FM_CONCAT_LIST_CHILD_DISABLED_ERR_EID (FM_CONCAT_LIST_CHILD_BASE_EID + FM_CHILD_DISABLED_EID_OFFSET)
 
 /**
- * \brief FM Child Task Decompress File Child Task Queue Full Event ID
+ * \brief FM Child Task Concat List Child Task Queue Full Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
  *  This event message is generated when the FM child task command queue
- *  interface cannot be used because the child task comand queue is full.
+ *  interface cannot be used because the child task command queue is full,
+ *  including when the queue path block pool cannot hold the inline source list.
  *
  *  If the child task command queue is full, the problem may be temporary,
  *  caused by sending too many FM commands too quickly.  If the command
@@ -2562,12 +4269,12 @@
  *  terminate the child task, which should then cause FM to process all
  *  commands in the main task.
  *
- *  Value: 227
+ *  Value: 314
  */
-#define FM_DECOM_CHILD_FULL_ERR_EID (FM_DECOM_CHILD_BASE_EID + FM_CHILD_Q_FULL_EID_OFFSET)
+#define FM_CONCAT_LIST_CHILD_FULL_ERR_EID (FM_CONCAT_LIST_CHILD_BASE_EID + FM_CHILD_Q_FULL_EID_OFFSET)
 
 /**
- * \brief FM Child Task Decompress File Child Task Inteface Broken Event ID
+ * \brief FM Child Task Concat List Child Task Interface Broken Event ID
  *
  *  \par Type: ERROR
  *
@@ -2582,212 +4289,255 @@
  *  affected the interface control variables.  In either case, it may be
  *  necessary to restart the FM application to resync the interface.
  *
- *  Value: 228
- *
+ *  Value: 315
  */
-#define FM_DECOM_CHILD_BROKEN_ERR_EID (FM_DECOM_CHILD_BASE_EID + FM_CHILD_BROKEN_EID_OFFSET)
+#define FM_CONCAT_LIST_CHILD_BROKEN_ERR_EID (FM_CONCAT_LIST_CHILD_BASE_EID + FM_CHILD_BROKEN_EID_OFFSET)
 
 /**
- * \brief FM Child Task Concat Files Source 1 Filename Error Base ID
+ * \brief FM Child Task Delete Directory Tree, Directory Error Base ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Concat
- *  command packet with a source 1 filename that is unusable for one
+ *  This event message is generated upon receipt of a /FM_DeleteTree
+ *  command packet with a directory name that is unusable for one
  *  of several reasons.
  *
- *  Value: 229
+ *  Value: 316
  */
-#define FM_CONCAT_SRC1_BASE_EID (FM_DECOM_CHILD_BASE_EID + FM_CHILD_NUM_OFFSETS)
+#define FM_DELETE_TREE_SRC_BASE_EID (FM_CONCAT_LIST_CHILD_BASE_EID + FM_CHILD_NUM_OFFSETS)
 
 /**
- * \brief FM Child Task Concat Files Source 1 Filename Invalid Event ID
+ * \brief FM Child Task Delete Directory Tree Name Invalid Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Concat
- *  command packet with an invalid source 1 filename.
+ *  This event message is generated upon receipt of a /FM_DeleteTree
+ *  command packet with an invalid directory name.
  *
- *  Value: 229
+ *  Value: 316
  */
-#define FM_CONCAT_SRC1_INVALID_ERR_EID (FM_CONCAT_SRC1_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+#define FM_DELETE_TREE_SRC_INVALID_ERR_EID (FM_DELETE_TREE_SRC_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
 
 /**
- * \brief FM Child Task Concat Files Source 1 File Does Not Exist Event ID
+ * \brief FM Child Task Delete Directory Tree Directory Does Not Exist Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Concat
- *  command packet with a source 1 filename that does not exist.
+ *  This event message is generated upon receipt of a /FM_DeleteTree
+ *  command packet with a directory name that does not exist.
  *
- *  Value: 230
+ *  Value: 317
  */
-#define FM_CONCAT_SRC1_DNE_ERR_EID (FM_CONCAT_SRC1_BASE_EID + FM_FNAME_DNE_EID_OFFSET)
+#define FM_DELETE_TREE_SRC_DNE_ERR_EID (FM_DELETE_TREE_SRC_BASE_EID + FM_FNAME_DNE_EID_OFFSET)
 
 /**
- * \brief FM Child Task Concat Files Source 1 Filename Is Directory Event ID
+ * \brief FM Child Task Delete Directory Tree Name Exists As File Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Concat
- *  command packet with a source filename that is a directory.
+ *  This event message is generated upon receipt of a /FM_DeleteTree
+ *  command packet with a directory name that exists as a file.
  *
- *  Value: 231
+ *  Value: 318
  */
-#define FM_CONCAT_SRC1_ISDIR_ERR_EID (FM_CONCAT_SRC1_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
+#define FM_DELETE_TREE_SRC_FILE_ERR_EID (FM_DELETE_TREE_SRC_BASE_EID + FM_FNAME_ISFILE_EID_OFFSET)
 
 /**
- * \brief FM Child Task Concat Files Source 1 File Already Open Event ID
+ * \brief FM Child Task Delete Directory Tree Child Task Error Base ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Concat
- *  command packet with a source filename that is already open.
+ *  This is the base for any of several messages that are generated when
+ *  the FM child task command queue interface cannot be used.
  *
- *  Value: 232
+ *  Value: 322
  */
-#define FM_CONCAT_SRC1_OPEN_ERR_EID (FM_CONCAT_SRC1_BASE_EID + FM_FNAME_ISOPEN_EID_OFFSET)
+#define FM_DELETE_TREE_CHILD_BASE_EID (FM_DELETE_TREE_SRC_BASE_EID + FM_FNAME_NUM_OFFSETS)
 
 /**
- * \brief FM Child Task Concat Files Source 2 Filename Error Base ID
+ * \brief FM Child Task Delete Directory Tree Child Task Disabled Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Concat
- *  command packet with a source 2 filename that is unusable for one
- *  of several reasons.
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the child task is disabled.
  *
- *  Value: 235
+ *  Value: 322
  */
-#define FM_CONCAT_SRC2_BASE_EID (FM_CONCAT_SRC1_BASE_EID + FM_FNAME_NUM_OFFSETS)
+#define FM_DELETE_TREE_CHILD_DISABLED_ERR_EID (FM_DELETE_TREE_CHILD_BASE_EID + FM_CHILD_DISABLED_EID_OFFSET)
 
 /**
- * \brief FM Child Task Concat Files Source 2 Filename Invalid Event ID
+ * \brief FM Child Task Delete Directory Tree Child Task Queue Full Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Concat
- *  command packet with an invalid source 2 filename.
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the child task command queue is full.
  *
- *  Value: 235
+ *  If the child task command queue is full, the problem may be temporary,
+ *  caused by sending too many FM commands too quickly.  If the command
+ *  queue does not empty itself within a reasonable amount of time then
+ *  the child task may be hung. It may be possible to use CFE commands to
+ *  terminate the child task, which should then cause FM to process all
+ *  commands in the main task.
+ *
+ *  Value: 323
  */
-#define FM_CONCAT_SRC2_INVALID_ERR_EID (FM_CONCAT_SRC2_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+#define FM_DELETE_TREE_CHILD_FULL_ERR_EID (FM_DELETE_TREE_CHILD_BASE_EID + FM_CHILD_Q_FULL_EID_OFFSET)
 
 /**
- * \brief FM Child Task Concat Files Source 2 File Does Not Exist Event ID
+ * \brief FM Child Task Delete Directory Tree Child Task Interface Broken Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Concat
- *  command packet with a source 2 filename that does not exist.
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the interface between the main task
+ *  and child task is broken.
  *
- *  Value: 236
+ *  If the child task queue is broken then either the handshake interface
+ *  logic is flawed, or there has been some sort of data corruption that
+ *  affected the interface control variables.  In either case, it may be
+ *  necessary to restart the FM application to resync the interface.
+ *
+ *  Value: 324
  */
-#define FM_CONCAT_SRC2_DNE_ERR_EID (FM_CONCAT_SRC2_BASE_EID + FM_FNAME_DNE_EID_OFFSET)
+#define FM_DELETE_TREE_CHILD_BROKEN_ERR_EID (FM_DELETE_TREE_CHILD_BASE_EID + FM_CHILD_BROKEN_EID_OFFSET)
 
 /**
- * \brief FM Child Task Concat Files Source 2 Filename Is Directory Event ID
+ * \brief FM Child Task Filter Files, Directory Error Base ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Concat
- *  command packet with a source filename that is a directory.
+ *  This event message is generated upon receipt of a /FM_FilterFiles
+ *  command packet with a directory name that is unusable for one
+ *  of several reasons.
  *
- *  Value: 237
+ *  Value: 325
  */
-#define FM_CONCAT_SRC2_ISDIR_ERR_EID (FM_CONCAT_SRC2_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
+#define FM_FILTER_FILES_SRC_BASE_EID (FM_DELETE_TREE_CHILD_BASE_EID + FM_CHILD_NUM_OFFSETS)
 
 /**
- * \brief FM Child Task Concat Files Source 2 File Already Open Event ID
+ * \brief FM Child Task Filter Files Directory Name Invalid Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Concat
- *  command packet with a source filename that is already open.
+ *  This event message is generated upon receipt of a /FM_FilterFiles
+ *  command packet with an invalid directory name.
  *
- *  Value: 238
+ *  Value: 325
  */
-#define FM_CONCAT_SRC2_OPEN_ERR_EID (FM_CONCAT_SRC2_BASE_EID + FM_FNAME_ISOPEN_EID_OFFSET)
+#define FM_FILTER_FILES_SRC_INVALID_ERR_EID (FM_FILTER_FILES_SRC_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
 
 /**
- * \brief FM Child Task Concat Files Target Filename Error Base ID
+ * \brief FM Child Task Filter Files Directory Does Not Exist Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Concat
- *  command packet with a target filename that is unusable for one
- *  of several reasons.
+ *  This event message is generated upon receipt of a /FM_FilterFiles
+ *  command packet with a directory name that does not exist.
  *
- *  Value: 241
+ *  Value: 326
  */
-#define FM_CONCAT_TGT_BASE_EID (FM_CONCAT_SRC2_BASE_EID + FM_FNAME_NUM_OFFSETS)
+#define FM_FILTER_FILES_SRC_DNE_ERR_EID (FM_FILTER_FILES_SRC_BASE_EID + FM_FNAME_DNE_EID_OFFSET)
 
 /**
- * \brief FM Child Task Concat Files Target Filename Invalid Event ID
+ * \brief FM Child Task Filter Files Directory Name Exists As File Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Concat
- *  command packet with an invalid target filename.
+ *  This event message is generated upon receipt of a /FM_FilterFiles
+ *  command packet with a directory name that exists as a file.
  *
- *  Value: 241
+ *  Value: 327
  */
-#define FM_CONCAT_TGT_INVALID_ERR_EID (FM_CONCAT_TGT_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+#define FM_FILTER_FILES_SRC_FILE_ERR_EID (FM_FILTER_FILES_SRC_BASE_EID + FM_FNAME_ISFILE_EID_OFFSET)
 
 /**
- * \brief FM Child Task Concat Files Target Filename Already Exists Event ID
+ * \brief FM Child Task Filter Files, Target Directory Error Base ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Concat
- *  command packet with a target filename that already exists.
+ *  This event message is generated upon receipt of a /FM_FilterFiles
+ *  command packet to move or copy files with a target directory name
+ *  that is unusable for one of several reasons.
  *
- *  Value: 242
+ *  Value: 331
  */
-#define FM_CONCAT_TGT_EXIST_ERR_EID (FM_CONCAT_TGT_BASE_EID + FM_FNAME_EXIST_EID_OFFSET)
+#define FM_FILTER_FILES_TGT_BASE_EID (FM_FILTER_FILES_SRC_BASE_EID + FM_FNAME_NUM_OFFSETS)
 
 /**
- * \brief FM Child Task Concat Files Target Filename Is Directory Event ID
+ * \brief FM Child Task Filter Files Target Directory Name Invalid Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Concat
- *  command packet with a target filename that is a directory.
+ *  This event message is generated upon receipt of a /FM_FilterFiles
+ *  command packet to move or copy files with an invalid target
+ *  directory name.
  *
- *  Value: 243
+ *  Value: 331
  */
-#define FM_CONCAT_TGT_ISDIR_ERR_EID (FM_CONCAT_TGT_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
+#define FM_FILTER_FILES_TGT_INVALID_ERR_EID (FM_FILTER_FILES_TGT_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
 
 /**
- * \brief FM Child Task Concat Files Child Task Error Base ID
+ * \brief FM Child Task Filter Files Target Directory Does Not Exist Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_FilterFiles
+ *  command packet to move or copy files with a target directory name
+ *  that does not exist.
+ *
+ *  Value: 332
+ */
+#define FM_FILTER_FILES_TGT_DNE_ERR_EID (FM_FILTER_FILES_TGT_BASE_EID + FM_FNAME_DNE_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Filter Files Target Directory Name Exists As File Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_FilterFiles
+ *  command packet to move or copy files with a target directory name
+ *  that exists as a file.
+ *
+ *  Value: 333
+ */
+#define FM_FILTER_FILES_TGT_FILE_ERR_EID (FM_FILTER_FILES_TGT_BASE_EID + FM_FNAME_ISFILE_EID_OFFSET)
+
+/**
+ * \brief FM Child Task Filter Files Child Task Error Base ID
  *
  *  \par Type: ERROR
  *
@@ -2796,12 +4546,12 @@
  *  This is the base for any of several messages that are generated when
  *  the FM child task command queue interface cannot be used.
  *
- *  Value: 247
+ *  Value: 337
  */
-#define FM_CONCAT_CHILD_BASE_EID (FM_CONCAT_TGT_BASE_EID + FM_FNAME_NUM_OFFSETS)
+#define FM_FILTER_FILES_CHILD_BASE_EID (FM_FILTER_FILES_TGT_BASE_EID + FM_FNAME_NUM_OFFSETS)
 
 /**
- * \brief FM Child Task Concat Files Child Task Disabled Event ID
+ * \brief FM Child Task Filter Files Child Task Disabled Event ID
  *
  *  \par Type: ERROR
  *
@@ -2810,19 +4560,19 @@
  *  This event message is generated when the FM child task command queue
  *  interface cannot be used because the child task is disabled.
  *
- *  Value: 247
+ *  Value: 337
  */
-#define FM_CONCAT_CHILD_DISABLED_ERR_EID (FM_CONCAT_CHILD_BASE_EID + FM_CHILD_DISABLED_EID_OFFSET)
+#define FM_FILTER_FILES_CHILD_DISABLED_ERR_EID (FM_FILTER_FILES_CHILD_BASE_EID + FM_CHILD_DISABLED_EID_OFFSET)
 
 /**
- * \brief FM Child Task Concat Files Child Task Queue Full Event ID
+ * \brief FM Child Task Filter Files Child Task Queue Full Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
  *  This event message is generated when the FM child task command queue
- *  interface cannot be used because the child task comand queue is full.
+ *  interface cannot be used because the child task command queue is full.
  *
  *  If the child task command queue is full, the problem may be temporary,
  *  caused by sending too many FM commands too quickly.  If the command
@@ -2831,12 +4581,12 @@
  *  terminate the child task, which should then cause FM to process all
  *  commands in the main task.
  *
- *  Value: 248
+ *  Value: 338
  */
-#define FM_CONCAT_CHILD_FULL_ERR_EID (FM_CONCAT_CHILD_BASE_EID + FM_CHILD_Q_FULL_EID_OFFSET)
+#define FM_FILTER_FILES_CHILD_FULL_ERR_EID (FM_FILTER_FILES_CHILD_BASE_EID + FM_CHILD_Q_FULL_EID_OFFSET)
 
 /**
- * \brief FM Child Task Concat Files Child Task Inteface Broken Event ID
+ * \brief FM Child Task Filter Files Child Task Interface Broken Event ID
  *
  *  \par Type: ERROR
  *
@@ -2851,27 +4601,27 @@
  *  affected the interface control variables.  In either case, it may be
  *  necessary to restart the FM application to resync the interface.
  *
- *  Value: 249
- *
+ *  Value: 339
  */
-#define FM_CONCAT_CHILD_BROKEN_ERR_EID (FM_CONCAT_CHILD_BASE_EID + FM_CHILD_BROKEN_EID_OFFSET)
+#define FM_FILTER_FILES_CHILD_BROKEN_ERR_EID (FM_FILTER_FILES_CHILD_BASE_EID + FM_CHILD_BROKEN_EID_OFFSET)
 
 /**
- * \brief FM Child Task Get File Info Child Task Error Base ID
+ * \brief FM Enforce Retention Child Task Error Base ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
  *  This is the base for any of several messages that are generated when
- *  the FM child task command queue interface cannot be used.
+ *  the FM child task command queue interface cannot be used to queue a
+ *  retention pass, whether commanded or scheduled.
  *
- *  Value: 250
+ *  Value: 340
  */
-#define FM_FILE_INFO_CHILD_BASE_EID (FM_CONCAT_CHILD_BASE_EID + FM_CHILD_NUM_OFFSETS)
+#define FM_ENFORCE_RETENTION_CHILD_BASE_EID (FM_FILTER_FILES_CHILD_BASE_EID + FM_CHILD_NUM_OFFSETS)
 
 /**
- * \brief FM Child Task Get File Info Child Task Disabled Event ID
+ * \brief FM Enforce Retention Child Task Disabled Event ID
  *
  *  \par Type: ERROR
  *
@@ -2880,33 +4630,28 @@
  *  This event message is generated when the FM child task command queue
  *  interface cannot be used because the child task is disabled.
  *
- *  Value: 250
+ *  Value: 340
  */
-#define FM_FILE_INFO_CHILD_DISABLED_ERR_EID (FM_FILE_INFO_CHILD_BASE_EID + FM_CHILD_DISABLED_EID_OFFSET)
+#define FM_ENFORCE_RETENTION_CHILD_DISABLED_ERR_EID (FM_ENFORCE_RETENTION_CHILD_BASE_EID + FM_CHILD_DISABLED_EID_OFFSET)
 
 /**
- * \brief FM Child Task Get File Info Child Task Queue Full Event ID
+ * \brief FM Enforce Retention Child Task Queue Full Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
  *  This event message is generated when the FM child task command queue
- *  interface cannot be used because the child task comand queue is full.
- *
- *  If the child task command queue is full, the problem may be temporary,
- *  caused by sending too many FM commands too quickly.  If the command
- *  queue does not empty itself within a reasonable amount of time then
- *  the child task may be hung. It may be possible to use CFE commands to
- *  terminate the child task, which should then cause FM to process all
- *  commands in the main task.
+ *  interface cannot be used because the child task command queue is full.
+ *  A scheduled pass that cannot be queued is tried again once the entry
+ *  interval has passed.
  *
- *  Value: 251
+ *  Value: 341
  */
-#define FM_FILE_INFO_CHILD_FULL_ERR_EID (FM_FILE_INFO_CHILD_BASE_EID + FM_CHILD_Q_FULL_EID_OFFSET)
+#define FM_ENFORCE_RETENTION_CHILD_FULL_ERR_EID (FM_ENFORCE_RETENTION_CHILD_BASE_EID + FM_CHILD_Q_FULL_EID_OFFSET)
 
 /**
- * \brief FM Child Task Get File Info Child Task Inteface Broken Event ID
+ * \brief FM Enforce Retention Child Task Interface Broken Event ID
  *
  *  \par Type: ERROR
  *
@@ -2916,89 +4661,161 @@
  *  interface cannot be used because the interface between the main task
  *  and child task is broken.
  *
- *  If the child task queue is broken then either the handshake interface
- *  logic is flawed, or there has been some sort of data corruption that
- *  affected the interface control variables.  In either case, it may be
- *  necessary to restart the FM application to resync the interface.
+ *  Value: 342
+ */
+#define FM_ENFORCE_RETENTION_CHILD_BROKEN_ERR_EID (FM_ENFORCE_RETENTION_CHILD_BASE_EID + FM_CHILD_BROKEN_EID_OFFSET)
+
+/** -------------------------------------------------------------
+ *  NOTE: Every event ID below the first base EID is in use, so
+ *  later single event IDs follow the last base EID block.
+ ** --------------------------------------------------------------*/
+
+/**
+ * \brief FM Enforce Retention Command Length Invalid Event ID
  *
- *  Value: 252
+ *  \par Type: ERROR
  *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_EnforceRetention
+ *  command packet with an invalid length.
  */
-#define FM_FILE_INFO_CHILD_BROKEN_ERR_EID (FM_FILE_INFO_CHILD_BASE_EID + FM_CHILD_BROKEN_EID_OFFSET)
+#define FM_ENFORCE_RETENTION_PKT_ERR_EID 343
 
 /**
- * \brief FM Child Task Create Directory, Directory Error Base ID
+ * \brief FM Enforce Retention Command Table Not Loaded Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Create
- *  command packet with a directory name that is unusable for one
- *  of several reasons.
- *
- *  Value: 253
+ *  This event message is generated upon receipt of a /FM_EnforceRetention
+ *  command packet when the retention table has not been loaded.
  */
-#define FM_CREATE_DIR_SRC_BASE_EID (FM_FILE_INFO_CHILD_BASE_EID + FM_CHILD_NUM_OFFSETS)
+#define FM_ENFORCE_RETENTION_TBL_ERR_EID 344
 
 /**
- * \brief FM Child Task Create Directory Name Invalid Event ID
+ * \brief FM Enforce Retention Command Index Invalid Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Create
- *  command packet with an invalid directory name.
+ *  This event message is generated upon receipt of a /FM_EnforceRetention
+ *  command packet with a table entry index that is out of range.
+ */
+#define FM_ENFORCE_RETENTION_IDX_ERR_EID 345
+
+/**
+ * \brief FM Enforce Retention Command Entry Disabled Event ID
  *
- *  Value: 253
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated upon receipt of a /FM_EnforceRetention
+ *  command packet that selects a retention table entry that is not
+ *  enabled.
  */
-#define FM_CREATE_DIR_SRC_INVALID_ERR_EID (FM_CREATE_DIR_SRC_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+#define FM_ENFORCE_RETENTION_DISABLED_ERR_EID 346
 
 /**
- * \brief FM Child Task Create Directory Name Exists As File Event ID
+ * \brief FM Enforce Retention Command Pass Pending Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Create
- *  command packet with a directory name that exists as a file.
+ *  This event message is generated upon receipt of a /FM_EnforceRetention
+ *  command packet that selects a retention table entry whose previous
+ *  pass is still queued or running.
+ */
+#define FM_ENFORCE_RETENTION_BUSY_ERR_EID 347
+
+/**
+ * \brief FM Enforce Retention Pass Event ID
  *
- *  Value: 254
+ *  \par Type: INFORMATION
+ *
+ *  \par Cause
+ *
+ *  This event message signals the completion of a commanded retention
+ *  pass, or of a scheduled pass that removed files.  The message text
+ *  includes the number of files and bytes removed.
  */
-#define FM_CREATE_DIR_SRC_DNE_ERR_EID (FM_CREATE_DIR_SRC_BASE_EID + FM_FNAME_DNE_EID_OFFSET)
+#define FM_ENFORCE_RETENTION_CMD_INF_EID 348
 
 /**
- * \brief FM Child Task Create Directory Already Exists Event ID
+ * \brief FM Enforce Retention Pass Over Limit Event ID
+ *
+ *  \par Type: INFORMATION
+ *
+ *  \par Cause
+ *
+ *  This general event message is issued when a retention pass ends with
+ *  the directory still over its limits.  The files left may be open, an
+ *  OS function may have failed, or the directory may hold more files
+ *  than one pass can index.
+ */
+#define FM_ENFORCE_RETENTION_WARNING_EID 349
+
+/**
+ * \brief FM Enforce Retention Pass OS Error Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_Create
- *  command pasket with a directory that already exists.
+ *  This event message is generated when a retention pass cannot open
+ *  the managed directory.  Refer to the OS-specific return value for an
+ *  indication of what might have caused this error.
+ */
+#define FM_ENFORCE_RETENTION_OS_ERR_EID 350
+
+/**
+ * \brief FM Retention Table Verification Event ID
  *
- *  Value: 255
+ *  \par Type: INFORMATION
+ *
+ *  \par Cause
+ *
+ *  This event message is generated when the retention table is
+ *  validated.  The message text includes the number of good, bad and
+ *  unused entries.
  */
-#define FM_CREATE_DIR_SRC_ISDIR_ERR_EID (FM_CREATE_DIR_SRC_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
+#define FM_RETENTION_TABLE_VERIFY_EID 351
 
 /**
- * \brief FM Child Task Create Directory Child Task Error Base ID
+ * \brief FM Retention Table Entry Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause
+ *
+ *  This event message is generated for the first bad entry found when
+ *  the retention table is validated, or when the table pointer is null.
+ *  The message text names the entry index and what is wrong with it.
+ */
+#define FM_RETENTION_TABLE_VERIFY_ERR_EID 352
+
+/**
+ * \brief FM Purge Trash Child Task Error Base ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
  *  This is the base for any of several messages that are generated when
- *  the FM child task command queue interface cannot be used.
+ *  the FM child task command queue interface cannot be used to queue a
+ *  purge pass, whether commanded or scheduled.  The block follows the
+ *  single event IDs above, so its base is given as a value.
  *
- *  Value: 259
+ *  Value: 353
  */
-#define FM_CREATE_DIR_CHILD_BASE_EID (FM_CREATE_DIR_SRC_BASE_EID + FM_FNAME_NUM_OFFSETS)
+#define FM_PURGE_TRASH_CHILD_BASE_EID 353
 
 /**
- * \brief FM Child Task Create Directory Child Task Disabled Event ID
+ * \brief FM Purge Trash Child Task Disabled Event ID
  *
  *  \par Type: ERROR
  *
@@ -3007,33 +4824,28 @@
  *  This event message is generated when the FM child task command queue
  *  interface cannot be used because the child task is disabled.
  *
- *  Value: 259
+ *  Value: 353
  */
-#define FM_CREATE_DIR_CHILD_DISABLED_ERR_EID (FM_CREATE_DIR_CHILD_BASE_EID + FM_CHILD_DISABLED_EID_OFFSET)
+#define FM_PURGE_TRASH_CHILD_DISABLED_ERR_EID (FM_PURGE_TRASH_CHILD_BASE_EID + FM_CHILD_DISABLED_EID_OFFSET)
 
 /**
- * \brief FM Child Task Create Directory Child Task Queue Full Event ID
+ * \brief FM Purge Trash Child Task Queue Full Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
  *  This event message is generated when the FM child task command queue
- *  interface cannot be used because the child task comand queue is full.
+ *  interface cannot be used because the child task command queue is full.
+ *  A scheduled pass that cannot be queued is tried again at the next
+ *  housekeeping request.
  *
- *  If the child task command queue is full, the problem may be temporary,
- *  caused by sending too many FM commands too quickly.  If the command
- *  queue does not empty itself within a reasonable amount of time then
- *  the child task may be hung. It may be possible to use CFE commands to
- *  terminate the child task, which should then cause FM to process all
- *  commands in the main task.
- *
- *  Value: 260
+ *  Value: 354
  */
-#define FM_CREATE_DIR_CHILD_FULL_ERR_EID (FM_CREATE_DIR_CHILD_BASE_EID + FM_CHILD_Q_FULL_EID_OFFSET)
+#define FM_PURGE_TRASH_CHILD_FULL_ERR_EID (FM_PURGE_TRASH_CHILD_BASE_EID + FM_CHILD_Q_FULL_EID_OFFSET)
 
 /**
- * \brief FM Child Task Create Directory Child Task Inteface Broken Event ID
+ * \brief FM Purge Trash Child Task Interface Broken Event ID
  *
  *  \par Type: ERROR
  *
@@ -3043,425 +4855,374 @@
  *  interface cannot be used because the interface between the main task
  *  and child task is broken.
  *
- *  If the child task queue is broken then either the handshake interface
- *  logic is flawed, or there has been some sort of data corruption that
- *  affected the interface control variables.  In either case, it may be
- *  necessary to restart the FM application to resync the interface.
- *
- *  Value: 261
- *
+ *  Value: 355
  */
-#define FM_CREATE_DIR_CHILD_BROKEN_ERR_EID (FM_CREATE_DIR_CHILD_BASE_EID + FM_CHILD_BROKEN_EID_OFFSET)
+#define FM_PURGE_TRASH_CHILD_BROKEN_ERR_EID (FM_PURGE_TRASH_CHILD_BASE_EID + FM_CHILD_BROKEN_EID_OFFSET)
 
 /**
- * \brief FM Child Task Delete Directory, Directory Error Base ID
+ * \brief FM Set Delete Mode Command Length Invalid Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_DeleteDir
- *  command packet with a directory name that is unusable for one
- *  of several reasons.
- *
- *  Value: 262
+ *  This event message is generated upon receipt of a /FM_SetDeleteMode
+ *  command packet with an invalid length.
  */
-#define FM_DELETE_DIR_SRC_BASE_EID (FM_CREATE_DIR_CHILD_BASE_EID + FM_CHILD_NUM_OFFSETS)
+#define FM_SET_DELETE_MODE_PKT_ERR_EID 356
 
 /**
- * \brief FM Child Task Delete Directory Name Invalid Event ID
+ * \brief FM Set Delete Mode Command Mode Invalid Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_DeleteDir
- *  command packet with an invalid directory name.
- *
- *  Value: 262
+ *  This event message is generated upon receipt of a /FM_SetDeleteMode
+ *  command packet with a mode that is not #FM_DELETE_MODE_DIRECT or
+ *  #FM_DELETE_MODE_TRASH.
  */
-#define FM_DELETE_DIR_SRC_INVALID_ERR_EID (FM_DELETE_DIR_SRC_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+#define FM_SET_DELETE_MODE_ARG_ERR_EID 357
 
 /**
- * \brief FM Child Task Delete Directory Name Exists As File Event ID
+ * \brief FM Set Delete Mode Command Success Event ID
  *
- *  \par Type: ERROR
+ *  \par Type: INFORMATION
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_DeleteDir
- *  command packet with a directory name that exists as a file.
- *
- *  Value: 263
+ *  This event message signals the successful completion of a
+ *  /FM_SetDeleteMode command.
  */
-#define FM_DELETE_DIR_SRC_DNE_ERR_EID (FM_DELETE_DIR_SRC_BASE_EID + FM_FNAME_DNE_EID_OFFSET)
+#define FM_SET_DELETE_MODE_CMD_INF_EID 358
 
 /**
- * \brief FM Child Task Delete Directory Child Task Error Base ID
+ * \brief FM Purge Trash Command Length Invalid Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This is the base for any of several messages that are generated when
- *  the FM child task command queue interface cannot be used.
- *
- *  Value: 268
+ *  This event message is generated upon receipt of a /FM_PurgeTrash
+ *  command packet with an invalid length.
  */
-#define FM_DELETE_DIR_CHILD_BASE_EID (FM_DELETE_DIR_SRC_BASE_EID + FM_FNAME_NUM_OFFSETS)
+#define FM_PURGE_TRASH_PKT_ERR_EID 359
 
 /**
- * \brief FM Child Task Delete Directory Child Task Disabled Event ID
+ * \brief FM Purge Trash Command Pass Pending Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated when the FM child task command queue
- *  interface cannot be used because the child task is disabled.
- *
- *  Value: 268
+ *  This event message is generated upon receipt of a /FM_PurgeTrash
+ *  command packet while the previous purge pass is still queued or
+ *  running.
  */
-#define FM_DELETE_DIR_CHILD_DISABLED_ERR_EID (FM_DELETE_DIR_CHILD_BASE_EID + FM_CHILD_DISABLED_EID_OFFSET)
+#define FM_PURGE_TRASH_BUSY_ERR_EID 360
 
 /**
- * \brief FM Child Task Delete Directory Child Task Queue Full Event ID
+ * \brief FM Purge Trash Command Success Event ID
  *
- *  \par Type: ERROR
+ *  \par Type: INFORMATION
  *
  *  \par Cause
  *
- *  This event message is generated when the FM child task command queue
- *  interface cannot be used because the child task comand queue is full.
- *
- *  If the child task command queue is full, the problem may be temporary,
- *  caused by sending too many FM commands too quickly.  If the command
- *  queue does not empty itself within a reasonable amount of time then
- *  the child task may be hung. It may be possible to use CFE commands to
- *  terminate the child task, which should then cause FM to process all
- *  commands in the main task.
- *
- *  Value: 269
+ *  This event message signals the completion of a commanded purge pass.
+ *  The message text includes the number of files removed.
  */
-#define FM_DELETE_DIR_CHILD_FULL_ERR_EID (FM_DELETE_DIR_CHILD_BASE_EID + FM_CHILD_Q_FULL_EID_OFFSET)
+#define FM_PURGE_TRASH_CMD_INF_EID 361
 
 /**
- * \brief FM Child Task Delete Directory Child Task Inteface Broken Event ID
+ * \brief FM Purge Trash Files Not Removed Event ID
  *
- *  \par Type: ERROR
+ *  \par Type: INFORMATION
  *
  *  \par Cause
  *
- *  This event message is generated when the FM child task command queue
- *  interface cannot be used because the interface between the main task
- *  and child task is broken.
- *
- *  If the child task queue is broken then either the handshake interface
- *  logic is flawed, or there has been some sort of data corruption that
- *  affected the interface control variables.  In either case, it may be
- *  necessary to restart the FM application to resync the interface.
- *
- *  Value: 270
- *
+ *  This general event message is issued when a commanded purge pass
+ *  leaves files in a trash directory.  The files left may be open or an
+ *  OS function may have failed.
  */
-#define FM_DELETE_DIR_CHILD_BROKEN_ERR_EID (FM_DELETE_DIR_CHILD_BASE_EID + FM_CHILD_BROKEN_EID_OFFSET)
+#define FM_PURGE_TRASH_WARNING_EID 362
 
 /**
- * \brief FM Child Task Directory List to File Source Filename Error Base ID
+ * \brief FM Purge Trash OS Error Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_GetDirFile
- *  command packet with a source directory name that is unusable for one
- *  of several reasons.
- *
- *  Value: 271
+ *  This event message is generated when a purge pass cannot open a
+ *  trash directory.  The directory is not purged again until more files
+ *  are put in it.  Refer to the OS-specific return value for an
+ *  indication of what might have caused this error.
  */
-#define FM_GET_DIR_FILE_SRC_BASE_EID (FM_DELETE_DIR_CHILD_BASE_EID + FM_CHILD_NUM_OFFSETS)
+#define FM_PURGE_TRASH_OS_ERR_EID 363
 
 /**
- * \brief FM Child Task Directory List to File Directory Name Invalid Event ID
+ * \brief FM Child Task Initialization Create Trash Semaphore Failed Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_GetDirFile
- *  command packet with an invalid source directory name.
- *
- *  Value: 271
+ *  This event message indicates an unsuccessful attempt to create the mutex
+ *  semaphore that serializes access to the list of trash directories.
+ *  Commands which would have otherwise been handed off to the child tasks
+ *  for execution, will now be rejected by the main FM application.
  */
-#define FM_GET_DIR_FILE_SRC_INVALID_ERR_EID (FM_GET_DIR_FILE_SRC_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+#define FM_CHILD_INIT_TRASH_SEM_ERR_EID 364
 
 /**
- * \brief FM Child Task Directory List to File Directory Does Not Exist Event ID
+ * \brief FM Child Task Initialization Create CRC Cache Semaphore Failed Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_GetDirFile
- *  command packet with a source directory name that does not exist.
- *
- *  Value: 272
+ *  This event message indicates an unsuccessful attempt to create the mutex
+ *  semaphore that serializes access to the file CRC cache.  Commands which
+ *  would have otherwise been handed off to the child tasks for execution,
+ *  will now be rejected by the main FM application.
  */
-#define FM_GET_DIR_FILE_SRC_DNE_ERR_EID (FM_GET_DIR_FILE_SRC_BASE_EID + FM_FNAME_DNE_EID_OFFSET)
+#define FM_CHILD_INIT_CRC_SEM_ERR_EID 365
 
 /**
- * \brief FM Child Task Directory List to File Directory Name Is File Event ID
+ * \brief FM Child Task Initialization CRC Helper Task Failed Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_GetDirFile
- *  command packet with a source directory name that is a file.
- *
- *  Value: 273
+ *  This event message indicates an unsuccessful attempt to create one of the
+ *  CRC helper semaphores or CRC helper tasks.  Commands which would have
+ *  otherwise been handed off to the child tasks for execution, will now be
+ *  processed by the main FM application.
  */
-#define FM_GET_DIR_FILE_SRC_ISDIR_ERR_EID (FM_GET_DIR_FILE_SRC_BASE_EID + FM_FNAME_ISFILE_EID_OFFSET)
+#define FM_CHILD_INIT_CRC_HELPER_ERR_EID 366
 
 /**
- * \brief FM Child Task Directory List to File Target Error Base ID
+ * \brief FM Child CRC Helper Task Termination Error Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_GetDirFile
- *  command packet with a target filename that is unusable for one
- *  of several reasons.
- *
- *  Value: 277
+ *  This event message indicates that a CRC helper task has suffered a fatal
+ *  error and has terminated.  The error occurred when trying to take its
+ *  start semaphore.  Later file CRCs are computed without that helper.
  */
-#define FM_GET_DIR_FILE_TGT_BASE_EID (FM_GET_DIR_FILE_SRC_BASE_EID + FM_FNAME_NUM_OFFSETS)
+#define FM_CHILD_CRC_HELPER_TERM_ERR_EID 367
 
 /**
- * \brief FM Child Task Directory List to File Target Filename Invalid Event ID
+ * \brief FM Get File Digest Source Filename Error Base ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_GetDirFile
- *  command packet with an invalid target file name.
+ *  This event message is generated upon receipt of a /FM_GetFileDigest
+ *  command packet with a source filename that is unusable for one
+ *  of several reasons.  The block follows the single event IDs above,
+ *  so its base is given as a value.
  *
- *  Value: 277
+ *  Value: 368
  */
-#define FM_GET_DIR_FILE_TGT_INVALID_ERR_EID (FM_GET_DIR_FILE_TGT_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+#define FM_GET_FILE_DIGEST_SRC_BASE_EID 368
 
 /**
- * \brief FM Child Task Directory List to File Target Filename Is Directory Event ID
+ * \brief FM Get File Digest Source Filename Invalid Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_GetDirFile
- *  command packet with a target filename that is a directory.
+ *  This event message is generated upon receipt of a /FM_GetFileDigest
+ *  command packet with an invalid source filename.
  *
- *  Value: 279
+ *  Value: 368
  */
-#define FM_GET_DIR_FILE_TGT_ISDIR_ERR_EID (FM_GET_DIR_FILE_TGT_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
+#define FM_GET_FILE_DIGEST_SRC_INVALID_ERR_EID (FM_GET_FILE_DIGEST_SRC_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
 
 /**
- * \brief FM Child Task Directory List to File Child Task Error Base ID
+ * \brief FM Get File Digest Source Filename Does Not Exist Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This is the base for any of several messages that are  generated when
- *  the FM child task command queue interface cannot be used.
+ *  This event message is generated upon receipt of a /FM_GetFileDigest
+ *  command packet with a source filename that does not exist.
  *
- *  Value: 283
+ *  Value: 369
  */
-#define FM_GET_DIR_FILE_CHILD_BASE_EID (FM_GET_DIR_FILE_TGT_BASE_EID + FM_FNAME_NUM_OFFSETS)
+#define FM_GET_FILE_DIGEST_SRC_DNE_ERR_EID (FM_GET_FILE_DIGEST_SRC_BASE_EID + FM_FNAME_DNE_EID_OFFSET)
 
 /**
- * \brief FM Child Task Directory List to File Child Task Disabled Event ID
+ * \brief FM Get File Digest Source Filename Is A Directory Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated when the FM child task command queue
- *  interface cannot be used because the child task is disabled.
+ *  This event message is generated upon receipt of a /FM_GetFileDigest
+ *  command packet with a source filename that is a directory.
  *
- *  Value: 283
+ *  Value: 370
  */
-#define FM_GET_DIR_FILE_CHILD_DISABLED_ERR_EID (FM_GET_DIR_FILE_CHILD_BASE_EID + FM_CHILD_DISABLED_EID_OFFSET)
+#define FM_GET_FILE_DIGEST_SRC_ISDIR_ERR_EID (FM_GET_FILE_DIGEST_SRC_BASE_EID + FM_FNAME_ISDIR_EID_OFFSET)
 
 /**
- * \brief FM Child Task Directory List to File Child Task Queue Full Event ID
+ * \brief FM Get File Digest Source File Is Open Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated when the FM child task command queue
- *  interface cannot be used because the child task comand queue is full.
- *
- *  If the child task command queue is full, the problem may be temporary,
- *  caused by sending too many FM commands too quickly.  If the command
- *  queue does not empty itself within a reasonable amount of time then
- *  the child task may be hung. It may be possible to use CFE commands to
- *  terminate the child task, which should then cause FM to process all
- *  commands in the main task.
+ *  This event message is generated upon receipt of a /FM_GetFileDigest
+ *  command packet with a source filename that is already open.
  *
- *  Value: 284
+ *  Value: 371
  */
-#define FM_GET_DIR_FILE_CHILD_FULL_ERR_EID (FM_GET_DIR_FILE_CHILD_BASE_EID + FM_CHILD_Q_FULL_EID_OFFSET)
+#define FM_GET_FILE_DIGEST_SRC_OPEN_ERR_EID (FM_GET_FILE_DIGEST_SRC_BASE_EID + FM_FNAME_ISOPEN_EID_OFFSET)
 
 /**
- * \brief FM Child Task Directory List to File Child Task Inteface Broken Event ID
+ * \brief FM Get File Digest Child Task Error Base ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated when the FM child task command queue
- *  interface cannot be used because the interface between the main task
- *  and child task is broken.
- *
- *  If the child task queue is broken then either the handshake interface
- *  logic is flawed, or there has been some sort of data corruption that
- *  affected the interface control variables.  In either case, it may be
- *  necessary to restart the FM application to resync the interface.
- *
- *  Value: 285
+ *  This is the base for any of several messages that are generated when
+ *  the FM child task command queue interface cannot be used.
  *
+ *  Value: 374
  */
-#define FM_GET_DIR_FILE_CHILD_BROKEN_ERR_EID (FM_GET_DIR_FILE_CHILD_BASE_EID + FM_CHILD_BROKEN_EID_OFFSET)
+#define FM_GET_FILE_DIGEST_CHILD_BASE_EID (FM_GET_FILE_DIGEST_SRC_BASE_EID + FM_FNAME_NUM_OFFSETS)
 
 /**
- * \brief FM Child Task Directory List to Packet Directory Error Base ID
+ * \brief FM Get File Digest Child Task Disabled Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_GetDirPkt
- *  command packet with a source directory name that is unusable for one
- *  of several reasons.
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the child task is disabled.
  *
- *  Value: 286
+ *  Value: 374
  */
-#define FM_GET_DIR_PKT_SRC_BASE_EID (FM_GET_DIR_FILE_CHILD_BASE_EID + FM_CHILD_NUM_OFFSETS)
+#define FM_GET_FILE_DIGEST_CHILD_DISABLED_ERR_EID (FM_GET_FILE_DIGEST_CHILD_BASE_EID + FM_CHILD_DISABLED_EID_OFFSET)
 
 /**
- * \brief FM Child Task Directory List to Packet Directory Name Invalid Event ID
+ * \brief FM Get File Digest Child Task Queue Full Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_GetDirPkt
- *  command packet with an invalid source directory name.
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the child task command queue is full.
  *
- *  Value: 286
+ *  Value: 375
  */
-#define FM_GET_DIR_PKT_SRC_INVALID_ERR_EID (FM_GET_DIR_PKT_SRC_BASE_EID + FM_FNAME_INVALID_EID_OFFSET)
+#define FM_GET_FILE_DIGEST_CHILD_FULL_ERR_EID (FM_GET_FILE_DIGEST_CHILD_BASE_EID + FM_CHILD_Q_FULL_EID_OFFSET)
 
 /**
- * \brief FM Child Task Directory List to Packet Directory Does Not Exist Event ID
+ * \brief FM Get File Digest Child Task Interface Broken Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_GetDirPkt
- *  command packet with a source directory name that does not exist.
+ *  This event message is generated when the FM child task command queue
+ *  interface cannot be used because the interface between the main task
+ *  and child task is broken.
  *
- *  Value: 287
+ *  Value: 376
  */
-#define FM_GET_DIR_PKT_SRC_DNE_ERR_EID (FM_GET_DIR_PKT_SRC_BASE_EID + FM_FNAME_DNE_EID_OFFSET)
+#define FM_GET_FILE_DIGEST_CHILD_BROKEN_ERR_EID (FM_GET_FILE_DIGEST_CHILD_BASE_EID + FM_CHILD_BROKEN_EID_OFFSET)
 
 /**
- * \brief FM Child Task Directory List to Packet Directory Is File Event ID
+ * \brief FM Get File Digest Command Length Invalid Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated upon receipt of a /FM_GetDirPkt
- *  command packet with a source directory name that is a file.
- *
- *  Value: 288
+ *  This event message is generated upon receipt of a /FM_GetFileDigest
+ *  command packet with an invalid length.
  */
-#define FM_GET_DIR_PKT_SRC_ISDIR_ERR_EID (FM_GET_DIR_PKT_SRC_BASE_EID + FM_FNAME_ISFILE_EID_OFFSET)
+#define FM_GET_FILE_DIGEST_PKT_ERR_EID 377
 
 /**
- * \brief FM Child Task Directory List to Packet Child Task Error Base ID
+ * \brief FM Get File Digest Command Digests Invalid Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This is the base for any of several messages that are  generated when
- *  the FM child task command queue interface cannot be used.
- *
- *  Value: 292
+ *  This event message is generated upon receipt of a /FM_GetFileDigest
+ *  command packet that selects no digest, or a digest bit other than
+ *  #FM_DIGEST_CRC32C, #FM_DIGEST_XXH64 and #FM_DIGEST_SHA256.
  */
-#define FM_GET_DIR_PKT_CHILD_BASE_EID (FM_GET_DIR_PKT_SRC_BASE_EID + FM_FNAME_NUM_OFFSETS)
+#define FM_GET_FILE_DIGEST_TYPE_ERR_EID 378
 
 /**
- * \brief FM Child Task Directory List to Packet Child Task Disabled Event ID
+ * \brief FM Get File Digest Command Event ID
  *
- *  \par Type: ERROR
+ *  \par Type: INFORMATION
  *
  *  \par Cause
  *
- *  This event message is generated when the FM child task command queue
- *  interface cannot be used because the child task is disabled.
+ *  This event message signals the successful completion of a
+ *  /FM_GetFileDigest command.  The message text includes the number of
+ *  bytes read.
  *
- *  Value: 292
+ *  Note that the execution of this command generally occurs within the
+ *  context of the FM low priority child task.  Thus this event may not
+ *  occur until some time after the command was invoked.  However, this
+ *  event message does signal the actual completion of the command.
  */
-#define FM_GET_DIR_PKT_CHILD_DISABLED_ERR_EID (FM_GET_DIR_PKT_CHILD_BASE_EID + FM_CHILD_DISABLED_EID_OFFSET)
+#define FM_GET_FILE_DIGEST_CMD_INF_EID 379
 
 /**
- * \brief FM Child Task Directory List to Packet Child Task Queue Full Event ID
+ * \brief FM Get File Digest Open File Failed Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated when the FM child task command queue
- *  interface cannot be used because the child task comand queue is full.
- *
- *  If the child task command queue is full, the problem may be temporary,
- *  caused by sending too many FM commands too quickly.  If the command
- *  queue does not empty itself within a reasonable amount of time then
- *  the child task may be hung. It may be possible to use CFE commands to
- *  terminate the child task, which should then cause FM to process all
- *  commands in the main task.
+ *  This event message is generated when the file named by a
+ *  /FM_GetFileDigest command cannot be opened.
  *
- *  Value: 293
+ *  This event message is generated due to an API function error that
+ *  occurred after preliminary command argument verification tests
+ *  indicated that the source file exists. Refer to the function
+ *  specific return value for an indication of what might have caused
+ *  this particular error.
  */
-#define FM_GET_DIR_PKT_CHILD_FULL_ERR_EID (FM_GET_DIR_PKT_CHILD_BASE_EID + FM_CHILD_Q_FULL_EID_OFFSET)
+#define FM_GET_FILE_DIGEST_OPEN_ERR_EID 380
 
 /**
- * \brief FM Child Task Directory List to Packet Child Task Inteface Broken Event ID
+ * \brief FM Get File Digest Read File Failed Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause
  *
- *  This event message is generated when the FM child task command queue
- *  interface cannot be used because the interface between the main task
- *  and child task is broken.
- *
- *  If the child task queue is broken then either the handshake interface
- *  logic is flawed, or there has been some sort of data corruption that
- *  affected the interface control variables.  In either case, it may be
- *  necessary to restart the FM application to resync the interface.
- *
- *  Value: 294
+ *  This event message is generated when the file named by a
+ *  /FM_GetFileDigest command cannot be read to its end.  No digest
+ *  telemetry packet is sent.
  *
+ *  This event message is generated due to an API function error that
+ *  occurred after preliminary command argument verification tests
+ *  indicated that the source file exists. Refer to the function
+ *  specific return value for an indication of what might have caused
+ *  this particular error.
  */
-#define FM_GET_DIR_PKT_CHILD_BROKEN_ERR_EID (FM_GET_DIR_PKT_CHILD_BASE_EID + FM_CHILD_BROKEN_EID_OFFSET)
+#define FM_GET_FILE_DIGEST_READ_ERR_EID 381
 
 /**\}*/
 
@@ -64,4 +64,72 @@
 
 #define FM_IGNORE_CRC 0
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task throttle rate definitions                         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#define FM_THROTTLE_RATE_UNLIMITED 0
+#define FM_THROTTLE_RATE_DEFAULT   0xFFFFFFFF
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM argument to abort the commands of every child task           */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#define FM_ABORT_ALL_CHILD_TASKS 0xFF
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM command argument verification mode definitions               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#define FM_VERIFY_MODE_MAIN  0
+#define FM_VERIFY_MODE_CHILD 1
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM filter files command action definitions                      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#define FM_FILTER_ACTION_DELETE 0
+#define FM_FILTER_ACTION_MOVE   1
+#define FM_FILTER_ACTION_COPY   2
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM retention table eviction order definitions                   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#define FM_RETENTION_ORDER_OLDEST   0
+#define FM_RETENTION_ORDER_PRIORITY 1
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task delete mode definitions                           */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#define FM_DELETE_MODE_DIRECT 0
+#define FM_DELETE_MODE_TRASH  1
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM get file digest command digest definitions                   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#define FM_DIGEST_CRC32C 0x01
+#define FM_DIGEST_XXH64  0x02
+#define FM_DIGEST_SHA256 0x04
+#define FM_DIGEST_ALL    (FM_DIGEST_CRC32C | FM_DIGEST_XXH64 | FM_DIGEST_SHA256)
+
+#define FM_DIGEST_XXH64_LEN  8
+#define FM_DIGEST_SHA256_LEN 32
+
 #endif /* FM_EXTERN_TYPEDEFS_H */
\ No newline at end of file
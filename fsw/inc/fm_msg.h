@@ -153,7 +153,7 @@ typedef struct
 /**
  *  \brief Single directory command payload structure
  *
- *  Used by #FM_DELETE_ALL_FILES_CC, #FM_CREATE_DIRECTORY_CC, #FM_DELETE_DIRECTORY_CC
+ *  Used by #FM_DELETE_ALL_FILES_CC, #FM_CREATE_DIRECTORY_CC, #FM_DELETE_DIRECTORY_CC, #FM_DELETE_TREE_CC
  */
 typedef struct
 {
@@ -373,6 +373,287 @@ typedef struct
     FM_FilenameAndMode_Payload_t Payload;
 } FM_SetPermissionsCmd_t;
 
+/**
+ *  \brief Copy block size command payload structure
+ *
+ *  Used by #FM_SET_COPY_BLOCK_SIZE_CC
+ */
+typedef struct
+{
+    uint32 BlockSize; /**< \brief Bytes per read and write when copying a file */
+} FM_CopyBlockSize_Payload_t;
+
+/**
+ *  \brief Set Copy Block Size command packet structure
+ *
+ *  For command details see #FM_SET_COPY_BLOCK_SIZE_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t CommandHeader; /**< \brief Command header */
+
+    FM_CopyBlockSize_Payload_t Payload; /**< \brief Command Payload */
+} FM_SetCopyBlockSizeCmd_t;
+
+/**
+ *  \brief Concat list command payload structure
+ *
+ *  Used by #FM_CONCAT_LIST_CC
+ */
+typedef struct
+{
+    char  Target[OS_MAX_PATH_LEN];   /**< \brief Target filename */
+    char  ListFile[OS_MAX_PATH_LEN]; /**< \brief Source list filename, empty to use the inline source names */
+    uint8 SourceCount;               /**< \brief Number of inline source names used when ListFile is empty */
+    uint8 Spare[3];                  /**< \brief Padding to 32 bit boundary */
+
+    char Source[FM_CONCAT_LIST_INLINE_MAX][OS_MAX_PATH_LEN]; /**< \brief Inline source filenames */
+} FM_ConcatList_Payload_t;
+
+/**
+ *  \brief Concat List command packet structure
+ *
+ *  For command details see #FM_CONCAT_LIST_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t CommandHeader; /**< \brief Command header */
+
+    FM_ConcatList_Payload_t Payload; /**< \brief Command Payload */
+} FM_ConcatListCmd_t;
+
+/**
+ *  \brief Set throttle command payload structure
+ *
+ *  Used by #FM_SET_THROTTLE_CC
+ */
+typedef struct
+{
+    char   Volume[OS_MAX_PATH_LEN]; /**< \brief Volume path prefix, empty to set the default rates */
+    uint32 ByteRate;                /**< \brief Bytes per second, #FM_THROTTLE_RATE_UNLIMITED for no limit */
+    uint32 StatRate;                /**< \brief OS_stat calls per second, #FM_THROTTLE_RATE_UNLIMITED for no limit */
+} FM_Throttle_Payload_t;
+
+/**
+ *  \brief Set Throttle command packet structure
+ *
+ *  For command details see #FM_SET_THROTTLE_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t CommandHeader; /**< \brief Command header */
+
+    FM_Throttle_Payload_t Payload; /**< \brief Command Payload */
+} FM_SetThrottleCmd_t;
+
+/**
+ *  \brief Abort command payload structure
+ *
+ *  Used by #FM_ABORT_CC
+ */
+typedef struct
+{
+    uint8 ChildTask; /**< \brief Child task index, #FM_ABORT_ALL_CHILD_TASKS for every child task */
+    uint8 Spare[3];  /**< \brief Padding to 32 bit boundary */
+} FM_Abort_Payload_t;
+
+/**
+ *  \brief Abort command packet structure
+ *
+ *  For command details see #FM_ABORT_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t CommandHeader; /**< \brief Command header */
+
+    FM_Abort_Payload_t Payload; /**< \brief Command Payload */
+} FM_AbortCmd_t;
+
+/**
+ *  \brief Flush Queue command packet structure
+ *
+ *  For command details see #FM_FLUSH_QUEUE_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t CommandHeader; /**< \brief Command header */
+} FM_FlushQueueCmd_t;
+
+/**
+ *  \brief Send Latency command packet structure
+ *
+ *  For command details see #FM_SEND_LATENCY_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t CommandHeader; /**< \brief Command header */
+} FM_SendLatencyCmd_t;
+
+/**
+ *  \brief Reset Latency command packet structure
+ *
+ *  For command details see #FM_RESET_LATENCY_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t CommandHeader; /**< \brief Command header */
+} FM_ResetLatencyCmd_t;
+
+/**
+ *  \brief Verify mode command payload structure
+ *
+ *  Used by #FM_SET_VERIFY_MODE_CC
+ */
+typedef struct
+{
+    uint8 Mode;     /**< \brief #FM_VERIFY_MODE_MAIN or #FM_VERIFY_MODE_CHILD */
+    uint8 Spare[3]; /**< \brief Padding to 32 bit boundary */
+} FM_VerifyMode_Payload_t;
+
+/**
+ *  \brief Set Verify Mode command packet structure
+ *
+ *  For command details see #FM_SET_VERIFY_MODE_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t CommandHeader; /**< \brief Command header */
+
+    FM_VerifyMode_Payload_t Payload; /**< \brief Command Payload */
+} FM_SetVerifyModeCmd_t;
+
+/**
+ *  \brief Delete Directory Tree command packet structure
+ *
+ *  For command details see #FM_DELETE_TREE_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t CommandHeader; /**< \brief Command header */
+
+    FM_DirectoryName_Payload_t Payload; /**< \brief Command Payload */
+} FM_DeleteTreeCmd_t;
+
+/**
+ *  \brief File filter structure
+ *
+ *  A limit of zero is not applied.  Ages are seconds since the file was
+ *  last modified.
+ */
+typedef struct
+{
+    uint32 MinAge;  /**< \brief Smallest age in seconds of a matching file */
+    uint32 MaxAge;  /**< \brief Largest age in seconds of a matching file */
+    uint32 MinSize; /**< \brief Smallest size in bytes of a matching file */
+    uint32 MaxSize; /**< \brief Largest size in bytes of a matching file */
+} FM_FileFilter_t;
+
+/**
+ *  \brief Filter files command payload structure
+ *
+ *  Used by #FM_FILTER_FILES_CC
+ */
+typedef struct
+{
+    char            Directory[OS_MAX_PATH_LEN]; /**< \brief Directory holding the files */
+    char            Target[OS_MAX_PATH_LEN];    /**< \brief Target directory for move and copy, unused for delete */
+    char            Pattern[OS_MAX_PATH_LEN];   /**< \brief Name pattern using '*' and '?', empty to match every name */
+    FM_FileFilter_t Filter;                     /**< \brief Age and size limits of a matching file */
+    uint8           Action;                     /**< \brief #FM_FILTER_ACTION_DELETE, _MOVE or _COPY */
+    uint8           Overwrite;                  /**< \brief Allow overwrite of files in the target directory */
+    uint8           Spare[2];                   /**< \brief Padding to 32 bit boundary */
+} FM_FilterFiles_Payload_t;
+
+/**
+ *  \brief Filter Files command packet structure
+ *
+ *  For command details see #FM_FILTER_FILES_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t CommandHeader; /**< \brief Command header */
+
+    FM_FilterFiles_Payload_t Payload; /**< \brief Command Payload */
+} FM_FilterFilesCmd_t;
+
+/**
+ *  \brief Retention table index command payload structure
+ *
+ *  Used by #FM_ENFORCE_RETENTION_CC
+ */
+typedef struct
+{
+    uint32 TableEntryIndex; /**< \brief Retention table entry index */
+} FM_RetentionIndex_Payload_t;
+
+/**
+ *  \brief Enforce Retention command packet structure
+ *
+ *  For command details see #FM_ENFORCE_RETENTION_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t CommandHeader; /**< \brief Command header */
+
+    FM_RetentionIndex_Payload_t Payload; /**< \brief Command Payload */
+} FM_EnforceRetentionCmd_t;
+
+/**
+ *  \brief Delete mode command payload structure
+ *
+ *  Used by #FM_SET_DELETE_MODE_CC
+ */
+typedef struct
+{
+    uint8 Mode;     /**< \brief #FM_DELETE_MODE_DIRECT or #FM_DELETE_MODE_TRASH */
+    uint8 Spare[3]; /**< \brief Padding to 32 bit boundary */
+} FM_DeleteMode_Payload_t;
+
+/**
+ *  \brief Set Delete Mode command packet structure
+ *
+ *  For command details see #FM_SET_DELETE_MODE_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t CommandHeader; /**< \brief Command header */
+
+    FM_DeleteMode_Payload_t Payload; /**< \brief Command Payload */
+} FM_SetDeleteModeCmd_t;
+
+/**
+ *  \brief Purge Trash command packet structure
+ *
+ *  For command details see #FM_PURGE_TRASH_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t CommandHeader; /**< \brief Command header */
+} FM_PurgeTrashCmd_t;
+
+/**
+ *  \brief Filename and digests command payload structure
+ *
+ *  Used by #FM_GET_FILE_DIGEST_CC
+ */
+typedef struct
+{
+    char   Filename[OS_MAX_PATH_LEN]; /**< \brief Filename */
+    uint32 Digests;                   /**< \brief Digests to compute (FM_DIGEST_xxx bits) */
+} FM_FilenameAndDigests_Payload_t;
+
+/**
+ *  \brief Get File Digest command packet structure
+ *
+ *  For command details see #FM_GET_FILE_DIGEST_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t CommandHeader; /**< \brief Command header */
+
+    FM_FilenameAndDigests_Payload_t Payload; /**< \brief Command Payload */
+} FM_GetFileDigestCmd_t;
+
 /**\}*/
 
 /**
@@ -536,12 +817,144 @@ typedef struct
     FM_MonitorReportPkt_Payload_t Payload; /**< \brief Telemetry Payload */
 } FM_MonitorReportPkt_t;
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM -- child task progress telemetry structures                  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**
+ *  \brief Child task progress entry structure
+ *
+ *  All zero for an idle child task.  For concatenate commands the total
+ *  grows as each source file is started.
+ */
+typedef struct
+{
+    uint8  CurrentCC;     /**< \brief Command code currently executing, zero when idle */
+    uint8  Spare[3];      /**< \brief Structure alignment spares */
+    uint32 ElapsedTime;   /**< \brief Milliseconds since the command started */
+    uint64 BytesDone;     /**< \brief Bytes read or copied so far */
+    uint64 BytesTotal;    /**< \brief Bytes the command is known to have to read or copy, zero if unknown */
+    uint32 ByteRate;      /**< \brief Average bytes per second since the command started */
+    uint32 TimeRemaining; /**< \brief Estimated seconds until the total is reached, zero if unknown */
+
+    char Source[OS_MAX_PATH_LEN]; /**< \brief Source file being read */
+    char Target[OS_MAX_PATH_LEN]; /**< \brief Target file being written, empty if none */
+} FM_ChildProgressEntry_t;
+
+/**
+ *  \brief Child task progress telemetry payload
+ */
+typedef struct
+{
+    FM_ChildProgressEntry_t ChildWorker[FM_CHILD_TASK_COUNT]; /**< \brief Progress of each child task */
+} FM_ChildProgressPkt_Payload_t;
+
+/**
+ *  \brief Child task progress telemetry packet
+ */
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t TelemetryHeader; /**< \brief Telemetry Header */
+
+    FM_ChildProgressPkt_Payload_t Payload; /**< \brief Telemetry Payload */
+} FM_ChildProgressPkt_t;
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM -- command latency telemetry structures                      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**
+ *  \brief Command latency histogram
+ *
+ *  Bucket 0 counts times under 4 microseconds, bucket N counts times from
+ *  4^N up to 4^(N+1) microseconds and the last bucket also counts every
+ *  longer time.
+ */
+typedef struct
+{
+    uint32 Bucket[FM_LATENCY_BUCKET_COUNT]; /**< \brief Number of times in each bucket */
+} FM_LatencyHistogram_t;
+
+/**
+ *  \brief Command latency telemetry payload
+ *
+ *  Each array is indexed by command code.  Commands the application
+ *  executes itself have no queue wait or execute times.
+ */
+typedef struct
+{
+    FM_LatencyHistogram_t Verify[FM_LATENCY_CC_COUNT];    /**< \brief Time to verify and dispatch each command */
+    FM_LatencyHistogram_t QueueWait[FM_LATENCY_CC_COUNT]; /**< \brief Time each command waited in the child queue */
+    FM_LatencyHistogram_t Execute[FM_LATENCY_CC_COUNT];   /**< \brief Time a child task took to execute each command */
+} FM_LatencyPkt_Payload_t;
+
+/**
+ *  \brief Command latency telemetry packet
+ */
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t TelemetryHeader; /**< \brief Telemetry Header */
+
+    FM_LatencyPkt_Payload_t Payload; /**< \brief Telemetry Payload */
+} FM_LatencyPkt_t;
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM -- get file digest telemetry structures                      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**
+ *  \brief Get File Digest telemetry payload
+ *
+ *  Digests that were not requested are zero.  The xxHash64 and SHA-256
+ *  values are sent most significant byte first, as they are printed.
+ */
+typedef struct
+{
+    uint32 Digests;                      /**< \brief Digests computed (FM_DIGEST_xxx bits) */
+    uint32 FileSize;                     /**< \brief Number of bytes the digests cover */
+    uint32 Crc32c;                       /**< \brief CRC-32C of the file */
+    uint8  Xxh64[FM_DIGEST_XXH64_LEN];   /**< \brief xxHash64 of the file, seed zero */
+    uint8  Sha256[FM_DIGEST_SHA256_LEN]; /**< \brief SHA-256 of the file */
+    char   Filename[OS_MAX_PATH_LEN];    /**< \brief Name of File */
+} FM_FileDigestPkt_Payload_t;
+
+/**
+ *  \brief Get File Digest telemetry packet
+ */
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t TelemetryHeader; /**< \brief Telemetry Header */
+
+    FM_FileDigestPkt_Payload_t Payload; /**< \brief Telemetry Payload */
+} FM_FileDigestPkt_t;
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* FM -- housekeeping telemetry structure                          */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
+/**
+ * \brief Housekeeping status for one child task in the worker pool
+ */
+typedef struct
+{
+    uint8 CmdCounter;     /**< \brief Child task command counter */
+    uint8 CmdErrCounter;  /**< \brief Child task command error counter */
+    uint8 CmdWarnCounter; /**< \brief Child task command warning counter */
+
+    uint8 CurrentCC;  /**< \brief Command code currently executing */
+    uint8 PreviousCC; /**< \brief Command code previously executed */
+
+    uint8 Spare[3]; /**< \brief Structure alignment spares */
+} FM_ChildWorkerStatus_t;
+
 /**
  * \brief Housekeeping telemetry payload
  */
@@ -553,14 +966,43 @@ typedef struct
 
     uint8 NumOpenFiles; /**< \brief Number of open files in the system */
 
-    uint8 ChildCmdCounter;     /**< \brief Child task command counter */
-    uint8 ChildCmdErrCounter;  /**< \brief Child task command error counter */
-    uint8 ChildCmdWarnCounter; /**< \brief Child task command warning counter */
+    uint8 ChildCmdCounter;     /**< \brief Child task command counter (sum of all child tasks) */
+    uint8 ChildCmdErrCounter;  /**< \brief Child task command error counter (sum of all child tasks) */
+    uint8 ChildCmdWarnCounter; /**< \brief Child task command warning counter (sum of all child tasks) */
+
+    uint8 ChildQueueCount; /**< \brief Number of pending commands in queue (both lanes) */
+
+    uint8 ChildCurrentCC;  /**< \brief Command code executing on the lowest numbered busy child task */
+    uint8 ChildPreviousCC; /**< \brief Command code last completed by the lowest numbered child task with one */
+
+    uint8 ChildTaskCount;      /**< \brief Number of child tasks running */
+    uint8 ChildFastQueueCount; /**< \brief Number of pending commands in the fast lane of the queue */
+
+    uint32 ChildEnqueueCount;  /**< \brief Commands handed to the child tasks */
+    uint32 ChildDequeueCount;  /**< \brief Commands taken from the queue by the child tasks */
+    uint32 ChildQueueWaitLast; /**< \brief Microseconds the most recent command waited in the queue */
+    uint32 ChildQueueWaitMax;  /**< \brief Longest time in microseconds a command waited in the queue */
+
+    uint16 ChildPathBlocksFree; /**< \brief Free blocks in the child task queue path name pool */
+    uint8  ChildVerifyMode;     /**< \brief Where command arguments are verified, see #FM_SET_VERIFY_MODE_CC */
+    uint8  ChildDeleteMode;     /**< \brief How the child task deletes files, see #FM_SET_DELETE_MODE_CC */
 
-    uint8 ChildQueueCount; /**< \brief Number of pending commands in queue */
+    uint32 ChildCopyBlockSize; /**< \brief Bytes per read and write when copying a file */
 
-    uint8 ChildCurrentCC;  /**< \brief Command code currently executing */
-    uint8 ChildPreviousCC; /**< \brief Command code previously executed */
+    uint32 ChildByteRate; /**< \brief Default child task bytes per second, zero when unlimited */
+    uint32 ChildStatRate; /**< \brief Default child task OS_stat calls per second, zero when unlimited */
+
+    uint32 RetentionPassCount; /**< \brief Retention passes completed, scheduled or commanded */
+    uint32 RetentionFileCount; /**< \brief Files removed by retention passes */
+
+    uint32 TrashFileCount;  /**< \brief Files renamed into a trash directory instead of removed */
+    uint32 TrashPurgeCount; /**< \brief Files removed from the trash directories by purge passes */
+
+    uint32 CrcCacheHits;   /**< \brief File CRCs reported from the CRC cache without reading the file */
+    uint32 CrcCacheMisses; /**< \brief File CRCs that had to be computed by reading the file */
+    uint32 CrcAppendCount; /**< \brief File CRCs continued from the CRC kept before the file grew */
+
+    FM_ChildWorkerStatus_t ChildWorker[FM_CHILD_TASK_COUNT]; /**< \brief Per child task status */
 } FM_HousekeepingPkt_Payload_t;
 
 /**
@@ -645,6 +1087,48 @@ typedef struct
     FM_MonitorTableEntry_t Entries[FM_TABLE_ENTRY_COUNT]; /**< \brief One entry for each monitor */
 } FM_MonitorTable_t;
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM -- directory retention table structures                      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**
+ *  \brief Retention table entry
+ *
+ *  An entry with an empty directory name is unused and must be disabled.
+ *  A limit of zero is not applied, but an enabled entry must set at least
+ *  one limit.
+ */
+typedef struct
+{
+    uint8  Enabled;  /**< \brief Directory is held under its limits when true */
+    uint8  Order;    /**< \brief #FM_RETENTION_ORDER_OLDEST or #FM_RETENTION_ORDER_PRIORITY */
+    uint16 Interval; /**< \brief Seconds between scheduled passes, must not be zero when enabled */
+    uint32 MaxBytes; /**< \brief Largest total size in bytes of the files in the directory */
+    uint32 MaxFiles; /**< \brief Largest number of files in the directory */
+
+    char Directory[OS_MAX_PATH_LEN]; /**< \brief Managed directory */
+
+    /**
+     * Priority patterns, used by #FM_RETENTION_ORDER_PRIORITY only
+     *
+     * A file matching the first pattern is removed before a file matching
+     * the second and so on, a file matching no pattern is removed last.
+     * Patterns use '*' and '?' as for #FM_FILTER_FILES_CC, an empty
+     * pattern is skipped.
+     */
+    char Priority[FM_RETENTION_PATTERN_COUNT][OS_MAX_FILE_NAME];
+} FM_RetentionTableEntry_t;
+
+/**
+ *  \brief Retention table definition
+ */
+typedef struct
+{
+    FM_RetentionTableEntry_t Entries[FM_RETENTION_ENTRY_COUNT]; /**< \brief One entry for each managed directory */
+} FM_RetentionTable_t;
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* FM -- child task interface command queue entry                  */
@@ -657,18 +1141,23 @@ typedef struct
 typedef struct
 {
     CFE_MSG_FcnCode_t CommandCode;              /**< \brief Command code - identifies the command */
-    uint16            Padding1;                 /**< \brief Structure padding to align to 32-bit boundaries */
+    uint8             ChildVerify;              /**< \brief Child task verifies the file system state first */
+    uint8             Overwrite;                /**< \brief Copy or move may replace an existing target */
     uint32            DirListOffset;            /**< \brief Starting entry for dir list commands */
     uint32            FileInfoState;            /**< \brief File info state */
     uint32            FileInfoSize;             /**< \brief File info size */
     uint32            FileInfoTime;             /**< \brief File info time */
-    uint32            FileInfoCRC;              /**< \brief File info CRC method */
+    uint32            FileInfoCRC;              /**< \brief File info CRC method, or get file digest digests */
     char              Source1[OS_MAX_PATH_LEN]; /**< \brief First source file or directory name command argument */
     char              Source2[OS_MAX_PATH_LEN]; /**< \brief Second source filename command argument */
     char              Target[OS_MAX_PATH_LEN];  /**< \brief Target filename command argument */
+    char              SourceList[FM_CONCAT_LIST_INLINE_MAX * OS_MAX_PATH_LEN]; /**< \brief Newline separated sources */
     uint8             GetSizeTimeMode; /**< \brief Whether to invoke stat call for size and time (CPU intensive) */
-    uint8             Padding2[3];     /**< \brief Structure padding to align to 32-bit boundaries */
+    uint8             FilterAction;    /**< \brief Action of a filter files command */
+    uint8             RetentionIndex;  /**< \brief Retention table entry of an enforce retention command */
+    uint8             Padding2;        /**< \brief Structure padding to align to 32-bit boundaries */
     uint32            Mode;            /**< \brief File Mode */
+    FM_FileFilter_t   Filter;          /**< \brief Age and size limits of a filter files command */
 } FM_ChildQueueEntry_t;
 
 #endif
@@ -128,7 +128,7 @@
  *       - Target filename is a directory
  *       - Child task interface queue is full
  *       - Child task interface logic is broken
- *       - Failure of OS copy function
+ *       - Failure of OS open, read or write function
  *
  *  \par Command Failure Verification
  *       - #FM_HousekeepingPkt_Payload_t.CommandErrCounter may increment
@@ -350,6 +350,12 @@
  *       of command argument verification and being able to place the command on
  *       the child task interface queue.
  *
+ *       The child task reads the directory once.  It collects the names of
+ *       the closed files in a list of #FM_CHILD_DELETE_LIST_SIZE bytes and
+ *       removes them a batch at a time, so the time taken grows in step
+ *       with the number of entries.  Each batch is paced by the throttle of
+ *       the volume holding the directory (see #FM_SET_THROTTLE_CC).
+ *
  *  \par Command Packet Structure
  *       #FM_DeleteAllFilesCmd_t
  *
@@ -541,6 +547,12 @@
  *       of command argument verification and being able to place the command on
  *       the child task interface queue.
  *
+ *       The child tasks keep the most recent CRCs, see
+ *       #FM_CHILD_CRC_CACHE_ENTRIES.  A CRC kept for the same file name,
+ *       size, modify time and CRC type is reported without reading the file.
+ *       A CRC-16 kept for a file that has since only grown is continued by
+ *       reading the appended bytes.
+ *
  *  \par Command Packet Structure
  *       #FM_GetFileInfoCmd_t
  *
@@ -965,6 +977,739 @@
  */
 #define FM_SET_PERMISSIONS_CC 19
 
+/**
+ * \brief Set Copy Block Size
+ *
+ *  \par Description
+ *       This command sets the number of bytes the child tasks read and write
+ *       at a time when copying a file.  Larger blocks need fewer file system
+ *       calls, smaller blocks give other tasks more frequent access to the
+ *       file systems.  The new size applies to copies started after the
+ *       command is processed and is reported in housekeeping telemetry.
+ *
+ *  \par Command Packet Structure
+ *       #FM_SetCopyBlockSizeCmd_t
+ *
+ *  \par Command Success Verification
+ *       - #FM_HousekeepingPkt_Payload_t.CommandCounter will increment
+ *       - #FM_HousekeepingPkt_Payload_t.ChildCopyBlockSize will be updated
+ *       - Informational event #FM_SET_COPY_BLOCK_CMD_INF_EID will be sent
+ *
+ *  \par Command Error Conditions
+ *       - Invalid command packet length
+ *       - Block size is less than #FM_CHILD_FILE_BLOCK_SIZE or greater
+ *         than #FM_CHILD_COPY_BUFFER_SIZE
+ *
+ *  \par Command Failure Verification
+ *       - #FM_HousekeepingPkt_Payload_t.CommandErrCounter will increment
+ *       - Error event #FM_SET_COPY_BLOCK_PKT_ERR_EID may be sent
+ *       - Error event #FM_SET_COPY_BLOCK_ARG_ERR_EID may be sent
+ *
+ *  \par Criticality
+ *       - There are no critical issues related to this command.
+ *
+ *  \sa #FM_COPY_FILE_CC
+ */
+#define FM_SET_COPY_BLOCK_SIZE_CC 20
+
+/**
+ * \brief Concatenate List of Files
+ *
+ *  \par Description
+ *       This command concatenates a list of source files into a new target
+ *       file in a single pass.  The target file is created and opened once
+ *       and each source file is streamed onto the end of it in list order.
+ *       The source names are either given inline in the command packet
+ *       (up to #FM_CONCAT_LIST_INLINE_MAX names) or read from a list file
+ *       holding one source filename per line, which has no limit on the
+ *       number of sources.  Blank lines in the list file are ignored.
+ *
+ *       Because of the possibility that this command might take a very long
+ *       time to complete, command argument validation will be done
+ *       immediately but copying the files will be performed by a lower
+ *       priority child task.  As such, the return value for this function
+ *       only refers to the result of command argument verification and
+ *       being able to place the command on the child task interface queue.
+ *
+ *  \par Command Packet Structure
+ *       #FM_ConcatListCmd_t
+ *
+ *  \par Command Success Verification
+ *       - #FM_HousekeepingPkt_Payload_t.CommandCounter will increment after validation
+ *       - #FM_HousekeepingPkt_Payload_t.ChildCmdCounter will increment after completion
+ *       - Informational event #FM_CONCAT_LIST_CMD_INF_EID will be sent
+ *
+ *  \par Command Error Conditions
+ *       - Invalid command packet length
+ *       - Inline source count is zero or greater than #FM_CONCAT_LIST_INLINE_MAX
+ *       - Invalid list filename, list file does not exist or is open
+ *       - Invalid source filename, source file does not exist or is open
+ *       - Invalid target filename
+ *       - Target file does exist
+ *       - Source list is empty, names the target or has a name that is too long
+ *       - Failure of OS function (open, read, write, etc.)
+ *
+ *  \par Command Failure Verification
+ *       - #FM_HousekeepingPkt_Payload_t.CommandErrCounter may increment
+ *       - #FM_HousekeepingPkt_Payload_t.ChildCmdErrCounter may increment
+ *       - Error event #FM_CONCAT_LIST_PKT_ERR_EID may be sent
+ *       - Error event #FM_CONCAT_LIST_ARG_ERR_EID may be sent
+ *       - Error event #FM_CONCAT_LIST_OPEN_LIST_ERR_EID may be sent
+ *       - Error event #FM_CONCAT_LIST_READ_LIST_ERR_EID may be sent
+ *       - Error event #FM_CONCAT_LIST_OPEN_SRC_ERR_EID may be sent
+ *       - Error event #FM_CONCAT_LIST_OPEN_TGT_ERR_EID may be sent
+ *       - Error event #FM_CONCAT_LIST_OSRD_ERR_EID may be sent
+ *       - Error event #FM_CONCAT_LIST_OSWR_ERR_EID may be sent
+ *       - Error event #FM_CONCAT_LIST_LIST_INVALID_ERR_EID may be sent
+ *       - Error event #FM_CONCAT_LIST_LIST_DNE_ERR_EID may be sent
+ *       - Error event #FM_CONCAT_LIST_LIST_ISDIR_ERR_EID may be sent
+ *       - Error event #FM_CONCAT_LIST_LIST_OPEN_ERR_EID may be sent
+ *       - Error event #FM_CONCAT_LIST_SRC_INVALID_ERR_EID may be sent
+ *       - Error event #FM_CONCAT_LIST_SRC_DNE_ERR_EID may be sent
+ *       - Error event #FM_CONCAT_LIST_SRC_ISDIR_ERR_EID may be sent
+ *       - Error event #FM_CONCAT_LIST_SRC_OPEN_ERR_EID may be sent
+ *       - Error event #FM_CONCAT_LIST_TGT_INVALID_ERR_EID may be sent
+ *       - Error event #FM_CONCAT_LIST_TGT_EXIST_ERR_EID may be sent
+ *       - Error event #FM_CONCAT_LIST_TGT_ISDIR_ERR_EID may be sent
+ *       - Error event #FM_CONCAT_LIST_CHILD_DISABLED_ERR_EID may be sent
+ *       - Error event #FM_CONCAT_LIST_CHILD_FULL_ERR_EID may be sent
+ *       - Error event #FM_CONCAT_LIST_CHILD_BROKEN_ERR_EID may be sent
+ *
+ *  \par Criticality
+ *       Concatenating many large files may consume more CPU resource
+ *       than anticipated.  Source files named in a list file are not
+ *       checked until the child task reaches them, a partial target file
+ *       is removed when any source cannot be appended.
+ *
+ *  \sa #FM_CONCAT_FILES_CC
+ */
+#define FM_CONCAT_LIST_CC 21
+
+/**
+ * \brief Set Throttle
+ *
+ *  \par Description
+ *       This command sets the rates at which the child tasks may process file
+ *       data (bytes per second) and query files with OS_stat (calls per
+ *       second).  With an empty volume the command sets the default rates,
+ *       otherwise it sets the rates of the files whose names start with the
+ *       volume path, for example "/ram" or "/cf".  A rate of
+ *       #FM_THROTTLE_RATE_UNLIMITED removes the limit and a volume rate of
+ *       #FM_THROTTLE_RATE_DEFAULT follows the default rate.  Setting both
+ *       rates of a volume to #FM_THROTTLE_RATE_DEFAULT removes the volume.
+ *       The new rates apply immediately, including to commands already
+ *       running in a child task.
+ *
+ *       A copy, move or concatenate between two volumes is paced by the
+ *       rates of both volumes.
+ *
+ *  \par Command Packet Structure
+ *       #FM_SetThrottleCmd_t
+ *
+ *  \par Command Success Verification
+ *       - #FM_HousekeepingPkt_Payload_t.CommandCounter will increment
+ *       - #FM_HousekeepingPkt_Payload_t.ChildByteRate and
+ *         #FM_HousekeepingPkt_Payload_t.ChildStatRate will be updated
+ *         when the default rates are set
+ *       - Informational event #FM_SET_THROTTLE_CMD_INF_EID will be sent
+ *
+ *  \par Command Error Conditions
+ *       - Invalid command packet length
+ *       - Volume is not terminated or does not start with a '/'
+ *       - A default rate is #FM_THROTTLE_RATE_DEFAULT
+ *       - A byte rate is less than #FM_CHILD_FILE_BLOCK_SIZE
+ *       - All #FM_CHILD_THROTTLE_VOLUME_COUNT volume entries are in use
+ *
+ *  \par Command Failure Verification
+ *       - #FM_HousekeepingPkt_Payload_t.CommandErrCounter will increment
+ *       - Error event #FM_SET_THROTTLE_PKT_ERR_EID may be sent
+ *       - Error event #FM_SET_THROTTLE_ARG_ERR_EID may be sent
+ *
+ *  \par Criticality
+ *       - Unlimited rates allow the child tasks to use all of the file
+ *         system bandwidth left over by higher priority tasks.
+ *
+ *  \sa #FM_SET_COPY_BLOCK_SIZE_CC
+ */
+#define FM_SET_THROTTLE_CC 22
+
+/**
+ * \brief Abort Child Task Command
+ *
+ *  \par Description
+ *       This command stops the command that a child task is executing, or
+ *       the commands of every child task when the child task index is
+ *       #FM_ABORT_ALL_CHILD_TASKS.  The child task notices the request
+ *       between two blocks of file data or two directory entries, so a long
+ *       copy, concatenate, CRC, delete all or directory listing stops
+ *       within one block.  The aborted command fails: a partial copy or
+ *       concatenate target file is removed, a CRC is not reported and
+ *       files already deleted stay deleted.  The currently executing
+ *       command of each child task is reported in housekeeping telemetry.
+ *
+ *       Commands still waiting in the queue are not affected, see
+ *       #FM_FLUSH_QUEUE_CC.
+ *
+ *  \par Command Packet Structure
+ *       #FM_AbortCmd_t
+ *
+ *  \par Command Success Verification
+ *       - #FM_HousekeepingPkt_Payload_t.CommandCounter will increment
+ *       - #FM_HousekeepingPkt_Payload_t.ChildCmdErrCounter will increment
+ *         for each aborted command
+ *       - Informational event #FM_ABORT_CMD_INF_EID will be sent
+ *       - Error event #FM_CHILD_ABORT_ERR_EID will be sent for each
+ *         aborted command
+ *
+ *  \par Command Error Conditions
+ *       - Invalid command packet length
+ *       - Child task index is not less than #FM_CHILD_TASK_COUNT and is
+ *         not #FM_ABORT_ALL_CHILD_TASKS
+ *
+ *  \par Command Failure Verification
+ *       - #FM_HousekeepingPkt_Payload_t.CommandErrCounter will increment
+ *       - Error event #FM_ABORT_PKT_ERR_EID may be sent
+ *       - Error event #FM_ABORT_ARG_ERR_EID may be sent
+ *
+ *  \par Criticality
+ *       - A command that has nearly finished is lost and must be sent again.
+ *
+ *  \sa #FM_FLUSH_QUEUE_CC
+ */
+#define FM_ABORT_CC 23
+
+/**
+ * \brief Flush Child Task Queue
+ *
+ *  \par Description
+ *       This command drops every command waiting in the child task queue.
+ *       Commands already executing are not affected, see #FM_ABORT_CC.
+ *       The dropped commands are neither executed nor counted by the child
+ *       task command counters and the path names they held are freed at
+ *       once.
+ *
+ *  \par Command Packet Structure
+ *       #FM_FlushQueueCmd_t
+ *
+ *  \par Command Success Verification
+ *       - #FM_HousekeepingPkt_Payload_t.CommandCounter will increment
+ *       - #FM_HousekeepingPkt_Payload_t.ChildQueueCount will drop to zero
+ *         once the child tasks have skipped the dropped commands
+ *       - Informational event #FM_FLUSH_QUEUE_CMD_INF_EID will be sent
+ *
+ *  \par Command Error Conditions
+ *       - Invalid command packet length
+ *
+ *  \par Command Failure Verification
+ *       - #FM_HousekeepingPkt_Payload_t.CommandErrCounter will increment
+ *       - Error event #FM_FLUSH_QUEUE_PKT_ERR_EID may be sent
+ *
+ *  \par Criticality
+ *       - Every queued command is dropped, including commands sent by
+ *         other applications.
+ *
+ *  \sa #FM_ABORT_CC
+ */
+#define FM_FLUSH_QUEUE_CC 24
+
+/**
+ * \brief Send Command Latency Histograms
+ *
+ *  \par Description
+ *       This command sends the command latency histograms.  For each
+ *       command code FM records the time the application took to verify
+ *       and dispatch the command, the time the command waited in the
+ *       child task queue and the time a child task took to execute it.
+ *       The times are counted in buckets that are each four times wider
+ *       than the one before, see #FM_LatencyHistogram_t.
+ *
+ *  \par Command Packet Structure
+ *       #FM_SendLatencyCmd_t
+ *
+ *  \par Command Success Verification
+ *       - #FM_HousekeepingPkt_Payload_t.CommandCounter will increment
+ *       - Telemetry packet #FM_LatencyPkt_t will be sent
+ *       - Informational event #FM_SEND_LATENCY_CMD_INF_EID will be sent
+ *
+ *  \par Command Error Conditions
+ *       - Invalid command packet length
+ *
+ *  \par Command Failure Verification
+ *       - #FM_HousekeepingPkt_Payload_t.CommandErrCounter will increment
+ *       - Error event #FM_SEND_LATENCY_PKT_ERR_EID will be sent
+ *
+ *  \par Criticality
+ *       - There are no critical issues related to this command.
+ *
+ *  \sa #FM_RESET_LATENCY_CC
+ */
+#define FM_SEND_LATENCY_CC 25
+
+/**
+ * \brief Reset Command Latency Histograms
+ *
+ *  \par Description
+ *       This command sets every command latency histogram to zero, along
+ *       with the most recent and longest queue wait times reported in
+ *       housekeeping telemetry.
+ *
+ *  \par Command Packet Structure
+ *       #FM_ResetLatencyCmd_t
+ *
+ *  \par Command Success Verification
+ *       - #FM_HousekeepingPkt_Payload_t.CommandCounter will increment
+ *       - #FM_HousekeepingPkt_Payload_t.ChildQueueWaitMax will be zero
+ *       - Informational event #FM_RESET_LATENCY_CMD_INF_EID will be sent
+ *
+ *  \par Command Error Conditions
+ *       - Invalid command packet length
+ *
+ *  \par Command Failure Verification
+ *       - #FM_HousekeepingPkt_Payload_t.CommandErrCounter will increment
+ *       - Error event #FM_RESET_LATENCY_PKT_ERR_EID will be sent
+ *
+ *  \par Criticality
+ *       - There are no critical issues related to this command.
+ *
+ *  \sa #FM_SEND_LATENCY_CC
+ */
+#define FM_RESET_LATENCY_CC 26
+
+/**
+ * \brief Set Verify Mode
+ *
+ *  \par Description
+ *       This command selects where file commands verify the file system
+ *       state of their arguments.  With #FM_VERIFY_MODE_MAIN the FM
+ *       application checks that source files exist, targets are not open,
+ *       etc. before the command is queued for a child task.  With
+ *       #FM_VERIFY_MODE_CHILD the application only checks that the names
+ *       are valid and queues the command, the child task makes the same
+ *       checks, with the same event IDs, when it starts the command.  The
+ *       application then takes the same short time for every command no
+ *       matter how slow the storage is.
+ *
+ *       In #FM_VERIFY_MODE_CHILD a command that fails verification counts
+ *       as an application command success and a child task command error.
+ *       Commands already queued keep the mode they were queued with.
+ *
+ *  \par Command Packet Structure
+ *       #FM_SetVerifyModeCmd_t
+ *
+ *  \par Command Success Verification
+ *       - #FM_HousekeepingPkt_Payload_t.CommandCounter will increment
+ *       - #FM_HousekeepingPkt_Payload_t.ChildVerifyMode will be updated
+ *       - Informational event #FM_SET_VERIFY_MODE_CMD_INF_EID will be sent
+ *
+ *  \par Command Error Conditions
+ *       - Invalid command packet length
+ *       - Mode is not #FM_VERIFY_MODE_MAIN or #FM_VERIFY_MODE_CHILD
+ *
+ *  \par Command Failure Verification
+ *       - #FM_HousekeepingPkt_Payload_t.CommandErrCounter will increment
+ *       - Error event #FM_SET_VERIFY_MODE_PKT_ERR_EID may be sent
+ *       - Error event #FM_SET_VERIFY_MODE_ARG_ERR_EID may be sent
+ *
+ *  \par Criticality
+ *       - In #FM_VERIFY_MODE_CHILD ground must watch the child task
+ *         counters and events to learn whether a command was rejected.
+ *
+ *  \sa #FM_SEND_LATENCY_CC
+ */
+#define FM_SET_VERIFY_MODE_CC 27
+
+/**
+ * \brief Delete Directory Tree
+ *
+ *  \par Description
+ *       This command deletes a directory together with every file and
+ *       sub-directory below it.  The child task walks the tree without
+ *       recursion: each directory is read once, its closed files are
+ *       removed a batch at a time as for #FM_DELETE_ALL_FILES_CC, and its
+ *       sub-directories are pushed onto a stack of #FM_CHILD_TREE_STACK_SIZE
+ *       names held by the child task.  A directory is removed once
+ *       everything below it has been visited.  Open files are not deleted,
+ *       so neither are the directories that hold them.  The removals are
+ *       paced by the throttle of the volume holding each directory (see
+ *       #FM_SET_THROTTLE_CC) and the command may be stopped with
+ *       #FM_ABORT_CC, leaving whatever has already been deleted deleted.
+ *
+ *       Because this command can take a long time, the FM application
+ *       invokes the child task to complete the command.  As such, the
+ *       command result for this function only refers to the result of
+ *       command argument verification and being able to place the command
+ *       on the child task interface queue.
+ *
+ *  \par Command Packet Structure
+ *       #FM_DeleteTreeCmd_t
+ *
+ *  \par Command Success Verification
+ *       - #FM_HousekeepingPkt_Payload_t.CommandCounter will increment after validation
+ *       - #FM_HousekeepingPkt_Payload_t.ChildCmdCounter will increment after completion
+ *       - Informational event #FM_DELETE_TREE_CMD_INF_EID will be sent with
+ *         the number of files and directories deleted
+ *
+ *  \par Command Error Conditions
+ *       - Invalid command packet length
+ *       - Invalid directory name
+ *       - Directory does not exist
+ *       - Directory name exists as a file
+ *       - Open files, a full stack or a failed OS function left the
+ *         directory in place
+ *       - Command aborted
+ *
+ *  \par Command Failure Verification
+ *       - #FM_HousekeepingPkt_Payload_t.CommandErrCounter will increment
+ *       - #FM_HousekeepingPkt_Payload_t.ChildCmdErrCounter may increment
+ *       - Error event #FM_DELETE_TREE_PKT_ERR_EID may be sent
+ *       - Error event #FM_DELETE_TREE_SRC_INVALID_ERR_EID may be sent
+ *       - Error event #FM_DELETE_TREE_SRC_DNE_ERR_EID may be sent
+ *       - Error event #FM_DELETE_TREE_SRC_FILE_ERR_EID may be sent
+ *       - Error event #FM_DELETE_TREE_CHILD_DISABLED_ERR_EID may be sent
+ *       - Error event #FM_DELETE_TREE_CHILD_FULL_ERR_EID may be sent
+ *       - Error event #FM_DELETE_TREE_CHILD_BROKEN_ERR_EID may be sent
+ *       - Error event #FM_DELETE_TREE_INCOMPLETE_ERR_EID may be sent with
+ *         the number of files and directories deleted and not deleted
+ *       - Error event #FM_CHILD_ABORT_ERR_EID may be sent
+ *
+ *  \par Criticality
+ *       The unexpected loss of a directory tree may affect a critical
+ *       tasks ability to store data.  Directories are followed by name, so
+ *       a link to a directory elsewhere is deleted as that directory.
+ *
+ *  \sa #FM_DELETE_DIRECTORY_CC, #FM_DELETE_ALL_FILES_CC
+ */
+#define FM_DELETE_TREE_CC 28
+
+/**
+ * \brief Filter Files
+ *
+ *  \par Description
+ *       This command deletes, moves or copies the files of one directory
+ *       that pass a filter, so that one command can replace many single
+ *       file commands.  A file passes when its name matches the pattern,
+ *       where '*' matches any run of characters and '?' matches any one
+ *       character, and when its age since the last modification and its
+ *       size fall within the limits given.  A limit of zero is not applied
+ *       and an empty pattern matches every name.  Moved and copied files
+ *       keep their names in the target directory.
+ *
+ *       The child task reads the directory once.  The name is tested
+ *       first, so only files with a matching name cost an OS_stat call.
+ *       Closed files that pass are collected and handled a batch at a time
+ *       as for #FM_DELETE_ALL_FILES_CC.  Sub-directories and open files are
+ *       skipped, as are files that would replace a target file when the
+ *       overwrite argument is zero.  The work is paced by the throttle of
+ *       the volumes involved (see #FM_SET_THROTTLE_CC) and the command may
+ *       be stopped with #FM_ABORT_CC, leaving whatever has already been
+ *       done in place.
+ *
+ *       Because this command can take a long time, the FM application
+ *       invokes the child task to complete the command.  As such, the
+ *       command result for this function only refers to the result of
+ *       command argument verification and being able to place the command
+ *       on the child task interface queue.
+ *
+ *  \par Command Packet Structure
+ *       #FM_FilterFilesCmd_t
+ *
+ *  \par Command Success Verification
+ *       - #FM_HousekeepingPkt_Payload_t.CommandCounter will increment after validation
+ *       - #FM_HousekeepingPkt_Payload_t.ChildCmdCounter will increment after completion
+ *       - Informational event #FM_FILTER_FILES_CMD_INF_EID will be sent with
+ *         the number of files handled
+ *       - #FM_HousekeepingPkt_Payload_t.ChildCmdWarnCounter may increment
+ *       - Informational event #FM_FILTER_FILES_WARNING_EID may be sent with
+ *         the number of matching files that were not handled
+ *
+ *  \par Command Error Conditions
+ *       - Invalid command packet length
+ *       - Invalid action or overwrite argument
+ *       - Invalid directory or target directory name
+ *       - Directory or target directory does not exist
+ *       - Directory or target directory name exists as a file
+ *       - Directory cannot be read
+ *       - Command aborted
+ *
+ *  \par Command Failure Verification
+ *       - #FM_HousekeepingPkt_Payload_t.CommandErrCounter will increment
+ *       - #FM_HousekeepingPkt_Payload_t.ChildCmdErrCounter may increment
+ *       - Error event #FM_FILTER_FILES_PKT_ERR_EID may be sent
+ *       - Error event #FM_FILTER_FILES_ACTION_ERR_EID may be sent
+ *       - Error event #FM_FILTER_FILES_OVR_ERR_EID may be sent
+ *       - Error event #FM_FILTER_FILES_SRC_INVALID_ERR_EID may be sent
+ *       - Error event #FM_FILTER_FILES_SRC_DNE_ERR_EID may be sent
+ *       - Error event #FM_FILTER_FILES_SRC_FILE_ERR_EID may be sent
+ *       - Error event #FM_FILTER_FILES_TGT_INVALID_ERR_EID may be sent
+ *       - Error event #FM_FILTER_FILES_TGT_DNE_ERR_EID may be sent
+ *       - Error event #FM_FILTER_FILES_TGT_FILE_ERR_EID may be sent
+ *       - Error event #FM_FILTER_FILES_CHILD_DISABLED_ERR_EID may be sent
+ *       - Error event #FM_FILTER_FILES_CHILD_FULL_ERR_EID may be sent
+ *       - Error event #FM_FILTER_FILES_CHILD_BROKEN_ERR_EID may be sent
+ *       - Error event #FM_FILTER_FILES_OS_ERR_EID may be sent
+ *       - Error event #FM_CHILD_ABORT_ERR_EID may be sent
+ *
+ *  \par Criticality
+ *       A broad pattern with no limits deletes or moves every closed file
+ *       in the directory.  A filter that is meant to select a few files
+ *       should be checked with #FM_GET_DIR_LIST_FILE_CC first.
+ *
+ *  \sa #FM_DELETE_ALL_FILES_CC, #FM_MOVE_FILE_CC, #FM_COPY_FILE_CC
+ */
+#define FM_FILTER_FILES_CC 29
+
+/**
+ * \brief Enforce Retention
+ *
+ *  \par Description
+ *       This command runs one retention pass over the directory of one
+ *       retention table entry now, rather than waiting for the entry's
+ *       next scheduled pass.
+ *
+ *       Each enabled entry of the retention table names a directory, a
+ *       limit on the total bytes and/or the number of files it may hold,
+ *       the order in which files are removed and the number of seconds
+ *       between passes.  Passes are scheduled by the housekeeping request,
+ *       so the interval is rounded up to the housekeeping period.  A pass
+ *       reads the directory once, counting every file and keeping the
+ *       files to be removed first in an index of #FM_RETENTION_INDEX_SIZE
+ *       entries, then removes closed files in index order until the
+ *       directory is back under its limits.  Files are removed oldest
+ *       first, or lowest priority first and oldest first within a
+ *       priority, where a file's priority is set by the first of the
+ *       entry's name patterns it matches.  Sub-directories are neither
+ *       counted nor removed.
+ *
+ *       Scheduled passes do not change the child task command counters,
+ *       they are counted in #FM_HousekeepingPkt_Payload_t.RetentionPassCount
+ *       and send an event only when they remove files or fail.  A
+ *       commanded pass is reported like any other child task command.
+ *
+ *       Because this command can take a long time, the FM application
+ *       invokes the child task to complete the command.  As such, the
+ *       command result for this function only refers to the result of
+ *       command argument verification and being able to place the command
+ *       on the child task interface queue.
+ *
+ *  \par Command Packet Structure
+ *       #FM_EnforceRetentionCmd_t
+ *
+ *  \par Command Success Verification
+ *       - #FM_HousekeepingPkt_Payload_t.CommandCounter will increment after validation
+ *       - #FM_HousekeepingPkt_Payload_t.ChildCmdCounter will increment after completion
+ *       - #FM_HousekeepingPkt_Payload_t.RetentionPassCount will increment after completion
+ *       - #FM_HousekeepingPkt_Payload_t.RetentionFileCount will increase by the files removed
+ *       - Informational event #FM_ENFORCE_RETENTION_CMD_INF_EID will be sent with
+ *         the number of files and bytes removed
+ *       - #FM_HousekeepingPkt_Payload_t.ChildCmdWarnCounter may increment
+ *       - Informational event #FM_ENFORCE_RETENTION_WARNING_EID may be sent when
+ *         the directory is still over its limits
+ *
+ *  \par Command Error Conditions
+ *       - Invalid command packet length
+ *       - Retention table has not been loaded
+ *       - Table entry index is out of range
+ *       - Table entry is not enabled
+ *       - Previous pass of the table entry is still queued or running
+ *       - Directory cannot be read
+ *       - Command aborted
+ *
+ *  \par Command Failure Verification
+ *       - #FM_HousekeepingPkt_Payload_t.CommandErrCounter will increment
+ *       - #FM_HousekeepingPkt_Payload_t.ChildCmdErrCounter may increment
+ *       - Error event #FM_ENFORCE_RETENTION_PKT_ERR_EID may be sent
+ *       - Error event #FM_ENFORCE_RETENTION_TBL_ERR_EID may be sent
+ *       - Error event #FM_ENFORCE_RETENTION_IDX_ERR_EID may be sent
+ *       - Error event #FM_ENFORCE_RETENTION_DISABLED_ERR_EID may be sent
+ *       - Error event #FM_ENFORCE_RETENTION_BUSY_ERR_EID may be sent
+ *       - Error event #FM_ENFORCE_RETENTION_CHILD_DISABLED_ERR_EID may be sent
+ *       - Error event #FM_ENFORCE_RETENTION_CHILD_FULL_ERR_EID may be sent
+ *       - Error event #FM_ENFORCE_RETENTION_CHILD_BROKEN_ERR_EID may be sent
+ *       - Error event #FM_ENFORCE_RETENTION_OS_ERR_EID may be sent
+ *       - Error event #FM_CHILD_ABORT_ERR_EID may be sent
+ *
+ *  \par Criticality
+ *       A pass deletes files without further confirmation.  The retention
+ *       table should be checked before it is loaded, a directory named by
+ *       mistake loses its oldest files at the next scheduled pass.
+ *
+ *  \sa #FM_FILTER_FILES_CC, #FM_MONITOR_FILESYSTEM_SPACE_CC
+ */
+#define FM_ENFORCE_RETENTION_CC 30
+
+/**
+ * \brief Set Delete Mode
+ *
+ *  \par Description
+ *       This command selects how the child task deletes files.  With
+ *       #FM_DELETE_MODE_DIRECT files are removed when the delete command
+ *       runs.  With #FM_DELETE_MODE_TRASH the #FM_DELETE_CC,
+ *       #FM_DELETE_ALL_FILES_CC and #FM_DELETE_TREE_CC commands and the
+ *       delete action of #FM_FILTER_FILES_CC rename each file into the
+ *       #FM_CHILD_TRASH_DIR_NAME directory at the top of its volume and
+ *       report success at once, a rename does not wait on the file system
+ *       to free the blocks of a large file.  The files in the trash are
+ *       removed later by purge passes (see #FM_PURGE_TRASH_CC).  A file that
+ *       cannot be renamed into the trash is removed directly.  Retention
+ *       passes always remove files directly.
+ *
+ *       Commands already queued use the mode set when they run.
+ *
+ *  \par Command Packet Structure
+ *       #FM_SetDeleteModeCmd_t
+ *
+ *  \par Command Success Verification
+ *       - #FM_HousekeepingPkt_Payload_t.CommandCounter will increment
+ *       - #FM_HousekeepingPkt_Payload_t.ChildDeleteMode will be updated
+ *       - Informational event #FM_SET_DELETE_MODE_CMD_INF_EID will be sent
+ *
+ *  \par Command Error Conditions
+ *       - Invalid command packet length
+ *       - Mode is not #FM_DELETE_MODE_DIRECT or #FM_DELETE_MODE_TRASH
+ *
+ *  \par Command Failure Verification
+ *       - #FM_HousekeepingPkt_Payload_t.CommandErrCounter will increment
+ *       - Error event #FM_SET_DELETE_MODE_PKT_ERR_EID may be sent
+ *       - Error event #FM_SET_DELETE_MODE_ARG_ERR_EID may be sent
+ *
+ *  \par Criticality
+ *       - In #FM_DELETE_MODE_TRASH the space of a deleted file is not free
+ *         until the file has been purged, free space telemetry reflects
+ *         this.
+ *
+ *  \sa #FM_PURGE_TRASH_CC, #FM_DELETE_CC, #FM_DELETE_ALL_FILES_CC
+ */
+#define FM_SET_DELETE_MODE_CC 31
+
+/**
+ * \brief Purge Trash
+ *
+ *  \par Description
+ *       This command removes every file in the trash directory of every
+ *       volume the child task has put files in, rather than waiting for
+ *       the scheduled purge passes.
+ *
+ *       Purge passes are scheduled by the housekeeping request when the
+ *       trash holds files and no child task command is waiting.  A
+ *       scheduled pass removes at most #FM_CHILD_PURGE_BUDGET files and
+ *       stops early when a command is queued behind it, so purging never
+ *       holds up other commands for long.  Scheduled passes do not change
+ *       the child task command counters or send events unless they fail,
+ *       the files they remove are counted in
+ *       #FM_HousekeepingPkt_Payload_t.TrashPurgeCount.  A commanded pass
+ *       has no budget and is reported like any other child task command.
+ *
+ *       The trash directory of a volume is purged again the first time
+ *       the volume is used after a restart, so files left in the trash by
+ *       an earlier run are removed as well.
+ *
+ *       Because this command can take a long time, the FM application
+ *       invokes the child task to complete the command.  As such, the
+ *       command result for this function only refers to the result of
+ *       command argument verification and being able to place the command
+ *       on the child task interface queue.
+ *
+ *  \par Command Packet Structure
+ *       #FM_PurgeTrashCmd_t
+ *
+ *  \par Command Success Verification
+ *       - #FM_HousekeepingPkt_Payload_t.CommandCounter will increment after validation
+ *       - #FM_HousekeepingPkt_Payload_t.ChildCmdCounter will increment after completion
+ *       - #FM_HousekeepingPkt_Payload_t.TrashPurgeCount will increase by the files removed
+ *       - Informational event #FM_PURGE_TRASH_CMD_INF_EID will be sent with
+ *         the number of files removed
+ *       - #FM_HousekeepingPkt_Payload_t.ChildCmdWarnCounter may increment
+ *       - Informational event #FM_PURGE_TRASH_WARNING_EID may be sent with
+ *         the number of files that could not be removed
+ *
+ *  \par Command Error Conditions
+ *       - Invalid command packet length
+ *       - Previous purge pass is still queued or running
+ *       - Trash directory cannot be read
+ *       - Command aborted
+ *
+ *  \par Command Failure Verification
+ *       - #FM_HousekeepingPkt_Payload_t.CommandErrCounter will increment
+ *       - #FM_HousekeepingPkt_Payload_t.ChildCmdErrCounter may increment
+ *       - Error event #FM_PURGE_TRASH_PKT_ERR_EID may be sent
+ *       - Error event #FM_PURGE_TRASH_BUSY_ERR_EID may be sent
+ *       - Error event #FM_PURGE_TRASH_CHILD_DISABLED_ERR_EID may be sent
+ *       - Error event #FM_PURGE_TRASH_CHILD_FULL_ERR_EID may be sent
+ *       - Error event #FM_PURGE_TRASH_CHILD_BROKEN_ERR_EID may be sent
+ *       - Error event #FM_PURGE_TRASH_OS_ERR_EID may be sent
+ *       - Error event #FM_CHILD_ABORT_ERR_EID may be sent
+ *
+ *  \par Criticality
+ *       None
+ *
+ *  \sa #FM_SET_DELETE_MODE_CC
+ */
+#define FM_PURGE_TRASH_CC 32
+
+/**
+ * \brief Get File Digest
+ *
+ *  \par Description
+ *       This command creates an FM file digest telemetry packet for the
+ *       source file.  Any combination of a CRC-32C (#FM_DIGEST_CRC32C),
+ *       an xxHash64 (#FM_DIGEST_XXH64) and a SHA-256 (#FM_DIGEST_SHA256)
+ *       may be selected, each block read from the file is passed to
+ *       every selected digest so the file is read only once.  The packet
+ *       also holds the number of bytes read and the source name.
+ *
+ *       CRC-32C and xxHash64 are fast checks for telling whether two
+ *       files hold the same data, SHA-256 is for integrity manifests.
+ *       None of these is the CRC of #FM_GET_FILE_INFO_CC.
+ *
+ *       Because this command can take a long time, the FM application
+ *       invokes the child task to complete the command.  As such, the
+ *       command result for this function only refers to the result of
+ *       command argument verification and being able to place the command
+ *       on the child task interface queue.
+ *
+ *  \par Command Packet Structure
+ *       #FM_GetFileDigestCmd_t
+ *
+ *  \par Command Success Verification
+ *       - #FM_HousekeepingPkt_Payload_t.CommandCounter will increment after validation
+ *       - #FM_HousekeepingPkt_Payload_t.ChildCmdCounter will increment after completion
+ *       - Telemetry packet #FM_FileDigestPkt_t will be sent
+ *       - Informational event #FM_GET_FILE_DIGEST_CMD_INF_EID will be sent
+ *
+ *  \par Command Error Conditions
+ *       - Invalid command packet length
+ *       - No digest or an unknown digest selected
+ *       - Source filename is invalid
+ *       - Source file does not exist
+ *       - Source filename is a directory
+ *       - Source file is open
+ *       - Source file cannot be opened or read
+ *       - Command aborted
+ *
+ *  \par Command Failure Verification
+ *       - #FM_HousekeepingPkt_Payload_t.CommandErrCounter may increment
+ *       - #FM_HousekeepingPkt_Payload_t.ChildCmdErrCounter may increment
+ *       - Error event #FM_GET_FILE_DIGEST_PKT_ERR_EID may be sent
+ *       - Error event #FM_GET_FILE_DIGEST_TYPE_ERR_EID may be sent
+ *       - Error event #FM_GET_FILE_DIGEST_SRC_INVALID_ERR_EID may be sent
+ *       - Error event #FM_GET_FILE_DIGEST_SRC_DNE_ERR_EID may be sent
+ *       - Error event #FM_GET_FILE_DIGEST_SRC_ISDIR_ERR_EID may be sent
+ *       - Error event #FM_GET_FILE_DIGEST_SRC_OPEN_ERR_EID may be sent
+ *       - Error event #FM_GET_FILE_DIGEST_CHILD_DISABLED_ERR_EID may be sent
+ *       - Error event #FM_GET_FILE_DIGEST_CHILD_FULL_ERR_EID may be sent
+ *       - Error event #FM_GET_FILE_DIGEST_CHILD_BROKEN_ERR_EID may be sent
+ *       - Error event #FM_GET_FILE_DIGEST_OPEN_ERR_EID may be sent
+ *       - Error event #FM_GET_FILE_DIGEST_READ_ERR_EID may be sent
+ *       - Error event #FM_CHILD_ABORT_ERR_EID may be sent
+ *
+ *  \par Criticality
+ *       Computing a SHA-256 of a very large file may consume more CPU
+ *       resource than anticipated.
+ *
+ *  \sa #FM_GET_FILE_INFO_CC
+ */
+#define FM_GET_FILE_DIGEST_CC 33
+
 /**\}*/
 
 #endif
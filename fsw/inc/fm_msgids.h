@@ -40,11 +40,14 @@
  * \{
  */
 
-#define FM_HK_TLM_MID         0x088A /** < \brief FM housekeeping */
-#define FM_FILE_INFO_TLM_MID  0x088B /** < \brief FM get file info */
-#define FM_DIR_LIST_TLM_MID   0x088C /** < \brief FM get dir list */
-#define FM_OPEN_FILES_TLM_MID 0x088D /** < \brief FM get open files */
-#define FM_FREE_SPACE_TLM_MID 0x088E /** < \brief FM get free space */
+#define FM_HK_TLM_MID             0x088A /** < \brief FM housekeeping */
+#define FM_FILE_INFO_TLM_MID      0x088B /** < \brief FM get file info */
+#define FM_DIR_LIST_TLM_MID       0x088C /** < \brief FM get dir list */
+#define FM_OPEN_FILES_TLM_MID     0x088D /** < \brief FM get open files */
+#define FM_FREE_SPACE_TLM_MID     0x088E /** < \brief FM get free space */
+#define FM_CHILD_PROGRESS_TLM_MID 0x088F /** < \brief FM child task progress */
+#define FM_LATENCY_TLM_MID        0x0890 /** < \brief FM command latency histograms */
+#define FM_FILE_DIGEST_TLM_MID    0x0891 /** < \brief FM get file digest */
 
 /**\}*/
 
@@ -29,8 +29,10 @@
  * \{
  */
 
-#define FM_APPMAIN_PERF_ID    39 /**< \brief Main application performance ID */
-#define FM_CHILD_TASK_PERF_ID 44 /**< \brief Child task performance ID */
+#define FM_APPMAIN_PERF_ID          39 /**< \brief Main application performance ID */
+#define FM_CHILD_TASK_PERF_ID       44 /**< \brief Child task performance ID */
+#define FM_CHILD_WRITER_PERF_ID     45 /**< \brief Child copy writer task performance ID */
+#define FM_CHILD_CRC_HELPER_PERF_ID 46 /**< \brief Child CRC helper task performance ID */
 
 /**\}*/
 
@@ -179,6 +179,21 @@
  */
 #define FM_DIR_LIST_PKT_ENTRIES 20
 
+/**
+ * \brief Concat List Command Inline Source Count
+ *
+ *  \par Description:
+ *       This definition sets the number of source filenames that can be
+ *       given inline in the /FM_ConcatList command packet.  Longer lists
+ *       are given to the command as a list file instead.
+ *
+ *  \par Limits:
+ *       The FM application limits this value to be no less than 2 and
+ *       no greater than 32.  Each inline source name adds OS_MAX_PATH_LEN
+ *       bytes to the command packet and to each child task queue entry.
+ */
+#define FM_CONCAT_LIST_INLINE_MAX 8
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* FM platform configuration parameters - child task definitions   */
@@ -189,81 +204,142 @@
  * \brief Child Task File I/O Control Settings
  *
  *  \par Description:
- *       These definitions control the amount of file data that the FM child task
- *       will process before giving up the CPU to allow other tasks time to run.
- *
  *       FM_CHILD_FILE_BLOCK_SIZE defines the size of each block of file data that
  *       the FM child task will read or write.  This value also defines the size
  *       of the FM child task I/O buffer that exists in global memory.
  *
- *       FM_CHILD_FILE_LOOP_COUNT defines the number of file data blocks that may
- *       be processed before the FM child task sleeps (gives up the CPU).
- *
- *       FM_CHILD_FILE_SLEEP_MS defines the length of time (in milli-secs) before
- *       the FM child task wakes (re-acquires the CPU).  Note that many platforms
- *       will limit the precision of this value.
- *
- *       Thus the combination of the 3 values control CPU use by the FM child task.
  *       Using a smaller block size minimizes the amount of RAM used by the file
- *       I/O buffer, but at the expense of file efficiency.  Adjust each of the
- *       values such that the combination is appropriate for the target platform.
- *
- *       For example, if the block size is 2048 and the loop count is 16 and the
- *       sleep time is 20, then while processing a 1 Mbyte file there will be
- *       32 sleep cycles of 20ms each, for a total task delay of 0.64 seconds.
+ *       I/O buffer, but at the expense of file efficiency.
  *
  *  \par Limits:
  *       FM_CHILD_FILE_BLOCK_SIZE: The FM application limits this value to be no
  *       less than 256 bytes and no greater than 32KB.
- *
- *       FM_CHILD_FILE_LOOP_COUNT: The FM application limits this value to be
- *       non-zero.  There is no upper limit - a very large number effectively
- *       means that the FM child task will not surrender the CPU to other lower
- *       priority tasks.
- *
- *       FM_CHILD_FILE_SLEEP_MS: The FM application limits this value to be no
- *       no greater than 100 ms.  The value zero generally means a very short
- *       task delay - refer to the target platform documentation for specifics.
  */
 #define FM_CHILD_FILE_BLOCK_SIZE 2048
-#define FM_CHILD_FILE_LOOP_COUNT 16
-#define FM_CHILD_FILE_SLEEP_MS   20
 
 /**
- * \brief Child file stat sleep
+ * \brief Child Task Throttle Settings
  *
  *  \par Description:
- *       OS_stat is a CPU intensive call. FM uses the OS_stat call to query a
- *       file’s size, date, and mode when setting up directory listings.
- *       Querying a large number of files and/or files large in size when
- *       processing directory listing commands can cause FM to hog the CPU. To
- *       mitigate this, options to sleep a configurable number of milliseconds
- *       between calls to OS_stat for a configurable number of files
- *       in a directory listing is provided. A large sleep cycle will not hang the CPU
- *       but it may take a long time for directory listing to complete. A shorter
- *       sleep cycle will speed up the directory listing commands but may cause
- *       FM to hog the CPU.
+ *       These definitions control the share of file system bandwidth used by the
+ *       FM child tasks.  Each volume is paced by a pair of token buckets, one
+ *       counting bytes read or written and one counting OS_stat calls.  A child
+ *       task that has used more than its share sleeps until the bucket refills,
+ *       so the FM child tasks run at full speed on an idle system and never
+ *       exceed the configured rates on a busy one.  The rates may be changed
+ *       at run time with the #FM_SET_THROTTLE_CC command.
+ *
+ *       FM_CHILD_THROTTLE_BYTE_RATE defines the default rate (in bytes per
+ *       second) of file data processed by the copy, move, concatenate and file
+ *       info commands.  The default of 1638400 matches the historical limit of
+ *       sleeping 20ms after each 32KB of data.
+ *
+ *       FM_CHILD_THROTTLE_STAT_RATE defines the default rate (in OS_stat calls
+ *       per second) of the directory listing commands.
+ *
+ *       FM_CHILD_THROTTLE_BURST_MS defines the depth of each bucket as the
+ *       amount of work (in milli-secs at the configured rate) that may be done
+ *       without a sleep after the child task has been idle.
+ *
+ *       FM_CHILD_THROTTLE_VOLUME_COUNT defines the number of volumes that may be
+ *       given rates that differ from the default rates.
  *
- *       FM_CHILD_STAT_SLEEP_MS: The number of milliseconds to sleep each
- *       cycle. One cycle is FM_CHILD_STAT_SLEEP_FILECOUNT.
+ *       For example, with a byte rate of 1638400 a 1 Mbyte file takes about
+ *       0.64 seconds to process regardless of the block size used.
  *
- *       FM_CHILD_STAT_SLEEP_FILECOUNT: The number of files to process (OS_stat) before
- *       sleeping FM_CHILD_STAT_SLEEP_MS.
- *       Works in tandem with FM_CHILD_STAT_SLEEP_MS to reduce CPU hogging
- *       while allowing slightly more customization to balance time the operator is waiting to
- *       get data back from a directory listing versus FM hogging the CPU with calls to OS_stat
+ *  \par Limits:
+ *       FM_CHILD_THROTTLE_BYTE_RATE: The FM application limits this value to be
+ *       zero or no less than #FM_CHILD_FILE_BLOCK_SIZE.  The value zero means
+ *       the data rate is not limited.
+ *
+ *       FM_CHILD_THROTTLE_STAT_RATE: The value zero means the OS_stat rate is not
+ *       limited.
+ *
+ *       FM_CHILD_THROTTLE_BURST_MS: The FM application limits this value to be
+ *       no less than 10 and no greater than 1000.
+ *
+ *       FM_CHILD_THROTTLE_VOLUME_COUNT: The FM application limits this value to
+ *       be no less than 1 and no greater than 16.
+ */
+#define FM_CHILD_THROTTLE_BYTE_RATE    1638400
+#define FM_CHILD_THROTTLE_STAT_RATE    0
+#define FM_CHILD_THROTTLE_BURST_MS     100
+#define FM_CHILD_THROTTLE_VOLUME_COUNT 4
+
+/**
+ * \brief Child Task Copy Buffer Settings
+ *
+ *  \par Description:
+ *       The copy file command streams file data through a dedicated buffer in
+ *       each child task rather than the #FM_CHILD_FILE_BLOCK_SIZE I/O buffer,
+ *       so that large files are copied with far fewer read and write calls.
+ *
+ *       FM_CHILD_COPY_BUFFER_SIZE defines the size of the copy buffer of each
+ *       child task.  This is also the default and the largest copy block size,
+ *       the copy block size may be reduced at run time with the
+ *       #FM_SET_COPY_BLOCK_SIZE_CC command.
+ *
+ *       FM_CHILD_COPY_BUFFER_ALIGN defines the alignment of the copy buffer in
+ *       memory, normally the page size of the target platform.
+ *
+ *       FM_CHILD_COPY_BUFFER_COUNT defines the number of copy buffers of each
+ *       child task.  With more than one buffer each child task gets a copy
+ *       writer task (#FM_CHILD_WRITER_TASK_NAME) that drains filled buffers
+ *       to the target file while the child task reads the next buffers from
+ *       the source file, so a copy between two devices runs at the speed of
+ *       the slower device rather than at the sum of both latencies.  With a
+ *       single buffer the child task reads and writes in turn and no writer
+ *       task is created.
+ *
+ *       The copy loop is paced by the child task throttle, see
+ *       #FM_CHILD_THROTTLE_BYTE_RATE, so the copy block size does not change the
+ *       bandwidth used by the child task.
  *
- *       In short:
- *       High SLEEP_MS means less CPU hogging by FM but a longer time to process a dir listing command
- *       Low SLEEP_MS means more potential CPU hogging by FM but shorter time to process a dir listing command
- *       High FILECOUNT means more potential CPU hogging by FM but a shorter time to process a dir listing command
- *       Low FILECOUNT means less CPU hogging by FM but longer time to process a dir listing command
  *  \par Limits:
- *       The default is zero unless the mission needs require them to be changed.
+ *       FM_CHILD_COPY_BUFFER_SIZE: The FM application limits this value to be no
+ *       less than #FM_CHILD_FILE_BLOCK_SIZE, no greater than 1MB and a multiple
+ *       of FM_CHILD_COPY_BUFFER_ALIGN.
  *
+ *       FM_CHILD_COPY_BUFFER_ALIGN: The FM application limits this value to be a
+ *       power of two no less than 8 and no greater than 64KB.
+ *
+ *       FM_CHILD_COPY_BUFFER_COUNT: The FM application limits this value to be
+ *       no less than 1 and no greater than 4.  Note that each child task
+ *       requires (FM_CHILD_COPY_BUFFER_COUNT * FM_CHILD_COPY_BUFFER_SIZE) bytes.
+ */
+#define FM_CHILD_COPY_BUFFER_SIZE  65536
+#define FM_CHILD_COPY_BUFFER_ALIGN 4096
+#define FM_CHILD_COPY_BUFFER_COUNT 2
+
+/**
+ * \brief Child Task Checkpoint Settings
+ *
+ *  \par Description:
+ *       Copy, move (between volumes), concat and concat list commands save a
+ *       checkpoint - the command arguments and the number of source bytes
+ *       known to be in the target file - while they run.  A child task that
+ *       finds its checkpoint file when it starts resumes that command from the
+ *       saved offset, so a long transfer cut off by an application restart or
+ *       a processor reset is not copied again from the start.  The checkpoint
+ *       file is removed when the command completes, fails or is aborted.
+ *
+ *       FM_CHILD_CHECKPOINT_FILE defines the checkpoint file name, each child
+ *       task appends its index to the name.  The file should be kept on a
+ *       volume that survives the resets of interest, a RAM disk is preserved
+ *       across a processor reset.
+ *
+ *       FM_CHILD_CHECKPOINT_INTERVAL defines the number of source bytes copied
+ *       between checkpoint saves.  Files shorter than this never cause a
+ *       checkpoint file to be written.
+ *
+ *  \par Limits:
+ *       FM_CHILD_CHECKPOINT_INTERVAL: The value zero disables checkpoints,
+ *       otherwise the FM application limits this value to be no less than
+ *       #FM_CHILD_COPY_BUFFER_SIZE and no greater than 256MB.  Checkpoints are
+ *       only saved within the first 2GB of the target file.
  */
-#define FM_CHILD_STAT_SLEEP_MS        0
-#define FM_CHILD_STAT_SLEEP_FILECOUNT 0
+#define FM_CHILD_CHECKPOINT_FILE     "/ram/fm_child_ckpt"
+#define FM_CHILD_CHECKPOINT_INTERVAL 1048576
 
 /**
  * \brief Child Task Command Queue Entry Count
@@ -275,14 +351,111 @@
  *       queue to be processed by the low priority FM child task.  A multi-entry
  *       command queue prevents the occasional slow command from being rejected
  *       because the child task has not yet completed the previous slow command.
+ *       Queued commands keep their file and directory names in the path block
+ *       pool (see #FM_CHILD_PATH_BLOCK_COUNT), so a deep queue only costs a few
+ *       dozen bytes per entry.
  *
  *  \par Limits:
  *       The FM application limits this value to be no less than 1 and no greater
- *       than 10.  There must be at least one because this is the method for
+ *       than 255.  There must be at least one because this is the method for
  *       passing command arguments from the parent to the child task.  The upper
  *       limit is arbitrary.
  */
-#define FM_CHILD_QUEUE_DEPTH 3
+#define FM_CHILD_QUEUE_DEPTH 64
+
+/**
+ * \brief Child Task Command Queue Path Block Size
+ *
+ *  \par Description:
+ *       File and directory names waiting in the child task command queue are
+ *       stored in a pool of fixed size blocks.  A name uses as many blocks
+ *       as its length (including the string terminator) requires, so short
+ *       names use less memory than a full #OS_MAX_PATH_LEN buffer.  This
+ *       definition sets the number of bytes in each block.
+ *
+ *  \par Limits:
+ *       The FM application limits this value to be no less than 8 and no
+ *       greater than #OS_MAX_PATH_LEN.  Smaller blocks waste less memory on
+ *       short names but take longer to copy.
+ */
+#define FM_CHILD_PATH_BLOCK_SIZE 32
+
+/**
+ * \brief Child Task Command Queue Path Block Count
+ *
+ *  \par Description:
+ *       This definition sets the number of blocks in the pool holding the file
+ *       and directory names of queued commands (see #FM_CHILD_PATH_BLOCK_SIZE).
+ *       A command is only accepted for the child task when the pool has enough
+ *       free blocks for three names of #OS_MAX_PATH_LEN bytes, so the pool
+ *       together with #FM_CHILD_QUEUE_DEPTH sets how many commands may wait.
+ *
+ *  \par Limits:
+ *       The FM application limits this value to be no less than the number of
+ *       blocks needed by three #OS_MAX_PATH_LEN names and no greater than 65535.
+ */
+#define FM_CHILD_PATH_BLOCK_COUNT 256
+
+/**
+ * \brief Child Task Fast Lane Burst Limit
+ *
+ *  \par Description:
+ *       Commands waiting for a child task are held in two lanes.  Short
+ *       metadata commands (rename, delete, create and delete directory, set
+ *       permissions and file info without a CRC) wait in the fast lane, all
+ *       other commands wait in the bulk lane, as do short commands on a
+ *       name that a command waiting in the bulk lane also works on, so
+ *       that commands on the same names run in order.  Each lane holds up to
+ *       #FM_CHILD_QUEUE_DEPTH commands and a free child task always takes a
+ *       fast lane command first.  This definition sets how many fast lane
+ *       commands may be taken in a row while bulk lane commands are waiting
+ *       before one bulk lane command is taken, so that a steady stream of
+ *       metadata commands cannot starve the bulk lane.
+ *
+ *  \par Limits:
+ *       The FM application limits this value to be no less than 1 and no
+ *       greater than 255.
+ */
+#define FM_CHILD_FAST_LANE_BURST 8
+
+/**
+ * \brief Child Task Worker Count
+ *
+ *  \par Description:
+ *       This definition sets the number of FM child tasks (workers) that
+ *       share the command queue in the FM main task to FM child task
+ *       handshake interface.  Each worker takes the next pending command
+ *       from the queue, so a slow command (such as copying a very large
+ *       file) running on one worker does not delay commands that are
+ *       picked up by the other workers.  Each worker has its own file I/O
+ *       buffer and reports its own command counters and command codes in
+ *       housekeeping telemetry.  A worker does not start a command whose
+ *       file or directory names overlap those of a command taken earlier
+ *       by another worker that is still running, so commands working on
+ *       the same names still run in the order they were sent.
+ *
+ *  \par Limits:
+ *       The FM application limits this value to be no less than 1 and no
+ *       greater than 8.  The default of 1 gives the original single child
+ *       task behavior, missions opt in to more workers.  Note that each
+ *       worker requires its own stack of #FM_CHILD_TASK_STACK_SIZE bytes.
+ */
+#define FM_CHILD_TASK_COUNT 1
+
+/**
+ * \brief Child Task Path Wait Interval
+ *
+ *  \par Description:
+ *       This definition sets the number of milliseconds a child task waits
+ *       before it checks again whether a command that works on the same
+ *       names as the command it has taken has finished on another child
+ *       task.  See #FM_CHILD_TASK_COUNT.
+ *
+ *  \par Limits:
+ *       The FM application limits this value to be no less than 1 and no
+ *       greater than 1000.
+ */
+#define FM_CHILD_PATH_WAIT_MS 10
 
 /**
  * \brief Child Task Name - cFE object name
@@ -290,11 +463,14 @@
  *  \par Description:
  *       This definition sets the FM child task object name.  The task object
  *       name is required during child task creation by cFE Executive Services.
+ *       The first child task uses this name, each additional child task in
+ *       the pool appends "_<index>" (for example "FM_CHILD_TASK_1").
  *
  *  \par Limits:
- *       FM requires that this name be defined, but otherwise places
- *       no limits on the definition.  Refer to CFE Executive Services
- *       for specific information on limits related to object names.
+ *       FM requires that this name be defined, and it must leave room for
+ *       the index suffix within the OSAL object name length.  Refer to CFE
+ *       Executive Services for specific information on limits related to
+ *       object names.
  */
 #define FM_CHILD_TASK_NAME "FM_CHILD_TASK"
 
@@ -352,6 +528,277 @@
  */
 #define FM_CHILD_SEM_NAME "FM_CHILD_SEM"
 
+/**
+ * \brief Child Copy Writer Task Name - cFE object name
+ *
+ *  \par Description:
+ *       This definition sets the object name of the copy writer task of each
+ *       child task, with "_<index>" appended (for example "FM_CHILD_WR_0").
+ *       Writer tasks are only created when #FM_CHILD_COPY_BUFFER_COUNT is
+ *       greater than 1 and run at #FM_CHILD_TASK_PRIORITY.
+ *
+ *  \par Limits:
+ *       FM requires that this name be defined, and it must leave room for
+ *       the index suffix within the OSAL object name length.  Refer to CFE
+ *       Executive Services for specific information on limits related to
+ *       object names.
+ */
+#define FM_CHILD_WRITER_TASK_NAME "FM_CHILD_WR"
+
+/**
+ * \brief Child Copy Writer Task Stack Size
+ *
+ *  \par Description:
+ *       This definition sets the size in bytes of the stack of each copy
+ *       writer task.  The writer task only writes copy buffers to the target
+ *       file, so it needs far less stack than the child task.
+ *
+ *  \par Limits:
+ *       The FM application limits this value to be no less than 2048
+ *       and no greater than 20480.  These limits are purely arbitrary
+ *       and may need to be modified for specific platforms.
+ */
+#define FM_CHILD_WRITER_STACK_SIZE 8192
+
+/**
+ * \brief Child CRC Helper Task Name
+ *
+ *  \par Description:
+ *       This definition sets the object name of each CRC helper task, with
+ *       "_<index>" appended (for example "FM_CRC_HLP_0").  Helper tasks are
+ *       only created when #FM_CHILD_CRC_SPLIT_SIZE is not zero and run at
+ *       #FM_CHILD_TASK_PRIORITY.
+ *
+ *  \par Limits:
+ *       FM requires that this name be defined, and it must leave room for
+ *       the index suffix within the OSAL object name length.  Refer to CFE
+ *       Executive Services for specific information on limits related to
+ *       object names.
+ */
+#define FM_CHILD_CRC_HELPER_TASK_NAME "FM_CRC_HLP"
+
+/**
+ * \brief Child CRC Helper Task Stack Size
+ *
+ *  \par Description:
+ *       This definition sets the size in bytes of the stack of each CRC
+ *       helper task.  The file data buffer of a helper is not on its stack.
+ *
+ *  \par Limits:
+ *       The FM application limits this value to be no less than 2048
+ *       and no greater than 20480.  These limits are purely arbitrary
+ *       and may need to be modified for specific platforms.
+ */
+#define FM_CHILD_CRC_HELPER_STACK_SIZE 8192
+
+/**
+ * \brief Child Task Verification Default
+ *
+ *  \par Description:
+ *       This definition selects where the file system state of command
+ *       arguments is verified after startup.  With a value of 0 the main
+ *       task verifies that files and directories exist, are closed, etc.
+ *       before a command is queued.  With a value of 1 the main task only
+ *       checks the names and the child task verifies the state when the
+ *       command executes, so slow storage does not delay the main task.
+ *       The #FM_SET_VERIFY_MODE_CC command changes the setting.
+ *
+ *  \par Limits:
+ *       This value must be 0 or 1.
+ */
+#define FM_CHILD_VERIFY_DEFAULT 0
+
+/**
+ * \brief Child Task Delete List Size
+ *
+ *  \par Description:
+ *       The Delete All Files command collects the names of the closed
+ *       files it finds in a directory in a list held by the child task,
+ *       then removes the files named in the list.  When the list is full
+ *       the files collected so far are removed as one batch, and the
+ *       directory read starts over, passing the entries that were read
+ *       before.  This definition sets the number of bytes in the list of
+ *       each child task.  Each name uses its length plus one byte.
+ *
+ *  \par Limits:
+ *       The FM application limits this value to be no less than
+ *       #OS_MAX_PATH_LEN and no greater than 1MB.  Larger lists mean fewer
+ *       batches and more memory for each child task.
+ */
+#define FM_CHILD_DELETE_LIST_SIZE 8192
+
+/**
+ * \brief Child Task Delete Tree Stack Size
+ *
+ *  \par Description:
+ *       The Delete Directory Tree command walks the tree with a stack of
+ *       directory names held by the child task instead of recursing on the
+ *       child task stack.  A directory is pushed when it is found and
+ *       popped once everything below it has been visited, so the stack
+ *       holds the directories along the current path plus the
+ *       sub-directories found but not yet visited.  This definition sets
+ *       the number of names each child task can hold.  A sub-directory
+ *       found while the stack is full is skipped and reported as not
+ *       deleted.
+ *
+ *  \par Limits:
+ *       The FM application limits this value to be no less than 1 and no
+ *       greater than 4096.  Each entry uses #OS_MAX_PATH_LEN bytes plus
+ *       a flag.
+ */
+#define FM_CHILD_TREE_STACK_SIZE 64
+
+/**
+ * \brief Child Task Delete Mode Default
+ *
+ *  \par Description:
+ *       Selects how the child task deletes files at startup.  When set
+ *       to #FM_DELETE_MODE_DIRECT (0) files are removed by the delete
+ *       commands.  When set to #FM_DELETE_MODE_TRASH (1) they are renamed
+ *       into the trash directory of their volume and removed later by
+ *       purge passes.  The #FM_SET_DELETE_MODE_CC command changes the
+ *       setting.
+ *
+ *  \par Limits:
+ *       The FM application limits this value to be 0 or 1.
+ */
+#define FM_CHILD_DELETE_DEFAULT 0
+
+/**
+ * \brief Child Task Trash Directory Name
+ *
+ *  \par Description:
+ *       Name of the trash directory the child task creates at the top of
+ *       each volume when files are deleted in #FM_DELETE_MODE_TRASH.  A
+ *       file is renamed into the trash directory of the volume that holds
+ *       it, so the rename never moves file data.  Every file in these
+ *       directories is removed by purge passes.
+ *
+ *  \par Limits:
+ *       FM requires that this name be defined.  The name must not be used
+ *       by any other directory, files in it are deleted without checks.
+ */
+#define FM_CHILD_TRASH_DIR_NAME ".fm_trash"
+
+/**
+ * \brief Child Task Trash Volume Count
+ *
+ *  \par Description:
+ *       Number of volumes whose trash directory the FM application can
+ *       keep track of.  A volume is claimed the first time a file on it
+ *       is deleted in #FM_DELETE_MODE_TRASH and kept until restart.  Files
+ *       on further volumes are removed directly.
+ *
+ *  \par Limits:
+ *       The FM application limits this value to be no less than 1 and no
+ *       greater than 16.  Each volume uses #OS_MAX_PATH_LEN bytes plus 4.
+ */
+#define FM_CHILD_TRASH_VOLUMES 4
+
+/**
+ * \brief Child Task Purge Budget
+ *
+ *  \par Description:
+ *       Largest number of files a scheduled purge pass removes from the
+ *       trash directories.  No more names than the budget allows are read
+ *       into a batch of the delete list, see #FM_CHILD_DELETE_LIST_SIZE.
+ *       A pass also ends after the current batch when a command is waiting
+ *       in the child task queue.  Commanded purge passes have no budget.
+ *
+ *  \par Limits:
+ *       The FM application limits this value to be no less than 1 and no
+ *       greater than 1000.
+ */
+#define FM_CHILD_PURGE_BUDGET 32
+
+/**
+ * \brief Child Task CRC Cache Entries
+ *
+ *  \par Description:
+ *       Number of file CRC results kept by the child tasks.  A Get File
+ *       Info command asking for a CRC that was computed before for the
+ *       same file name, size, modify time and CRC type reports the kept
+ *       result instead of reading the file again.  A kept CRC-16 of a file
+ *       that has only grown since is continued from the kept size.  When
+ *       the cache is full the entry used least recently is replaced.
+ *
+ *  \par Limits:
+ *       The FM application limits this value to be no less than 1 and no
+ *       greater than 256.  Each entry uses #OS_MAX_PATH_LEN bytes plus 28.
+ */
+#define FM_CHILD_CRC_CACHE_ENTRIES 16
+
+/**
+ * \brief Child Task CRC Helper Tasks
+ *
+ *  \par Description:
+ *       Number of CRC helper tasks shared by the child tasks.  The CRC-16
+ *       of a large file is computed in #FM_CHILD_CRC_HELPERS + 1 ranges at
+ *       once, the helpers reading the leading ranges while the child task
+ *       reads the last one, and the range results are combined into the
+ *       CRC a single pass would give.  A child task finding the helpers in
+ *       use by another child task computes its CRC in a single pass.
+ *
+ *  \par Limits:
+ *       The FM application limits this value to be no less than 1 and no
+ *       greater than 8.  Each helper uses #FM_CHILD_FILE_BLOCK_SIZE bytes
+ *       for its file data buffer.
+ */
+#define FM_CHILD_CRC_HELPERS 2
+
+/**
+ * \brief Child Task CRC Split Size
+ *
+ *  \par Description:
+ *       Smallest file, in bytes, whose CRC-16 is split between the CRC
+ *       helper tasks.  Smaller files, and CRC types other than CRC-16, are
+ *       read in a single pass by the child task.  The value zero turns the
+ *       split off and no helper tasks are created.
+ *
+ *  \par Limits:
+ *       The FM application limits this value to be zero or no less than
+ *       #FM_CHILD_FILE_BLOCK_SIZE times (#FM_CHILD_CRC_HELPERS + 1), so that
+ *       every range holds at least one block.
+ */
+#define FM_CHILD_CRC_SPLIT_SIZE 1048576
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM platform configuration parameters - latency histograms       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**
+ * \brief Command Latency Histogram Bucket Count
+ *
+ *  \par Description:
+ *       Number of buckets in each command latency histogram.  Bucket 0
+ *       counts times under 4 microseconds and each bucket after it covers
+ *       four times the range of the one before.  The last bucket counts
+ *       every longer time, with 16 buckets it starts at about 18 minutes.
+ *
+ *  \par Limits:
+ *       The FM application limits this value to be no less than 2 and
+ *       no greater than 16.
+ */
+#define FM_LATENCY_BUCKET_COUNT 16
+
+/**
+ * \brief Command Latency Histogram Command Code Count
+ *
+ *  \par Description:
+ *       Command codes below this value each have their own verify, queue
+ *       wait and execute latency histograms.  Higher command codes are not
+ *       recorded.  The telemetry packet holds three histograms for every
+ *       command code, so this value sets most of its size.
+ *
+ *  \par Limits:
+ *       The FM application limits this value to be no less than 1 and
+ *       no greater than 64.  It should be greater than the highest FM
+ *       command code.
+ */
+#define FM_LATENCY_CC_COUNT 40
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* FM platform configuration parameters - table definitions        */
@@ -444,6 +891,113 @@
  */
 #define FM_TABLE_VALIDATION_ERR (-1)
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM platform configuration parameters - retention table          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**
+ * \brief Retention Table Name - cFE object name
+ *
+ *  \par Description:
+ *       Table object name is required during table creation.
+ *
+ *  \par Limits:
+ *       FM requires that this name be defined, but otherwise places
+ *       no limits on the definition.  Refer to CFE Table Services
+ *       for specific information on limits related to table names.
+ */
+#define FM_RETENTION_TABLE_CFE_NAME "Retention"
+
+/**
+ * \brief Retention Table Name - filename with path
+ *
+ *  \par Description:
+ *       Table name with path is required to load table at startup.
+ *
+ *  \par Limits:
+ *       FM requires that this name be defined, but otherwise places
+ *       no limits on the definition.  If the named table does not
+ *       exist or fails validation, the table load will fail and no
+ *       directory is managed until a valid table is loaded.
+ */
+#define FM_RETENTION_TABLE_DEF_NAME "/cf/fm_retention.tbl"
+
+/**
+ * \brief Retention Table Name - filename without path
+ *
+ *  \par Description:
+ *       Table name without path defines the output name for the table
+ *       file created during the table make process.
+ *
+ *  \par Limits:
+ *       FM requires that this name be defined, but otherwise places
+ *       no limits on the definition.  If the table name is not
+ *       valid then the make process may fail, or the table file may
+ *       be unloadable to the target hardware.
+ */
+#define FM_RETENTION_TABLE_FILENAME "fm_retention.tbl"
+
+/**
+ * \brief Retention Table Description
+ *
+ *  \par Description:
+ *       Table files contain headers that include descriptive text.
+ *       This text will be put into the file header during the table
+ *       make process.
+ *
+ *  \par Limits:
+ *       FM requires that this name be defined, but otherwise places
+ *       no limits on the definition.  Refer to cFE Table Services
+ *       for limits related to table descriptive text.
+ */
+#define FM_RETENTION_TABLE_DEF_DESC "FM Directory Retention Table"
+
+/**
+ * \brief Number of Retention Table Entries
+ *
+ *  \par Description:
+ *       This value defines the number of directories whose size FM may
+ *       be set to hold under a limit.  Each entry also has its own
+ *       eviction index of #FM_RETENTION_INDEX_SIZE files.
+ *
+ *  \par Limits:
+ *       FM limits this value to be not less than 1 and not greater than 32.
+ */
+#define FM_RETENTION_ENTRY_COUNT 4
+
+/**
+ * \brief Number of Retention Priority Patterns
+ *
+ *  \par Description:
+ *       Each retention table entry holds this many file name patterns.
+ *       When an entry removes the lowest priority files first, a file
+ *       matching the first pattern goes before a file matching the
+ *       second and so on, files matching no pattern go last.
+ *
+ *  \par Limits:
+ *       FM limits this value to be not less than 1 and not greater than 16.
+ */
+#define FM_RETENTION_PATTERN_COUNT 4
+
+/**
+ * \brief Retention Eviction Index Size
+ *
+ *  \par Description:
+ *       Each retention pass reads the managed directory once and keeps
+ *       the files to be removed first in an index of this many entries,
+ *       ordered so that each removal costs O(log n).  Files beyond the
+ *       index are still counted toward the limits.  When removing every
+ *       file in the index does not bring the directory back under its
+ *       limits, the next pass continues.
+ *
+ *  \par Limits:
+ *       FM limits this value to be not less than 1 and not greater than
+ *       65536.  Each index entry uses #OS_MAX_FILE_NAME bytes plus 12.
+ */
+#define FM_RETENTION_INDEX_SIZE 256
+
 /**\}*/
 
 #endif
@@ -173,6 +173,23 @@ CFE_Status_t FM_AppInit(void)
     /* Initialize global data  */
     memset(&FM_GlobalData, 0, sizeof(FM_GlobalData));
 
+    /* Copy in blocks as large as the child task copy buffer until commanded otherwise */
+    FM_GlobalData.ChildCopyBlockSize = FM_CHILD_COPY_BUFFER_SIZE;
+
+    /* Verify command arguments where the platform selects until commanded otherwise */
+    FM_GlobalData.ChildVerifyMode = FM_CHILD_VERIFY_DEFAULT;
+
+    /* Delete files the way the platform selects until commanded otherwise */
+    FM_GlobalData.ChildDeleteMode = FM_CHILD_DELETE_DEFAULT;
+
+    /* Pace the child tasks at the default rates until commanded otherwise */
+    FM_GlobalData.ChildThrottle[FM_CHILD_THROTTLE_DEFAULT].ByteRate = FM_CHILD_THROTTLE_BYTE_RATE;
+    FM_GlobalData.ChildThrottle[FM_CHILD_THROTTLE_DEFAULT].StatRate = FM_CHILD_THROTTLE_STAT_RATE;
+
+    /* Build the CRC and digest tables before any child task can compute a file CRC or digest */
+    FM_CrcInit(&FM_GlobalData.Crc);
+    FM_DigestInit(&FM_GlobalData.Digest);
+
     /* Register for event services */
     Result = CFE_EVS_Register(NULL, 0, CFE_EVS_EventFilter_BINARY);
 
@@ -221,7 +238,7 @@ CFE_Status_t FM_AppInit(void)
             if (Result != CFE_SUCCESS)
             {
                 CFE_EVS_SendEvent(FM_STARTUP_TABLE_INIT_ERR_EID, CFE_EVS_EventType_ERROR,
-                                  "%s register free space table: result = 0x%08X", ErrText, (unsigned int)Result);
+                                  "%s register tables: result = 0x%08X", ErrText, (unsigned int)Result);
             }
             else
             {
@@ -249,11 +266,17 @@ CFE_Status_t FM_AppInit(void)
 void FM_SendHkCmd(const CFE_SB_Buffer_t *BufPtr)
 {
     FM_HousekeepingPkt_Payload_t *PayloadPtr;
+    FM_ChildWorker_t *            Worker;
+    uint32                        i;
 
     FM_ReleaseTablePointers();
 
     FM_AcquireTablePointers();
 
+    /* Housekeeping requests also pace the retention and trash purge passes */
+    FM_RetentionSchedule();
+    FM_TrashSchedule();
+
     /* Initialize housekeeping telemetry message */
     CFE_MSG_Init(CFE_MSG_PTR(FM_GlobalData.HousekeepingPkt.TelemetryHeader), CFE_SB_ValueToMsgId(FM_HK_TLM_MID),
                  sizeof(FM_HousekeepingPkt_t));
@@ -266,17 +289,198 @@ void FM_SendHkCmd(const CFE_SB_Buffer_t *BufPtr)
 
     PayloadPtr->NumOpenFiles = FM_GetOpenFilesData(NULL);
 
-    /* Report child task command counters */
-    PayloadPtr->ChildCmdCounter     = FM_GlobalData.ChildCmdCounter;
-    PayloadPtr->ChildCmdErrCounter  = FM_GlobalData.ChildCmdErrCounter;
-    PayloadPtr->ChildCmdWarnCounter = FM_GlobalData.ChildCmdWarnCounter;
+    /* Report command counters and activity for each child task in the pool */
+    for (i = 0; i < FM_CHILD_TASK_COUNT; i++)
+    {
+        Worker = &FM_GlobalData.ChildWorker[i];
+
+        PayloadPtr->ChildWorker[i].CmdCounter     = Worker->CmdCounter;
+        PayloadPtr->ChildWorker[i].CmdErrCounter  = Worker->CmdErrCounter;
+        PayloadPtr->ChildWorker[i].CmdWarnCounter = Worker->CmdWarnCounter;
+        PayloadPtr->ChildWorker[i].CurrentCC      = Worker->CurrentCC;
+        PayloadPtr->ChildWorker[i].PreviousCC     = Worker->PreviousCC;
+
+        /* Child task command counters are the sum across the pool */
+        PayloadPtr->ChildCmdCounter += Worker->CmdCounter;
+        PayloadPtr->ChildCmdErrCounter += Worker->CmdErrCounter;
+        PayloadPtr->ChildCmdWarnCounter += Worker->CmdWarnCounter;
+
+        /* Report the command executing on the lowest numbered busy child task */
+        if ((PayloadPtr->ChildCurrentCC == 0) && (Worker->CurrentCC != 0))
+        {
+            PayloadPtr->ChildCurrentCC = Worker->CurrentCC;
+        }
+
+        /* Likewise the command last completed, each worker orders only its own commands */
+        if ((PayloadPtr->ChildPreviousCC == 0) && (Worker->PreviousCC != 0))
+        {
+            PayloadPtr->ChildPreviousCC = Worker->PreviousCC;
+        }
+    }
+
+    PayloadPtr->ChildQueueCount     = FM_ChildQueueCount();
+    PayloadPtr->ChildFastQueueCount = FM_ChildLaneCount(&FM_GlobalData.ChildLane[FM_CHILD_LANE_FAST]);
+    PayloadPtr->ChildTaskCount      = FM_GlobalData.ChildTaskCount;
+
+    /* Report child queue handover counters */
+    PayloadPtr->ChildEnqueueCount  = FM_GlobalData.ChildEnqueueCount;
+    PayloadPtr->ChildDequeueCount  = FM_GlobalData.ChildDequeueCount;
+    PayloadPtr->ChildQueueWaitLast = FM_GlobalData.ChildQueueWaitLast;
+    PayloadPtr->ChildQueueWaitMax  = FM_GlobalData.ChildQueueWaitMax;
+
+    /* Report remaining space in the queue path name pool */
+    PayloadPtr->ChildPathBlocksFree = FM_GetChildPathBlocksFree(FM_CHILD_PATH_BLOCK_COUNT);
+
+    PayloadPtr->ChildCopyBlockSize = FM_GlobalData.ChildCopyBlockSize;
+    PayloadPtr->ChildByteRate      = FM_GlobalData.ChildThrottle[FM_CHILD_THROTTLE_DEFAULT].ByteRate;
+    PayloadPtr->ChildStatRate      = FM_GlobalData.ChildThrottle[FM_CHILD_THROTTLE_DEFAULT].StatRate;
+    PayloadPtr->ChildVerifyMode    = FM_GlobalData.ChildVerifyMode;
+    PayloadPtr->ChildDeleteMode    = FM_GlobalData.ChildDeleteMode;
 
-    PayloadPtr->ChildQueueCount = FM_GlobalData.ChildQueueCount;
+    PayloadPtr->RetentionPassCount = FM_GlobalData.RetentionPassCount;
+    PayloadPtr->RetentionFileCount = FM_GlobalData.RetentionFileCount;
 
-    /* Report current and previous commands executed by the child task */
-    PayloadPtr->ChildCurrentCC  = FM_GlobalData.ChildCurrentCC;
-    PayloadPtr->ChildPreviousCC = FM_GlobalData.ChildPreviousCC;
+    PayloadPtr->TrashFileCount  = FM_GlobalData.TrashFileCount;
+    PayloadPtr->TrashPurgeCount = FM_GlobalData.TrashPurgeCount;
+
+    PayloadPtr->CrcCacheHits   = FM_GlobalData.CrcCacheHits;
+    PayloadPtr->CrcCacheMisses = FM_GlobalData.CrcCacheMisses;
+    PayloadPtr->CrcAppendCount = FM_GlobalData.CrcAppendCount;
 
     CFE_SB_TimeStampMsg(CFE_MSG_PTR(FM_GlobalData.HousekeepingPkt.TelemetryHeader));
     CFE_SB_TransmitMsg(CFE_MSG_PTR(FM_GlobalData.HousekeepingPkt.TelemetryHeader), true);
+
+    FM_SendChildProgress();
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM application -- child task progress telemetry                 */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void FM_SendChildProgress(void)
+{
+    FM_ChildProgressEntry_t *EntryPtr;
+    FM_ChildWorker_t *       Worker;
+    OS_time_t                Now;
+    int64                    ElapsedMs = 0;
+    bool                     Busy      = false;
+    uint32                   i;
+
+    for (i = 0; i < FM_CHILD_TASK_COUNT; i++)
+    {
+        if (FM_GlobalData.ChildWorker[i].CurrentCC != 0)
+        {
+            Busy = true;
+        }
+    }
+
+    /* The packet after the last command ends shows every child task idle */
+    if (Busy || FM_GlobalData.ChildProgressBusy)
+    {
+        /* Initialize child progress telemetry message (set all data to zero) */
+        CFE_MSG_Init(CFE_MSG_PTR(FM_GlobalData.ChildProgressPkt.TelemetryHeader),
+                     CFE_SB_ValueToMsgId(FM_CHILD_PROGRESS_TLM_MID), sizeof(FM_ChildProgressPkt_t));
+
+        OS_GetLocalTime(&Now);
+
+        for (i = 0; i < FM_CHILD_TASK_COUNT; i++)
+        {
+            Worker   = &FM_GlobalData.ChildWorker[i];
+            EntryPtr = &FM_GlobalData.ChildProgressPkt.Payload.ChildWorker[i];
+
+            EntryPtr->CurrentCC = Worker->CurrentCC;
+
+            if (EntryPtr->CurrentCC != 0)
+            {
+                EntryPtr->BytesDone  = Worker->ProgressBytes;
+                EntryPtr->BytesTotal = Worker->ProgressTotal;
+
+                strncpy(EntryPtr->Source, Worker->ProgressSource, sizeof(EntryPtr->Source) - 1);
+                strncpy(EntryPtr->Target, Worker->ProgressTarget, sizeof(EntryPtr->Target) - 1);
+
+                ElapsedMs = OS_TimeGetTotalMilliseconds(OS_TimeSubtract(Now, Worker->ProgressStart));
+
+                if (ElapsedMs > 0)
+                {
+                    EntryPtr->ElapsedTime = (uint32)ElapsedMs;
+                    EntryPtr->ByteRate    = (uint32)((EntryPtr->BytesDone * 1000) / (uint64)ElapsedMs);
+                }
+
+                /* Time remaining is only known once some bytes have been timed */
+                if ((EntryPtr->ByteRate != 0) && (EntryPtr->BytesTotal > EntryPtr->BytesDone))
+                {
+                    EntryPtr->TimeRemaining =
+                        (uint32)((EntryPtr->BytesTotal - EntryPtr->BytesDone) / EntryPtr->ByteRate);
+                }
+            }
+        }
+
+        CFE_SB_TimeStampMsg(CFE_MSG_PTR(FM_GlobalData.ChildProgressPkt.TelemetryHeader));
+        CFE_SB_TransmitMsg(CFE_MSG_PTR(FM_GlobalData.ChildProgressPkt.TelemetryHeader), true);
+    }
+
+    FM_GlobalData.ChildProgressBusy = Busy;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM application -- queue the retention passes that are due       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void FM_RetentionSchedule(void)
+{
+    FM_RetentionTableEntry_t *EntryPtr;
+    FM_RetentionState_t *     State;
+    OS_time_t                 LocalTime;
+    uint32                    Now;
+    uint32                    i;
+
+    /* Nothing is managed until a retention table has been loaded */
+    if (FM_GlobalData.RetentionTablePtr != NULL)
+    {
+        OS_GetLocalTime(&LocalTime);
+        Now = (uint32)OS_TimeGetTotalSeconds(LocalTime);
+
+        for (i = 0; i < FM_RETENTION_ENTRY_COUNT; i++)
+        {
+            EntryPtr = &FM_GlobalData.RetentionTablePtr->Entries[i];
+            State    = &FM_GlobalData.Retention[i];
+
+            /* A clock set back by more than the interval does not hold the entry off */
+            if ((EntryPtr->Enabled != 0) && (FM_ATOMIC_LOAD(&State->Busy) == 0) &&
+                ((Now >= State->NextTime) || ((State->NextTime - Now) > EntryPtr->Interval)))
+            {
+                /* A pass that cannot be queued now is tried again after the interval */
+                State->NextTime = Now + EntryPtr->Interval;
+
+                FM_StartRetention(i, false);
+            }
+        }
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM application -- queue a trash purge pass when one is due      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void FM_TrashSchedule(void)
+{
+    bool   Pending = false;
+    uint32 i;
+
+    for (i = 0; i < FM_CHILD_TRASH_VOLUMES; i++)
+    {
+        if (FM_ATOMIC_LOAD(&FM_GlobalData.Trash[i].Pending) != 0)
+        {
+            Pending = true;
+        }
+    }
+
+    /* Purging waits for the queue to empty so that it never delays a command */
+    if (Pending && (FM_ATOMIC_LOAD(&FM_GlobalData.TrashPurgeBusy) == 0) && (FM_ChildQueueCount() == 0))
+    {
+        FM_StartPurge(false);
+    }
 }
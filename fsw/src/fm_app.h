@@ -27,6 +27,8 @@
 #include "cfe.h"
 #include "fm_msg.h"
 #include "fm_compression.h"
+#include "fm_crc.h"
+#include "fm_digest.h"
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
@@ -43,12 +45,456 @@
  */
 #define FM_SB_TIMEOUT 1000
 
+/**
+ *  \brief Path blocks reserved for each command sent to the child task
+ *
+ *  \par Description
+ *      Worst case number of path blocks needed by the three names of one
+ *      queued command.
+ */
+#define FM_CHILD_PATH_BLOCKS_PER_CMD (3 * ((OS_MAX_PATH_LEN + FM_CHILD_PATH_BLOCK_SIZE - 1) / FM_CHILD_PATH_BLOCK_SIZE))
+
+/**
+ *  \brief Child task copy buffer alignment attribute
+ *
+ *  \par Description
+ *      Places each child task copy buffer on a #FM_CHILD_COPY_BUFFER_ALIGN
+ *      boundary.  Compilers without the attribute get natural alignment.
+ */
+#if defined(__GNUC__)
+#define FM_CHILD_COPY_BUFFER_ALIGNED __attribute__((aligned(FM_CHILD_COPY_BUFFER_ALIGN)))
+#else
+#define FM_CHILD_COPY_BUFFER_ALIGNED
+#endif
+
+/**
+ *  \brief Child task checkpoint record signature
+ *
+ *  \par Description
+ *      Marks a checkpoint file written by this version of FM.
+ */
+#define FM_CHILD_CHECKPOINT_SIGNATURE 0x464D434B
+
+/**
+ *  \brief Largest target offset of a child task checkpoint
+ *
+ *  \par Description
+ *      Resumed copies are positioned with OS_lseek, which takes a 32-bit
+ *      signed offset, so no checkpoint is saved past this target offset.
+ */
+#define FM_CHILD_CHECKPOINT_MAX_OFFSET (0x7FFFFFFF - FM_CHILD_CHECKPOINT_INTERVAL)
+
+/**
+ *  \name Child task queue lanes
+ *
+ *  Commands queued for the child tasks are split into two lanes.  Short
+ *  metadata commands are placed in the fast lane and are dispatched ahead
+ *  of the long running data commands waiting in the bulk lane.
+ */
+/**\{*/
+#define FM_CHILD_LANE_FAST  0 /**< \brief Rename, delete, create/delete directory, set permissions */
+#define FM_CHILD_LANE_BULK  1 /**< \brief Copy, move, concat, decompress, CRC and directory listings */
+#define FM_CHILD_LANE_COUNT 2 /**< \brief Number of child task queue lanes */
+/**\}*/
+
+/**
+ *  \name Child task throttle entries
+ *
+ *  The default throttle entry is followed by one entry for each volume
+ *  that may be given its own rates.
+ */
+/**\{*/
+#define FM_CHILD_THROTTLE_DEFAULT 0 /**< \brief Entry holding the default rates */
+#define FM_CHILD_THROTTLE_ENTRIES (FM_CHILD_THROTTLE_VOLUME_COUNT + 1) /**< \brief Number of throttle entries */
+/**\}*/
+
+/**
+ *  \name Open path set sizes
+ *
+ *  The open path set holds the name of every stream OSAL can have open and
+ *  has twice as many hash slots as names, so a probe always ends at an
+ *  empty slot after a few steps.
+ */
+/**\{*/
+#define FM_OPEN_PATH_SET_ENTRIES OS_MAX_NUM_OPEN_FILES          /**< \brief Names the set can hold */
+#define FM_OPEN_PATH_SET_SLOTS   (2 * FM_OPEN_PATH_SET_ENTRIES) /**< \brief Hash slots in the set */
+/**\}*/
+
+#define FM_CHILD_CMD_PATHS 3 /**< \brief Names compared when child task commands are ordered */
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* FM -- application global data structure                         */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
+/**
+ *  \brief Child task queue path block data structure
+ *
+ *  File and directory names of queued commands are kept in a pool of these
+ *  blocks, chained together when a name does not fit in one block.  Only
+ *  the parent task allocates blocks and a child task releases each block
+ *  once it has copied the name out.
+ */
+typedef struct
+{
+    uint32 InUse; /**< \brief Set by the parent task on allocation, cleared by the child task on release */
+    uint16 Next;  /**< \brief Next block of the name plus one, zero for the last block */
+    uint16 Spare; /**< \brief Structure alignment spare */
+
+    char Data[FM_CHILD_PATH_BLOCK_SIZE]; /**< \brief Part of the name (string terminator in the last block) */
+} FM_ChildPathBlock_t;
+
+/**
+ *  \brief Open path set data structure
+ *
+ *  Snapshot of the names of the open streams, taken with one pass over the
+ *  OSAL object table and hashed so that each file state lookup made by a
+ *  command costs one probe instead of another pass.  A snapshot is taken
+ *  the first time a command needs one and is dropped when the next command
+ *  starts.  Commands that remove or move files a batch at a time also drop
+ *  it before each batch, so a file opened while a long run is in progress
+ *  is seen within a batch.
+ */
+typedef struct
+{
+    bool   Valid;    /**< \brief Set once the snapshot has been taken for the command in progress */
+    bool   Overflow; /**< \brief Set when more streams were open than the set can hold */
+    uint16 Count;    /**< \brief Number of names in the set */
+
+    uint16 Slot[FM_OPEN_PATH_SET_SLOTS];   /**< \brief Name index plus one for each hash slot, zero when empty */
+    uint32 Hash[FM_OPEN_PATH_SET_ENTRIES]; /**< \brief Hash of each name */
+
+    char Path[FM_OPEN_PATH_SET_ENTRIES][OS_MAX_PATH_LEN]; /**< \brief Names of the open streams */
+} FM_OpenPathSet_t;
+
+/**
+ *  \brief Child command path set data structure
+ *
+ *  First source, second source and target names of a child task command.
+ *  Two commands whose names overlap (see #FM_PathsOverlap) are run in the
+ *  order they were taken from the queue.
+ */
+typedef struct
+{
+    char Path[FM_CHILD_CMD_PATHS][OS_MAX_PATH_LEN]; /**< \brief Names of the command, empty when not used */
+} FM_ChildPathSet_t;
+
+/**
+ *  \brief Child task queue slot data structure
+ *
+ *  Compact form of #FM_ChildQueueEntry_t held in the queue lanes, the names
+ *  are replaced by references into the path block pool.
+ */
+typedef struct
+{
+    CFE_MSG_FcnCode_t CommandCode;     /**< \brief Command code - identifies the command */
+    uint8             GetSizeTimeMode; /**< \brief Whether to invoke stat call for size and time */
+    uint8             Flushed;         /**< \brief Set by the parent task when the command is dropped unexecuted */
+    uint8             ChildVerify;     /**< \brief Child task verifies the file system state first */
+    uint8             Overwrite;       /**< \brief Copy or move may replace an existing target */
+    uint8             FilterAction;    /**< \brief Action of a filter files command */
+    uint8             RetentionIndex;  /**< \brief Retention table entry of an enforce retention command */
+
+    uint16 Source1;    /**< \brief First path block of the Source1 name plus one, zero when empty */
+    uint16 Source2;    /**< \brief First path block of the Source2 name plus one, zero when empty */
+    uint16 Target;     /**< \brief First path block of the Target name plus one, zero when empty */
+    uint16 SourceList; /**< \brief First path block of the SourceList names plus one, zero when empty */
+
+    uint32 DirListOffset; /**< \brief Starting entry for dir list commands */
+    uint32 FileInfoState; /**< \brief File info state */
+    uint32 FileInfoSize;  /**< \brief File info size */
+    uint32 FileInfoTime;  /**< \brief File info time */
+    uint32 FileInfoCRC;   /**< \brief File info CRC method, or get file digest digests */
+    uint32 Mode;          /**< \brief File Mode */
+
+    FM_FileFilter_t Filter; /**< \brief Age and size limits of a filter files command */
+} FM_ChildQueueSlot_t;
+
+/**
+ *  \brief Child task queue lane data structure
+ *
+ *  Each lane is a single producer ring.  Only the parent task advances
+ *  WriteIndex and only a child task (holding #FM_GlobalData_t.ChildDequeueSem)
+ *  advances ReadIndex, so the parent needs no lock to hand over a command.
+ *  Both indices run from 0 to (2 * #FM_CHILD_QUEUE_DEPTH - 1) so that a full
+ *  lane can be told apart from an empty one without a shared counter.
+ *
+ *  The parent does take #FM_GlobalData_t.ChildDequeueSem to read or mark
+ *  slots that are still queued: to search the bulk lane for the names of a
+ *  fast lane command (#FM_GetChildLane) and to flush the lanes
+ *  (#FM_FlushChildQueue).  It also takes it to read the names held by kernel
+ *  copies (#FM_BuildOpenPathSet).  Each holds it for at most one pass over
+ *  #FM_CHILD_QUEUE_DEPTH slots or #FM_CHILD_TASK_COUNT workers, and the child
+ *  tasks hold it only to take a slot and to claim or release names.  OSAL
+ *  mutexes inherit priority, so a child task holding it runs at the parent
+ *  priority until it gives it back.
+ */
+typedef struct
+{
+    uint32 WriteIndex; /**< \brief Ring index for next write to command args (parent only) */
+    uint32 ReadIndex;  /**< \brief Ring index for next read from command args (child only) */
+
+    OS_time_t EnqueueTime[FM_CHILD_QUEUE_DEPTH]; /**< \brief Time each queued command was handed over */
+
+    FM_ChildQueueSlot_t Queue[FM_CHILD_QUEUE_DEPTH]; /**< \brief Lane command queue */
+} FM_ChildLane_t;
+
+/**
+ *  \brief Child task throttle data structure
+ *
+ *  A pair of token buckets paces the child tasks on one volume.  Tokens are
+ *  kept in units of (rate * microseconds) so that slow rates refill without
+ *  rounding loss, a bucket that runs negative makes the next user sleep until
+ *  it has refilled.  Entry #FM_CHILD_THROTTLE_DEFAULT holds the default rates
+ *  and paces every file that does not match a volume entry.  All entries are
+ *  protected by #FM_GlobalData_t.ChildThrottleSem.
+ */
+typedef struct
+{
+    char Volume[OS_MAX_PATH_LEN]; /**< \brief Volume path prefix, empty for the default entry or a free entry */
+
+    uint32 ByteRate; /**< \brief Bytes per second, zero when unlimited, #FM_THROTTLE_RATE_DEFAULT follows default */
+    uint32 StatRate; /**< \brief OS_stat calls per second, zero when unlimited, #FM_THROTTLE_RATE_DEFAULT as ByteRate */
+
+    int64 ByteTokens; /**< \brief Byte bucket level (bytes * microseconds) */
+    int64 StatTokens; /**< \brief Stat bucket level (stats * microseconds) */
+
+    OS_time_t LastRefill; /**< \brief Time the buckets were last refilled */
+} FM_ChildThrottle_t;
+
+/**
+ *  \brief Child task checkpoint record
+ *
+ *  Saved to the checkpoint file of a child task while a copy, move or concat
+ *  command runs.  The concat sources before the one being copied are already
+ *  in the target file, which holds at least TargetBase + SourceOffset good
+ *  bytes.
+ */
+typedef struct
+{
+    uint32 Signature;    /**< \brief #FM_CHILD_CHECKPOINT_SIGNATURE in a valid record */
+    uint32 SourceIndex;  /**< \brief Source being copied (zero based concat source number) */
+    uint32 TargetBase;   /**< \brief Target offset of the first byte of the source being copied */
+    uint32 SourceOffset; /**< \brief Bytes of the source being copied known to be in the target file */
+    uint32 SourceSize;   /**< \brief Size of the source being copied when its copy started */
+    uint32 SourceTime;   /**< \brief Modify time of the source being copied when its copy started */
+
+    FM_ChildQueueEntry_t CmdArgs; /**< \brief Arguments of the command being checkpointed */
+} FM_ChildCheckpoint_t;
+
+/**
+ *  \brief Child task delete tree stack entry
+ *
+ *  A directory waiting to be deleted by the Delete Directory Tree command.
+ *  Its files are removed and its sub-directories pushed when it is first
+ *  reached, the directory itself is removed when it is reached again.
+ */
+typedef struct
+{
+    char Path[OS_MAX_PATH_LEN]; /**< \brief Directory name */
+    bool Scanned;               /**< \brief Set once the files have been removed and sub-directories pushed */
+} FM_ChildTreeFrame_t;
+
+/**
+ *  \brief Retention index entry
+ *
+ *  One file of a managed directory, as seen by the retention pass that
+ *  read the directory.
+ */
+typedef struct
+{
+    uint32 Size;     /**< \brief File size in bytes */
+    uint32 Time;     /**< \brief File modify time */
+    uint32 Priority; /**< \brief Index of the first priority pattern matched, zero for oldest first order */
+
+    char Name[OS_MAX_FILE_NAME]; /**< \brief File name without the directory */
+} FM_RetentionFile_t;
+
+/**
+ *  \brief Retention table entry state
+ *
+ *  The parent task copies the table entry into Policy and sets Busy before
+ *  it queues a pass, the child task running the pass clears Busy when the
+ *  pass ends.  While Busy is set only that child task touches the rest of
+ *  the structure, so a table load never changes a pass in progress.
+ *
+ *  The index is a binary heap.  While the directory is read the file to
+ *  be removed last is on top, so a file that should go earlier can take
+ *  its place in O(log n) once the index is full.  The heap is then turned
+ *  over so that the file to be removed first is on top, and each removal
+ *  costs O(log n).
+ */
+typedef struct
+{
+    uint32 Busy;      /**< \brief Set while a pass of the entry is queued or running */
+    bool   Commanded; /**< \brief Set when the pass was requested by #FM_ENFORCE_RETENTION_CC */
+    uint32 NextTime;  /**< \brief Clock seconds at which the next scheduled pass is due */
+
+    FM_RetentionTableEntry_t Policy; /**< \brief Table entry of the queued or running pass */
+
+    uint32 FileCount;  /**< \brief Files in the directory, kept current while the pass removes files */
+    uint64 ByteCount;  /**< \brief Bytes in the directory, kept current while the pass removes files */
+    uint32 IndexCount; /**< \brief Files in the index */
+
+    FM_RetentionFile_t Index[FM_RETENTION_INDEX_SIZE]; /**< \brief Files to be removed first, as a heap */
+} FM_RetentionState_t;
+
+/**
+ *  \brief Trash directory state
+ *
+ *  A child task claims a free entry, under #FM_GlobalData_t.ChildTrashSem,
+ *  the first time it puts a file in the trash directory of a volume.  The
+ *  entry is kept until restart.  Pending is set when a file is put in the
+ *  trash and cleared by the purge pass that empties the directory, it is
+ *  set when the entry is claimed so that files left by an earlier run are
+ *  purged as well.
+ */
+typedef struct
+{
+    char   Path[OS_MAX_PATH_LEN]; /**< \brief Trash directory path, empty for a free entry */
+    uint32 Pending;               /**< \brief Set while the trash directory may hold files */
+} FM_TrashVolume_t;
+
+/**
+ *  \brief File CRC cache entry
+ *
+ *  The CRC of a file as it was when the CRC was computed.  The size and
+ *  modify time are those reported by OS_stat when the command was
+ *  verified, a file written since then no longer matches.  All entries
+ *  are protected by #FM_GlobalData_t.ChildCrcCacheSem.
+ *
+ *  The head and check CRCs cover the first and the last block of the
+ *  file, or the whole file when it is no larger than a block.  A file
+ *  that has grown since is only read on from Size if both blocks still
+ *  give the same CRCs.
+ */
+typedef struct
+{
+    char   Path[OS_MAX_PATH_LEN]; /**< \brief File name, empty for a free entry */
+    uint32 Size;                  /**< \brief File size in bytes */
+    uint32 Time;                  /**< \brief File modify time */
+    uint32 CrcType;               /**< \brief CRC algorithm (CFE_ES_CrcType_xxx) */
+    uint32 Crc;                   /**< \brief CRC of the file */
+    uint32 LastUse;               /**< \brief #FM_GlobalData_t.CrcCacheClock when last looked up or stored */
+    uint32 CheckLength;           /**< \brief Bytes covered by the check CRC, zero when the CRC cannot be continued */
+    uint32 HeadCrc;               /**< \brief CRC-16 of the first CheckLength bytes */
+    uint32 CheckCrc;              /**< \brief CRC-16 of the CheckLength bytes before Size */
+} FM_CrcCacheEntry_t;
+
+/**
+ *  \brief CRC helper task data structure
+ *
+ *  One instance exists for each CRC helper task.  The child task holding
+ *  the helpers (#FM_GlobalData_t.CrcHelperBusy) fills in the range and
+ *  gives StartSem, the helper computes the CRC-16 of the range and gives
+ *  #FM_GlobalData_t.CrcHelperDoneSem.
+ */
+typedef struct
+{
+    osal_id_t StartSem; /**< \brief Given by the child task for each range to compute */
+
+    char   Path[OS_MAX_PATH_LEN]; /**< \brief File to read */
+    uint32 Offset;                /**< \brief Offset of the range in the file */
+    uint32 Length;                /**< \brief Bytes in the range */
+    uint32 Crc;                   /**< \brief CRC-16 of the range, as returned by #FM_CalculateCRC */
+    uint32 BytesRead;             /**< \brief Bytes of the range read, less than Length if the file shrank */
+    int32  Result;                /**< \brief OS_SUCCESS once the whole range has been read */
+    uint32 Pending;               /**< \brief Set while a range has been given to the helper and not finished */
+    bool   Running;               /**< \brief Set while the helper task is running */
+
+    uint8 Buffer[FM_CHILD_FILE_BLOCK_SIZE]; /**< \brief Helper task file I/O buffer */
+} FM_CrcHelper_t;
+
+/**
+ *  \brief Child task (worker) data structure
+ *
+ *  One instance exists for each child task in the worker pool.  Everything
+ *  a child task command handler modifies while executing a command lives
+ *  here so that several child tasks can run commands side by side.
+ */
+typedef struct
+{
+    uint8 CmdCounter;     /**< \brief Child task command success counter */
+    uint8 CmdErrCounter;  /**< \brief Child task command error counter */
+    uint8 CmdWarnCounter; /**< \brief Child task command warning counter */
+
+    uint8 CurrentCC;  /**< \brief Command code currently executing */
+    uint8 PreviousCC; /**< \brief Command code previously executed */
+
+    uint8 WorkerIndex; /**< \brief Index of this child task in the worker pool */
+    bool  Aborted;     /**< \brief Set once the command in progress has been aborted */
+    bool  Resuming;    /**< \brief Set while a command read from the checkpoint file has not reached its source */
+
+    uint32 CmdSequence;   /**< \brief Number of the command in progress (never zero once a command is taken) */
+    uint32 AbortSequence; /**< \brief Number of the command to abort (written by the parent task only) */
+    uint32 InFlightSeq;   /**< \brief Dispatch number of the command held, zero when idle (under ChildDequeueSem) */
+
+    FM_ChildPathSet_t InFlightPaths;   /**< \brief Names of the command held (under ChildDequeueSem) */
+    FM_ChildPathSet_t KernelCopyPaths; /**< \brief Files the kernel copy has open (under ChildDequeueSem) */
+    bool              KernelCopyOpen;  /**< \brief Set while a kernel copy has files open (under ChildDequeueSem) */
+
+    FM_ChildQueueEntry_t CmdArgs; /**< \brief Command arguments taken from the queue */
+
+    FM_DirListFileStats_t DirListFileStats; /**< \brief Get dir list to file statistics structure */
+
+    FM_DirListPkt_t DirListPkt; /**< \brief Get dir list to packet telemetry packet */
+
+    FM_FileInfoPkt_t FileInfoPkt; /**< \brief Get file info telemetry packet */
+
+    FM_FileDigestPkt_t  FileDigestPkt; /**< \brief Get file digest telemetry packet */
+    FM_Digest_Context_t Digest;        /**< \brief Get file digest calculation in progress */
+
+    FM_OpenPathSet_t OpenPaths; /**< \brief Open stream names seen by the command in progress */
+
+    uint64 CopyBytes; /**< \brief Bytes written by the most recent copy */
+
+    OS_time_t ProgressStart; /**< \brief Time the command in progress started */
+    uint64    ProgressBytes; /**< \brief Bytes read or copied by the command in progress */
+    uint64    ProgressTotal; /**< \brief Bytes the command in progress is known to have to read or copy */
+
+    char ProgressSource[OS_MAX_PATH_LEN]; /**< \brief Source file the command in progress is working on */
+    char ProgressTarget[OS_MAX_PATH_LEN]; /**< \brief Target file the command in progress is working on */
+
+    osal_id_t CopyEmptySem;  /**< \brief Counts copy buffers the child task may fill */
+    osal_id_t CopyFilledSem; /**< \brief Counts copy buffers waiting for the writer task */
+    osal_id_t CopyTarget;    /**< \brief Target file handle of the copy in progress */
+
+    int32 CopyLength[FM_CHILD_COPY_BUFFER_COUNT]; /**< \brief Bytes read into each copy buffer */
+    int32 CopyWriteResult;   /**< \brief Result of the first failed write of the copy in progress */
+    int32 CopyWriteExpected; /**< \brief Bytes the first failed write of the copy should have written */
+
+    osal_id_t   ConcatListFile;   /**< \brief Concat list source list file handle, undefined for an inline list */
+    const char *ConcatListText;   /**< \brief Concat list source names not yet parsed */
+    uint32      ConcatListLength; /**< \brief Length of the concat list source name text */
+    uint32      ConcatListOffset; /**< \brief Offset of the next concat list character to parse */
+
+    uint32 DeleteListLength; /**< \brief Bytes of the delete list in use */
+    uint32 DeleteListCount;  /**< \brief Names in the delete list */
+    uint32 DirKeptCount;     /**< \brief Entries read from the directory being read that are still in it */
+    uint32 DirSkipCount;     /**< \brief Entries already read to pass over after the directory read starts over */
+    uint32 TreeDepth;        /**< \brief Directories on the delete tree stack */
+
+    uint8 CopyFillSlot;    /**< \brief Copy buffer the child task fills next */
+    bool  WriterRunning;   /**< \brief Set while the copy writer task of this worker is running */
+    bool  CopyWriteFailed; /**< \brief Set once a write of the copy in progress has failed */
+    bool  CheckpointSaved; /**< \brief Set once the checkpoint file has been written for the command in progress */
+
+    uint32 CheckpointNext; /**< \brief Source offset of the next checkpoint save, zero when not saving */
+    uint32 CrcLastBytes;   /**< \brief Bytes at the end of the file left in Buffer by the CRC in progress */
+
+    FM_ChildCheckpoint_t Checkpoint; /**< \brief Checkpoint of the copy, move or concat in progress */
+
+    char Buffer[FM_CHILD_FILE_BLOCK_SIZE]; /**< \brief Child task file I/O buffer */
+
+    char DeleteList[FM_CHILD_DELETE_LIST_SIZE]; /**< \brief Delete All Files entry names, each string terminated */
+
+    FM_ChildTreeFrame_t TreeStack[FM_CHILD_TREE_STACK_SIZE]; /**< \brief Delete Directory Tree pending directories */
+
+    uint8 CopyBuffer[FM_CHILD_COPY_BUFFER_COUNT][FM_CHILD_COPY_BUFFER_SIZE]
+        FM_CHILD_COPY_BUFFER_ALIGNED; /**< \brief Child task copy buffers */
+} FM_ChildWorker_t;
+
 /**
  *  \brief Application global data structure
  */
@@ -57,48 +503,102 @@ typedef struct
     FM_MonitorTable_t *MonitorTablePtr;    /**< \brief File System Table Pointer */
     CFE_TBL_Handle_t   MonitorTableHandle; /**< \brief File System Table Handle */
 
+    FM_RetentionTable_t *RetentionTablePtr;    /**< \brief Retention Table Pointer */
+    CFE_TBL_Handle_t     RetentionTableHandle; /**< \brief Retention Table Handle */
+
     CFE_SB_PipeId_t CmdPipe; /**< \brief cFE software bus command pipe */
 
-    CFE_ES_TaskId_t ChildTaskID;        /**< \brief Child task ID */
-    osal_id_t       ChildSemaphore;     /**< \brief Child task wakeup counting semaphore */
-    osal_id_t       ChildQueueCountSem; /**< \brief Child queue counter mutex semaphore */
+    CFE_ES_TaskId_t ChildTaskID[FM_CHILD_TASK_COUNT];   /**< \brief Child task IDs */
+    CFE_ES_TaskId_t ChildWriterID[FM_CHILD_TASK_COUNT]; /**< \brief Child copy writer task IDs */
+    CFE_ES_TaskId_t CrcHelperID[FM_CHILD_CRC_HELPERS];  /**< \brief CRC helper task IDs */
+    osal_id_t       ChildSemaphore;                     /**< \brief Child task wakeup counting semaphore */
+    osal_id_t       ChildDequeueSem;                    /**< \brief Child queue and worker names mutex semaphore */
+    osal_id_t       ChildDecompressSem;                 /**< \brief Decompressor state mutex semaphore */
+    osal_id_t       ChildThrottleSem;                   /**< \brief Child task throttle mutex semaphore */
+    osal_id_t       ChildTrashSem;                      /**< \brief Trash directory list mutex semaphore */
+    osal_id_t       ChildCrcCacheSem;                   /**< \brief File CRC cache mutex semaphore */
+    osal_id_t       CrcHelperSem;                       /**< \brief CRC helper claim mutex semaphore */
+    osal_id_t       CrcHelperDoneSem;                   /**< \brief Counts ranges finished by the CRC helpers */
 
-    uint8 ChildCmdCounter;     /**< \brief Child task command success counter */
-    uint8 ChildCmdErrCounter;  /**< \brief Child task command error counter */
-    uint8 ChildCmdWarnCounter; /**< \brief Child task command warning counter */
+    uint8 ChildTaskStarted; /**< \brief Number of child tasks that have claimed a worker slot */
+    uint8 ChildTaskCount;   /**< \brief Number of child tasks currently running */
 
-    uint8 ChildWriteIndex; /**< \brief Array index for next write to command args */
-    uint8 ChildReadIndex;  /**< \brief Array index for next read from command args */
-    uint8 ChildQueueCount; /**< \brief Number of pending commands in queue */
+    uint8 ChildFastBurst;     /**< \brief Consecutive fast lane commands taken while bulk lane commands waited */
+    uint8 ChildWriterStarted; /**< \brief Number of copy writer tasks that have claimed a worker slot */
+    uint8 CrcHelperStarted;   /**< \brief Number of CRC helper tasks that have claimed a helper slot */
+    bool  CrcHelperBusy;      /**< \brief Set while a child task is using the CRC helpers */
 
     uint8 CommandCounter;    /**< \brief Application command success counter */
     uint8 CommandErrCounter; /**< \brief Application command error counter */
     uint8 Spare8a;           /**< \brief Placeholder for unused command warning counter */
+    bool  ChildProgressBusy; /**< \brief Set when the last child progress packet showed a busy child task */
+
+    uint32 ChildPathCursor; /**< \brief Path block where the parent starts its next free block search */
+
+    uint32 ChildEnqueueCount;  /**< \brief Commands handed to the child tasks */
+    uint32 ChildDequeueCount;  /**< \brief Commands taken from the queue by the child tasks */
+    uint32 ChildDispatchSeq;   /**< \brief Dispatch number given to the last command taken by a child task */
+    uint32 ChildQueueWaitLast; /**< \brief Microseconds the most recent command waited in the queue */
+    uint32 ChildQueueWaitMax;  /**< \brief Longest time in microseconds a command waited in the queue */
 
-    uint8 ChildCurrentCC;  /**< \brief Command code currently executing */
-    uint8 ChildPreviousCC; /**< \brief Command code previously executed */
-    uint8 Spare8b;         /**< \brief Structure alignment spare */
+    uint32 ChildCopyBlockSize; /**< \brief Bytes per read and write when copying a file */
+    uint8  ChildVerifyMode;    /**< \brief #FM_VERIFY_MODE_MAIN or #FM_VERIFY_MODE_CHILD */
+    uint8  ChildDeleteMode;    /**< \brief #FM_DELETE_MODE_DIRECT or #FM_DELETE_MODE_TRASH */
+
+    uint32 RetentionPassCount; /**< \brief Retention passes completed */
+    uint32 RetentionFileCount; /**< \brief Files removed by retention passes */
+
+    uint32 TrashSequence;       /**< \brief Number given to the next file put in a trash directory */
+    uint32 TrashFileCount;      /**< \brief Files renamed into a trash directory instead of removed */
+    uint32 TrashPurgeCount;     /**< \brief Files removed from the trash directories by purge passes */
+    uint32 TrashPurgeBusy;      /**< \brief Set while a purge pass is queued or running */
+    bool   TrashPurgeCommanded; /**< \brief Set when the purge pass was requested by #FM_PURGE_TRASH_CC */
+
+    uint32 CrcCacheClock;  /**< \brief Use stamp given to the next CRC cache entry looked up or stored */
+    uint32 CrcCacheHits;   /**< \brief File CRCs reported from the CRC cache */
+    uint32 CrcCacheMisses; /**< \brief File CRCs computed by reading the file */
+    uint32 CrcAppendCount; /**< \brief File CRCs continued from the CRC kept before the file grew */
+    uint32 CrcHelperStop;  /**< \brief Set to stop the CRC helpers when the rest of the file CRC has failed */
 
     uint32 FileStatTime; /**< \brief Modify time from most recent OS_stat */
     uint32 FileStatSize; /**< \brief File size from most recent OS_stat */
     uint32 FileStatMode; /**< \brief File mode from most recent OS_stat (OS_FILESTAT_MODE) */
 
-    FM_DirListFileStats_t DirListFileStats; /**< \brief Get dir list to file statistics structure */
-
-    FM_DirListPkt_t DirListPkt; /**< \brief Get dir list to packet telemetry packet */
-
     FM_MonitorReportPkt_t
         MonitorReportPkt; /**< \brief Telemetry packet reporting status of items in the monitor table */
 
-    FM_FileInfoPkt_t FileInfoPkt; /**< \brief Get file info telemetry packet */
-
     FM_OpenFilesPkt_t OpenFilesPkt; /**< \brief Get open files telemetry packet */
 
     FM_HousekeepingPkt_t HousekeepingPkt; /**< \brief Application housekeeping telemetry packet */
 
-    char ChildBuffer[FM_CHILD_FILE_BLOCK_SIZE]; /**< \brief Child task file I/O buffer */
+    FM_ChildProgressPkt_t ChildProgressPkt; /**< \brief Child task progress telemetry packet */
+
+    FM_LatencyPkt_Payload_t Latency;    /**< \brief Command latency histograms being recorded */
+    FM_LatencyPkt_t         LatencyPkt; /**< \brief Command latency telemetry packet */
+
+    FM_ChildQueueEntry_t ChildStagingEntry; /**< \brief Command args being built before they are queued */
+
+    FM_OpenPathSet_t OpenPaths; /**< \brief Open stream names seen by the command being verified */
+
+    FM_ChildLane_t ChildLane[FM_CHILD_LANE_COUNT]; /**< \brief Child task command queue lanes */
+
+    FM_ChildPathBlock_t ChildPathBlock[FM_CHILD_PATH_BLOCK_COUNT]; /**< \brief Queued command path block pool */
+
+    FM_ChildWorker_t ChildWorker[FM_CHILD_TASK_COUNT]; /**< \brief Child task worker pool */
+
+    FM_ChildThrottle_t ChildThrottle[FM_CHILD_THROTTLE_ENTRIES]; /**< \brief Child task default and volume throttles */
+
+    FM_RetentionState_t Retention[FM_RETENTION_ENTRY_COUNT]; /**< \brief Retention table entry pass state */
+
+    FM_TrashVolume_t Trash[FM_CHILD_TRASH_VOLUMES]; /**< \brief Trash directories claimed by the child tasks */
+
+    FM_Crc_State_t Crc; /**< \brief CRC method and kernel tables used by the child tasks */
 
-    FM_ChildQueueEntry_t ChildQueue[FM_CHILD_QUEUE_DEPTH]; /**< \brief Child task command queue */
+    FM_Digest_State_t Digest; /**< \brief File digest kernel tables used by the child tasks */
+
+    FM_CrcCacheEntry_t CrcCache[FM_CHILD_CRC_CACHE_ENTRIES]; /**< \brief File CRC results kept by the child tasks */
+
+    FM_CrcHelper_t CrcHelper[FM_CHILD_CRC_HELPERS]; /**< \brief CRC helper task ranges and buffers */
 
     /**
      * \brief State of the embedded decompression routine
@@ -166,11 +666,17 @@ CFE_Status_t FM_AppInit(void);
  *  \par Description
  *
  *       Allow CFE Table Services the opportunity to manage the File System
- *       Free Space Table.  This provides a mechanism to receive table updates.
+ *       Free Space Table and the Retention Table.  This provides a mechanism
+ *       to receive table updates.
+ *
+ *       Queue the retention passes that are due, see #FM_RetentionSchedule,
+ *       and a trash purge pass when one is due, see #FM_TrashSchedule.
  *
  *       Populate the FM application Housekeeping Telemetry packet.  Timestamp
  *       the packet and send it to ground via the Software Bus.
  *
+ *       Then send the child task progress packet, see #FM_SendChildProgress.
+ *
  *  \par Assumptions, External Events, and Notes: None
  *
  *  \param [in]  BufPtr Pointer to Software Bus command packet.
@@ -179,6 +685,63 @@ CFE_Status_t FM_AppInit(void);
  */
 void FM_SendHkCmd(const CFE_SB_Buffer_t *BufPtr);
 
+/**
+ *  \brief Send Child Task Progress Telemetry
+ *
+ *  \par Description
+ *
+ *       Populate the child task progress packet from the progress each child
+ *       task records for its command in progress.  Throughput and time
+ *       remaining are computed here so that the child task loops only have
+ *       to count bytes.
+ *
+ *       The packet is sent while any child task is busy, and once more
+ *       after they are all idle so that ground sees the commands end.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The counters are read without taking a semaphore, a packet may mix
+ *       values from before and after a block was processed.
+ *
+ *  \sa #FM_ChildProgressPkt_t
+ */
+void FM_SendChildProgress(void);
+
+/**
+ *  \brief Schedule Retention Passes
+ *
+ *  \par Description
+ *
+ *       Queue a retention pass for each enabled retention table entry whose
+ *       interval has passed since its previous pass was queued, unless that
+ *       pass is still queued or running.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called with each housekeeping request, so the pass interval is
+ *       rounded up to the housekeeping period.
+ *
+ *  \sa #FM_StartRetention, #FM_RetentionTable_t
+ */
+void FM_RetentionSchedule(void);
+
+/**
+ *  \brief Schedule Trash Purge Pass
+ *
+ *  \par Description
+ *
+ *       Queue a purge pass when a trash directory may hold files, no purge
+ *       pass is queued or running and no command is waiting for a child
+ *       task.  Purging only starts on an idle queue, so deferred deletes
+ *       never delay other commands for more than one purge batch.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called with each housekeeping request after the retention passes
+ *       have been queued, so a retention pass due at the same time goes
+ *       first.
+ *
+ *  \sa #FM_StartPurge, #FM_PURGE_TRASH_CC
+ */
+void FM_TrashSchedule(void);
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* FM application global data structure instance                   */
@@ -188,4 +751,79 @@ void FM_SendHkCmd(const CFE_SB_Buffer_t *BufPtr);
 /** \brief File Manager global */
 extern FM_GlobalData_t FM_GlobalData;
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM -- child task queue lane index access                        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**
+ *  \brief Queue lane ring index range
+ *
+ *  \par Description
+ *      Lane ring indices wrap at twice the lane depth, the queue slot for
+ *      an index is the index modulo #FM_CHILD_QUEUE_DEPTH.
+ */
+#define FM_CHILD_LANE_INDEX_WRAP (2 * FM_CHILD_QUEUE_DEPTH)
+
+/**
+ *  \name Parent/child handover atomic access
+ *
+ *  A lane index (or path block InUse flag) is published with release ordering
+ *  after the queue slot (or block) is written or read and loaded with acquire
+ *  ordering before it is read or reused, so the contents are handed over with
+ *  the index.  Counters shared by the child tasks are added to without a lock.
+ */
+/**\{*/
+#if defined(__GNUC__)
+#define FM_ATOMIC_LOAD(Ptr)       __atomic_load_n((Ptr), __ATOMIC_ACQUIRE)
+#define FM_ATOMIC_STORE(Ptr, Val) __atomic_store_n((Ptr), (Val), __ATOMIC_RELEASE)
+#define FM_ATOMIC_ADD(Ptr, Val)   __atomic_fetch_add((Ptr), (Val), __ATOMIC_RELAXED)
+#else
+/* Without compiler atomics this relies on the target not reordering stores */
+#define FM_ATOMIC_LOAD(Ptr)       (*(volatile const uint32 *)(Ptr))
+#define FM_ATOMIC_STORE(Ptr, Val) (*(volatile uint32 *)(Ptr) = (Val))
+/* and an occasional count may be lost when two child tasks add at once */
+#define FM_ATOMIC_ADD(Ptr, Val) (*(volatile uint32 *)(Ptr) += (Val))
+#endif
+/**\}*/
+
+/**
+ *  \brief Number of commands waiting in a queue lane
+ *
+ *  \param [in]  Lane Pointer to the queue lane
+ *
+ *  \return Number of commands waiting in the lane
+ */
+static inline uint32 FM_ChildLaneCount(const FM_ChildLane_t *Lane)
+{
+    uint32 WriteIndex = FM_ATOMIC_LOAD(&Lane->WriteIndex);
+    uint32 ReadIndex  = FM_ATOMIC_LOAD(&Lane->ReadIndex);
+
+    return (WriteIndex + FM_CHILD_LANE_INDEX_WRAP - ReadIndex) % FM_CHILD_LANE_INDEX_WRAP;
+}
+
+/**
+ *  \brief Advance a queue lane ring index
+ *
+ *  \param [in]  Index Current ring index
+ *
+ *  \return Next ring index
+ */
+static inline uint32 FM_ChildLaneNextIndex(uint32 Index)
+{
+    return (Index + 1) % FM_CHILD_LANE_INDEX_WRAP;
+}
+
+/**
+ *  \brief Number of commands waiting in all queue lanes
+ *
+ *  \return Number of commands waiting for a child task
+ */
+static inline uint32 FM_ChildQueueCount(void)
+{
+    return FM_ChildLaneCount(&FM_GlobalData.ChildLane[FM_CHILD_LANE_FAST]) +
+           FM_ChildLaneCount(&FM_GlobalData.ChildLane[FM_CHILD_LANE_BULK]);
+}
+
 #endif
@@ -31,6 +31,7 @@
 #include "fm_child.h"
 #include "fm_cmds.h"
 #include "fm_cmd_utils.h"
+#include "fm_kernel_copy.h"
 #include "fm_perfids.h"
 #include "fm_platform_cfg.h"
 #include "fm_verify.h"
@@ -46,7 +47,16 @@
 #define OS_DIRENTRY_NAME(x) ((x).d_name)
 #endif
 
-#define FM_QUEUE_SEM_NAME "FM_QUEUE_SEM"
+#define FM_QUEUE_SEM_NAME       "FM_QUEUE_SEM"
+#define FM_DECOMPRESS_SEM_NAME  "FM_DECOM_SEM"
+#define FM_THROTTLE_SEM_NAME    "FM_THRTL_SEM"
+#define FM_TRASH_SEM_NAME       "FM_TRASH_SEM"
+#define FM_CRC_CACHE_SEM_NAME   "FM_CRC_SEM"
+#define FM_COPY_EMPTY_SEM_NAME  "FM_CPY_EMPTY"
+#define FM_COPY_FILLED_SEM_NAME "FM_CPY_FILL"
+#define FM_CRC_START_SEM_NAME   "FM_CRC_START"
+#define FM_CRC_DONE_SEM_NAME    "FM_CRC_DONE"
+#define FM_CRC_HELPER_SEM_NAME  "FM_CRC_HELP"
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
@@ -56,10 +66,13 @@
 
 CFE_Status_t FM_ChildInit(void)
 {
-    int32        TaskTextLen               = OS_MAX_PATH_LEN;
-    char         TaskText[OS_MAX_PATH_LEN] = "\0";
-    CFE_Status_t Result                    = CFE_SUCCESS;
-    uint32       TaskEID                   = 0;
+    int32             TaskTextLen               = OS_MAX_PATH_LEN;
+    char              TaskText[OS_MAX_PATH_LEN] = "\0";
+    char              TaskName[OS_MAX_API_NAME] = "\0";
+    CFE_Status_t      Result                    = CFE_SUCCESS;
+    uint32            TaskEID                   = 0;
+    FM_ChildWorker_t *Worker                    = NULL;
+    uint32            i;
 
     /* Create counting semaphore (given by parent to wake-up child) */
     Result = OS_CountSemCreate(&FM_GlobalData.ChildSemaphore, FM_CHILD_SEM_NAME, 0, 0);
@@ -71,8 +84,8 @@ CFE_Status_t FM_ChildInit(void)
     }
     else
     {
-        /* Create mutex semaphore (protect access to ChildQueueCount) */
-        Result = OS_MutSemCreate(&FM_GlobalData.ChildQueueCountSem, FM_QUEUE_SEM_NAME, 0);
+        /* Create mutex semaphore (serialize child tasks taking commands from the queue) */
+        Result = OS_MutSemCreate(&FM_GlobalData.ChildDequeueSem, FM_QUEUE_SEM_NAME, 0);
 
         if (Result != CFE_SUCCESS)
         {
@@ -82,15 +95,150 @@ CFE_Status_t FM_ChildInit(void)
         }
         else
         {
-            /* Create child task (low priority command handler) */
-            Result = CFE_ES_CreateChildTask(&FM_GlobalData.ChildTaskID, FM_CHILD_TASK_NAME, FM_ChildTask, 0,
-                                            FM_CHILD_TASK_STACK_SIZE, FM_CHILD_TASK_PRIORITY, 0);
+            /* Create mutex semaphore (decompressor state is not reentrant) */
+            Result = OS_MutSemCreate(&FM_GlobalData.ChildDecompressSem, FM_DECOMPRESS_SEM_NAME, 0);
+
             if (Result != CFE_SUCCESS)
             {
-                TaskEID = FM_CHILD_INIT_CREATE_ERR_EID;
-                strncpy(TaskText, "create task failed", TaskTextLen - 1);
+                TaskEID = FM_CHILD_INIT_DSEM_ERR_EID;
+                strncpy(TaskText, "create decompress semaphore failed", TaskTextLen - 1);
                 TaskText[TaskTextLen - 1] = '\0';
             }
+            else
+            {
+                /* Create mutex semaphore (throttle buckets are shared by the child tasks and the parent) */
+                Result = OS_MutSemCreate(&FM_GlobalData.ChildThrottleSem, FM_THROTTLE_SEM_NAME, 0);
+
+                if (Result != CFE_SUCCESS)
+                {
+                    TaskEID = FM_CHILD_INIT_TSEM_ERR_EID;
+                    strncpy(TaskText, "create throttle semaphore failed", TaskTextLen - 1);
+                    TaskText[TaskTextLen - 1] = '\0';
+                }
+            }
+        }
+    }
+
+    if (Result == CFE_SUCCESS)
+    {
+        /* Create mutex semaphore (trash directories are claimed by whichever child task needs one first) */
+        Result = OS_MutSemCreate(&FM_GlobalData.ChildTrashSem, FM_TRASH_SEM_NAME, 0);
+
+        if (Result != CFE_SUCCESS)
+        {
+            TaskEID = FM_CHILD_INIT_TRASH_SEM_ERR_EID;
+            strncpy(TaskText, "create trash semaphore failed", TaskTextLen - 1);
+            TaskText[TaskTextLen - 1] = '\0';
+        }
+    }
+
+    if (Result == CFE_SUCCESS)
+    {
+        /* Create mutex semaphore (the CRC cache is shared by the child tasks) */
+        Result = OS_MutSemCreate(&FM_GlobalData.ChildCrcCacheSem, FM_CRC_CACHE_SEM_NAME, 0);
+
+        if (Result != CFE_SUCCESS)
+        {
+            TaskEID = FM_CHILD_INIT_CRC_SEM_ERR_EID;
+            strncpy(TaskText, "create CRC cache semaphore failed", TaskTextLen - 1);
+            TaskText[TaskTextLen - 1] = '\0';
+        }
+    }
+
+    /* Create copy buffer semaphores and copy writer task of each child task */
+    for (i = 0; (Result == CFE_SUCCESS) && (FM_CHILD_COPY_BUFFER_COUNT > 1) && (i < FM_CHILD_TASK_COUNT); i++)
+    {
+        Worker = &FM_GlobalData.ChildWorker[i];
+
+        /* Every copy buffer starts out empty */
+        snprintf(TaskName, sizeof(TaskName), "%s_%u", FM_COPY_EMPTY_SEM_NAME, (unsigned int)i);
+        Result = OS_CountSemCreate(&Worker->CopyEmptySem, TaskName, FM_CHILD_COPY_BUFFER_COUNT, 0);
+
+        if (Result == CFE_SUCCESS)
+        {
+            snprintf(TaskName, sizeof(TaskName), "%s_%u", FM_COPY_FILLED_SEM_NAME, (unsigned int)i);
+            Result = OS_CountSemCreate(&Worker->CopyFilledSem, TaskName, 0, 0);
+        }
+
+        if (Result == CFE_SUCCESS)
+        {
+            snprintf(TaskName, sizeof(TaskName), "%s_%u", FM_CHILD_WRITER_TASK_NAME, (unsigned int)i);
+            Result = CFE_ES_CreateChildTask(&FM_GlobalData.ChildWriterID[i], TaskName, FM_ChildWriterTask, 0,
+                                            FM_CHILD_WRITER_STACK_SIZE, FM_CHILD_TASK_PRIORITY, 0);
+        }
+
+        if (Result != CFE_SUCCESS)
+        {
+            TaskEID = FM_CHILD_INIT_WRITER_ERR_EID;
+            snprintf(TaskText, TaskTextLen, "create copy writer %u failed", (unsigned int)i);
+        }
+    }
+
+    /* Create the CRC helper tasks, which report finished ranges on one shared semaphore */
+    if ((Result == CFE_SUCCESS) && (FM_CHILD_CRC_SPLIT_SIZE > 0))
+    {
+        Result = OS_CountSemCreate(&FM_GlobalData.CrcHelperDoneSem, FM_CRC_DONE_SEM_NAME, 0, 0);
+
+        if (Result != CFE_SUCCESS)
+        {
+            TaskEID = FM_CHILD_INIT_CRC_HELPER_ERR_EID;
+            strncpy(TaskText, "create CRC helper semaphore failed", TaskTextLen - 1);
+            TaskText[TaskTextLen - 1] = '\0';
+        }
+    }
+
+    if ((Result == CFE_SUCCESS) && (FM_CHILD_CRC_SPLIT_SIZE > 0))
+    {
+        /* Create mutex semaphore (the CRC helpers are claimed by one child task at a time) */
+        Result = OS_MutSemCreate(&FM_GlobalData.CrcHelperSem, FM_CRC_HELPER_SEM_NAME, 0);
+
+        if (Result != CFE_SUCCESS)
+        {
+            TaskEID = FM_CHILD_INIT_CRC_HELPER_ERR_EID;
+            strncpy(TaskText, "create CRC helper mutex failed", TaskTextLen - 1);
+            TaskText[TaskTextLen - 1] = '\0';
+        }
+    }
+
+    for (i = 0; (Result == CFE_SUCCESS) && (FM_CHILD_CRC_SPLIT_SIZE > 0) && (i < FM_CHILD_CRC_HELPERS); i++)
+    {
+        snprintf(TaskName, sizeof(TaskName), "%s_%u", FM_CRC_START_SEM_NAME, (unsigned int)i);
+        Result = OS_CountSemCreate(&FM_GlobalData.CrcHelper[i].StartSem, TaskName, 0, 0);
+
+        if (Result == CFE_SUCCESS)
+        {
+            snprintf(TaskName, sizeof(TaskName), "%s_%u", FM_CHILD_CRC_HELPER_TASK_NAME, (unsigned int)i);
+            Result = CFE_ES_CreateChildTask(&FM_GlobalData.CrcHelperID[i], TaskName, FM_ChildCrcHelperTask, 0,
+                                            FM_CHILD_CRC_HELPER_STACK_SIZE, FM_CHILD_TASK_PRIORITY, 0);
+        }
+
+        if (Result != CFE_SUCCESS)
+        {
+            TaskEID = FM_CHILD_INIT_CRC_HELPER_ERR_EID;
+            snprintf(TaskText, TaskTextLen, "create CRC helper %u failed", (unsigned int)i);
+        }
+    }
+
+    /* Create child tasks (low priority command handlers) */
+    for (i = 0; (Result == CFE_SUCCESS) && (i < FM_CHILD_TASK_COUNT); i++)
+    {
+        /* First child task keeps the configured name, others get an index suffix */
+        if (i == 0)
+        {
+            strncpy(TaskName, FM_CHILD_TASK_NAME, sizeof(TaskName) - 1);
+            TaskName[sizeof(TaskName) - 1] = '\0';
+        }
+        else
+        {
+            snprintf(TaskName, sizeof(TaskName), "%s_%u", FM_CHILD_TASK_NAME, (unsigned int)i);
+        }
+
+        Result = CFE_ES_CreateChildTask(&FM_GlobalData.ChildTaskID[i], TaskName, FM_ChildTask, 0,
+                                        FM_CHILD_TASK_STACK_SIZE, FM_CHILD_TASK_PRIORITY, 0);
+        if (Result != CFE_SUCCESS)
+        {
+            TaskEID = FM_CHILD_INIT_CREATE_ERR_EID;
+            snprintf(TaskText, TaskTextLen, "create task %u failed", (unsigned int)i);
         }
     }
 
@@ -111,31 +259,214 @@ CFE_Status_t FM_ChildInit(void)
 
 void FM_ChildTask(void)
 {
-    const char *TaskText = "Child Task";
+    const char *      TaskText    = "Child Task";
+    FM_ChildWorker_t *Worker      = NULL;
+    uint8             WorkerIndex = 0;
+    bool              LastWorker  = false;
+
+    /* Claim the next unused worker slot (every child task runs this entry point) */
+    OS_MutSemTake(FM_GlobalData.ChildDequeueSem);
+    WorkerIndex = FM_GlobalData.ChildTaskStarted++;
+    FM_GlobalData.ChildTaskCount++;
+    OS_MutSemGive(FM_GlobalData.ChildDequeueSem);
+
+    if (WorkerIndex < FM_CHILD_TASK_COUNT)
+    {
+        Worker              = &FM_GlobalData.ChildWorker[WorkerIndex];
+        Worker->WorkerIndex = WorkerIndex;
 
-    /*
-    ** The child task runs until the parent dies (normal end) or
-    **  until it encounters a fatal error (semaphore error, etc.)...
-    */
-    CFE_EVS_SendEvent(FM_CHILD_INIT_EID, CFE_EVS_EventType_INFORMATION, "%s initialization complete", TaskText);
+        /*
+        ** The child task runs until the parent dies (normal end) or
+        **  until it encounters a fatal error (semaphore error, etc.)...
+        */
+        CFE_EVS_SendEvent(FM_CHILD_INIT_EID, CFE_EVS_EventType_INFORMATION, "%s %d initialization complete", TaskText,
+                          (int)WorkerIndex);
+
+        /* Finish the command cut off by the last restart before taking new ones */
+        FM_ChildCheckpointResume(Worker);
+
+        /* Child task process loop */
+        FM_ChildLoop(Worker);
+    }
+
+    OS_MutSemTake(FM_GlobalData.ChildDequeueSem);
+    FM_GlobalData.ChildTaskCount--;
+    LastWorker = (FM_GlobalData.ChildTaskCount == 0);
+    OS_MutSemGive(FM_GlobalData.ChildDequeueSem);
+
+    /* Clear the semaphore ID once no child task remains to service the queue */
+    if (LastWorker)
+    {
+        FM_GlobalData.ChildSemaphore = OS_OBJECT_ID_UNDEFINED;
+    }
+
+    /* This call allows cFE to clean-up system resources */
+    CFE_ES_ExitChildTask();
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child copy writer task -- task entry point                   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_ChildWriterTask(void)
+{
+    FM_ChildWorker_t *Worker      = NULL;
+    uint8             WorkerIndex = 0;
+    uint32            i;
+
+    /* Claim the next child task without a copy writer */
+    OS_MutSemTake(FM_GlobalData.ChildDequeueSem);
+    WorkerIndex = FM_GlobalData.ChildWriterStarted++;
+    OS_MutSemGive(FM_GlobalData.ChildDequeueSem);
+
+    if (WorkerIndex < FM_CHILD_TASK_COUNT)
+    {
+        Worker = &FM_GlobalData.ChildWorker[WorkerIndex];
+
+        Worker->WriterRunning = true;
+
+        /* Copy writer process loop */
+        FM_ChildWriterLoop(Worker);
+
+        /* Later copies read and write in turn, fail a copy still waiting on this task */
+        Worker->WriterRunning   = false;
+        Worker->CopyWriteResult = OS_ERROR;
+        Worker->CopyWriteFailed = true;
+
+        for (i = 0; i < FM_CHILD_COPY_BUFFER_COUNT; i++)
+        {
+            OS_CountSemGive(Worker->CopyEmptySem);
+        }
+    }
+
+    /* This call allows cFE to clean-up system resources */
+    CFE_ES_ExitChildTask();
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child copy writer task -- main process loop                  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_ChildWriterLoop(FM_ChildWorker_t *Worker)
+{
+    int32 Result = OS_SUCCESS;
+    uint8 Slot   = 0;
+
+    while (Result == OS_SUCCESS)
+    {
+        /* Pend until the child task has filled a copy buffer */
+        Result = OS_CountSemTake(Worker->CopyFilledSem);
+
+        if (Result == OS_SUCCESS)
+        {
+            CFE_ES_PerfLogEntry(FM_CHILD_WRITER_PERF_ID);
+
+            FM_ChildCopyWrite(Worker, Slot);
+
+            CFE_ES_PerfLogExit(FM_CHILD_WRITER_PERF_ID);
+
+            /* Buffers are drained in the order the child task fills them */
+            Slot = (Slot + 1) % FM_CHILD_COPY_BUFFER_COUNT;
+
+            OS_CountSemGive(Worker->CopyEmptySem);
+        }
+        else
+        {
+            CFE_EVS_SendEvent(FM_CHILD_WRITER_TERM_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Child Writer Task %d termination error: semaphore take failed: result = %d",
+                              (int)Worker->WorkerIndex, (int)Result);
+        }
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child CRC helper task -- task entry point                    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_ChildCrcHelperTask(void)
+{
+    FM_CrcHelper_t *Helper      = NULL;
+    uint8           HelperIndex = 0;
+
+    /* Claim the next unused helper slot */
+    OS_MutSemTake(FM_GlobalData.ChildDequeueSem);
+    HelperIndex = FM_GlobalData.CrcHelperStarted++;
+    OS_MutSemGive(FM_GlobalData.ChildDequeueSem);
+
+    if (HelperIndex < FM_CHILD_CRC_HELPERS)
+    {
+        Helper = &FM_GlobalData.CrcHelper[HelperIndex];
 
-    /* Child task process loop */
-    FM_ChildLoop();
+        Helper->Running = true;
 
-    /* Clear the semaphore ID */
-    FM_GlobalData.ChildSemaphore = OS_OBJECT_ID_UNDEFINED;
+        /* CRC helper process loop */
+        FM_ChildCrcHelperLoop(Helper, HelperIndex);
+
+        /* Later CRCs leave this helper out, fail a range still waiting on this task */
+        Helper->Running = false;
+
+        if (FM_ATOMIC_LOAD(&Helper->Pending) != 0)
+        {
+            Helper->Result = OS_ERROR;
+
+            FM_ATOMIC_STORE(&Helper->Pending, 0);
+            OS_CountSemGive(FM_GlobalData.CrcHelperDoneSem);
+        }
+    }
 
     /* This call allows cFE to clean-up system resources */
     CFE_ES_ExitChildTask();
 }
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child CRC helper task -- main process loop                   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_ChildCrcHelperLoop(FM_CrcHelper_t *Helper, uint8 HelperIndex)
+{
+    int32 Result = OS_SUCCESS;
+
+    while (Result == OS_SUCCESS)
+    {
+        /* Pend until a child task hands over a range */
+        Result = OS_CountSemTake(Helper->StartSem);
+
+        if (Result == OS_SUCCESS)
+        {
+            CFE_ES_PerfLogEntry(FM_CHILD_CRC_HELPER_PERF_ID);
+
+            Helper->Result = FM_ChildCrcRange(NULL, Helper->Path, Helper->Offset, Helper->Length, Helper->Buffer,
+                                              &Helper->Crc, &Helper->BytesRead);
+
+            CFE_ES_PerfLogExit(FM_CHILD_CRC_HELPER_PERF_ID);
+
+            FM_ATOMIC_STORE(&Helper->Pending, 0);
+            OS_CountSemGive(FM_GlobalData.CrcHelperDoneSem);
+        }
+        else
+        {
+            CFE_EVS_SendEvent(FM_CHILD_CRC_HELPER_TERM_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "CRC Helper Task %d termination error: semaphore take failed: result = %d",
+                              (int)HelperIndex, (int)Result);
+        }
+    }
+}
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* FM child task -- main process loop                              */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-void FM_ChildLoop(void)
+void FM_ChildLoop(FM_ChildWorker_t *Worker)
 {
     const char * TaskText = "Child Task termination error: ";
     CFE_Status_t Result   = CFE_SUCCESS;
@@ -151,19 +482,22 @@ void FM_ChildLoop(void)
         if (Result == CFE_SUCCESS)
         {
             /* Make sure the parent/child handshake is not broken */
-            if (FM_GlobalData.ChildQueueCount == 0)
+            if (FM_ChildQueueCount() == 0)
             {
-                FM_GlobalData.ChildCmdErrCounter++;
+                Worker->CmdErrCounter++;
                 CFE_EVS_SendEvent(FM_CHILD_TERM_EMPTYQ_ERR_EID, CFE_EVS_EventType_ERROR, "%s empty queue", TaskText);
 
                 /* Set result that will terminate child task run loop */
                 Result = OS_ERROR;
             }
-            else if (FM_GlobalData.ChildReadIndex >= FM_CHILD_QUEUE_DEPTH)
+            else if ((FM_GlobalData.ChildLane[FM_CHILD_LANE_FAST].ReadIndex >= FM_CHILD_LANE_INDEX_WRAP) ||
+                     (FM_GlobalData.ChildLane[FM_CHILD_LANE_BULK].ReadIndex >= FM_CHILD_LANE_INDEX_WRAP))
             {
-                FM_GlobalData.ChildCmdErrCounter++;
+                Worker->CmdErrCounter++;
                 CFE_EVS_SendEvent(FM_CHILD_TERM_QIDX_ERR_EID, CFE_EVS_EventType_ERROR,
-                                  "%s invalid queue index: index = %d", TaskText, (int)FM_GlobalData.ChildReadIndex);
+                                  "%s invalid queue index: index = %d/%d", TaskText,
+                                  (int)FM_GlobalData.ChildLane[FM_CHILD_LANE_FAST].ReadIndex,
+                                  (int)FM_GlobalData.ChildLane[FM_CHILD_LANE_BULK].ReadIndex);
 
                 /* Set result that will terminate child task run loop */
                 Result = OS_ERROR;
@@ -171,7 +505,7 @@ void FM_ChildLoop(void)
             else
             {
                 /* Invoke the child task command handler */
-                FM_ChildProcess();
+                FM_ChildProcess(Worker);
             }
         }
         else
@@ -186,168 +520,667 @@ void FM_ChildLoop(void)
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* FM child task -- interface handshake processor                  */
+/* FM child task -- select queue lane for next command             */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-void FM_ChildProcess(void)
+uint8 FM_ChildSelectLane(void)
 {
-    const char *          TaskText = "Child Task";
-    FM_ChildQueueEntry_t *CmdArgs  = &FM_GlobalData.ChildQueue[FM_GlobalData.ChildReadIndex];
+    FM_ChildLane_t *  BulkLane = &FM_GlobalData.ChildLane[FM_CHILD_LANE_BULK];
+    FM_ChildPathSet_t Paths;
+    uint8             Lane     = FM_CHILD_LANE_BULK;
 
-    /* Invoke the command-specific handler */
-    switch (CmdArgs->CommandCode)
+    if (FM_ChildLaneCount(&FM_GlobalData.ChildLane[FM_CHILD_LANE_FAST]) != 0)
     {
-        case FM_COPY_FILE_CC:
-            FM_ChildCopyCmd(CmdArgs);
-            break;
-
-        case FM_MOVE_FILE_CC:
-            FM_ChildMoveCmd(CmdArgs);
-            break;
-
-        case FM_RENAME_FILE_CC:
-            FM_ChildRenameCmd(CmdArgs);
-            break;
-
-        case FM_DELETE_FILE_CC:
-            FM_ChildDeleteCmd(CmdArgs);
-            break;
-
-        case FM_DELETE_ALL_FILES_CC:
-            FM_ChildDeleteAllFilesCmd(CmdArgs);
-            break;
-
-        case FM_DECOMPRESS_FILE_CC:
-            FM_ChildDecompressFileCmd(CmdArgs);
-            break;
+        if (FM_ChildLaneCount(BulkLane) == 0)
+        {
+            /* Nothing waiting in the bulk lane */
+            FM_GlobalData.ChildFastBurst = 0;
+            Lane                         = FM_CHILD_LANE_FAST;
+        }
+        else if (FM_GlobalData.ChildFastBurst < FM_CHILD_FAST_LANE_BURST)
+        {
+            /* Fast lane goes first while the bulk lane waits */
+            FM_GlobalData.ChildFastBurst++;
+            Lane = FM_CHILD_LANE_FAST;
+        }
+        else
+        {
+            /* A fast command sent earlier on the same names still goes first */
+            FM_GetSlotPaths(&BulkLane->Queue[BulkLane->ReadIndex % FM_CHILD_QUEUE_DEPTH], &Paths);
 
-        case FM_CONCAT_FILES_CC:
-            FM_ChildConcatFilesCmd(CmdArgs);
-            break;
+            if (FM_ChildLaneOverlaps(&FM_GlobalData.ChildLane[FM_CHILD_LANE_FAST], &Paths))
+            {
+                Lane = FM_CHILD_LANE_FAST;
+            }
+            else
+            {
+                /* Burst limit reached - let one bulk command through */
+                FM_GlobalData.ChildFastBurst = 0;
+            }
+        }
+    }
+    else
+    {
+        FM_GlobalData.ChildFastBurst = 0;
+    }
 
-        case FM_CREATE_DIRECTORY_CC:
-            FM_ChildCreateDirectoryCmd(CmdArgs);
-            break;
+    return Lane;
+}
 
-        case FM_DELETE_DIRECTORY_CC:
-            FM_ChildDeleteDirectoryCmd(CmdArgs);
-            break;
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task -- load and release queued command path name      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-        case FM_GET_FILE_INFO_CC:
-            FM_ChildFileInfoCmd(CmdArgs);
-            break;
+void FM_ChildLoadPath(uint16 PathRef, char *Path, uint32 BufferSize)
+{
+    FM_ChildPathBlock_t *Block;
+    uint32               Offset = 0;
+    uint32               ChunkSize;
 
-        case FM_GET_DIR_LIST_FILE_CC:
-            FM_ChildDirListFileCmd(CmdArgs);
-            break;
+    while ((PathRef != 0) && (PathRef <= FM_CHILD_PATH_BLOCK_COUNT))
+    {
+        Block = &FM_GlobalData.ChildPathBlock[PathRef - 1];
 
-        case FM_GET_DIR_LIST_PKT_CC:
-            FM_ChildDirListPktCmd(CmdArgs);
-            break;
+        ChunkSize = BufferSize - Offset;
+        if (ChunkSize > FM_CHILD_PATH_BLOCK_SIZE)
+        {
+            ChunkSize = FM_CHILD_PATH_BLOCK_SIZE;
+        }
 
-        case FM_SET_PERMISSIONS_CC:
-            FM_ChildSetPermissionsCmd(CmdArgs);
-            break;
+        memcpy(&Path[Offset], Block->Data, ChunkSize);
+        Offset += ChunkSize;
+        PathRef = Block->Next;
 
-        default:
-            FM_GlobalData.ChildCmdErrCounter++;
-            CFE_EVS_SendEvent(FM_CHILD_EXE_ERR_EID, CFE_EVS_EventType_ERROR,
-                              "%s execution error: invalid command code: cc = %d", TaskText, (int)CmdArgs->CommandCode);
-            break;
+        /* Hand the block back to the parent once it has been copied */
+        FM_ATOMIC_STORE(&Block->InUse, 0);
     }
 
-    /* Update the handshake queue read index */
-    FM_GlobalData.ChildReadIndex++;
-
-    if (FM_GlobalData.ChildReadIndex >= FM_CHILD_QUEUE_DEPTH)
+    if (BufferSize > 0)
     {
-        FM_GlobalData.ChildReadIndex = 0;
+        Path[BufferSize - 1] = '\0';
     }
-
-    /* Prevent parent/child updating queue counter at same time */
-    OS_MutSemTake(FM_GlobalData.ChildQueueCountSem);
-    FM_GlobalData.ChildQueueCount--;
-    OS_MutSemGive(FM_GlobalData.ChildQueueCountSem);
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* FM child task command handler -- Copy File                      */
+/* FM child task -- record the names of the command taken          */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-void FM_ChildCopyCmd(const FM_ChildQueueEntry_t *CmdArgs)
+void FM_ChildClaimPaths(FM_ChildWorker_t *Worker)
 {
-    const char *CmdText   = "Copy File";
-    int32       OS_Status = OS_SUCCESS;
+    /* Dispatch numbers skip zero, which marks an idle worker */
+    FM_GlobalData.ChildDispatchSeq++;
+    if (FM_GlobalData.ChildDispatchSeq == 0)
+    {
+        FM_GlobalData.ChildDispatchSeq = 1;
+    }
 
-    /* Report current child task activity */
-    FM_GlobalData.ChildCurrentCC = CmdArgs->CommandCode;
+    FM_GetEntryPaths(&Worker->CmdArgs, &Worker->InFlightPaths);
+    Worker->InFlightSeq = FM_GlobalData.ChildDispatchSeq;
+}
 
-    /* Note the order of the arguments to OS_cp (src,tgt) */
-    OS_Status = OS_cp(CmdArgs->Source1, CmdArgs->Target);
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task -- test for an earlier command on the same names  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-    if (OS_Status != OS_SUCCESS)
-    {
-        FM_GlobalData.ChildCmdErrCounter++;
+bool FM_ChildPathsBusy(const FM_ChildWorker_t *Worker)
+{
+    const FM_ChildWorker_t *Other;
+    bool                    Busy = false;
+    uint32                  i;
 
-        /* Send command failure event (error) */
-        CFE_EVS_SendEvent(FM_COPY_OS_ERR_EID, CFE_EVS_EventType_ERROR,
-                          "%s error: OS_cp failed: result = %d, src = %s, tgt = %s", CmdText, (int)OS_Status,
-                          CmdArgs->Source1, CmdArgs->Target);
-    }
-    else
+    for (i = 0; (i < FM_CHILD_TASK_COUNT) && (Busy == false); i++)
     {
-        FM_GlobalData.ChildCmdCounter++;
+        Other = &FM_GlobalData.ChildWorker[i];
 
-        /* Send command completion event (info) */
-        CFE_EVS_SendEvent(FM_COPY_CMD_INF_EID, CFE_EVS_EventType_INFORMATION, "%s command: src = %s, tgt = %s", CmdText,
-                          CmdArgs->Source1, CmdArgs->Target);
+        /* Only commands taken earlier count, so two commands never wait for each other */
+        if ((Other != Worker) && (Other->InFlightSeq != 0) &&
+            ((int32)(Other->InFlightSeq - Worker->InFlightSeq) < 0))
+        {
+            Busy = FM_PathSetsOverlap(&Other->InFlightPaths, &Worker->InFlightPaths);
+        }
     }
 
-    /* Report previous child task activity */
-    FM_GlobalData.ChildPreviousCC = CmdArgs->CommandCode;
-    FM_GlobalData.ChildCurrentCC  = 0;
+    return Busy;
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* FM child task command handler -- Move File                      */
+/* FM child task -- wait until the names of the command are free   */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-void FM_ChildMoveCmd(const FM_ChildQueueEntry_t *CmdArgs)
+void FM_ChildWaitForPaths(FM_ChildWorker_t *Worker)
+{
+    bool Busy = true;
+
+    while (Busy == true)
+    {
+        OS_MutSemTake(FM_GlobalData.ChildDequeueSem);
+        Busy = FM_ChildPathsBusy(Worker);
+        OS_MutSemGive(FM_GlobalData.ChildDequeueSem);
+
+        if (Busy == true)
+        {
+            /* Give up the CPU while the other child task finishes with the names */
+            CFE_ES_PerfLogExit(FM_CHILD_TASK_PERF_ID);
+            OS_TaskDelay(FM_CHILD_PATH_WAIT_MS);
+            CFE_ES_PerfLogEntry(FM_CHILD_TASK_PERF_ID);
+        }
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task -- drop the names of the finished command         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_ChildReleasePaths(FM_ChildWorker_t *Worker)
+{
+    OS_MutSemTake(FM_GlobalData.ChildDequeueSem);
+    Worker->InFlightSeq = 0;
+    OS_MutSemGive(FM_GlobalData.ChildDequeueSem);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task -- interface handshake processor                  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_ChildProcess(FM_ChildWorker_t *Worker)
+{
+    FM_ChildQueueEntry_t *CmdArgs = &Worker->CmdArgs;
+    FM_ChildLane_t *      Lane;
+    FM_ChildQueueSlot_t * Slot;
+    uint32                ReadIndex;
+    uint32                WaitTime;
+    bool                  Flushed;
+    OS_time_t             DequeueTime;
+
+    /*
+    ** The dequeue mutex serializes the child tasks against each other and
+    **  against the parent reading or flushing queued slots.  The entry is
+    **  copied out before the new read index is published so that the queue
+    **  slot can be reused by the parent while this command executes.
+    */
+    OS_MutSemTake(FM_GlobalData.ChildDequeueSem);
+
+    Lane      = &FM_GlobalData.ChildLane[FM_ChildSelectLane()];
+    ReadIndex = Lane->ReadIndex;
+    Slot      = &Lane->Queue[ReadIndex % FM_CHILD_QUEUE_DEPTH];
+
+    memset(CmdArgs, 0, sizeof(*CmdArgs));
+
+    /* The parent task marks flushed slots while holding the dequeue mutex */
+    Flushed = (Slot->Flushed != 0);
+
+    CmdArgs->CommandCode     = Slot->CommandCode;
+    CmdArgs->GetSizeTimeMode = Slot->GetSizeTimeMode;
+    CmdArgs->ChildVerify     = Slot->ChildVerify;
+    CmdArgs->Overwrite       = Slot->Overwrite;
+    CmdArgs->FilterAction    = Slot->FilterAction;
+    CmdArgs->RetentionIndex  = Slot->RetentionIndex;
+    CmdArgs->DirListOffset   = Slot->DirListOffset;
+    CmdArgs->FileInfoState   = Slot->FileInfoState;
+    CmdArgs->FileInfoSize    = Slot->FileInfoSize;
+    CmdArgs->FileInfoTime    = Slot->FileInfoTime;
+    CmdArgs->FileInfoCRC     = Slot->FileInfoCRC;
+    CmdArgs->Mode            = Slot->Mode;
+    CmdArgs->Filter          = Slot->Filter;
+
+    FM_ChildLoadPath(Slot->Source1, CmdArgs->Source1, sizeof(CmdArgs->Source1));
+    FM_ChildLoadPath(Slot->Source2, CmdArgs->Source2, sizeof(CmdArgs->Source2));
+    FM_ChildLoadPath(Slot->Target, CmdArgs->Target, sizeof(CmdArgs->Target));
+    FM_ChildLoadPath(Slot->SourceList, CmdArgs->SourceList, sizeof(CmdArgs->SourceList));
+
+    /* Time spent waiting in the queue */
+    OS_GetLocalTime(&DequeueTime);
+    WaitTime = (uint32)OS_TimeGetTotalMicroseconds(
+        OS_TimeSubtract(DequeueTime, Lane->EnqueueTime[ReadIndex % FM_CHILD_QUEUE_DEPTH]));
+
+    FM_RecordLatency(FM_GlobalData.Latency.QueueWait, CmdArgs->CommandCode,
+                     Lane->EnqueueTime[ReadIndex % FM_CHILD_QUEUE_DEPTH], DequeueTime);
+
+    /* Update the handshake queue read index */
+    FM_ATOMIC_STORE(&Lane->ReadIndex, FM_ChildLaneNextIndex(ReadIndex));
+
+    FM_GlobalData.ChildDequeueCount++;
+    FM_GlobalData.ChildQueueWaitLast = WaitTime;
+
+    if (WaitTime > FM_GlobalData.ChildQueueWaitMax)
+    {
+        FM_GlobalData.ChildQueueWaitMax = WaitTime;
+    }
+
+    if (Flushed == false)
+    {
+        FM_ChildClaimPaths(Worker);
+    }
+
+    OS_MutSemGive(FM_GlobalData.ChildDequeueSem);
+
+    /* Commands dropped by a flush queue command are skipped, their names were already freed */
+    if (Flushed == false)
+    {
+        /* A command taken earlier by another child task on the same names finishes first */
+        FM_ChildWaitForPaths(Worker);
+        FM_ChildExecute(Worker);
+        FM_ChildReleasePaths(Worker);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task -- execute command held by the worker             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_ChildExecute(FM_ChildWorker_t *Worker)
+{
+    const char *          TaskText = "Child Task";
+    FM_ChildQueueEntry_t *CmdArgs  = &Worker->CmdArgs;
+    uint32                Sequence;
+    OS_time_t             EndTime;
+
+    /* Number the command so that an abort request cannot reach the next one */
+    Sequence = Worker->CmdSequence + 1;
+    if (Sequence == 0)
+    {
+        Sequence = 1;
+    }
+
+    Worker->Aborted = false;
+    FM_ATOMIC_STORE(&Worker->CmdSequence, Sequence);
+
+    /* Each command takes its own snapshot of the open files */
+    Worker->OpenPaths.Valid = false;
+
+    FM_ChildProgressBegin(Worker);
+
+    /* Checks left by the parent task in FM_VERIFY_MODE_CHILD come first */
+    if ((CmdArgs->ChildVerify != 0) && (FM_ChildVerifyCmd(Worker, CmdArgs) == false))
+    {
+        Worker->CmdErrCounter++;
+    }
+    else
+    {
+        /* Invoke the command-specific handler */
+        switch (CmdArgs->CommandCode)
+        {
+            case FM_COPY_FILE_CC:
+                FM_ChildCopyCmd(Worker, CmdArgs);
+                break;
+
+            case FM_MOVE_FILE_CC:
+                FM_ChildMoveCmd(Worker, CmdArgs);
+                break;
+
+            case FM_RENAME_FILE_CC:
+                FM_ChildRenameCmd(Worker, CmdArgs);
+                break;
+
+            case FM_DELETE_FILE_CC:
+                FM_ChildDeleteCmd(Worker, CmdArgs);
+                break;
+
+            case FM_DELETE_ALL_FILES_CC:
+                FM_ChildDeleteAllFilesCmd(Worker, CmdArgs);
+                break;
+
+            case FM_DECOMPRESS_FILE_CC:
+                FM_ChildDecompressFileCmd(Worker, CmdArgs);
+                break;
+
+            case FM_CONCAT_FILES_CC:
+                FM_ChildConcatFilesCmd(Worker, CmdArgs);
+                break;
+
+            case FM_CONCAT_LIST_CC:
+                FM_ChildConcatListCmd(Worker, CmdArgs);
+                break;
+
+            case FM_CREATE_DIRECTORY_CC:
+                FM_ChildCreateDirectoryCmd(Worker, CmdArgs);
+                break;
+
+            case FM_DELETE_DIRECTORY_CC:
+                FM_ChildDeleteDirectoryCmd(Worker, CmdArgs);
+                break;
+
+            case FM_DELETE_TREE_CC:
+                FM_ChildDeleteTreeCmd(Worker, CmdArgs);
+                break;
+
+            case FM_FILTER_FILES_CC:
+                FM_ChildFilterFilesCmd(Worker, CmdArgs);
+                break;
+
+            case FM_ENFORCE_RETENTION_CC:
+                FM_ChildRetentionCmd(Worker, CmdArgs);
+                break;
+
+            case FM_PURGE_TRASH_CC:
+                FM_ChildPurgeCmd(Worker, CmdArgs);
+                break;
+
+            case FM_GET_FILE_INFO_CC:
+                FM_ChildFileInfoCmd(Worker, CmdArgs);
+                break;
+
+            case FM_GET_FILE_DIGEST_CC:
+                FM_ChildFileDigestCmd(Worker, CmdArgs);
+                break;
+
+            case FM_GET_DIR_LIST_FILE_CC:
+                FM_ChildDirListFileCmd(Worker, CmdArgs);
+                break;
+
+            case FM_GET_DIR_LIST_PKT_CC:
+                FM_ChildDirListPktCmd(Worker, CmdArgs);
+                break;
+
+            case FM_SET_PERMISSIONS_CC:
+                FM_ChildSetPermissionsCmd(Worker, CmdArgs);
+                break;
+
+            default:
+                Worker->CmdErrCounter++;
+                CFE_EVS_SendEvent(FM_CHILD_EXE_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "%s execution error: invalid command code: cc = %d", TaskText,
+                                  (int)CmdArgs->CommandCode);
+                break;
+        }
+    }
+
+    /* Execute time runs from the start recorded for progress telemetry */
+    OS_GetLocalTime(&EndTime);
+    FM_RecordLatency(FM_GlobalData.Latency.Execute, CmdArgs->CommandCode, Worker->ProgressStart, EndTime);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task -- verify file system state left by the parent    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_ChildVerifyCmd(FM_ChildWorker_t *Worker, FM_ChildQueueEntry_t *CmdArgs)
+{
+    bool              Result     = true;
+    FM_OpenPathSet_t *OpenPaths  = &Worker->OpenPaths;
+    const char *      SourceName = CmdArgs->SourceList;
+    uint32            Length;
+    char              Source[OS_MAX_PATH_LEN];
+
+    /*
+    ** The same checks, event IDs and command text as the parent task
+    **  command handlers use in FM_VERIFY_MODE_MAIN.
+    */
+    switch (CmdArgs->CommandCode)
+    {
+        case FM_COPY_FILE_CC:
+            Result = FM_VerifyFileState(FM_FILE_EXISTS, CmdArgs->Source1, OS_MAX_PATH_LEN, FM_COPY_SRC_BASE_EID,
+                                        "Copy File", OpenPaths);
+            if (Result == true)
+            {
+                Result = FM_VerifyFileState((CmdArgs->Overwrite != 0) ? FM_FILE_NOTOPEN : FM_FILE_NOEXIST,
+                                            CmdArgs->Target, OS_MAX_PATH_LEN, FM_COPY_TGT_BASE_EID, "Copy File",
+                                            OpenPaths);
+            }
+            break;
+
+        case FM_MOVE_FILE_CC:
+            Result = FM_VerifyFileState(FM_FILE_EXISTS, CmdArgs->Source1, OS_MAX_PATH_LEN, FM_MOVE_SRC_BASE_EID,
+                                        "Move File", OpenPaths);
+            if (Result == true)
+            {
+                Result = FM_VerifyFileState((CmdArgs->Overwrite != 0) ? FM_FILE_NOTOPEN : FM_FILE_NOEXIST,
+                                            CmdArgs->Target, OS_MAX_PATH_LEN, FM_MOVE_TGT_BASE_EID, "Move File",
+                                            OpenPaths);
+            }
+            break;
+
+        case FM_RENAME_FILE_CC:
+            Result = FM_VerifyFileState(FM_FILE_EXISTS, CmdArgs->Source1, OS_MAX_PATH_LEN, FM_RENAME_SRC_BASE_EID,
+                                        "Rename File", OpenPaths);
+            if (Result == true)
+            {
+                Result = FM_VerifyFileState(FM_FILE_NOEXIST, CmdArgs->Target, OS_MAX_PATH_LEN, FM_RENAME_TGT_BASE_EID,
+                                            "Rename File", OpenPaths);
+            }
+            break;
+
+        case FM_DELETE_FILE_CC:
+            Result = FM_VerifyFileState(FM_FILE_CLOSED, CmdArgs->Source1, OS_MAX_PATH_LEN, FM_DELETE_SRC_BASE_EID,
+                                        "Delete File", OpenPaths);
+            break;
+
+        case FM_DELETE_ALL_FILES_CC:
+            Result = FM_VerifyFileState(FM_DIR_EXISTS, CmdArgs->Source1, OS_MAX_PATH_LEN, FM_DELETE_ALL_SRC_BASE_EID,
+                                        "Delete All Files", OpenPaths);
+            break;
+
+        case FM_DECOMPRESS_FILE_CC:
+            Result = FM_VerifyFileState(FM_FILE_CLOSED, CmdArgs->Source1, OS_MAX_PATH_LEN, FM_DECOM_SRC_BASE_EID,
+                                        "Decompress File", OpenPaths);
+            if (Result == true)
+            {
+                Result = FM_VerifyFileState(FM_FILE_NOEXIST, CmdArgs->Target, OS_MAX_PATH_LEN, FM_DECOM_TGT_BASE_EID,
+                                            "Decompress File", OpenPaths);
+            }
+            break;
+
+        case FM_CONCAT_FILES_CC:
+            Result = FM_VerifyFileState(FM_FILE_CLOSED, CmdArgs->Source1, OS_MAX_PATH_LEN, FM_CONCAT_SRC1_BASE_EID,
+                                        "Concat Files", OpenPaths);
+            if (Result == true)
+            {
+                Result = FM_VerifyFileState(FM_FILE_CLOSED, CmdArgs->Source2, OS_MAX_PATH_LEN, FM_CONCAT_SRC2_BASE_EID,
+                                            "Concat Files", OpenPaths);
+            }
+            if (Result == true)
+            {
+                Result = FM_VerifyFileState(FM_FILE_NOEXIST, CmdArgs->Target, OS_MAX_PATH_LEN, FM_CONCAT_TGT_BASE_EID,
+                                            "Concat Files", OpenPaths);
+            }
+            break;
+
+        case FM_CONCAT_LIST_CC:
+            if (CmdArgs->Source1[0] != '\0')
+            {
+                Result = FM_VerifyFileState(FM_FILE_CLOSED, CmdArgs->Source1, OS_MAX_PATH_LEN,
+                                            FM_CONCAT_LIST_LIST_BASE_EID, "Concat List", OpenPaths);
+            }
+
+            /* Inline sources are joined by newlines, the parent checked each name fits */
+            while ((Result == true) && (*SourceName != '\0'))
+            {
+                Length = strcspn(SourceName, "\n");
+                if (Length >= sizeof(Source))
+                {
+                    Length = sizeof(Source) - 1;
+                }
+
+                memcpy(Source, SourceName, Length);
+                Source[Length] = '\0';
+
+                Result = FM_VerifyFileState(FM_FILE_CLOSED, Source, sizeof(Source), FM_CONCAT_LIST_SRC_BASE_EID,
+                                            "Concat List", OpenPaths);
+
+                SourceName += strcspn(SourceName, "\n");
+                if (*SourceName == '\n')
+                {
+                    SourceName++;
+                }
+            }
+
+            if (Result == true)
+            {
+                Result = FM_VerifyFileState(FM_FILE_NOEXIST, CmdArgs->Target, OS_MAX_PATH_LEN,
+                                            FM_CONCAT_LIST_TGT_BASE_EID, "Concat List", OpenPaths);
+            }
+            break;
+
+        case FM_GET_FILE_INFO_CC:
+            /* The parent only checked the name, get the state, size, time and mode now */
+            CmdArgs->FileInfoState = FM_GetFilenameState(CmdArgs->Source1, OS_MAX_PATH_LEN, false, OpenPaths);
+            FM_ChildSizeTimeMode(CmdArgs->Source1, &CmdArgs->FileInfoSize, &CmdArgs->FileInfoTime, &CmdArgs->Mode);
+            break;
+
+        case FM_GET_FILE_DIGEST_CC:
+            Result = FM_VerifyFileState(FM_FILE_CLOSED, CmdArgs->Source1, OS_MAX_PATH_LEN,
+                                        FM_GET_FILE_DIGEST_SRC_BASE_EID, "Get File Digest", OpenPaths);
+            break;
+
+        case FM_CREATE_DIRECTORY_CC:
+            Result = FM_VerifyFileState(FM_DIR_NOEXIST, CmdArgs->Source1, OS_MAX_PATH_LEN, FM_CREATE_DIR_SRC_BASE_EID,
+                                        "Create Directory", OpenPaths);
+            break;
+
+        case FM_DELETE_DIRECTORY_CC:
+            Result = FM_VerifyFileState(FM_DIR_EXISTS, CmdArgs->Source1, OS_MAX_PATH_LEN, FM_DELETE_DIR_SRC_BASE_EID,
+                                        "Delete Directory", OpenPaths);
+            break;
+
+        case FM_DELETE_TREE_CC:
+            Result = FM_VerifyFileState(FM_DIR_EXISTS, CmdArgs->Source1, OS_MAX_PATH_LEN, FM_DELETE_TREE_SRC_BASE_EID,
+                                        "Delete Directory Tree", OpenPaths);
+            break;
+
+        case FM_FILTER_FILES_CC:
+            Result = FM_VerifyFileState(FM_DIR_EXISTS, CmdArgs->Source1, OS_MAX_PATH_LEN, FM_FILTER_FILES_SRC_BASE_EID,
+                                        "Filter Files", OpenPaths);
+            if ((Result == true) && (CmdArgs->FilterAction != FM_FILTER_ACTION_DELETE))
+            {
+                Result = FM_VerifyFileState(FM_DIR_EXISTS, CmdArgs->Target, OS_MAX_PATH_LEN,
+                                            FM_FILTER_FILES_TGT_BASE_EID, "Filter Files", OpenPaths);
+            }
+            break;
+
+        case FM_GET_DIR_LIST_FILE_CC:
+            Result = FM_VerifyFileState(FM_DIR_EXISTS, CmdArgs->Source1, OS_MAX_PATH_LEN, FM_GET_DIR_FILE_SRC_BASE_EID,
+                                        "Directory List to File", OpenPaths);
+            if (Result == true)
+            {
+                Result = FM_VerifyFileState(FM_FILE_NOTOPEN, CmdArgs->Target, OS_MAX_PATH_LEN,
+                                            FM_GET_DIR_FILE_TGT_BASE_EID, "Directory List to File", OpenPaths);
+            }
+            break;
+
+        case FM_GET_DIR_LIST_PKT_CC:
+            Result = FM_VerifyFileState(FM_DIR_EXISTS, CmdArgs->Source1, OS_MAX_PATH_LEN, FM_GET_DIR_PKT_SRC_BASE_EID,
+                                        "Directory List to Packet", OpenPaths);
+            break;
+
+        default:
+            /*
+            ** Set permissions only needs a valid name, a retention pass
+            **  reports a missing directory itself and a purge pass has no
+            **  arguments, unknown codes are reported by FM_ChildExecute
+            */
+            break;
+    }
+
+    return Result;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task command handler -- Copy File                      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_ChildCopyCmd(FM_ChildWorker_t *Worker, const FM_ChildQueueEntry_t *CmdArgs)
+{
+    const char *CmdText = "Copy File";
+
+    /* Report current child task activity */
+    Worker->CurrentCC = CmdArgs->CommandCode;
+
+    FM_ChildCheckpointBegin(Worker, CmdArgs);
+
+    if (FM_ChildCopyFile(Worker, CmdArgs->Source1, CmdArgs->Target, FM_COPY_OS_ERR_EID, CmdText) == false)
+    {
+        Worker->CmdErrCounter++;
+    }
+    else
+    {
+        Worker->CmdCounter++;
+
+        /* Send command completion event (info) */
+        CFE_EVS_SendEvent(FM_COPY_CMD_INF_EID, CFE_EVS_EventType_INFORMATION,
+                          "%s command: src = %s, tgt = %s, bytes = %llu", CmdText, CmdArgs->Source1, CmdArgs->Target,
+                          (unsigned long long)Worker->CopyBytes);
+    }
+
+    FM_ChildCheckpointEnd(Worker);
+
+    /* Report previous child task activity */
+    Worker->PreviousCC = CmdArgs->CommandCode;
+    Worker->CurrentCC  = 0;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task command handler -- Move File                      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_ChildMoveCmd(FM_ChildWorker_t *Worker, const FM_ChildQueueEntry_t *CmdArgs)
 {
     const char *CmdText   = "Move File";
     int32       OS_Status = OS_SUCCESS;
 
     /* Report current child task activity */
-    FM_GlobalData.ChildCurrentCC = CmdArgs->CommandCode;
+    Worker->CurrentCC = CmdArgs->CommandCode;
 
-    OS_Status = OS_mv(CmdArgs->Source1, CmdArgs->Target);
+    FM_ChildCheckpointBegin(Worker, CmdArgs);
+
+    /* A rename only works within one volume */
+    OS_Status = OS_rename(CmdArgs->Source1, CmdArgs->Target);
 
     if (OS_Status != OS_SUCCESS)
     {
-        FM_GlobalData.ChildCmdErrCounter++;
+        /* Move across volumes - copy the file, then remove the source file */
+        if (FM_ChildCopyFile(Worker, CmdArgs->Source1, CmdArgs->Target, FM_MOVE_OS_ERR_EID, CmdText) == true)
+        {
+            OS_Status = OS_remove(CmdArgs->Source1);
 
-        /* Send command failure event (error) */
-        CFE_EVS_SendEvent(FM_MOVE_OS_ERR_EID, CFE_EVS_EventType_ERROR,
-                          "%s error: OS_mv failed: result = %d, src = %s, tgt = %s", CmdText, (int)OS_Status,
-                          CmdArgs->Source1, CmdArgs->Target);
+            if (OS_Status != OS_SUCCESS)
+            {
+                /* Send command failure event (error) */
+                CFE_EVS_SendEvent(FM_MOVE_OS_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "%s error: OS_remove failed: result = %d, src = %s", CmdText, (int)OS_Status,
+                                  CmdArgs->Source1);
+            }
+        }
+    }
+
+    if (OS_Status != OS_SUCCESS)
+    {
+        Worker->CmdErrCounter++;
     }
     else
     {
-        FM_GlobalData.ChildCmdCounter++;
+        Worker->CmdCounter++;
 
         /* Send command completion event (info) */
         CFE_EVS_SendEvent(FM_MOVE_CMD_INF_EID, CFE_EVS_EventType_INFORMATION, "%s command: src = %s, tgt = %s", CmdText,
                           CmdArgs->Source1, CmdArgs->Target);
     }
 
+    FM_ChildCheckpointEnd(Worker);
+
     /* Report previous child task activity */
-    FM_GlobalData.ChildPreviousCC = CmdArgs->CommandCode;
-    FM_GlobalData.ChildCurrentCC  = 0;
+    Worker->PreviousCC = CmdArgs->CommandCode;
+    Worker->CurrentCC  = 0;
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
@@ -356,19 +1189,19 @@ void FM_ChildMoveCmd(const FM_ChildQueueEntry_t *CmdArgs)
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-void FM_ChildRenameCmd(const FM_ChildQueueEntry_t *CmdArgs)
+void FM_ChildRenameCmd(FM_ChildWorker_t *Worker, const FM_ChildQueueEntry_t *CmdArgs)
 {
     const char *CmdText   = "Rename File";
     int32       OS_Status = OS_SUCCESS;
 
     /* Report current child task activity */
-    FM_GlobalData.ChildCurrentCC = CmdArgs->CommandCode;
+    Worker->CurrentCC = CmdArgs->CommandCode;
 
     OS_Status = OS_rename(CmdArgs->Source1, CmdArgs->Target);
 
     if (OS_Status != OS_SUCCESS)
     {
-        FM_GlobalData.ChildCmdErrCounter++;
+        Worker->CmdErrCounter++;
 
         /* Send command failure event (error) */
         CFE_EVS_SendEvent(FM_RENAME_OS_ERR_EID, CFE_EVS_EventType_ERROR,
@@ -377,7 +1210,7 @@ void FM_ChildRenameCmd(const FM_ChildQueueEntry_t *CmdArgs)
     }
     else
     {
-        FM_GlobalData.ChildCmdCounter++;
+        Worker->CmdCounter++;
 
         /* Send command completion event (info) */
         CFE_EVS_SendEvent(FM_RENAME_CMD_INF_EID, CFE_EVS_EventType_INFORMATION, "%s command: src = %s, tgt = %s",
@@ -385,8 +1218,8 @@ void FM_ChildRenameCmd(const FM_ChildQueueEntry_t *CmdArgs)
     }
 
     /* Report previous child task activity */
-    FM_GlobalData.ChildPreviousCC = CmdArgs->CommandCode;
-    FM_GlobalData.ChildCurrentCC  = 0;
+    Worker->PreviousCC = CmdArgs->CommandCode;
+    Worker->CurrentCC  = 0;
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
@@ -395,19 +1228,23 @@ void FM_ChildRenameCmd(const FM_ChildQueueEntry_t *CmdArgs)
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-void FM_ChildDeleteCmd(const FM_ChildQueueEntry_t *CmdArgs)
+void FM_ChildDeleteCmd(FM_ChildWorker_t *Worker, const FM_ChildQueueEntry_t *CmdArgs)
 {
     const char *CmdText   = "Delete File";
     int32       OS_Status = OS_SUCCESS;
 
     /* Report current child task activity */
-    FM_GlobalData.ChildCurrentCC = CmdArgs->CommandCode;
+    Worker->CurrentCC = CmdArgs->CommandCode;
 
-    OS_Status = OS_remove(CmdArgs->Source1);
+    /* In FM_DELETE_MODE_TRASH the file is removed later by a purge pass */
+    if (FM_ChildTrashFile(CmdArgs->Source1) == false)
+    {
+        OS_Status = OS_remove(CmdArgs->Source1);
+    }
 
     if (OS_Status != OS_SUCCESS)
     {
-        FM_GlobalData.ChildCmdErrCounter++;
+        Worker->CmdErrCounter++;
 
         /* Send command failure event (error) */
         CFE_EVS_SendEvent(FM_DELETE_OS_ERR_EID, CFE_EVS_EventType_ERROR,
@@ -416,7 +1253,7 @@ void FM_ChildDeleteCmd(const FM_ChildQueueEntry_t *CmdArgs)
     }
     else
     {
-        FM_GlobalData.ChildCmdCounter++;
+        Worker->CmdCounter++;
 
         /* Send command completion event (info) */
         CFE_EVS_SendEvent(FM_DELETE_CMD_INF_EID, CFE_EVS_EventType_INFORMATION, "%s command: file = %s", CmdText,
@@ -424,8 +1261,8 @@ void FM_ChildDeleteCmd(const FM_ChildQueueEntry_t *CmdArgs)
     }
 
     /* Report previous child task activity */
-    FM_GlobalData.ChildPreviousCC = CmdArgs->CommandCode;
-    FM_GlobalData.ChildCurrentCC  = 0;
+    Worker->PreviousCC = CmdArgs->CommandCode;
+    Worker->CurrentCC  = 0;
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
@@ -434,18 +1271,16 @@ void FM_ChildDeleteCmd(const FM_ChildQueueEntry_t *CmdArgs)
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-void FM_ChildDeleteAllFilesCmd(FM_ChildQueueEntry_t *CmdArgs)
+void FM_ChildDeleteAllFilesCmd(FM_ChildWorker_t *Worker, FM_ChildQueueEntry_t *CmdArgs)
 {
-    const char *CmdText = "Delete All Files";
-    osal_id_t   DirId   = OS_OBJECT_ID_UNDEFINED;
-    os_dirent_t DirEntry;
-    int32       OS_Status                     = OS_SUCCESS;
-    uint32      FilenameState                 = FM_NAME_IS_INVALID;
-    uint32      NameLength                    = 0;
-    uint32      DeleteCount                   = 0;
-    uint32      FilesNotDeletedCount          = 0;
-    uint32      DirectoriesSkippedCount       = 0;
-    char        Filename[2 * OS_MAX_PATH_LEN] = "";
+    const char *CmdText                 = "Delete All Files";
+    osal_id_t   DirId                   = OS_OBJECT_ID_UNDEFINED;
+    int32       OS_Status               = OS_SUCCESS;
+    bool        DirectoryEnd            = false;
+    uint32      DeleteCount             = 0;
+    uint32      BatchCount              = 0;
+    uint32      FilesNotDeletedCount    = 0;
+    uint32      DirectoriesSkippedCount = 0;
 
     /*
     ** Command argument usage for this command:
@@ -457,17 +1292,15 @@ void FM_ChildDeleteAllFilesCmd(FM_ChildQueueEntry_t *CmdArgs)
     char *Directory  = CmdArgs->Source1;
     char *DirWithSep = CmdArgs->Source2;
 
-    memset(&DirEntry, 0, sizeof(DirEntry));
-
     /* Report current child task activity */
-    FM_GlobalData.ChildCurrentCC = CmdArgs->CommandCode;
+    Worker->CurrentCC = CmdArgs->CommandCode;
 
     /* Open directory so that we can read from it */
     OS_Status = OS_DirectoryOpen(&DirId, Directory);
 
     if (OS_Status != OS_SUCCESS)
     {
-        FM_GlobalData.ChildCmdErrCounter++;
+        Worker->CmdErrCounter++;
 
         /* Send command failure event (error) */
         CFE_EVS_SendEvent(FM_DELETE_ALL_OS_ERR_EID, CFE_EVS_EventType_ERROR,
@@ -475,1081 +1308,4272 @@ void FM_ChildDeleteAllFilesCmd(FM_ChildQueueEntry_t *CmdArgs)
     }
     else
     {
-        /* Read each directory entry and delete the files */
-
-        while (OS_DirectoryRead(DirId, &DirEntry) == OS_SUCCESS)
+        /*
+        ** The closed files found are collected in the delete list and
+        ** removed a batch at a time.  After a batch removes files the read
+        ** starts over and passes the entries already counted, so each
+        ** entry is counted once and the rest of the directory is never
+        ** read past, whatever the file system does with removed entries.
+        */
+        Worker->DirKeptCount = 0;
+        Worker->DirSkipCount = 0;
+
+        while ((DirectoryEnd == false) && (Worker->Aborted == false))
         {
-            /*
-            ** Ignore the "." and ".." directory entries
-            */
-            if ((strcmp(OS_DIRENTRY_NAME(DirEntry), FM_THIS_DIRECTORY) != 0) &&
-                (strcmp(OS_DIRENTRY_NAME(DirEntry), FM_PARENT_DIRECTORY) != 0))
-            {
-                /* Construct full path filename */
-                NameLength = snprintf(Filename, sizeof(Filename), "%s%s", DirWithSep, OS_DIRENTRY_NAME(DirEntry));
+            Worker->DeleteListLength = 0;
+            Worker->DeleteListCount  = 0;
 
-                if (NameLength >= OS_MAX_PATH_LEN)
-                {
-                    FilesNotDeletedCount++;
-                }
-                else
-                {
-                    /* What kind of directory entry is this? */
-                    FilenameState = FM_GetFilenameState(Filename, OS_MAX_PATH_LEN, false);
+            DirectoryEnd = FM_ChildDeleteAllCollect(Worker, DirId, DirWithSep, CmdText, false, &FilesNotDeletedCount,
+                                                    &DirectoriesSkippedCount);
 
-                    /* FilenameState cannot have a value beyond five macros in cases below */
-                    switch (FilenameState)
-                    {
-                        case FM_NAME_IS_INVALID:
-                            FilesNotDeletedCount++;
-                            break;
-
-                        case FM_NAME_IS_NOT_IN_USE:
-
-                            /* This result is very unlikely - the */
-                            /*   name existed a moment ago when   */
-                            /*   the directory entry was read but */
-                            /*   now the call to OS_stat() failed */
-                            /*   implying that the entry is gone  */
-                            FilesNotDeletedCount++;
-                            break;
-
-                        case FM_NAME_IS_DIRECTORY:
-                            DirectoriesSkippedCount++;
-                            break;
-
-                        case FM_NAME_IS_FILE_OPEN:
-                            FilesNotDeletedCount++;
-                            break;
-
-                        case FM_NAME_IS_FILE_CLOSED:
-                            if ((OS_Status = OS_remove(Filename)) == OS_SUCCESS)
-                            {
-                                /*
-                                ** After deleting the file, rewind the directory
-                                ** to keep the file system from getting confused
-                                */
-                                OS_DirectoryRewind(DirId);
-
-                                /* Increment delete count */
-                                DeleteCount++;
-                            }
-                            else
-                            {
-                                FilesNotDeletedCount++;
-                            }
-
-                            break;
-                        default:
-                            FilesNotDeletedCount++;
-                            break;
-                    } /* end switch statement */
-                }
-            } /* end if "." or ".." directory entries */
-        }     /* End while OS_ReadDirectory */
+            if (DirectoryEnd == true)
+            {
+                /* The last batch is removed with the directory closed */
+                OS_DirectoryClose(DirId);
+            }
 
-        OS_DirectoryClose(DirId);
+            BatchCount = FM_ChildDeleteAllRemove(Worker, Directory, DirWithSep, CmdText, &FilesNotDeletedCount);
+            DeleteCount += BatchCount;
 
-        /* Send command completion event (info) */
-        CFE_EVS_SendEvent(FM_DELETE_ALL_CMD_INF_EID, CFE_EVS_EventType_INFORMATION,
-                          "%s command: deleted %d files: dir = %s", CmdText, (int)DeleteCount, Directory);
-        FM_GlobalData.ChildCmdCounter++;
+            if (DirectoryEnd == false)
+            {
+                FM_ChildDirectoryRestart(Worker, DirId, BatchCount);
+            }
+        }
 
-        if (FilesNotDeletedCount > 0)
+        if (DirectoryEnd == false)
         {
-            /* If errors occurred, report generic event(s) */
-            CFE_EVS_SendEvent(FM_DELETE_ALL_FILES_ND_WARNING_EID, CFE_EVS_EventType_INFORMATION,
-                              "%s command: one or more files could not be deleted. Files may be open : dir = %s",
-                              CmdText, Directory);
-            FM_GlobalData.ChildCmdWarnCounter++;
+            OS_DirectoryClose(DirId);
         }
 
-        if (DirectoriesSkippedCount > 0)
+        if (Worker->Aborted)
         {
-            /* If errors occurred, report generic event(s) */
-            CFE_EVS_SendEvent(FM_DELETE_ALL_SKIP_WARNING_EID, CFE_EVS_EventType_INFORMATION,
-                              "%s command: one or more directories skipped : dir = %s", CmdText, Directory);
-            FM_GlobalData.ChildCmdWarnCounter++;
+            /* Files deleted before the abort stay deleted */
+            Worker->CmdErrCounter++;
         }
+        else
+        {
+            /* Send command completion event (info) */
+            CFE_EVS_SendEvent(FM_DELETE_ALL_CMD_INF_EID, CFE_EVS_EventType_INFORMATION,
+                              "%s command: deleted %d files: dir = %s", CmdText, (int)DeleteCount, Directory);
+            Worker->CmdCounter++;
+
+            if (FilesNotDeletedCount > 0)
+            {
+                /* If errors occurred, report generic event(s) */
+                CFE_EVS_SendEvent(FM_DELETE_ALL_FILES_ND_WARNING_EID, CFE_EVS_EventType_INFORMATION,
+                                  "%s command: one or more files could not be deleted. Files may be open : dir = %s",
+                                  CmdText, Directory);
+                Worker->CmdWarnCounter++;
+            }
 
+            if (DirectoriesSkippedCount > 0)
+            {
+                /* If errors occurred, report generic event(s) */
+                CFE_EVS_SendEvent(FM_DELETE_ALL_SKIP_WARNING_EID, CFE_EVS_EventType_INFORMATION,
+                                  "%s command: one or more directories skipped : dir = %s", CmdText, Directory);
+                Worker->CmdWarnCounter++;
+            }
+        }
     } /* end if OS_Status != OS_SUCCESS */
 
     /* Report previous child task activity */
-    FM_GlobalData.ChildPreviousCC = CmdArgs->CommandCode;
-    FM_GlobalData.ChildCurrentCC  = 0;
+    Worker->PreviousCC = CmdArgs->CommandCode;
+    Worker->CurrentCC  = 0;
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* FM child task command handler -- Decompress File                */
+/* FM child task utility function -- collect files to delete       */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-void FM_ChildDecompressFileCmd(const FM_ChildQueueEntry_t *CmdArgs)
+bool FM_ChildDeleteAllCollect(FM_ChildWorker_t *Worker, osal_id_t DirId, const char *DirWithSep, const char *CmdText,
+                              bool Descend, uint32 *NotDeletedCount, uint32 *SkippedCount)
 {
-    const char * CmdText    = "Decompress File";
-    CFE_Status_t CFE_Status = CFE_SUCCESS;
-
-    /* Report current child task activity */
-    FM_GlobalData.ChildCurrentCC = CmdArgs->CommandCode;
+    bool        DirectoryEnd  = false;
+    uint32      FilenameState = FM_NAME_IS_INVALID;
+    uint32      PathLength    = 0;
+    uint32      NameLength    = 0;
+    os_dirent_t DirEntry;
+    char        Filename[2 * OS_MAX_PATH_LEN];
 
-    /* Decompress source file into target file */
-    CFE_Status = FM_Decompress_Impl(FM_GlobalData.DecompressorStatePtr, CmdArgs->Source1, CmdArgs->Target);
+    memset(&DirEntry, 0, sizeof(DirEntry));
 
-    if (CFE_Status != CFE_SUCCESS)
+    /* Stop reading while the list still has room for the longest name */
+    while ((DirectoryEnd == false) && ((FM_CHILD_DELETE_LIST_SIZE - Worker->DeleteListLength) >= OS_MAX_PATH_LEN) &&
+           (FM_ChildAbortCheck(Worker, CmdText) == false))
     {
-        FM_GlobalData.ChildCmdErrCounter++;
+        if (FM_ChildDirectoryNext(Worker, DirId, &DirEntry) == false)
+        {
+            DirectoryEnd = true;
+        }
+        else
+        {
+            /* Construct full path filename */
+            PathLength = snprintf(Filename, sizeof(Filename), "%s%s", DirWithSep, OS_DIRENTRY_NAME(DirEntry));
 
-        /* Send command failure event (error) */
-        CFE_EVS_SendEvent(FM_DECOM_CFE_ERR_EID, CFE_EVS_EventType_ERROR,
-                          "%s error: CFE_FS_Decompress failed: result = %d, src = %s, tgt = %s", CmdText,
-                          (int)CFE_Status, CmdArgs->Source1, CmdArgs->Target);
-    }
-    else
-    {
-        FM_GlobalData.ChildCmdCounter++;
+            if (PathLength >= OS_MAX_PATH_LEN)
+            {
+                (*NotDeletedCount)++;
+            }
+            else
+            {
+                /* What kind of directory entry is this? */
+                FilenameState = FM_GetFilenameState(Filename, OS_MAX_PATH_LEN, false, &Worker->OpenPaths);
 
-        /* Send command completion event (info) */
-        CFE_EVS_SendEvent(FM_DECOM_CMD_INF_EID, CFE_EVS_EventType_INFORMATION, "%s command: src = %s, tgt = %s",
-                          CmdText, CmdArgs->Source1, CmdArgs->Target);
+                switch (FilenameState)
+                {
+                    case FM_NAME_IS_DIRECTORY:
+                        /* A tree delete visits the sub-directory after this directory has been read */
+                        if ((Descend == false) || (FM_ChildDeleteTreePush(Worker, Filename) == false))
+                        {
+                            (*SkippedCount)++;
+                        }
+                        break;
+
+                    case FM_NAME_IS_FILE_CLOSED:
+                        /* Only the entry name is kept, the directory is added back when removing */
+                        NameLength = strlen(OS_DIRENTRY_NAME(DirEntry)) + 1;
+                        memcpy(&Worker->DeleteList[Worker->DeleteListLength], OS_DIRENTRY_NAME(DirEntry), NameLength);
+
+                        Worker->DeleteListLength += NameLength;
+                        Worker->DeleteListCount++;
+                        break;
+
+                    default:
+                        /* Invalid, open, or gone since the directory entry was read */
+                        (*NotDeletedCount)++;
+                        break;
+                }
+            }
+        }
     }
 
-    /* Report previous child task activity */
-    FM_GlobalData.ChildPreviousCC = CmdArgs->CommandCode;
-    FM_GlobalData.ChildCurrentCC  = 0;
+    return DirectoryEnd;
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* FM child task command handler -- Concatenate Files              */
+/* FM child task utility function -- remove collected files        */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-void FM_ChildConcatFilesCmd(const FM_ChildQueueEntry_t *CmdArgs)
+uint32 FM_ChildDeleteAllRemove(FM_ChildWorker_t *Worker, const char *Directory, const char *DirWithSep,
+                               const char *CmdText, uint32 *NotDeletedCount)
 {
-    const char *CmdText        = "Concat Files";
-    bool        ConcatResult   = false;
-    bool        CopyInProgress = false;
-    int32       LoopCount      = 0;
-    int32       OS_Status      = OS_SUCCESS;
-    osal_id_t   FileHandleSrc  = OS_OBJECT_ID_UNDEFINED;
-    osal_id_t   FileHandleTgt  = OS_OBJECT_ID_UNDEFINED;
-    int32       BytesRead      = 0;
-    int32       BytesWritten   = 0;
-
-    /* Report current child task activity */
-    FM_GlobalData.ChildCurrentCC = CmdArgs->CommandCode;
-
-    /* Copy source file #1 to the target file */
-    OS_Status = OS_cp(CmdArgs->Source1, CmdArgs->Target);
+    uint32      DeleteCount = 0;
+    uint32      Offset      = 0;
+    const char *Name        = NULL;
+    char        Filename[2 * OS_MAX_PATH_LEN];
 
-    if (OS_Status != OS_SUCCESS)
+    /* One throttle charge covers the whole batch */
+    if ((Worker->DeleteListCount > 0) && (Worker->Aborted == false))
     {
-        FM_GlobalData.ChildCmdErrCounter++;
-
-        /* Send command failure event (error) */
-        CFE_EVS_SendEvent(FM_CONCAT_OSCPY_ERR_EID, CFE_EVS_EventType_ERROR,
-                          "%s error: OS_cp failed: result = %d, src = %s, tgt = %s", CmdText, (int)OS_Status,
-                          CmdArgs->Source1, CmdArgs->Target);
+        FM_ChildThrottle(Directory, NULL, 0, Worker->DeleteListCount);
     }
-    else
+
+    /*
+    ** Files may have been opened while the batch was collected and
+    **  throttled, so each batch is checked against a new snapshot of the
+    **  open files.  The next batch is collected with the same snapshot.
+    */
+    Worker->OpenPaths.Valid = false;
+
+    while ((Offset < Worker->DeleteListLength) && (FM_ChildAbortCheck(Worker, CmdText) == false))
     {
-        /* Open source file #2 */
-        OS_Status = OS_OpenCreate(&FileHandleSrc, CmdArgs->Source2, OS_FILE_FLAG_NONE, OS_READ_ONLY);
+        Name = &Worker->DeleteList[Offset];
+        snprintf(Filename, sizeof(Filename), "%s%s", DirWithSep, Name);
 
-        if (OS_Status != OS_SUCCESS)
+        if (FM_IsPathOpen(&Worker->OpenPaths, Filename) == true)
         {
-            FM_GlobalData.ChildCmdErrCounter++;
-
-            /* Send command failure event (error) */
-            CFE_EVS_SendEvent(FM_CONCAT_OPEN_SRC2_ERR_EID, CFE_EVS_EventType_ERROR,
-                              "%s error: OS_OpenCreate failed: result = %d, src2 = %s", CmdText, (int)OS_Status,
-                              CmdArgs->Source2);
+            (*NotDeletedCount)++;
         }
-        else
+        /* A file put in the trash counts as deleted */
+        else if ((FM_ChildTrashFile(Filename) == true) || (OS_remove(Filename) == OS_SUCCESS))
         {
-            /* Open target file */
-            OS_Status = OS_OpenCreate(&FileHandleTgt, CmdArgs->Target, OS_FILE_FLAG_NONE, OS_READ_WRITE);
-
-            if (OS_Status != OS_SUCCESS)
-            {
-                FM_GlobalData.ChildCmdErrCounter++;
-
-                /* Send command failure event (error) */
-                CFE_EVS_SendEvent(FM_CONCAT_OPEN_TGT_ERR_EID, CFE_EVS_EventType_ERROR,
-                                  "%s error: OS_OpenCreate failed: result = %d, tgt = %s", CmdText, (int)OS_Status,
-                                  CmdArgs->Target);
-            }
-            else
-            {
-                /* Append source file #2 to target file */
-                /* Seek to end of target file */
-                OS_lseek(FileHandleTgt, 0, OS_SEEK_END);
-                CopyInProgress = true;
-                LoopCount      = 0;
-
-                while (CopyInProgress)
-                {
-                    BytesRead = OS_read(FileHandleSrc, FM_GlobalData.ChildBuffer, FM_CHILD_FILE_BLOCK_SIZE);
-
-                    if (BytesRead == 0)
-                    {
-                        /* Success - finished reading source file #2 */
-                        CopyInProgress = false;
-                        ConcatResult   = true;
-
-                        FM_GlobalData.ChildCmdCounter++;
-
-                        /* Send command completion event (info) */
-                        CFE_EVS_SendEvent(FM_CONCAT_CMD_INF_EID, CFE_EVS_EventType_INFORMATION,
-                                          "%s command: src1 = %s, src2 = %s, tgt = %s", CmdText, CmdArgs->Source1,
-                                          CmdArgs->Source2, CmdArgs->Target);
-                    }
-                    else if (BytesRead < 0)
-                    {
-                        CopyInProgress = false;
-                        FM_GlobalData.ChildCmdErrCounter++;
-
-                        /* Send command failure event (error) */
-                        CFE_EVS_SendEvent(FM_CONCAT_OSRD_ERR_EID, CFE_EVS_EventType_ERROR,
-                                          "%s error: OS_read failed: result = %d, file = %s", CmdText, (int)BytesRead,
-                                          CmdArgs->Source2);
-                    }
-                    else
-                    {
-                        /* Write source file #2 to target file */
-                        BytesWritten = OS_write(FileHandleTgt, FM_GlobalData.ChildBuffer, BytesRead);
-
-                        if (BytesWritten != BytesRead)
-                        {
-                            CopyInProgress = false;
-                            FM_GlobalData.ChildCmdErrCounter++;
-
-                            /* Send command failure event (error) */
-                            CFE_EVS_SendEvent(FM_CONCAT_OSWR_ERR_EID, CFE_EVS_EventType_ERROR,
-                                              "%s error: OS_write failed: result = %d, expected = %d", CmdText,
-                                              (int)BytesWritten, (int)BytesRead);
-                        }
-
-                        /* Avoid CPU hogging */
-                        LoopCount++;
-                        if (LoopCount == FM_CHILD_FILE_LOOP_COUNT)
-                        {
-                            /* Give up the CPU */
-                            CFE_ES_PerfLogExit(FM_CHILD_TASK_PERF_ID);
-                            OS_TaskDelay(FM_CHILD_FILE_SLEEP_MS);
-                            CFE_ES_PerfLogEntry(FM_CHILD_TASK_PERF_ID);
-                            LoopCount = 0;
-                        }
-                    }
-                }
-                /* Close target file */
-                OS_close(FileHandleTgt);
-            }
-            /* Close source file #2 */
-            OS_close(FileHandleSrc);
+            DeleteCount++;
         }
-
-        if (ConcatResult == false)
+        else
         {
-            /* Remove partial target file after concat error */
-            OS_remove(CmdArgs->Target);
+            (*NotDeletedCount)++;
         }
+
+        Offset += strlen(Name) + 1;
     }
 
-    /* Report previous child task activity */
-    FM_GlobalData.ChildPreviousCC = CmdArgs->CommandCode;
-    FM_GlobalData.ChildCurrentCC  = 0;
+    return DeleteCount;
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* FM child task command handler -- Get File Info                  */
+/* FM child task utility function -- read the next directory entry */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-void FM_ChildFileInfoCmd(FM_ChildQueueEntry_t *CmdArgs)
+bool FM_ChildDirectoryNext(FM_ChildWorker_t *Worker, osal_id_t DirId, os_dirent_t *DirEntry)
 {
-    const char *CmdText    = "Get File Info";
-    bool        GettingCRC = false;
-    uint32      CurrentCRC = 0;
-    int32       LoopCount  = 0;
-    int32       BytesRead  = 0;
-    osal_id_t   FileHandle = OS_OBJECT_ID_UNDEFINED;
-    int32       Status     = 0;
-
-    FM_FileInfoPkt_Payload_t *ReportPtr;
-
-    /* Report current child task activity */
-    FM_GlobalData.ChildCurrentCC = CmdArgs->CommandCode;
-
-    /*
-    ** Command argument usage for this command:
-    **
-    **  CmdArgs->CommandCode   = FM_GET_DIR_LIST_FILE_CC
-    **  CmdArgs->Source1       = name of directory or file
-    **  CmdArgs->FileInfoState = state of directory or file
-    **  CmdArgs->FileInfoSize  = file size, else zero
-    **  CmdArgs->FileInfoTime  = last modify time
-    */
-
-    /* Initialize file info packet (set all data to zero) */
-    CFE_MSG_Init(CFE_MSG_PTR(FM_GlobalData.FileInfoPkt.TelemetryHeader), CFE_SB_ValueToMsgId(FM_FILE_INFO_TLM_MID),
-                 sizeof(FM_FileInfoPkt_t));
-
-    ReportPtr = &FM_GlobalData.FileInfoPkt.Payload;
-
-    /* Report directory or filename state, name, size and time */
-    ReportPtr->FileStatus = (uint8)CmdArgs->FileInfoState;
-    strncpy(ReportPtr->Filename, CmdArgs->Source1, OS_MAX_PATH_LEN - 1);
-    ReportPtr->Filename[OS_MAX_PATH_LEN - 1] = '\0';
-
-    ReportPtr->FileSize         = CmdArgs->FileInfoSize;
-    ReportPtr->LastModifiedTime = CmdArgs->FileInfoTime;
-    ReportPtr->Mode             = CmdArgs->Mode;
+    bool EntryRead    = false;
+    bool DirectoryEnd = false;
 
-    /* Validate CRC algorithm */
-    if (CmdArgs->FileInfoCRC != FM_IGNORE_CRC)
+    while ((EntryRead == false) && (DirectoryEnd == false))
     {
-        if (CmdArgs->FileInfoState != FM_NAME_IS_FILE_CLOSED)
+        if (OS_DirectoryRead(DirId, DirEntry) != OS_SUCCESS)
         {
-            /* Can only calculate CRC for closed files */
-            FM_GlobalData.ChildCmdWarnCounter++;
-
-            CFE_EVS_SendEvent(FM_GET_FILE_INFO_STATE_WARNING_EID, CFE_EVS_EventType_INFORMATION,
-                              "%s warning: unable to compute CRC: invalid file state = %d, file = %s", CmdText,
-                              (int)CmdArgs->FileInfoState, CmdArgs->Source1);
-
-            CmdArgs->FileInfoCRC = FM_IGNORE_CRC;
+            DirectoryEnd = true;
         }
-        else if ((CmdArgs->FileInfoCRC != CFE_ES_CrcType_CRC_8) && (CmdArgs->FileInfoCRC != CFE_ES_CrcType_CRC_16) &&
-                 (CmdArgs->FileInfoCRC != CFE_ES_CrcType_CRC_32))
+        /*
+        ** Ignore the "." and ".." directory entries
+        */
+        else if ((strcmp(OS_DIRENTRY_NAME(*DirEntry), FM_THIS_DIRECTORY) == 0) ||
+                 (strcmp(OS_DIRENTRY_NAME(*DirEntry), FM_PARENT_DIRECTORY) == 0))
         {
-            /* Can only calculate CRC using known algorithms */
-            FM_GlobalData.ChildCmdWarnCounter++;
-
-            CFE_EVS_SendEvent(FM_GET_FILE_INFO_TYPE_WARNING_EID, CFE_EVS_EventType_INFORMATION,
-                              "%s warning: unable to compute CRC: invalid CRC type = %d, file = %s", CmdText,
-                              (int)CmdArgs->FileInfoCRC, CmdArgs->Source1);
-
-            CmdArgs->FileInfoCRC = FM_IGNORE_CRC;
+            /* Not counted */
         }
-    }
-
-    /* Compute CRC */
-    if (CmdArgs->FileInfoCRC != FM_IGNORE_CRC)
-    {
-        Status = OS_OpenCreate(&FileHandle, CmdArgs->Source1, OS_FILE_FLAG_NONE, OS_READ_ONLY);
-
-        if (Status != OS_SUCCESS)
+        else if (Worker->DirSkipCount > 0)
         {
-            FM_GlobalData.ChildCmdWarnCounter++;
-
-            /* Send CRC failure event (warning) */
-            CFE_EVS_SendEvent(FM_GET_FILE_INFO_OPEN_ERR_EID, CFE_EVS_EventType_ERROR,
-                              "%s warning: unable to compute CRC: OS_OpenCreate result = %d, file = %s", CmdText,
-                              (int)Status, CmdArgs->Source1);
-
-            GettingCRC = false;
+            /* Already read and counted before the read started over */
+            Worker->DirSkipCount--;
         }
         else
         {
-            GettingCRC = true;
-        }
-
-        while (GettingCRC)
-        {
-            BytesRead = OS_read(FileHandle, FM_GlobalData.ChildBuffer, FM_CHILD_FILE_BLOCK_SIZE);
-
-            if (BytesRead == 0)
-            {
-                /* Finished reading file */
-                GettingCRC = false;
-                OS_close(FileHandle);
-
-                /* Add CRC to telemetry packet */
-                ReportPtr->CRC_Computed = true;
-                ReportPtr->CRC          = CurrentCRC;
-            }
-            else if (BytesRead < 0)
-            {
-                /* Error reading file */
-                CurrentCRC = 0;
-                GettingCRC = false;
-                OS_close(FileHandle);
-
-                /* Send CRC failure event (warning) */
-                FM_GlobalData.ChildCmdWarnCounter++;
-                CFE_EVS_SendEvent(FM_GET_FILE_INFO_READ_WARNING_EID, CFE_EVS_EventType_INFORMATION,
-                                  "%s warning: unable to compute CRC: OS_read result = %d, file = %s", CmdText,
-                                  (int)BytesRead, CmdArgs->Source1);
-            }
-            else
-            {
-                /* Continue CRC calculation */
-                CurrentCRC =
-                    CFE_ES_CalculateCRC(FM_GlobalData.ChildBuffer, BytesRead, CurrentCRC, CmdArgs->FileInfoCRC);
-            }
-
-            /* Avoid CPU hogging */
-            if (GettingCRC)
-            {
-                LoopCount++;
-                if (LoopCount == FM_CHILD_FILE_LOOP_COUNT)
-                {
-                    /* Give up the CPU */
-                    CFE_ES_PerfLogExit(FM_CHILD_TASK_PERF_ID);
-                    OS_TaskDelay(FM_CHILD_FILE_SLEEP_MS);
-                    CFE_ES_PerfLogEntry(FM_CHILD_TASK_PERF_ID);
-                    LoopCount = 0;
-                }
-            }
+            /* The entry is in the directory until a batch removes it */
+            Worker->DirKeptCount++;
+            EntryRead = true;
         }
-
-        ReportPtr->CRC = CurrentCRC;
     }
 
-    /* Timestamp and send file info telemetry packet */
-    CFE_SB_TimeStampMsg(CFE_MSG_PTR(FM_GlobalData.FileInfoPkt.TelemetryHeader));
-    CFE_SB_TransmitMsg(CFE_MSG_PTR(FM_GlobalData.FileInfoPkt.TelemetryHeader), true);
+    return EntryRead;
+}
 
-    FM_GlobalData.ChildCmdCounter++;
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- restart a directory read      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-    /* Send command completion event (info) */
-    CFE_EVS_SendEvent(FM_GET_FILE_INFO_CMD_INF_EID, CFE_EVS_EventType_INFORMATION, "%s command: file = %s", CmdText,
-                      CmdArgs->Source1);
+void FM_ChildDirectoryRestart(FM_ChildWorker_t *Worker, osal_id_t DirId, uint32 RemovedCount)
+{
+    Worker->DirKeptCount -= RemovedCount;
 
-    /* Report previous child task activity */
-    FM_GlobalData.ChildPreviousCC = CmdArgs->CommandCode;
-    FM_GlobalData.ChildCurrentCC  = 0;
+    /*
+    ** File systems that read a directory by entry offset (RTEMS IMFS,
+    **  dosFs) move the unread entries down over the removed ones, so the
+    **  read starts over and passes the entries that stayed.  A batch that
+    **  removed nothing leaves the read where it is.
+    */
+    if (RemovedCount > 0)
+    {
+        OS_DirectoryRewind(DirId);
+        Worker->DirSkipCount = Worker->DirKeptCount;
+    }
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* FM child task command handler -- Create Directory               */
+/* FM child task command handler -- Decompress File                */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-void FM_ChildCreateDirectoryCmd(const FM_ChildQueueEntry_t *CmdArgs)
+void FM_ChildDecompressFileCmd(FM_ChildWorker_t *Worker, const FM_ChildQueueEntry_t *CmdArgs)
 {
-    const char *CmdText   = "Create Directory";
-    int32       OS_Status = OS_SUCCESS;
+    const char * CmdText    = "Decompress File";
+    CFE_Status_t CFE_Status = CFE_SUCCESS;
 
     /* Report current child task activity */
-    FM_GlobalData.ChildCurrentCC = CmdArgs->CommandCode;
+    Worker->CurrentCC = CmdArgs->CommandCode;
 
-    OS_Status = OS_mkdir(CmdArgs->Source1, 0);
+    /* Decompress source file into target file (one child task at a time) */
+    OS_MutSemTake(FM_GlobalData.ChildDecompressSem);
+    CFE_Status = FM_Decompress_Impl(FM_GlobalData.DecompressorStatePtr, CmdArgs->Source1, CmdArgs->Target);
+    OS_MutSemGive(FM_GlobalData.ChildDecompressSem);
 
-    if (OS_Status != OS_SUCCESS)
+    if (CFE_Status != CFE_SUCCESS)
     {
-        FM_GlobalData.ChildCmdErrCounter++;
+        Worker->CmdErrCounter++;
 
         /* Send command failure event (error) */
-        CFE_EVS_SendEvent(FM_CREATE_DIR_OS_ERR_EID, CFE_EVS_EventType_ERROR,
-                          "%s error: OS_mkdir failed: result = %d, dir = %s", CmdText, (int)OS_Status,
-                          CmdArgs->Source1);
+        CFE_EVS_SendEvent(FM_DECOM_CFE_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "%s error: CFE_FS_Decompress failed: result = %d, src = %s, tgt = %s", CmdText,
+                          (int)CFE_Status, CmdArgs->Source1, CmdArgs->Target);
     }
     else
     {
-        FM_GlobalData.ChildCmdCounter++;
+        Worker->CmdCounter++;
 
         /* Send command completion event (info) */
-        CFE_EVS_SendEvent(FM_CREATE_DIR_CMD_INF_EID, CFE_EVS_EventType_INFORMATION, "%s command: src = %s", CmdText,
-                          CmdArgs->Source1);
+        CFE_EVS_SendEvent(FM_DECOM_CMD_INF_EID, CFE_EVS_EventType_INFORMATION, "%s command: src = %s, tgt = %s",
+                          CmdText, CmdArgs->Source1, CmdArgs->Target);
     }
 
     /* Report previous child task activity */
-    FM_GlobalData.ChildPreviousCC = CmdArgs->CommandCode;
-    FM_GlobalData.ChildCurrentCC  = 0;
+    Worker->PreviousCC = CmdArgs->CommandCode;
+    Worker->CurrentCC  = 0;
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* FM child task command handler -- Delete Directory               */
+/* FM child task command handler -- Concatenate Files              */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-void FM_ChildDeleteDirectoryCmd(const FM_ChildQueueEntry_t *CmdArgs)
+void FM_ChildConcatFilesCmd(FM_ChildWorker_t *Worker, const FM_ChildQueueEntry_t *CmdArgs)
 {
-    const char *CmdText      = "Delete Directory";
-    bool        RemoveTheDir = true;
-    osal_id_t   DirId        = OS_OBJECT_ID_UNDEFINED;
-    os_dirent_t DirEntry;
-    int32       OS_Status = OS_SUCCESS;
-
-    memset(&DirEntry, 0, sizeof(DirEntry));
+    const char *CmdText       = "Concat Files";
+    bool        ConcatResult  = false;
+    bool        Source1Copied = true;
+    int32       OS_Status     = OS_SUCCESS;
+    uint32      ResumeOffset  = 0;
 
     /* Report current child task activity */
-    FM_GlobalData.ChildCurrentCC = CmdArgs->CommandCode;
+    Worker->CurrentCC = CmdArgs->CommandCode;
 
-    /* Open the dir so we can see if it is empty */
-    OS_Status = OS_DirectoryOpen(&DirId, CmdArgs->Source1);
+    FM_ChildCheckpointBegin(Worker, CmdArgs);
 
-    if (OS_Status != OS_SUCCESS)
+    /* A concat resumed in source file #2 already holds source file #1 */
+    if ((Worker->Resuming == false) || (Worker->Checkpoint.SourceIndex == 0))
     {
-        CFE_EVS_SendEvent(FM_DELETE_OPENDIR_OS_ERR_EID, CFE_EVS_EventType_ERROR,
-                          "%s error: OS_DirectoryOpen failed: dir = %s", CmdText, CmdArgs->Source1);
+        /* Copy source file #1 to the target file */
+        Source1Copied = FM_ChildCopyFile(Worker, CmdArgs->Source1, CmdArgs->Target, FM_CONCAT_OSCPY_ERR_EID, CmdText);
+    }
 
-        RemoveTheDir = false;
-        FM_GlobalData.ChildCmdErrCounter++;
+    if (Source1Copied == false)
+    {
+        Worker->CmdErrCounter++;
     }
     else
     {
-        /* Look for a directory entry that is not "." or ".." */
-        while ((OS_DirectoryRead(DirId, &DirEntry) == OS_SUCCESS) && (RemoveTheDir == true))
+        if (FM_ChildCheckpointSource(Worker, 1, CmdArgs->Source2, CmdArgs->Target, CmdText, &ResumeOffset) == false)
         {
-            if ((strcmp(OS_DIRENTRY_NAME(DirEntry), FM_THIS_DIRECTORY) != 0) &&
-                (strcmp(OS_DIRENTRY_NAME(DirEntry), FM_PARENT_DIRECTORY) != 0))
-            {
-                CFE_EVS_SendEvent(FM_DELETE_DIR_EMPTY_ERR_EID, CFE_EVS_EventType_ERROR,
-                                  "%s error: directory is not empty: dir = %s", CmdText, CmdArgs->Source1);
-
-                RemoveTheDir = false;
-                FM_GlobalData.ChildCmdErrCounter++;
-            }
+            OS_Status = OS_ERROR;
         }
-
-        OS_DirectoryClose(DirId);
-    }
-
-    if (RemoveTheDir)
-    {
-        /* Remove the directory */
-        OS_Status = OS_rmdir(CmdArgs->Source1);
-
-        if (OS_Status != OS_SUCCESS)
+        else if (ResumeOffset == 0)
         {
-            /* Send command failure event (error) */
-            CFE_EVS_SendEvent(FM_DELETE_RMDIR_OS_ERR_EID, CFE_EVS_EventType_ERROR,
-                              "%s error: OS_rmdir failed: result = %d, dir = %s", CmdText, (int)OS_Status,
-                              CmdArgs->Source1);
-
-            FM_GlobalData.ChildCmdErrCounter++;
+            /* Let the kernel append source file #2 when the build includes a kernel copy method */
+            OS_Status = FM_ChildKernelCopy(Worker, CmdArgs->Source2, CmdArgs->Target, true, FM_CONCAT_OSWR_ERR_EID,
+                                           CmdText);
         }
         else
         {
-            /* Send command completion event (info) */
-            CFE_EVS_SendEvent(FM_DELETE_DIR_CMD_INF_EID, CFE_EVS_EventType_INFORMATION, "%s command: src = %s", CmdText,
-                              CmdArgs->Source1);
+            /* A resumed append is streamed from the checkpoint offset */
+            OS_Status = CFE_STATUS_NOT_IMPLEMENTED;
+        }
+
+        if (OS_Status == CFE_SUCCESS)
+        {
+            ConcatResult = true;
+        }
+        else if (OS_Status == CFE_STATUS_NOT_IMPLEMENTED)
+        {
+            ConcatResult = FM_ChildConcatAppend(Worker, CmdArgs, ResumeOffset, CmdText);
+        }
+
+        if (ConcatResult == true)
+        {
+            Worker->CmdCounter++;
+
+            /* Send command completion event (info) */
+            CFE_EVS_SendEvent(FM_CONCAT_CMD_INF_EID, CFE_EVS_EventType_INFORMATION,
+                              "%s command: src1 = %s, src2 = %s, tgt = %s", CmdText, CmdArgs->Source1,
+                              CmdArgs->Source2, CmdArgs->Target);
+        }
+        else
+        {
+            Worker->CmdErrCounter++;
 
-            FM_GlobalData.ChildCmdCounter++;
+            /* Remove partial target file after concat error */
+            OS_remove(CmdArgs->Target);
         }
     }
 
+    FM_ChildCheckpointEnd(Worker);
+
     /* Report previous child task activity */
-    FM_GlobalData.ChildPreviousCC = CmdArgs->CommandCode;
-    FM_GlobalData.ChildCurrentCC  = 0;
+    Worker->PreviousCC = CmdArgs->CommandCode;
+    Worker->CurrentCC  = 0;
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* FM child task command handler -- Get Directory List (to file)   */
+/* FM child task utility function -- append source #2 for concat   */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-void FM_ChildDirListFileCmd(const FM_ChildQueueEntry_t *CmdArgs)
+bool FM_ChildConcatAppend(FM_ChildWorker_t *Worker, const FM_ChildQueueEntry_t *CmdArgs, uint32 ResumeOffset,
+                          const char *CmdText)
 {
-    const char *CmdText    = "Directory List to File";
-    bool        Result     = false;
-    osal_id_t   FileHandle = OS_OBJECT_ID_UNDEFINED;
-    osal_id_t   DirId      = OS_OBJECT_ID_UNDEFINED;
-    int32       Status     = 0;
-
-    /* Report current child task activity */
-    FM_GlobalData.ChildCurrentCC = CmdArgs->CommandCode;
-
-    /*
-    ** Command argument usage for this command:
-    **
-    **  CmdArgs->CommandCode = FM_GET_DIR_LIST_FILE_CC
-    **  CmdArgs->Source1     = directory name
-    **  CmdArgs->Source2     = directory name plus separator
-    **  CmdArgs->Target      = output filename
-    */
+    bool      ConcatResult  = false;
+    bool      Positioned    = true;
+    int32     OS_Status     = OS_SUCCESS;
+    osal_id_t FileHandleSrc = OS_OBJECT_ID_UNDEFINED;
+    osal_id_t FileHandleTgt = OS_OBJECT_ID_UNDEFINED;
 
-    /* Open directory for reading directory list */
-    Status = OS_DirectoryOpen(&DirId, CmdArgs->Source1);
+    /* Open source file #2 */
+    OS_Status = OS_OpenCreate(&FileHandleSrc, CmdArgs->Source2, OS_FILE_FLAG_NONE, OS_READ_ONLY);
 
-    if (Status != OS_SUCCESS)
+    if (OS_Status != OS_SUCCESS)
     {
-        FM_GlobalData.ChildCmdErrCounter++;
-
         /* Send command failure event (error) */
-        CFE_EVS_SendEvent(FM_GET_DIR_FILE_OSOPENDIR_ERR_EID, CFE_EVS_EventType_ERROR,
-                          "%s error: OS_DirectoryOpen failed: dir = %s", CmdText, CmdArgs->Source1);
+        CFE_EVS_SendEvent(FM_CONCAT_OPEN_SRC2_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "%s error: OS_OpenCreate failed: result = %d, src2 = %s", CmdText, (int)OS_Status,
+                          CmdArgs->Source2);
     }
     else
     {
-        /* Create output file, write placeholder for statistics, etc. */
-        Result = FM_ChildDirListFileInit(&FileHandle, CmdArgs->Source1, CmdArgs->Target);
-        if (Result == true)
+        /* Open target file */
+        OS_Status = OS_OpenCreate(&FileHandleTgt, CmdArgs->Target, OS_FILE_FLAG_NONE, OS_READ_WRITE);
+
+        if (OS_Status != OS_SUCCESS)
         {
-            /* Read directory listing and write contents to output file */
-            FM_ChildDirListFileLoop(DirId, FileHandle, CmdArgs->Source1, CmdArgs->Source2, CmdArgs->Target,
-                                    CmdArgs->GetSizeTimeMode);
+            /* Send command failure event (error) */
+            CFE_EVS_SendEvent(FM_CONCAT_OPEN_TGT_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "%s error: OS_OpenCreate failed: result = %d, tgt = %s", CmdText, (int)OS_Status,
+                              CmdArgs->Target);
+        }
+        else
+        {
+            /* Append source file #2 to target file */
+            if (ResumeOffset == 0)
+            {
+                /* Seek to end of target file */
+                OS_lseek(FileHandleTgt, 0, OS_SEEK_END);
+            }
+            else
+            {
+                /* Continue both files at the checkpoint */
+                Positioned = FM_ChildCheckpointSeek(Worker, FileHandleSrc, FileHandleTgt, CmdText);
+            }
 
-            /* Close output file */
-            OS_close(FileHandle);
+            if (Positioned == true)
+            {
+                ConcatResult = FM_ChildCopyStream(Worker, FileHandleSrc, FileHandleTgt, CmdArgs->Source2,
+                                                  CmdArgs->Target, FM_CONCAT_OSRD_ERR_EID, FM_CONCAT_OSWR_ERR_EID,
+                                                  CmdText);
+            }
+
+            /* Close target file */
+            OS_close(FileHandleTgt);
         }
 
-        /* Close directory list access handle */
-        OS_DirectoryClose(DirId);
+        /* Close source file #2 */
+        OS_close(FileHandleSrc);
     }
 
-    /* Report previous child task activity */
-    FM_GlobalData.ChildPreviousCC = CmdArgs->CommandCode;
-    FM_GlobalData.ChildCurrentCC  = 0;
+    return ConcatResult;
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* FM child task command handler -- Get Directory List (to pkt)    */
+/* FM child task command handler -- Concatenate List of Files      */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-void FM_ChildDirListPktCmd(const FM_ChildQueueEntry_t *CmdArgs)
+void FM_ChildConcatListCmd(FM_ChildWorker_t *Worker, const FM_ChildQueueEntry_t *CmdArgs)
 {
-    const char *       CmdText                      = "Directory List to Packet";
-    char               LogicalName[OS_MAX_PATH_LEN] = "\0";
-    bool               StillProcessing              = true;
-    osal_id_t          DirId                        = OS_OBJECT_ID_UNDEFINED;
-    os_dirent_t        DirEntry;
-    int32              ListIndex      = 0;
-    FM_DirListEntry_t *ListEntry      = NULL;
-    size_t             PathLength     = 0;
-    size_t             EntryLength    = 0;
-    int32              FilesTillSleep = FM_CHILD_STAT_SLEEP_FILECOUNT;
-    int32              Status;
+    const char *CmdText       = "Concat List";
+    bool        ConcatResult  = false;
+    bool        ListFinished  = false;
+    int32       OS_Status     = OS_SUCCESS;
+    osal_id_t   FileHandleTgt = OS_OBJECT_ID_UNDEFINED;
+    uint32      TargetFlags   = OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE;
+    uint32      SourceCount   = 0;
+    char        Source[OS_MAX_PATH_LEN];
 
-    FM_DirListPkt_Payload_t *ReportPtr;
+    /* Report current child task activity */
+    Worker->CurrentCC = CmdArgs->CommandCode;
 
-    memset(&DirEntry, 0, sizeof(DirEntry));
+    Worker->CopyBytes = 0;
 
-    /* Report current child task activity */
-    FM_GlobalData.ChildCurrentCC = CmdArgs->CommandCode;
+    FM_ChildCheckpointBegin(Worker, CmdArgs);
 
-    /*
-    ** Command argument usage for this command:
-    **
-    **  CmdArgs->CommandCode   = FM_GET_DIR_LIST_PKT_CC
-    **  CmdArgs->Source1       = directory name
-    **  CmdArgs->Source2       = directory name plus separator
-    **  CmdArgs->DirListOffset = index of 1st reported dir entry
-    */
-    PathLength = strlen(CmdArgs->Source2);
+    /* A resumed list keeps the sources already in the target file */
+    if (Worker->Resuming)
+    {
+        TargetFlags = OS_FILE_FLAG_NONE;
+    }
 
-    /* Open source directory for reading directory list */
-    Status = OS_DirectoryOpen(&DirId, CmdArgs->Source1);
+    /* Inline source names are parsed where they are, a list file is read through the I/O buffer */
+    Worker->ConcatListFile   = OS_OBJECT_ID_UNDEFINED;
+    Worker->ConcatListText   = CmdArgs->SourceList;
+    Worker->ConcatListLength = strlen(CmdArgs->SourceList);
+    Worker->ConcatListOffset = 0;
 
-    if (Status != OS_SUCCESS)
+    if (CmdArgs->Source1[0] != '\0')
     {
-        FM_GlobalData.ChildCmdErrCounter++;
+        Worker->ConcatListLength = 0;
 
-        /* Send command failure event (error) */
-        CFE_EVS_SendEvent(FM_GET_DIR_PKT_OS_ERR_EID, CFE_EVS_EventType_ERROR,
-                          "%s error: OS_DirectoryOpen failed: dir = %s", CmdText, CmdArgs->Source1);
+        OS_Status = OS_OpenCreate(&Worker->ConcatListFile, CmdArgs->Source1, OS_FILE_FLAG_NONE, OS_READ_ONLY);
+
+        if (OS_Status != OS_SUCCESS)
+        {
+            Worker->ConcatListFile = OS_OBJECT_ID_UNDEFINED;
+
+            /* Send command failure event (error) */
+            CFE_EVS_SendEvent(FM_CONCAT_LIST_OPEN_LIST_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "%s error: OS_OpenCreate failed: result = %d, list = %s", CmdText, (int)OS_Status,
+                              CmdArgs->Source1);
+        }
+    }
+
+    if (OS_Status == OS_SUCCESS)
+    {
+        /* Create the target file once for the whole list */
+        OS_Status = OS_OpenCreate(&FileHandleTgt, CmdArgs->Target, TargetFlags, OS_WRITE_ONLY);
+
+        if (OS_Status != OS_SUCCESS)
+        {
+            /* Send command failure event (error) */
+            CFE_EVS_SendEvent(FM_CONCAT_LIST_OPEN_TGT_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "%s error: OS_OpenCreate failed: result = %d, tgt = %s", CmdText, (int)OS_Status,
+                              CmdArgs->Target);
+        }
+        else
+        {
+            ConcatResult = true;
+
+            /* Stream each source file onto the end of the target file in list order */
+            while ((ConcatResult == true) && (ListFinished == false))
+            {
+                OS_Status = FM_ChildConcatListNext(Worker, Source, sizeof(Source));
+
+                if (OS_Status != OS_SUCCESS)
+                {
+                    ConcatResult = false;
+
+                    /* Send command failure event (error) */
+                    CFE_EVS_SendEvent(FM_CONCAT_LIST_READ_LIST_ERR_EID, CFE_EVS_EventType_ERROR,
+                                      "%s error: source list read failed: result = %d, source = %d", CmdText,
+                                      (int)OS_Status, (int)(SourceCount + 1));
+                }
+                else if (Source[0] == '\0')
+                {
+                    ListFinished = true;
+                }
+                else if (strcmp(Source, CmdArgs->Target) == 0)
+                {
+                    ConcatResult = false;
+
+                    /* Send command failure event (error) */
+                    CFE_EVS_SendEvent(FM_CONCAT_LIST_READ_LIST_ERR_EID, CFE_EVS_EventType_ERROR,
+                                      "%s error: source list names the target: tgt = %s", CmdText, CmdArgs->Target);
+                }
+                else if ((Worker->Resuming == true) && (SourceCount < Worker->Checkpoint.SourceIndex))
+                {
+                    /* Skip the sources copied before the checkpoint */
+                    SourceCount++;
+                }
+                else
+                {
+                    ConcatResult = FM_ChildConcatListSource(Worker, FileHandleTgt, Source, SourceCount, CmdArgs->Target,
+                                                            CmdText);
+                    SourceCount++;
+                }
+            }
+
+            if ((ConcatResult == true) && (SourceCount == 0))
+            {
+                ConcatResult = false;
+
+                /* Send command failure event (error) */
+                CFE_EVS_SendEvent(FM_CONCAT_LIST_READ_LIST_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "%s error: source list is empty: tgt = %s", CmdText, CmdArgs->Target);
+            }
+            else if ((ConcatResult == true) && (Worker->Resuming == true))
+            {
+                ConcatResult = false;
+
+                /* Send command failure event (error) */
+                CFE_EVS_SendEvent(FM_CHILD_CHECKPOINT_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "%s error: source list ends before checkpoint: source = %d, tgt = %s", CmdText,
+                                  (int)(Worker->Checkpoint.SourceIndex + 1), CmdArgs->Target);
+            }
+
+            /* Close target file */
+            OS_close(FileHandleTgt);
+
+            if (ConcatResult == false)
+            {
+                /* Remove partial target file after concat error */
+                OS_remove(CmdArgs->Target);
+            }
+        }
+    }
+
+    if (OS_ObjectIdDefined(Worker->ConcatListFile))
+    {
+        /* Close source list file */
+        OS_close(Worker->ConcatListFile);
+        Worker->ConcatListFile = OS_OBJECT_ID_UNDEFINED;
+    }
+
+    if (ConcatResult == true)
+    {
+        Worker->CmdCounter++;
+
+        /* Send command completion event (info) */
+        CFE_EVS_SendEvent(FM_CONCAT_LIST_CMD_INF_EID, CFE_EVS_EventType_INFORMATION,
+                          "%s command: sources = %d, bytes = %lu, tgt = %s", CmdText, (int)SourceCount,
+                          (unsigned long)Worker->CopyBytes, CmdArgs->Target);
     }
     else
     {
-        /* Initialize the directory list telemetry packet */
-        CFE_MSG_Init(CFE_MSG_PTR(FM_GlobalData.DirListPkt.TelemetryHeader), CFE_SB_ValueToMsgId(FM_DIR_LIST_TLM_MID),
-                     sizeof(FM_DirListPkt_t));
+        Worker->CmdErrCounter++;
+    }
 
-        ReportPtr = &FM_GlobalData.DirListPkt.Payload;
+    FM_ChildCheckpointEnd(Worker);
 
-        strncpy(ReportPtr->DirName, CmdArgs->Source1, OS_MAX_PATH_LEN - 1);
-        ReportPtr->DirName[OS_MAX_PATH_LEN - 1] = '\0';
-        ReportPtr->FirstFile                    = CmdArgs->DirListOffset;
+    /* Report previous child task activity */
+    Worker->PreviousCC = CmdArgs->CommandCode;
+    Worker->CurrentCC  = 0;
+}
 
-        StillProcessing = true;
-        while (StillProcessing == true)
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- next concat list source name  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+int32 FM_ChildConcatListNext(FM_ChildWorker_t *Worker, char *Source, uint32 BufferSize)
+{
+    int32  Result     = OS_SUCCESS;
+    int32  BytesRead  = 0;
+    bool   Searching  = true;
+    uint32 NameLength = 0;
+    char   NextChar;
+
+    while (Searching)
+    {
+        if (Worker->ConcatListOffset >= Worker->ConcatListLength)
         {
-            /* Read next directory entry */
-            Status = OS_DirectoryRead(DirId, &DirEntry);
+            /* Inline lists are parsed in one piece, list files are refilled until the end */
+            BytesRead = 0;
 
-            if (Status != OS_SUCCESS)
+            if (OS_ObjectIdDefined(Worker->ConcatListFile))
             {
-                /* Stop reading directory - no more entries */
-                StillProcessing = false;
+                BytesRead = OS_read(Worker->ConcatListFile, Worker->Buffer, sizeof(Worker->Buffer));
             }
-            else if ((strcmp(OS_DIRENTRY_NAME(DirEntry), FM_THIS_DIRECTORY) != 0) &&
-                     (strcmp(OS_DIRENTRY_NAME(DirEntry), FM_PARENT_DIRECTORY) != 0))
+
+            if (BytesRead > 0)
             {
-                /* Do not count the "." and ".." directory entries */
-                ReportPtr->TotalFiles++;
+                Worker->ConcatListText   = Worker->Buffer;
+                Worker->ConcatListLength = BytesRead;
+                Worker->ConcatListOffset = 0;
+            }
+            else
+            {
+                /* End of the list (the last name need not end with a newline) or read error */
+                Result    = BytesRead;
+                Searching = false;
+            }
+        }
+        else
+        {
+            NextChar = Worker->ConcatListText[Worker->ConcatListOffset];
+            Worker->ConcatListOffset++;
 
-                /* Start collecting directory entries at command-specified offset */
-                /* Stop collecting directory entries when telemetry packet is full */
-                if ((ReportPtr->TotalFiles > ReportPtr->FirstFile) &&
-                    (ReportPtr->PacketFiles < FM_DIR_LIST_PKT_ENTRIES))
-                {
-                    /* Create a shorthand access to the packet list entry */
-                    ListIndex = ReportPtr->PacketFiles;
-                    ListEntry = &ReportPtr->FileList[ListIndex];
+            if ((NextChar == '\n') || (NextChar == '\0'))
+            {
+                /* Blank lines are skipped */
+                Searching = (NameLength == 0);
+            }
+            else if (NextChar == '\r')
+            {
+                /* Ignore carriage returns of list files written with CRLF line endings */
+            }
+            else if (NameLength < (BufferSize - 1))
+            {
+                Source[NameLength] = NextChar;
+                NameLength++;
+            }
+            else
+            {
+                Result    = OS_FS_ERR_PATH_TOO_LONG;
+                Searching = false;
+            }
+        }
+    }
 
-                    EntryLength = strlen(OS_DIRENTRY_NAME(DirEntry));
+    /* An empty name marks the end of the list */
+    Source[NameLength] = '\0';
 
-                    /* Verify combined directory plus filename length */
-                    if ((PathLength + EntryLength) < sizeof(LogicalName))
-                    {
-                        /* Add filename to directory listing telemetry packet */
-                        strncpy(ListEntry->EntryName, OS_DIRENTRY_NAME(DirEntry), sizeof(ListEntry->EntryName) - 1);
-                        ListEntry->EntryName[sizeof(ListEntry->EntryName) - 1] = '\0';
+    return Result;
+}
 
-                        /* Build filename - Directory already has path separator */
-                        memcpy(LogicalName, CmdArgs->Source2, PathLength);
-                        memcpy(&LogicalName[PathLength], OS_DIRENTRY_NAME(DirEntry), EntryLength);
-                        LogicalName[PathLength + EntryLength] = '\0';
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- append one concat list source */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-                        FM_ChildSleepStat(LogicalName, ListEntry, &FilesTillSleep, CmdArgs->GetSizeTimeMode);
+bool FM_ChildConcatListSource(FM_ChildWorker_t *Worker, osal_id_t FileHandleTgt, const char *Source, uint32 SourceIndex,
+                              const char *Target, const char *CmdText)
+{
+    bool      ConcatResult  = false;
+    bool      Positioned    = false;
+    int32     OS_Status     = OS_SUCCESS;
+    osal_id_t FileHandleSrc = OS_OBJECT_ID_UNDEFINED;
+    uint32    ResumeOffset  = 0;
 
-                        /* Add another entry to the telemetry packet */
-                        ReportPtr->PacketFiles++;
-                    }
-                    else
-                    {
-                        FM_GlobalData.ChildCmdWarnCounter++;
+    /* Open source file */
+    OS_Status = OS_OpenCreate(&FileHandleSrc, Source, OS_FILE_FLAG_NONE, OS_READ_ONLY);
 
-                        /* Send command warning event (info) */
-                        CFE_EVS_SendEvent(FM_GET_DIR_PKT_WARNING_EID, CFE_EVS_EventType_INFORMATION,
-                                          "%s warning: dir + entry is too long: dir = %s, entry = %s", CmdText,
-                                          CmdArgs->Source2, OS_DIRENTRY_NAME(DirEntry));
-                    }
-                }
-            }
+    if (OS_Status != OS_SUCCESS)
+    {
+        /* Send command failure event (error) */
+        CFE_EVS_SendEvent(FM_CONCAT_LIST_OPEN_SRC_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "%s error: OS_OpenCreate failed: result = %d, src = %s", CmdText, (int)OS_Status, Source);
+    }
+    else
+    {
+        Positioned = FM_ChildCheckpointSource(Worker, SourceIndex, Source, Target, CmdText, &ResumeOffset);
+
+        if ((Positioned == true) && (ResumeOffset != 0))
+        {
+            /* Continue both files at the checkpoint */
+            Positioned = FM_ChildCheckpointSeek(Worker, FileHandleSrc, FileHandleTgt, CmdText);
         }
 
-        OS_DirectoryClose(DirId);
+        if (Positioned == true)
+        {
+            /* The target file stays open and positioned at its end between sources */
+            ConcatResult = FM_ChildCopyStream(Worker, FileHandleSrc, FileHandleTgt, Source, Target,
+                                              FM_CONCAT_LIST_OSRD_ERR_EID, FM_CONCAT_LIST_OSWR_ERR_EID, CmdText);
+        }
+
+        /* Close source file */
+        OS_close(FileHandleSrc);
+    }
 
-        /* Timestamp and send directory listing telemetry packet */
-        CFE_SB_TimeStampMsg(CFE_MSG_PTR(FM_GlobalData.DirListPkt.TelemetryHeader));
-        CFE_SB_TransmitMsg(CFE_MSG_PTR(FM_GlobalData.DirListPkt.TelemetryHeader), true);
+    return ConcatResult;
+}
 
-        /* Send command completion event (info) */
-        CFE_EVS_SendEvent(FM_GET_DIR_PKT_CMD_INF_EID, CFE_EVS_EventType_INFORMATION,
-                          "%s command: offset = %d, dir = %s", CmdText, (int)CmdArgs->DirListOffset, CmdArgs->Source1);
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task command handler -- Get File Info                  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_ChildFileInfoCmd(FM_ChildWorker_t *Worker, FM_ChildQueueEntry_t *CmdArgs)
+{
+    const char *       CmdText    = "Get File Info";
+    bool               GettingCRC = false;
+    bool               Appended   = false;
+    uint32             CurrentCRC = 0;
+    uint32             StartTime  = 0;
+    int32              BytesRead  = 0;
+    osal_id_t          FileHandle = OS_OBJECT_ID_UNDEFINED;
+    int32              Status     = 0;
+    OS_time_t          LocalTime;
+    FM_CrcCacheEntry_t Base;
+
+    FM_FileInfoPkt_Payload_t *ReportPtr;
+
+    /* Report current child task activity */
+    Worker->CurrentCC = CmdArgs->CommandCode;
+
+    /*
+    ** Command argument usage for this command:
+    **
+    **  CmdArgs->CommandCode   = FM_GET_DIR_LIST_FILE_CC
+    **  CmdArgs->Source1       = name of directory or file
+    **  CmdArgs->FileInfoState = state of directory or file
+    **  CmdArgs->FileInfoSize  = file size, else zero
+    **  CmdArgs->FileInfoTime  = last modify time
+    */
+
+    /* Initialize file info packet (set all data to zero) */
+    CFE_MSG_Init(CFE_MSG_PTR(Worker->FileInfoPkt.TelemetryHeader), CFE_SB_ValueToMsgId(FM_FILE_INFO_TLM_MID),
+                 sizeof(FM_FileInfoPkt_t));
+
+    ReportPtr = &Worker->FileInfoPkt.Payload;
+
+    /* Report directory or filename state, name, size and time */
+    ReportPtr->FileStatus = (uint8)CmdArgs->FileInfoState;
+    strncpy(ReportPtr->Filename, CmdArgs->Source1, OS_MAX_PATH_LEN - 1);
+    ReportPtr->Filename[OS_MAX_PATH_LEN - 1] = '\0';
+
+    ReportPtr->FileSize         = CmdArgs->FileInfoSize;
+    ReportPtr->LastModifiedTime = CmdArgs->FileInfoTime;
+    ReportPtr->Mode             = CmdArgs->Mode;
+
+    /* Validate CRC algorithm */
+    if (CmdArgs->FileInfoCRC != FM_IGNORE_CRC)
+    {
+        if (CmdArgs->FileInfoState != FM_NAME_IS_FILE_CLOSED)
+        {
+            /* Can only calculate CRC for closed files */
+            Worker->CmdWarnCounter++;
+
+            CFE_EVS_SendEvent(FM_GET_FILE_INFO_STATE_WARNING_EID, CFE_EVS_EventType_INFORMATION,
+                              "%s warning: unable to compute CRC: invalid file state = %d, file = %s", CmdText,
+                              (int)CmdArgs->FileInfoState, CmdArgs->Source1);
+
+            CmdArgs->FileInfoCRC = FM_IGNORE_CRC;
+        }
+        else if ((CmdArgs->FileInfoCRC != CFE_ES_CrcType_CRC_8) && (CmdArgs->FileInfoCRC != CFE_ES_CrcType_CRC_16) &&
+                 (CmdArgs->FileInfoCRC != CFE_ES_CrcType_CRC_32))
+        {
+            /* Can only calculate CRC using known algorithms */
+            Worker->CmdWarnCounter++;
+
+            CFE_EVS_SendEvent(FM_GET_FILE_INFO_TYPE_WARNING_EID, CFE_EVS_EventType_INFORMATION,
+                              "%s warning: unable to compute CRC: invalid CRC type = %d, file = %s", CmdText,
+                              (int)CmdArgs->FileInfoCRC, CmdArgs->Source1);
+
+            CmdArgs->FileInfoCRC = FM_IGNORE_CRC;
+        }
+    }
+
+    /* An unchanged file does not need to be read again */
+    if ((CmdArgs->FileInfoCRC != FM_IGNORE_CRC) && (FM_ChildCrcCacheLookup(CmdArgs, &CurrentCRC)))
+    {
+        FM_ATOMIC_ADD(&FM_GlobalData.CrcCacheHits, 1);
+
+        /* Add CRC to telemetry packet */
+        ReportPtr->CRC_Computed = true;
+        ReportPtr->CRC          = CurrentCRC;
+
+        CmdArgs->FileInfoCRC = FM_IGNORE_CRC;
+    }
+
+    /* Compute CRC */
+    if (CmdArgs->FileInfoCRC != FM_IGNORE_CRC)
+    {
+        FM_ATOMIC_ADD(&FM_GlobalData.CrcCacheMisses, 1);
+
+        /* Writes from now on change the modify time, see FM_ChildCrcCacheStore */
+        OS_GetLocalTime(&LocalTime);
+        StartTime = (uint32)OS_TimeGetTotalSeconds(LocalTime);
+
+        Worker->ProgressTotal = CmdArgs->FileInfoSize;
+        Worker->CrcLastBytes  = 0;
+
+        /* A file that only grew since its CRC was kept is read on from the kept size */
+        Appended = FM_ChildCrcCacheBase(CmdArgs, &Base);
+
+        /* Any other large file is split between the CRC helper tasks */
+        Status = CFE_STATUS_NOT_IMPLEMENTED;
+
+        if (Appended == false)
+        {
+            Status = FM_ChildCrcParallel(Worker, CmdArgs, &CurrentCRC);
+        }
+
+        if (Status == OS_SUCCESS)
+        {
+            /* Add CRC to telemetry packet */
+            ReportPtr->CRC_Computed = true;
+
+            FM_ChildCrcCacheStore(Worker, CmdArgs, CurrentCRC, StartTime);
+        }
+        else if (Status != CFE_STATUS_NOT_IMPLEMENTED)
+        {
+            /* Stop without reporting a partial CRC */
+            CurrentCRC = 0;
+
+            if (Worker->Aborted == false)
+            {
+                /* Send CRC failure event (warning) */
+                Worker->CmdWarnCounter++;
+                CFE_EVS_SendEvent(FM_GET_FILE_INFO_READ_WARNING_EID, CFE_EVS_EventType_INFORMATION,
+                                  "%s warning: unable to compute CRC: OS_read result = %d, file = %s", CmdText,
+                                  (int)Status, CmdArgs->Source1);
+            }
+        }
+        else
+        {
+            Status = OS_OpenCreate(&FileHandle, CmdArgs->Source1, OS_FILE_FLAG_NONE, OS_READ_ONLY);
+
+            if (Status != OS_SUCCESS)
+            {
+                Worker->CmdWarnCounter++;
+
+                /* Send CRC failure event (warning) */
+                CFE_EVS_SendEvent(FM_GET_FILE_INFO_OPEN_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "%s warning: unable to compute CRC: OS_OpenCreate result = %d, file = %s", CmdText,
+                                  (int)Status, CmdArgs->Source1);
+            }
+            else
+            {
+                GettingCRC = true;
+
+                if (Appended)
+                {
+                    Status = FM_ChildCrcResume(Worker, FileHandle, &Base);
+                }
+
+                if ((Appended) && (Status == OS_SUCCESS))
+                {
+                    CurrentCRC = Base.Crc;
+
+                    FM_ATOMIC_ADD(&FM_GlobalData.CrcAppendCount, 1);
+                }
+                else if ((Appended) && (Status != CFE_STATUS_NOT_IMPLEMENTED))
+                {
+                    GettingCRC = false;
+                    OS_close(FileHandle);
+
+                    /* Send CRC failure event (warning) */
+                    Worker->CmdWarnCounter++;
+                    CFE_EVS_SendEvent(FM_GET_FILE_INFO_READ_WARNING_EID, CFE_EVS_EventType_INFORMATION,
+                                      "%s warning: unable to compute CRC: OS_lseek result = %d, file = %s", CmdText,
+                                      (int)Status, CmdArgs->Source1);
+                }
+            }
+        }
+
+        while (GettingCRC)
+        {
+            BytesRead = OS_read(FileHandle, Worker->Buffer, FM_CHILD_FILE_BLOCK_SIZE);
+
+            if (BytesRead == 0)
+            {
+                /* Finished reading file */
+                GettingCRC = false;
+                OS_close(FileHandle);
+
+                /* Add CRC to telemetry packet */
+                ReportPtr->CRC_Computed = true;
+                ReportPtr->CRC          = CurrentCRC;
+
+                FM_ChildCrcCacheStore(Worker, CmdArgs, CurrentCRC, StartTime);
+            }
+            else if (BytesRead < 0)
+            {
+                /* Error reading file */
+                CurrentCRC = 0;
+                GettingCRC = false;
+                OS_close(FileHandle);
+
+                /* Send CRC failure event (warning) */
+                Worker->CmdWarnCounter++;
+                CFE_EVS_SendEvent(FM_GET_FILE_INFO_READ_WARNING_EID, CFE_EVS_EventType_INFORMATION,
+                                  "%s warning: unable to compute CRC: OS_read result = %d, file = %s", CmdText,
+                                  (int)BytesRead, CmdArgs->Source1);
+            }
+            else if (FM_ChildAbortCheck(Worker, CmdText))
+            {
+                /* Stop without reporting a partial CRC */
+                CurrentCRC = 0;
+                GettingCRC = false;
+                OS_close(FileHandle);
+            }
+            else
+            {
+                /* Continue CRC calculation */
+                CurrentCRC = FM_CalculateCRC(&FM_GlobalData.Crc, Worker->Buffer, BytesRead, CurrentCRC,
+                                             CmdArgs->FileInfoCRC);
+                Worker->ProgressBytes += BytesRead;
+                Worker->CrcLastBytes = BytesRead;
+
+                /* Avoid hogging the CPU and the volume */
+                FM_ChildThrottle(CmdArgs->Source1, NULL, BytesRead, 0);
+            }
+        }
+
+        ReportPtr->CRC = CurrentCRC;
+    }
+
+    if (Worker->Aborted)
+    {
+        Worker->CmdErrCounter++;
+    }
+    else
+    {
+        /* Timestamp and send file info telemetry packet */
+        CFE_SB_TimeStampMsg(CFE_MSG_PTR(Worker->FileInfoPkt.TelemetryHeader));
+        CFE_SB_TransmitMsg(CFE_MSG_PTR(Worker->FileInfoPkt.TelemetryHeader), true);
+
+        Worker->CmdCounter++;
+
+        /* Send command completion event (info) */
+        CFE_EVS_SendEvent(FM_GET_FILE_INFO_CMD_INF_EID, CFE_EVS_EventType_INFORMATION, "%s command: file = %s",
+                          CmdText, CmdArgs->Source1);
+    }
+
+    /* Report previous child task activity */
+    Worker->PreviousCC = CmdArgs->CommandCode;
+    Worker->CurrentCC  = 0;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- look up a file CRC            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_ChildCrcCacheLookup(const FM_ChildQueueEntry_t *CmdArgs, uint32 *Crc)
+{
+    bool                Found = false;
+    FM_CrcCacheEntry_t *Entry = NULL;
+    uint32              i;
+
+    OS_MutSemTake(FM_GlobalData.ChildCrcCacheSem);
+
+    for (i = 0; (i < FM_CHILD_CRC_CACHE_ENTRIES) && (Found == false); i++)
+    {
+        Entry = &FM_GlobalData.CrcCache[i];
+
+        if ((Entry->Size == CmdArgs->FileInfoSize) && (Entry->Time == CmdArgs->FileInfoTime) &&
+            (Entry->CrcType == CmdArgs->FileInfoCRC) && (strcmp(Entry->Path, CmdArgs->Source1) == 0))
+        {
+            *Crc           = Entry->Crc;
+            Entry->LastUse = FM_GlobalData.CrcCacheClock++;
+
+            Found = true;
+        }
+    }
+
+    OS_MutSemGive(FM_GlobalData.ChildCrcCacheSem);
+
+    return Found;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- keep a file CRC               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_ChildCrcCacheStore(FM_ChildWorker_t *Worker, const FM_ChildQueueEntry_t *CmdArgs, uint32 Crc, uint32 StartTime)
+{
+    FM_CrcCacheEntry_t *Entry       = NULL;
+    uint32              MatchIndex  = FM_CHILD_CRC_CACHE_ENTRIES;
+    uint32              FreeIndex   = FM_CHILD_CRC_CACHE_ENTRIES;
+    uint32              LruIndex    = 0;
+    uint32              LruAge      = 0;
+    uint32              CheckLength = 0;
+    uint32              HeadCrc     = 0;
+    uint32              CheckCrc    = 0;
+    uint32              i;
+
+    /*
+    ** Modify times are kept in whole seconds.  A file modified in the same
+    **  second as its CRC started to be read may be written again without
+    **  changing its modify time, so its CRC is not kept.  Nor is the CRC of
+    **  a file that was not the size it was verified at when read.
+    */
+    if ((CmdArgs->FileInfoTime < StartTime) && (Worker->ProgressBytes == CmdArgs->FileInfoSize))
+    {
+        /* The CRCs of the first and last block tell an appended file from a rewritten one */
+        if ((CmdArgs->FileInfoCRC == CFE_ES_CrcType_CRC_16) && (CmdArgs->FileInfoSize > 0))
+        {
+            CheckLength = FM_CHILD_FILE_BLOCK_SIZE;
+
+            if (CmdArgs->FileInfoSize < FM_CHILD_FILE_BLOCK_SIZE)
+            {
+                CheckLength = CmdArgs->FileInfoSize;
+            }
+
+            if (FM_ChildCrcCheckWindows(Worker, CmdArgs->Source1, CmdArgs->FileInfoSize, CheckLength, &HeadCrc,
+                                        &CheckCrc) == false)
+            {
+                CheckLength = 0;
+            }
+        }
+
+        OS_MutSemTake(FM_GlobalData.ChildCrcCacheSem);
+
+        for (i = 0; i < FM_CHILD_CRC_CACHE_ENTRIES; i++)
+        {
+            Entry = &FM_GlobalData.CrcCache[i];
+
+            if (Entry->Path[0] == '\0')
+            {
+                if (FreeIndex == FM_CHILD_CRC_CACHE_ENTRIES)
+                {
+                    FreeIndex = i;
+                }
+            }
+            else if ((Entry->CrcType == CmdArgs->FileInfoCRC) && (strcmp(Entry->Path, CmdArgs->Source1) == 0))
+            {
+                MatchIndex = i;
+            }
+            else if ((FM_GlobalData.CrcCacheClock - Entry->LastUse) >= LruAge)
+            {
+                LruAge   = FM_GlobalData.CrcCacheClock - Entry->LastUse;
+                LruIndex = i;
+            }
+        }
+
+        /* An older CRC of the same file is replaced first, then a free entry, then the least recently used */
+        if (MatchIndex < FM_CHILD_CRC_CACHE_ENTRIES)
+        {
+            Entry = &FM_GlobalData.CrcCache[MatchIndex];
+        }
+        else if (FreeIndex < FM_CHILD_CRC_CACHE_ENTRIES)
+        {
+            Entry = &FM_GlobalData.CrcCache[FreeIndex];
+        }
+        else
+        {
+            Entry = &FM_GlobalData.CrcCache[LruIndex];
+        }
+
+        strncpy(Entry->Path, CmdArgs->Source1, OS_MAX_PATH_LEN - 1);
+        Entry->Path[OS_MAX_PATH_LEN - 1] = '\0';
+
+        Entry->Size    = CmdArgs->FileInfoSize;
+        Entry->Time    = CmdArgs->FileInfoTime;
+        Entry->CrcType = CmdArgs->FileInfoCRC;
+        Entry->Crc     = Crc;
+        Entry->LastUse = FM_GlobalData.CrcCacheClock++;
+
+        Entry->CheckLength = CheckLength;
+        Entry->HeadCrc     = HeadCrc;
+        Entry->CheckCrc    = CheckCrc;
+
+        OS_MutSemGive(FM_GlobalData.ChildCrcCacheSem);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- find the CRC of a grown file  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_ChildCrcCacheBase(const FM_ChildQueueEntry_t *CmdArgs, FM_CrcCacheEntry_t *Base)
+{
+    bool                Found = false;
+    FM_CrcCacheEntry_t *Entry = NULL;
+    uint32              i;
+
+    /* Only CRC-16 is computed the same way by FM and cFE, and can be continued */
+    if (CmdArgs->FileInfoCRC == CFE_ES_CrcType_CRC_16)
+    {
+        OS_MutSemTake(FM_GlobalData.ChildCrcCacheSem);
+
+        for (i = 0; (i < FM_CHILD_CRC_CACHE_ENTRIES) && (Found == false); i++)
+        {
+            Entry = &FM_GlobalData.CrcCache[i];
+
+            /* A file that is no larger, or has an older modify time, has been rewritten */
+            if ((Entry->CheckLength > 0) && (Entry->Size < CmdArgs->FileInfoSize) &&
+                (Entry->Time <= CmdArgs->FileInfoTime) && (Entry->CrcType == CmdArgs->FileInfoCRC) &&
+                (strcmp(Entry->Path, CmdArgs->Source1) == 0))
+            {
+                memcpy(Base, Entry, sizeof(*Base));
+                Entry->LastUse = FM_GlobalData.CrcCacheClock++;
+
+                Found = true;
+            }
+        }
+
+        OS_MutSemGive(FM_GlobalData.ChildCrcCacheSem);
+    }
+
+    return Found;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- continue the CRC of a file    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+int32 FM_ChildCrcResume(FM_ChildWorker_t *Worker, osal_id_t FileHandle, const FM_CrcCacheEntry_t *Base)
+{
+    int32  Status     = CFE_STATUS_NOT_IMPLEMENTED;
+    int32  SeekResult = 0;
+    uint32 Crc        = 0;
+    bool   Appended   = false;
+
+    /* The file was only appended to if its first block and the block that ended it still hold the same bytes */
+    if ((FM_ChildCrcCheckRead(Worker, FileHandle, 0, Base->CheckLength, &Crc)) && (Crc == Base->HeadCrc))
+    {
+        Appended = FM_ChildCrcCheckRead(Worker, FileHandle, Base->Size - Base->CheckLength, Base->CheckLength, &Crc);
+    }
+
+    if ((Appended) && (Crc == Base->CheckCrc))
+    {
+        /* The file position is now the end of the kept CRC */
+        Status = OS_SUCCESS;
+
+        Worker->ProgressBytes = Base->Size;
+        Worker->CrcLastBytes  = Base->CheckLength;
+    }
+    else
+    {
+        /* Read the whole file again */
+        SeekResult = OS_lseek(FileHandle, 0, OS_SEEK_SET);
+
+        if (SeekResult != 0)
+        {
+            Status = SeekResult;
+        }
+    }
+
+    return Status;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- CRCs of the first/last block  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_ChildCrcCheckWindows(FM_ChildWorker_t *Worker, const char *Filename, uint32 Size, uint32 Length,
+                             uint32 *HeadCrc, uint32 *TailCrc)
+{
+    bool      HeadKept   = false;
+    bool      TailKept   = false;
+    osal_id_t FileHandle = OS_OBJECT_ID_UNDEFINED;
+
+    /* The last read is still in the buffer, and ends at the file size, when it filled the window */
+    if (Worker->CrcLastBytes == Length)
+    {
+        *TailCrc = FM_CalculateCRC(&FM_GlobalData.Crc, Worker->Buffer, Length, 0, CFE_ES_CrcType_CRC_16);
+        TailKept = true;
+
+        /* A file no larger than one block is its own first block */
+        if (Length == Size)
+        {
+            *HeadCrc = *TailCrc;
+            HeadKept = true;
+        }
+    }
+
+    /* Anything else is read again, a short final read is not enough to tell a rewritten file */
+    if ((HeadKept == false) && (OS_OpenCreate(&FileHandle, Filename, OS_FILE_FLAG_NONE, OS_READ_ONLY) == OS_SUCCESS))
+    {
+        HeadKept = FM_ChildCrcCheckRead(Worker, FileHandle, 0, Length, HeadCrc);
+
+        if ((HeadKept) && (TailKept == false) && (Length == Size))
+        {
+            *TailCrc = *HeadCrc;
+            TailKept = true;
+        }
+        else if ((HeadKept) && (TailKept == false))
+        {
+            TailKept = FM_ChildCrcCheckRead(Worker, FileHandle, Size - Length, Length, TailCrc);
+        }
+
+        OS_close(FileHandle);
+    }
+
+    return (HeadKept && TailKept);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- CRC of one block of a file    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_ChildCrcCheckRead(FM_ChildWorker_t *Worker, osal_id_t FileHandle, uint32 Offset, uint32 Length, uint32 *Crc)
+{
+    bool Read = false;
+
+    if ((OS_lseek(FileHandle, (int32)Offset, OS_SEEK_SET) == (int32)Offset) &&
+        (OS_read(FileHandle, Worker->Buffer, Length) == (int32)Length))
+    {
+        *Crc = FM_CalculateCRC(&FM_GlobalData.Crc, Worker->Buffer, Length, 0, CFE_ES_CrcType_CRC_16);
+        Read = true;
+    }
+
+    return Read;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- split a file CRC into ranges  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+int32 FM_ChildCrcParallel(FM_ChildWorker_t *Worker, const FM_ChildQueueEntry_t *CmdArgs, uint32 *Crc)
+{
+    int32           Status      = CFE_STATUS_NOT_IMPLEMENTED;
+    FM_CrcHelper_t *Helper      = NULL;
+    uint32          HelperCount = 0;
+    uint32          RangeSize   = 0;
+    uint32          TailCrc     = 0;
+    uint32          TailBytes   = 0;
+    uint8           HelperList[FM_CHILD_CRC_HELPERS];
+    uint32          i;
+
+    /* Range CRCs can only be combined when FM computes them itself */
+    if ((FM_CHILD_CRC_SPLIT_SIZE > 0) && (CmdArgs->FileInfoSize >= FM_CHILD_CRC_SPLIT_SIZE) &&
+        (CmdArgs->FileInfoCRC == CFE_ES_CrcType_CRC_16) && (FM_GlobalData.Crc.Method == FM_CRC_METHOD_SLICE8))
+    {
+        /* Another child task using the helpers computes its CRC in a single pass */
+        OS_MutSemTake(FM_GlobalData.CrcHelperSem);
+
+        if (FM_GlobalData.CrcHelperBusy == false)
+        {
+            for (i = 0; i < FM_CHILD_CRC_HELPERS; i++)
+            {
+                if (FM_GlobalData.CrcHelper[i].Running)
+                {
+                    HelperList[HelperCount] = (uint8)i;
+                    HelperCount++;
+                }
+            }
+
+            FM_GlobalData.CrcHelperBusy = (HelperCount > 0);
+        }
+
+        OS_MutSemGive(FM_GlobalData.CrcHelperSem);
+    }
+
+    if (HelperCount > 0)
+    {
+        /* Helpers take equal ranges of whole blocks, the child task reads the rest of the file */
+        RangeSize = ((CmdArgs->FileInfoSize / (HelperCount + 1)) / FM_CHILD_FILE_BLOCK_SIZE) * FM_CHILD_FILE_BLOCK_SIZE;
+
+        FM_ATOMIC_STORE(&FM_GlobalData.CrcHelperStop, 0);
+
+        for (i = 0; i < HelperCount; i++)
+        {
+            Helper = &FM_GlobalData.CrcHelper[HelperList[i]];
+
+            strncpy(Helper->Path, CmdArgs->Source1, OS_MAX_PATH_LEN - 1);
+            Helper->Path[OS_MAX_PATH_LEN - 1] = '\0';
+
+            Helper->Offset = i * RangeSize;
+            Helper->Length = RangeSize;
+
+            FM_ATOMIC_STORE(&Helper->Pending, 1);
+            OS_CountSemGive(Helper->StartSem);
+        }
+
+        Status = FM_ChildCrcRange(Worker, CmdArgs->Source1, HelperCount * RangeSize, 0, (uint8 *)Worker->Buffer,
+                                  &TailCrc, &TailBytes);
+
+        if (Status != OS_SUCCESS)
+        {
+            FM_ATOMIC_STORE(&FM_GlobalData.CrcHelperStop, 1);
+        }
+
+        /* The helper results and buffers are only released once every range has finished */
+        for (i = 0; i < HelperCount; i++)
+        {
+            OS_CountSemTake(FM_GlobalData.CrcHelperDoneSem);
+        }
+
+        *Crc = 0;
+
+        for (i = 0; i < HelperCount; i++)
+        {
+            Helper = &FM_GlobalData.CrcHelper[HelperList[i]];
+
+            if ((Status == OS_SUCCESS) && (Helper->Result != OS_SUCCESS))
+            {
+                Status = Helper->Result;
+            }
+            else if ((Status == OS_SUCCESS) && (Helper->BytesRead != RangeSize))
+            {
+                /* The file shrank since it was verified, a single pass gives the CRC of what is left */
+                Status = CFE_STATUS_NOT_IMPLEMENTED;
+            }
+
+            *Crc = FM_CrcCombine(&FM_GlobalData.Crc, *Crc, Helper->Crc, RangeSize);
+
+            Worker->ProgressBytes += Helper->BytesRead;
+        }
+
+        *Crc = FM_CrcCombine(&FM_GlobalData.Crc, *Crc, TailCrc, TailBytes);
+
+        if (Status == CFE_STATUS_NOT_IMPLEMENTED)
+        {
+            *Crc                  = 0;
+            Worker->ProgressBytes = 0;
+        }
+
+        OS_MutSemTake(FM_GlobalData.CrcHelperSem);
+        FM_GlobalData.CrcHelperBusy = false;
+        OS_MutSemGive(FM_GlobalData.CrcHelperSem);
+    }
+
+    return Status;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- CRC of one range of a file    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+int32 FM_ChildCrcRange(FM_ChildWorker_t *Worker, const char *Filename, uint32 Offset, uint32 Length, uint8 *Buffer,
+                       uint32 *Crc, uint32 *BytesDone)
+{
+    const char *CmdText    = "Get File Info";
+    osal_id_t   FileHandle = OS_OBJECT_ID_UNDEFINED;
+    int32       Status     = OS_SUCCESS;
+    int32       BytesRead  = 0;
+    uint32      ReadSize   = FM_CHILD_FILE_BLOCK_SIZE;
+    bool        Reading    = false;
+
+    *Crc       = 0;
+    *BytesDone = 0;
+
+    /* Each range has a file handle of its own, so reads start at its offset without disturbing the others */
+    Status = OS_OpenCreate(&FileHandle, Filename, OS_FILE_FLAG_NONE, OS_READ_ONLY);
+
+    if (Status == OS_SUCCESS)
+    {
+        Reading = true;
+
+        if ((Offset > 0) && (OS_lseek(FileHandle, Offset, OS_SEEK_SET) != (int32)Offset))
+        {
+            Status  = OS_ERROR;
+            Reading = false;
+        }
+
+        while (Reading)
+        {
+            /* A zero length reads to the end of the file */
+            if ((Length != 0) && ((Length - *BytesDone) < FM_CHILD_FILE_BLOCK_SIZE))
+            {
+                ReadSize = Length - *BytesDone;
+            }
+
+            if (ReadSize == 0)
+            {
+                Reading = false;
+            }
+            else if (FM_ATOMIC_LOAD(&FM_GlobalData.CrcHelperStop) != 0)
+            {
+                Status  = OS_ERROR;
+                Reading = false;
+            }
+            else if ((Worker != NULL) && (FM_ChildAbortCheck(Worker, CmdText)))
+            {
+                Status  = OS_ERROR;
+                Reading = false;
+            }
+            else
+            {
+                BytesRead = OS_read(FileHandle, Buffer, ReadSize);
+
+                if (BytesRead > 0)
+                {
+                    *Crc = FM_CalculateCRC(&FM_GlobalData.Crc, Buffer, BytesRead, *Crc, CFE_ES_CrcType_CRC_16);
+                    *BytesDone += BytesRead;
+
+                    if (Worker != NULL)
+                    {
+                        Worker->ProgressBytes += BytesRead;
+                        Worker->CrcLastBytes = BytesRead;
+                    }
+
+                    /* Avoid hogging the CPU and the volume */
+                    FM_ChildThrottle(Filename, NULL, BytesRead, 0);
+                }
+                else
+                {
+                    /* End of file, or a read error */
+                    Status  = BytesRead;
+                    Reading = false;
+                }
+            }
+        }
+
+        OS_close(FileHandle);
+    }
+
+    return Status;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task command handler -- Get File Digest                */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_ChildFileDigestCmd(FM_ChildWorker_t *Worker, const FM_ChildQueueEntry_t *CmdArgs)
+{
+    const char *CmdText    = "Get File Digest";
+    bool        Reading    = false;
+    bool        Failed     = false;
+    int32       BytesRead  = 0;
+    osal_id_t   FileHandle = OS_OBJECT_ID_UNDEFINED;
+    int32       Status     = 0;
+
+    FM_FileDigestPkt_Payload_t *ReportPtr;
+
+    /* Report current child task activity */
+    Worker->CurrentCC = CmdArgs->CommandCode;
+
+    /*
+    ** Command argument usage for this command:
+    **
+    **  CmdArgs->CommandCode = FM_GET_FILE_DIGEST_CC
+    **  CmdArgs->Source1     = name of file
+    **  CmdArgs->FileInfoCRC = digests to compute (FM_DIGEST_xxx bits)
+    */
+
+    /* Initialize file digest packet (set all data to zero) */
+    CFE_MSG_Init(CFE_MSG_PTR(Worker->FileDigestPkt.TelemetryHeader), CFE_SB_ValueToMsgId(FM_FILE_DIGEST_TLM_MID),
+                 sizeof(FM_FileDigestPkt_t));
+
+    ReportPtr = &Worker->FileDigestPkt.Payload;
+
+    ReportPtr->Digests = CmdArgs->FileInfoCRC;
+    strncpy(ReportPtr->Filename, CmdArgs->Source1, OS_MAX_PATH_LEN - 1);
+    ReportPtr->Filename[OS_MAX_PATH_LEN - 1] = '\0';
+
+    Status = OS_OpenCreate(&FileHandle, CmdArgs->Source1, OS_FILE_FLAG_NONE, OS_READ_ONLY);
+
+    if (Status != OS_SUCCESS)
+    {
+        Failed = true;
+
+        CFE_EVS_SendEvent(FM_GET_FILE_DIGEST_OPEN_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "%s error: OS_OpenCreate failed: result = %d, file = %s", CmdText, (int)Status,
+                          CmdArgs->Source1);
+    }
+    else
+    {
+        Reading = true;
+
+        FM_DigestStart(&Worker->Digest, CmdArgs->FileInfoCRC);
+    }
+
+    /* Each block is read once and passed to every selected digest */
+    while (Reading)
+    {
+        BytesRead = OS_read(FileHandle, Worker->Buffer, FM_CHILD_FILE_BLOCK_SIZE);
+
+        if (BytesRead == 0)
+        {
+            /* Finished reading file */
+            Reading = false;
+        }
+        else if (BytesRead < 0)
+        {
+            Reading = false;
+            Failed  = true;
+
+            CFE_EVS_SendEvent(FM_GET_FILE_DIGEST_READ_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "%s error: OS_read failed: result = %d, file = %s", CmdText, (int)BytesRead,
+                              CmdArgs->Source1);
+        }
+        else if (FM_ChildAbortCheck(Worker, CmdText))
+        {
+            /* Stop without reporting partial digests */
+            Reading = false;
+        }
+        else
+        {
+            FM_DigestUpdate(&FM_GlobalData.Digest, &Worker->Digest, Worker->Buffer, BytesRead);
+
+            ReportPtr->FileSize += BytesRead;
+            Worker->ProgressBytes += BytesRead;
+
+            /* Avoid hogging the CPU and the volume */
+            FM_ChildThrottle(CmdArgs->Source1, NULL, BytesRead, 0);
+        }
+    }
+
+    if (Status == OS_SUCCESS)
+    {
+        OS_close(FileHandle);
+    }
+
+    if ((Worker->Aborted) || (Failed))
+    {
+        Worker->CmdErrCounter++;
+    }
+    else
+    {
+        FM_DigestFinish(&Worker->Digest, &ReportPtr->Crc32c, ReportPtr->Xxh64, ReportPtr->Sha256);
+
+        /* Timestamp and send file digest telemetry packet */
+        CFE_SB_TimeStampMsg(CFE_MSG_PTR(Worker->FileDigestPkt.TelemetryHeader));
+        CFE_SB_TransmitMsg(CFE_MSG_PTR(Worker->FileDigestPkt.TelemetryHeader), true);
+
+        Worker->CmdCounter++;
+
+        /* Send command completion event (info) */
+        CFE_EVS_SendEvent(FM_GET_FILE_DIGEST_CMD_INF_EID, CFE_EVS_EventType_INFORMATION,
+                          "%s command: file = %s, size = %u", CmdText, CmdArgs->Source1,
+                          (unsigned int)ReportPtr->FileSize);
+    }
+
+    /* Report previous child task activity */
+    Worker->PreviousCC = CmdArgs->CommandCode;
+    Worker->CurrentCC  = 0;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task command handler -- Create Directory               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_ChildCreateDirectoryCmd(FM_ChildWorker_t *Worker, const FM_ChildQueueEntry_t *CmdArgs)
+{
+    const char *CmdText   = "Create Directory";
+    int32       OS_Status = OS_SUCCESS;
+
+    /* Report current child task activity */
+    Worker->CurrentCC = CmdArgs->CommandCode;
+
+    OS_Status = OS_mkdir(CmdArgs->Source1, 0);
+
+    if (OS_Status != OS_SUCCESS)
+    {
+        Worker->CmdErrCounter++;
+
+        /* Send command failure event (error) */
+        CFE_EVS_SendEvent(FM_CREATE_DIR_OS_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "%s error: OS_mkdir failed: result = %d, dir = %s", CmdText, (int)OS_Status,
+                          CmdArgs->Source1);
+    }
+    else
+    {
+        Worker->CmdCounter++;
+
+        /* Send command completion event (info) */
+        CFE_EVS_SendEvent(FM_CREATE_DIR_CMD_INF_EID, CFE_EVS_EventType_INFORMATION, "%s command: src = %s", CmdText,
+                          CmdArgs->Source1);
+    }
+
+    /* Report previous child task activity */
+    Worker->PreviousCC = CmdArgs->CommandCode;
+    Worker->CurrentCC  = 0;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task command handler -- Delete Directory               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_ChildDeleteDirectoryCmd(FM_ChildWorker_t *Worker, const FM_ChildQueueEntry_t *CmdArgs)
+{
+    const char *CmdText      = "Delete Directory";
+    bool        RemoveTheDir = true;
+    osal_id_t   DirId        = OS_OBJECT_ID_UNDEFINED;
+    os_dirent_t DirEntry;
+    int32       OS_Status = OS_SUCCESS;
+
+    memset(&DirEntry, 0, sizeof(DirEntry));
+
+    /* Report current child task activity */
+    Worker->CurrentCC = CmdArgs->CommandCode;
+
+    /* Open the dir so we can see if it is empty */
+    OS_Status = OS_DirectoryOpen(&DirId, CmdArgs->Source1);
+
+    if (OS_Status != OS_SUCCESS)
+    {
+        CFE_EVS_SendEvent(FM_DELETE_OPENDIR_OS_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "%s error: OS_DirectoryOpen failed: dir = %s", CmdText, CmdArgs->Source1);
+
+        RemoveTheDir = false;
+        Worker->CmdErrCounter++;
+    }
+    else
+    {
+        /* Look for a directory entry that is not "." or ".." */
+        while ((OS_DirectoryRead(DirId, &DirEntry) == OS_SUCCESS) && (RemoveTheDir == true))
+        {
+            if ((strcmp(OS_DIRENTRY_NAME(DirEntry), FM_THIS_DIRECTORY) != 0) &&
+                (strcmp(OS_DIRENTRY_NAME(DirEntry), FM_PARENT_DIRECTORY) != 0))
+            {
+                CFE_EVS_SendEvent(FM_DELETE_DIR_EMPTY_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "%s error: directory is not empty: dir = %s", CmdText, CmdArgs->Source1);
+
+                RemoveTheDir = false;
+                Worker->CmdErrCounter++;
+            }
+        }
+
+        OS_DirectoryClose(DirId);
+    }
+
+    if (RemoveTheDir)
+    {
+        /* Remove the directory */
+        OS_Status = OS_rmdir(CmdArgs->Source1);
+
+        if (OS_Status != OS_SUCCESS)
+        {
+            /* Send command failure event (error) */
+            CFE_EVS_SendEvent(FM_DELETE_RMDIR_OS_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "%s error: OS_rmdir failed: result = %d, dir = %s", CmdText, (int)OS_Status,
+                              CmdArgs->Source1);
+
+            Worker->CmdErrCounter++;
+        }
+        else
+        {
+            /* Send command completion event (info) */
+            CFE_EVS_SendEvent(FM_DELETE_DIR_CMD_INF_EID, CFE_EVS_EventType_INFORMATION, "%s command: src = %s", CmdText,
+                              CmdArgs->Source1);
+
+            Worker->CmdCounter++;
+        }
+    }
+
+    /* Report previous child task activity */
+    Worker->PreviousCC = CmdArgs->CommandCode;
+    Worker->CurrentCC  = 0;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task command handler -- Delete Directory Tree          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_ChildDeleteTreeCmd(FM_ChildWorker_t *Worker, const FM_ChildQueueEntry_t *CmdArgs)
+{
+    const char *         CmdText         = "Delete Directory Tree";
+    FM_ChildTreeFrame_t *Frame           = NULL;
+    bool                 TreeRemoved     = false;
+    uint32               FilesDeleted    = 0;
+    uint32               FilesNotDeleted = 0;
+    uint32               DirsDeleted     = 0;
+    uint32               DirsNotDeleted  = 0;
+
+    /*
+    ** Command argument usage for this command:
+    **
+    **  CmdArgs->CommandCode = FM_DELETE_TREE_CC
+    **  CmdArgs->Source1     = directory name
+    */
+
+    /* Report current child task activity */
+    Worker->CurrentCC = CmdArgs->CommandCode;
+
+    /* The directories still to visit are kept in the worker, not on the child task stack */
+    Worker->TreeDepth = 0;
+    FM_ChildDeleteTreePush(Worker, CmdArgs->Source1);
+
+    while ((Worker->TreeDepth > 0) && (FM_ChildAbortCheck(Worker, CmdText) == false))
+    {
+        Frame = &Worker->TreeStack[Worker->TreeDepth - 1];
+
+        if (Frame->Scanned == false)
+        {
+            /* Sub-directories found are pushed above this one and visited first */
+            Frame->Scanned = true;
+            FilesDeleted += FM_ChildDeleteTreeScan(Worker, Frame->Path, CmdText, &FilesNotDeleted, &DirsNotDeleted);
+        }
+        else
+        {
+            /* Everything below has been visited, anything left behind makes OS_rmdir fail */
+            Worker->TreeDepth--;
+            FM_ChildThrottle(Frame->Path, NULL, 0, 1);
+
+            if (OS_rmdir(Frame->Path) == OS_SUCCESS)
+            {
+                DirsDeleted++;
+                TreeRemoved = (Worker->TreeDepth == 0);
+            }
+            else
+            {
+                DirsNotDeleted++;
+            }
+        }
+    }
+
+    if (Worker->Aborted)
+    {
+        /* Files and directories deleted before the abort stay deleted */
+        Worker->CmdErrCounter++;
+    }
+    else if (TreeRemoved)
+    {
+        /* Send command completion event (info) */
+        CFE_EVS_SendEvent(FM_DELETE_TREE_CMD_INF_EID, CFE_EVS_EventType_INFORMATION,
+                          "%s command: deleted %d files and %d directories: dir = %s", CmdText, (int)FilesDeleted,
+                          (int)DirsDeleted, CmdArgs->Source1);
+        Worker->CmdCounter++;
+    }
+    else
+    {
+        /* Send command failure event (error) */
+        CFE_EVS_SendEvent(FM_DELETE_TREE_INCOMPLETE_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "%s error: deleted %d files, %d dirs, kept %d files, %d dirs: dir = %s", CmdText,
+                          (int)FilesDeleted, (int)DirsDeleted, (int)FilesNotDeleted, (int)DirsNotDeleted,
+                          CmdArgs->Source1);
+        Worker->CmdErrCounter++;
+    }
+
+    /* Report previous child task activity */
+    Worker->PreviousCC = CmdArgs->CommandCode;
+    Worker->CurrentCC  = 0;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- delete files of a tree level  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+uint32 FM_ChildDeleteTreeScan(FM_ChildWorker_t *Worker, const char *Directory, const char *CmdText,
+                              uint32 *NotDeletedCount, uint32 *SkippedCount)
+{
+    osal_id_t DirId        = OS_OBJECT_ID_UNDEFINED;
+    bool      DirectoryEnd = false;
+    uint32    DeleteCount  = 0;
+    uint32    BatchCount   = 0;
+    char      DirWithSep[OS_MAX_PATH_LEN];
+
+    strncpy(DirWithSep, Directory, sizeof(DirWithSep) - 1);
+    DirWithSep[sizeof(DirWithSep) - 1] = '\0';
+    FM_AppendPathSep(DirWithSep, sizeof(DirWithSep));
+
+    FM_ChildProgressSource(Worker, Directory, "", 0);
+
+    if (OS_DirectoryOpen(&DirId, Directory) == OS_SUCCESS)
+    {
+        /* Same batches as Delete All Files, with sub-directories pushed instead of skipped */
+        Worker->DirKeptCount = 0;
+        Worker->DirSkipCount = 0;
+
+        while ((DirectoryEnd == false) && (Worker->Aborted == false))
+        {
+            Worker->DeleteListLength = 0;
+            Worker->DeleteListCount  = 0;
+
+            DirectoryEnd =
+                FM_ChildDeleteAllCollect(Worker, DirId, DirWithSep, CmdText, true, NotDeletedCount, SkippedCount);
+
+            if (DirectoryEnd == true)
+            {
+                /* The last batch is removed with the directory closed */
+                OS_DirectoryClose(DirId);
+            }
+
+            BatchCount = FM_ChildDeleteAllRemove(Worker, Directory, DirWithSep, CmdText, NotDeletedCount);
+            DeleteCount += BatchCount;
+
+            /* A sub-directory passed over after the restart is not pushed again */
+            if (DirectoryEnd == false)
+            {
+                FM_ChildDirectoryRestart(Worker, DirId, BatchCount);
+            }
+        }
+
+        if (DirectoryEnd == false)
+        {
+            OS_DirectoryClose(DirId);
+        }
+    }
+
+    return DeleteCount;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- push a tree directory         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_ChildDeleteTreePush(FM_ChildWorker_t *Worker, const char *Directory)
+{
+    FM_ChildTreeFrame_t *Frame  = NULL;
+    bool                 Pushed = false;
+
+    if (Worker->TreeDepth < FM_CHILD_TREE_STACK_SIZE)
+    {
+        Frame = &Worker->TreeStack[Worker->TreeDepth];
+
+        strncpy(Frame->Path, Directory, sizeof(Frame->Path) - 1);
+        Frame->Path[sizeof(Frame->Path) - 1] = '\0';
+        Frame->Scanned                       = false;
+
+        Worker->TreeDepth++;
+        Pushed = true;
+    }
+
+    return Pushed;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task command handler -- Filter Files                   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_ChildFilterFilesCmd(FM_ChildWorker_t *Worker, const FM_ChildQueueEntry_t *CmdArgs)
+{
+    const char *CmdText      = "Filter Files";
+    const char *ActionText   = "deleted";
+    osal_id_t   DirId        = OS_OBJECT_ID_UNDEFINED;
+    int32       OS_Status    = OS_SUCCESS;
+    bool        DirectoryEnd = false;
+    uint32      DoneCount    = 0;
+    uint32      BatchCount   = 0;
+    uint32      NotDoneCount = 0;
+    uint32      Now          = 0;
+    OS_time_t   LocalTime;
+    char        DirWithSep[OS_MAX_PATH_LEN];
+    char        TgtWithSep[OS_MAX_PATH_LEN];
+
+    /*
+    ** Command argument usage for this command:
+    **
+    **  CmdArgs->CommandCode  = FM_FILTER_FILES_CC
+    **  CmdArgs->Source1      = directory name
+    **  CmdArgs->Source2      = name pattern
+    **  CmdArgs->Target       = target directory name, empty for delete
+    **  CmdArgs->FilterAction = delete, move or copy
+    **  CmdArgs->Filter       = age and size limits
+    */
+
+    /* Report current child task activity */
+    Worker->CurrentCC = CmdArgs->CommandCode;
+
+    /*
+    ** Copies save checkpoints under this command, which is not resumed, so
+    **  a reset during a copy discards the checkpoint instead of resuming an
+    **  earlier command.  The command can simply be sent again.
+    */
+    FM_ChildCheckpointBegin(Worker, CmdArgs);
+
+    if (CmdArgs->FilterAction == FM_FILTER_ACTION_MOVE)
+    {
+        ActionText = "moved";
+    }
+    else if (CmdArgs->FilterAction == FM_FILTER_ACTION_COPY)
+    {
+        ActionText = "copied";
+    }
+
+    strncpy(DirWithSep, CmdArgs->Source1, sizeof(DirWithSep) - 1);
+    DirWithSep[sizeof(DirWithSep) - 1] = '\0';
+    FM_AppendPathSep(DirWithSep, sizeof(DirWithSep));
+
+    strncpy(TgtWithSep, CmdArgs->Target, sizeof(TgtWithSep) - 1);
+    TgtWithSep[sizeof(TgtWithSep) - 1] = '\0';
+    FM_AppendPathSep(TgtWithSep, sizeof(TgtWithSep));
+
+    /* Every file age is measured from the same clock reading */
+    OS_GetLocalTime(&LocalTime);
+    Now = (uint32)OS_TimeGetTotalSeconds(LocalTime);
+
+    /* Open directory so that we can read from it */
+    OS_Status = OS_DirectoryOpen(&DirId, CmdArgs->Source1);
+
+    if (OS_Status != OS_SUCCESS)
+    {
+        Worker->CmdErrCounter++;
+
+        /* Send command failure event (error) */
+        CFE_EVS_SendEvent(FM_FILTER_FILES_OS_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "%s error: OS_DirectoryOpen failed: dir = %s", CmdText, CmdArgs->Source1);
+    }
+    else
+    {
+        /* The files that pass are handled a batch at a time, as for Delete All Files */
+        Worker->DirKeptCount = 0;
+        Worker->DirSkipCount = 0;
+
+        while ((DirectoryEnd == false) && (Worker->Aborted == false))
+        {
+            Worker->DeleteListLength = 0;
+            Worker->DeleteListCount  = 0;
+
+            DirectoryEnd = FM_ChildFilterCollect(Worker, DirId, DirWithSep, CmdArgs, Now, CmdText, &NotDoneCount);
+
+            if (DirectoryEnd == true)
+            {
+                /* The last batch is handled with the directory closed */
+                OS_DirectoryClose(DirId);
+            }
+
+            BatchCount = FM_ChildFilterApply(Worker, CmdArgs, DirWithSep, TgtWithSep, CmdText, &NotDoneCount);
+            DoneCount += BatchCount;
+
+            /* Copied files stay in the directory */
+            if ((DirectoryEnd == false) && (CmdArgs->FilterAction != FM_FILTER_ACTION_COPY))
+            {
+                FM_ChildDirectoryRestart(Worker, DirId, BatchCount);
+            }
+        }
+
+        if (DirectoryEnd == false)
+        {
+            OS_DirectoryClose(DirId);
+        }
+
+        if (Worker->Aborted)
+        {
+            /* Files handled before the abort stay handled */
+            Worker->CmdErrCounter++;
+        }
+        else
+        {
+            /* Send command completion event (info) */
+            CFE_EVS_SendEvent(FM_FILTER_FILES_CMD_INF_EID, CFE_EVS_EventType_INFORMATION,
+                              "%s command: %s %d files: dir = %s", CmdText, ActionText, (int)DoneCount,
+                              CmdArgs->Source1);
+            Worker->CmdCounter++;
+
+            if (NotDoneCount > 0)
+            {
+                /* Open files, existing targets and OS errors are reported together */
+                CFE_EVS_SendEvent(FM_FILTER_FILES_WARNING_EID, CFE_EVS_EventType_INFORMATION,
+                                  "%s command: %d matching files not %s: dir = %s", CmdText, (int)NotDoneCount,
+                                  ActionText, CmdArgs->Source1);
+                Worker->CmdWarnCounter++;
+            }
+        }
+    }
+
+    FM_ChildCheckpointEnd(Worker);
+
+    /* Report previous child task activity */
+    Worker->PreviousCC = CmdArgs->CommandCode;
+    Worker->CurrentCC  = 0;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- collect files passing filter  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_ChildFilterCollect(FM_ChildWorker_t *Worker, osal_id_t DirId, const char *DirWithSep,
+                           const FM_ChildQueueEntry_t *CmdArgs, uint32 Now, const char *CmdText, uint32 *NotDoneCount)
+{
+    bool        DirectoryEnd = false;
+    uint32      PathLength   = 0;
+    uint32      NameLength   = 0;
+    os_dirent_t DirEntry;
+    os_fstat_t  FileStatus;
+    char        Filename[2 * OS_MAX_PATH_LEN];
+
+    memset(&DirEntry, 0, sizeof(DirEntry));
+    memset(&FileStatus, 0, sizeof(FileStatus));
+
+    /* Stop reading while the list still has room for the longest name */
+    while ((DirectoryEnd == false) && ((FM_CHILD_DELETE_LIST_SIZE - Worker->DeleteListLength) >= OS_MAX_PATH_LEN) &&
+           (FM_ChildAbortCheck(Worker, CmdText) == false))
+    {
+        if (FM_ChildDirectoryNext(Worker, DirId, &DirEntry) == false)
+        {
+            DirectoryEnd = true;
+        }
+        /* The name is tested first so that entries that do not match cost no OS_stat call */
+        else if (FM_MatchPattern(CmdArgs->Source2, OS_DIRENTRY_NAME(DirEntry)) == true)
+        {
+            /* Construct full path filename */
+            PathLength = snprintf(Filename, sizeof(Filename), "%s%s", DirWithSep, OS_DIRENTRY_NAME(DirEntry));
+
+            if ((PathLength >= OS_MAX_PATH_LEN) || (OS_stat(Filename, &FileStatus) != OS_SUCCESS))
+            {
+                /* Too long to handle, or gone since the directory entry was read */
+                (*NotDoneCount)++;
+            }
+            else if (!OS_FILESTAT_ISDIR(FileStatus) &&
+                     (FM_ChildFilterPass(&CmdArgs->Filter, OS_FILESTAT_SIZE(FileStatus), OS_FILESTAT_TIME(FileStatus),
+                                         Now) == true))
+            {
+                if (FM_IsPathOpen(&Worker->OpenPaths, Filename))
+                {
+                    (*NotDoneCount)++;
+                }
+                else
+                {
+                    /* Only the entry name is kept, the directory is added back when handling the file */
+                    NameLength = strlen(OS_DIRENTRY_NAME(DirEntry)) + 1;
+                    memcpy(&Worker->DeleteList[Worker->DeleteListLength], OS_DIRENTRY_NAME(DirEntry), NameLength);
+
+                    Worker->DeleteListLength += NameLength;
+                    Worker->DeleteListCount++;
+                }
+            }
+        }
+    }
+
+    return DirectoryEnd;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- test file age and size limits */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_ChildFilterPass(const FM_FileFilter_t *Filter, uint32 FileSize, uint32 FileTime, uint32 Now)
+{
+    bool   Passed = true;
+    uint32 Age    = 0;
+
+    /* A file stamped later than the clock reading has no age */
+    if (Now > FileTime)
+    {
+        Age = Now - FileTime;
+    }
+
+    /* A limit of zero is not applied */
+    if (((Filter->MinSize != 0) && (FileSize < Filter->MinSize)) ||
+        ((Filter->MaxSize != 0) && (FileSize > Filter->MaxSize)) || ((Filter->MinAge != 0) && (Age < Filter->MinAge)) ||
+        ((Filter->MaxAge != 0) && (Age > Filter->MaxAge)))
+    {
+        Passed = false;
+    }
+
+    return Passed;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- handle collected files        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+uint32 FM_ChildFilterApply(FM_ChildWorker_t *Worker, const FM_ChildQueueEntry_t *CmdArgs, const char *DirWithSep,
+                           const char *TgtWithSep, const char *CmdText, uint32 *NotDoneCount)
+{
+    uint32      DoneCount = 0;
+    uint32      Offset    = 0;
+    const char *Name      = NULL;
+    char        Source[2 * OS_MAX_PATH_LEN];
+    char        Target[2 * OS_MAX_PATH_LEN];
+
+    if (CmdArgs->FilterAction == FM_FILTER_ACTION_DELETE)
+    {
+        DoneCount = FM_ChildDeleteAllRemove(Worker, CmdArgs->Source1, DirWithSep, CmdText, NotDoneCount);
+    }
+    else
+    {
+        /* One throttle charge covers the target checks of the batch, copied data is charged as it is copied */
+        if ((Worker->DeleteListCount > 0) && (Worker->Aborted == false))
+        {
+            FM_ChildThrottle(CmdArgs->Source1, CmdArgs->Target, 0, Worker->DeleteListCount);
+        }
+
+        /* As for a delete batch, the files are checked against a new snapshot */
+        Worker->OpenPaths.Valid = false;
+
+        while ((Offset < Worker->DeleteListLength) && (FM_ChildAbortCheck(Worker, CmdText) == false))
+        {
+            Name = &Worker->DeleteList[Offset];
+            snprintf(Source, sizeof(Source), "%s%s", DirWithSep, Name);
+            snprintf(Target, sizeof(Target), "%s%s", TgtWithSep, Name);
+
+            if ((FM_IsPathOpen(&Worker->OpenPaths, Source) == false) &&
+                (FM_ChildFilterTransfer(Worker, CmdArgs, Source, Target, CmdText) == true))
+            {
+                DoneCount++;
+            }
+            else
+            {
+                (*NotDoneCount)++;
+            }
+
+            Offset += strlen(Name) + 1;
+        }
+    }
+
+    return DoneCount;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- move or copy a filtered file  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_ChildFilterTransfer(FM_ChildWorker_t *Worker, const FM_ChildQueueEntry_t *CmdArgs, const char *Source,
+                            const char *Target, const char *CmdText)
+{
+    bool   Transferred = false;
+    uint32 TargetState = FM_NAME_IS_INVALID;
+
+    /* A file is never copied onto itself, the copy would truncate it first */
+    if (strcmp(Source, Target) != 0)
+    {
+        TargetState = FM_GetFilenameState(Target, OS_MAX_PATH_LEN, false, &Worker->OpenPaths);
+    }
+
+    /* The target name must be unused, or hold a closed file that may be overwritten */
+    if ((TargetState == FM_NAME_IS_NOT_IN_USE) ||
+        ((TargetState == FM_NAME_IS_FILE_CLOSED) && (CmdArgs->Overwrite != 0)))
+    {
+        FM_ChildProgressSource(Worker, Source, Target, 0);
+
+        if (CmdArgs->FilterAction == FM_FILTER_ACTION_COPY)
+        {
+            Transferred = FM_ChildCopyFile(Worker, Source, Target, FM_FILTER_FILES_OS_ERR_EID, CmdText);
+        }
+        else if (OS_rename(Source, Target) == OS_SUCCESS)
+        {
+            Transferred = true;
+        }
+        else if (FM_ChildCopyFile(Worker, Source, Target, FM_FILTER_FILES_OS_ERR_EID, CmdText) == true)
+        {
+            /* Move across volumes - remove the source file once it has been copied */
+            Transferred = (OS_remove(Source) == OS_SUCCESS);
+        }
+    }
+
+    return Transferred;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task command handler -- Enforce Retention              */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_ChildRetentionCmd(FM_ChildWorker_t *Worker, const FM_ChildQueueEntry_t *CmdArgs)
+{
+    const char *         CmdText      = "Enforce Retention";
+    FM_RetentionState_t *State        = &FM_GlobalData.Retention[CmdArgs->RetentionIndex];
+    bool                 Commanded    = State->Commanded;
+    osal_id_t            DirId        = OS_OBJECT_ID_UNDEFINED;
+    int32                OS_Status    = OS_SUCCESS;
+    uint32               RemoveCount  = 0;
+    uint64               BytesRemoved = 0;
+    uint32               i;
+    char                 DirWithSep[OS_MAX_PATH_LEN];
+
+    /*
+    ** Command argument usage for this command:
+    **
+    **  CmdArgs->CommandCode    = FM_ENFORCE_RETENTION_CC
+    **  CmdArgs->Source1        = managed directory name
+    **  CmdArgs->RetentionIndex = retention table entry, its state holds the limits
+    */
+
+    /* Report current child task activity */
+    Worker->CurrentCC = CmdArgs->CommandCode;
+
+    strncpy(DirWithSep, CmdArgs->Source1, sizeof(DirWithSep) - 1);
+    DirWithSep[sizeof(DirWithSep) - 1] = '\0';
+    FM_AppendPathSep(DirWithSep, sizeof(DirWithSep));
+
+    /* Open directory so that we can read from it */
+    OS_Status = OS_DirectoryOpen(&DirId, CmdArgs->Source1);
+
+    if (OS_Status != OS_SUCCESS)
+    {
+        if (Commanded)
+        {
+            Worker->CmdErrCounter++;
+        }
+
+        /* Send command failure event (error) */
+        CFE_EVS_SendEvent(FM_ENFORCE_RETENTION_OS_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "%s error: OS_DirectoryOpen failed: dir = %s", CmdText, CmdArgs->Source1);
+    }
+    else
+    {
+        /* The directory is read once, files are counted and the first to go are indexed */
+        FM_ChildRetentionScan(Worker, State, DirId, DirWithSep);
+
+        OS_DirectoryClose(DirId);
+
+        /* Turn the index over so that the file to be removed first is on top */
+        for (i = State->IndexCount / 2; i > 0; i--)
+        {
+            FM_ChildRetentionSift(State->Index, State->IndexCount, i - 1, true);
+        }
+
+        RemoveCount = FM_ChildRetentionEvict(Worker, State, DirWithSep, CmdText, &BytesRemoved);
+
+        FM_ATOMIC_ADD(&FM_GlobalData.RetentionFileCount, RemoveCount);
+
+        if (Worker->Aborted)
+        {
+            /* Files removed before the abort stay removed */
+            if (Commanded)
+            {
+                Worker->CmdErrCounter++;
+            }
+        }
+        else
+        {
+            FM_ATOMIC_ADD(&FM_GlobalData.RetentionPassCount, 1);
+
+            /* Scheduled passes that find nothing to do stay quiet */
+            if ((Commanded) || (RemoveCount > 0))
+            {
+                CFE_EVS_SendEvent(FM_ENFORCE_RETENTION_CMD_INF_EID, CFE_EVS_EventType_INFORMATION,
+                                  "%s: removed %d files, %u bytes: dir = %s", CmdText, (int)RemoveCount,
+                                  (unsigned int)BytesRemoved, CmdArgs->Source1);
+            }
+
+            if (Commanded)
+            {
+                Worker->CmdCounter++;
+            }
+
+            if (FM_ChildRetentionOver(State))
+            {
+                /* Open files, OS errors and files beyond the index are left for the next pass */
+                CFE_EVS_SendEvent(FM_ENFORCE_RETENTION_WARNING_EID, CFE_EVS_EventType_INFORMATION,
+                                  "%s: directory still over limits: files = %d, bytes = %u: dir = %s", CmdText,
+                                  (int)State->FileCount, (unsigned int)State->ByteCount, CmdArgs->Source1);
+
+                if (Commanded)
+                {
+                    Worker->CmdWarnCounter++;
+                }
+            }
+        }
+    }
+
+    /* The entry may be scheduled or commanded again */
+    FM_ATOMIC_STORE(&State->Busy, 0);
+
+    /* Report previous child task activity */
+    Worker->PreviousCC = CmdArgs->CommandCode;
+    Worker->CurrentCC  = 0;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- count and index managed files */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_ChildRetentionScan(FM_ChildWorker_t *Worker, FM_RetentionState_t *State, osal_id_t DirId,
+                           const char *DirWithSep)
+{
+    bool               DirectoryEnd = false;
+    uint32             PathLength   = 0;
+    os_dirent_t        DirEntry;
+    os_fstat_t         FileStatus;
+    FM_RetentionFile_t File;
+    char               Filename[2 * OS_MAX_PATH_LEN];
+
+    memset(&DirEntry, 0, sizeof(DirEntry));
+    memset(&FileStatus, 0, sizeof(FileStatus));
+    memset(&File, 0, sizeof(File));
+
+    State->FileCount  = 0;
+    State->ByteCount  = 0;
+    State->IndexCount = 0;
+
+    while ((DirectoryEnd == false) && (FM_ChildAbortCheck(Worker, "Enforce Retention") == false))
+    {
+        if (OS_DirectoryRead(DirId, &DirEntry) != OS_SUCCESS)
+        {
+            DirectoryEnd = true;
+        }
+        /* Ignore the "." and ".." directory entries */
+        else if ((strcmp(OS_DIRENTRY_NAME(DirEntry), FM_THIS_DIRECTORY) != 0) &&
+                 (strcmp(OS_DIRENTRY_NAME(DirEntry), FM_PARENT_DIRECTORY) != 0))
+        {
+            /* Construct full path filename */
+            PathLength = snprintf(Filename, sizeof(Filename), "%s%s", DirWithSep, OS_DIRENTRY_NAME(DirEntry));
+
+            /* Every file costs an OS_stat, paced like the directory listings */
+            FM_ChildThrottle(State->Policy.Directory, NULL, 0, 1);
+
+            /* Names too long to remove and files gone since the entry was read are skipped */
+            if ((PathLength < OS_MAX_PATH_LEN) && (OS_stat(Filename, &FileStatus) == OS_SUCCESS) &&
+                !OS_FILESTAT_ISDIR(FileStatus))
+            {
+                File.Size     = OS_FILESTAT_SIZE(FileStatus);
+                File.Time     = OS_FILESTAT_TIME(FileStatus);
+                File.Priority = FM_ChildRetentionPriority(&State->Policy, OS_DIRENTRY_NAME(DirEntry));
+
+                strncpy(File.Name, OS_DIRENTRY_NAME(DirEntry), sizeof(File.Name) - 1);
+                File.Name[sizeof(File.Name) - 1] = '\0';
+
+                State->FileCount++;
+                State->ByteCount += File.Size;
+
+                FM_ChildRetentionOffer(State, &File);
+            }
+        }
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- retention priority of a file  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+uint32 FM_ChildRetentionPriority(const FM_RetentionTableEntry_t *Policy, const char *Name)
+{
+    uint32 Priority = 0;
+    uint32 i;
+
+    if (Policy->Order == FM_RETENTION_ORDER_PRIORITY)
+    {
+        /* Files matching no pattern are removed last */
+        Priority = FM_RETENTION_PATTERN_COUNT;
+
+        /* The first pattern matched sets the priority, empty patterns are skipped */
+        for (i = 0; (i < FM_RETENTION_PATTERN_COUNT) && (Priority == FM_RETENTION_PATTERN_COUNT); i++)
+        {
+            if ((Policy->Priority[i][0] != '\0') && (FM_MatchPattern(Policy->Priority[i], Name) == true))
+            {
+                Priority = i;
+            }
+        }
+    }
+
+    return Priority;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- offer a file to the index     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_ChildRetentionOffer(FM_RetentionState_t *State, const FM_RetentionFile_t *File)
+{
+    uint32 Slot   = 0;
+    uint32 Parent = 0;
+    bool   Done   = false;
+
+    /* While the directory is read the file to be removed last is on top */
+    if (State->IndexCount < FM_RETENTION_INDEX_SIZE)
+    {
+        /* Room left - add the file at the bottom and let it rise */
+        Slot = State->IndexCount;
+        State->IndexCount++;
+
+        while ((Done == false) && (Slot > 0))
+        {
+            Parent = (Slot - 1) / 2;
+
+            if (FM_ChildRetentionAbove(File, &State->Index[Parent], false) == true)
+            {
+                State->Index[Slot] = State->Index[Parent];
+                Slot               = Parent;
+            }
+            else
+            {
+                Done = true;
+            }
+        }
+
+        State->Index[Slot] = *File;
+    }
+    else if (FM_ChildRetentionAbove(&State->Index[0], File, false) == true)
+    {
+        /* The file goes before the last one to go, which drops out of the index */
+        State->Index[0] = *File;
+        FM_ChildRetentionSift(State->Index, State->IndexCount, 0, false);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- compare two indexed files     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_ChildRetentionAbove(const FM_RetentionFile_t *Upper, const FM_RetentionFile_t *Lower, bool EvictFirst)
+{
+    const FM_RetentionFile_t *First  = Upper;
+    const FM_RetentionFile_t *Second = Lower;
+
+    /* With the file to be removed last on top the order is reversed */
+    if (EvictFirst == false)
+    {
+        First  = Lower;
+        Second = Upper;
+    }
+
+    /* Lowest priority first, oldest first within a priority */
+    return ((First->Priority < Second->Priority) ||
+            ((First->Priority == Second->Priority) && (First->Time < Second->Time)));
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- sift an index entry down      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_ChildRetentionSift(FM_RetentionFile_t *Index, uint32 Count, uint32 Root, bool EvictFirst)
+{
+    FM_RetentionFile_t Held  = Index[Root];
+    uint32             Child = 0;
+    bool               Done  = false;
+
+    while ((Done == false) && (((2 * Root) + 1) < Count))
+    {
+        Child = (2 * Root) + 1;
+
+        /* Follow the child that belongs nearer the top */
+        if (((Child + 1) < Count) && (FM_ChildRetentionAbove(&Index[Child + 1], &Index[Child], EvictFirst) == true))
+        {
+            Child++;
+        }
+
+        if (FM_ChildRetentionAbove(&Index[Child], &Held, EvictFirst) == true)
+        {
+            Index[Root] = Index[Child];
+            Root        = Child;
+        }
+        else
+        {
+            Done = true;
+        }
+    }
+
+    Index[Root] = Held;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- remove indexed files          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+uint32 FM_ChildRetentionEvict(FM_ChildWorker_t *Worker, FM_RetentionState_t *State, const char *DirWithSep,
+                              const char *CmdText, uint64 *BytesRemoved)
+{
+    uint32             RemoveCount = 0;
+    FM_RetentionFile_t File;
+    char               Filename[2 * OS_MAX_PATH_LEN];
+
+    while ((State->IndexCount > 0) && (FM_ChildRetentionOver(State) == true) &&
+           (FM_ChildAbortCheck(Worker, CmdText) == false))
+    {
+        /* Take the file to be removed first off the top, the last file refills the top */
+        File = State->Index[0];
+        State->IndexCount--;
+        State->Index[0] = State->Index[State->IndexCount];
+        FM_ChildRetentionSift(State->Index, State->IndexCount, 0, true);
+
+        snprintf(Filename, sizeof(Filename), "%s%s", DirWithSep, File.Name);
+
+        FM_ChildThrottle(State->Policy.Directory, NULL, 0, 1);
+
+        /* Only the files over the limits are removed, each against a new snapshot of the open files */
+        Worker->OpenPaths.Valid = false;
+
+        /* Open files and files that cannot be removed stay counted */
+        if ((FM_IsPathOpen(&Worker->OpenPaths, Filename) == false) && (OS_remove(Filename) == OS_SUCCESS))
+        {
+            State->FileCount--;
+            State->ByteCount -= File.Size;
+
+            *BytesRemoved += File.Size;
+            RemoveCount++;
+        }
+    }
+
+    return RemoveCount;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- test retention limits         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_ChildRetentionOver(const FM_RetentionState_t *State)
+{
+    /* A limit of zero is not applied */
+    return (((State->Policy.MaxFiles != 0) && (State->FileCount > State->Policy.MaxFiles)) ||
+            ((State->Policy.MaxBytes != 0) && (State->ByteCount > State->Policy.MaxBytes)));
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task command handler -- Purge Trash                    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_ChildPurgeCmd(FM_ChildWorker_t *Worker, const FM_ChildQueueEntry_t *CmdArgs)
+{
+    const char *CmdText        = "Purge Trash";
+    bool        Commanded      = FM_GlobalData.TrashPurgeCommanded;
+    bool        Done           = false;
+    bool        DirectoryEnd   = false;
+    osal_id_t   DirId          = OS_OBJECT_ID_UNDEFINED;
+    int32       OS_Status      = OS_SUCCESS;
+    uint32      Budget         = FM_CHILD_PURGE_BUDGET;
+    uint32      PurgeCount     = 0;
+    uint32      NotPurgedCount = 0;
+    uint32      OpenErrCount   = 0;
+    uint32      i;
+    char        TrashDir[OS_MAX_PATH_LEN];
+
+    /*
+    ** Command argument usage for this command:
+    **
+    **  CmdArgs->CommandCode = FM_PURGE_TRASH_CC
+    */
+
+    /* Report current child task activity */
+    Worker->CurrentCC = CmdArgs->CommandCode;
+
+    /* A commanded pass empties every trash directory */
+    if (Commanded)
+    {
+        Budget = 0;
+    }
+
+    for (i = 0; (i < FM_CHILD_TRASH_VOLUMES) && (Done == false); i++)
+    {
+        /* Entries are claimed but never released, so the copy stays valid */
+        OS_MutSemTake(FM_GlobalData.ChildTrashSem);
+        strncpy(TrashDir, FM_GlobalData.Trash[i].Path, sizeof(TrashDir) - 1);
+        TrashDir[sizeof(TrashDir) - 1] = '\0';
+        OS_MutSemGive(FM_GlobalData.ChildTrashSem);
+
+        if ((TrashDir[0] != '\0') && ((Commanded) || (FM_ATOMIC_LOAD(&FM_GlobalData.Trash[i].Pending) != 0)))
+        {
+            /* Files put in the trash while the pass runs set the flag again */
+            FM_ATOMIC_STORE(&FM_GlobalData.Trash[i].Pending, 0);
+
+            OS_Status = OS_DirectoryOpen(&DirId, TrashDir);
+
+            if (OS_Status != OS_SUCCESS)
+            {
+                OpenErrCount++;
+
+                /* Send command failure event (error) */
+                CFE_EVS_SendEvent(FM_PURGE_TRASH_OS_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "%s error: OS_DirectoryOpen failed: dir = %s", CmdText, TrashDir);
+            }
+            else
+            {
+                DirectoryEnd = FM_ChildPurgeVolume(Worker, DirId, TrashDir, Budget, &PurgeCount, &NotPurgedCount);
+
+                OS_DirectoryClose(DirId);
+
+                if ((DirectoryEnd == false) || (Worker->Aborted))
+                {
+                    /* The rest is left for the next pass */
+                    FM_ATOMIC_STORE(&FM_GlobalData.Trash[i].Pending, 1);
+                }
+            }
+        }
+
+        /* A scheduled pass gives way to queued commands */
+        Done = (Worker->Aborted) || ((Budget != 0) && ((PurgeCount >= Budget) || (FM_ChildQueueCount() > 0)));
+    }
+
+    FM_ATOMIC_ADD(&FM_GlobalData.TrashPurgeCount, PurgeCount);
+
+    /* Scheduled passes only report trash directories that cannot be read */
+    if (Commanded)
+    {
+        if ((Worker->Aborted) || (OpenErrCount > 0))
+        {
+            /* Files removed before the abort stay removed */
+            Worker->CmdErrCounter++;
+        }
+        else
+        {
+            /* Send command completion event (info) */
+            CFE_EVS_SendEvent(FM_PURGE_TRASH_CMD_INF_EID, CFE_EVS_EventType_INFORMATION,
+                              "%s command: purged %d files", CmdText, (int)PurgeCount);
+            Worker->CmdCounter++;
+
+            if (NotPurgedCount > 0)
+            {
+                CFE_EVS_SendEvent(FM_PURGE_TRASH_WARNING_EID, CFE_EVS_EventType_INFORMATION,
+                                  "%s command: %d files could not be purged", CmdText, (int)NotPurgedCount);
+                Worker->CmdWarnCounter++;
+            }
+        }
+    }
+
+    /* Another pass may be scheduled or commanded */
+    FM_ATOMIC_STORE(&FM_GlobalData.TrashPurgeBusy, 0);
+
+    /* Report previous child task activity */
+    Worker->PreviousCC = CmdArgs->CommandCode;
+    Worker->CurrentCC  = 0;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- purge one trash directory     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_ChildPurgeVolume(FM_ChildWorker_t *Worker, osal_id_t DirId, const char *TrashDir, uint32 Budget,
+                         uint32 *PurgeCount, uint32 *NotPurgedCount)
+{
+    const char *CmdText      = "Purge Trash";
+    bool        DirectoryEnd = false;
+    bool        Yield        = false;
+    uint32      MaxCount     = 0;
+    uint32      BatchCount   = 0;
+    char        DirWithSep[OS_MAX_PATH_LEN];
+
+    strncpy(DirWithSep, TrashDir, sizeof(DirWithSep) - 1);
+    DirWithSep[sizeof(DirWithSep) - 1] = '\0';
+    FM_AppendPathSep(DirWithSep, sizeof(DirWithSep));
+
+    Worker->DirKeptCount = 0;
+    Worker->DirSkipCount = 0;
+
+    while ((DirectoryEnd == false) && (Yield == false) && (Worker->Aborted == false))
+    {
+        Worker->DeleteListLength = 0;
+        Worker->DeleteListCount  = 0;
+
+        /* A budget limits the batch as well, so a pass never reads past it */
+        if (Budget != 0)
+        {
+            MaxCount = Budget - *PurgeCount;
+        }
+
+        DirectoryEnd = FM_ChildPurgeCollect(Worker, DirId, CmdText, MaxCount);
+
+        BatchCount = FM_ChildDeleteAllRemove(Worker, TrashDir, DirWithSep, CmdText, NotPurgedCount);
+        *PurgeCount += BatchCount;
+
+        Yield = (Budget != 0) && ((*PurgeCount >= Budget) || (FM_ChildQueueCount() > 0));
+
+        /* The directory stays open between batches, so the read starts over as for Delete All Files */
+        if ((DirectoryEnd == false) && (Yield == false))
+        {
+            FM_ChildDirectoryRestart(Worker, DirId, BatchCount);
+        }
+    }
+
+    return DirectoryEnd;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- collect trash entries         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_ChildPurgeCollect(FM_ChildWorker_t *Worker, osal_id_t DirId, const char *CmdText, uint32 MaxCount)
+{
+    bool        DirectoryEnd = false;
+    uint32      NameLength   = 0;
+    os_dirent_t DirEntry;
+
+    memset(&DirEntry, 0, sizeof(DirEntry));
+
+    /* Stop reading while the list still has room for the longest name */
+    while ((DirectoryEnd == false) && ((FM_CHILD_DELETE_LIST_SIZE - Worker->DeleteListLength) >= OS_MAX_PATH_LEN) &&
+           ((MaxCount == 0) || (Worker->DeleteListCount < MaxCount)) && (FM_ChildAbortCheck(Worker, CmdText) == false))
+    {
+        if (FM_ChildDirectoryNext(Worker, DirId, &DirEntry) == false)
+        {
+            DirectoryEnd = true;
+        }
+        /*
+        ** Every entry was a closed file when it was renamed into the trash,
+        **  so no OS_stat is spent on it and anything else fails to be removed
+        */
+        else
+        {
+            NameLength = strlen(OS_DIRENTRY_NAME(DirEntry)) + 1;
+            memcpy(&Worker->DeleteList[Worker->DeleteListLength], OS_DIRENTRY_NAME(DirEntry), NameLength);
+
+            Worker->DeleteListLength += NameLength;
+            Worker->DeleteListCount++;
+        }
+    }
+
+    return DirectoryEnd;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- put a file in the trash       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_ChildTrashFile(const char *Filename)
+{
+    bool   Trashed = false;
+    uint32 Index   = FM_CHILD_TRASH_VOLUMES;
+    int32  Length  = 0;
+    char   TrashDir[OS_MAX_PATH_LEN];
+    char   TrashName[OS_MAX_PATH_LEN];
+
+    if (FM_GlobalData.ChildDeleteMode == FM_DELETE_MODE_TRASH)
+    {
+        Index = FM_ChildTrashVolume(Filename, TrashDir, sizeof(TrashDir));
+    }
+
+    if (Index < FM_CHILD_TRASH_VOLUMES)
+    {
+        /*
+        ** Files are numbered so that names never collide in the trash.  A
+        **  number left by an earlier run is replaced, or if the rename fails
+        **  the file is removed directly by the caller.
+        */
+        Length = snprintf(TrashName, sizeof(TrashName), "%s/%08X", TrashDir,
+                          (unsigned int)FM_ATOMIC_ADD(&FM_GlobalData.TrashSequence, 1));
+
+        if ((Length < (int32)sizeof(TrashName)) && (OS_rename(Filename, TrashName) == OS_SUCCESS))
+        {
+            FM_ATOMIC_STORE(&FM_GlobalData.Trash[Index].Pending, 1);
+            FM_ATOMIC_ADD(&FM_GlobalData.TrashFileCount, 1);
+
+            Trashed = true;
+        }
+    }
+
+    return Trashed;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- find a volume trash directory */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+uint32 FM_ChildTrashVolume(const char *Filename, char *TrashDir, uint32 BufferSize)
+{
+    uint32      Index     = FM_CHILD_TRASH_VOLUMES;
+    uint32      FreeIndex = FM_CHILD_TRASH_VOLUMES;
+    const char *Separator = NULL;
+    int32       Length    = 0;
+    os_fstat_t  FileStatus;
+    uint32      i;
+
+    /* The volume is the first component of the path, where the OSAL file system mounts it */
+    if (Filename[0] == '/')
+    {
+        Separator = strchr(&Filename[1], '/');
+    }
+
+    if (Separator != NULL)
+    {
+        Length = snprintf(TrashDir, BufferSize, "%.*s/%s", (int)(Separator - Filename), Filename,
+                          FM_CHILD_TRASH_DIR_NAME);
+    }
+
+    /* Files already in the trash are removed rather than renamed again */
+    if ((Separator != NULL) && (Length < (int32)BufferSize) &&
+        ((strncmp(Filename, TrashDir, Length) != 0) || (Filename[Length] != '/')))
+    {
+        OS_MutSemTake(FM_GlobalData.ChildTrashSem);
+
+        for (i = 0; i < FM_CHILD_TRASH_VOLUMES; i++)
+        {
+            if (FM_GlobalData.Trash[i].Path[0] == '\0')
+            {
+                if (FreeIndex == FM_CHILD_TRASH_VOLUMES)
+                {
+                    FreeIndex = i;
+                }
+            }
+            else if (strcmp(FM_GlobalData.Trash[i].Path, TrashDir) == 0)
+            {
+                Index = i;
+            }
+        }
+
+        /* The first file put in the trash of a volume claims an entry for it */
+        if ((Index == FM_CHILD_TRASH_VOLUMES) && (FreeIndex < FM_CHILD_TRASH_VOLUMES))
+        {
+            /* The directory may be left from an earlier run, so only its existence matters */
+            OS_mkdir(TrashDir, 0);
+
+            memset(&FileStatus, 0, sizeof(FileStatus));
+
+            if ((OS_stat(TrashDir, &FileStatus) == OS_SUCCESS) && OS_FILESTAT_ISDIR(FileStatus))
+            {
+                strncpy(FM_GlobalData.Trash[FreeIndex].Path, TrashDir, OS_MAX_PATH_LEN - 1);
+                FM_GlobalData.Trash[FreeIndex].Path[OS_MAX_PATH_LEN - 1] = '\0';
+
+                /* Files left by an earlier run are purged with the new ones */
+                FM_ATOMIC_STORE(&FM_GlobalData.Trash[FreeIndex].Pending, 1);
+
+                Index = FreeIndex;
+            }
+        }
+
+        OS_MutSemGive(FM_GlobalData.ChildTrashSem);
+    }
+
+    return Index;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task command handler -- Get Directory List (to file)   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_ChildDirListFileCmd(FM_ChildWorker_t *Worker, const FM_ChildQueueEntry_t *CmdArgs)
+{
+    const char *CmdText    = "Directory List to File";
+    bool        Result     = false;
+    osal_id_t   FileHandle = OS_OBJECT_ID_UNDEFINED;
+    osal_id_t   DirId      = OS_OBJECT_ID_UNDEFINED;
+    int32       Status     = 0;
+
+    /* Report current child task activity */
+    Worker->CurrentCC = CmdArgs->CommandCode;
+
+    /*
+    ** Command argument usage for this command:
+    **
+    **  CmdArgs->CommandCode = FM_GET_DIR_LIST_FILE_CC
+    **  CmdArgs->Source1     = directory name
+    **  CmdArgs->Source2     = directory name plus separator
+    **  CmdArgs->Target      = output filename
+    */
+
+    /* Open directory for reading directory list */
+    Status = OS_DirectoryOpen(&DirId, CmdArgs->Source1);
+
+    if (Status != OS_SUCCESS)
+    {
+        Worker->CmdErrCounter++;
+
+        /* Send command failure event (error) */
+        CFE_EVS_SendEvent(FM_GET_DIR_FILE_OSOPENDIR_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "%s error: OS_DirectoryOpen failed: dir = %s", CmdText, CmdArgs->Source1);
+    }
+    else
+    {
+        /* Create output file, write placeholder for statistics, etc. */
+        Result = FM_ChildDirListFileInit(Worker, &FileHandle, CmdArgs->Source1, CmdArgs->Target);
+        if (Result == true)
+        {
+            /* Read directory listing and write contents to output file */
+            FM_ChildDirListFileLoop(Worker, DirId, FileHandle, CmdArgs->Source1, CmdArgs->Source2, CmdArgs->Target,
+                                    CmdArgs->GetSizeTimeMode);
+
+            /* Close output file */
+            OS_close(FileHandle);
+
+            if (Worker->Aborted)
+            {
+                /* Remove partial output file after abort */
+                OS_remove(CmdArgs->Target);
+            }
+        }
+
+        /* Close directory list access handle */
+        OS_DirectoryClose(DirId);
+    }
+
+    /* Report previous child task activity */
+    Worker->PreviousCC = CmdArgs->CommandCode;
+    Worker->CurrentCC  = 0;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task command handler -- Get Directory List (to pkt)    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_ChildDirListPktCmd(FM_ChildWorker_t *Worker, const FM_ChildQueueEntry_t *CmdArgs)
+{
+    const char *       CmdText                      = "Directory List to Packet";
+    char               LogicalName[OS_MAX_PATH_LEN] = "\0";
+    bool               StillProcessing              = true;
+    osal_id_t          DirId                        = OS_OBJECT_ID_UNDEFINED;
+    os_dirent_t        DirEntry;
+    int32              ListIndex      = 0;
+    FM_DirListEntry_t *ListEntry      = NULL;
+    size_t             PathLength     = 0;
+    size_t             EntryLength    = 0;
+    int32              Status;
+
+    FM_DirListPkt_Payload_t *ReportPtr;
+
+    memset(&DirEntry, 0, sizeof(DirEntry));
+
+    /* Report current child task activity */
+    Worker->CurrentCC = CmdArgs->CommandCode;
+
+    /*
+    ** Command argument usage for this command:
+    **
+    **  CmdArgs->CommandCode   = FM_GET_DIR_LIST_PKT_CC
+    **  CmdArgs->Source1       = directory name
+    **  CmdArgs->Source2       = directory name plus separator
+    **  CmdArgs->DirListOffset = index of 1st reported dir entry
+    */
+    PathLength = strlen(CmdArgs->Source2);
+
+    /* Open source directory for reading directory list */
+    Status = OS_DirectoryOpen(&DirId, CmdArgs->Source1);
+
+    if (Status != OS_SUCCESS)
+    {
+        Worker->CmdErrCounter++;
+
+        /* Send command failure event (error) */
+        CFE_EVS_SendEvent(FM_GET_DIR_PKT_OS_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "%s error: OS_DirectoryOpen failed: dir = %s", CmdText, CmdArgs->Source1);
+    }
+    else
+    {
+        /* Initialize the directory list telemetry packet */
+        CFE_MSG_Init(CFE_MSG_PTR(Worker->DirListPkt.TelemetryHeader), CFE_SB_ValueToMsgId(FM_DIR_LIST_TLM_MID),
+                     sizeof(FM_DirListPkt_t));
+
+        ReportPtr = &Worker->DirListPkt.Payload;
+
+        strncpy(ReportPtr->DirName, CmdArgs->Source1, OS_MAX_PATH_LEN - 1);
+        ReportPtr->DirName[OS_MAX_PATH_LEN - 1] = '\0';
+        ReportPtr->FirstFile                    = CmdArgs->DirListOffset;
+
+        StillProcessing = true;
+        while ((StillProcessing == true) && (FM_ChildAbortCheck(Worker, CmdText) == false))
+        {
+            /* Read next directory entry */
+            Status = OS_DirectoryRead(DirId, &DirEntry);
+
+            if (Status != OS_SUCCESS)
+            {
+                /* Stop reading directory - no more entries */
+                StillProcessing = false;
+            }
+            else if ((strcmp(OS_DIRENTRY_NAME(DirEntry), FM_THIS_DIRECTORY) != 0) &&
+                     (strcmp(OS_DIRENTRY_NAME(DirEntry), FM_PARENT_DIRECTORY) != 0))
+            {
+                /* Do not count the "." and ".." directory entries */
+                ReportPtr->TotalFiles++;
+
+                /* Start collecting directory entries at command-specified offset */
+                /* Stop collecting directory entries when telemetry packet is full */
+                if ((ReportPtr->TotalFiles > ReportPtr->FirstFile) &&
+                    (ReportPtr->PacketFiles < FM_DIR_LIST_PKT_ENTRIES))
+                {
+                    /* Create a shorthand access to the packet list entry */
+                    ListIndex = ReportPtr->PacketFiles;
+                    ListEntry = &ReportPtr->FileList[ListIndex];
+
+                    EntryLength = strlen(OS_DIRENTRY_NAME(DirEntry));
+
+                    /* Verify combined directory plus filename length */
+                    if ((PathLength + EntryLength) < sizeof(LogicalName))
+                    {
+                        /* Add filename to directory listing telemetry packet */
+                        strncpy(ListEntry->EntryName, OS_DIRENTRY_NAME(DirEntry), sizeof(ListEntry->EntryName) - 1);
+                        ListEntry->EntryName[sizeof(ListEntry->EntryName) - 1] = '\0';
+
+                        /* Build filename - Directory already has path separator */
+                        memcpy(LogicalName, CmdArgs->Source2, PathLength);
+                        memcpy(&LogicalName[PathLength], OS_DIRENTRY_NAME(DirEntry), EntryLength);
+                        LogicalName[PathLength + EntryLength] = '\0';
+
+                        FM_ChildSleepStat(LogicalName, ListEntry, CmdArgs->GetSizeTimeMode);
+
+                        /* Add another entry to the telemetry packet */
+                        ReportPtr->PacketFiles++;
+                    }
+                    else
+                    {
+                        Worker->CmdWarnCounter++;
+
+                        /* Send command warning event (info) */
+                        CFE_EVS_SendEvent(FM_GET_DIR_PKT_WARNING_EID, CFE_EVS_EventType_INFORMATION,
+                                          "%s warning: dir + entry is too long: dir = %s, entry = %s", CmdText,
+                                          CmdArgs->Source2, OS_DIRENTRY_NAME(DirEntry));
+                    }
+                }
+            }
+        }
+
+        OS_DirectoryClose(DirId);
+
+        if (Worker->Aborted)
+        {
+            Worker->CmdErrCounter++;
+        }
+        else
+        {
+            /* Timestamp and send directory listing telemetry packet */
+            CFE_SB_TimeStampMsg(CFE_MSG_PTR(Worker->DirListPkt.TelemetryHeader));
+            CFE_SB_TransmitMsg(CFE_MSG_PTR(Worker->DirListPkt.TelemetryHeader), true);
+
+            /* Send command completion event (info) */
+            CFE_EVS_SendEvent(FM_GET_DIR_PKT_CMD_INF_EID, CFE_EVS_EventType_INFORMATION,
+                              "%s command: offset = %d, dir = %s", CmdText, (int)CmdArgs->DirListOffset,
+                              CmdArgs->Source1);
+
+            Worker->CmdCounter++;
+        }
+    }
+
+    /* Report previous child task activity */
+    Worker->PreviousCC = CmdArgs->CommandCode;
+    Worker->CurrentCC  = 0;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task command handler -- Set File Permissions           */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void FM_ChildSetPermissionsCmd(FM_ChildWorker_t *Worker, const FM_ChildQueueEntry_t *CmdArgs)
+{
+    int32       OS_Status = OS_SUCCESS;
+    const char *CmdText   = "Set Permissions";
+
+    OS_Status = OS_chmod(CmdArgs->Source1, CmdArgs->Mode);
+
+    if (OS_Status == OS_SUCCESS)
+    {
+        Worker->CmdCounter++;
+
+        /* Send command completion event (info) */
+        CFE_EVS_SendEvent(FM_SET_PERM_CMD_INF_EID, CFE_EVS_EventType_INFORMATION, "%s command: file = %s, access = %d",
+                          CmdText, CmdArgs->Source1, (int)CmdArgs->Mode);
+    }
+    else
+    {
+        Worker->CmdErrCounter++;
+
+        /* Send OS error message */
+        CFE_EVS_SendEvent(FM_SET_PERM_OS_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "%s command: OS_chmod error, RC=0x%08X, file = %s, access = %d", CmdText,
+                          (unsigned int)OS_Status, CmdArgs->Source1, (int)CmdArgs->Mode);
+    }
+
+    /* Report previous child task activity */
+    Worker->PreviousCC = CmdArgs->CommandCode;
+    Worker->CurrentCC  = 0;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- create dir list output file   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_ChildDirListFileInit(FM_ChildWorker_t *Worker, osal_id_t *FileHandlePtr, const char *Directory,
+                             const char *Filename)
+{
+    const char *    CmdText       = "Directory List to File";
+    bool            CommandResult = true;
+    CFE_FS_Header_t FileHeader;
+    osal_id_t       FileHandle   = OS_OBJECT_ID_UNDEFINED;
+    int32           BytesWritten = 0;
+    int32           Status       = 0;
+
+    /* Initialize the standard cFE File Header for the Directory Listing File */
+    CFE_FS_InitHeader(&FileHeader, CmdText, FM_DIR_LIST_FILE_SUBTYPE);
+
+    /* Create directory listing output file */
+    Status = OS_OpenCreate(&FileHandle, Filename, OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE, OS_READ_WRITE);
+
+    if (Status == OS_SUCCESS)
+    {
+        /* Write the standard CFE file header */
+        BytesWritten = CFE_FS_WriteHeader(FileHandle, &FileHeader);
+        if (BytesWritten == sizeof(CFE_FS_Header_t))
+        {
+            /* Initialize directory statistics structure */
+            memset(&Worker->DirListFileStats, 0, sizeof(Worker->DirListFileStats));
+            strncpy(Worker->DirListFileStats.DirName, Directory, OS_MAX_PATH_LEN - 1);
+            Worker->DirListFileStats.DirName[OS_MAX_PATH_LEN - 1] = '\0';
+
+            /* Write blank FM directory statistics structure as a placeholder */
+            BytesWritten = OS_write(FileHandle, &Worker->DirListFileStats, sizeof(FM_DirListFileStats_t));
+            if (BytesWritten == sizeof(FM_DirListFileStats_t))
+            {
+                /* Return output file handle */
+                *FileHandlePtr = FileHandle;
+            }
+            else
+            {
+                CommandResult = false;
+                Worker->CmdErrCounter++;
+
+                /* Send command failure event (error) */
+                CFE_EVS_SendEvent(FM_GET_DIR_FILE_WRBLANK_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "%s error: OS_write blank stats failed: result = %d, expected = %u", CmdText,
+                                  (int)BytesWritten, (unsigned int)sizeof(FM_DirListFileStats_t));
+            }
+        }
+        else
+        {
+            CommandResult = false;
+            Worker->CmdErrCounter++;
+
+            /* Send command failure event (error) */
+            CFE_EVS_SendEvent(FM_GET_DIR_FILE_WRHDR_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "%s error: CFE_FS_WriteHeader failed: result = %d, expected = %u", CmdText,
+                              (int)BytesWritten, (unsigned int)sizeof(CFE_FS_Header_t));
+        }
+
+        /* Close output file after write error */
+        if (CommandResult == false)
+        {
+            OS_close(FileHandle);
+        }
+    }
+    else
+    {
+        CommandResult = false;
+        Worker->CmdErrCounter++;
+
+        /* Send command failure event (error) */
+        CFE_EVS_SendEvent(FM_GET_DIR_FILE_OSCREAT_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "%s error: OS_OpenCreate failed: result = %d, file = %s", CmdText, (int)Status, Filename);
+    }
+
+    return CommandResult;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- write to dir list output file */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_ChildDirListFileLoop(FM_ChildWorker_t *Worker, osal_id_t DirId, osal_id_t FileHandle, const char *Directory,
+                             const char *DirWithSep, const char *Filename, uint8 getSizeTimeMode)
+{
+    const char *      CmdText                   = "Directory List to File";
+    size_t            WriteLength               = sizeof(FM_DirListEntry_t);
+    bool              ReadingDirectory          = true;
+    bool              CommandResult             = true;
+    uint32            DirEntries                = 0;
+    uint32            FileEntries               = 0;
+    size_t            EntryLength               = 0;
+    size_t            PathLength                = 0;
+    int32             BytesWritten              = 0;
+    int32             Status                    = 0;
+    char              TempName[OS_MAX_PATH_LEN] = "\0";
+    os_dirent_t       DirEntry;
+    FM_DirListEntry_t DirListData;
+
+    memset(&DirEntry, 0, sizeof(DirEntry));
+
+    PathLength = strlen(DirWithSep);
+
+    /* Until end of directory entries, output file write error or abort */
+    while ((CommandResult == true) && (ReadingDirectory == true) && (FM_ChildAbortCheck(Worker, CmdText) == false))
+    {
+        Status = OS_DirectoryRead(DirId, &DirEntry);
+
+        /* Normal loop end - no more directory entries */
+        if (Status != OS_SUCCESS)
+        {
+            ReadingDirectory = false;
+        }
+        else if ((strcmp(OS_DIRENTRY_NAME(DirEntry), FM_THIS_DIRECTORY) != 0) &&
+                 (strcmp(OS_DIRENTRY_NAME(DirEntry), FM_PARENT_DIRECTORY) != 0))
+        {
+            /* Do not count the "." and ".." files */
+            DirEntries++;
+
+            /* Count all files - write limited number */
+            if (FileEntries < FM_DIR_LIST_FILE_ENTRIES)
+            {
+                EntryLength = strlen(OS_DIRENTRY_NAME(DirEntry));
+
+                /*
+                 * DirListData.EntryName and TempName are both OS_MAX_PATH_LEN, DirEntry name is OS_MAX_FILE_NAME,
+                 * so limiting test is PathLength and EntryLength together
+                 */
+                if ((PathLength + EntryLength) < sizeof(TempName))
+                {
+                    /* Build qualified directory entry name */
+                    memcpy(TempName, DirWithSep, PathLength);
+                    memcpy(&TempName[PathLength], OS_DIRENTRY_NAME(DirEntry), EntryLength);
+                    TempName[PathLength + EntryLength] = '\0';
+
+                    /*
+                     * Populate directory list file entry -
+                     * Note this is guaranteed to be null-terminated due to the memset()
+                     * this will leave at least one null char after the string.
+                     */
+                    memset(&DirListData, 0, sizeof(DirListData));
+                    strncpy(DirListData.EntryName, OS_DIRENTRY_NAME(DirEntry), sizeof(DirListData.EntryName) - 1);
+
+                    FM_ChildSleepStat(TempName, &DirListData, getSizeTimeMode);
+
+                    /* Write directory list file entry to output file */
+                    BytesWritten = OS_write(FileHandle, &DirListData, WriteLength);
+
+                    if (BytesWritten == WriteLength)
+                    {
+                        FileEntries++;
+                    }
+                    else
+                    {
+                        CommandResult = false;
+                        Worker->CmdErrCounter++;
+
+                        /* Send command failure event (error) */
+                        CFE_EVS_SendEvent(FM_GET_DIR_FILE_WRENTRY_ERR_EID, CFE_EVS_EventType_ERROR,
+                                          "%s error: OS_write entry failed: result = %d, expected = %d", CmdText,
+                                          (int)BytesWritten, (int)WriteLength);
+                    }
+                }
+                else
+                {
+                    Worker->CmdWarnCounter++;
+
+                    /* Send command failure event (error) */
+                    CFE_EVS_SendEvent(FM_GET_DIR_FILE_WARNING_EID, CFE_EVS_EventType_INFORMATION,
+                                      "%s error: combined directory and entry name too long: dir = %s, entry = %s",
+                                      CmdText, Directory, OS_DIRENTRY_NAME(DirEntry));
+                }
+            }
+        }
+    }
+
+    if (Worker->Aborted)
+    {
+        /* The caller removes the partial output file */
+        CommandResult = false;
+        Worker->CmdErrCounter++;
+    }
+
+    /* Update directory statistics in output file */
+    if ((CommandResult == true) && (DirEntries != 0))
+    {
+        /* Update entries found in directory vs entries written to file */
+        Worker->DirListFileStats.DirEntries  = DirEntries;
+        Worker->DirListFileStats.FileEntries = FileEntries;
+
+        /* Back up to the start of the statistics data */
+        OS_lseek(FileHandle, sizeof(CFE_FS_Header_t), OS_SEEK_SET);
+
+        /* Write an updated version of the statistics data */
+        WriteLength  = sizeof(FM_DirListFileStats_t);
+        BytesWritten = OS_write(FileHandle, &Worker->DirListFileStats, WriteLength);
+
+        if (BytesWritten != WriteLength)
+        {
+            CommandResult = false;
+            Worker->CmdErrCounter++;
+
+            /* Send command failure event (error) */
+            CFE_EVS_SendEvent(FM_GET_DIR_FILE_UPSTATS_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "%s error: OS_write update stats failed: result = %d, expected = %d", CmdText,
+                              (int)BytesWritten, (int)WriteLength);
+        }
+    }
+
+    /* Send command completion event (info) */
+    if (CommandResult == true)
+    {
+        Worker->CmdCounter++;
+
+        CFE_EVS_SendEvent(FM_GET_DIR_FILE_CMD_INF_EID,
+                          CFE_EVS_EventType_INFORMATION, "%s command: wrote %d of %d names: dir = %s, filename = %s",
+                          CmdText, (int)FileEntries, (int)DirEntries, Directory, Filename);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- copy file through copy buffer */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_ChildCopyFile(FM_ChildWorker_t *Worker, const char *Source, const char *Target, uint32 EventID,
+                      const char *CmdText)
+{
+    bool      CopyResult    = false;
+    bool      Positioned    = true;
+    int32     OS_Status     = OS_SUCCESS;
+    uint32    TargetFlags   = OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE;
+    uint32    ResumeOffset  = 0;
+    osal_id_t FileHandleSrc = OS_OBJECT_ID_UNDEFINED;
+    osal_id_t FileHandleTgt = OS_OBJECT_ID_UNDEFINED;
+
+    Worker->CopyBytes = 0;
+
+    if (FM_ChildCheckpointSource(Worker, 0, Source, Target, CmdText, &ResumeOffset) == false)
+    {
+        OS_Status = OS_ERROR;
+    }
+    else if (ResumeOffset == 0)
+    {
+        /* Let the kernel copy the data when the build includes a kernel copy method */
+        OS_Status = FM_ChildKernelCopy(Worker, Source, Target, false, EventID, CmdText);
+    }
+    else
+    {
+        /* A resumed copy is streamed from the checkpoint offset into the existing target file */
+        OS_Status   = CFE_STATUS_NOT_IMPLEMENTED;
+        TargetFlags = OS_FILE_FLAG_NONE;
+    }
+
+    if (OS_Status == CFE_SUCCESS)
+    {
+        CopyResult = true;
+    }
+    else if (OS_Status != CFE_STATUS_NOT_IMPLEMENTED)
+    {
+        /* Remove partial target file after copy error */
+        OS_remove(Target);
+    }
+    else
+    {
+        /* Open source file */
+        OS_Status = OS_OpenCreate(&FileHandleSrc, Source, OS_FILE_FLAG_NONE, OS_READ_ONLY);
+
+        if (OS_Status != OS_SUCCESS)
+        {
+            /* Send command failure event (error) */
+            CFE_EVS_SendEvent(EventID, CFE_EVS_EventType_ERROR,
+                              "%s error: OS_OpenCreate failed: result = %d, src = %s", CmdText, (int)OS_Status,
+                              Source);
+        }
+        else
+        {
+            /* Create (or truncate) target file, a resumed copy keeps what it holds */
+            OS_Status = OS_OpenCreate(&FileHandleTgt, Target, TargetFlags, OS_WRITE_ONLY);
+
+            if (OS_Status != OS_SUCCESS)
+            {
+                /* Send command failure event (error) */
+                CFE_EVS_SendEvent(EventID, CFE_EVS_EventType_ERROR,
+                                  "%s error: OS_OpenCreate failed: result = %d, tgt = %s", CmdText, (int)OS_Status,
+                                  Target);
+            }
+            else
+            {
+                if (ResumeOffset != 0)
+                {
+                    /* Continue both files at the checkpoint */
+                    Positioned = FM_ChildCheckpointSeek(Worker, FileHandleSrc, FileHandleTgt, CmdText);
+                }
+
+                if (Positioned == true)
+                {
+                    CopyResult = FM_ChildCopyStream(Worker, FileHandleSrc, FileHandleTgt, Source, Target, EventID,
+                                                    EventID, CmdText);
+                }
+
+                /* Close target file */
+                OS_close(FileHandleTgt);
+
+                if (CopyResult == false)
+                {
+                    /* Remove partial target file after copy error */
+                    OS_remove(Target);
+                }
+            }
+
+            /* Close source file */
+            OS_close(FileHandleSrc);
+        }
+    }
+
+    return CopyResult;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- copy file inside the kernel   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+int32 FM_ChildKernelCopy(FM_ChildWorker_t *Worker, const char *Source, const char *Target, bool Append,
+                         uint32 EventID, const char *CmdText)
+{
+    FM_KernelCopy_State_t KernelCopy;
+    bool                  CopyInProgress = false;
+    int32                 Result         = CFE_SUCCESS;
+    int32                 BytesCopied    = 0;
+
+    /* The kernel copy opens the files outside of OSAL, so the open file checks are told here */
+    OS_MutSemTake(FM_GlobalData.ChildDequeueSem);
+
+    strncpy(Worker->KernelCopyPaths.Path[0], Source, OS_MAX_PATH_LEN - 1);
+    strncpy(Worker->KernelCopyPaths.Path[2], Target, OS_MAX_PATH_LEN - 1);
+
+    Worker->KernelCopyPaths.Path[0][OS_MAX_PATH_LEN - 1] = '\0';
+    Worker->KernelCopyPaths.Path[1][0]                   = '\0';
+    Worker->KernelCopyPaths.Path[2][OS_MAX_PATH_LEN - 1] = '\0';
+    Worker->KernelCopyOpen                               = true;
+
+    OS_MutSemGive(FM_GlobalData.ChildDequeueSem);
+
+    Result = FM_KernelCopy_Open(&KernelCopy, Source, Target, Append);
+
+    if (Result == CFE_SUCCESS)
+    {
+        CopyInProgress = true;
+
+        while (CopyInProgress)
+        {
+            if (FM_ChildAbortCheck(Worker, CmdText))
+            {
+                /* The caller removes the partial target file */
+                BytesCopied = OS_ERROR;
+            }
+            else
+            {
+                /* Copy as much data per call as the copy loop reads at a time */
+                BytesCopied = FM_KernelCopy_Chunk(&KernelCopy, FM_GlobalData.ChildCopyBlockSize);
+            }
+
+            if (BytesCopied == 0)
+            {
+                /* Success - finished reading source file */
+                CopyInProgress = false;
+            }
+            else if (BytesCopied > 0)
+            {
+                Worker->CopyBytes += BytesCopied;
+                Worker->ProgressBytes += BytesCopied;
+
+                FM_ChildCheckpointSave(Worker, BytesCopied);
+
+                /* Avoid hogging the CPU and the volumes */
+                FM_ChildThrottle(Source, Target, BytesCopied, 0);
+            }
+            else
+            {
+                CopyInProgress = false;
+                Result         = BytesCopied;
+
+                /* Nothing was copied yet when the kernel cannot copy these files */
+                if ((Result != CFE_STATUS_NOT_IMPLEMENTED) && (Worker->Aborted == false))
+                {
+                    /* Send command failure event (error) */
+                    CFE_EVS_SendEvent(EventID, CFE_EVS_EventType_ERROR,
+                                      "%s error: kernel copy failed: result = %d, src = %s, tgt = %s", CmdText,
+                                      (int)Result, Source, Target);
+                }
+            }
+        }
+
+        FM_KernelCopy_Close(&KernelCopy);
+    }
+
+    OS_MutSemTake(FM_GlobalData.ChildDequeueSem);
+    Worker->KernelCopyOpen = false;
+    OS_MutSemGive(FM_GlobalData.ChildDequeueSem);
+
+    return Result;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- stream open file to open file */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_ChildCopyStream(FM_ChildWorker_t *Worker, osal_id_t FileHandleSrc, osal_id_t FileHandleTgt,
+                        const char *Source, const char *Target, uint32 ReadEventID, uint32 WriteEventID,
+                        const char *CmdText)
+{
+    bool   CopyResult     = false;
+    bool   CopyInProgress = true;
+    bool   Pipelined      = Worker->WriterRunning;
+    uint32 BlockSize      = FM_GlobalData.ChildCopyBlockSize;
+    uint32 BuffersHeld    = 0;
+    uint32 BuffersFilled  = 0;
+    uint8  Slot           = Worker->CopyFillSlot;
+    int32  OS_Status      = OS_SUCCESS;
+    int32  BytesRead      = 0;
+
+    /* Never read past the end of a copy buffer */
+    if ((BlockSize == 0) || (BlockSize > FM_CHILD_COPY_BUFFER_SIZE))
+    {
+        BlockSize = FM_CHILD_COPY_BUFFER_SIZE;
+    }
+
+    Worker->CopyTarget      = FileHandleTgt;
+    Worker->CopyWriteFailed = false;
+
+    while (CopyInProgress)
+    {
+        if (Pipelined)
+        {
+            /* Wait for the writer task to hand back a drained buffer */
+            OS_Status = OS_CountSemTake(Worker->CopyEmptySem);
+
+            if (OS_Status == OS_SUCCESS)
+            {
+                BuffersHeld++;
+
+                /* Buffers drain in fill order, so once each has been filled the one handed back was written */
+                if ((BuffersFilled >= FM_CHILD_COPY_BUFFER_COUNT) && (Worker->CopyWriteFailed == false))
+                {
+                    FM_ChildCheckpointSave(Worker, Worker->CopyLength[Slot]);
+                }
+            }
+        }
+
+        if (OS_Status != OS_SUCCESS)
+        {
+            CopyInProgress = false;
+
+            /* Send command failure event (error) */
+            CFE_EVS_SendEvent(ReadEventID, CFE_EVS_EventType_ERROR,
+                              "%s error: OS_CountSemTake failed: result = %d, file = %s", CmdText, (int)OS_Status,
+                              Source);
+        }
+        else if (Worker->CopyWriteFailed)
+        {
+            /* Write failure event is sent once the writer task is idle */
+            CopyInProgress = false;
+        }
+        else if (FM_ChildAbortCheck(Worker, CmdText))
+        {
+            /* The caller removes the partial target file */
+            CopyInProgress = false;
+        }
+        else
+        {
+            BytesRead = OS_read(FileHandleSrc, Worker->CopyBuffer[Slot], BlockSize);
+
+            if (BytesRead == 0)
+            {
+                /* Success - finished reading source file */
+                CopyInProgress = false;
+                CopyResult     = true;
+            }
+            else if (BytesRead < 0)
+            {
+                CopyInProgress = false;
+
+                /* Send command failure event (error) */
+                CFE_EVS_SendEvent(ReadEventID, CFE_EVS_EventType_ERROR,
+                                  "%s error: OS_read failed: result = %d, file = %s", CmdText, (int)BytesRead, Source);
+            }
+            else
+            {
+                Worker->CopyLength[Slot] = BytesRead;
+                Worker->ProgressBytes += BytesRead;
+
+                if (Pipelined)
+                {
+                    /* Hand the buffer to the writer task and fill the next one meanwhile */
+                    BuffersHeld--;
+                    BuffersFilled++;
+                    OS_CountSemGive(Worker->CopyFilledSem);
+                    Slot = (Slot + 1) % FM_CHILD_COPY_BUFFER_COUNT;
+                }
+                else
+                {
+                    FM_ChildCopyWrite(Worker, Slot);
+
+                    if (Worker->CopyWriteFailed == false)
+                    {
+                        FM_ChildCheckpointSave(Worker, BytesRead);
+                    }
+                }
+
+                /* Avoid hogging the CPU and the volumes */
+                FM_ChildThrottle(Source, Target, BytesRead, 0);
+            }
+        }
+    }
+
+    if (Pipelined)
+    {
+        /* Wait until the writer task has drained every buffer handed to it */
+        while ((BuffersHeld < FM_CHILD_COPY_BUFFER_COUNT) && (OS_CountSemTake(Worker->CopyEmptySem) == OS_SUCCESS))
+        {
+            BuffersHeld++;
+        }
+
+        /* Return the empty buffers for the next copy */
+        while (BuffersHeld > 0)
+        {
+            OS_CountSemGive(Worker->CopyEmptySem);
+            BuffersHeld--;
+        }
+
+        Worker->CopyFillSlot = Slot;
+    }
+
+    if (Worker->CopyWriteFailed)
+    {
+        CopyResult = false;
+
+        /* Send command failure event (error) */
+        CFE_EVS_SendEvent(WriteEventID, CFE_EVS_EventType_ERROR,
+                          "%s error: OS_write failed: result = %d, expected = %d", CmdText,
+                          (int)Worker->CopyWriteResult, (int)Worker->CopyWriteExpected);
+    }
+
+    return CopyResult;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- write one filled copy buffer  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_ChildCopyWrite(FM_ChildWorker_t *Worker, uint8 Slot)
+{
+    int32 BytesWritten = 0;
+
+    /* Buffers filled after a failed write are handed back unwritten */
+    if (Worker->CopyWriteFailed == false)
+    {
+        BytesWritten = OS_write(Worker->CopyTarget, Worker->CopyBuffer[Slot], Worker->CopyLength[Slot]);
+
+        if (BytesWritten != Worker->CopyLength[Slot])
+        {
+            Worker->CopyWriteResult   = BytesWritten;
+            Worker->CopyWriteExpected = Worker->CopyLength[Slot];
+            Worker->CopyWriteFailed   = true;
+        }
+        else
+        {
+            Worker->CopyBytes += BytesWritten;
+        }
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- get dir entry size and time   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+int32 FM_ChildSizeTimeMode(const char *Filename, uint32 *FileSize, uint32 *FileTime, uint32 *FileMode)
+{
+    int32      Result = OS_SUCCESS;
+    os_fstat_t FileStatus;
+
+    memset(&FileStatus, 0, sizeof(FileStatus));
+
+    Result = OS_stat(Filename, &FileStatus);
+
+    if (Result != OS_SUCCESS)
+    {
+        *FileSize = 0;
+        *FileTime = 0;
+        *FileMode = 0;
+    }
+    else
+    {
+        *FileTime = OS_FILESTAT_TIME(FileStatus);
+        *FileSize = OS_FILESTAT_SIZE(FileStatus);
+        *FileMode = OS_FILESTAT_MODE(FileStatus);
+    }
+
+    return Result;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- sleep between OS_stat on files*/
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_ChildSleepStat(const char *Filename, FM_DirListEntry_t *DirListData, bool getSizeTimeMode)
+{
+    /* Check if command requested size and time */
+    if (getSizeTimeMode == true)
+    {
+        /* Avoid hogging the CPU and the volume */
+        FM_ChildThrottle(Filename, NULL, 0, 1);
+
+        /* Get file size, date, and mode */
+        FM_ChildSizeTimeMode(Filename, &(DirListData->EntrySize), &(DirListData->ModifyTime), &(DirListData->Mode));
+    }
+    else
+    {
+        DirListData->EntrySize  = 0;
+        DirListData->ModifyTime = 0;
+        DirListData->Mode       = 0;
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- pace file system use          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_ChildThrottle(const char *Source, const char *Target, uint32 Bytes, uint32 Stats)
+{
+    uint32    SourceIndex   = FM_CHILD_THROTTLE_DEFAULT;
+    uint32    TargetIndex   = FM_CHILD_THROTTLE_DEFAULT;
+    uint32    DelayMs       = 0;
+    uint32    TargetDelayMs = 0;
+    OS_time_t Now;
+
+    OS_GetLocalTime(&Now);
+
+    OS_MutSemTake(FM_GlobalData.ChildThrottleSem);
+
+    SourceIndex = FM_ChildThrottleSelect(Source);
+    DelayMs     = FM_ChildThrottleCharge(SourceIndex, Now, Bytes, Stats);
+
+    /* Data moved between volumes is charged to both of them */
+    if (Target != NULL)
+    {
+        TargetIndex = FM_ChildThrottleSelect(Target);
+
+        if (TargetIndex != SourceIndex)
+        {
+            TargetDelayMs = FM_ChildThrottleCharge(TargetIndex, Now, Bytes, Stats);
+
+            if (TargetDelayMs > DelayMs)
+            {
+                DelayMs = TargetDelayMs;
+            }
+        }
+    }
+
+    OS_MutSemGive(FM_GlobalData.ChildThrottleSem);
+
+    if (DelayMs > 0)
+    {
+        /* Give up the CPU until the busiest volume has caught up */
+        CFE_ES_PerfLogExit(FM_CHILD_TASK_PERF_ID);
+        OS_TaskDelay(DelayMs);
+        CFE_ES_PerfLogEntry(FM_CHILD_TASK_PERF_ID);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- find the throttle of a file   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+uint32 FM_ChildThrottleSelect(const char *Path)
+{
+    uint32      Index        = FM_CHILD_THROTTLE_DEFAULT;
+    size_t      MatchLength  = 0;
+    size_t      VolumeLength = 0;
+    const char *Volume       = NULL;
+    uint32      i;
+
+    /* The longest volume that is a whole path prefix of the file wins */
+    for (i = FM_CHILD_THROTTLE_DEFAULT + 1; i < FM_CHILD_THROTTLE_ENTRIES; i++)
+    {
+        Volume       = FM_GlobalData.ChildThrottle[i].Volume;
+        VolumeLength = strlen(Volume);
+
+        if ((VolumeLength > MatchLength) && (strncmp(Path, Volume, VolumeLength) == 0) &&
+            ((Path[VolumeLength] == '\0') || (Path[VolumeLength] == '/') || (Volume[VolumeLength - 1] == '/')))
+        {
+            Index       = i;
+            MatchLength = VolumeLength;
+        }
+    }
+
+    return Index;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- charge one throttle entry     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+uint32 FM_ChildThrottleCharge(uint32 Index, OS_time_t Now, uint32 Bytes, uint32 Stats)
+{
+    FM_ChildThrottle_t *Throttle    = &FM_GlobalData.ChildThrottle[Index];
+    FM_ChildThrottle_t *Default     = &FM_GlobalData.ChildThrottle[FM_CHILD_THROTTLE_DEFAULT];
+    uint32              ByteRate    = Throttle->ByteRate;
+    uint32              StatRate    = Throttle->StatRate;
+    uint32              DelayMs     = 0;
+    uint32              StatDelayMs = 0;
+    int64               ElapsedUs   = 0;
+
+    /* Volume rates may follow the default rates */
+    if (ByteRate == FM_THROTTLE_RATE_DEFAULT)
+    {
+        ByteRate = Default->ByteRate;
+    }
+
+    if (StatRate == FM_THROTTLE_RATE_DEFAULT)
+    {
+        StatRate = Default->StatRate;
+    }
+
+    ElapsedUs            = OS_TimeGetTotalMicroseconds(OS_TimeSubtract(Now, Throttle->LastRefill));
+    Throttle->LastRefill = Now;
+
+    DelayMs     = FM_ChildThrottleBucket(&Throttle->ByteTokens, ByteRate, ElapsedUs, Bytes);
+    StatDelayMs = FM_ChildThrottleBucket(&Throttle->StatTokens, StatRate, ElapsedUs, Stats);
+
+    if (StatDelayMs > DelayMs)
+    {
+        DelayMs = StatDelayMs;
+    }
+
+    return DelayMs;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- refill and drain one bucket   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+uint32 FM_ChildThrottleBucket(int64 *Tokens, uint32 Rate, int64 ElapsedUs, uint32 Used)
+{
+    int64  Depth   = (int64)Rate * FM_CHILD_THROTTLE_BURST_MS * 1000;
+    uint32 DelayMs = 0;
+
+    if (Rate == FM_THROTTLE_RATE_UNLIMITED)
+    {
+        /* Nothing to pace, start from an empty bucket if a limit is set later */
+        *Tokens = 0;
+    }
+    else
+    {
+        /* Clock steps backwards and long idle times refill at most one burst */
+        if (ElapsedUs < 0)
+        {
+            ElapsedUs = 0;
+        }
+        else if (ElapsedUs > (FM_CHILD_THROTTLE_BURST_MS * 1000))
+        {
+            ElapsedUs = FM_CHILD_THROTTLE_BURST_MS * 1000;
+        }
+
+        *Tokens += (int64)Rate * ElapsedUs;
+
+        if (*Tokens > Depth)
+        {
+            *Tokens = Depth;
+        }
+
+        *Tokens -= (int64)Used * 1000000;
+
+        if (*Tokens < 0)
+        {
+            /* Sleep until the bucket is back to zero */
+            DelayMs = (uint32)((-*Tokens + ((int64)Rate * 1000) - 1) / ((int64)Rate * 1000));
+        }
+    }
+
+    return DelayMs;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- check for an abort request    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_ChildAbortCheck(FM_ChildWorker_t *Worker, const char *CmdText)
+{
+    uint32 AbortSequence = FM_ATOMIC_LOAD(&Worker->AbortSequence);
+
+    /* Only a request naming the command in progress stops it */
+    if ((Worker->Aborted == false) && (AbortSequence != 0) && (AbortSequence == Worker->CmdSequence))
+    {
+        Worker->Aborted = true;
 
-        FM_GlobalData.ChildCmdCounter++;
+        /* Send command failure event (error) */
+        CFE_EVS_SendEvent(FM_CHILD_ABORT_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "%s error: aborted by command: child task = %d", CmdText, (int)Worker->WorkerIndex);
     }
 
-    /* Report previous child task activity */
-    FM_GlobalData.ChildPreviousCC = CmdArgs->CommandCode;
-    FM_GlobalData.ChildCurrentCC  = 0;
+    return Worker->Aborted;
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* FM child task command handler -- Set File Permissions           */
+/* FM child task utility function -- resume checkpointed command   */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-void FM_ChildSetPermissionsCmd(const FM_ChildQueueEntry_t *CmdArgs)
+
+void FM_ChildCheckpointResume(FM_ChildWorker_t *Worker)
 {
-    int32       OS_Status = OS_SUCCESS;
-    const char *CmdText   = "Set Permissions";
+    FM_ChildCheckpoint_t *Checkpoint   = &Worker->Checkpoint;
+    FM_ChildQueueEntry_t *CmdArgs      = &Checkpoint->CmdArgs;
+    osal_id_t             FileHandle   = OS_OBJECT_ID_UNDEFINED;
+    int32                 BytesRead    = 0;
+    bool                  CommandKnown = false;
+    char                  FileName[OS_MAX_PATH_LEN];
 
-    OS_Status = OS_chmod(CmdArgs->Source1, CmdArgs->Mode);
+    FM_ChildCheckpointName(Worker, FileName, sizeof(FileName));
 
-    if (OS_Status == OS_SUCCESS)
+    /* There is no checkpoint file unless a command was cut off */
+    if (OS_OpenCreate(&FileHandle, FileName, OS_FILE_FLAG_NONE, OS_READ_ONLY) == OS_SUCCESS)
     {
-        FM_GlobalData.ChildCmdCounter++;
+        BytesRead = OS_read(FileHandle, Checkpoint, sizeof(*Checkpoint));
+        OS_close(FileHandle);
 
-        /* Send command completion event (info) */
-        CFE_EVS_SendEvent(FM_SET_PERM_CMD_INF_EID, CFE_EVS_EventType_INFORMATION, "%s command: file = %s, access = %d",
-                          CmdText, CmdArgs->Source1, (int)CmdArgs->Mode);
-    }
-    else
-    {
-        FM_GlobalData.ChildCmdErrCounter++;
+        /* The file is removed once the command ends, whether or not it could be resumed */
+        Worker->CheckpointSaved = true;
 
-        /* Send OS error message */
-        CFE_EVS_SendEvent(FM_SET_PERM_OS_ERR_EID, CFE_EVS_EventType_ERROR,
-                          "%s command: OS_chmod error, RC=0x%08X, file = %s, access = %d", CmdText,
-                          (unsigned int)OS_Status, CmdArgs->Source1, (int)CmdArgs->Mode);
-    }
+        CommandKnown = (CmdArgs->CommandCode == FM_COPY_FILE_CC) || (CmdArgs->CommandCode == FM_MOVE_FILE_CC) ||
+                       (CmdArgs->CommandCode == FM_CONCAT_FILES_CC) || (CmdArgs->CommandCode == FM_CONCAT_LIST_CC);
 
-    /* Report previous child task activity */
-    FM_GlobalData.ChildPreviousCC = CmdArgs->CommandCode;
-    FM_GlobalData.ChildCurrentCC  = 0;
+        if ((BytesRead != (int32)sizeof(*Checkpoint)) || (Checkpoint->Signature != FM_CHILD_CHECKPOINT_SIGNATURE) ||
+            (CommandKnown == false))
+        {
+            /* Send checkpoint failure event (error) */
+            CFE_EVS_SendEvent(FM_CHILD_CHECKPOINT_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Child Task %d error: invalid checkpoint discarded: file = %s", (int)Worker->WorkerIndex,
+                              FileName);
+
+            FM_ChildCheckpointEnd(Worker);
+        }
+        else
+        {
+            /* Never trust the string terminators read from a file */
+            CmdArgs->Source1[sizeof(CmdArgs->Source1) - 1]       = '\0';
+            CmdArgs->Source2[sizeof(CmdArgs->Source2) - 1]       = '\0';
+            CmdArgs->Target[sizeof(CmdArgs->Target) - 1]         = '\0';
+            CmdArgs->SourceList[sizeof(CmdArgs->SourceList) - 1] = '\0';
+
+            Worker->CmdArgs  = *CmdArgs;
+            Worker->Resuming = true;
+
+            OS_MutSemTake(FM_GlobalData.ChildDequeueSem);
+            FM_ChildClaimPaths(Worker);
+            OS_MutSemGive(FM_GlobalData.ChildDequeueSem);
+
+            FM_ChildWaitForPaths(Worker);
+            FM_ChildExecute(Worker);
+            FM_ChildReleasePaths(Worker);
+        }
+    }
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* FM child task utility function -- create dir list output file   */
+/* FM child task utility function -- start checkpointed command    */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-bool FM_ChildDirListFileInit(osal_id_t *FileHandlePtr, const char *Directory, const char *Filename)
+void FM_ChildCheckpointBegin(FM_ChildWorker_t *Worker, const FM_ChildQueueEntry_t *CmdArgs)
 {
-    const char *    CmdText       = "Directory List to File";
-    bool            CommandResult = true;
-    CFE_FS_Header_t FileHeader;
-    osal_id_t       FileHandle   = OS_OBJECT_ID_UNDEFINED;
-    int32           BytesWritten = 0;
-    int32           Status       = 0;
+    /* A resumed command keeps the record read from its checkpoint file */
+    if (Worker->Resuming == false)
+    {
+        memset(&Worker->Checkpoint, 0, sizeof(Worker->Checkpoint));
 
-    /* Initialize the standard cFE File Header for the Directory Listing File */
-    CFE_FS_InitHeader(&FileHeader, CmdText, FM_DIR_LIST_FILE_SUBTYPE);
+        Worker->Checkpoint.Signature = FM_CHILD_CHECKPOINT_SIGNATURE;
+        Worker->Checkpoint.CmdArgs   = *CmdArgs;
+    }
+}
 
-    /* Create directory listing output file */
-    Status = OS_OpenCreate(&FileHandle, Filename, OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE, OS_READ_WRITE);
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- start checkpointed source     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-    if (Status == OS_SUCCESS)
+bool FM_ChildCheckpointSource(FM_ChildWorker_t *Worker, uint32 SourceIndex, const char *Source, const char *Target,
+                              const char *CmdText, uint32 *ResumeOffset)
+{
+    FM_ChildCheckpoint_t *Checkpoint = &Worker->Checkpoint;
+    bool                  Result     = true;
+    int32                 Status     = OS_SUCCESS;
+    uint32                SourceSize = 0;
+    uint32                SourceTime = 0;
+    uint32                TargetSize = 0;
+    uint32                TargetTime = 0;
+    uint32                FileMode   = 0;
+
+    *ResumeOffset = 0;
+
+    if (Worker->Resuming)
     {
-        /* Write the standard CFE file header */
-        BytesWritten = CFE_FS_WriteHeader(FileHandle, &FileHeader);
-        if (BytesWritten == sizeof(CFE_FS_Header_t))
-        {
-            /* Initialize directory statistics structure */
-            memset(&FM_GlobalData.DirListFileStats, 0, sizeof(FM_GlobalData.DirListFileStats));
-            strncpy(FM_GlobalData.DirListFileStats.DirName, Directory, OS_MAX_PATH_LEN - 1);
-            FM_GlobalData.DirListFileStats.DirName[OS_MAX_PATH_LEN - 1] = '\0';
+        Worker->Resuming = false;
 
-            /* Write blank FM directory statistics structure as a placeholder */
-            BytesWritten = OS_write(FileHandle, &FM_GlobalData.DirListFileStats, sizeof(FM_DirListFileStats_t));
-            if (BytesWritten == sizeof(FM_DirListFileStats_t))
-            {
-                /* Return output file handle */
-                *FileHandlePtr = FileHandle;
-            }
-            else
-            {
-                CommandResult = false;
-                FM_GlobalData.ChildCmdErrCounter++;
+        Status = FM_ChildSizeTimeMode(Source, &SourceSize, &SourceTime, &FileMode);
 
-                /* Send command failure event (error) */
-                CFE_EVS_SendEvent(FM_GET_DIR_FILE_WRBLANK_ERR_EID, CFE_EVS_EventType_ERROR,
-                                  "%s error: OS_write blank stats failed: result = %d, expected = %u", CmdText,
-                                  (int)BytesWritten, (unsigned int)sizeof(FM_DirListFileStats_t));
-            }
+        if (Status == OS_SUCCESS)
+        {
+            Status = FM_ChildSizeTimeMode(Target, &TargetSize, &TargetTime, &FileMode);
         }
-        else
+
+        /* The source must be unchanged and the target must still hold the checkpointed data */
+        if ((Status != OS_SUCCESS) || (SourceIndex != Checkpoint->SourceIndex) ||
+            (SourceSize != Checkpoint->SourceSize) || (SourceTime != Checkpoint->SourceTime) ||
+            (Checkpoint->SourceOffset > SourceSize) ||
+            (TargetSize < (Checkpoint->TargetBase + Checkpoint->SourceOffset)))
         {
-            CommandResult = false;
-            FM_GlobalData.ChildCmdErrCounter++;
+            Result = false;
 
-            /* Send command failure event (error) */
-            CFE_EVS_SendEvent(FM_GET_DIR_FILE_WRHDR_ERR_EID, CFE_EVS_EventType_ERROR,
-                              "%s error: CFE_FS_WriteHeader failed: result = %d, expected = %u", CmdText,
-                              (int)BytesWritten, (unsigned int)sizeof(CFE_FS_Header_t));
+            /* Send checkpoint failure event (error) */
+            CFE_EVS_SendEvent(FM_CHILD_CHECKPOINT_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "%s error: checkpoint does not match files: src = %s, tgt = %s", CmdText, Source,
+                              Target);
         }
-
-        /* Close output file after write error */
-        if (CommandResult == false)
+        else
         {
-            OS_close(FileHandle);
+            *ResumeOffset     = Checkpoint->SourceOffset;
+            Worker->CopyBytes = Checkpoint->TargetBase + Checkpoint->SourceOffset;
+
+            /* Send resume event (info) */
+            CFE_EVS_SendEvent(FM_CHILD_RESUME_INF_EID, CFE_EVS_EventType_INFORMATION,
+                              "%s resumed from checkpoint: src = %s, offset = %lu, tgt = %s", CmdText, Source,
+                              (unsigned long)Checkpoint->SourceOffset, Target);
         }
     }
     else
     {
-        CommandResult = false;
-        FM_GlobalData.ChildCmdErrCounter++;
+        /* Each source starts where the previous one ended */
+        Checkpoint->SourceIndex  = SourceIndex;
+        Checkpoint->TargetBase   = (uint32)Worker->CopyBytes;
+        Checkpoint->SourceOffset = 0;
+        Checkpoint->SourceSize   = 0;
+        Checkpoint->SourceTime   = 0;
+
+        /* A resumed source is checked against the size and time it had when its copy started */
+        FM_ChildSizeTimeMode(Source, &Checkpoint->SourceSize, &Checkpoint->SourceTime, &FileMode);
+    }
 
-        /* Send command failure event (error) */
-        CFE_EVS_SendEvent(FM_GET_DIR_FILE_OSCREAT_ERR_EID, CFE_EVS_EventType_ERROR,
-                          "%s error: OS_OpenCreate failed: result = %d, file = %s", CmdText, (int)Status, Filename);
+    if (Result == true)
+    {
+        /* Report the bytes left to copy from this source */
+        FM_ChildProgressSource(Worker, Source, Target, Checkpoint->SourceSize - *ResumeOffset);
     }
 
-    return CommandResult;
+    Worker->CheckpointNext = 0;
+
+    if ((Result == true) && (FM_CHILD_CHECKPOINT_INTERVAL != 0) &&
+        (Worker->CopyBytes <= FM_CHILD_CHECKPOINT_MAX_OFFSET))
+    {
+        Worker->CheckpointNext = *ResumeOffset + FM_CHILD_CHECKPOINT_INTERVAL;
+    }
+
+    return Result;
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* FM child task utility function -- write to dir list output file */
+/* FM child task utility function -- position files at checkpoint  */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-void FM_ChildDirListFileLoop(osal_id_t DirId, osal_id_t FileHandle, const char *Directory, const char *DirWithSep,
-                             const char *Filename, uint8 getSizeTimeMode)
+bool FM_ChildCheckpointSeek(FM_ChildWorker_t *Worker, osal_id_t FileHandleSrc, osal_id_t FileHandleTgt,
+                            const char *CmdText)
 {
-    const char *      CmdText                   = "Directory List to File";
-    size_t            WriteLength               = sizeof(FM_DirListEntry_t);
-    bool              ReadingDirectory          = true;
-    bool              CommandResult             = true;
-    uint32            DirEntries                = 0;
-    uint32            FileEntries               = 0;
-    size_t            EntryLength               = 0;
-    size_t            PathLength                = 0;
-    int32             BytesWritten              = 0;
-    int32             FilesTillSleep            = FM_CHILD_STAT_SLEEP_FILECOUNT;
-    int32             Status                    = 0;
-    char              TempName[OS_MAX_PATH_LEN] = "\0";
-    os_dirent_t       DirEntry;
-    FM_DirListEntry_t DirListData;
-
-    memset(&DirEntry, 0, sizeof(DirEntry));
+    bool  Result       = true;
+    int32 SourceOffset = Worker->Checkpoint.SourceOffset;
+    int32 TargetOffset = Worker->Checkpoint.TargetBase + Worker->Checkpoint.SourceOffset;
+    int32 SourceResult = 0;
+    int32 TargetResult = 0;
 
-    PathLength = strlen(DirWithSep);
+    SourceResult = OS_lseek(FileHandleSrc, SourceOffset, OS_SEEK_SET);
+    TargetResult = OS_lseek(FileHandleTgt, TargetOffset, OS_SEEK_SET);
 
-    /* Until end of directory entries or output file write error */
-    while ((CommandResult == true) && (ReadingDirectory == true))
+    if ((SourceResult != SourceOffset) || (TargetResult != TargetOffset))
     {
-        Status = OS_DirectoryRead(DirId, &DirEntry);
+        Result = false;
 
-        /* Normal loop end - no more directory entries */
-        if (Status != OS_SUCCESS)
-        {
-            ReadingDirectory = false;
-        }
-        else if ((strcmp(OS_DIRENTRY_NAME(DirEntry), FM_THIS_DIRECTORY) != 0) &&
-                 (strcmp(OS_DIRENTRY_NAME(DirEntry), FM_PARENT_DIRECTORY) != 0))
-        {
-            /* Do not count the "." and ".." files */
-            DirEntries++;
+        /* Send checkpoint failure event (error) */
+        CFE_EVS_SendEvent(FM_CHILD_CHECKPOINT_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "%s error: OS_lseek to checkpoint failed: result = %d/%d, offset = %d/%d", CmdText,
+                          (int)SourceResult, (int)TargetResult, (int)SourceOffset, (int)TargetOffset);
+    }
 
-            /* Count all files - write limited number */
-            if (FileEntries < FM_DIR_LIST_FILE_ENTRIES)
-            {
-                EntryLength = strlen(OS_DIRENTRY_NAME(DirEntry));
+    return Result;
+}
 
-                /*
-                 * DirListData.EntryName and TempName are both OS_MAX_PATH_LEN, DirEntry name is OS_MAX_FILE_NAME,
-                 * so limiting test is PathLength and EntryLength together
-                 */
-                if ((PathLength + EntryLength) < sizeof(TempName))
-                {
-                    /* Build qualified directory entry name */
-                    memcpy(TempName, DirWithSep, PathLength);
-                    memcpy(&TempName[PathLength], OS_DIRENTRY_NAME(DirEntry), EntryLength);
-                    TempName[PathLength + EntryLength] = '\0';
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- save copy checkpoint          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-                    /*
-                     * Populate directory list file entry -
-                     * Note this is guaranteed to be null-terminated due to the memset()
-                     * this will leave at least one null char after the string.
-                     */
-                    memset(&DirListData, 0, sizeof(DirListData));
-                    strncpy(DirListData.EntryName, OS_DIRENTRY_NAME(DirEntry), sizeof(DirListData.EntryName) - 1);
+void FM_ChildCheckpointSave(FM_ChildWorker_t *Worker, uint32 Bytes)
+{
+    FM_ChildCheckpoint_t *Checkpoint = &Worker->Checkpoint;
+    osal_id_t             FileHandle = OS_OBJECT_ID_UNDEFINED;
+    int32                 Status     = OS_SUCCESS;
+    char                  FileName[OS_MAX_PATH_LEN];
 
-                    FM_ChildSleepStat(TempName, &DirListData, &FilesTillSleep, getSizeTimeMode);
+    /* Bytes known to be written to the target file */
+    Checkpoint->SourceOffset += Bytes;
 
-                    /* Write directory list file entry to output file */
-                    BytesWritten = OS_write(FileHandle, &DirListData, WriteLength);
+    if ((Worker->CheckpointNext != 0) && (Checkpoint->SourceOffset >= Worker->CheckpointNext))
+    {
+        FM_ChildCheckpointName(Worker, FileName, sizeof(FileName));
 
-                    if (BytesWritten == WriteLength)
-                    {
-                        FileEntries++;
-                    }
-                    else
-                    {
-                        CommandResult = false;
-                        FM_GlobalData.ChildCmdErrCounter++;
+        Status = OS_OpenCreate(&FileHandle, FileName, OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE, OS_WRITE_ONLY);
 
-                        /* Send command failure event (error) */
-                        CFE_EVS_SendEvent(FM_GET_DIR_FILE_WRENTRY_ERR_EID, CFE_EVS_EventType_ERROR,
-                                          "%s error: OS_write entry failed: result = %d, expected = %d", CmdText,
-                                          (int)BytesWritten, (int)WriteLength);
-                    }
-                }
-                else
-                {
-                    FM_GlobalData.ChildCmdWarnCounter++;
+        if (Status == OS_SUCCESS)
+        {
+            Worker->CheckpointSaved = true;
 
-                    /* Send command failure event (error) */
-                    CFE_EVS_SendEvent(FM_GET_DIR_FILE_WARNING_EID, CFE_EVS_EventType_INFORMATION,
-                                      "%s error: combined directory and entry name too long: dir = %s, entry = %s",
-                                      CmdText, Directory, OS_DIRENTRY_NAME(DirEntry));
-                }
-            }
+            Status = OS_write(FileHandle, Checkpoint, sizeof(*Checkpoint));
+            OS_close(FileHandle);
         }
-    }
-
-    /* Update directory statistics in output file */
-    if ((CommandResult == true) && (DirEntries != 0))
-    {
-        /* Update entries found in directory vs entries written to file */
-        FM_GlobalData.DirListFileStats.DirEntries  = DirEntries;
-        FM_GlobalData.DirListFileStats.FileEntries = FileEntries;
-
-        /* Back up to the start of the statistics data */
-        OS_lseek(FileHandle, sizeof(CFE_FS_Header_t), OS_SEEK_SET);
-
-        /* Write an updated version of the statistics data */
-        WriteLength  = sizeof(FM_DirListFileStats_t);
-        BytesWritten = OS_write(FileHandle, &FM_GlobalData.DirListFileStats, WriteLength);
 
-        if (BytesWritten != WriteLength)
+        if (Status != (int32)sizeof(*Checkpoint))
         {
-            CommandResult = false;
-            FM_GlobalData.ChildCmdErrCounter++;
+            /* Carry on without checkpoints rather than fail the command */
+            Worker->CheckpointNext = 0;
 
-            /* Send command failure event (error) */
-            CFE_EVS_SendEvent(FM_GET_DIR_FILE_UPSTATS_ERR_EID, CFE_EVS_EventType_ERROR,
-                              "%s error: OS_write update stats failed: result = %d, expected = %d", CmdText,
-                              (int)BytesWritten, (int)WriteLength);
+            /* Send checkpoint failure event (error) */
+            CFE_EVS_SendEvent(FM_CHILD_CHECKPOINT_SAVE_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Child Task %d error: checkpoint save failed: result = %d, file = %s",
+                              (int)Worker->WorkerIndex, (int)Status, FileName);
+        }
+        else if ((Checkpoint->TargetBase + Checkpoint->SourceOffset) > FM_CHILD_CHECKPOINT_MAX_OFFSET)
+        {
+            /* The next checkpoint would be out of reach of OS_lseek */
+            Worker->CheckpointNext = 0;
+        }
+        else
+        {
+            Worker->CheckpointNext = Checkpoint->SourceOffset + FM_CHILD_CHECKPOINT_INTERVAL;
         }
     }
+}
 
-    /* Send command completion event (info) */
-    if (CommandResult == true)
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- end checkpointed command      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_ChildCheckpointEnd(FM_ChildWorker_t *Worker)
+{
+    char FileName[OS_MAX_PATH_LEN];
+
+    Worker->CheckpointNext = 0;
+    Worker->Resuming       = false;
+
+    /* Completed, failed and aborted commands are never resumed */
+    if (Worker->CheckpointSaved)
     {
-        FM_GlobalData.ChildCmdCounter++;
+        FM_ChildCheckpointName(Worker, FileName, sizeof(FileName));
+        OS_remove(FileName);
 
-        CFE_EVS_SendEvent(FM_GET_DIR_FILE_CMD_INF_EID,
-                          CFE_EVS_EventType_INFORMATION, "%s command: wrote %d of %d names: dir = %s, filename = %s",
-                          CmdText, (int)FileEntries, (int)DirEntries, Directory, Filename);
+        Worker->CheckpointSaved = false;
     }
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* FM child task utility function -- get dir entry size and time   */
+/* FM child task utility function -- checkpoint file name          */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-int32 FM_ChildSizeTimeMode(const char *Filename, uint32 *FileSize, uint32 *FileTime, uint32 *FileMode)
+void FM_ChildCheckpointName(const FM_ChildWorker_t *Worker, char *FileName, uint32 BufferSize)
 {
-    int32      Result = OS_SUCCESS;
-    os_fstat_t FileStatus;
+    snprintf(FileName, BufferSize, "%s%u", FM_CHILD_CHECKPOINT_FILE, (unsigned int)Worker->WorkerIndex);
+}
 
-    memset(&FileStatus, 0, sizeof(FileStatus));
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility function -- start command progress        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-    Result = OS_stat(Filename, &FileStatus);
+void FM_ChildProgressBegin(FM_ChildWorker_t *Worker)
+{
+    Worker->ProgressBytes = 0;
+    Worker->ProgressTotal = 0;
 
-    if (Result != OS_SUCCESS)
-    {
-        *FileSize = 0;
-        *FileTime = 0;
-        *FileMode = 0;
-    }
-    else
-    {
-        *FileTime = OS_FILESTAT_TIME(FileStatus);
-        *FileSize = OS_FILESTAT_SIZE(FileStatus);
-        *FileMode = OS_FILESTAT_MODE(FileStatus);
-    }
+    /* Commands without a file loop report only their arguments and elapsed time */
+    strncpy(Worker->ProgressSource, Worker->CmdArgs.Source1, sizeof(Worker->ProgressSource) - 1);
+    strncpy(Worker->ProgressTarget, Worker->CmdArgs.Target, sizeof(Worker->ProgressTarget) - 1);
+    Worker->ProgressSource[sizeof(Worker->ProgressSource) - 1] = '\0';
+    Worker->ProgressTarget[sizeof(Worker->ProgressTarget) - 1] = '\0';
 
-    return Result;
+    OS_GetLocalTime(&Worker->ProgressStart);
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* FM child task utility function -- sleep between OS_stat on files*/
+/* FM child task utility function -- start source file progress    */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-void FM_ChildSleepStat(const char *Filename, FM_DirListEntry_t *DirListData, int32 *FilesTillSleep,
-                       bool getSizeTimeMode)
+void FM_ChildProgressSource(FM_ChildWorker_t *Worker, const char *Source, const char *Target, uint32 Bytes)
 {
-    /* Check if command requested size and time */
-    if (getSizeTimeMode == true)
-    {
-        if (*FilesTillSleep <= 0)
-        {
-            CFE_ES_PerfLogExit(FM_CHILD_TASK_PERF_ID);
-            OS_TaskDelay(FM_CHILD_STAT_SLEEP_MS);
-            CFE_ES_PerfLogEntry(FM_CHILD_TASK_PERF_ID);
-            *FilesTillSleep = FM_CHILD_STAT_SLEEP_FILECOUNT;
-        }
-
-        /* Get file size, date, and mode */
-        FM_ChildSizeTimeMode(Filename, &(DirListData->EntrySize), &(DirListData->ModifyTime), &(DirListData->Mode));
+    strncpy(Worker->ProgressSource, Source, sizeof(Worker->ProgressSource) - 1);
+    strncpy(Worker->ProgressTarget, Target, sizeof(Worker->ProgressTarget) - 1);
+    Worker->ProgressSource[sizeof(Worker->ProgressSource) - 1] = '\0';
+    Worker->ProgressTarget[sizeof(Worker->ProgressTarget) - 1] = '\0';
 
-        (*FilesTillSleep)--;
-    }
-    else
-    {
-        DirListData->EntrySize  = 0;
-        DirListData->ModifyTime = 0;
-        DirListData->Mode       = 0;
-    }
+    /* Concat sources add to the total as each one is started */
+    Worker->ProgressTotal += Bytes;
 }
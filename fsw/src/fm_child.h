@@ -26,6 +26,7 @@
 
 #include "cfe.h"
 #include "fm_msg.h"
+#include "fm_app.h"
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
@@ -38,9 +39,11 @@
  *
  *  \par Description
  *       This function is invoked during FM application startup initialization to
- *       create and initialize the FM Child Task.  The purpose for the child task
- *       is to process FM application commands that take too long to execute within
- *       the main task.
+ *       create and initialize the pool of #FM_CHILD_TASK_COUNT FM Child Tasks.  The
+ *       purpose for the child tasks is to process FM application commands that take
+ *       too long to execute within the main task.  All child tasks share a single
+ *       command queue, so a slow command on one child task does not block commands
+ *       taken from the queue by the others.
  *
  *  \par Assumptions, External Events, and Notes:
  *
@@ -62,6 +65,10 @@ CFE_Status_t FM_ChildInit(void);
  *       handshake with the parent task, this function will self delete as a child
  *       task with CFE. There is no return from #CFE_ES_DeleteChildTask.
  *
+ *       Every child task in the pool runs this function.  On entry each task
+ *       claims the next unused #FM_ChildWorker_t slot.  The handshake semaphore
+ *       is only cleared when the last running child task terminates.
+ *
  *  \par Assumptions, External Events, and Notes:
  *
  *  \sa #CFE_ES_DeleteChildTask, #FM_ChildLoop
@@ -79,27 +86,262 @@ void FM_ChildTask(void);
  *       until the child task is terminated by the CFE, or until a fatal error
  *       occurs which causes the child task to terminate itself.  Fatal errors are
  *       defined as any error returned by #OS_CountSemTake or if the handshake
- *       queue is empty, or if the read index for the handshake queue is invalid.
+ *       queue is empty, or if the read index for either queue lane is invalid.
  *
  *  \par Assumptions, External Events, and Notes:
  *
+ *  \param [in,out] Worker A pointer to the child task worker running this loop.
+ *
  *  \sa #FM_ChildQueueEntry_t, #FM_ChildProcess
  */
-void FM_ChildLoop(void);
+void FM_ChildLoop(FM_ChildWorker_t *Worker);
+
+/**
+ *  \brief Child Copy Writer Task Entry Point Function
+ *
+ *  \par Description
+ *       This function is the entry point for the copy writer task of a child
+ *       task.  On entry each writer task claims the next #FM_ChildWorker_t
+ *       slot without a writer and calls the writer main loop function.  Should
+ *       the main loop return, later copies made by that worker read and write
+ *       in turn, and a copy still waiting on the writer task is failed.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Writer tasks are only created when #FM_CHILD_COPY_BUFFER_COUNT is
+ *       greater than 1.
+ *
+ *  \sa #FM_ChildWriterLoop, #FM_ChildCopyStream
+ */
+void FM_ChildWriterTask(void);
+
+/**
+ *  \brief Child Copy Writer Task Main Loop Processor Function
+ *
+ *  \par Description
+ *       This function waits for the child task to fill a copy buffer, writes
+ *       it to the target file of the copy in progress and hands the empty
+ *       buffer back.  Buffers are drained in the order they were filled.  The
+ *       function returns if the filled buffer semaphore take fails.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *
+ *  \param [in,out] Worker A pointer to the child task worker served by this writer.
+ *
+ *  \sa #FM_ChildCopyWrite
+ */
+void FM_ChildWriterLoop(FM_ChildWorker_t *Worker);
+
+/**
+ *  \brief Child CRC Helper Task Entry Point Function
+ *
+ *  \par Description
+ *       This function is the entry point for each CRC helper task.  On entry
+ *       each helper task claims the next #FM_CrcHelper_t slot and calls the
+ *       helper main loop function.  Should the main loop return, later CRCs
+ *       are split between the remaining helpers, and a range still waiting
+ *       on the helper task is failed.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Helper tasks are only created when #FM_CHILD_CRC_SPLIT_SIZE is not
+ *       zero.
+ *
+ *  \sa #FM_ChildCrcHelperLoop, #FM_ChildCrcParallel
+ */
+void FM_ChildCrcHelperTask(void);
+
+/**
+ *  \brief Child CRC Helper Task Main Loop Processor Function
+ *
+ *  \par Description
+ *       This function waits for a child task to hand over a range of a file,
+ *       computes the CRC-16 of the range and reports it finished.  The
+ *       function returns if the start semaphore take fails.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *
+ *  \param [in,out] Helper      A pointer to the helper slot of this task.
+ *  \param [in]     HelperIndex Index of the helper slot, for event text.
+ *
+ *  \sa #FM_ChildCrcRange
+ */
+void FM_ChildCrcHelperLoop(FM_CrcHelper_t *Helper, uint8 HelperIndex);
+
+/**
+ *  \brief Child Task Queue Lane Selection Function
+ *
+ *  \par Description
+ *       This function selects the queue lane that the next command is taken
+ *       from.  Fast lane commands are taken ahead of bulk lane commands, but
+ *       after #FM_CHILD_FAST_LANE_BURST fast lane commands in a row have been
+ *       taken while the bulk lane was waiting, one bulk lane command is taken
+ *       unless a fast lane command waiting ahead of it works on the same
+ *       names (see #FM_ChildLaneOverlaps).
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Must be called while holding the child task dequeue mutex, with at
+ *       least one command pending in either lane.
+ *
+ *  \return Child task queue lane
+ *  \retval #FM_CHILD_LANE_FAST Take the next command from the fast lane
+ *  \retval #FM_CHILD_LANE_BULK Take the next command from the bulk lane
+ *
+ *  \sa #FM_GetChildLane
+ */
+uint8 FM_ChildSelectLane(void);
+
+/**
+ *  \brief Child Task Queued Path Load Function
+ *
+ *  \par Description
+ *       This function copies a path name stored in the child task path block
+ *       pool by #FM_StoreChildPath into the caller's buffer, releasing each
+ *       block back to the parent as soon as its contents have been copied.
+ *       A zero reference produces an empty string.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Every block of the chain is released even if the name does not fit
+ *       in the buffer, in which case the name is truncated.
+ *
+ *  \param [in]  PathRef    First block of the stored path name (block index + 1).
+ *  \param [out] Path       Buffer that receives the path name.
+ *  \param [in]  BufferSize Size of the buffer, in bytes.
+ *
+ *  \sa #FM_StoreChildPath, #FM_ChildProcess
+ */
+void FM_ChildLoadPath(uint16 PathRef, char *Path, uint32 BufferSize);
+
+/**
+ *  \brief Child Task Claim Command Paths Function
+ *
+ *  \par Description
+ *       This function gives the command just taken by a worker the next
+ *       dispatch number and records its names, so that a command taken
+ *       later by another worker on the same names waits for it.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Must be called while holding the queue dequeue mutex.
+ *
+ *  \param [in,out] Worker A pointer to the child task worker holding the command.
+ *
+ *  \sa #FM_ChildWaitForPaths, #FM_ChildReleasePaths
+ */
+void FM_ChildClaimPaths(FM_ChildWorker_t *Worker);
+
+/**
+ *  \brief Child Task Command Paths Busy Function
+ *
+ *  \par Description
+ *       This function tests whether another worker is running a command
+ *       taken before the worker's command whose names overlap its names
+ *       (see #FM_PathSetsOverlap).
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Must be called while holding the queue dequeue mutex.
+ *
+ *  \param [in] Worker A pointer to the child task worker holding the command.
+ *
+ *  \return Boolean busy response
+ *  \retval true  An earlier command on the same names is still running
+ *  \retval false The command may start
+ */
+bool FM_ChildPathsBusy(const FM_ChildWorker_t *Worker);
+
+/**
+ *  \brief Child Task Wait For Command Paths Function
+ *
+ *  \par Description
+ *       This function delays the worker, #FM_CHILD_PATH_WAIT_MS at a time,
+ *       until no command taken earlier by another worker on the same names
+ *       is still running.  Commands working on the same names therefore run
+ *       in the order they were taken from the queue, as they did with a
+ *       single child task.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Only earlier commands are waited for, so two workers never wait
+ *       for each other.
+ *
+ *  \param [in] Worker A pointer to the child task worker holding the command.
+ *
+ *  \sa #FM_ChildClaimPaths, #FM_ChildPathsBusy
+ */
+void FM_ChildWaitForPaths(FM_ChildWorker_t *Worker);
+
+/**
+ *  \brief Child Task Release Command Paths Function
+ *
+ *  \par Description
+ *       This function marks the worker idle once its command has finished,
+ *       releasing the commands waiting for its names.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *
+ *  \param [in,out] Worker A pointer to the child task worker that ran the command.
+ *
+ *  \sa #FM_ChildClaimPaths
+ */
+void FM_ChildReleasePaths(FM_ChildWorker_t *Worker);
 
 /**
  *  \brief Child Task Command Queue Processor Function
  *
  *  \par Description
- *       This function routes control to the appropriate child task command
- *       handler.  After the command handler has finished, this function then
- *       updates the queue access variables to point to the next queue entry.
+ *       This function takes the next entry from the handshake queue lanes (see
+ *       #FM_ChildSelectLane), copying the command arguments and path names
+ *       (see #FM_ChildLoadPath) into the worker before publishing the new lane
+ *       read index, so that the queue entry may
+ *       be reused by the parent while the command executes.  The time the
+ *       command waited in the queue is recorded.  It then executes the command
+ *       (see #FM_ChildExecute) once no earlier command on the same names is
+ *       running on another worker (see #FM_ChildWaitForPaths).  Entries dropped by #FM_FLUSH_QUEUE_CC are taken
+ *       off the queue without being executed.
  *
  *  \par Assumptions, External Events, and Notes:
  *
+ *  \param [in,out] Worker A pointer to the child task worker executing the command.
+ *
  *  \sa #FM_ChildQueueEntry_t, #FM_ChildTask
  */
-void FM_ChildProcess(void);
+void FM_ChildProcess(FM_ChildWorker_t *Worker);
+
+/**
+ *  \brief Child Task Command Execution Function
+ *
+ *  \par Description
+ *       This function numbers the command held in #FM_ChildWorker_t.CmdArgs
+ *       for #FM_ChildAbortCheck and routes control to the appropriate child
+ *       task command handler.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Commands are taken from the queue by #FM_ChildProcess, or read from
+ *       the checkpoint file by #FM_ChildCheckpointResume.
+ *
+ *  \param [in,out] Worker A pointer to the child task worker executing the command.
+ */
+void FM_ChildExecute(FM_ChildWorker_t *Worker);
+
+/**
+ *  \brief Child Task Command Verification Function
+ *
+ *  \par Description
+ *       This function checks the file system state of the arguments of a
+ *       command queued in #FM_VERIFY_MODE_CHILD.  The checks, event IDs and
+ *       event text are those the main task command handler would have used
+ *       in #FM_VERIFY_MODE_MAIN.  For the Get File Info command it fills in
+ *       the file state, size, time and mode instead.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The main task has already checked that each name is terminated.
+ *
+ *  \param [in,out] Worker  A pointer to the worker running the command.
+ *  \param [in,out] CmdArgs A pointer to the command held by the worker.
+ *
+ *  \return Boolean verification response
+ *  \retval true  Arguments are in the required state
+ *  \retval false An argument is not in the required state, an error event was sent
+ *
+ *  \sa #FM_SET_VERIFY_MODE_CC, #FM_VerifyFileState
+ */
+bool FM_ChildVerifyCmd(FM_ChildWorker_t *Worker, FM_ChildQueueEntry_t *CmdArgs);
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
@@ -117,12 +359,13 @@ void FM_ChildProcess(void);
  *
  *  \par Assumptions, External Events, and Notes:
  *
+ *  \param [in,out] Worker A pointer to the child task worker executing the command.
  *  \param [in] CmdArgs A pointer to an entry in the child task handshake command
  *       queue which contains the arguments necessary to process this command.
  *
  *  \sa #FM_ChildQueueEntry_t, #FM_CopyFileCmd_t
  */
-void FM_ChildCopyCmd(const FM_ChildQueueEntry_t *CmdArgs);
+void FM_ChildCopyCmd(FM_ChildWorker_t *Worker, const FM_ChildQueueEntry_t *CmdArgs);
 
 /**
  *  \brief Child Task Move File Command Handler
@@ -134,12 +377,13 @@ void FM_ChildCopyCmd(const FM_ChildQueueEntry_t *CmdArgs);
  *
  *  \par Assumptions, External Events, and Notes:
  *
+ *  \param [in,out] Worker A pointer to the child task worker executing the command.
  *  \param [in] CmdArgs A pointer to an entry in the child task handshake command
  *       queue which contains the arguments necessary to process this command.
  *
  *  \sa #FM_ChildQueueEntry_t, #FM_MoveFileCmd_t
  */
-void FM_ChildMoveCmd(const FM_ChildQueueEntry_t *CmdArgs);
+void FM_ChildMoveCmd(FM_ChildWorker_t *Worker, const FM_ChildQueueEntry_t *CmdArgs);
 
 /**
  *  \brief Child Task Rename File Command Handler
@@ -151,12 +395,13 @@ void FM_ChildMoveCmd(const FM_ChildQueueEntry_t *CmdArgs);
  *
  *  \par Assumptions, External Events, and Notes:
  *
+ *  \param [in,out] Worker A pointer to the child task worker executing the command.
  *  \param [in] CmdArgs A pointer to an entry in the child task handshake command
  *       queue which contains the arguments necessary to process this command.
  *
  *  \sa #FM_ChildQueueEntry_t, #FM_RenameFileCmd_t
  */
-void FM_ChildRenameCmd(const FM_ChildQueueEntry_t *CmdArgs);
+void FM_ChildRenameCmd(FM_ChildWorker_t *Worker, const FM_ChildQueueEntry_t *CmdArgs);
 
 /**
  *  \brief Child Task Delete File Command Handler
@@ -168,12 +413,13 @@ void FM_ChildRenameCmd(const FM_ChildQueueEntry_t *CmdArgs);
  *
  *  \par Assumptions, External Events, and Notes:
  *
+ *  \param [in,out] Worker A pointer to the child task worker executing the command.
  *  \param [in] CmdArgs A pointer to an entry in the child task handshake command
  *       queue which contains the arguments necessary to process this command.
  *
  *  \sa #FM_ChildQueueEntry_t, #FM_DeleteFileCmd_t
  */
-void FM_ChildDeleteCmd(const FM_ChildQueueEntry_t *CmdArgs);
+void FM_ChildDeleteCmd(FM_ChildWorker_t *Worker, const FM_ChildQueueEntry_t *CmdArgs);
 
 /**
  *  \brief Child Task Delete All Files Command Handler
@@ -185,12 +431,120 @@ void FM_ChildDeleteCmd(const FM_ChildQueueEntry_t *CmdArgs);
  *
  *  \par Assumptions, External Events, and Notes:
  *
+ *  \param [in,out] Worker A pointer to the child task worker executing the command.
  *  \param [in] CmdArgs A pointer to an entry in the child task handshake command
  *       queue which contains the arguments necessary to process this command.
  *
  *  \sa #FM_ChildQueueEntry_t, #FM_DeleteAllFilesCmd_t
  */
-void FM_ChildDeleteAllFilesCmd(FM_ChildQueueEntry_t *CmdArgs);
+void FM_ChildDeleteAllFilesCmd(FM_ChildWorker_t *Worker, FM_ChildQueueEntry_t *CmdArgs);
+
+/**
+ *  \brief Child Task Delete All Files Collect Utility Function
+ *
+ *  \par Description
+ *       This function reads directory entries and adds the name of each
+ *       closed file to the worker delete list.  Reading stops at the end of
+ *       the directory, when the list has no room for another name of up to
+ *       #OS_MAX_PATH_LEN bytes, or when the command is aborted.  With
+ *       Descend set each sub-directory is pushed onto the worker delete
+ *       tree stack, otherwise sub-directories are skipped.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Entries are added after the names already in the list.  Entries are
+ *       read with #FM_ChildDirectoryNext, so the entries counted before the
+ *       read started over are passed over.
+ *
+ *  \param [in,out] Worker          A pointer to the child task worker executing the command.
+ *  \param [in] DirId               Handle of the open directory.
+ *  \param [in] DirWithSep          Directory name plus separator.
+ *  \param [in] CmdText             Command name used in the abort event.
+ *  \param [in] Descend             Push sub-directories instead of skipping them.
+ *  \param [in,out] NotDeletedCount Counter of the files that will not be removed.
+ *  \param [in,out] SkippedCount    Counter of the directories skipped or not fitting on the stack.
+ *
+ *  \return Boolean directory end response
+ *  \retval true  Every entry of the directory has been read
+ *  \retval false Entries remain to be read, or the command was aborted
+ *
+ *  \sa #FM_ChildDeleteAllRemove, #FM_ChildDeleteTreePush
+ */
+bool FM_ChildDeleteAllCollect(FM_ChildWorker_t *Worker, osal_id_t DirId, const char *DirWithSep, const char *CmdText,
+                              bool Descend, uint32 *NotDeletedCount, uint32 *SkippedCount);
+
+/**
+ *  \brief Child Task Delete All Files Remove Utility Function
+ *
+ *  \par Description
+ *       This function removes the files named in the worker delete list.
+ *       The volume throttle is charged once for the whole batch before the
+ *       first file is removed.  In #FM_DELETE_MODE_TRASH each file is put in
+ *       the trash instead, see #FM_ChildTrashFile.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Files removed before an abort stay removed.
+ *
+ *  \param [in,out] Worker          A pointer to the child task worker executing the command.
+ *  \param [in] Directory           Directory name, used to select the throttle.
+ *  \param [in] DirWithSep          Directory name plus separator.
+ *  \param [in] CmdText             Command name used in the abort event.
+ *  \param [in,out] NotDeletedCount Counter of the files that could not be removed.
+ *
+ *  \return Number of files removed
+ *
+ *  \sa #FM_ChildDeleteAllCollect, #FM_ChildThrottle
+ */
+uint32 FM_ChildDeleteAllRemove(FM_ChildWorker_t *Worker, const char *Directory, const char *DirWithSep,
+                               const char *CmdText, uint32 *NotDeletedCount);
+
+/**
+ *  \brief Child Task Read Directory Entry Utility Function
+ *
+ *  \par Description
+ *       This function reads the next entry of a directory read in batches,
+ *       skipping the "." and ".." entries and, after the read has started
+ *       over, the entries that were already read.  Each entry returned is
+ *       counted as kept in the directory until a batch removes it.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The caller clears the worker DirKeptCount and DirSkipCount when the
+ *       directory is opened.
+ *
+ *  \param [in,out] Worker   A pointer to the child task worker executing the command.
+ *  \param [in]     DirId    Handle of the open directory.
+ *  \param [out]    DirEntry The directory entry read.
+ *
+ *  \return Boolean entry read response
+ *  \retval true  An entry not read before was returned
+ *  \retval false The end of the directory was reached
+ *
+ *  \sa #FM_ChildDirectoryRestart
+ */
+bool FM_ChildDirectoryNext(FM_ChildWorker_t *Worker, osal_id_t DirId, os_dirent_t *DirEntry);
+
+/**
+ *  \brief Child Task Restart Directory Read Utility Function
+ *
+ *  \par Description
+ *       This function is called after a batch read from an open directory
+ *       has been handled.  When the batch removed entries the directory
+ *       read is rewound, and the entries still in the directory are passed
+ *       over by #FM_ChildDirectoryNext.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       File systems that read a directory by entry offset, such as RTEMS
+ *       IMFS and dosFs, move the unread entries down over removed ones.
+ *       Reading on from the same position would then skip as many entries
+ *       as were removed.  Entries keep their order otherwise, so the entries
+ *       read before are the first ones read again.
+ *
+ *  \param [in,out] Worker       A pointer to the child task worker executing the command.
+ *  \param [in]     DirId        Handle of the open directory.
+ *  \param [in]     RemovedCount Number of entries of the batch removed from the directory.
+ *
+ *  \sa #FM_ChildDirectoryNext
+ */
+void FM_ChildDirectoryRestart(FM_ChildWorker_t *Worker, osal_id_t DirId, uint32 RemovedCount);
 
 /**
  *  \brief Child Task Decompress File Command Handler
@@ -202,12 +556,13 @@ void FM_ChildDeleteAllFilesCmd(FM_ChildQueueEntry_t *CmdArgs);
  *
  *  \par Assumptions, External Events, and Notes:
  *
+ *  \param [in,out] Worker A pointer to the child task worker executing the command.
  *  \param [in] CmdArgs A pointer to an entry in the child task handshake command
  *       queue which contains the arguments necessary to process this command.
  *
  *  \sa #FM_ChildQueueEntry_t, #FM_DecompressFileCmd_t
  */
-void FM_ChildDecompressFileCmd(const FM_ChildQueueEntry_t *CmdArgs);
+void FM_ChildDecompressFileCmd(FM_ChildWorker_t *Worker, const FM_ChildQueueEntry_t *CmdArgs);
 
 /**
  *  \brief Child Task Concatenate Files Command Handler
@@ -219,200 +574,1373 @@ void FM_ChildDecompressFileCmd(const FM_ChildQueueEntry_t *CmdArgs);
  *
  *  \par Assumptions, External Events, and Notes:
  *
+ *  \param [in,out] Worker A pointer to the child task worker executing the command.
  *  \param [in] CmdArgs A pointer to an entry in the child task handshake command
  *       queue which contains the arguments necessary to process this command.
  *
  *  \sa #FM_ChildQueueEntry_t, #FM_ConcatFilesCmd_t
  */
-void FM_ChildConcatFilesCmd(const FM_ChildQueueEntry_t *CmdArgs);
+void FM_ChildConcatFilesCmd(FM_ChildWorker_t *Worker, const FM_ChildQueueEntry_t *CmdArgs);
 
 /**
- *  \brief Child Task Get File Info Command Handler
+ *  \brief Child Task Concatenate Append Utility Function
  *
  *  \par Description
- *       This function is invoked when the FM child task has been granted the child
- *       task handshake semaphore and the child task command queue contains arguments
- *       that signal a get file info command.
+ *       This function appends source file #2 of a concatenate files command to
+ *       the target file through the child task copy buffers.  It is used when
+ *       the kernel cannot copy the files (see #FM_ChildKernelCopy), or when
+ *       the append is resumed from a checkpoint.
  *
  *  \par Assumptions, External Events, and Notes:
+ *       The caller updates the command counters and removes the target file
+ *       if the append fails.
  *
- *  \param [in] CmdArgs A pointer to an entry in the child task handshake command
- *       queue which contains the arguments necessary to process this command.
+ *  \param [in,out] Worker   A pointer to the child task worker executing the command.
+ *  \param [in] CmdArgs      A pointer to the concatenate files command arguments.
+ *  \param [in] ResumeOffset Source file #2 offset to resume at, zero to append all of it
+ *  \param [in] CmdText      Error event text
  *
- *  \sa #FM_ChildQueueEntry_t, #FM_GetFileInfoCmd_t
+ *  \return Boolean append success response
+ *  \retval true  Source file #2 was appended to the target file
+ *  \retval false Append failed, an error event has been sent
  */
-void FM_ChildFileInfoCmd(FM_ChildQueueEntry_t *CmdArgs);
+bool FM_ChildConcatAppend(FM_ChildWorker_t *Worker, const FM_ChildQueueEntry_t *CmdArgs, uint32 ResumeOffset,
+                          const char *CmdText);
 
 /**
- *  \brief Child Task Create Directory Command Handler
+ *  \brief Child Task Concatenate List of Files Command Handler
  *
  *  \par Description
  *       This function is invoked when the FM child task has been granted the child
  *       task handshake semaphore and the child task command queue contains arguments
- *       that signal a create directory command.
+ *       that signal a concatenate list of files command.  The target file is
+ *       created once and each source file is streamed onto its end in list order.
  *
  *  \par Assumptions, External Events, and Notes:
+ *       Source1 holds the list filename, when it is empty SourceList holds
+ *       the newline separated inline source names.
  *
+ *  \param [in,out] Worker A pointer to the child task worker executing the command.
  *  \param [in] CmdArgs A pointer to an entry in the child task handshake command
  *       queue which contains the arguments necessary to process this command.
  *
- *  \sa #FM_ChildQueueEntry_t, #FM_CreateDirectoryCmd_t
+ *  \sa #FM_ChildQueueEntry_t, #FM_ConcatListCmd_t
  */
-void FM_ChildCreateDirectoryCmd(const FM_ChildQueueEntry_t *CmdArgs);
+void FM_ChildConcatListCmd(FM_ChildWorker_t *Worker, const FM_ChildQueueEntry_t *CmdArgs);
 
 /**
- *  \brief Child Task Delete Directory Command Handler
+ *  \brief Child Task Concatenate List Next Source Utility Function
  *
  *  \par Description
- *       This function is invoked when the FM child task has been granted the child
- *       task handshake semaphore and the child task command queue contains arguments
- *       that signal a delete directory command.
+ *       This function parses the next source filename from the concatenate
+ *       list in progress.  Names are separated by newlines, blank lines and
+ *       carriage returns are skipped.  A list file is read into the child
+ *       task I/O buffer a block at a time as the names are parsed.
  *
  *  \par Assumptions, External Events, and Notes:
+ *       The caller sets up the list state in the worker before the first call.
  *
- *  \param [in] CmdArgs A pointer to an entry in the child task handshake command
- *       queue which contains the arguments necessary to process this command.
+ *  \param [in,out] Worker A pointer to the child task worker executing the command.
+ *  \param [out] Source     Buffer for the source filename, empty at the end of the list
+ *  \param [in]  BufferSize Size of the source filename buffer
  *
- *  \sa #FM_ChildQueueEntry_t, #FM_DeleteDirectoryCmd_t
+ *  \return Execution status
+ *  \retval #OS_SUCCESS              A name (or the end of the list) was found
+ *  \retval #OS_FS_ERR_PATH_TOO_LONG A listed name does not fit in the buffer
+ *  \retval Other                    Error reading the list file
  */
-void FM_ChildDeleteDirectoryCmd(const FM_ChildQueueEntry_t *CmdArgs);
+int32 FM_ChildConcatListNext(FM_ChildWorker_t *Worker, char *Source, uint32 BufferSize);
 
 /**
- *  \brief Child Task Get Dir List to File Command Handler
+ *  \brief Child Task Concatenate List Append Source Utility Function
+ *
+ *  \par Description
+ *       This function opens one source file of a concatenate list command and
+ *       streams it onto the end of the open target file through the child task
+ *       copy buffers.  The source resumed from a checkpoint continues at the
+ *       checkpoint offset instead.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The caller updates the command counters and removes the target file
+ *       if the append fails.
+ *
+ *  \param [in,out] Worker   A pointer to the child task worker executing the command.
+ *  \param [in] FileHandleTgt Open target file handle
+ *  \param [in] Source        Source filename
+ *  \param [in] SourceIndex   Zero based position of the source in the list
+ *  \param [in] Target        Target filename
+ *  \param [in] CmdText       Error event text
+ *
+ *  \return Boolean append success response
+ *  \retval true  The source file was appended to the target file
+ *  \retval false Append failed, an error event has been sent
+ */
+bool FM_ChildConcatListSource(FM_ChildWorker_t *Worker, osal_id_t FileHandleTgt, const char *Source, uint32 SourceIndex,
+                              const char *Target, const char *CmdText);
+
+/**
+ *  \brief Child Task Get File Info Command Handler
  *
  *  \par Description
  *       This function is invoked when the FM child task has been granted the child
  *       task handshake semaphore and the child task command queue contains arguments
- *       that signal a get directory listing to a file command.
+ *       that signal a get file info command.
  *
  *  \par Assumptions, External Events, and Notes:
  *
+ *  \param [in,out] Worker A pointer to the child task worker executing the command.
  *  \param [in] CmdArgs A pointer to an entry in the child task handshake command
  *       queue which contains the arguments necessary to process this command.
  *
- *  \sa #FM_ChildQueueEntry_t, #FM_GetDirListFileCmd_t
+ *  \sa #FM_ChildQueueEntry_t, #FM_GetFileInfoCmd_t
  */
-void FM_ChildDirListFileCmd(const FM_ChildQueueEntry_t *CmdArgs);
+void FM_ChildFileInfoCmd(FM_ChildWorker_t *Worker, FM_ChildQueueEntry_t *CmdArgs);
 
 /**
- *  \brief Child Task Get Dir List to Packet Command Handler
+ *  \brief Child Task Look Up File CRC
  *
  *  \par Description
- *       This function is invoked when the FM child task has been granted the child
- *       task handshake semaphore and the child task command queue contains arguments
- *       that signal a get directory listing to a packet command.
+ *       This function looks for a CRC kept for the file name, size, modify
+ *       time and CRC type of a get file info command.  An entry found is
+ *       marked as the most recently used.
  *
  *  \par Assumptions, External Events, and Notes:
+ *       Takes #FM_GlobalData_t.ChildCrcCacheSem.
  *
- *  \param [in] CmdArgs A pointer to an entry in the child task handshake command
- *       queue which contains the arguments necessary to process this command.
+ *  \param [in]  CmdArgs A pointer to the get file info command arguments.
+ *  \param [out] Crc     The CRC kept for the file, unchanged if none was found.
  *
- *  \sa #FM_ChildQueueEntry_t, #FM_GetDirListPktCmd_t
+ *  \return Boolean lookup response
+ *  \retval true  The CRC of the unchanged file was found
+ *  \retval false The file has to be read
+ *
+ *  \sa #FM_ChildCrcCacheStore
  */
-void FM_ChildDirListPktCmd(const FM_ChildQueueEntry_t *CmdArgs);
+bool FM_ChildCrcCacheLookup(const FM_ChildQueueEntry_t *CmdArgs, uint32 *Crc);
 
 /**
- *  \brief Child Task Set Permissions Command Handler
+ *  \brief Child Task Keep File CRC
  *
  *  \par Description
- *       This function is invoked when the FM child task has been granted the child
- *       task handshake semaphore and the child task command queue contains arguments
- *       that signal a set permissions / mode on the source1 file or directory
+ *       This function keeps the CRC computed by a get file info command.  It
+ *       replaces an older CRC of the same file and CRC type, else a free
+ *       entry, else the entry used least recently.  A file whose modify time
+ *       is not before the second the read started may have been written
+ *       while it was read, nor a file that was not read to its verified
+ *       size, its CRC is not kept.  A CRC-16 is kept with the CRCs of the
+ *       first and last block so the file can be continued once it grows.
  *
  *  \par Assumptions, External Events, and Notes:
+ *       Takes #FM_GlobalData_t.ChildCrcCacheSem.  May read the file again
+ *       into the worker file I/O buffer, see #FM_ChildCrcCheckWindows.
  *
- *  \param [in] CmdArgs A pointer to an entry in the child task handshake command
- *       queue which contains the arguments necessary to process this command.
+ *  \param [in,out] Worker    A pointer to the child task worker that read the file.
+ *  \param [in]     CmdArgs   A pointer to the get file info command arguments.
+ *  \param [in]     Crc       The CRC computed for the file.
+ *  \param [in]     StartTime Local time in seconds taken before the file was opened.
  *
- *  \sa #FM_ChildQueueEntry_t, #FM_SetPermissionsCmd_t
+ *  \sa #FM_ChildCrcCacheLookup
  */
-void FM_ChildSetPermissionsCmd(const FM_ChildQueueEntry_t *CmdArgs);
+void FM_ChildCrcCacheStore(FM_ChildWorker_t *Worker, const FM_ChildQueueEntry_t *CmdArgs, uint32 Crc, uint32 StartTime);
 
-/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-/*                                                                 */
-/* FM child task utility functions                                 */
-/*                                                                 */
-/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**
+ *  \brief Child Task Find Grown File CRC
+ *
+ *  \par Description
+ *       This function looks for a CRC-16 kept for a smaller size of the file
+ *       of a get file info command, with a modify time no later than the
+ *       file's.  An entry found is marked as the most recently used.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Takes #FM_GlobalData_t.ChildCrcCacheSem.  Only entries kept with
+ *       check CRCs of their first and last block are returned.
+ *
+ *  \param [in]  CmdArgs A pointer to the get file info command arguments.
+ *  \param [out] Base    A copy of the entry found, unchanged if none was found.
+ *
+ *  \return Boolean lookup response
+ *  \retval true  A CRC of the start of the file was found
+ *  \retval false The file has to be read from the start
+ *
+ *  \sa #FM_ChildCrcResume
+ */
+bool FM_ChildCrcCacheBase(const FM_ChildQueueEntry_t *CmdArgs, FM_CrcCacheEntry_t *Base);
 
 /**
- *  \brief Child Task Get Dir List to File Initialization Function
+ *  \brief Child Task Continue File CRC Function
  *
  *  \par Description
- *       This function creates the output file and then writes both the CFE file header
- *       and a blank copy of the directory list statistics structure to the output file.
- *       At the end of the command, software will re-write the statistics structure,
- *       this time with up to date values.
+ *       This function reads the first block of the file and the block that
+ *       ended it when its CRC was kept.  If both still have the same CRCs the
+ *       file was only appended to, and is left positioned to read on from the
+ *       kept size.  Otherwise the file is moved back to its start to be read
+ *       in full.
  *
  *  \par Assumptions, External Events, and Notes:
+ *       Uses the worker file I/O buffer.
  *
- *  \param [out] FileHandlePtr A pointer to a file handle variable which is modified to
- *       contain the newly created output file handle.
- *  \param [in] Directory      A pointer to a buffer containing the directory name.
- *  \param [in] Filename       A pointer to a buffer containing the output filename.
+ *  \param [in,out] Worker     A pointer to the child task worker executing the command.
+ *  \param [in]     FileHandle The open file.
+ *  \param [in]     Base       The entry found by #FM_ChildCrcCacheBase.
  *
- *  \return Execution status, see \ref CFEReturnCodes and \ref OSReturnCodes
- *  \retval #CFE_SUCCESS \copybrief CFE_SUCCESS
+ *  \return Execution status
+ *  \retval #OS_SUCCESS                 Read on from the kept size, starting from the kept CRC
+ *  \retval #CFE_STATUS_NOT_IMPLEMENTED The file was rewritten, read it from the start
+ *  \retval Other                       The file could not be moved back to its start
+ *
+ *  \sa #FM_ChildCrcCacheBase
  */
-bool FM_ChildDirListFileInit(osal_id_t *FileHandlePtr, const char *Directory, const char *Filename);
+int32 FM_ChildCrcResume(FM_ChildWorker_t *Worker, osal_id_t FileHandle, const FM_CrcCacheEntry_t *Base);
 
 /**
- *  \brief Child Task Get Dir List to File Loop Processor Function
+ *  \brief Child Task File CRC Check Blocks Function
  *
  *  \par Description
- *       This function reads each directory entry, determines the last modify time
- *       size and mode for each entry, and writes the entry data to the output file.
+ *       This function computes the CRC-16 of the first and of the last
+ *       Length bytes of a file whose CRC was just read to Size.  The last
+ *       read is used as is when it filled a whole window, else the file is
+ *       opened and the windows read again.  A short final read is never
+ *       used alone, it would miss a rewrite of the bytes before it.
  *
  *  \par Assumptions, External Events, and Notes:
+ *       Uses the worker file I/O buffer.
  *
- *  \param [in] DirId           Directory ID, a handle used to read directory entries.
- *  \param [in] FileHandle      Output file handle.
- *  \param [in] Directory       Pointer to a buffer containing the directory name.
- *  \param [in] DirWithSep      Pointer to directory name with path separator appended.
- *  \param [in] Filename        Pointer to a buffer containing the output filename.
- *  \param [in] GetSizeTimeMode Option to call OS_stat for size, time, mode of files
+ *  \param [in,out] Worker   A pointer to the child task worker that read the file.
+ *  \param [in]     Filename The file whose CRC was read.
+ *  \param [in]     Size     Bytes the CRC covers.
+ *  \param [in]     Length   Bytes in each window, no more than Size or #FM_CHILD_FILE_BLOCK_SIZE.
+ *  \param [out]    HeadCrc  CRC-16 of the first Length bytes.
+ *  \param [out]    TailCrc  CRC-16 of the Length bytes before Size.
+ *
+ *  \return Boolean check response
+ *  \retval true  Both CRCs were computed
+ *  \retval false The file could not be read, the CRC is kept without them
+ *
+ *  \sa #FM_ChildCrcCacheStore, #FM_ChildCrcCheckRead
  */
-void FM_ChildDirListFileLoop(osal_id_t DirId, osal_id_t FileHandle, const char *Directory, const char *DirWithSep,
-                             const char *Filename, uint8 GetSizeTimeMode);
+bool FM_ChildCrcCheckWindows(FM_ChildWorker_t *Worker, const char *Filename, uint32 Size, uint32 Length,
+                             uint32 *HeadCrc, uint32 *TailCrc);
 
 /**
- *  \brief Child Task File Size Time and Mode Utility Function
+ *  \brief Child Task File CRC Check Block Read Function
  *
  *  \par Description
- *       This function is invoked to query the last modify time, current size and mode (permissions) for
- *       each directory entry when processing either the Get Directory List to File
- *       or Get Directory List to Packet commands.
+ *       This function moves an open file to Offset and computes the CRC-16
+ *       of the next Length bytes.  The file is left positioned after them.
  *
  *  \par Assumptions, External Events, and Notes:
+ *       Uses the worker file I/O buffer, Length is no more than
+ *       #FM_CHILD_FILE_BLOCK_SIZE.
  *
- *  \param [in] Filename  Pointer to the combined directory and entry names.
- *  \param [out] FileSize Pointer to the number containing the current entry size.
- *  \param [out] FileTime Pointer to the number containing the last modify time.
- *  \param [out] FileMode Pointer to the value containing the mode (permissions).
+ *  \param [in,out] Worker     A pointer to the child task worker executing the command.
+ *  \param [in]     FileHandle The open file.
+ *  \param [in]     Offset     File offset of the first byte.
+ *  \param [in]     Length     Bytes to read.
+ *  \param [out]    Crc        CRC-16 of the bytes read.
  *
- *  \return Execution status, see \ref CFEReturnCodes and \ref OSReturnCodes
- *  \retval #CFE_SUCCESS \copybrief CFE_SUCCESS
+ *  \return Boolean read response
+ *  \retval true  All Length bytes were read
+ *  \retval false The file could not be moved, or ended first
+ *
+ *  \sa #FM_ChildCrcResume, #FM_ChildCrcCheckWindows
  */
-int32 FM_ChildSizeTimeMode(const char *Filename, uint32 *FileSize, uint32 *FileTime, uint32 *FileMode);
+bool FM_ChildCrcCheckRead(FM_ChildWorker_t *Worker, osal_id_t FileHandle, uint32 Offset, uint32 Length, uint32 *Crc);
 
 /**
- *  \brief Child Task Sleep and Stat Utility Function
+ *  \brief Child Task Split File CRC Function
  *
  *  \par Description
- *       This function is invoked to query the last modify time, current size and mode (permissions) for
- *       each directory entry when processing either the Get Directory List to File
- *       or Get Directory List to Packet commands.
- *       However it only will sleep if FM_CHILD_STAT_SLEEP_FILECOUNT reaches zero and call FM_ChildSizeTimeMode if
- *       getSizeTimeMode is TRUE, otherwise this function has no effect
+ *       This function computes the CRC-16 of a large file in ranges.  Each
+ *       running CRC helper task reads an equal range of whole blocks from
+ *       the start of the file while the child task reads the rest, and the
+ *       range CRCs are combined into the CRC of a single pass.  A child task
+ *       abort or a failed range stops the other ranges.
  *
  *  \par Assumptions, External Events, and Notes:
+ *       The split is skipped for files smaller than #FM_CHILD_CRC_SPLIT_SIZE,
+ *       for CRC types other than CRC-16, when cFE computes the CRC, and
+ *       while another child task is using the helpers.  Takes
+ *       #FM_GlobalData_t.CrcHelperSem to claim and release the helpers.
  *
- *  \param [in] Filename        Pointer to the combined directory and entry names.
- *  \param [out] DirListData    Pointer to the data containing the current entry size, last modify time, and mode
- *  \param [out] FilesTillSleep If this is zero the function will sleep for #FM_CHILD_STAT_SLEEP_MS and reset it to
- *                              #FM_CHILD_STAT_SLEEP_FILECOUNT. Otherwise it will subtract 1
- *  \param [in] GetSizeTimeMode Whether this function should call FM_ChildSizeTimeMode
+ *  \param [in,out] Worker  A pointer to the child task worker executing the command.
+ *  \param [in]     CmdArgs A pointer to the get file info command arguments.
+ *  \param [out]    Crc     The CRC of the file, set when the split is made.
+ *
+ *  \return Execution status
+ *  \retval #OS_SUCCESS                 The CRC of the whole file was computed
+ *  \retval #CFE_STATUS_NOT_IMPLEMENTED The file was not split, or shrank while read, read it in a single pass
+ *  \retval Other                       Open, seek or read failure, or the command was aborted
+ *
+ *  \sa #FM_ChildCrcRange, #FM_CrcCombine
+ */
+int32 FM_ChildCrcParallel(FM_ChildWorker_t *Worker, const FM_ChildQueueEntry_t *CmdArgs, uint32 *Crc);
+
+/**
+ *  \brief Child Task Range CRC Function
+ *
+ *  \par Description
+ *       This function opens the file, moves to the start of the range and
+ *       computes the CRC-16 of the range a block at a time.  Reading stops
+ *       early at the end of the file or once #FM_GlobalData_t.CrcHelperStop
+ *       is set.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Runs on both the child task and the CRC helper tasks, the abort
+ *       check and progress count are only made when Worker is not NULL.
+ *
+ *  \param [in,out] Worker    A pointer to the child task worker, NULL on a helper task.
+ *  \param [in]     Filename  The file to read.
+ *  \param [in]     Offset    Offset of the range in the file.
+ *  \param [in]     Length    Bytes in the range, zero to read to the end of the file.
+ *  \param [in]     Buffer    A file I/O buffer of #FM_CHILD_FILE_BLOCK_SIZE bytes.
+ *  \param [out]    Crc       The CRC-16 of the bytes read.
+ *  \param [out]    BytesDone The number of bytes read.
+ *
+ *  \return Execution status
+ *  \retval #OS_SUCCESS The range was read up to its length or the end of the file
+ *  \retval Other       Open, seek or read failure, stop request or abort
+ *
+ *  \sa #FM_ChildCrcParallel
+ */
+int32 FM_ChildCrcRange(FM_ChildWorker_t *Worker, const char *Filename, uint32 Offset, uint32 Length, uint8 *Buffer,
+                       uint32 *Crc, uint32 *BytesDone);
+
+/**
+ *  \brief Child Task Get File Digest Command Handler
+ *
+ *  \par Description
+ *       This function is invoked when the FM child task has been granted the child
+ *       task handshake semaphore and the child task command queue contains arguments
+ *       that signal a get file digest command.  The file is read once and each block
+ *       is passed to every digest selected by the command.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       No telemetry packet is sent when the file cannot be read to its end or
+ *       the command is aborted.
+ *
+ *  \param [in,out] Worker A pointer to the child task worker executing the command.
+ *  \param [in] CmdArgs A pointer to an entry in the child task handshake command
+ *       queue which contains the arguments necessary to process this command.
+ *
+ *  \sa #FM_ChildQueueEntry_t, #FM_GetFileDigestCmd_t
+ */
+void FM_ChildFileDigestCmd(FM_ChildWorker_t *Worker, const FM_ChildQueueEntry_t *CmdArgs);
+
+/**
+ *  \brief Child Task Create Directory Command Handler
+ *
+ *  \par Description
+ *       This function is invoked when the FM child task has been granted the child
+ *       task handshake semaphore and the child task command queue contains arguments
+ *       that signal a create directory command.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *
+ *  \param [in,out] Worker A pointer to the child task worker executing the command.
+ *  \param [in] CmdArgs A pointer to an entry in the child task handshake command
+ *       queue which contains the arguments necessary to process this command.
+ *
+ *  \sa #FM_ChildQueueEntry_t, #FM_CreateDirectoryCmd_t
+ */
+void FM_ChildCreateDirectoryCmd(FM_ChildWorker_t *Worker, const FM_ChildQueueEntry_t *CmdArgs);
+
+/**
+ *  \brief Child Task Delete Directory Command Handler
+ *
+ *  \par Description
+ *       This function is invoked when the FM child task has been granted the child
+ *       task handshake semaphore and the child task command queue contains arguments
+ *       that signal a delete directory command.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *
+ *  \param [in,out] Worker A pointer to the child task worker executing the command.
+ *  \param [in] CmdArgs A pointer to an entry in the child task handshake command
+ *       queue which contains the arguments necessary to process this command.
+ *
+ *  \sa #FM_ChildQueueEntry_t, #FM_DeleteDirectoryCmd_t
+ */
+void FM_ChildDeleteDirectoryCmd(FM_ChildWorker_t *Worker, const FM_ChildQueueEntry_t *CmdArgs);
+
+/**
+ *  \brief Child Task Delete Directory Tree Command Handler
+ *
+ *  \par Description
+ *       This function is invoked when the FM child task has been granted the child
+ *       task handshake semaphore and the child task command queue contains arguments
+ *       that signal a delete directory tree command.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The tree is walked with the worker delete tree stack, not by recursion, so
+ *       the depth of the tree does not use child task stack.  Each directory is
+ *       removed with OS_rmdir once everything below it has been visited.
+ *
+ *  \param [in,out] Worker A pointer to the child task worker executing the command.
+ *  \param [in] CmdArgs A pointer to an entry in the child task handshake command
+ *       queue which contains the arguments necessary to process this command.
+ *
+ *  \sa #FM_ChildQueueEntry_t, #FM_DeleteTreeCmd_t
+ */
+void FM_ChildDeleteTreeCmd(FM_ChildWorker_t *Worker, const FM_ChildQueueEntry_t *CmdArgs);
+
+/**
+ *  \brief Child Task Delete Directory Tree Scan Utility Function
+ *
+ *  \par Description
+ *       This function reads a directory, removing its closed files a batch
+ *       at a time and pushing its sub-directories onto the worker delete
+ *       tree stack.  Each entry is counted and each sub-directory pushed
+ *       once, see #FM_ChildDirectoryRestart.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       A directory that cannot be opened is left for OS_rmdir to report.
+ *
+ *  \param [in,out] Worker          A pointer to the child task worker executing the command.
+ *  \param [in] Directory           Directory name.
+ *  \param [in] CmdText             Command name used in the abort event.
+ *  \param [in,out] NotDeletedCount Counter of the files that could not be removed.
+ *  \param [in,out] SkippedCount    Counter of the sub-directories that did not fit on the stack.
+ *
+ *  \return Number of files removed
+ *
+ *  \sa #FM_ChildDeleteAllCollect, #FM_ChildDeleteAllRemove
+ */
+uint32 FM_ChildDeleteTreeScan(FM_ChildWorker_t *Worker, const char *Directory, const char *CmdText,
+                              uint32 *NotDeletedCount, uint32 *SkippedCount);
+
+/**
+ *  \brief Child Task Delete Directory Tree Push Utility Function
+ *
+ *  \par Description
+ *       This function adds a directory to the top of the worker delete tree
+ *       stack, to be scanned the next time it is reached.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *
+ *  \param [in,out] Worker  A pointer to the child task worker executing the command.
+ *  \param [in] Directory   Directory name.
+ *
+ *  \return Boolean push response
+ *  \retval true  The directory was pushed
+ *  \retval false The stack already holds #FM_CHILD_TREE_STACK_SIZE directories
+ */
+bool FM_ChildDeleteTreePush(FM_ChildWorker_t *Worker, const char *Directory);
+
+/**
+ *  \brief Child Task Filter Files Command Handler
+ *
+ *  \par Description
+ *       This function is invoked when the FM child task has been granted the child
+ *       task handshake semaphore and the child task command queue contains arguments
+ *       that signal a filter files command.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Files that pass the filter are collected in the worker delete list and
+ *       deleted, moved or copied a batch at a time.  Each entry is looked at once,
+ *       see #FM_ChildDirectoryRestart.
+ *
+ *  \param [in,out] Worker A pointer to the child task worker executing the command.
+ *  \param [in] CmdArgs A pointer to an entry in the child task handshake command
+ *       queue which contains the arguments necessary to process this command.
+ *
+ *  \sa #FM_ChildQueueEntry_t, #FM_FilterFilesCmd_t
+ */
+void FM_ChildFilterFilesCmd(FM_ChildWorker_t *Worker, const FM_ChildQueueEntry_t *CmdArgs);
+
+/**
+ *  \brief Child Task Filter Files Collect Utility Function
+ *
+ *  \par Description
+ *       This function reads entries from an open directory and adds the name
+ *       of each closed file that passes the filter to the worker delete list.
+ *       Reading stops as for #FM_ChildDeleteAllCollect.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Only entries whose name matches the pattern are passed to OS_stat.
+ *       Sub-directories and files outside the limits are not counted.
+ *
+ *  \param [in,out] Worker       A pointer to the child task worker executing the command.
+ *  \param [in] DirId            Handle of the open directory.
+ *  \param [in] DirWithSep       Directory name plus separator.
+ *  \param [in] CmdArgs          Command arguments holding the pattern and filter.
+ *  \param [in] Now              Local time in seconds that file ages are measured from.
+ *  \param [in] CmdText          Command name used in the abort event.
+ *  \param [in,out] NotDoneCount Counter of the matching files that will not be handled.
+ *
+ *  \return Boolean directory end response
+ *  \retval true  Every entry of the directory has been read
+ *  \retval false Entries remain to be read, or the command was aborted
+ *
+ *  \sa #FM_ChildFilterPass, #FM_ChildFilterApply
+ */
+bool FM_ChildFilterCollect(FM_ChildWorker_t *Worker, osal_id_t DirId, const char *DirWithSep,
+                           const FM_ChildQueueEntry_t *CmdArgs, uint32 Now, const char *CmdText, uint32 *NotDoneCount);
+
+/**
+ *  \brief Child Task Filter Files Limit Test Utility Function
+ *
+ *  \par Description
+ *       This function tests the size and modify time of a file against the
+ *       age and size limits of a filter.  A limit of zero is not applied.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *
+ *  \param [in] Filter   Age and size limits.
+ *  \param [in] FileSize File size in bytes.
+ *  \param [in] FileTime File modify time in seconds.
+ *  \param [in] Now      Local time in seconds that the age is measured from.
+ *
+ *  \return Boolean filter response
+ *  \retval true  The file is within every limit
+ *  \retval false The file is outside a limit
+ */
+bool FM_ChildFilterPass(const FM_FileFilter_t *Filter, uint32 FileSize, uint32 FileTime, uint32 Now);
+
+/**
+ *  \brief Child Task Filter Files Apply Utility Function
+ *
+ *  \par Description
+ *       This function deletes, moves or copies the files named in the worker
+ *       delete list.  Delete uses #FM_ChildDeleteAllRemove.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *
+ *  \param [in,out] Worker       A pointer to the child task worker executing the command.
+ *  \param [in] CmdArgs          Command arguments holding the action and directories.
+ *  \param [in] DirWithSep       Directory name plus separator.
+ *  \param [in] TgtWithSep       Target directory name plus separator, unused for delete.
+ *  \param [in] CmdText          Command name used in events.
+ *  \param [in,out] NotDoneCount Counter of the files that could not be handled.
+ *
+ *  \return Number of files handled
+ *
+ *  \sa #FM_ChildFilterCollect, #FM_ChildFilterTransfer
+ */
+uint32 FM_ChildFilterApply(FM_ChildWorker_t *Worker, const FM_ChildQueueEntry_t *CmdArgs, const char *DirWithSep,
+                           const char *TgtWithSep, const char *CmdText, uint32 *NotDoneCount);
+
+/**
+ *  \brief Child Task Filter Files Transfer Utility Function
+ *
+ *  \par Description
+ *       This function moves or copies one file into the target directory.  A
+ *       move that cannot rename the file copies it and removes the source.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       An existing target file is only replaced when overwrite is set and the
+ *       file is closed.  A file is never moved or copied onto itself.
+ *
+ *  \param [in,out] Worker A pointer to the child task worker executing the command.
+ *  \param [in] CmdArgs    Command arguments holding the action and overwrite flag.
+ *  \param [in] Source     Source filename.
+ *  \param [in] Target     Target filename.
+ *  \param [in] CmdText    Command name used in events.
+ *
+ *  \return Boolean transfer response
+ *  \retval true  The file was moved or copied
+ *  \retval false The file was left in place
+ */
+bool FM_ChildFilterTransfer(FM_ChildWorker_t *Worker, const FM_ChildQueueEntry_t *CmdArgs, const char *Source,
+                            const char *Target, const char *CmdText);
+
+/**
+ *  \brief Child Task Enforce Retention Command Handler
+ *
+ *  \par Description
+ *       This function is invoked when the FM child task has been granted the child
+ *       task handshake semaphore and the child task command queue contains arguments
+ *       that signal a retention pass over a managed directory.  The directory is
+ *       read once, counting its files and bytes and keeping an index of the files
+ *       to be removed first.  Files are then removed from the top of the index
+ *       until the directory is within its limits.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       A scheduled pass leaves the command counters alone and only sends an
+ *       event when it removes files or fails.  The busy flag of the retention
+ *       entry is cleared when the pass ends.
+ *
+ *  \param [in,out] Worker A pointer to the child task worker executing the command.
+ *  \param [in] CmdArgs    A pointer to an FM_ChildQueueEntry_t structure
+ *
+ *  \sa #FM_ENFORCE_RETENTION_CC, #FM_RetentionSchedule
+ */
+void FM_ChildRetentionCmd(FM_ChildWorker_t *Worker, const FM_ChildQueueEntry_t *CmdArgs);
+
+/**
+ *  \brief Child Task Retention Scan Utility Function
+ *
+ *  \par Description
+ *       This function reads the managed directory, counts the files and their
+ *       sizes and offers each file to the retention index.  Each OS_stat is
+ *       charged to the stat throttle of the directory.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Subdirectories, files that could not be queried and names too long
+ *       to remove are not counted.
+ *
+ *  \param [in,out] Worker    A pointer to the child task worker executing the command.
+ *  \param [in,out] State     Retention state of the entry being enforced.
+ *  \param [in] DirId         Open directory handle.
+ *  \param [in] DirWithSep    Directory name plus separator.
+ */
+void FM_ChildRetentionScan(FM_ChildWorker_t *Worker, FM_RetentionState_t *State, osal_id_t DirId,
+                           const char *DirWithSep);
+
+/**
+ *  \brief Child Task Retention Priority Utility Function
+ *
+ *  \par Description
+ *       This function returns the removal priority of a file, lower values are
+ *       removed first.  In oldest first order every file has priority zero,
+ *       in priority order the index of the first matching pattern is used.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Files that match no pattern get #FM_RETENTION_PATTERN_COUNT.
+ *
+ *  \param [in] Policy Retention table entry.
+ *  \param [in] Name   Filename without the directory.
+ *
+ *  \return Removal priority of the file
+ */
+uint32 FM_ChildRetentionPriority(const FM_RetentionTableEntry_t *Policy, const char *Name);
+
+/**
+ *  \brief Child Task Retention Index Offer Utility Function
+ *
+ *  \par Description
+ *       This function adds a file to the retention index while the directory
+ *       is read.  The index keeps the file to be removed last on top, so when
+ *       it is full a file that goes before the top one replaces it.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *
+ *  \param [in,out] State Retention state holding the index.
+ *  \param [in] File      File to be offered.
+ */
+void FM_ChildRetentionOffer(FM_RetentionState_t *State, const FM_RetentionFile_t *File);
+
+/**
+ *  \brief Child Task Retention Index Order Utility Function
+ *
+ *  \par Description
+ *       This function tells whether a file belongs above another in the
+ *       retention index.  With EvictFirst set the file to be removed first
+ *       is above, otherwise the file to be removed last is above.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Files are removed by priority and then oldest first.
+ *
+ *  \param [in] Upper      File tested for the upper position.
+ *  \param [in] Lower      File tested for the lower position.
+ *  \param [in] EvictFirst Index direction.
+ *
+ *  \return Boolean order response
+ *  \retval true  Upper belongs above Lower
+ *  \retval false Upper does not belong above Lower
+ */
+bool FM_ChildRetentionAbove(const FM_RetentionFile_t *Upper, const FM_RetentionFile_t *Lower, bool EvictFirst);
+
+/**
+ *  \brief Child Task Retention Index Sift Utility Function
+ *
+ *  \par Description
+ *       This function moves the index entry at Root down until neither child
+ *       belongs above it.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *
+ *  \param [in,out] Index  Retention index.
+ *  \param [in] Count      Number of index entries in use.
+ *  \param [in] Root       Entry to be moved down.
+ *  \param [in] EvictFirst Index direction, see #FM_ChildRetentionAbove.
+ */
+void FM_ChildRetentionSift(FM_RetentionFile_t *Index, uint32 Count, uint32 Root, bool EvictFirst);
+
+/**
+ *  \brief Child Task Retention Evict Utility Function
+ *
+ *  \par Description
+ *       This function removes files from the top of the retention index
+ *       while the directory is over a limit.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Open files and files that cannot be removed are dropped from the
+ *       index but stay counted.  Each removal is charged to the stat
+ *       throttle of the directory.
+ *
+ *  \param [in,out] Worker       A pointer to the child task worker executing the command.
+ *  \param [in,out] State        Retention state holding the index and counts.
+ *  \param [in] DirWithSep       Directory name plus separator.
+ *  \param [in] CmdText          Command name used in events.
+ *  \param [in,out] BytesRemoved Total size of the removed files.
+ *
+ *  \return Number of files removed
+ */
+uint32 FM_ChildRetentionEvict(FM_ChildWorker_t *Worker, FM_RetentionState_t *State, const char *DirWithSep,
+                              const char *CmdText, uint64 *BytesRemoved);
+
+/**
+ *  \brief Child Task Retention Limit Utility Function
+ *
+ *  \par Description
+ *       This function tells whether the counted files exceed a limit of the
+ *       retention entry.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       A limit of zero is not applied.
+ *
+ *  \param [in] State Retention state holding the limits and counts.
+ *
+ *  \return Boolean limit response
+ *  \retval true  The directory is over a limit
+ *  \retval false The directory is within its limits
+ */
+bool FM_ChildRetentionOver(const FM_RetentionState_t *State);
+
+/**
+ *  \brief Child Task Purge Trash Command Handler
+ *
+ *  \par Description
+ *       This function is invoked when the FM child task has been granted the child
+ *       task handshake semaphore and the child task command queue contains arguments
+ *       that signal a trash purge pass.  Each claimed trash directory that may hold
+ *       files is read and its files removed a batch at a time.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       A scheduled pass removes at most #FM_CHILD_PURGE_BUDGET files, ends after
+ *       the current batch when a command is waiting in the queue, leaves the
+ *       command counters alone and only sends an event when a trash directory
+ *       cannot be read.  The purge busy flag is cleared when the pass ends.
+ *
+ *  \param [in,out] Worker A pointer to the child task worker executing the command.
+ *  \param [in] CmdArgs    A pointer to an FM_ChildQueueEntry_t structure
+ *
+ *  \sa #FM_PURGE_TRASH_CC, #FM_TrashSchedule
+ */
+void FM_ChildPurgeCmd(FM_ChildWorker_t *Worker, const FM_ChildQueueEntry_t *CmdArgs);
+
+/**
+ *  \brief Child Task Purge Trash Directory Utility Function
+ *
+ *  \par Description
+ *       This function reads an open trash directory and removes its files a
+ *       batch at a time with #FM_ChildDeleteAllRemove.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       With a budget the pass stops once the count of files removed reaches
+ *       it or a command is waiting in the queue.  The caller closes the
+ *       directory.
+ *
+ *  \param [in,out] Worker         A pointer to the child task worker executing the command.
+ *  \param [in] DirId              Open trash directory handle.
+ *  \param [in] TrashDir           Trash directory name.
+ *  \param [in] Budget             Files the whole pass may remove, zero when unlimited.
+ *  \param [in,out] PurgeCount     Files removed by the pass so far.
+ *  \param [in,out] NotPurgedCount Counter of the files that could not be removed.
+ *
+ *  \return Boolean directory end response
+ *  \retval true  Every entry of the directory has been read
+ *  \retval false The pass stopped with entries left to read
+ */
+bool FM_ChildPurgeVolume(FM_ChildWorker_t *Worker, osal_id_t DirId, const char *TrashDir, uint32 Budget,
+                         uint32 *PurgeCount, uint32 *NotPurgedCount);
+
+/**
+ *  \brief Child Task Purge Trash Collect Utility Function
+ *
+ *  \par Description
+ *       This function reads trash directory entries into the worker delete
+ *       list until the list is full, it holds the number of names given or
+ *       the directory ends.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Entries are not queried with OS_stat, every entry was a closed file
+ *       when it was put in the trash.
+ *
+ *  \param [in,out] Worker A pointer to the child task worker executing the command.
+ *  \param [in] DirId      Open trash directory handle.
+ *  \param [in] CmdText    Command name used in the abort event.
+ *  \param [in] MaxCount   Most names to collect, zero when unlimited.
+ *
+ *  \return Boolean directory end response
+ *  \retval true  Every entry of the directory has been read
+ *  \retval false The list is full or holds the number of names given
+ */
+bool FM_ChildPurgeCollect(FM_ChildWorker_t *Worker, osal_id_t DirId, const char *CmdText, uint32 MaxCount);
+
+/**
+ *  \brief Child Task Trash File Utility Function
+ *
+ *  \par Description
+ *       In #FM_DELETE_MODE_TRASH this function renames a file into the trash
+ *       directory of its volume under a new numbered name, so that it is
+ *       deleted without waiting for the file system to free its blocks.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The caller removes the file itself when it is not put in the trash,
+ *       which includes files that are already in a trash directory.
+ *
+ *  \param [in] Filename File to delete.
+ *
+ *  \return Boolean file trashed response
+ *  \retval true  File renamed into the trash
+ *  \retval false File not renamed, the caller removes it
+ *
+ *  \sa #FM_ChildTrashVolume, #FM_ChildPurgeCmd
+ */
+bool FM_ChildTrashFile(const char *Filename);
+
+/**
+ *  \brief Child Task Trash Volume Utility Function
+ *
+ *  \par Description
+ *       This function builds the name of the trash directory of the volume
+ *       holding a file and finds its entry in the trash directory list.  The
+ *       first time a volume is seen a free entry is claimed, after creating
+ *       the trash directory if it does not exist.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The volume is the first component of the path.  The list is searched
+ *       under #FM_GlobalData_t.ChildTrashSem.
+ *
+ *  \param [in] Filename   File to delete.
+ *  \param [out] TrashDir  Buffer for the trash directory name.
+ *  \param [in] BufferSize Size of the TrashDir buffer.
+ *
+ *  \return Trash directory list index, #FM_CHILD_TRASH_VOLUMES when the file
+ *          is in a trash directory or no entry can be used
+ */
+uint32 FM_ChildTrashVolume(const char *Filename, char *TrashDir, uint32 BufferSize);
+
+/**
+ *  \brief Child Task Get Dir List to File Command Handler
+ *
+ *  \par Description
+ *       This function is invoked when the FM child task has been granted the child
+ *       task handshake semaphore and the child task command queue contains arguments
+ *       that signal a get directory listing to a file command.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *
+ *  \param [in,out] Worker A pointer to the child task worker executing the command.
+ *  \param [in] CmdArgs A pointer to an entry in the child task handshake command
+ *       queue which contains the arguments necessary to process this command.
+ *
+ *  \sa #FM_ChildQueueEntry_t, #FM_GetDirListFileCmd_t
+ */
+void FM_ChildDirListFileCmd(FM_ChildWorker_t *Worker, const FM_ChildQueueEntry_t *CmdArgs);
+
+/**
+ *  \brief Child Task Get Dir List to Packet Command Handler
+ *
+ *  \par Description
+ *       This function is invoked when the FM child task has been granted the child
+ *       task handshake semaphore and the child task command queue contains arguments
+ *       that signal a get directory listing to a packet command.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *
+ *  \param [in,out] Worker A pointer to the child task worker executing the command.
+ *  \param [in] CmdArgs A pointer to an entry in the child task handshake command
+ *       queue which contains the arguments necessary to process this command.
+ *
+ *  \sa #FM_ChildQueueEntry_t, #FM_GetDirListPktCmd_t
+ */
+void FM_ChildDirListPktCmd(FM_ChildWorker_t *Worker, const FM_ChildQueueEntry_t *CmdArgs);
+
+/**
+ *  \brief Child Task Set Permissions Command Handler
+ *
+ *  \par Description
+ *       This function is invoked when the FM child task has been granted the child
+ *       task handshake semaphore and the child task command queue contains arguments
+ *       that signal a set permissions / mode on the source1 file or directory
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *
+ *  \param [in,out] Worker A pointer to the child task worker executing the command.
+ *  \param [in] CmdArgs A pointer to an entry in the child task handshake command
+ *       queue which contains the arguments necessary to process this command.
+ *
+ *  \sa #FM_ChildQueueEntry_t, #FM_SetPermissionsCmd_t
+ */
+void FM_ChildSetPermissionsCmd(FM_ChildWorker_t *Worker, const FM_ChildQueueEntry_t *CmdArgs);
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM child task utility functions                                 */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**
+ *  \brief Child Task Get Dir List to File Initialization Function
+ *
+ *  \par Description
+ *       This function creates the output file and then writes both the CFE file header
+ *       and a blank copy of the directory list statistics structure to the output file.
+ *       At the end of the command, software will re-write the statistics structure,
+ *       this time with up to date values.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *
+ *  \param [in,out] Worker       A pointer to the child task worker executing the command.
+ *  \param [out] FileHandlePtr A pointer to a file handle variable which is modified to
+ *       contain the newly created output file handle.
+ *  \param [in] Directory      A pointer to a buffer containing the directory name.
+ *  \param [in] Filename       A pointer to a buffer containing the output filename.
+ *
+ *  \return Execution status, see \ref CFEReturnCodes and \ref OSReturnCodes
+ *  \retval #CFE_SUCCESS \copybrief CFE_SUCCESS
+ */
+bool FM_ChildDirListFileInit(FM_ChildWorker_t *Worker, osal_id_t *FileHandlePtr, const char *Directory,
+                             const char *Filename);
+
+/**
+ *  \brief Child Task Get Dir List to File Loop Processor Function
+ *
+ *  \par Description
+ *       This function reads each directory entry, determines the last modify time
+ *       size and mode for each entry, and writes the entry data to the output file.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *
+ *  \param [in,out] Worker      A pointer to the child task worker executing the command.
+ *  \param [in] DirId           Directory ID, a handle used to read directory entries.
+ *  \param [in] FileHandle      Output file handle.
+ *  \param [in] Directory       Pointer to a buffer containing the directory name.
+ *  \param [in] DirWithSep      Pointer to directory name with path separator appended.
+ *  \param [in] Filename        Pointer to a buffer containing the output filename.
+ *  \param [in] GetSizeTimeMode Option to call OS_stat for size, time, mode of files
+ */
+void FM_ChildDirListFileLoop(FM_ChildWorker_t *Worker, osal_id_t DirId, osal_id_t FileHandle, const char *Directory,
+                             const char *DirWithSep, const char *Filename, uint8 GetSizeTimeMode);
+
+/**
+ *  \brief Child Task Copy File Utility Function
+ *
+ *  \par Description
+ *       This function copies the source file to the target file with
+ *       #FM_ChildKernelCopy when the kernel can copy the files.  Otherwise it
+ *       opens the source file and creates (or truncates) the target file,
+ *       then copies the data with #FM_ChildCopyStream.  A copy resumed from a
+ *       checkpoint is always streamed, starting at the checkpoint offset of
+ *       the existing target file.  The number of bytes in the target file is
+ *       left in #FM_ChildWorker_t.CopyBytes.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       A partial target file is removed if the copy fails.
+ *
+ *  \param [in,out] Worker A pointer to the child task worker executing the command.
+ *  \param [in] Source     Pointer to a buffer containing the source filename.
+ *  \param [in] Target     Pointer to a buffer containing the target filename.
+ *  \param [in] EventID    Error event ID (command specific)
+ *  \param [in] CmdText    Error event text (command specific)
+ *
+ *  \return Boolean copy success response
+ *  \retval true  Target file holds a complete copy of the source file
+ *  \retval false Copy failed, an error event has been sent
+ */
+bool FM_ChildCopyFile(FM_ChildWorker_t *Worker, const char *Source, const char *Target, uint32 EventID,
+                      const char *CmdText);
+
+/**
+ *  \brief Child Task Kernel Copy Utility Function
+ *
+ *  \par Description
+ *       This function copies the source file to the target file with the
+ *       kernel copy method included in the build (see fm_kernel_copy.h), so
+ *       the data does not pass through the child task buffers.  The target
+ *       file is created or truncated, or with Append set the data is added at
+ *       its end.  The data is copied #FM_GlobalData_t.ChildCopyBlockSize bytes
+ *       at a time and each chunk is charged to the throttles of both files
+ *       with #FM_ChildThrottle.  The number of bytes copied is added to
+ *       #FM_ChildWorker_t.CopyBytes.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       #CFE_STATUS_NOT_IMPLEMENTED means nothing was copied and the caller
+ *       must copy the data itself, no event is sent in that case.
+ *
+ *  \param [in,out] Worker A pointer to the child task worker executing the command.
+ *  \param [in] Source     Pointer to a buffer containing the source filename.
+ *  \param [in] Target     Pointer to a buffer containing the target filename.
+ *  \param [in] Append     Set to add the data at the end of the target file.
+ *  \param [in] EventID    Error event ID (command specific)
+ *  \param [in] CmdText    Error event text (command specific)
+ *
+ *  \return Execution status
+ *  \retval #CFE_SUCCESS                The kernel copied the whole file
+ *  \retval #CFE_STATUS_NOT_IMPLEMENTED The kernel cannot copy these files
+ *  \retval Other                       Copy failed, an error event has been sent
+ */
+int32 FM_ChildKernelCopy(FM_ChildWorker_t *Worker, const char *Source, const char *Target, bool Append,
+                         uint32 EventID, const char *CmdText);
+
+/**
+ *  \brief Child Task Copy Stream Utility Function
+ *
+ *  \par Description
+ *       This function copies the rest of the open source file to the current
+ *       position of the open target file through the child task copy buffers,
+ *       reading #FM_GlobalData_t.ChildCopyBlockSize bytes at a time.  When the
+ *       copy writer task of the worker is running, the child task fills one
+ *       copy buffer while the writer task drains the previous ones, so reads
+ *       from the source device overlap writes to the target device.  Otherwise
+ *       each buffer is written by the child task right after it is read.  Each
+ *       block read is charged to the throttles of both files with
+ *       #FM_ChildThrottle.  The number of bytes written is added to
+ *       #FM_ChildWorker_t.CopyBytes.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The function does not return until every buffer handed to the writer
+ *       task has been drained, so the caller may close the files right away.
+ *
+ *  \param [in,out] Worker     A pointer to the child task worker executing the command.
+ *  \param [in] FileHandleSrc  Source file handle, open for reading.
+ *  \param [in] FileHandleTgt  Target file handle, open for writing.
+ *  \param [in] Source         Pointer to a buffer containing the source filename.
+ *  \param [in] Target         Pointer to a buffer containing the target filename.
+ *  \param [in] ReadEventID    Read error event ID (command specific)
+ *  \param [in] WriteEventID   Write error event ID (command specific)
+ *  \param [in] CmdText        Error event text (command specific)
+ *
+ *  \return Boolean copy success response
+ *  \retval true  All of the source data was written to the target file
+ *  \retval false Copy failed, an error event has been sent
+ *
+ *  \sa #FM_ChildWriterTask, #FM_ChildCopyWrite
+ */
+bool FM_ChildCopyStream(FM_ChildWorker_t *Worker, osal_id_t FileHandleSrc, osal_id_t FileHandleTgt,
+                        const char *Source, const char *Target, uint32 ReadEventID, uint32 WriteEventID,
+                        const char *CmdText);
+
+/**
+ *  \brief Child Task Copy Buffer Write Utility Function
+ *
+ *  \par Description
+ *       This function writes one filled copy buffer to the target file of the
+ *       copy in progress.  The first failed write is recorded in the worker,
+ *       after which the remaining buffers of the copy are not written.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called by the copy writer task, or by the child task itself when the
+ *       writer task is not running.  No event is sent from here.
+ *
+ *  \param [in,out] Worker A pointer to the child task worker that owns the buffer.
+ *  \param [in] Slot       Index of the copy buffer to write.
+ *
+ *  \sa #FM_ChildCopyStream
+ */
+void FM_ChildCopyWrite(FM_ChildWorker_t *Worker, uint8 Slot);
+
+/**
+ *  \brief Child Task File Size Time and Mode Utility Function
+ *
+ *  \par Description
+ *       This function is invoked to query the last modify time, current size and mode (permissions) for
+ *       each directory entry when processing either the Get Directory List to File
+ *       or Get Directory List to Packet commands.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *
+ *  \param [in] Filename  Pointer to the combined directory and entry names.
+ *  \param [out] FileSize Pointer to the number containing the current entry size.
+ *  \param [out] FileTime Pointer to the number containing the last modify time.
+ *  \param [out] FileMode Pointer to the value containing the mode (permissions).
+ *
+ *  \return Execution status, see \ref CFEReturnCodes and \ref OSReturnCodes
+ *  \retval #CFE_SUCCESS \copybrief CFE_SUCCESS
+ */
+int32 FM_ChildSizeTimeMode(const char *Filename, uint32 *FileSize, uint32 *FileTime, uint32 *FileMode);
+
+/**
+ *  \brief Child Task Sleep and Stat Utility Function
+ *
+ *  \par Description
+ *       This function is invoked to query the last modify time, current size and mode (permissions) for
+ *       each directory entry when processing either the Get Directory List to File
+ *       or Get Directory List to Packet commands.
+ *       Each query is charged to the stat throttle of the file with #FM_ChildThrottle, which
+ *       sleeps when the volume is over its OS_stat rate.  The function only queries (and sleeps)
+ *       if getSizeTimeMode is TRUE, otherwise the entry size, time and mode are cleared.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *
+ *  \param [in] Filename        Pointer to the combined directory and entry names.
+ *  \param [out] DirListData    Pointer to the data containing the current entry size, last modify time, and mode
+ *  \param [in] GetSizeTimeMode Whether this function should call FM_ChildSizeTimeMode
+ */
+void FM_ChildSleepStat(const char *Filename, FM_DirListEntry_t *DirListData, bool GetSizeTimeMode);
+
+/**
+ *  \brief Child Task Throttle Utility Function
+ *
+ *  \par Description
+ *       This function charges file system work just done by a child task to
+ *       the throttle of the volume holding the source file and, when it is on
+ *       another volume, to the throttle of the target file.  If either volume
+ *       is over its byte or OS_stat rate the child task gives up the CPU until
+ *       the volume has caught up.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The throttle entries are updated while holding
+ *       #FM_GlobalData_t.ChildThrottleSem, the task delay happens after it
+ *       has been released.
+ *
+ *  \param [in] Source Pointer to the source filename.
+ *  \param [in] Target Pointer to the target filename, NULL when there is no target.
+ *  \param [in] Bytes  Number of bytes read or written.
+ *  \param [in] Stats  Number of OS_stat calls made.
+ *
+ *  \sa #FM_SET_THROTTLE_CC
+ */
+void FM_ChildThrottle(const char *Source, const char *Target, uint32 Bytes, uint32 Stats);
+
+/**
+ *  \brief Child Task Throttle Select Utility Function
+ *
+ *  \par Description
+ *       This function finds the throttle entry of the volume holding a file.
+ *       A volume matches when it is a whole path prefix of the filename, the
+ *       longest matching volume wins.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The caller holds #FM_GlobalData_t.ChildThrottleSem.
+ *
+ *  \param [in] Path Pointer to the filename.
+ *
+ *  \return Index of the throttle entry
+ *  \retval #FM_CHILD_THROTTLE_DEFAULT No volume entry matches the file
+ */
+uint32 FM_ChildThrottleSelect(const char *Path);
+
+/**
+ *  \brief Child Task Throttle Charge Utility Function
+ *
+ *  \par Description
+ *       This function refills both buckets of a throttle entry for the time
+ *       since they were last used and then takes the work just done out of
+ *       them.  Volume rates of #FM_THROTTLE_RATE_DEFAULT use the default rates.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The caller holds #FM_GlobalData_t.ChildThrottleSem.
+ *
+ *  \param [in] Index Index of the throttle entry.
+ *  \param [in] Now   Current time.
+ *  \param [in] Bytes Number of bytes read or written.
+ *  \param [in] Stats Number of OS_stat calls made.
+ *
+ *  \return Milliseconds the caller must sleep, zero if the volume is within its rates
+ */
+uint32 FM_ChildThrottleCharge(uint32 Index, OS_time_t Now, uint32 Bytes, uint32 Stats);
+
+/**
+ *  \brief Child Task Throttle Bucket Utility Function
+ *
+ *  \par Description
+ *       This function refills one token bucket at Rate for ElapsedUs, up to a
+ *       depth of #FM_CHILD_THROTTLE_BURST_MS of work, and then takes Used out
+ *       of it.  Tokens are kept in units of (Rate * microseconds).  A bucket
+ *       may run negative, the returned delay is the time it takes to refill
+ *       to zero.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       A Rate of #FM_THROTTLE_RATE_UNLIMITED never asks for a delay.
+ *
+ *  \param [in,out] Tokens Pointer to the bucket level.
+ *  \param [in] Rate       Units per second.
+ *  \param [in] ElapsedUs  Microseconds since the bucket was last refilled.
+ *  \param [in] Used       Units of work just done.
+ *
+ *  \return Milliseconds the caller must sleep, zero if the bucket is not empty
+ */
+uint32 FM_ChildThrottleBucket(int64 *Tokens, uint32 Rate, int64 ElapsedUs, uint32 Used);
+
+/**
+ *  \brief Child Task Abort Check Utility Function
+ *
+ *  \par Description
+ *       This function reports whether the command in progress has been
+ *       aborted by an #FM_ABORT_CC command.  Long running loops call it
+ *       between blocks or directory entries and stop when it returns true.
+ *       The abort event is sent the first time the request is seen.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The parent task only writes #FM_ChildWorker_t.AbortSequence, a
+ *       request for a command that has already finished never matches.
+ *
+ *  \param [in] Worker  Pointer to the child task worker.
+ *  \param [in] CmdText Text identifying the command in progress.
+ *
+ *  \return Whether the command in progress has been aborted
+ */
+bool FM_ChildAbortCheck(FM_ChildWorker_t *Worker, const char *CmdText);
+
+/**
+ *  \brief Child Task Checkpoint Resume Utility Function
+ *
+ *  \par Description
+ *       This function is called once when a child task starts.  If the child
+ *       task checkpoint file exists, the copy, move or concat command saved
+ *       in it is executed again and resumes from the checkpoint offset (see
+ *       #FM_ChildCheckpointSource).  An invalid checkpoint file is removed.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The resumed command is not taken from the queue.
+ *
+ *  \param [in,out] Worker Pointer to the child task worker.
+ *
+ *  \sa #FM_CHILD_CHECKPOINT_FILE
+ */
+void FM_ChildCheckpointResume(FM_ChildWorker_t *Worker);
+
+/**
+ *  \brief Child Task Checkpoint Begin Utility Function
+ *
+ *  \par Description
+ *       This function starts the checkpoint record of a copy, move or concat
+ *       command.  Nothing is written until the first source has been copied
+ *       for #FM_CHILD_CHECKPOINT_INTERVAL bytes.  A resumed command keeps the
+ *       record read from the checkpoint file.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Every call is paired with a call to #FM_ChildCheckpointEnd.
+ *
+ *  \param [in,out] Worker Pointer to the child task worker.
+ *  \param [in] CmdArgs    Arguments of the command being started.
+ */
+void FM_ChildCheckpointBegin(FM_ChildWorker_t *Worker, const FM_ChildQueueEntry_t *CmdArgs);
+
+/**
+ *  \brief Child Task Checkpoint Source Utility Function
+ *
+ *  \par Description
+ *       This function is called before each source file of a checkpointed
+ *       command is copied.  Normally it records where the source starts in
+ *       the target file (#FM_ChildWorker_t.CopyBytes) along with the size and
+ *       modify time of the source, and returns a resume offset of zero.  For
+ *       the source named in the checkpoint of a resumed command it instead
+ *       checks that the source is unchanged and that the target file still
+ *       holds the checkpointed data, then returns the checkpoint offset.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The caller positions both files with #FM_ChildCheckpointSeek when
+ *       the resume offset is not zero.
+ *
+ *  \param [in,out] Worker     Pointer to the child task worker.
+ *  \param [in]  SourceIndex   Zero based number of the source within the command.
+ *  \param [in]  Source        Source filename
+ *  \param [in]  Target        Target filename
+ *  \param [in]  CmdText       Error event text
+ *  \param [out] ResumeOffset  Source offset to resume the copy at
+ *
+ *  \return Whether the copy of the source may go ahead
+ *  \retval true  Copy the source from the resume offset
+ *  \retval false The checkpoint does not match the files, an error event has been sent
+ */
+bool FM_ChildCheckpointSource(FM_ChildWorker_t *Worker, uint32 SourceIndex, const char *Source, const char *Target,
+                              const char *CmdText, uint32 *ResumeOffset);
+
+/**
+ *  \brief Child Task Checkpoint Seek Utility Function
+ *
+ *  \par Description
+ *       This function positions the source and target files of a resumed copy
+ *       at the checkpoint offsets.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *
+ *  \param [in] Worker        Pointer to the child task worker.
+ *  \param [in] FileHandleSrc Open source file handle
+ *  \param [in] FileHandleTgt Open target file handle
+ *  \param [in] CmdText       Error event text
+ *
+ *  \return Boolean seek success response
+ *  \retval true  Both files are positioned at the checkpoint
+ *  \retval false Seek failed, an error event has been sent
+ */
+bool FM_ChildCheckpointSeek(FM_ChildWorker_t *Worker, osal_id_t FileHandleSrc, osal_id_t FileHandleTgt,
+                            const char *CmdText);
+
+/**
+ *  \brief Child Task Checkpoint Save Utility Function
+ *
+ *  \par Description
+ *       This function is called by the copy loops each time more source bytes
+ *       are known to be written to the target file.  The checkpoint file is
+ *       rewritten each time another #FM_CHILD_CHECKPOINT_INTERVAL bytes have
+ *       been copied.  If the file cannot be written the command carries on
+ *       without further checkpoints.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Only bytes that have actually been written may be reported, with a
+ *       copy writer task a buffer counts once the writer has handed it back.
+ *
+ *  \param [in,out] Worker Pointer to the child task worker.
+ *  \param [in] Bytes      Number of source bytes just written to the target file.
+ */
+void FM_ChildCheckpointSave(FM_ChildWorker_t *Worker, uint32 Bytes);
+
+/**
+ *  \brief Child Task Checkpoint End Utility Function
+ *
+ *  \par Description
+ *       This function is called when a checkpointed command completes, fails
+ *       or is aborted.  It removes the checkpoint file, if one was written, so
+ *       the command is not resumed.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *
+ *  \param [in,out] Worker Pointer to the child task worker.
+ */
+void FM_ChildCheckpointEnd(FM_ChildWorker_t *Worker);
+
+/**
+ *  \brief Child Task Checkpoint Filename Utility Function
+ *
+ *  \par Description
+ *       This function builds the checkpoint filename of a child task from
+ *       #FM_CHILD_CHECKPOINT_FILE and the child task index.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *
+ *  \param [in]  Worker     Pointer to the child task worker.
+ *  \param [out] FileName   Buffer for the checkpoint filename.
+ *  \param [in]  BufferSize Size of the filename buffer, in bytes.
+ */
+void FM_ChildCheckpointName(const FM_ChildWorker_t *Worker, char *FileName, uint32 BufferSize);
+
+/**
+ *  \brief Child Task Progress Begin Utility Function
+ *
+ *  \par Description
+ *       This function is called before each command is executed.  It clears
+ *       the byte counts reported in the child task progress packet, reports
+ *       the command source and target names and records the start time.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *
+ *  \param [in,out] Worker Pointer to the child task worker.
+ *
+ *  \sa #FM_SendChildProgress
+ */
+void FM_ChildProgressBegin(FM_ChildWorker_t *Worker);
+
+/**
+ *  \brief Child Task Progress Source Utility Function
+ *
+ *  \par Description
+ *       This function is called when a command starts reading a source file.
+ *       It reports the source and target names and adds the bytes to be read
+ *       to the progress total.  The loops that read the file add each block
+ *       to the progress byte count.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *
+ *  \param [in,out] Worker Pointer to the child task worker.
+ *  \param [in]     Source Source filename.
+ *  \param [in]     Target Target filename, empty if none.
+ *  \param [in]     Bytes  Bytes the command will read from the source.
  */
-void FM_ChildSleepStat(const char *Filename, FM_DirListEntry_t *DirListData, int32 *FilesTillSleep,
-                       bool GetSizeTimeMode);
+void FM_ChildProgressSource(FM_ChildWorker_t *Worker, const char *Source, const char *Target, uint32 Bytes);
 
 #endif
@@ -28,6 +28,7 @@
 #include "cfe.h"
 #include "fm_app.h"
 #include "fm_msg.h"
+#include "fm_msgdefs.h"
 #include "fm_cmd_utils.h"
 #include "fm_child.h"
 #include "fm_perfids.h"
@@ -37,7 +38,6 @@
 #include <ctype.h>
 
 static uint32 OpenFileCount = 0;
-static bool   FileIsOpen    = false;
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
@@ -107,60 +107,200 @@ uint32 FM_GetOpenFilesData(FM_OpenFilesEntry_t *OpenFilesData)
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* FM utility function -- query filename state                     */
+/* FM utility function -- check name is terminated and not empty   */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-static void SearchOpenFileData(osal_id_t ObjId, void *CallbackArg)
+bool FM_IsValidNameString(const char *Name, size_t BufferSize)
 {
-    const char *   Fname = (const char *)CallbackArg;
-    OS_file_prop_t FdProp;
+    bool  NameIsValid = false;
+    int32 StringLength;
+
+    if (Name != NULL)
+    {
+        /* Search Name for a string terminator */
+        for (StringLength = 0; StringLength < BufferSize; StringLength++)
+        {
+            if (Name[StringLength] == '\0')
+            {
+                break;
+            }
+        }
+
+        /* Verify that Name is not empty and has a terminator */
+        if ((StringLength > 0) && (StringLength < BufferSize))
+        {
+            NameIsValid = true;
+        }
+    }
+
+    return NameIsValid;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM utility function -- snapshot the names of open streams       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+static uint32 FM_OpenPathHash(const char *Path)
+{
+    uint32 Hash = 2166136261u;
+
+    /* FNV-1a */
+    while (*Path != '\0')
+    {
+        Hash ^= (uint8)*Path;
+        Hash *= 16777619u;
+        Path++;
+    }
+
+    return Hash;
+}
+
+static void AddOpenPath(FM_OpenPathSet_t *OpenPaths, const char *Path)
+{
+    uint32 Index;
+    uint32 SlotIndex;
+
+    if (OpenPaths->Count >= FM_OPEN_PATH_SET_ENTRIES)
+    {
+        OpenPaths->Overflow = true;
+    }
+    else
+    {
+        Index = OpenPaths->Count;
+
+        strncpy(OpenPaths->Path[Index], Path, OS_MAX_PATH_LEN - 1);
+        OpenPaths->Path[Index][OS_MAX_PATH_LEN - 1] = '\0';
+        OpenPaths->Hash[Index]                      = FM_OpenPathHash(OpenPaths->Path[Index]);
+
+        /* Linear probe, the set always has more slots than names */
+        SlotIndex = OpenPaths->Hash[Index] % FM_OPEN_PATH_SET_SLOTS;
+        while (OpenPaths->Slot[SlotIndex] != 0)
+        {
+            SlotIndex = (SlotIndex + 1) % FM_OPEN_PATH_SET_SLOTS;
+        }
+
+        OpenPaths->Slot[SlotIndex] = Index + 1;
+        OpenPaths->Count++;
+    }
+}
+
+static void LoadOpenPathSet(osal_id_t ObjId, void *CallbackArg)
+{
+    FM_OpenPathSet_t *OpenPaths = (FM_OpenPathSet_t *)CallbackArg;
+    OS_file_prop_t    FdProp;
 
     memset(&FdProp, 0, sizeof(FdProp));
 
     if (OS_IdentifyObject(ObjId) == OS_OBJECT_TYPE_OS_STREAM)
     {
-        /* Get system info for each file descriptor table entry */
         /* If the FD table entry is valid - then the file is open */
         if (OS_FDGetInfo(ObjId, &FdProp) == OS_SUCCESS)
         {
-            if (strcmp(Fname, FdProp.Path) == 0)
-            {
-                FileIsOpen = true;
-            }
+            AddOpenPath(OpenPaths, FdProp.Path);
         }
     }
 }
 
-uint32 FM_GetFilenameState(const char *Filename, size_t BufferSize, bool FileInfoCmd)
+void FM_BuildOpenPathSet(FM_OpenPathSet_t *OpenPaths)
 {
-    os_fstat_t FileStatus;
-    uint32     FilenameState   = FM_NAME_IS_INVALID;
-    bool       FilenameIsValid = false;
-    int32      StringLength;
+    const FM_ChildWorker_t *Worker;
+    uint32                  i;
+    uint32                  j;
 
-    memset(&FileStatus, 0, sizeof(FileStatus));
+    memset(OpenPaths->Slot, 0, sizeof(OpenPaths->Slot));
+
+    OpenPaths->Count    = 0;
+    OpenPaths->Overflow = false;
+
+    OS_ForEachObject(OS_OBJECT_CREATOR_ANY, LoadOpenPathSet, OpenPaths);
 
-    if (Filename != NULL)
+    /* A kernel copy holds its files open outside of OSAL */
+    OS_MutSemTake(FM_GlobalData.ChildDequeueSem);
+
+    for (i = 0; i < FM_CHILD_TASK_COUNT; i++)
     {
-        /* Search Filename for a string terminator */
-        for (StringLength = 0; StringLength < BufferSize; StringLength++)
+        Worker = &FM_GlobalData.ChildWorker[i];
+
+        if (Worker->KernelCopyOpen == true)
         {
-            if (Filename[StringLength] == '\0')
+            for (j = 0; j < FM_CHILD_CMD_PATHS; j++)
             {
-                break;
+                if (Worker->KernelCopyPaths.Path[j][0] != '\0')
+                {
+                    AddOpenPath(OpenPaths, Worker->KernelCopyPaths.Path[j]);
+                }
             }
         }
+    }
 
-        /* Verify that Filename is not empty and has a terminator */
-        if ((StringLength > 0) && (StringLength < BufferSize))
+    OS_MutSemGive(FM_GlobalData.ChildDequeueSem);
+
+    OpenPaths->Valid = true;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM utility function -- look up a name in the open path set      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_IsPathOpen(FM_OpenPathSet_t *OpenPaths, const char *Path)
+{
+    bool   PathIsOpen = false;
+    uint32 Hash;
+    uint32 SlotIndex;
+    uint32 Index;
+
+    /* The first lookup made by a command takes the snapshot */
+    if (OpenPaths->Valid == false)
+    {
+        FM_BuildOpenPathSet(OpenPaths);
+    }
+
+    if (OpenPaths->Overflow == true)
+    {
+        /* Names were left out, so any name might be open */
+        PathIsOpen = true;
+    }
+    else
+    {
+        Hash      = FM_OpenPathHash(Path);
+        SlotIndex = Hash % FM_OPEN_PATH_SET_SLOTS;
+
+        while ((PathIsOpen == false) && (OpenPaths->Slot[SlotIndex] != 0))
         {
-            FilenameIsValid = true;
+            Index = OpenPaths->Slot[SlotIndex] - 1;
+
+            if ((OpenPaths->Hash[Index] == Hash) && (strcmp(OpenPaths->Path[Index], Path) == 0))
+            {
+                PathIsOpen = true;
+            }
+
+            SlotIndex = (SlotIndex + 1) % FM_OPEN_PATH_SET_SLOTS;
         }
     }
 
+    return PathIsOpen;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM utility function -- query filename state                     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+uint32 FM_GetFilenameState(const char *Filename, size_t BufferSize, bool FileInfoCmd, FM_OpenPathSet_t *OpenPaths)
+{
+    os_fstat_t FileStatus;
+    uint32     FilenameState = FM_NAME_IS_INVALID;
+
+    memset(&FileStatus, 0, sizeof(FileStatus));
+
     /* If Filename is valid, then determine its state */
-    if (FilenameIsValid)
+    if (FM_IsValidNameString(Filename, BufferSize))
     {
         /* Check to see if Filename is in use */
         if (OS_stat(Filename, &FileStatus) == OS_SUCCESS)
@@ -175,11 +315,8 @@ uint32 FM_GetFilenameState(const char *Filename, size_t BufferSize, bool FileInf
             {
                 /* Filename is a file, but is it open? */
                 FilenameState = FM_NAME_IS_FILE_CLOSED;
-                FileIsOpen    = false;
 
-                OS_ForEachObject(OS_OBJECT_CREATOR_ANY, SearchOpenFileData, (void *)Filename);
-
-                if (FileIsOpen == true)
+                if (FM_IsPathOpen(OpenPaths, Filename))
                 {
                     FilenameState = FM_NAME_IS_FILE_OPEN;
                 }
@@ -222,8 +359,19 @@ uint32 FM_VerifyNameValid(const char *Name, size_t BufferSize, uint32 EventID, c
     char   LocalFile[1 + OS_MAX_PATH_LEN];
     uint32 FilenameState = FM_NAME_IS_INVALID;
 
-    /* Looking for filename state != FM_NAME_IS_INVALID */
-    FilenameState = FM_GetFilenameState(Name, BufferSize, true);
+    if (FM_GlobalData.ChildVerifyMode == FM_VERIFY_MODE_CHILD)
+    {
+        /* Only the name is checked here, the child task finds the state when the command executes */
+        if (FM_IsValidNameString(Name, BufferSize))
+        {
+            FilenameState = FM_NAME_IS_NOT_IN_USE;
+        }
+    }
+    else
+    {
+        /* Looking for filename state != FM_NAME_IS_INVALID */
+        FilenameState = FM_GetFilenameState(Name, BufferSize, true, &FM_GlobalData.OpenPaths);
+    }
 
     if (FilenameState == FM_NAME_IS_INVALID)
     {
@@ -245,7 +393,7 @@ uint32 FM_VerifyNameValid(const char *Name, size_t BufferSize, uint32 EventID, c
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
 bool FM_VerifyFileState(FM_File_States State, const char *Filename, size_t BufferSize, uint32 EventID,
-                        const char *CmdText)
+                        const char *CmdText, FM_OpenPathSet_t *OpenPaths)
 {
     bool        Result        = false;
     uint32      FilenameState = FM_NAME_IS_INVALID;
@@ -254,7 +402,7 @@ bool FM_VerifyFileState(FM_File_States State, const char *Filename, size_t Buffe
     char        LocalFile[1 + OS_MAX_PATH_LEN];
 
     /* Get state of the filename */
-    FilenameState = FM_GetFilenameState(Filename, BufferSize, false);
+    FilenameState = FM_GetFilenameState(Filename, BufferSize, false, OpenPaths);
 
     switch (FilenameState)
     {
@@ -348,6 +496,38 @@ bool FM_VerifyFileState(FM_File_States State, const char *Filename, size_t Buffe
     return Result;
 }
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM utility function -- verify state now or in the child task    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_VerifyFileStateOrDefer(FM_File_States State, const char *Filename, size_t BufferSize, uint32 EventID,
+                               const char *CmdText)
+{
+    bool Result = true;
+    char LocalFile[1 + OS_MAX_PATH_LEN];
+
+    if (FM_GlobalData.ChildVerifyMode == FM_VERIFY_MODE_CHILD)
+    {
+        /* The child task verifies the state when the command executes */
+        if (!FM_IsValidNameString(Filename, BufferSize))
+        {
+            Result = false;
+
+            CFE_SB_MessageStringGet(LocalFile, Filename, NULL, sizeof(LocalFile), BufferSize);
+            CFE_EVS_SendEvent((EventID + FM_FNAME_INVALID_EID_OFFSET), CFE_EVS_EventType_ERROR,
+                              "%s error: filename is invalid: name = %s", CmdText, LocalFile);
+        }
+    }
+    else
+    {
+        Result = FM_VerifyFileState(State, Filename, BufferSize, EventID, CmdText, &FM_GlobalData.OpenPaths);
+    }
+
+    return Result;
+}
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* FM utility function -- verify state is closed file              */
@@ -356,7 +536,7 @@ bool FM_VerifyFileState(FM_File_States State, const char *Filename, size_t Buffe
 
 bool FM_VerifyFileClosed(const char *Filename, size_t BufferSize, uint32 EventID, const char *CmdText)
 {
-    return FM_VerifyFileState(FM_FILE_CLOSED, Filename, BufferSize, EventID, CmdText);
+    return FM_VerifyFileStateOrDefer(FM_FILE_CLOSED, Filename, BufferSize, EventID, CmdText);
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
@@ -367,7 +547,7 @@ bool FM_VerifyFileClosed(const char *Filename, size_t BufferSize, uint32 EventID
 
 bool FM_VerifyFileExists(const char *Filename, size_t BufferSize, uint32 EventID, const char *CmdText)
 {
-    return FM_VerifyFileState(FM_FILE_EXISTS, Filename, BufferSize, EventID, CmdText);
+    return FM_VerifyFileStateOrDefer(FM_FILE_EXISTS, Filename, BufferSize, EventID, CmdText);
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
@@ -378,7 +558,7 @@ bool FM_VerifyFileExists(const char *Filename, size_t BufferSize, uint32 EventID
 
 bool FM_VerifyFileNoExist(const char *Filename, size_t BufferSize, uint32 EventID, const char *CmdText)
 {
-    return FM_VerifyFileState(FM_FILE_NOEXIST, Filename, BufferSize, EventID, CmdText);
+    return FM_VerifyFileStateOrDefer(FM_FILE_NOEXIST, Filename, BufferSize, EventID, CmdText);
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
@@ -389,7 +569,7 @@ bool FM_VerifyFileNoExist(const char *Filename, size_t BufferSize, uint32 EventI
 
 bool FM_VerifyFileNotOpen(const char *Filename, size_t BufferSize, uint32 EventID, const char *CmdText)
 {
-    return FM_VerifyFileState(FM_FILE_NOTOPEN, Filename, BufferSize, EventID, CmdText);
+    return FM_VerifyFileStateOrDefer(FM_FILE_NOTOPEN, Filename, BufferSize, EventID, CmdText);
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
@@ -400,7 +580,7 @@ bool FM_VerifyFileNotOpen(const char *Filename, size_t BufferSize, uint32 EventI
 
 bool FM_VerifyDirExists(const char *Directory, size_t BufferSize, uint32 EventID, const char *CmdText)
 {
-    return FM_VerifyFileState(FM_DIR_EXISTS, Directory, BufferSize, EventID, CmdText);
+    return FM_VerifyFileStateOrDefer(FM_DIR_EXISTS, Directory, BufferSize, EventID, CmdText);
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
@@ -411,7 +591,7 @@ bool FM_VerifyDirExists(const char *Directory, size_t BufferSize, uint32 EventID
 
 bool FM_VerifyDirNoExist(const char *Name, size_t BufferSize, uint32 EventID, const char *CmdText)
 {
-    return FM_VerifyFileState(FM_DIR_NOEXIST, Name, BufferSize, EventID, CmdText);
+    return FM_VerifyFileStateOrDefer(FM_DIR_NOEXIST, Name, BufferSize, EventID, CmdText);
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
@@ -424,8 +604,8 @@ bool FM_VerifyChildTask(uint32 EventID, const char *CmdText)
 {
     bool Result = false;
 
-    /* Copy of child queue count that child task cannot change */
-    uint8 LocalQueueCount = FM_GlobalData.ChildQueueCount;
+    /* Pending command count - child tasks can only make this smaller */
+    uint32 LocalQueueCount = FM_ChildQueueCount();
 
     /* Verify child task is active and queue interface is healthy */
     if (!OS_ObjectIdDefined(FM_GlobalData.ChildSemaphore))
@@ -444,18 +624,29 @@ bool FM_VerifyChildTask(uint32 EventID, const char *CmdText)
         /* Queue full - cannot add another command */
         Result = false;
     }
-    else if ((LocalQueueCount > FM_CHILD_QUEUE_DEPTH) || (FM_GlobalData.ChildWriteIndex >= FM_CHILD_QUEUE_DEPTH))
+    else if ((LocalQueueCount > FM_CHILD_QUEUE_DEPTH) ||
+             (FM_GlobalData.ChildLane[FM_CHILD_LANE_FAST].WriteIndex >= FM_CHILD_LANE_INDEX_WRAP) ||
+             (FM_GlobalData.ChildLane[FM_CHILD_LANE_BULK].WriteIndex >= FM_CHILD_LANE_INDEX_WRAP))
     {
         CFE_EVS_SendEvent((EventID + FM_CHILD_BROKEN_EID_OFFSET), CFE_EVS_EventType_ERROR,
-                          "%s error: child task interface is broken: count = %d, index = %d", CmdText, LocalQueueCount,
-                          FM_GlobalData.ChildWriteIndex);
+                          "%s error: child task interface is broken: count = %d, index = %d/%d", CmdText,
+                          (int)LocalQueueCount, (int)FM_GlobalData.ChildLane[FM_CHILD_LANE_FAST].WriteIndex,
+                          (int)FM_GlobalData.ChildLane[FM_CHILD_LANE_BULK].WriteIndex);
 
         /* Queue broken - cannot add another command */
         Result = false;
     }
+    else if (FM_GetChildPathBlocksFree(FM_CHILD_PATH_BLOCKS_PER_CMD) < FM_CHILD_PATH_BLOCKS_PER_CMD)
+    {
+        CFE_EVS_SendEvent((EventID + FM_CHILD_Q_FULL_EID_OFFSET), CFE_EVS_EventType_ERROR,
+                          "%s error: child task queue is full: no free path blocks", CmdText);
+
+        /* Path block pool full - cannot add another command */
+        Result = false;
+    }
     else
     {
-        memset(&FM_GlobalData.ChildQueue[FM_GlobalData.ChildWriteIndex], 0, sizeof(FM_GlobalData.ChildQueue[0]));
+        memset(&FM_GlobalData.ChildStagingEntry, 0, sizeof(FM_GlobalData.ChildStagingEntry));
 
         /* OK to add another command to the queue */
         Result = true;
@@ -466,24 +657,283 @@ bool FM_VerifyChildTask(uint32 EventID, const char *CmdText)
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* FM utility function -- invoke child task command processor      */
+/* FM utility function -- select child queue lane for a command    */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-void FM_InvokeChildTask(void)
+uint8 FM_GetChildLane(const FM_ChildQueueEntry_t *CmdArgs)
+{
+    FM_ChildPathSet_t Paths;
+    uint8             Lane = FM_CHILD_LANE_BULK;
+
+    switch (CmdArgs->CommandCode)
+    {
+        case FM_RENAME_FILE_CC:
+        case FM_DELETE_FILE_CC:
+        case FM_CREATE_DIRECTORY_CC:
+        case FM_DELETE_DIRECTORY_CC:
+        case FM_SET_PERMISSIONS_CC:
+            Lane = FM_CHILD_LANE_FAST;
+            break;
+
+        case FM_GET_FILE_INFO_CC:
+            /* Only a file CRC makes file info a long running command */
+            if (CmdArgs->FileInfoCRC == FM_IGNORE_CRC)
+            {
+                Lane = FM_CHILD_LANE_FAST;
+            }
+            break;
+
+        default:
+            break;
+    }
+
+    /*
+    ** A fast lane command would overtake the bulk lane commands waiting
+    **  ahead of it, so one working on the same names as any of them joins
+    **  the bulk lane instead.  The child tasks take slots off the lanes
+    **  and release their names under the dequeue mutex.
+    */
+    if (Lane == FM_CHILD_LANE_FAST)
+    {
+        FM_GetEntryPaths(CmdArgs, &Paths);
+
+        OS_MutSemTake(FM_GlobalData.ChildDequeueSem);
+
+        if (FM_ChildLaneOverlaps(&FM_GlobalData.ChildLane[FM_CHILD_LANE_BULK], &Paths))
+        {
+            Lane = FM_CHILD_LANE_BULK;
+        }
+
+        OS_MutSemGive(FM_GlobalData.ChildDequeueSem);
+    }
+
+    return Lane;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM utility function -- count free queue path blocks             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+uint32 FM_GetChildPathBlocksFree(uint32 Limit)
+{
+    uint32 FreeCount = 0;
+    uint32 i;
+
+    for (i = 0; (i < FM_CHILD_PATH_BLOCK_COUNT) && (FreeCount < Limit); i++)
+    {
+        if (FM_ATOMIC_LOAD(&FM_GlobalData.ChildPathBlock[i].InUse) == 0)
+        {
+            FreeCount++;
+        }
+    }
+
+    return FreeCount;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM utility function -- store queued command path name           */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+uint16 FM_StoreChildPath(const char *Path)
+{
+    FM_ChildPathBlock_t *Block     = NULL;
+    FM_ChildPathBlock_t *PrevBlock = NULL;
+    uint16               PathRef   = 0;
+    uint32               Length    = strlen(Path) + 1;
+    uint32               Offset    = 0;
+    uint32               ChunkSize;
+    uint32               Searched;
+
+    /* Empty names are not stored */
+    if (Path[0] == '\0')
+    {
+        Length = 0;
+    }
+
+    while (Offset < Length)
+    {
+        /* Find the next free block - FM_VerifyChildTask has reserved enough */
+        for (Searched = 0; Searched < FM_CHILD_PATH_BLOCK_COUNT; Searched++)
+        {
+            Block = &FM_GlobalData.ChildPathBlock[FM_GlobalData.ChildPathCursor];
+
+            FM_GlobalData.ChildPathCursor = (FM_GlobalData.ChildPathCursor + 1) % FM_CHILD_PATH_BLOCK_COUNT;
+
+            if (FM_ATOMIC_LOAD(&Block->InUse) == 0)
+            {
+                break;
+            }
+        }
+
+        if (Searched == FM_CHILD_PATH_BLOCK_COUNT)
+        {
+            /* Pool exhausted - the child task gets a truncated name */
+            break;
+        }
+
+        ChunkSize = Length - Offset;
+        if (ChunkSize > FM_CHILD_PATH_BLOCK_SIZE)
+        {
+            ChunkSize = FM_CHILD_PATH_BLOCK_SIZE;
+        }
+
+        memcpy(Block->Data, &Path[Offset], ChunkSize);
+        Block->Next  = 0;
+        Block->InUse = 1;
+
+        /* Link the block onto the end of the name */
+        if (PrevBlock == NULL)
+        {
+            PathRef = (uint16)(Block - FM_GlobalData.ChildPathBlock) + 1;
+        }
+        else
+        {
+            PrevBlock->Next = (uint16)(Block - FM_GlobalData.ChildPathBlock) + 1;
+        }
+
+        PrevBlock = Block;
+        Offset += ChunkSize;
+    }
+
+    return PathRef;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM utility function -- release queued command path name         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_ReleaseChildPath(uint16 PathRef)
+{
+    FM_ChildPathBlock_t *Block;
+
+    while ((PathRef != 0) && (PathRef <= FM_CHILD_PATH_BLOCK_COUNT))
+    {
+        Block   = &FM_GlobalData.ChildPathBlock[PathRef - 1];
+        PathRef = Block->Next;
+
+        FM_ATOMIC_STORE(&Block->InUse, 0);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM utility function -- drop every queued child task command     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+uint32 FM_FlushChildQueue(void)
 {
-    /* Update callers queue index */
-    FM_GlobalData.ChildWriteIndex++;
+    FM_ChildLane_t *     Lane;
+    FM_ChildQueueSlot_t *Slot;
+    uint32               FlushCount = 0;
+    uint32               WaitCount;
+    uint32               ReadIndex;
+    uint32               i;
+    uint32               j;
+
+    /*
+    ** Holding the dequeue mutex keeps the child tasks from copying out a
+    **  slot while it is marked.  Slots the child tasks have not reached yet
+    **  stay queued, so every handshake semaphore count still finds a slot.
+    */
+    OS_MutSemTake(FM_GlobalData.ChildDequeueSem);
 
-    if (FM_GlobalData.ChildWriteIndex >= FM_CHILD_QUEUE_DEPTH)
+    for (i = 0; i < FM_CHILD_LANE_COUNT; i++)
     {
-        FM_GlobalData.ChildWriteIndex = 0;
+        Lane      = &FM_GlobalData.ChildLane[i];
+        WaitCount = FM_ChildLaneCount(Lane);
+        ReadIndex = Lane->ReadIndex;
+
+        for (j = 0; (j < WaitCount) && (j < FM_CHILD_QUEUE_DEPTH); j++)
+        {
+            Slot      = &Lane->Queue[ReadIndex % FM_CHILD_QUEUE_DEPTH];
+            ReadIndex = FM_ChildLaneNextIndex(ReadIndex);
+
+            if (Slot->Flushed == false)
+            {
+                FM_ReleaseChildPath(Slot->Source1);
+                FM_ReleaseChildPath(Slot->Source2);
+                FM_ReleaseChildPath(Slot->Target);
+                FM_ReleaseChildPath(Slot->SourceList);
+
+                Slot->Source1    = 0;
+                Slot->Source2    = 0;
+                Slot->Target     = 0;
+                Slot->SourceList = 0;
+                Slot->Flushed    = true;
+
+                /* A dropped retention pass frees its entry for the next one */
+                if (Slot->CommandCode == FM_ENFORCE_RETENTION_CC)
+                {
+                    FM_ATOMIC_STORE(&FM_GlobalData.Retention[Slot->RetentionIndex].Busy, 0);
+                }
+
+                /* As does a dropped purge pass */
+                if (Slot->CommandCode == FM_PURGE_TRASH_CC)
+                {
+                    FM_ATOMIC_STORE(&FM_GlobalData.TrashPurgeBusy, 0);
+                }
+
+                FlushCount++;
+            }
+        }
     }
 
-    /* Prevent parent/child updating queue counter at same time */
-    OS_MutSemTake(FM_GlobalData.ChildQueueCountSem);
-    FM_GlobalData.ChildQueueCount++;
-    OS_MutSemGive(FM_GlobalData.ChildQueueCountSem);
+    OS_MutSemGive(FM_GlobalData.ChildDequeueSem);
+
+    return FlushCount;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM utility function -- invoke child task command processor      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_InvokeChildTask(void)
+{
+    FM_ChildQueueEntry_t *CmdArgs    = &FM_GlobalData.ChildStagingEntry;
+    FM_ChildLane_t *      Lane       = &FM_GlobalData.ChildLane[FM_GetChildLane(CmdArgs)];
+    uint32                WriteIndex = Lane->WriteIndex;
+    FM_ChildQueueSlot_t * Slot       = &Lane->Queue[WriteIndex % FM_CHILD_QUEUE_DEPTH];
+
+    /*
+    ** The parent task is the only writer of the lane write index and
+    **  FM_VerifyChildTask has already checked there is room, so the slot
+    **  is free.  Names go to the path block pool, sized to their length.
+    **  Publishing the new write index hands the slot over.
+    */
+    Slot->CommandCode     = CmdArgs->CommandCode;
+    Slot->GetSizeTimeMode = CmdArgs->GetSizeTimeMode;
+    Slot->Flushed         = false;
+    Slot->ChildVerify     = (FM_GlobalData.ChildVerifyMode == FM_VERIFY_MODE_CHILD);
+    Slot->Overwrite       = CmdArgs->Overwrite;
+    Slot->FilterAction    = CmdArgs->FilterAction;
+    Slot->RetentionIndex  = CmdArgs->RetentionIndex;
+    Slot->Source1         = FM_StoreChildPath(CmdArgs->Source1);
+    Slot->Source2         = FM_StoreChildPath(CmdArgs->Source2);
+    Slot->Target          = FM_StoreChildPath(CmdArgs->Target);
+    Slot->SourceList      = FM_StoreChildPath(CmdArgs->SourceList);
+    Slot->DirListOffset   = CmdArgs->DirListOffset;
+    Slot->FileInfoState   = CmdArgs->FileInfoState;
+    Slot->FileInfoSize    = CmdArgs->FileInfoSize;
+    Slot->FileInfoTime    = CmdArgs->FileInfoTime;
+    Slot->FileInfoCRC     = CmdArgs->FileInfoCRC;
+    Slot->Mode            = CmdArgs->Mode;
+    Slot->Filter          = CmdArgs->Filter;
+
+    OS_GetLocalTime(&Lane->EnqueueTime[WriteIndex % FM_CHILD_QUEUE_DEPTH]);
+
+    FM_ATOMIC_STORE(&Lane->WriteIndex, FM_ChildLaneNextIndex(WriteIndex));
+
+    FM_GlobalData.ChildEnqueueCount++;
 
     /* Does the child task still have a semaphore? */
     if (OS_ObjectIdDefined(FM_GlobalData.ChildSemaphore))
@@ -493,6 +943,238 @@ void FM_InvokeChildTask(void)
     }
 }
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM utility function -- queue a retention pass                   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_StartRetention(uint32 TableEntryIndex, bool Commanded)
+{
+    FM_ChildQueueEntry_t *CmdArgs = &FM_GlobalData.ChildStagingEntry;
+    FM_RetentionState_t * State   = &FM_GlobalData.Retention[TableEntryIndex];
+    bool                  Result  = false;
+
+    Result = FM_VerifyChildTask(FM_ENFORCE_RETENTION_CHILD_BASE_EID, "Enforce Retention");
+
+    if (Result == true)
+    {
+        /*
+        ** The pass works from a copy of the table entry, so a table load
+        **  cannot change it midway.  Publishing the queue slot hands the
+        **  state over to the child task that takes the pass.
+        */
+        State->Policy    = FM_GlobalData.RetentionTablePtr->Entries[TableEntryIndex];
+        State->Commanded = Commanded;
+        State->Busy      = 1;
+
+        CmdArgs->CommandCode    = FM_ENFORCE_RETENTION_CC;
+        CmdArgs->RetentionIndex = (uint8)TableEntryIndex;
+        strncpy(CmdArgs->Source1, State->Policy.Directory, OS_MAX_PATH_LEN - 1);
+        CmdArgs->Source1[OS_MAX_PATH_LEN - 1] = '\0';
+
+        /* Invoke lower priority child task */
+        FM_InvokeChildTask();
+    }
+
+    return Result;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM utility function -- queue a trash purge pass                 */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_StartPurge(bool Commanded)
+{
+    FM_ChildQueueEntry_t *CmdArgs = &FM_GlobalData.ChildStagingEntry;
+    bool                  Result  = false;
+
+    Result = FM_VerifyChildTask(FM_PURGE_TRASH_CHILD_BASE_EID, "Purge Trash");
+
+    if (Result == true)
+    {
+        /* Publishing the queue slot hands the pass over to a child task */
+        FM_GlobalData.TrashPurgeCommanded = Commanded;
+        FM_GlobalData.TrashPurgeBusy      = 1;
+
+        CmdArgs->CommandCode = FM_PURGE_TRASH_CC;
+
+        /* Invoke lower priority child task */
+        FM_InvokeChildTask();
+    }
+
+    return Result;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM utility function -- test whether two names overlap           */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_PathsOverlap(const char *Path1, const char *Path2)
+{
+    bool   Overlap = false;
+    size_t Length1 = strlen(Path1);
+    size_t Length2 = strlen(Path2);
+
+    /* Empty names are unused command arguments */
+    if ((Length1 != 0) && (Length2 != 0))
+    {
+        /* A trailing separator does not make a different name */
+        while ((Length1 > 0) && (Path1[Length1 - 1] == '/'))
+        {
+            Length1--;
+        }
+
+        while ((Length2 > 0) && (Path2[Length2 - 1] == '/'))
+        {
+            Length2--;
+        }
+
+        /* Same name, or one name is a directory holding the other */
+        if (Length1 == Length2)
+        {
+            Overlap = (strncmp(Path1, Path2, Length1) == 0);
+        }
+        else if (Length1 < Length2)
+        {
+            Overlap = (strncmp(Path1, Path2, Length1) == 0) && (Path2[Length1] == '/');
+        }
+        else
+        {
+            Overlap = (strncmp(Path1, Path2, Length2) == 0) && (Path1[Length2] == '/');
+        }
+    }
+
+    return Overlap;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM utility function -- collect the names of a command           */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_GetEntryPaths(const FM_ChildQueueEntry_t *CmdArgs, FM_ChildPathSet_t *Paths)
+{
+    strncpy(Paths->Path[0], CmdArgs->Source1, OS_MAX_PATH_LEN - 1);
+    strncpy(Paths->Path[1], CmdArgs->Source2, OS_MAX_PATH_LEN - 1);
+    strncpy(Paths->Path[2], CmdArgs->Target, OS_MAX_PATH_LEN - 1);
+
+    Paths->Path[0][OS_MAX_PATH_LEN - 1] = '\0';
+    Paths->Path[1][OS_MAX_PATH_LEN - 1] = '\0';
+    Paths->Path[2][OS_MAX_PATH_LEN - 1] = '\0';
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM utility function -- test whether two commands share a name   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_PathSetsOverlap(const FM_ChildPathSet_t *Paths1, const FM_ChildPathSet_t *Paths2)
+{
+    bool   Overlap = false;
+    uint32 i;
+    uint32 j;
+
+    for (i = 0; (i < FM_CHILD_CMD_PATHS) && (Overlap == false); i++)
+    {
+        for (j = 0; (j < FM_CHILD_CMD_PATHS) && (Overlap == false); j++)
+        {
+            Overlap = FM_PathsOverlap(Paths1->Path[i], Paths2->Path[j]);
+        }
+    }
+
+    return Overlap;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM utility function -- read a queued name without releasing it  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_PeekChildPath(uint16 PathRef, char *Path, uint32 BufferSize)
+{
+    const FM_ChildPathBlock_t *Block;
+    uint32                     Offset = 0;
+    uint32                     ChunkSize;
+
+    while ((PathRef != 0) && (PathRef <= FM_CHILD_PATH_BLOCK_COUNT) && (Offset < BufferSize))
+    {
+        Block = &FM_GlobalData.ChildPathBlock[PathRef - 1];
+
+        ChunkSize = BufferSize - Offset;
+        if (ChunkSize > FM_CHILD_PATH_BLOCK_SIZE)
+        {
+            ChunkSize = FM_CHILD_PATH_BLOCK_SIZE;
+        }
+
+        memcpy(&Path[Offset], Block->Data, ChunkSize);
+        Offset += ChunkSize;
+        PathRef = Block->Next;
+    }
+
+    if (BufferSize > 0)
+    {
+        /* Terminate the name, which is empty for a zero reference */
+        if (Offset < BufferSize)
+        {
+            Path[Offset] = '\0';
+        }
+
+        Path[BufferSize - 1] = '\0';
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM utility function -- collect the names of a queued command    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_GetSlotPaths(const FM_ChildQueueSlot_t *Slot, FM_ChildPathSet_t *Paths)
+{
+    FM_PeekChildPath(Slot->Source1, Paths->Path[0], sizeof(Paths->Path[0]));
+    FM_PeekChildPath(Slot->Source2, Paths->Path[1], sizeof(Paths->Path[1]));
+    FM_PeekChildPath(Slot->Target, Paths->Path[2], sizeof(Paths->Path[2]));
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM utility function -- test a lane for a command on the names   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_ChildLaneOverlaps(const FM_ChildLane_t *Lane, const FM_ChildPathSet_t *Paths)
+{
+    const FM_ChildQueueSlot_t *Slot;
+    FM_ChildPathSet_t          SlotPaths;
+    bool                       Overlap   = false;
+    uint32                     WaitCount = FM_ChildLaneCount(Lane);
+    uint32                     ReadIndex = Lane->ReadIndex;
+    uint32                     i;
+
+    for (i = 0; (i < WaitCount) && (i < FM_CHILD_QUEUE_DEPTH) && (Overlap == false); i++)
+    {
+        Slot      = &Lane->Queue[ReadIndex % FM_CHILD_QUEUE_DEPTH];
+        ReadIndex = FM_ChildLaneNextIndex(ReadIndex);
+
+        /* Flushed slots have already given their names back */
+        if (Slot->Flushed == false)
+        {
+            FM_GetSlotPaths(Slot, &SlotPaths);
+            Overlap = FM_PathSetsOverlap(&SlotPaths, Paths);
+        }
+    }
+
+    return Overlap;
+}
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* FM utility function -- add path separator to directory name     */
@@ -525,6 +1207,64 @@ void FM_AppendPathSep(char *Directory, uint32 BufferSize)
     }
 }
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM utility function -- match a name against a wildcard pattern  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_MatchPattern(const char *Pattern, const char *Name)
+{
+    const char *StarPattern = NULL;
+    const char *StarName    = NULL;
+    bool        Matched     = true;
+
+    /* An empty pattern matches every name */
+    if (*Pattern != '\0')
+    {
+        /*
+        ** Only the most recent '*' is ever revisited, so the match needs no
+        **  recursion and takes at most (pattern length * name length) steps.
+        */
+        while ((*Name != '\0') && (Matched == true))
+        {
+            if (*Pattern == '*')
+            {
+                /* Let the star match nothing for now, remember where to widen it */
+                StarPattern = Pattern;
+                StarName    = Name;
+                Pattern++;
+            }
+            else if ((*Pattern == '?') || ((*Pattern != '\0') && (*Pattern == *Name)))
+            {
+                Pattern++;
+                Name++;
+            }
+            else if (StarPattern != NULL)
+            {
+                /* Let the last star match one more character */
+                StarName++;
+                Pattern = StarPattern + 1;
+                Name    = StarName;
+            }
+            else
+            {
+                Matched = false;
+            }
+        }
+
+        /* Only stars may be left over once the name is used up */
+        while ((Matched == true) && (*Pattern == '*'))
+        {
+            Pattern++;
+        }
+
+        Matched = (Matched && (*Pattern == '\0'));
+    }
+
+    return Matched;
+}
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* FM utility function -- Facilitates monitoring free volume space */
@@ -635,3 +1375,42 @@ CFE_Status_t FM_GetDirectorySpaceEstimate(const char *Directory, uint64 *BlockCo
 
     return Result;
 }
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM utility function -- latency histogram bucket for a time      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+uint32 FM_LatencyBucket(int64 Microseconds)
+{
+    uint32 Bucket = 0;
+
+    /* Each bucket is four times as wide as the one before */
+    while ((Microseconds >= 4) && (Bucket < (FM_LATENCY_BUCKET_COUNT - 1)))
+    {
+        Microseconds >>= 2;
+        Bucket++;
+    }
+
+    return Bucket;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM utility function -- count a time in a latency histogram      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_RecordLatency(FM_LatencyHistogram_t *Histograms, CFE_MSG_FcnCode_t CommandCode, OS_time_t StartTime,
+                      OS_time_t EndTime)
+{
+    uint32 Bucket = 0;
+
+    if (CommandCode < FM_LATENCY_CC_COUNT)
+    {
+        Bucket = FM_LatencyBucket(OS_TimeGetTotalMicroseconds(OS_TimeSubtract(EndTime, StartTime)));
+
+        FM_ATOMIC_ADD(&Histograms[CommandCode].Bucket[Bucket], 1);
+    }
+}
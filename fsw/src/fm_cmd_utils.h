@@ -27,6 +27,7 @@
 
 #include "cfe.h"
 #include "fm_msg.h"
+#include "fm_app.h"
 
 /************************************************************************
  * Type Definitions
@@ -89,6 +90,64 @@ bool FM_VerifyOverwrite(uint16 Overwrite, uint32 EventID, const char *CmdText);
  */
 uint32 FM_GetOpenFilesData(FM_OpenFilesEntry_t *OpenFilesData);
 
+/**
+ *  \brief Build Open Path Set Function
+ *
+ *  \par Description
+ *       This function makes one pass over the OSAL object table and
+ *       stores the name of each open stream in a hash set, then adds the
+ *       names of the files held open by kernel copies.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Any earlier contents of the set are replaced.  A name that could
+ *       not be stored marks the set as overflowed.  The queue dequeue mutex
+ *       is held while the kernel copy names are read.
+ *
+ *  \param [out] OpenPaths Pointer to the set to fill
+ *
+ *  \sa #FM_IsPathOpen
+ */
+void FM_BuildOpenPathSet(FM_OpenPathSet_t *OpenPaths);
+
+/**
+ *  \brief Is Path Open Function
+ *
+ *  \par Description
+ *       This function looks a name up in an open path set, first taking
+ *       the snapshot if the set is not valid.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       An overflowed set reports every name as open.
+ *
+ *  \param [in, out] OpenPaths Pointer to the open path set
+ *  \param [in]      Path      Name to look up
+ *
+ *  \return Boolean name open response
+ *  \retval true  Name was open when the snapshot was taken
+ *  \retval false Name was not open when the snapshot was taken
+ *
+ *  \sa #FM_BuildOpenPathSet
+ */
+bool FM_IsPathOpen(FM_OpenPathSet_t *OpenPaths, const char *Path);
+
+/**
+ *  \brief Is Valid Name String Function
+ *
+ *  \par Description
+ *       This function checks that a name is not empty and has a string
+ *       terminator within its buffer.  The file system is not queried.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *
+ *  \param [in]  Name       Pointer to buffer containing name
+ *  \param [in]  BufferSize Size of name character buffer
+ *
+ *  \return Boolean name valid response
+ *  \retval true  Name is valid
+ *  \retval false Name is NULL, empty or not terminated
+ */
+bool FM_IsValidNameString(const char *Name, size_t BufferSize);
+
 /**
  *  \brief Get Filename State Function
  *
@@ -104,6 +163,7 @@ uint32 FM_GetOpenFilesData(FM_OpenFilesEntry_t *OpenFilesData);
  *  \param [in]  Filename    Pointer to buffer containing filename
  *  \param [in]  BufferSize  Size of filename character buffer
  *  \param [in]  FileInfoCmd Is this for the Get File Info command?
+ *  \param [in]  OpenPaths   Open path set of the calling task
  *
  *  \return File state
  *  \retval #FM_NAME_IS_INVALID     \copydoc FM_NAME_IS_INVALID
@@ -112,9 +172,9 @@ uint32 FM_GetOpenFilesData(FM_OpenFilesEntry_t *OpenFilesData);
  *  \retval #FM_NAME_IS_FILE_CLOSED \copydoc FM_NAME_IS_FILE_CLOSED
  *  \retval #FM_NAME_IS_DIRECTORY   \copydoc FM_NAME_IS_DIRECTORY
  *
- *  \sa #OS_stat, #OS_FDGetInfo
+ *  \sa #OS_stat, #FM_IsPathOpen
  */
-uint32 FM_GetFilenameState(const char *Filename, size_t BufferSize, bool FileInfoCmd);
+uint32 FM_GetFilenameState(const char *Filename, size_t BufferSize, bool FileInfoCmd, FM_OpenPathSet_t *OpenPaths);
 
 /**
  *  \brief Verify Name Function
@@ -124,6 +184,9 @@ uint32 FM_GetFilenameState(const char *Filename, size_t BufferSize, bool FileInf
  *       an error event if the state is invalid.
  *
  *  \par Assumptions, External Events, and Notes:
+ *       In #FM_VERIFY_MODE_CHILD the file system is not queried, a valid
+ *       name is reported as #FM_NAME_IS_NOT_IN_USE and the child task
+ *       finds the real state when the command executes.
  *
  *  \param [in]  Name       Pointer to buffer containing name
  *  \param [in]  BufferSize Size of name character buffer
@@ -155,6 +218,7 @@ uint32 FM_VerifyNameValid(const char *Name, size_t BufferSize, uint32 EventID, c
  *  \param [in]  BufferSize Size of filename character buffer
  *  \param [in]  EventID    Error event ID (command-specific)
  *  \param [in]  CmdText    Error event text (command-specific)
+ *  \param [in]  OpenPaths  Open path set of the calling task
  *
  *  \return Boolean file state response
  *  \retval true  File is in the given state
@@ -163,7 +227,35 @@ uint32 FM_VerifyNameValid(const char *Name, size_t BufferSize, uint32 EventID, c
  *  \sa #FM_GetFilenameState
  */
 bool FM_VerifyFileState(FM_File_States State, const char *Filename, size_t BufferSize, uint32 EventID,
-                        const char *CmdText);
+                        const char *CmdText, FM_OpenPathSet_t *OpenPaths);
+
+/**
+ *  \brief Verify File State Now or Later Function
+ *
+ *  \par Description
+ *       In #FM_VERIFY_MODE_MAIN this function calls the Verify File State
+ *       function.  In #FM_VERIFY_MODE_CHILD it only checks the name and
+ *       leaves the state to the child task, which makes the same check
+ *       when the command executes.  An invalid name generates the same
+ *       error event in both modes.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called by the main task command handlers only.
+ *
+ *  \param [in]  State      State of file to verify
+ *  \param [in]  Filename   Pointer to buffer containing filename
+ *  \param [in]  BufferSize Size of filename character buffer
+ *  \param [in]  EventID    Error event ID (command-specific)
+ *  \param [in]  CmdText    Error event text (command-specific)
+ *
+ *  \return Boolean file state response
+ *  \retval true  File is in the given state or the check is left to the child task
+ *  \retval false File is not in the given state or the name is invalid
+ *
+ *  \sa #FM_VerifyFileState, #FM_SET_VERIFY_MODE_CC
+ */
+bool FM_VerifyFileStateOrDefer(FM_File_States State, const char *Filename, size_t BufferSize, uint32 EventID,
+                               const char *CmdText);
 
 /**
  *  \brief Verify File is Closed Function
@@ -173,6 +265,8 @@ bool FM_VerifyFileState(FM_File_States State, const char *Filename, size_t Buffe
  *       an error event if the state is anything other than a closed file.
  *
  *  \par Assumptions, External Events, and Notes:
+ *       In #FM_VERIFY_MODE_CHILD only the name is checked, see
+ *       #FM_VerifyFileStateOrDefer.
  *
  *  \param [in]  Filename   Pointer to buffer containing filename
  *  \param [in]  BufferSize Size of filename character buffer
@@ -196,6 +290,8 @@ bool FM_VerifyFileClosed(const char *Filename, size_t BufferSize, uint32 EventID
  *       a closed file.
  *
  *  \par Assumptions, External Events, and Notes:
+ *       In #FM_VERIFY_MODE_CHILD only the name is checked, see
+ *       #FM_VerifyFileStateOrDefer.
  *
  *  \param [in]  Filename   Pointer to buffer containing filename
  *  \param [in]  BufferSize Size of filename character buffer
@@ -219,6 +315,8 @@ bool FM_VerifyFileExists(const char *Filename, size_t BufferSize, uint32 EventID
  *       unused the name is not a file and is not a directory.
  *
  *  \par Assumptions, External Events, and Notes:
+ *       In #FM_VERIFY_MODE_CHILD only the name is checked, see
+ *       #FM_VerifyFileStateOrDefer.
  *
  *  \param [in]  Filename   Pointer to buffer containing name
  *  \param [in]  BufferSize Size of name character buffer
@@ -241,6 +339,8 @@ bool FM_VerifyFileNoExist(const char *Filename, size_t BufferSize, uint32 EventI
  *       an error event if the state is a directory or an open file.
  *
  *  \par Assumptions, External Events, and Notes:
+ *       In #FM_VERIFY_MODE_CHILD only the name is checked, see
+ *       #FM_VerifyFileStateOrDefer.
  *
  *  \param [in]  Filename   Pointer to buffer containing name
  *  \param [in]  BufferSize Size of name character buffer
@@ -263,6 +363,8 @@ bool FM_VerifyFileNotOpen(const char *Filename, size_t BufferSize, uint32 EventI
  *       an error event if the state is not an existing directory.
  *
  *  \par Assumptions, External Events, and Notes:
+ *       In #FM_VERIFY_MODE_CHILD only the name is checked, see
+ *       #FM_VerifyFileStateOrDefer.
  *
  *  \param [in]  Directory  Pointer to buffer containing directory name
  *  \param [in]  BufferSize Size of directory name character buffer
@@ -285,6 +387,8 @@ bool FM_VerifyDirExists(const char *Directory, size_t BufferSize, uint32 EventID
  *       an error event if the state is an existing file or directory.
  *
  *  \par Assumptions, External Events, and Notes:
+ *       In #FM_VERIFY_MODE_CHILD only the name is checked, see
+ *       #FM_VerifyFileStateOrDefer.
  *
  *  \param [in]  Name       Pointer to buffer containing directory name
  *  \param [in]  BufferSize Size of directory name character buffer
@@ -304,7 +408,10 @@ bool FM_VerifyDirNoExist(const char *Name, size_t BufferSize, uint32 EventID, co
  *
  *  \par Description
  *       This function verifies that the child task interface queue is
- *       not full and that the queue index values are within bounds.
+ *       not full, that the queue index values are within bounds and that
+ *       the path block pool has room for the names of a command.  On
+ *       success the staging entry is cleared, ready for the caller to
+ *       load the arguments for the current command.
  *
  *  \par Assumptions, External Events, and Notes:
  *
@@ -317,14 +424,114 @@ bool FM_VerifyDirNoExist(const char *Name, size_t BufferSize, uint32 EventID, co
  */
 bool FM_VerifyChildTask(uint32 EventID, const char *CmdText);
 
+/**
+ *  \brief Get Child Queue Lane Function
+ *
+ *  \par Description
+ *       This function selects the child task queue lane for a command.
+ *       Short metadata commands (rename, delete, create and delete
+ *       directory, set permissions, and file info without a CRC) use the
+ *       fast lane.  Everything else (copy, move, concat, decompress, file
+ *       info with a CRC, delete all and directory listings) uses the bulk
+ *       lane.  A fast lane command whose names overlap those of a command
+ *       waiting in the bulk lane (see #FM_ChildLaneOverlaps) uses the bulk
+ *       lane too, so commands working on the same names run in the order
+ *       they were sent.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Must only be called from the parent task.  The queue dequeue mutex
+ *       is held while the bulk lane is searched.
+ *
+ *  \param [in]  CmdArgs Pointer to command arguments
+ *
+ *  \return Child task queue lane
+ *  \retval #FM_CHILD_LANE_FAST Command runs in the fast lane
+ *  \retval #FM_CHILD_LANE_BULK Command runs in the bulk lane
+ */
+uint8 FM_GetChildLane(const FM_ChildQueueEntry_t *CmdArgs);
+
+/**
+ *  \brief Count Free Child Queue Path Blocks Function
+ *
+ *  \par Description
+ *       This function counts the unused blocks in the pool holding the
+ *       file and directory names of queued commands.  Counting stops once
+ *       the limit is reached.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Child tasks may release blocks while the count is taken, so the
+ *       actual number of free blocks can only be larger.
+ *
+ *  \param [in]  Limit Stop counting once this many free blocks are found
+ *
+ *  \return Number of free path blocks (no more than Limit)
+ */
+uint32 FM_GetChildPathBlocksFree(uint32 Limit);
+
+/**
+ *  \brief Store Child Queue Path Name Function
+ *
+ *  \par Description
+ *       This function copies a file or directory name into as many blocks
+ *       of the path block pool as its length requires, chaining the blocks
+ *       together.  The child task copies the name back out and releases the
+ *       blocks with #FM_ChildLoadPath.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Must only be called from the parent task after #FM_VerifyChildTask
+ *       has confirmed that the pool has room for the command.
+ *
+ *  \param [in]  Path Pointer to the name (string terminated)
+ *
+ *  \return Reference to the stored name
+ *  \retval 0 The name is empty and was not stored
+ *  \retval >0 First path block of the name plus one
+ */
+uint16 FM_StoreChildPath(const char *Path);
+
+/**
+ *  \brief Release Child Queue Path Name Function
+ *
+ *  \par Description
+ *       This function hands every block of a stored name back to the path
+ *       block pool without copying the name out.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Must only be called from the parent task for a name that no child
+ *       task will load, see #FM_FlushChildQueue.
+ *
+ *  \param [in]  PathRef Reference returned by #FM_StoreChildPath
+ */
+void FM_ReleaseChildPath(uint16 PathRef);
+
+/**
+ *  \brief Flush Child Queue Function
+ *
+ *  \par Description
+ *       This function drops every command waiting in both queue lanes.  Each
+ *       waiting slot is marked as flushed and its names are released at once,
+ *       the lane indices and the handshake semaphore are left alone so that
+ *       the child tasks take the flushed slots off the queue as usual and
+ *       skip them without executing.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Must only be called from the parent task.  The queue dequeue mutex is
+ *       held while the slots are marked so no child task can be copying one
+ *       of them out at the same time.
+ *
+ *  \return Number of commands dropped
+ */
+uint32 FM_FlushChildQueue(void);
+
 /**
  *  \brief Invoke Child Task Function
  *
  *  \par Description
- *       This function is called after the caller has loaded the next
- *       available entry in the child task queue with the arguments for
- *       the current command.  The function updates the queue access
- *       index and then verifies that the Child Task is operational.
+ *       This function is called after the caller has loaded the staging
+ *       entry with the arguments for the current command.  The function
+ *       copies the entry into the next available slot of its queue lane
+ *       (see #FM_GetChildLane), publishes the new lane write index without
+ *       taking a lock and then verifies that the Child Task is operational.
  *       If the Child Task is operational then it is signaled via
  *       handshake semaphore to process the next command from the queue.
  *       If instead, the Child Task is not operational, the Child Task
@@ -333,11 +540,170 @@ bool FM_VerifyChildTask(uint32 EventID, const char *CmdText);
  *       which execution thread is active when the command is processed.
  *
  *  \par Assumptions, External Events, and Notes:
+ *       Must only be called from the parent task, which is the single
+ *       writer for every queue lane.
  *
  *  \sa #OS_CountSemGive, #FM_ChildProcess
  */
 void FM_InvokeChildTask(void);
 
+/**
+ *  \brief Start Retention Pass Function
+ *
+ *  \par Description
+ *       This function queues a retention pass over the directory of one
+ *       retention table entry.  The table entry is copied into the entry
+ *       state, which is marked busy until the child task ends the pass or
+ *       the pass is flushed from the queue.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Must only be called from the parent task, with the retention table
+ *       loaded and no pass of the entry pending.  The child task queue is
+ *       checked here and an error event is sent when it cannot be used.
+ *
+ *  \param [in]  TableEntryIndex Retention table entry index
+ *  \param [in]  Commanded       Set when the pass was requested by ground command
+ *
+ *  \return Boolean pass queued response
+ *  \retval true  Pass queued
+ *  \retval false Child task queue cannot be used
+ *
+ *  \sa #FM_RetentionSchedule, #FM_EnforceRetentionCmd, #FM_ChildRetentionCmd
+ */
+bool FM_StartRetention(uint32 TableEntryIndex, bool Commanded);
+
+/**
+ *  \brief Start Trash Purge Pass Function
+ *
+ *  \par Description
+ *       This function queues a pass that removes the files in the trash
+ *       directories.  The purge is marked busy until the child task ends
+ *       the pass or the pass is flushed from the queue.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Must only be called from the parent task with no purge pass
+ *       pending.  The child task queue is checked here and an error event
+ *       is sent when it cannot be used.
+ *
+ *  \param [in]  Commanded Set when the pass was requested by ground command
+ *
+ *  \return Boolean pass queued response
+ *  \retval true  Pass queued
+ *  \retval false Child task queue cannot be used
+ *
+ *  \sa #FM_TrashSchedule, #FM_PurgeTrashCmd, #FM_ChildPurgeCmd
+ */
+bool FM_StartPurge(bool Commanded);
+
+/**
+ *  \brief Paths Overlap Function
+ *
+ *  \par Description
+ *       This function tests whether two names refer to the same file or
+ *       directory, or whether one of them names a directory that holds the
+ *       other.  Trailing path separators are ignored and an empty name
+ *       never overlaps another name.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Names are compared as given, "/cf/a" and "/cf/./a" do not overlap.
+ *
+ *  \param [in]  Path1 Pointer to the first name (string terminated)
+ *  \param [in]  Path2 Pointer to the second name (string terminated)
+ *
+ *  \return Boolean overlap response
+ *  \retval true  The names overlap
+ *  \retval false The names do not overlap
+ */
+bool FM_PathsOverlap(const char *Path1, const char *Path2);
+
+/**
+ *  \brief Get Command Paths Function
+ *
+ *  \par Description
+ *       This function copies the first source, second source and target
+ *       names of a child task command into a path set.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The names of a concat list source list are not included.
+ *
+ *  \param [in]  CmdArgs Pointer to command arguments
+ *  \param [out] Paths   Pointer to the path set to load
+ */
+void FM_GetEntryPaths(const FM_ChildQueueEntry_t *CmdArgs, FM_ChildPathSet_t *Paths);
+
+/**
+ *  \brief Path Sets Overlap Function
+ *
+ *  \par Description
+ *       This function tests whether any name of one path set overlaps any
+ *       name of the other, see #FM_PathsOverlap.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *
+ *  \param [in]  Paths1 Pointer to the first path set
+ *  \param [in]  Paths2 Pointer to the second path set
+ *
+ *  \return Boolean overlap response
+ *  \retval true  The commands share a name
+ *  \retval false The commands do not share a name
+ */
+bool FM_PathSetsOverlap(const FM_ChildPathSet_t *Paths1, const FM_ChildPathSet_t *Paths2);
+
+/**
+ *  \brief Peek Child Queue Path Name Function
+ *
+ *  \par Description
+ *       This function copies a name stored in the path block pool by
+ *       #FM_StoreChildPath into the caller's buffer.  Unlike
+ *       #FM_ChildLoadPath the blocks stay in use.  A zero reference
+ *       produces an empty string and a name that does not fit is
+ *       truncated.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The caller must hold the queue dequeue mutex so that no child task
+ *       releases the blocks while they are read.
+ *
+ *  \param [in]  PathRef    Reference returned by #FM_StoreChildPath
+ *  \param [out] Path       Buffer that receives the name
+ *  \param [in]  BufferSize Size of the buffer, in bytes
+ */
+void FM_PeekChildPath(uint16 PathRef, char *Path, uint32 BufferSize);
+
+/**
+ *  \brief Get Queued Command Paths Function
+ *
+ *  \par Description
+ *       This function copies the first source, second source and target
+ *       names of a queued command into a path set, see #FM_PeekChildPath.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The caller must hold the queue dequeue mutex.
+ *
+ *  \param [in]  Slot  Pointer to the queue slot
+ *  \param [out] Paths Pointer to the path set to load
+ */
+void FM_GetSlotPaths(const FM_ChildQueueSlot_t *Slot, FM_ChildPathSet_t *Paths);
+
+/**
+ *  \brief Child Queue Lane Overlaps Function
+ *
+ *  \par Description
+ *       This function tests whether any command waiting in a queue lane
+ *       works on a name that overlaps a name of the path set, see
+ *       #FM_PathSetsOverlap.  Flushed slots are skipped.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The caller must hold the queue dequeue mutex.
+ *
+ *  \param [in]  Lane  Pointer to the queue lane
+ *  \param [in]  Paths Pointer to the path set
+ *
+ *  \return Boolean overlap response
+ *  \retval true  A waiting command shares a name with the path set
+ *  \retval false No waiting command shares a name with the path set
+ */
+bool FM_ChildLaneOverlaps(const FM_ChildLane_t *Lane, const FM_ChildPathSet_t *Paths);
+
 /**
  *  \brief Append Path Separator Function
  *
@@ -357,6 +723,27 @@ void FM_InvokeChildTask(void);
  */
 void FM_AppendPathSep(char *Directory, uint32 BufferSize);
 
+/**
+ *  \brief Match Pattern Function
+ *
+ *  \par Description
+ *       This function tests a directory entry name against a pattern in
+ *       which '*' matches any run of characters, including none, and '?'
+ *       matches any one character.  Every other character must match
+ *       itself.  An empty pattern matches every name.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The match is iterative, it does not use the stack for each '*'.
+ *
+ *  \param [in]  Pattern  Pointer to the pattern string
+ *  \param [in]  Name     Pointer to the name string
+ *
+ *  \return Boolean match response
+ *  \retval true  Name matches the pattern
+ *  \retval false Name does not match the pattern
+ */
+bool FM_MatchPattern(const char *Pattern, const char *Name);
+
 /**
  *  \brief Gets the free space on the volume
  *
@@ -400,4 +787,41 @@ CFE_Status_t FM_GetVolumeFreeSpace(const char *FileSys, uint64 *BlockCount, uint
  */
 CFE_Status_t FM_GetDirectorySpaceEstimate(const char *Directory, uint64 *BlockCount, uint64 *ByteCount);
 
+/**
+ *  \brief Latency Histogram Bucket Function
+ *
+ *  \par Description
+ *       This function returns the latency histogram bucket that counts a
+ *       time.  Bucket 0 counts times under 4 microseconds and each bucket
+ *       after it is four times wider than the one before.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Negative times, from a clock set back, are counted in bucket 0.
+ *
+ *  \param [in]  Microseconds Time to count
+ *
+ *  \return Bucket index, less than #FM_LATENCY_BUCKET_COUNT
+ */
+uint32 FM_LatencyBucket(int64 Microseconds);
+
+/**
+ *  \brief Record Command Latency Function
+ *
+ *  \par Description
+ *       This function counts the time between two clock readings in the
+ *       latency histogram of a command code.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       May be called from the parent task and from every child task, the
+ *       bucket is incremented with #FM_ATOMIC_ADD.  Command codes not less
+ *       than #FM_LATENCY_CC_COUNT are not recorded.
+ *
+ *  \param [in,out] Histograms  Histograms indexed by command code
+ *  \param [in]     CommandCode Command code of the timed command
+ *  \param [in]     StartTime   Clock reading when the timed step started
+ *  \param [in]     EndTime     Clock reading when the timed step ended
+ */
+void FM_RecordLatency(FM_LatencyHistogram_t *Histograms, CFE_MSG_FcnCode_t CommandCode, OS_time_t StartTime,
+                      OS_time_t EndTime);
+
 #endif
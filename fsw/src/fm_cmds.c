@@ -72,13 +72,22 @@ bool FM_NoopCmd(const CFE_SB_Buffer_t *BufPtr)
 bool FM_ResetCountersCmd(const CFE_SB_Buffer_t *BufPtr)
 {
     const char *CmdText = "Reset Counters";
+    uint32      i;
 
     FM_GlobalData.CommandCounter    = 0;
     FM_GlobalData.CommandErrCounter = 0;
 
-    FM_GlobalData.ChildCmdCounter     = 0;
-    FM_GlobalData.ChildCmdErrCounter  = 0;
-    FM_GlobalData.ChildCmdWarnCounter = 0;
+    for (i = 0; i < FM_CHILD_TASK_COUNT; i++)
+    {
+        FM_GlobalData.ChildWorker[i].CmdCounter     = 0;
+        FM_GlobalData.ChildWorker[i].CmdErrCounter  = 0;
+        FM_GlobalData.ChildWorker[i].CmdWarnCounter = 0;
+    }
+
+    FM_GlobalData.ChildEnqueueCount  = 0;
+    FM_GlobalData.ChildDequeueCount  = 0;
+    FM_GlobalData.ChildQueueWaitLast = 0;
+    FM_GlobalData.ChildQueueWaitMax  = 0;
 
     /* Send command completion event (debug) */
     CFE_EVS_SendEvent(FM_RESET_CMD_EID, CFE_EVS_EventType_DEBUG, "%s command", CmdText);
@@ -131,10 +140,11 @@ bool FM_CopyFileCmd(const CFE_SB_Buffer_t *BufPtr)
     /* Prepare command for child task execution */
     if (CommandResult == true)
     {
-        CmdArgs = &FM_GlobalData.ChildQueue[FM_GlobalData.ChildWriteIndex];
+        CmdArgs = &FM_GlobalData.ChildStagingEntry;
 
         /* Set handshake queue command args */
         CmdArgs->CommandCode = FM_COPY_FILE_CC;
+        CmdArgs->Overwrite   = (CmdPtr->Overwrite != 0);
         strncpy(CmdArgs->Source1, CmdPtr->Source, OS_MAX_PATH_LEN - 1);
         CmdArgs->Source1[OS_MAX_PATH_LEN - 1] = '\0';
 
@@ -193,10 +203,11 @@ bool FM_MoveFileCmd(const CFE_SB_Buffer_t *BufPtr)
     /* Prepare command for child task execution */
     if (CommandResult == true)
     {
-        CmdArgs = &FM_GlobalData.ChildQueue[FM_GlobalData.ChildWriteIndex];
+        CmdArgs = &FM_GlobalData.ChildStagingEntry;
 
         /* Set handshake queue command args */
         CmdArgs->CommandCode = FM_MOVE_FILE_CC;
+        CmdArgs->Overwrite   = (CmdPtr->Overwrite != 0);
 
         strncpy(CmdArgs->Source1, CmdPtr->Source, OS_MAX_PATH_LEN - 1);
         CmdArgs->Source1[OS_MAX_PATH_LEN - 1] = '\0';
@@ -243,7 +254,7 @@ bool FM_RenameFileCmd(const CFE_SB_Buffer_t *BufPtr)
     /* Prepare command for child task execution */
     if (CommandResult == true)
     {
-        CmdArgs = &FM_GlobalData.ChildQueue[FM_GlobalData.ChildWriteIndex];
+        CmdArgs = &FM_GlobalData.ChildStagingEntry;
 
         /* Set handshake queue command args */
         CmdArgs->CommandCode = FM_RENAME_FILE_CC;
@@ -287,7 +298,7 @@ bool FM_DeleteFileCmd(const CFE_SB_Buffer_t *BufPtr)
     /* Prepare command for child task execution */
     if (CommandResult == true)
     {
-        CmdArgs = &FM_GlobalData.ChildQueue[FM_GlobalData.ChildWriteIndex];
+        CmdArgs = &FM_GlobalData.ChildStagingEntry;
 
         /* Set handshake queue command args - might be global or internal CC */
         CFE_MSG_GetFcnCode(&BufPtr->Msg, &CmdArgs->CommandCode);
@@ -334,7 +345,7 @@ bool FM_DeleteAllFilesCmd(const CFE_SB_Buffer_t *BufPtr)
     /* Prepare command for child task execution */
     if (CommandResult == true)
     {
-        CmdArgs = &FM_GlobalData.ChildQueue[FM_GlobalData.ChildWriteIndex];
+        CmdArgs = &FM_GlobalData.ChildStagingEntry;
 
         /* Set handshake queue command args */
         CmdArgs->CommandCode = FM_DELETE_ALL_FILES_CC;
@@ -383,7 +394,7 @@ bool FM_DecompressFileCmd(const CFE_SB_Buffer_t *BufPtr)
     /* Prepare command for child task execution */
     if (CommandResult == true)
     {
-        CmdArgs = &FM_GlobalData.ChildQueue[FM_GlobalData.ChildWriteIndex];
+        CmdArgs = &FM_GlobalData.ChildStagingEntry;
 
         /* Set handshake queue command args */
         CmdArgs->CommandCode = FM_DECOMPRESS_FILE_CC;
@@ -437,7 +448,7 @@ bool FM_ConcatFilesCmd(const CFE_SB_Buffer_t *BufPtr)
     /* Prepare command for child task execution */
     if (CommandResult == true)
     {
-        CmdArgs = &FM_GlobalData.ChildQueue[FM_GlobalData.ChildWriteIndex];
+        CmdArgs = &FM_GlobalData.ChildStagingEntry;
 
         /* Set handshake queue command args */
         CmdArgs->CommandCode = FM_CONCAT_FILES_CC;
@@ -488,7 +499,7 @@ bool FM_GetFileInfoCmd(const CFE_SB_Buffer_t *BufPtr)
     /* Prepare command for child task execution */
     if (CommandResult == true)
     {
-        CmdArgs = &FM_GlobalData.ChildQueue[FM_GlobalData.ChildWriteIndex];
+        CmdArgs = &FM_GlobalData.ChildStagingEntry;
 
         /* Set handshake queue command args */
         CmdArgs->CommandCode = FM_GET_FILE_INFO_CC;
@@ -569,7 +580,7 @@ bool FM_CreateDirectoryCmd(const CFE_SB_Buffer_t *BufPtr)
     /* Prepare command for child task execution */
     if (CommandResult == true)
     {
-        CmdArgs = &FM_GlobalData.ChildQueue[FM_GlobalData.ChildWriteIndex];
+        CmdArgs = &FM_GlobalData.ChildStagingEntry;
 
         /* Set handshake queue command args */
         CmdArgs->CommandCode = FM_CREATE_DIRECTORY_CC;
@@ -610,7 +621,7 @@ bool FM_DeleteDirectoryCmd(const CFE_SB_Buffer_t *BufPtr)
     /* Prepare command for child task execution */
     if (CommandResult == true)
     {
-        CmdArgs = &FM_GlobalData.ChildQueue[FM_GlobalData.ChildWriteIndex];
+        CmdArgs = &FM_GlobalData.ChildStagingEntry;
 
         /* Set handshake queue command args */
         CmdArgs->CommandCode = FM_DELETE_DIRECTORY_CC;
@@ -671,7 +682,7 @@ bool FM_GetDirListFileCmd(const CFE_SB_Buffer_t *BufPtr)
     /* Prepare command for child task execution */
     if (CommandResult == true)
     {
-        CmdArgs = &FM_GlobalData.ChildQueue[FM_GlobalData.ChildWriteIndex];
+        CmdArgs = &FM_GlobalData.ChildStagingEntry;
 
         /* Append a path separator to the end of the directory name */
         strncpy(DirWithSep, CmdPtr->Directory, OS_MAX_PATH_LEN - 1);
@@ -725,7 +736,7 @@ bool FM_GetDirListPktCmd(const CFE_SB_Buffer_t *BufPtr)
     /* Prepare command for child task execution */
     if (CommandResult == true)
     {
-        CmdArgs = &FM_GlobalData.ChildQueue[FM_GlobalData.ChildWriteIndex];
+        CmdArgs = &FM_GlobalData.ChildStagingEntry;
 
         /* Append a path separator to the end of the directory name */
         strncpy(DirWithSep, CmdPtr->Directory, OS_MAX_PATH_LEN - 1);
@@ -932,7 +943,7 @@ bool FM_SetPermissionsCmd(const CFE_SB_Buffer_t *BufPtr)
     /* Prepare command for child task execution */
     if (CommandResult == true)
     {
-        CmdArgs = &FM_GlobalData.ChildQueue[FM_GlobalData.ChildWriteIndex];
+        CmdArgs = &FM_GlobalData.ChildStagingEntry;
         /* Set handshake queue command args */
         CmdArgs->CommandCode = FM_SET_PERMISSIONS_CC;
         strncpy(CmdArgs->Source1, CmdPtr->FileName, OS_MAX_PATH_LEN - 1);
@@ -945,3 +956,684 @@ bool FM_SetPermissionsCmd(const CFE_SB_Buffer_t *BufPtr)
 
     return CommandResult;
 }
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM command handler -- Set Copy Block Size                       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_SetCopyBlockSizeCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    const char *CmdText       = "Set Copy Block Size";
+    bool        CommandResult = true;
+
+    const FM_CopyBlockSize_Payload_t *CmdPtr = FM_GET_CMD_PAYLOAD(BufPtr, FM_SetCopyBlockSizeCmd_t);
+
+    if ((CmdPtr->BlockSize < FM_CHILD_FILE_BLOCK_SIZE) || (CmdPtr->BlockSize > FM_CHILD_COPY_BUFFER_SIZE))
+    {
+        /* Block size must fit in the child task copy buffer */
+        CommandResult = false;
+
+        CFE_EVS_SendEvent(FM_SET_COPY_BLOCK_ARG_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "%s error: invalid command argument: size = %lu, min = %d, max = %d", CmdText,
+                          (unsigned long)CmdPtr->BlockSize, FM_CHILD_FILE_BLOCK_SIZE, FM_CHILD_COPY_BUFFER_SIZE);
+    }
+    else
+    {
+        /* Copies started from now on use the new block size */
+        FM_GlobalData.ChildCopyBlockSize = CmdPtr->BlockSize;
+
+        /* Send command completion event (info) */
+        CFE_EVS_SendEvent(FM_SET_COPY_BLOCK_CMD_INF_EID, CFE_EVS_EventType_INFORMATION, "%s command: size = %lu",
+                          CmdText, (unsigned long)CmdPtr->BlockSize);
+    }
+
+    return CommandResult;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM command handler -- Concatenate List of Files                 */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_ConcatListCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    const char *          CmdText       = "Concat List";
+    FM_ChildQueueEntry_t *CmdArgs       = NULL;
+    bool                  CommandResult = true;
+    uint32                BlocksNeeded  = 0;
+    uint32                Offset        = 0;
+    uint32                Length        = 0;
+    uint32                i;
+
+    const FM_ConcatList_Payload_t *CmdPtr = FM_GET_CMD_PAYLOAD(BufPtr, FM_ConcatListCmd_t);
+
+    if (CmdPtr->ListFile[0] != '\0')
+    {
+        /* Verify that the list file exists, is not a directory and is not open */
+        CommandResult =
+            FM_VerifyFileClosed(CmdPtr->ListFile, sizeof(CmdPtr->ListFile), FM_CONCAT_LIST_LIST_BASE_EID, CmdText);
+    }
+    else if ((CmdPtr->SourceCount == 0) || (CmdPtr->SourceCount > FM_CONCAT_LIST_INLINE_MAX))
+    {
+        CommandResult = false;
+
+        CFE_EVS_SendEvent(FM_CONCAT_LIST_ARG_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "%s error: invalid source count: count = %d, max = %d", CmdText, (int)CmdPtr->SourceCount,
+                          FM_CONCAT_LIST_INLINE_MAX);
+    }
+    else
+    {
+        /* Verify that each inline source file exists, is not a directory and is not open */
+        for (i = 0; (i < CmdPtr->SourceCount) && (CommandResult == true); i++)
+        {
+            CommandResult = FM_VerifyFileClosed(CmdPtr->Source[i], sizeof(CmdPtr->Source[i]),
+                                                FM_CONCAT_LIST_SRC_BASE_EID, CmdText);
+        }
+    }
+
+    /* Verify that target file does not exist */
+    if (CommandResult == true)
+    {
+        CommandResult =
+            FM_VerifyFileNoExist(CmdPtr->Target, sizeof(CmdPtr->Target), FM_CONCAT_LIST_TGT_BASE_EID, CmdText);
+    }
+
+    /* Check for lower priority child task availability */
+    if (CommandResult == true)
+    {
+        CommandResult = FM_VerifyChildTask(FM_CONCAT_LIST_CHILD_BASE_EID, CmdText);
+    }
+
+    /* Prepare command for child task execution */
+    if (CommandResult == true)
+    {
+        CmdArgs = &FM_GlobalData.ChildStagingEntry;
+
+        /* Set handshake queue command args */
+        CmdArgs->CommandCode = FM_CONCAT_LIST_CC;
+        strncpy(CmdArgs->Source1, CmdPtr->ListFile, OS_MAX_PATH_LEN - 1);
+        CmdArgs->Source1[OS_MAX_PATH_LEN - 1] = '\0';
+        strncpy(CmdArgs->Target, CmdPtr->Target, OS_MAX_PATH_LEN - 1);
+        CmdArgs->Target[OS_MAX_PATH_LEN - 1] = '\0';
+
+        if (CmdPtr->ListFile[0] == '\0')
+        {
+            /* Join the inline source names into one newline separated list */
+            for (i = 0; i < CmdPtr->SourceCount; i++)
+            {
+                Length = strlen(CmdPtr->Source[i]);
+                memcpy(&CmdArgs->SourceList[Offset], CmdPtr->Source[i], Length);
+                Offset += Length;
+                CmdArgs->SourceList[Offset] = '\n';
+                Offset++;
+            }
+
+            CmdArgs->SourceList[Offset - 1] = '\0';
+
+            /* The list is stored in the path block pool next to the other names */
+            BlocksNeeded =
+                FM_CHILD_PATH_BLOCKS_PER_CMD + ((Offset + FM_CHILD_PATH_BLOCK_SIZE - 1) / FM_CHILD_PATH_BLOCK_SIZE);
+
+            if (FM_GetChildPathBlocksFree(BlocksNeeded) < BlocksNeeded)
+            {
+                CommandResult = false;
+
+                CFE_EVS_SendEvent(FM_CONCAT_LIST_CHILD_FULL_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "%s error: child task queue is full: no free path blocks", CmdText);
+            }
+        }
+
+        if (CommandResult == true)
+        {
+            /* Invoke lower priority child task */
+            FM_InvokeChildTask();
+        }
+    }
+
+    return CommandResult;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM command handler -- Set Throttle                              */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_SetThrottleCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    const char *        CmdText       = "Set Throttle";
+    bool                CommandResult = false;
+    bool                IsDefault     = false;
+    uint32              Index         = FM_CHILD_THROTTLE_ENTRIES;
+    uint32              FreeIndex     = FM_CHILD_THROTTLE_ENTRIES;
+    FM_ChildThrottle_t *Throttle      = NULL;
+    uint32              i;
+
+    const FM_Throttle_Payload_t *CmdPtr = FM_GET_CMD_PAYLOAD(BufPtr, FM_SetThrottleCmd_t);
+
+    IsDefault = (CmdPtr->Volume[0] == '\0');
+
+    if ((CmdPtr->Volume[sizeof(CmdPtr->Volume) - 1] != '\0') || ((IsDefault == false) && (CmdPtr->Volume[0] != '/')))
+    {
+        CFE_EVS_SendEvent(FM_SET_THROTTLE_ARG_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "%s error: invalid volume: must be empty or an absolute path", CmdText);
+    }
+    else if (IsDefault && ((CmdPtr->ByteRate == FM_THROTTLE_RATE_DEFAULT) ||
+                           (CmdPtr->StatRate == FM_THROTTLE_RATE_DEFAULT)))
+    {
+        CFE_EVS_SendEvent(FM_SET_THROTTLE_ARG_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "%s error: default rates cannot follow the default", CmdText);
+    }
+    else if ((CmdPtr->ByteRate != FM_THROTTLE_RATE_UNLIMITED) && (CmdPtr->ByteRate != FM_THROTTLE_RATE_DEFAULT) &&
+             (CmdPtr->ByteRate < FM_CHILD_FILE_BLOCK_SIZE))
+    {
+        CFE_EVS_SendEvent(FM_SET_THROTTLE_ARG_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "%s error: invalid command argument: byte rate = %lu, min = %d", CmdText,
+                          (unsigned long)CmdPtr->ByteRate, FM_CHILD_FILE_BLOCK_SIZE);
+    }
+    else
+    {
+        /* The child tasks refill and drain the buckets while holding the same semaphore */
+        OS_MutSemTake(FM_GlobalData.ChildThrottleSem);
+
+        if (IsDefault)
+        {
+            Index = FM_CHILD_THROTTLE_DEFAULT;
+        }
+        else
+        {
+            /* Update the entry of the volume, or take the first free entry */
+            for (i = FM_CHILD_THROTTLE_ENTRIES - 1; i > FM_CHILD_THROTTLE_DEFAULT; i--)
+            {
+                if (FM_GlobalData.ChildThrottle[i].Volume[0] == '\0')
+                {
+                    FreeIndex = i;
+                }
+                else if (strcmp(FM_GlobalData.ChildThrottle[i].Volume, CmdPtr->Volume) == 0)
+                {
+                    Index = i;
+                }
+            }
+
+            if (Index == FM_CHILD_THROTTLE_ENTRIES)
+            {
+                Index = FreeIndex;
+            }
+        }
+
+        if (Index < FM_CHILD_THROTTLE_ENTRIES)
+        {
+            CommandResult = true;
+            Throttle      = &FM_GlobalData.ChildThrottle[Index];
+
+            if ((CmdPtr->ByteRate == FM_THROTTLE_RATE_DEFAULT) && (CmdPtr->StatRate == FM_THROTTLE_RATE_DEFAULT))
+            {
+                /* A volume that only follows the default rates needs no entry */
+                memset(Throttle, 0, sizeof(*Throttle));
+            }
+            else
+            {
+                strncpy(Throttle->Volume, CmdPtr->Volume, sizeof(Throttle->Volume) - 1);
+                Throttle->Volume[sizeof(Throttle->Volume) - 1] = '\0';
+
+                Throttle->ByteRate = CmdPtr->ByteRate;
+                Throttle->StatRate = CmdPtr->StatRate;
+            }
+        }
+
+        OS_MutSemGive(FM_GlobalData.ChildThrottleSem);
+
+        if (CommandResult)
+        {
+            /* Send command completion event (info) */
+            CFE_EVS_SendEvent(FM_SET_THROTTLE_CMD_INF_EID, CFE_EVS_EventType_INFORMATION,
+                              "%s command: volume = %s, byte rate = %lu, stat rate = %lu", CmdText,
+                              IsDefault ? "(default)" : CmdPtr->Volume, (unsigned long)CmdPtr->ByteRate,
+                              (unsigned long)CmdPtr->StatRate);
+        }
+        else
+        {
+            CFE_EVS_SendEvent(FM_SET_THROTTLE_ARG_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "%s error: volume table full: volume = %s, entries = %d", CmdText, CmdPtr->Volume,
+                              FM_CHILD_THROTTLE_VOLUME_COUNT);
+        }
+    }
+
+    return CommandResult;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM command handler -- Abort Child Task Command                  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_AbortCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    const char *      CmdText       = "Abort";
+    bool              CommandResult = false;
+    uint32            AbortCount    = 0;
+    FM_ChildWorker_t *Worker;
+    uint32            i;
+
+    const FM_Abort_Payload_t *CmdPtr = FM_GET_CMD_PAYLOAD(BufPtr, FM_AbortCmd_t);
+
+    if ((CmdPtr->ChildTask >= FM_CHILD_TASK_COUNT) && (CmdPtr->ChildTask != FM_ABORT_ALL_CHILD_TASKS))
+    {
+        CFE_EVS_SendEvent(FM_ABORT_ARG_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "%s error: invalid command argument: child task = %d, count = %d", CmdText,
+                          (int)CmdPtr->ChildTask, FM_CHILD_TASK_COUNT);
+    }
+    else
+    {
+        CommandResult = true;
+
+        for (i = 0; i < FM_CHILD_TASK_COUNT; i++)
+        {
+            Worker = &FM_GlobalData.ChildWorker[i];
+
+            /* Name the command in progress - a child task that has moved on ignores the request */
+            if (((CmdPtr->ChildTask == i) || (CmdPtr->ChildTask == FM_ABORT_ALL_CHILD_TASKS)) &&
+                (Worker->CurrentCC != 0))
+            {
+                FM_ATOMIC_STORE(&Worker->AbortSequence, FM_ATOMIC_LOAD(&Worker->CmdSequence));
+                AbortCount++;
+            }
+        }
+
+        /* Send command completion event (info) */
+        CFE_EVS_SendEvent(FM_ABORT_CMD_INF_EID, CFE_EVS_EventType_INFORMATION,
+                          "%s command: child task = %d, commands aborted = %d", CmdText, (int)CmdPtr->ChildTask,
+                          (int)AbortCount);
+    }
+
+    return CommandResult;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM command handler -- Flush Child Task Queue                    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_FlushQueueCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    const char *CmdText    = "Flush Queue";
+    uint32      FlushCount = 0;
+
+    /* Commands already executing are left alone */
+    FlushCount = FM_FlushChildQueue();
+
+    /* Send command completion event (info) */
+    CFE_EVS_SendEvent(FM_FLUSH_QUEUE_CMD_INF_EID, CFE_EVS_EventType_INFORMATION, "%s command: commands dropped = %d",
+                      CmdText, (int)FlushCount);
+
+    return true;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM command handler -- Send Command Latency Histograms           */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_SendLatencyCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    const char *CmdText = "Send Latency";
+
+    /* Initialize latency telemetry packet */
+    CFE_MSG_Init(CFE_MSG_PTR(FM_GlobalData.LatencyPkt.TelemetryHeader), CFE_SB_ValueToMsgId(FM_LATENCY_TLM_MID),
+                 sizeof(FM_LatencyPkt_t));
+
+    /* Child tasks may add to the histograms while they are copied */
+    memcpy(&FM_GlobalData.LatencyPkt.Payload, &FM_GlobalData.Latency, sizeof(FM_GlobalData.LatencyPkt.Payload));
+
+    /* Timestamp and send latency telemetry packet */
+    CFE_SB_TimeStampMsg(CFE_MSG_PTR(FM_GlobalData.LatencyPkt.TelemetryHeader));
+    CFE_SB_TransmitMsg(CFE_MSG_PTR(FM_GlobalData.LatencyPkt.TelemetryHeader), true);
+
+    /* Send command completion event (info) */
+    CFE_EVS_SendEvent(FM_SEND_LATENCY_CMD_INF_EID, CFE_EVS_EventType_INFORMATION, "%s command", CmdText);
+
+    return true;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM command handler -- Reset Command Latency Histograms          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_ResetLatencyCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    const char *CmdText = "Reset Latency";
+
+    memset(&FM_GlobalData.Latency, 0, sizeof(FM_GlobalData.Latency));
+
+    FM_GlobalData.ChildQueueWaitLast = 0;
+    FM_GlobalData.ChildQueueWaitMax  = 0;
+
+    /* Send command completion event (info) */
+    CFE_EVS_SendEvent(FM_RESET_LATENCY_CMD_INF_EID, CFE_EVS_EventType_INFORMATION, "%s command", CmdText);
+
+    return true;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM command handler -- Set Verify Mode                           */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_SetVerifyModeCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    const char *CmdText       = "Set Verify Mode";
+    bool        CommandResult = true;
+
+    const FM_VerifyMode_Payload_t *CmdPtr = FM_GET_CMD_PAYLOAD(BufPtr, FM_SetVerifyModeCmd_t);
+
+    if ((CmdPtr->Mode != FM_VERIFY_MODE_MAIN) && (CmdPtr->Mode != FM_VERIFY_MODE_CHILD))
+    {
+        CommandResult = false;
+
+        CFE_EVS_SendEvent(FM_SET_VERIFY_MODE_ARG_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "%s error: invalid command argument: mode = %d", CmdText, (int)CmdPtr->Mode);
+    }
+    else
+    {
+        /* Commands queued from now on are verified where the new mode selects */
+        FM_GlobalData.ChildVerifyMode = CmdPtr->Mode;
+
+        /* Send command completion event (info) */
+        CFE_EVS_SendEvent(FM_SET_VERIFY_MODE_CMD_INF_EID, CFE_EVS_EventType_INFORMATION, "%s command: mode = %d",
+                          CmdText, (int)CmdPtr->Mode);
+    }
+
+    return CommandResult;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM command handler -- Delete Directory Tree                     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_DeleteTreeCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    FM_ChildQueueEntry_t *CmdArgs = NULL;
+    const char *          CmdText = "Delete Directory Tree";
+    bool                  CommandResult;
+
+    const FM_DirectoryName_Payload_t *CmdPtr = FM_GET_CMD_PAYLOAD(BufPtr, FM_DeleteTreeCmd_t);
+
+    /* Verify that the directory exists */
+    CommandResult =
+        FM_VerifyDirExists(CmdPtr->Directory, sizeof(CmdPtr->Directory), FM_DELETE_TREE_SRC_BASE_EID, CmdText);
+
+    /* Check for lower priority child task availability */
+    if (CommandResult == true)
+    {
+        CommandResult = FM_VerifyChildTask(FM_DELETE_TREE_CHILD_BASE_EID, CmdText);
+    }
+
+    /* Prepare command for child task execution */
+    if (CommandResult == true)
+    {
+        CmdArgs = &FM_GlobalData.ChildStagingEntry;
+
+        /* Set handshake queue command args */
+        CmdArgs->CommandCode = FM_DELETE_TREE_CC;
+        strncpy(CmdArgs->Source1, CmdPtr->Directory, OS_MAX_PATH_LEN - 1);
+        CmdArgs->Source1[OS_MAX_PATH_LEN - 1] = '\0';
+
+        /* Invoke lower priority child task */
+        FM_InvokeChildTask();
+    }
+
+    return CommandResult;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM command handler -- Filter Files                              */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_FilterFilesCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    FM_ChildQueueEntry_t *CmdArgs       = NULL;
+    const char *          CmdText       = "Filter Files";
+    bool                  CommandResult = true;
+
+    const FM_FilterFiles_Payload_t *CmdPtr = FM_GET_CMD_PAYLOAD(BufPtr, FM_FilterFilesCmd_t);
+
+    /* Verify that the action argument is valid */
+    if ((CmdPtr->Action != FM_FILTER_ACTION_DELETE) && (CmdPtr->Action != FM_FILTER_ACTION_MOVE) &&
+        (CmdPtr->Action != FM_FILTER_ACTION_COPY))
+    {
+        CommandResult = false;
+
+        CFE_EVS_SendEvent(FM_FILTER_FILES_ACTION_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "%s error: invalid command argument: action = %d", CmdText, (int)CmdPtr->Action);
+    }
+
+    /* Verify that overwrite argument is valid */
+    if (CommandResult == true)
+    {
+        CommandResult = FM_VerifyOverwrite(CmdPtr->Overwrite, FM_FILTER_FILES_OVR_ERR_EID, CmdText);
+    }
+
+    /* Verify that the directory exists */
+    if (CommandResult == true)
+    {
+        CommandResult =
+            FM_VerifyDirExists(CmdPtr->Directory, sizeof(CmdPtr->Directory), FM_FILTER_FILES_SRC_BASE_EID, CmdText);
+    }
+
+    /* Verify that the target directory exists, delete does not use it */
+    if ((CommandResult == true) && (CmdPtr->Action != FM_FILTER_ACTION_DELETE))
+    {
+        CommandResult =
+            FM_VerifyDirExists(CmdPtr->Target, sizeof(CmdPtr->Target), FM_FILTER_FILES_TGT_BASE_EID, CmdText);
+    }
+
+    /* Check for lower priority child task availability */
+    if (CommandResult == true)
+    {
+        CommandResult = FM_VerifyChildTask(FM_FILTER_FILES_CHILD_BASE_EID, CmdText);
+    }
+
+    /* Prepare command for child task execution */
+    if (CommandResult == true)
+    {
+        CmdArgs = &FM_GlobalData.ChildStagingEntry;
+
+        /* Set handshake queue command args */
+        CmdArgs->CommandCode  = FM_FILTER_FILES_CC;
+        CmdArgs->FilterAction = CmdPtr->Action;
+        CmdArgs->Overwrite    = (CmdPtr->Overwrite != 0);
+        CmdArgs->Filter       = CmdPtr->Filter;
+        strncpy(CmdArgs->Source1, CmdPtr->Directory, OS_MAX_PATH_LEN - 1);
+        CmdArgs->Source1[OS_MAX_PATH_LEN - 1] = '\0';
+
+        strncpy(CmdArgs->Source2, CmdPtr->Pattern, OS_MAX_PATH_LEN - 1);
+        CmdArgs->Source2[OS_MAX_PATH_LEN - 1] = '\0';
+
+        /* Delete leaves the target name empty so that it takes no path blocks */
+        if (CmdPtr->Action != FM_FILTER_ACTION_DELETE)
+        {
+            strncpy(CmdArgs->Target, CmdPtr->Target, OS_MAX_PATH_LEN - 1);
+            CmdArgs->Target[OS_MAX_PATH_LEN - 1] = '\0';
+        }
+
+        /* Invoke lower priority child task */
+        FM_InvokeChildTask();
+    }
+
+    return CommandResult;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM command handler -- Enforce Retention                         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_EnforceRetentionCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    const char *CmdText       = "Enforce Retention";
+    bool        CommandResult = false;
+
+    const FM_RetentionIndex_Payload_t *CmdPtr = FM_GET_CMD_PAYLOAD(BufPtr, FM_EnforceRetentionCmd_t);
+
+    if (FM_GlobalData.RetentionTablePtr == NULL)
+    {
+        /* Retention table has not been loaded */
+        CFE_EVS_SendEvent(FM_ENFORCE_RETENTION_TBL_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "%s error: retention table is not loaded", CmdText);
+    }
+    else if (CmdPtr->TableEntryIndex >= FM_RETENTION_ENTRY_COUNT)
+    {
+        /* Table index argument is out of range */
+        CFE_EVS_SendEvent(FM_ENFORCE_RETENTION_IDX_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "%s error: invalid command argument: index = %d", CmdText, (int)CmdPtr->TableEntryIndex);
+    }
+    else if (FM_GlobalData.RetentionTablePtr->Entries[CmdPtr->TableEntryIndex].Enabled == 0)
+    {
+        /* Disabled and unused entries manage nothing */
+        CFE_EVS_SendEvent(FM_ENFORCE_RETENTION_DISABLED_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "%s error: table entry is not enabled: index = %d", CmdText, (int)CmdPtr->TableEntryIndex);
+    }
+    else if (FM_ATOMIC_LOAD(&FM_GlobalData.Retention[CmdPtr->TableEntryIndex].Busy) != 0)
+    {
+        /* One pass per entry at a time, the pending pass will do the same work */
+        CFE_EVS_SendEvent(FM_ENFORCE_RETENTION_BUSY_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "%s error: previous pass is still pending: index = %d", CmdText,
+                          (int)CmdPtr->TableEntryIndex);
+    }
+    else
+    {
+        /* Check for lower priority child task availability and queue the pass */
+        CommandResult = FM_StartRetention(CmdPtr->TableEntryIndex, true);
+    }
+
+    return CommandResult;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM command handler -- Set Delete Mode                           */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_SetDeleteModeCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    const char *CmdText       = "Set Delete Mode";
+    bool        CommandResult = true;
+
+    const FM_DeleteMode_Payload_t *CmdPtr = FM_GET_CMD_PAYLOAD(BufPtr, FM_SetDeleteModeCmd_t);
+
+    if ((CmdPtr->Mode != FM_DELETE_MODE_DIRECT) && (CmdPtr->Mode != FM_DELETE_MODE_TRASH))
+    {
+        CommandResult = false;
+
+        CFE_EVS_SendEvent(FM_SET_DELETE_MODE_ARG_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "%s error: invalid command argument: mode = %d", CmdText, (int)CmdPtr->Mode);
+    }
+    else
+    {
+        /* Files already in the trash are still purged after a change to direct mode */
+        FM_GlobalData.ChildDeleteMode = CmdPtr->Mode;
+
+        /* Send command completion event (info) */
+        CFE_EVS_SendEvent(FM_SET_DELETE_MODE_CMD_INF_EID, CFE_EVS_EventType_INFORMATION, "%s command: mode = %d",
+                          CmdText, (int)CmdPtr->Mode);
+    }
+
+    return CommandResult;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM command handler -- Purge Trash                               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_PurgeTrashCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    const char *CmdText       = "Purge Trash";
+    bool        CommandResult = false;
+
+    if (FM_ATOMIC_LOAD(&FM_GlobalData.TrashPurgeBusy) != 0)
+    {
+        /* One purge pass at a time, the pending pass will do the same work */
+        CFE_EVS_SendEvent(FM_PURGE_TRASH_BUSY_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "%s error: previous pass is still pending", CmdText);
+    }
+    else
+    {
+        /* Check for lower priority child task availability and queue the pass */
+        CommandResult = FM_StartPurge(true);
+    }
+
+    return CommandResult;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM command handler -- Get File Digest                           */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_GetFileDigestCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    FM_ChildQueueEntry_t *CmdArgs       = NULL;
+    const char *          CmdText       = "Get File Digest";
+    bool                  CommandResult = true;
+
+    const FM_FilenameAndDigests_Payload_t *CmdPtr = FM_GET_CMD_PAYLOAD(BufPtr, FM_GetFileDigestCmd_t);
+
+    /* Verify that at least one digest is selected and that each one is known */
+    if ((CmdPtr->Digests == 0) || ((CmdPtr->Digests & ~FM_DIGEST_ALL) != 0))
+    {
+        CommandResult = false;
+
+        CFE_EVS_SendEvent(FM_GET_FILE_DIGEST_TYPE_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "%s error: invalid command argument: digests = 0x%X", CmdText,
+                          (unsigned int)CmdPtr->Digests);
+    }
+
+    /* Verify that the source exists, is a file and is not open */
+    if (CommandResult == true)
+    {
+        CommandResult =
+            FM_VerifyFileClosed(CmdPtr->Filename, sizeof(CmdPtr->Filename), FM_GET_FILE_DIGEST_SRC_BASE_EID, CmdText);
+    }
+
+    /* Check for lower priority child task availability */
+    if (CommandResult == true)
+    {
+        CommandResult = FM_VerifyChildTask(FM_GET_FILE_DIGEST_CHILD_BASE_EID, CmdText);
+    }
+
+    /* Prepare command for child task execution */
+    if (CommandResult == true)
+    {
+        CmdArgs = &FM_GlobalData.ChildStagingEntry;
+
+        /* Set handshake queue command args, the digests travel in the CRC method argument */
+        CmdArgs->CommandCode = FM_GET_FILE_DIGEST_CC;
+        strncpy(CmdArgs->Source1, CmdPtr->Filename, OS_MAX_PATH_LEN - 1);
+        CmdArgs->Source1[OS_MAX_PATH_LEN - 1] = '\0';
+
+        CmdArgs->FileInfoCRC = CmdPtr->Digests;
+
+        /* Invoke lower priority child task */
+        FM_InvokeChildTask();
+    }
+
+    return CommandResult;
+}
@@ -425,4 +425,295 @@ bool FM_SetTableStateCmd(const CFE_SB_Buffer_t *BufPtr);
  */
 bool FM_SetPermissionsCmd(const CFE_SB_Buffer_t *BufPtr);
 
+/**
+ *  \brief Set Copy Block Size Command Handler Function
+ *
+ *  \par Description
+ *       This function sets the number of bytes the child tasks read and write
+ *       at a time when copying a file.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       A copy already in progress keeps the block size it started with.
+ *
+ *  \param [in]  BufPtr Pointer to Software Bus command packet.
+ *
+ *  \return Boolean command success response
+ *  \retval true  Command successful
+ *  \retval false Command not successful
+ *
+ *  \sa #FM_SET_COPY_BLOCK_SIZE_CC, #FM_SetCopyBlockSizeCmd_t, #FM_ChildCopyFile
+ */
+bool FM_SetCopyBlockSizeCmd(const CFE_SB_Buffer_t *BufPtr);
+
+/**
+ *  \brief Concatenate List of Files Command Handler Function
+ *
+ *  \par Description
+ *       This function verifies the source list, the target file and the child
+ *       task queue of a concatenate list of files command and hands the command
+ *       to the child task, which concatenates the files.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Only the list file is verified when one is given, the names it holds
+ *       are checked by the child task as it reaches them.  Inline source names
+ *       are queued as one newline separated list in the path block pool.
+ *
+ *  \param [in]  BufPtr Pointer to Software Bus command packet.
+ *
+ *  \return Boolean command success response
+ *  \retval true  Command successful
+ *  \retval false Command not successful
+ *
+ *  \sa #FM_CONCAT_LIST_CC, #FM_ConcatListCmd_t, #FM_CONCAT_LIST_CMD_INF_EID
+ */
+bool FM_ConcatListCmd(const CFE_SB_Buffer_t *BufPtr);
+
+/**
+ *  \brief Set Throttle Command Handler Function
+ *
+ *  \par Description
+ *       This function sets the default child task byte and OS_stat rates, or
+ *       the rates of one volume.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The new rates apply to the next block or OS_stat of every child task,
+ *       including commands already in progress.
+ *
+ *  \param [in]  BufPtr Pointer to Software Bus command packet.
+ *
+ *  \return Boolean command success response
+ *  \retval true  Command successful
+ *  \retval false Command not successful
+ *
+ *  \sa #FM_SET_THROTTLE_CC, #FM_SetThrottleCmd_t, #FM_ChildThrottle
+ */
+bool FM_SetThrottleCmd(const CFE_SB_Buffer_t *BufPtr);
+
+/**
+ *  \brief Abort Child Task Command Handler Function
+ *
+ *  \par Description
+ *       This function asks one child task, or every child task, to stop the
+ *       command it is executing.  The request names the command in progress
+ *       so that it cannot stop a command the child task starts later.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The child task stops at its next #FM_ChildAbortCheck, the abort is
+ *       reported by the child task with #FM_CHILD_ABORT_ERR_EID.
+ *
+ *  \param [in]  BufPtr Pointer to Software Bus command packet.
+ *
+ *  \return Boolean command success response
+ *  \retval true  Command successful
+ *  \retval false Command not successful
+ *
+ *  \sa #FM_ABORT_CC, #FM_AbortCmd_t
+ */
+bool FM_AbortCmd(const CFE_SB_Buffer_t *BufPtr);
+
+/**
+ *  \brief Flush Child Task Queue Command Handler Function
+ *
+ *  \par Description
+ *       This function drops every command waiting in the child task queue.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Commands already executing are not affected.
+ *
+ *  \param [in]  BufPtr Pointer to Software Bus command packet.
+ *
+ *  \return Boolean command success response
+ *  \retval true  Command successful
+ *  \retval false Command not successful
+ *
+ *  \sa #FM_FLUSH_QUEUE_CC, #FM_FlushQueueCmd_t, #FM_FlushChildQueue
+ */
+bool FM_FlushQueueCmd(const CFE_SB_Buffer_t *BufPtr);
+
+/**
+ *  \brief Send Command Latency Histograms Command Handler Function
+ *
+ *  \par Description
+ *       This function copies the command latency histograms into the latency
+ *       telemetry packet and sends it.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The child tasks keep counting while the histograms are copied, a
+ *       packet may hold a count from a command the next packet also shows.
+ *
+ *  \param [in]  BufPtr Pointer to Software Bus command packet.
+ *
+ *  \return Boolean command success response
+ *  \retval true  Command successful
+ *  \retval false Command not successful
+ *
+ *  \sa #FM_SEND_LATENCY_CC, #FM_SendLatencyCmd_t, #FM_LatencyPkt_t
+ */
+bool FM_SendLatencyCmd(const CFE_SB_Buffer_t *BufPtr);
+
+/**
+ *  \brief Reset Command Latency Histograms Command Handler Function
+ *
+ *  \par Description
+ *       This function sets the command latency histograms and the queue
+ *       wait times reported in housekeeping telemetry to zero.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *
+ *  \param [in]  BufPtr Pointer to Software Bus command packet.
+ *
+ *  \return Boolean command success response
+ *  \retval true  Command successful
+ *  \retval false Command not successful
+ *
+ *  \sa #FM_RESET_LATENCY_CC, #FM_ResetLatencyCmd_t
+ */
+bool FM_ResetLatencyCmd(const CFE_SB_Buffer_t *BufPtr);
+
+/**
+ *  \brief Set Verify Mode Command Handler Function
+ *
+ *  \par Description
+ *       This function selects whether the main task or the child task
+ *       verifies the file system state of file command arguments.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Commands already queued keep the mode they were queued with.
+ *
+ *  \param [in]  BufPtr Pointer to Software Bus command packet.
+ *
+ *  \return Boolean command success response
+ *  \retval true  Command successful
+ *  \retval false Command not successful
+ *
+ *  \sa #FM_SET_VERIFY_MODE_CC, #FM_SetVerifyModeCmd_t
+ */
+bool FM_SetVerifyModeCmd(const CFE_SB_Buffer_t *BufPtr);
+
+/**
+ *  \brief Delete Directory Tree Command Handler Function
+ *
+ *  \par Description
+ *       This function deletes the command specified directory together
+ *       with the files and sub-directories below it.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The tree is deleted by a child task, only the directory name is
+ *       verified here.
+ *
+ *  \param [in]  BufPtr Pointer to Software Bus command packet.
+ *
+ *  \return Boolean command success response
+ *  \retval true  Command successful
+ *  \retval false Command not successful
+ *
+ *  \sa #FM_DELETE_TREE_CC, #FM_DeleteTreeCmd_t
+ */
+bool FM_DeleteTreeCmd(const CFE_SB_Buffer_t *BufPtr);
+
+/**
+ *  \brief Filter Files Command Handler Function
+ *
+ *  \par Description
+ *       This function deletes, moves or copies the files in the command
+ *       specified directory that pass the command specified name pattern,
+ *       age and size filter.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The files are filtered by a child task, only the arguments and
+ *       directory names are verified here.
+ *
+ *  \param [in]  BufPtr Pointer to Software Bus command packet.
+ *
+ *  \return Boolean command success response
+ *  \retval true  Command successful
+ *  \retval false Command not successful
+ *
+ *  \sa #FM_FILTER_FILES_CC, #FM_FilterFilesCmd_t
+ */
+bool FM_FilterFilesCmd(const CFE_SB_Buffer_t *BufPtr);
+
+/**
+ *  \brief Enforce Retention Command Handler Function
+ *
+ *  \par Description
+ *       This function queues a retention pass over the directory of the
+ *       command specified retention table entry, without waiting for the
+ *       entry's next scheduled pass.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The pass is made by a child task, only the table entry is
+ *       verified here.
+ *
+ *  \param [in]  BufPtr Pointer to Software Bus command packet.
+ *
+ *  \return Boolean command success response
+ *  \retval true  Command successful
+ *  \retval false Command not successful
+ *
+ *  \sa #FM_ENFORCE_RETENTION_CC, #FM_EnforceRetentionCmd_t
+ */
+bool FM_EnforceRetentionCmd(const CFE_SB_Buffer_t *BufPtr);
+
+/**
+ *  \brief Set Delete Mode Command Handler Function
+ *
+ *  \par Description
+ *       This function selects whether the child task removes deleted files
+ *       at once or renames them into the trash directory of their volume.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Commands already queued use the mode set when they run.
+ *
+ *  \param [in]  BufPtr Pointer to Software Bus command packet.
+ *
+ *  \return Boolean command success response
+ *  \retval true  Command successful
+ *  \retval false Command not successful
+ *
+ *  \sa #FM_SET_DELETE_MODE_CC, #FM_SetDeleteModeCmd_t
+ */
+bool FM_SetDeleteModeCmd(const CFE_SB_Buffer_t *BufPtr);
+
+/**
+ *  \brief Purge Trash Command Handler Function
+ *
+ *  \par Description
+ *       This function queues a pass that removes every file in the trash
+ *       directories, without waiting for the scheduled purge passes.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The pass is made by a child task, only that no other purge pass is
+ *       pending is verified here.
+ *
+ *  \param [in]  BufPtr Pointer to Software Bus command packet.
+ *
+ *  \return Boolean command success response
+ *  \retval true  Command successful
+ *  \retval false Command not successful
+ *
+ *  \sa #FM_PURGE_TRASH_CC, #FM_PurgeTrashCmd_t
+ */
+bool FM_PurgeTrashCmd(const CFE_SB_Buffer_t *BufPtr);
+
+/**
+ *  \brief Get File Digest Command Handler Function
+ *
+ *  \par Description
+ *       This function creates a telemetry packet holding the digests of
+ *       the command specified file selected by the command.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The file is read and the packet sent by a child task.
+ *
+ *  \param [in]  BufPtr Pointer to Software Bus command packet.
+ *
+ *  \return Boolean command success response
+ *  \retval true  Command successful
+ *  \retval false Command not successful
+ *
+ *  \sa #FM_GET_FILE_DIGEST_CC, #FM_GetFileDigestCmd_t, #FM_FileDigestPkt_t
+ */
+bool FM_GetFileDigestCmd(const CFE_SB_Buffer_t *BufPtr);
+
 #endif
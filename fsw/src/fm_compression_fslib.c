@@ -46,8 +46,8 @@ struct FM_Decompressor_State
 /**
  * @brief Instance of the decompressor state object
  *
- * A single instance is OK because this is only invoked
- * from a single thread.
+ * A single instance is OK because the child tasks serialize
+ * access to it with the decompress mutex semaphore.
  */
 static FM_Decompressor_State_t FM_FSLIB_DecompressState;
 
@@ -0,0 +1,249 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,918-1, and identified as “Core Flight
+ * Software System (cFS) File Manager Application Version 2.6.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *  File Manager (FM) CRC kernels
+ *
+ * CRC-16 uses the CRC-16/ARC polynomial in its reflected form, as cFE
+ * does.  The kernel reads the data a byte at a time, so the result does
+ * not depend on processor byte order or data alignment.
+ */
+
+#include <common_types.h>
+#include <string.h>
+
+#include "cfe.h"
+#include "fm_crc.h"
+
+/* Reflected CRC-16/ARC polynomial */
+#define FM_CRC16_POLY 0xA001
+
+/* Check value, its CRC-16 has bit 15 set so that a sign extending cFE can be told apart */
+#define FM_CRC_CHECK_DATA   "123456789"
+#define FM_CRC_CHECK_LENGTH 9
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM CRC -- apply a zero run operator to a CRC-16                 */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+static uint16 FM_CrcMatrixTimes(const uint16 *Matrix, uint16 Vector)
+{
+    uint16 Result = 0;
+    uint32 Bit;
+
+    for (Bit = 0; (Vector >> Bit) != 0; Bit++)
+    {
+        if (((Vector >> Bit) & 1) != 0)
+        {
+            Result ^= Matrix[Bit];
+        }
+    }
+
+    return Result;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM CRC -- build the tables and select the CRC method            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_CrcInit(FM_Crc_State_t *State)
+{
+    uint32 CfeCrc = 0;
+    uint32 Crc    = 0;
+    uint32 Slice;
+    uint32 i;
+    uint32 Bit;
+    uint16 Operator[16];
+    uint16 Squared[16];
+
+    for (i = 0; i < 256; i++)
+    {
+        Crc = i;
+
+        for (Bit = 0; Bit < 8; Bit++)
+        {
+            if ((Crc & 1) != 0)
+            {
+                Crc = (Crc >> 1) ^ FM_CRC16_POLY;
+            }
+            else
+            {
+                Crc = Crc >> 1;
+            }
+        }
+
+        State->Table[0][i] = (uint16)Crc;
+    }
+
+    for (Slice = 1; Slice < FM_CRC_SLICES; Slice++)
+    {
+        for (i = 0; i < 256; i++)
+        {
+            Crc = State->Table[Slice - 1][i];
+
+            State->Table[Slice][i] = (uint16)((Crc >> 8) ^ State->Table[0][Crc & 0xFF]);
+        }
+    }
+
+    /* One zero bit shifts the CRC right and folds in the polynomial */
+    Operator[0] = FM_CRC16_POLY;
+
+    for (Bit = 1; Bit < 16; Bit++)
+    {
+        Operator[Bit] = (uint16)(1 << (Bit - 1));
+    }
+
+    /* Squaring an operator doubles its run, three times gives one zero byte */
+    for (i = 0; i < FM_CRC_ZERO_OPS + 2; i++)
+    {
+        for (Bit = 0; Bit < 16; Bit++)
+        {
+            Squared[Bit] = FM_CrcMatrixTimes(Operator, Operator[Bit]);
+        }
+
+        memcpy(Operator, Squared, sizeof(Operator));
+
+        if (i >= 2)
+        {
+            memcpy(State->ZeroOp[i - 2], Operator, sizeof(Operator));
+        }
+    }
+
+    State->Method     = FM_CRC_METHOD_CFE;
+    State->SignExtend = false;
+
+    /* Only take over from cFE when the result is the same */
+    CfeCrc = CFE_ES_CalculateCRC(FM_CRC_CHECK_DATA, FM_CRC_CHECK_LENGTH, 0, CFE_ES_CrcType_CRC_16);
+    Crc    = FM_CrcSlice8(State, (const uint8 *)FM_CRC_CHECK_DATA, FM_CRC_CHECK_LENGTH, 0);
+
+    if (CfeCrc == Crc)
+    {
+        State->Method = FM_CRC_METHOD_SLICE8;
+    }
+    else if (CfeCrc == (Crc | 0xFFFF0000))
+    {
+        /* cFE computes the CRC in a signed 16 bit variable */
+        State->Method     = FM_CRC_METHOD_SLICE8;
+        State->SignExtend = true;
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM CRC -- continue a CRC calculation                            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+uint32 FM_CalculateCRC(const FM_Crc_State_t *State, const void *DataPtr, size_t DataLength, uint32 InputCRC,
+                       uint32 TypeCRC)
+{
+    uint32 Crc = 0;
+
+    if ((State->Method == FM_CRC_METHOD_SLICE8) && (TypeCRC == CFE_ES_CrcType_CRC_16))
+    {
+        /* Only the low half of a previous result is carried forward, as in cFE */
+        Crc = FM_CrcSlice8(State, DataPtr, DataLength, (uint16)(InputCRC & 0xFFFF));
+
+        if ((State->SignExtend) && ((Crc & 0x8000) != 0))
+        {
+            Crc |= 0xFFFF0000;
+        }
+    }
+    else
+    {
+        Crc = CFE_ES_CalculateCRC(DataPtr, DataLength, InputCRC, TypeCRC);
+    }
+
+    return Crc;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM CRC -- CRC-16 table kernel                                   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+uint16 FM_CrcSlice8(const FM_Crc_State_t *State, const uint8 *DataPtr, size_t DataLength, uint16 Crc)
+{
+    const uint8 *BufPtr = DataPtr;
+    size_t       Length = DataLength;
+
+    /* The eight lookups of a step do not depend on each other */
+    while (Length >= FM_CRC_SLICES)
+    {
+        Crc ^= (uint16)(BufPtr[0] | (BufPtr[1] << 8));
+
+        Crc = State->Table[7][Crc & 0xFF] ^ State->Table[6][Crc >> 8] ^ State->Table[5][BufPtr[2]] ^
+              State->Table[4][BufPtr[3]] ^ State->Table[3][BufPtr[4]] ^ State->Table[2][BufPtr[5]] ^
+              State->Table[1][BufPtr[6]] ^ State->Table[0][BufPtr[7]];
+
+        BufPtr += FM_CRC_SLICES;
+        Length -= FM_CRC_SLICES;
+    }
+
+    while (Length > 0)
+    {
+        Crc = (Crc >> 8) ^ State->Table[0][(Crc ^ *BufPtr) & 0xFF];
+
+        BufPtr++;
+        Length--;
+    }
+
+    return Crc;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM CRC -- combine the CRC-16 values of adjacent ranges          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+uint32 FM_CrcCombine(const FM_Crc_State_t *State, uint32 CrcA, uint32 CrcB, uint32 LengthB)
+{
+    uint16 Crc = (uint16)(CrcA & 0xFFFF);
+    uint32 Result;
+    uint32 Bit;
+
+    /*
+     * Running the second range from the CRC of the first gives the same
+     * result as running it from zero, XORed with the first CRC run over
+     * as many zero bytes
+     */
+    for (Bit = 0; (Bit < FM_CRC_ZERO_OPS) && ((LengthB >> Bit) != 0); Bit++)
+    {
+        if (((LengthB >> Bit) & 1) != 0)
+        {
+            Crc = FM_CrcMatrixTimes(State->ZeroOp[Bit], Crc);
+        }
+    }
+
+    Result = Crc ^ (CrcB & 0xFFFF);
+
+    if ((State->SignExtend) && ((Result & 0x8000) != 0))
+    {
+        Result |= 0xFFFF0000;
+    }
+
+    return Result;
+}
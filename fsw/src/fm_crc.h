@@ -0,0 +1,122 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,918-1, and identified as “Core Flight
+ * Software System (cFS) File Manager Application Version 2.6.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   FM internal CRC API.  The CRC of a file is computed here rather than by
+ *   passing each block to CFE_ES_CalculateCRC, which processes one byte per
+ *   table lookup.  The table kernel is only used when it gives the same
+ *   result as cFE, so reported CRC values do not change.
+ */
+
+#ifndef FM_CRC_H
+#define FM_CRC_H
+
+#include <common_types.h>
+
+#include "cfe.h"
+
+/**
+ * \name CRC methods
+ * \{
+ */
+#define FM_CRC_METHOD_CFE    0 /**< \brief Every CRC is computed by CFE_ES_CalculateCRC */
+#define FM_CRC_METHOD_SLICE8 1 /**< \brief CRC-16 is computed eight bytes at a time by FM */
+/**\}*/
+
+#define FM_CRC_SLICES   8  /**< \brief Bytes consumed by each step of the table kernel */
+#define FM_CRC_ZERO_OPS 32 /**< \brief Zero run operators, one per bit of a 32 bit length */
+
+/**
+ * @brief The state object for the CRC kernels
+ *
+ * Table[0] is the byte-at-a-time CRC-16/ARC table used by cFE.  Table[n]
+ * gives the CRC of a byte followed by n zero bytes, which lets one step
+ * of the kernel consume #FM_CRC_SLICES bytes with independent lookups.
+ *
+ * ZeroOp[n] is the 16x16 bit matrix that advances a CRC-16 over 2^n zero
+ * bytes, stored a column per word.  These let the CRCs of adjacent ranges
+ * of a file be combined without reading the data again.
+ */
+typedef struct
+{
+    uint32 Method;     /**< \brief CRC method in use (FM_CRC_METHOD_xxx) */
+    bool   SignExtend; /**< \brief Set when cFE returns a CRC-16 with bit 15 copied into the upper half */
+
+    uint16 Table[FM_CRC_SLICES][256];   /**< \brief CRC-16 kernel lookup tables */
+    uint16 ZeroOp[FM_CRC_ZERO_OPS][16]; /**< \brief CRC-16 zero run operators */
+} FM_Crc_State_t;
+
+/**
+ * @brief Initialize the CRC kernels
+ *
+ * Builds the lookup tables and selects #FM_CRC_METHOD_SLICE8 only if the
+ * table kernel gives the same CRC-16 as CFE_ES_CalculateCRC for a check
+ * value, otherwise every CRC is left to cFE.
+ *
+ * @param State the CRC state object
+ */
+void FM_CrcInit(FM_Crc_State_t *State);
+
+/**
+ * @brief Continue a CRC calculation
+ *
+ * Drop-in replacement for CFE_ES_CalculateCRC.  CRC types other than
+ * CRC-16 are always passed to cFE.
+ *
+ * @param State the CRC state object
+ * @param DataPtr the data to add to the CRC
+ * @param DataLength the number of bytes of data
+ * @param InputCRC the CRC of the preceding data, zero for the first block
+ * @param TypeCRC the CRC algorithm (CFE_ES_CrcType_xxx)
+ *
+ * @returns The CRC of the preceding data and this block
+ */
+uint32 FM_CalculateCRC(const FM_Crc_State_t *State, const void *DataPtr, size_t DataLength, uint32 InputCRC,
+                       uint32 TypeCRC);
+
+/**
+ * @brief CRC-16 table kernel
+ *
+ * @param State the CRC state object
+ * @param DataPtr the data to add to the CRC
+ * @param DataLength the number of bytes of data
+ * @param Crc the CRC-16 of the preceding data
+ *
+ * @returns The CRC-16 of the preceding data and this block
+ */
+uint16 FM_CrcSlice8(const FM_Crc_State_t *State, const uint8 *DataPtr, size_t DataLength, uint16 Crc);
+
+/**
+ * @brief Combine the CRC-16 values of two adjacent ranges of data
+ *
+ * Gives the CRC-16 that a single pass over the first range and then the
+ * second would have produced, where each range CRC was started from zero.
+ * Values are in the same form as returned by #FM_CalculateCRC.
+ *
+ * @param State the CRC state object
+ * @param CrcA the CRC-16 of the first range
+ * @param CrcB the CRC-16 of the second range
+ * @param LengthB the number of bytes in the second range
+ *
+ * @returns The CRC-16 of both ranges
+ */
+uint32 FM_CrcCombine(const FM_Crc_State_t *State, uint32 CrcA, uint32 CrcB, uint32 LengthB);
+
+#endif
@@ -0,0 +1,485 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,918-1, and identified as “Core Flight
+ * Software System (cFS) File Manager Application Version 2.6.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *  File Manager (FM) file digest kernels
+ *
+ * CRC-32C uses the Castagnoli polynomial in its reflected form, xxHash64
+ * uses a seed of zero and SHA-256 is as specified in FIPS 180-4.  Every
+ * kernel reads the data a byte at a time, so the results do not depend on
+ * processor byte order or data alignment.
+ */
+
+#include <common_types.h>
+#include <string.h>
+
+#include "cfe.h"
+#include "fm_digest.h"
+
+/* Reflected CRC-32C polynomial */
+#define FM_DIGEST_CRC32C_POLY 0x82F63B78
+
+/* xxHash64 primes */
+#define FM_DIGEST_XXH_PRIME1 0x9E3779B185EBCA87ULL
+#define FM_DIGEST_XXH_PRIME2 0xC2B2AE3D27D4EB4FULL
+#define FM_DIGEST_XXH_PRIME3 0x165667B19E3779F9ULL
+#define FM_DIGEST_XXH_PRIME4 0x85EBCA77C2B2AE63ULL
+#define FM_DIGEST_XXH_PRIME5 0x27D4EB2F165667C5ULL
+
+/* Offset of the message length in the last SHA-256 block */
+#define FM_DIGEST_SHA256_LENGTH_OFFSET 56
+
+/* SHA-256 initial hash value */
+static const uint32 FM_DIGEST_SHA256_INIT[FM_DIGEST_SHA256_WORDS] = {
+    0x6A09E667, 0xBB67AE85, 0x3C6EF372, 0xA54FF53A, 0x510E527F, 0x9B05688C, 0x1F83D9AB, 0x5BE0CD19};
+
+/* SHA-256 round constants */
+static const uint32 FM_DIGEST_SHA256_K[64] = {
+    0x428A2F98, 0x71374491, 0xB5C0FBCF, 0xE9B5DBA5, 0x3956C25B, 0x59F111F1, 0x923F82A4, 0xAB1C5ED5,
+    0xD807AA98, 0x12835B01, 0x243185BE, 0x550C7DC3, 0x72BE5D74, 0x80DEB1FE, 0x9BDC06A7, 0xC19BF174,
+    0xE49B69C1, 0xEFBE4786, 0x0FC19DC6, 0x240CA1CC, 0x2DE92C6F, 0x4A7484AA, 0x5CB0A9DC, 0x76F988DA,
+    0x983E5152, 0xA831C66D, 0xB00327C8, 0xBF597FC7, 0xC6E00BF3, 0xD5A79147, 0x06CA6351, 0x14292967,
+    0x27B70A85, 0x2E1B2138, 0x4D2C6DFC, 0x53380D13, 0x650A7354, 0x766A0ABB, 0x81C2C92E, 0x92722C85,
+    0xA2BFE8A1, 0xA81A664B, 0xC24B8B70, 0xC76C51A3, 0xD192E819, 0xD6990624, 0xF40E3585, 0x106AA070,
+    0x19A4C116, 0x1E376C08, 0x2748774C, 0x34B0BCB5, 0x391C0CB3, 0x4ED8AA4A, 0x5B9CCA4F, 0x682E6FF3,
+    0x748F82EE, 0x78A5636F, 0x84C87814, 0x8CC70208, 0x90BEFFFA, 0xA4506CEB, 0xBEF9A3F7, 0xC67178F2};
+
+/* Handles each whole stripe or block of a digest */
+typedef void (*FM_DigestBlockFunc_t)(FM_Digest_Context_t *Context, const uint8 *BlockPtr);
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM digest -- rotate and load helpers                            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+static uint32 FM_DigestRotr32(uint32 Value, uint32 Count)
+{
+    return (Value >> Count) | (Value << (32 - Count));
+}
+
+static uint64 FM_DigestRotl64(uint64 Value, uint32 Count)
+{
+    return (Value << Count) | (Value >> (64 - Count));
+}
+
+static uint32 FM_DigestLoad32(const uint8 *BufPtr)
+{
+    return (uint32)BufPtr[0] | ((uint32)BufPtr[1] << 8) | ((uint32)BufPtr[2] << 16) | ((uint32)BufPtr[3] << 24);
+}
+
+static uint64 FM_DigestLoad64(const uint8 *BufPtr)
+{
+    return (uint64)FM_DigestLoad32(BufPtr) | ((uint64)FM_DigestLoad32(&BufPtr[4]) << 32);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM digest -- split data into whole stripes or blocks            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+static void FM_DigestFeed(FM_Digest_Context_t *Context, uint8 *Buffer, uint32 *Buffered, uint32 BlockSize,
+                          const uint8 *DataPtr, size_t DataLength, FM_DigestBlockFunc_t BlockFunc)
+{
+    const uint8 *BufPtr = DataPtr;
+    size_t       Length = DataLength;
+    size_t       Fill   = 0;
+
+    /* Complete the block left over from the previous update first */
+    if (*Buffered > 0)
+    {
+        Fill = BlockSize - *Buffered;
+        if (Fill > Length)
+        {
+            Fill = Length;
+        }
+
+        memcpy(&Buffer[*Buffered], BufPtr, Fill);
+        *Buffered += Fill;
+        BufPtr += Fill;
+        Length -= Fill;
+
+        if (*Buffered == BlockSize)
+        {
+            BlockFunc(Context, Buffer);
+            *Buffered = 0;
+        }
+    }
+
+    /* Whole blocks are taken straight from the data */
+    while (Length >= BlockSize)
+    {
+        BlockFunc(Context, BufPtr);
+
+        BufPtr += BlockSize;
+        Length -= BlockSize;
+    }
+
+    if (Length > 0)
+    {
+        memcpy(&Buffer[*Buffered], BufPtr, Length);
+        *Buffered += Length;
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM digest -- xxHash64 stripe                                    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+static uint64 FM_DigestXxhRound(uint64 Accum, uint64 Input)
+{
+    Accum += Input * FM_DIGEST_XXH_PRIME2;
+    Accum = FM_DigestRotl64(Accum, 31);
+
+    return Accum * FM_DIGEST_XXH_PRIME1;
+}
+
+static void FM_DigestXxhStripe(FM_Digest_Context_t *Context, const uint8 *BlockPtr)
+{
+    uint32 i;
+
+    /* The four lanes of a stripe do not depend on each other */
+    for (i = 0; i < FM_DIGEST_XXH64_ACCUMS; i++)
+    {
+        Context->XxhAccum[i] = FM_DigestXxhRound(Context->XxhAccum[i], FM_DigestLoad64(&BlockPtr[i * 8]));
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM digest -- xxHash64 result                                    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+static uint64 FM_DigestXxhFinish(const FM_Digest_Context_t *Context)
+{
+    const uint8 *BufPtr = Context->XxhBuffer;
+    uint32       Length = Context->XxhBuffered;
+    uint64       Hash   = FM_DIGEST_XXH_PRIME5;
+    uint32       i;
+
+    if (Context->XxhLength >= FM_DIGEST_XXH64_STRIPE)
+    {
+        Hash = FM_DigestRotl64(Context->XxhAccum[0], 1) + FM_DigestRotl64(Context->XxhAccum[1], 7) +
+               FM_DigestRotl64(Context->XxhAccum[2], 12) + FM_DigestRotl64(Context->XxhAccum[3], 18);
+
+        for (i = 0; i < FM_DIGEST_XXH64_ACCUMS; i++)
+        {
+            Hash ^= FM_DigestXxhRound(0, Context->XxhAccum[i]);
+            Hash = (Hash * FM_DIGEST_XXH_PRIME1) + FM_DIGEST_XXH_PRIME4;
+        }
+    }
+
+    Hash += Context->XxhLength;
+
+    /* Bytes short of a stripe are folded in eight, then four, then one at a time */
+    while (Length >= 8)
+    {
+        Hash ^= FM_DigestXxhRound(0, FM_DigestLoad64(BufPtr));
+        Hash = (FM_DigestRotl64(Hash, 27) * FM_DIGEST_XXH_PRIME1) + FM_DIGEST_XXH_PRIME4;
+
+        BufPtr += 8;
+        Length -= 8;
+    }
+
+    if (Length >= 4)
+    {
+        Hash ^= (uint64)FM_DigestLoad32(BufPtr) * FM_DIGEST_XXH_PRIME1;
+        Hash = (FM_DigestRotl64(Hash, 23) * FM_DIGEST_XXH_PRIME2) + FM_DIGEST_XXH_PRIME3;
+
+        BufPtr += 4;
+        Length -= 4;
+    }
+
+    while (Length > 0)
+    {
+        Hash ^= (uint64)(*BufPtr) * FM_DIGEST_XXH_PRIME5;
+        Hash = FM_DigestRotl64(Hash, 11) * FM_DIGEST_XXH_PRIME1;
+
+        BufPtr++;
+        Length--;
+    }
+
+    Hash ^= Hash >> 33;
+    Hash *= FM_DIGEST_XXH_PRIME2;
+    Hash ^= Hash >> 29;
+    Hash *= FM_DIGEST_XXH_PRIME3;
+    Hash ^= Hash >> 32;
+
+    return Hash;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM digest -- SHA-256 block                                      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+static void FM_DigestShaBlock(FM_Digest_Context_t *Context, const uint8 *BlockPtr)
+{
+    uint32 Schedule[64];
+    uint32 Work[FM_DIGEST_SHA256_WORDS];
+    uint32 Temp1;
+    uint32 Temp2;
+    uint32 t;
+
+    for (t = 0; t < 16; t++)
+    {
+        Schedule[t] = ((uint32)BlockPtr[t * 4] << 24) | ((uint32)BlockPtr[(t * 4) + 1] << 16) |
+                      ((uint32)BlockPtr[(t * 4) + 2] << 8) | (uint32)BlockPtr[(t * 4) + 3];
+    }
+
+    for (t = 16; t < 64; t++)
+    {
+        Temp1 = FM_DigestRotr32(Schedule[t - 15], 7) ^ FM_DigestRotr32(Schedule[t - 15], 18) ^ (Schedule[t - 15] >> 3);
+        Temp2 = FM_DigestRotr32(Schedule[t - 2], 17) ^ FM_DigestRotr32(Schedule[t - 2], 19) ^ (Schedule[t - 2] >> 10);
+
+        Schedule[t] = Schedule[t - 16] + Temp1 + Schedule[t - 7] + Temp2;
+    }
+
+    memcpy(Work, Context->ShaHash, sizeof(Work));
+
+    /* Work[0] to Work[7] are the working variables a to h of FIPS 180-4 */
+    for (t = 0; t < 64; t++)
+    {
+        Temp1 = Work[7] + (FM_DigestRotr32(Work[4], 6) ^ FM_DigestRotr32(Work[4], 11) ^ FM_DigestRotr32(Work[4], 25)) +
+                ((Work[4] & Work[5]) ^ (~Work[4] & Work[6])) + FM_DIGEST_SHA256_K[t] + Schedule[t];
+        Temp2 = (FM_DigestRotr32(Work[0], 2) ^ FM_DigestRotr32(Work[0], 13) ^ FM_DigestRotr32(Work[0], 22)) +
+                ((Work[0] & Work[1]) ^ (Work[0] & Work[2]) ^ (Work[1] & Work[2]));
+
+        Work[7] = Work[6];
+        Work[6] = Work[5];
+        Work[5] = Work[4];
+        Work[4] = Work[3] + Temp1;
+        Work[3] = Work[2];
+        Work[2] = Work[1];
+        Work[1] = Work[0];
+        Work[0] = Temp1 + Temp2;
+    }
+
+    for (t = 0; t < FM_DIGEST_SHA256_WORDS; t++)
+    {
+        Context->ShaHash[t] += Work[t];
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM digest -- SHA-256 padding and result                         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+static void FM_DigestShaFinish(FM_Digest_Context_t *Context, uint8 *Sha256)
+{
+    uint64 BitLength = Context->ShaLength * 8;
+    uint32 i;
+
+    /* Pad with a one bit and zeros up to the length, taking another block if it does not fit */
+    Context->ShaBuffer[Context->ShaBuffered] = 0x80;
+    Context->ShaBuffered++;
+
+    if (Context->ShaBuffered > FM_DIGEST_SHA256_LENGTH_OFFSET)
+    {
+        memset(&Context->ShaBuffer[Context->ShaBuffered], 0, FM_DIGEST_SHA256_BLOCK - Context->ShaBuffered);
+        FM_DigestShaBlock(Context, Context->ShaBuffer);
+        Context->ShaBuffered = 0;
+    }
+
+    memset(&Context->ShaBuffer[Context->ShaBuffered], 0, FM_DIGEST_SHA256_LENGTH_OFFSET - Context->ShaBuffered);
+
+    for (i = 0; i < 8; i++)
+    {
+        Context->ShaBuffer[FM_DIGEST_SHA256_BLOCK - 1 - i] = (uint8)(BitLength >> (i * 8));
+    }
+
+    FM_DigestShaBlock(Context, Context->ShaBuffer);
+    Context->ShaBuffered = 0;
+
+    for (i = 0; i < FM_DIGEST_SHA256_LEN; i++)
+    {
+        Sha256[i] = (uint8)(Context->ShaHash[i / 4] >> (24 - ((i % 4) * 8)));
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM digest -- build the tables                                   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_DigestInit(FM_Digest_State_t *State)
+{
+    uint32 Crc = 0;
+    uint32 Slice;
+    uint32 i;
+    uint32 Bit;
+
+    for (i = 0; i < 256; i++)
+    {
+        Crc = i;
+
+        for (Bit = 0; Bit < 8; Bit++)
+        {
+            if ((Crc & 1) != 0)
+            {
+                Crc = (Crc >> 1) ^ FM_DIGEST_CRC32C_POLY;
+            }
+            else
+            {
+                Crc = Crc >> 1;
+            }
+        }
+
+        State->Table[0][i] = Crc;
+    }
+
+    for (Slice = 1; Slice < FM_DIGEST_SLICES; Slice++)
+    {
+        for (i = 0; i < 256; i++)
+        {
+            Crc = State->Table[Slice - 1][i];
+
+            State->Table[Slice][i] = (Crc >> 8) ^ State->Table[0][Crc & 0xFF];
+        }
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM digest -- start a digest calculation                         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_DigestStart(FM_Digest_Context_t *Context, uint32 Digests)
+{
+    memset(Context, 0, sizeof(*Context));
+
+    Context->Digests = Digests & FM_DIGEST_ALL;
+    Context->Crc32c  = 0xFFFFFFFF;
+
+    /* Accumulators for a seed of zero */
+    Context->XxhAccum[0] = FM_DIGEST_XXH_PRIME1 + FM_DIGEST_XXH_PRIME2;
+    Context->XxhAccum[1] = FM_DIGEST_XXH_PRIME2;
+    Context->XxhAccum[2] = 0;
+    Context->XxhAccum[3] = 0 - FM_DIGEST_XXH_PRIME1;
+
+    memcpy(Context->ShaHash, FM_DIGEST_SHA256_INIT, sizeof(Context->ShaHash));
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM digest -- continue a digest calculation                      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_DigestUpdate(const FM_Digest_State_t *State, FM_Digest_Context_t *Context, const void *DataPtr,
+                     size_t DataLength)
+{
+    if ((Context->Digests & FM_DIGEST_CRC32C) != 0)
+    {
+        Context->Crc32c = FM_DigestCrc32c(State, DataPtr, DataLength, Context->Crc32c);
+    }
+
+    if ((Context->Digests & FM_DIGEST_XXH64) != 0)
+    {
+        Context->XxhLength += DataLength;
+
+        FM_DigestFeed(Context, Context->XxhBuffer, &Context->XxhBuffered, FM_DIGEST_XXH64_STRIPE, DataPtr, DataLength,
+                      FM_DigestXxhStripe);
+    }
+
+    if ((Context->Digests & FM_DIGEST_SHA256) != 0)
+    {
+        Context->ShaLength += DataLength;
+
+        FM_DigestFeed(Context, Context->ShaBuffer, &Context->ShaBuffered, FM_DIGEST_SHA256_BLOCK, DataPtr, DataLength,
+                      FM_DigestShaBlock);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM digest -- finish a digest calculation                        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void FM_DigestFinish(FM_Digest_Context_t *Context, uint32 *Crc32c, uint8 *Xxh64, uint8 *Sha256)
+{
+    uint64 Hash = 0;
+    uint32 i;
+
+    if ((Context->Digests & FM_DIGEST_CRC32C) != 0)
+    {
+        *Crc32c = ~Context->Crc32c;
+    }
+
+    if ((Context->Digests & FM_DIGEST_XXH64) != 0)
+    {
+        Hash = FM_DigestXxhFinish(Context);
+
+        for (i = 0; i < FM_DIGEST_XXH64_LEN; i++)
+        {
+            Xxh64[i] = (uint8)(Hash >> (56 - (i * 8)));
+        }
+    }
+
+    if ((Context->Digests & FM_DIGEST_SHA256) != 0)
+    {
+        FM_DigestShaFinish(Context, Sha256);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM digest -- CRC-32C table kernel                               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+uint32 FM_DigestCrc32c(const FM_Digest_State_t *State, const uint8 *DataPtr, size_t DataLength, uint32 Crc)
+{
+    const uint8 *BufPtr = DataPtr;
+    size_t       Length = DataLength;
+
+    /* The eight lookups of a step do not depend on each other */
+    while (Length >= FM_DIGEST_SLICES)
+    {
+        Crc ^= FM_DigestLoad32(BufPtr);
+
+        Crc = State->Table[7][Crc & 0xFF] ^ State->Table[6][(Crc >> 8) & 0xFF] ^ State->Table[5][(Crc >> 16) & 0xFF] ^
+              State->Table[4][Crc >> 24] ^ State->Table[3][BufPtr[4]] ^ State->Table[2][BufPtr[5]] ^
+              State->Table[1][BufPtr[6]] ^ State->Table[0][BufPtr[7]];
+
+        BufPtr += FM_DIGEST_SLICES;
+        Length -= FM_DIGEST_SLICES;
+    }
+
+    while (Length > 0)
+    {
+        Crc = (Crc >> 8) ^ State->Table[0][(Crc ^ *BufPtr) & 0xFF];
+
+        BufPtr++;
+        Length--;
+    }
+
+    return Crc;
+}
@@ -0,0 +1,131 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,918-1, and identified as “Core Flight
+ * Software System (cFS) File Manager Application Version 2.6.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   FM internal file digest API.  Each block read from a file is passed to
+ *   every digest selected by a get file digest command, so any set of
+ *   digests costs a single read of the file.
+ */
+
+#ifndef FM_DIGEST_H
+#define FM_DIGEST_H
+
+#include <common_types.h>
+
+#include "cfe.h"
+#include "fm_extern_typedefs.h"
+
+#define FM_DIGEST_SLICES       8  /**< \brief Bytes consumed by each step of the CRC-32C kernel */
+#define FM_DIGEST_XXH64_STRIPE 32 /**< \brief Bytes consumed by each step of xxHash64 */
+#define FM_DIGEST_XXH64_ACCUMS 4  /**< \brief 64 bit accumulators in the xxHash64 state */
+#define FM_DIGEST_SHA256_BLOCK 64 /**< \brief Bytes in a SHA-256 message block */
+#define FM_DIGEST_SHA256_WORDS 8  /**< \brief 32 bit words in the SHA-256 hash state */
+
+/**
+ * @brief The state object shared by every digest calculation
+ *
+ * Table[0] is the byte-at-a-time CRC-32C table.  Table[n] gives the CRC
+ * of a byte followed by n zero bytes, which lets one step of the kernel
+ * consume #FM_DIGEST_SLICES bytes with independent lookups.
+ */
+typedef struct
+{
+    uint32 Table[FM_DIGEST_SLICES][256]; /**< \brief CRC-32C kernel lookup tables */
+} FM_Digest_State_t;
+
+/**
+ * @brief The context of one file digest calculation
+ *
+ * Bytes that do not yet fill an xxHash64 stripe or a SHA-256 block are
+ * held until the next update, so blocks of any length may be passed in.
+ */
+typedef struct
+{
+    uint32 Digests; /**< \brief Digests being computed (FM_DIGEST_xxx bits) */
+
+    uint32 Crc32c; /**< \brief CRC-32C so far, before the final inversion */
+
+    uint64 XxhAccum[FM_DIGEST_XXH64_ACCUMS];  /**< \brief xxHash64 stripe accumulators */
+    uint64 XxhLength;                         /**< \brief Bytes passed to xxHash64 */
+    uint8  XxhBuffer[FM_DIGEST_XXH64_STRIPE]; /**< \brief Bytes not yet making up a stripe */
+    uint32 XxhBuffered;                       /**< \brief Bytes in XxhBuffer */
+
+    uint32 ShaHash[FM_DIGEST_SHA256_WORDS];   /**< \brief SHA-256 intermediate hash value */
+    uint64 ShaLength;                         /**< \brief Bytes passed to SHA-256 */
+    uint8  ShaBuffer[FM_DIGEST_SHA256_BLOCK]; /**< \brief Bytes not yet making up a block */
+    uint32 ShaBuffered;                       /**< \brief Bytes in ShaBuffer */
+} FM_Digest_Context_t;
+
+/**
+ * @brief Initialize the digest kernels
+ *
+ * Builds the CRC-32C lookup tables.
+ *
+ * @param State the digest state object
+ */
+void FM_DigestInit(FM_Digest_State_t *State);
+
+/**
+ * @brief Start a digest calculation
+ *
+ * @param Context the context of the calculation
+ * @param Digests the digests to compute (FM_DIGEST_xxx bits), others are ignored
+ */
+void FM_DigestStart(FM_Digest_Context_t *Context, uint32 Digests);
+
+/**
+ * @brief Continue a digest calculation
+ *
+ * Passes the data to each digest being computed.
+ *
+ * @param State      the digest state object
+ * @param Context    the context of the calculation
+ * @param DataPtr    the next bytes of the file
+ * @param DataLength the number of bytes
+ */
+void FM_DigestUpdate(const FM_Digest_State_t *State, FM_Digest_Context_t *Context, const void *DataPtr,
+                     size_t DataLength);
+
+/**
+ * @brief Finish a digest calculation
+ *
+ * Outputs of digests that were not computed are left unchanged.  The
+ * xxHash64 and SHA-256 values are written most significant byte first.
+ *
+ * @param Context the context of the calculation, left finished
+ * @param Crc32c  the CRC-32C of the data
+ * @param Xxh64   the #FM_DIGEST_XXH64_LEN byte xxHash64 of the data, seed zero
+ * @param Sha256  the #FM_DIGEST_SHA256_LEN byte SHA-256 of the data
+ */
+void FM_DigestFinish(FM_Digest_Context_t *Context, uint32 *Crc32c, uint8 *Xxh64, uint8 *Sha256);
+
+/**
+ * @brief CRC-32C table kernel
+ *
+ * @param State      the digest state object
+ * @param DataPtr    the data
+ * @param DataLength the number of bytes
+ * @param Crc        the CRC so far, before the final inversion
+ *
+ * @returns the CRC including the data, before the final inversion
+ */
+uint32 FM_DigestCrc32c(const FM_Digest_State_t *State, const uint8 *DataPtr, size_t DataLength, uint32 Crc);
+
+#endif
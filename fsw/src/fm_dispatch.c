@@ -36,6 +36,7 @@
 #include "fm_msgids.h"
 #include "fm_events.h"
 #include "fm_cmds.h"
+#include "fm_cmd_utils.h"
 #include "fm_app.h"
 
 #include "cfe.h"
@@ -381,6 +382,247 @@ bool FM_SetPermissionsVerifyDispatch(const CFE_SB_Buffer_t *BufPtr)
     return FM_SetPermissionsCmd(BufPtr);
 }
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM command handler -- Set Copy Block Size                       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_SetCopyBlockSizeVerifyDispatch(const CFE_SB_Buffer_t *BufPtr)
+{
+    /* Verify command packet length */
+    if (!FM_IsValidCmdPktLength(&BufPtr->Msg, sizeof(FM_SetCopyBlockSizeCmd_t), FM_SET_COPY_BLOCK_PKT_ERR_EID,
+                                "Set Copy Block Size"))
+    {
+        return false;
+    }
+
+    return FM_SetCopyBlockSizeCmd(BufPtr);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM command handler -- Concatenate List of Files                 */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_ConcatListVerifyDispatch(const CFE_SB_Buffer_t *BufPtr)
+{
+    /* Verify command packet length */
+    if (!FM_IsValidCmdPktLength(&BufPtr->Msg, sizeof(FM_ConcatListCmd_t), FM_CONCAT_LIST_PKT_ERR_EID, "Concat List"))
+    {
+        return false;
+    }
+
+    return FM_ConcatListCmd(BufPtr);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM command handler -- Set Throttle                              */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_SetThrottleVerifyDispatch(const CFE_SB_Buffer_t *BufPtr)
+{
+    /* Verify command packet length */
+    if (!FM_IsValidCmdPktLength(&BufPtr->Msg, sizeof(FM_SetThrottleCmd_t), FM_SET_THROTTLE_PKT_ERR_EID,
+                                "Set Throttle"))
+    {
+        return false;
+    }
+
+    return FM_SetThrottleCmd(BufPtr);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM command handler -- Abort Child Task Command                  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_AbortVerifyDispatch(const CFE_SB_Buffer_t *BufPtr)
+{
+    /* Verify command packet length */
+    if (!FM_IsValidCmdPktLength(&BufPtr->Msg, sizeof(FM_AbortCmd_t), FM_ABORT_PKT_ERR_EID, "Abort"))
+    {
+        return false;
+    }
+
+    return FM_AbortCmd(BufPtr);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM command handler -- Flush Child Task Queue                    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_FlushQueueVerifyDispatch(const CFE_SB_Buffer_t *BufPtr)
+{
+    /* Verify command packet length */
+    if (!FM_IsValidCmdPktLength(&BufPtr->Msg, sizeof(FM_FlushQueueCmd_t), FM_FLUSH_QUEUE_PKT_ERR_EID, "Flush Queue"))
+    {
+        return false;
+    }
+
+    return FM_FlushQueueCmd(BufPtr);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM command handler -- Send Command Latency Histograms           */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_SendLatencyVerifyDispatch(const CFE_SB_Buffer_t *BufPtr)
+{
+    /* Verify command packet length */
+    if (!FM_IsValidCmdPktLength(&BufPtr->Msg, sizeof(FM_SendLatencyCmd_t), FM_SEND_LATENCY_PKT_ERR_EID,
+                                "Send Latency"))
+    {
+        return false;
+    }
+
+    return FM_SendLatencyCmd(BufPtr);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM command handler -- Reset Command Latency Histograms          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_ResetLatencyVerifyDispatch(const CFE_SB_Buffer_t *BufPtr)
+{
+    /* Verify command packet length */
+    if (!FM_IsValidCmdPktLength(&BufPtr->Msg, sizeof(FM_ResetLatencyCmd_t), FM_RESET_LATENCY_PKT_ERR_EID,
+                                "Reset Latency"))
+    {
+        return false;
+    }
+
+    return FM_ResetLatencyCmd(BufPtr);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM command handler -- Set Verify Mode                           */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_SetVerifyModeVerifyDispatch(const CFE_SB_Buffer_t *BufPtr)
+{
+    /* Verify command packet length */
+    if (!FM_IsValidCmdPktLength(&BufPtr->Msg, sizeof(FM_SetVerifyModeCmd_t), FM_SET_VERIFY_MODE_PKT_ERR_EID,
+                                "Set Verify Mode"))
+    {
+        return false;
+    }
+
+    return FM_SetVerifyModeCmd(BufPtr);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM command handler -- Delete Directory Tree                     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_DeleteTreeVerifyDispatch(const CFE_SB_Buffer_t *BufPtr)
+{
+    /* Verify command packet length */
+    if (!FM_IsValidCmdPktLength(&BufPtr->Msg, sizeof(FM_DeleteTreeCmd_t), FM_DELETE_TREE_PKT_ERR_EID,
+                                "Delete Directory Tree"))
+    {
+        return false;
+    }
+
+    return FM_DeleteTreeCmd(BufPtr);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM command handler -- Filter Files                              */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_FilterFilesVerifyDispatch(const CFE_SB_Buffer_t *BufPtr)
+{
+    /* Verify command packet length */
+    if (!FM_IsValidCmdPktLength(&BufPtr->Msg, sizeof(FM_FilterFilesCmd_t), FM_FILTER_FILES_PKT_ERR_EID, "Filter Files"))
+    {
+        return false;
+    }
+
+    return FM_FilterFilesCmd(BufPtr);
+}
+
+bool FM_EnforceRetentionVerifyDispatch(const CFE_SB_Buffer_t *BufPtr)
+{
+    /* Verify command packet length */
+    if (!FM_IsValidCmdPktLength(&BufPtr->Msg, sizeof(FM_EnforceRetentionCmd_t), FM_ENFORCE_RETENTION_PKT_ERR_EID,
+                                "Enforce Retention"))
+    {
+        return false;
+    }
+
+    return FM_EnforceRetentionCmd(BufPtr);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM command handler -- Set Delete Mode                           */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_SetDeleteModeVerifyDispatch(const CFE_SB_Buffer_t *BufPtr)
+{
+    /* Verify command packet length */
+    if (!FM_IsValidCmdPktLength(&BufPtr->Msg, sizeof(FM_SetDeleteModeCmd_t), FM_SET_DELETE_MODE_PKT_ERR_EID,
+                                "Set Delete Mode"))
+    {
+        return false;
+    }
+
+    return FM_SetDeleteModeCmd(BufPtr);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM command handler -- Purge Trash                               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_PurgeTrashVerifyDispatch(const CFE_SB_Buffer_t *BufPtr)
+{
+    /* Verify command packet length */
+    if (!FM_IsValidCmdPktLength(&BufPtr->Msg, sizeof(FM_PurgeTrashCmd_t), FM_PURGE_TRASH_PKT_ERR_EID, "Purge Trash"))
+    {
+        return false;
+    }
+
+    return FM_PurgeTrashCmd(BufPtr);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM command handler -- Get File Digest                           */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool FM_GetFileDigestVerifyDispatch(const CFE_SB_Buffer_t *BufPtr)
+{
+    /* Verify command packet length */
+    if (!FM_IsValidCmdPktLength(&BufPtr->Msg, sizeof(FM_GetFileDigestCmd_t), FM_GET_FILE_DIGEST_PKT_ERR_EID,
+                                "Get File Digest"))
+    {
+        return false;
+    }
+
+    return FM_GetFileDigestCmd(BufPtr);
+}
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* FM command handler -- Send Housekeeping                         */
@@ -439,9 +681,16 @@ void FM_ProcessCmd(const CFE_SB_Buffer_t *BufPtr)
 {
     bool              Result;
     CFE_MSG_FcnCode_t CommandCode = 0;
+    OS_time_t         StartTime;
+    OS_time_t         EndTime;
 
     CFE_MSG_GetFcnCode(&BufPtr->Msg, &CommandCode);
 
+    OS_GetLocalTime(&StartTime);
+
+    /* Each command takes its own snapshot of the open files */
+    FM_GlobalData.OpenPaths.Valid = false;
+
     /* Invoke specific command handler */
     switch (CommandCode)
     {
@@ -517,6 +766,62 @@ void FM_ProcessCmd(const CFE_SB_Buffer_t *BufPtr)
             Result = FM_SetPermissionsVerifyDispatch(BufPtr);
             break;
 
+        case FM_SET_COPY_BLOCK_SIZE_CC:
+            Result = FM_SetCopyBlockSizeVerifyDispatch(BufPtr);
+            break;
+
+        case FM_CONCAT_LIST_CC:
+            Result = FM_ConcatListVerifyDispatch(BufPtr);
+            break;
+
+        case FM_SET_THROTTLE_CC:
+            Result = FM_SetThrottleVerifyDispatch(BufPtr);
+            break;
+
+        case FM_ABORT_CC:
+            Result = FM_AbortVerifyDispatch(BufPtr);
+            break;
+
+        case FM_FLUSH_QUEUE_CC:
+            Result = FM_FlushQueueVerifyDispatch(BufPtr);
+            break;
+
+        case FM_SEND_LATENCY_CC:
+            Result = FM_SendLatencyVerifyDispatch(BufPtr);
+            break;
+
+        case FM_RESET_LATENCY_CC:
+            Result = FM_ResetLatencyVerifyDispatch(BufPtr);
+            break;
+
+        case FM_SET_VERIFY_MODE_CC:
+            Result = FM_SetVerifyModeVerifyDispatch(BufPtr);
+            break;
+
+        case FM_DELETE_TREE_CC:
+            Result = FM_DeleteTreeVerifyDispatch(BufPtr);
+            break;
+
+        case FM_FILTER_FILES_CC:
+            Result = FM_FilterFilesVerifyDispatch(BufPtr);
+            break;
+
+        case FM_ENFORCE_RETENTION_CC:
+            Result = FM_EnforceRetentionVerifyDispatch(BufPtr);
+            break;
+
+        case FM_SET_DELETE_MODE_CC:
+            Result = FM_SetDeleteModeVerifyDispatch(BufPtr);
+            break;
+
+        case FM_PURGE_TRASH_CC:
+            Result = FM_PurgeTrashVerifyDispatch(BufPtr);
+            break;
+
+        case FM_GET_FILE_DIGEST_CC:
+            Result = FM_GetFileDigestVerifyDispatch(BufPtr);
+            break;
+
         default:
             Result = false;
             CFE_EVS_SendEvent(FM_CC_ERR_EID, CFE_EVS_EventType_ERROR, "Main loop error: invalid command code: cc = %d",
@@ -524,6 +829,10 @@ void FM_ProcessCmd(const CFE_SB_Buffer_t *BufPtr)
             break;
     }
 
+    /* Verify time includes execution for commands that do not use the child task */
+    OS_GetLocalTime(&EndTime);
+    FM_RecordLatency(FM_GlobalData.Latency.Verify, CommandCode, StartTime, EndTime);
+
     if (Result)
     {
         /* Increment command success counter */
@@ -98,6 +98,20 @@ bool FM_GetDirListPktVerifyDispatch(const CFE_SB_Buffer_t *BufPtr);
 bool FM_MonitorFilesystemSpaceVerifyDispatch(const CFE_SB_Buffer_t *BufPtr);
 bool FM_SetTableStateVerifyDispatch(const CFE_SB_Buffer_t *BufPtr);
 bool FM_SetPermissionsVerifyDispatch(const CFE_SB_Buffer_t *BufPtr);
+bool FM_SetCopyBlockSizeVerifyDispatch(const CFE_SB_Buffer_t *BufPtr);
+bool FM_ConcatListVerifyDispatch(const CFE_SB_Buffer_t *BufPtr);
+bool FM_SetThrottleVerifyDispatch(const CFE_SB_Buffer_t *BufPtr);
+bool FM_AbortVerifyDispatch(const CFE_SB_Buffer_t *BufPtr);
+bool FM_FlushQueueVerifyDispatch(const CFE_SB_Buffer_t *BufPtr);
+bool FM_SendLatencyVerifyDispatch(const CFE_SB_Buffer_t *BufPtr);
+bool FM_ResetLatencyVerifyDispatch(const CFE_SB_Buffer_t *BufPtr);
+bool FM_SetVerifyModeVerifyDispatch(const CFE_SB_Buffer_t *BufPtr);
+bool FM_DeleteTreeVerifyDispatch(const CFE_SB_Buffer_t *BufPtr);
+bool FM_FilterFilesVerifyDispatch(const CFE_SB_Buffer_t *BufPtr);
+bool FM_EnforceRetentionVerifyDispatch(const CFE_SB_Buffer_t *BufPtr);
+bool FM_SetDeleteModeVerifyDispatch(const CFE_SB_Buffer_t *BufPtr);
+bool FM_PurgeTrashVerifyDispatch(const CFE_SB_Buffer_t *BufPtr);
+bool FM_GetFileDigestVerifyDispatch(const CFE_SB_Buffer_t *BufPtr);
 void FM_SendHkVerifyDispatch(const CFE_SB_Buffer_t *BufPtr);
 
 #endif
@@ -0,0 +1,99 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,918-1, and identified as “Core Flight
+ * Software System (cFS) File Manager Application Version 2.6.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   FM internal kernel copy API.  These functions may be unimplemented, or
+ *   they may map to operating system calls that copy file data without
+ *   passing it through a child task buffer.  The implementation is chosen
+ *   at build time, in the same way as the compression adapter.
+ */
+
+#ifndef FM_KERNEL_COPY_H
+#define FM_KERNEL_COPY_H
+
+#include <common_types.h>
+#include <fm_platform_cfg.h>
+
+#include "cfe.h"
+
+/**
+ * \name Kernel copy methods
+ * \{
+ */
+#define FM_KERNEL_COPY_NONE       0 /**< \brief Kernel copy is not open */
+#define FM_KERNEL_COPY_FILE_RANGE 1 /**< \brief Data is copied with copy_file_range */
+#define FM_KERNEL_COPY_SENDFILE   2 /**< \brief Data is copied with sendfile */
+/**\}*/
+
+/**
+ * @brief The state object for a kernel copy
+ *
+ * The handles are native file descriptors owned by the selected
+ * implementation, they are not OSAL object IDs.
+ */
+typedef struct
+{
+    int32  SrcHandle;   /**< \brief Native source file handle */
+    int32  TgtHandle;   /**< \brief Native target file handle */
+    uint32 Method;      /**< \brief Kernel copy method in use (FM_KERNEL_COPY_xxx) */
+    uint32 Spare;       /**< \brief Structure alignment spare */
+    uint64 BytesCopied; /**< \brief Bytes copied since the files were opened */
+} FM_KernelCopy_State_t;
+
+/**
+ * @brief Open the files of a kernel copy
+ *
+ * Opens the source file for reading.  The target file is created or
+ * truncated, or with Append set it must exist and data is added at its end.
+ *
+ * @param State the kernel copy state object
+ * @param SrcFileName the source file (OSAL virtual path)
+ * @param DstFileName the target file (OSAL virtual path)
+ * @param Append set to add data at the end of an existing target file
+ *
+ * @returns Status code
+ * @retval #CFE_SUCCESS if both files are open
+ * @retval #CFE_STATUS_NOT_IMPLEMENTED if the caller must copy the data itself
+ */
+CFE_Status_t FM_KernelCopy_Open(FM_KernelCopy_State_t *State, const char *SrcFileName, const char *DstFileName,
+                                bool Append);
+
+/**
+ * @brief Copy the next chunk of a kernel copy
+ *
+ * @param State the kernel copy state object
+ * @param Length the largest number of bytes to copy
+ *
+ * @returns Bytes copied, or status code
+ * @retval 0 at the end of the source file
+ * @retval #CFE_STATUS_NOT_IMPLEMENTED if no method works for these files and
+ *         nothing has been copied yet, the caller must copy the data itself
+ * @retval #OS_ERROR if the copy failed
+ */
+int32 FM_KernelCopy_Chunk(FM_KernelCopy_State_t *State, uint32 Length);
+
+/**
+ * @brief Close the files of a kernel copy
+ *
+ * @param State the kernel copy state object
+ */
+void FM_KernelCopy_Close(FM_KernelCopy_State_t *State);
+
+#endif
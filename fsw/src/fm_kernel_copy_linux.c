@@ -0,0 +1,151 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,918-1, and identified as “Core Flight
+ * Software System (cFS) File Manager Application Version 2.6.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *  File Manager (FM) Linux kernel copy API
+ *
+ * This copies file data inside the kernel with copy_file_range, falling back
+ * to sendfile when the two files do not support it (for example on older
+ * kernels or across file systems).  If neither call works for the files,
+ * the child task copies the data through its own buffers.  For use with the
+ * POSIX OSAL only, since the OSAL paths are translated to host paths.  The
+ * files are opened outside of OSAL, so the child task records their names
+ * for the FM open file checks while the copy runs.
+ */
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE /* copy_file_range */
+#endif
+
+#include <common_types.h>
+#include <cfe_error.h>
+#include <osapi.h>
+
+#include "fm_kernel_copy.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/sendfile.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+
+CFE_Status_t FM_KernelCopy_Open(FM_KernelCopy_State_t *State, const char *SrcFileName, const char *DstFileName,
+                                bool Append)
+{
+    char LocalSrc[OS_MAX_LOCAL_PATH_LEN];
+    char LocalDst[OS_MAX_LOCAL_PATH_LEN];
+
+    memset(State, 0, sizeof(*State));
+    State->SrcHandle = -1;
+    State->TgtHandle = -1;
+
+    /* Any failure here is reported by the buffered copy that follows */
+    if ((OS_TranslatePath(SrcFileName, LocalSrc) != OS_SUCCESS) ||
+        (OS_TranslatePath(DstFileName, LocalDst) != OS_SUCCESS))
+    {
+        return CFE_STATUS_NOT_IMPLEMENTED;
+    }
+
+    State->SrcHandle = open(LocalSrc, O_RDONLY);
+
+    if (State->SrcHandle >= 0)
+    {
+        if (Append)
+        {
+            /* copy_file_range rejects O_APPEND targets, seek to the end instead */
+            State->TgtHandle = open(LocalDst, O_WRONLY);
+
+            if ((State->TgtHandle >= 0) && (lseek(State->TgtHandle, 0, SEEK_END) < 0))
+            {
+                close(State->TgtHandle);
+                State->TgtHandle = -1;
+            }
+        }
+        else
+        {
+            State->TgtHandle = open(LocalDst, O_WRONLY | O_CREAT | O_TRUNC, 0666);
+        }
+    }
+
+    if (State->TgtHandle < 0)
+    {
+        FM_KernelCopy_Close(State);
+        return CFE_STATUS_NOT_IMPLEMENTED;
+    }
+
+    State->Method = FM_KERNEL_COPY_FILE_RANGE;
+
+    return CFE_SUCCESS;
+}
+
+int32 FM_KernelCopy_Chunk(FM_KernelCopy_State_t *State, uint32 Length)
+{
+    ssize_t Result = -1;
+
+    if (State->Method == FM_KERNEL_COPY_FILE_RANGE)
+    {
+        Result = copy_file_range(State->SrcHandle, NULL, State->TgtHandle, NULL, Length, 0);
+
+        /* Not supported for these files, use sendfile unless data was already copied */
+        if ((Result < 0) && (State->BytesCopied == 0) &&
+            ((errno == ENOSYS) || (errno == EXDEV) || (errno == EINVAL) || (errno == EOPNOTSUPP)))
+        {
+            State->Method = FM_KERNEL_COPY_SENDFILE;
+        }
+    }
+
+    if (State->Method == FM_KERNEL_COPY_SENDFILE)
+    {
+        Result = sendfile(State->TgtHandle, State->SrcHandle, NULL, Length);
+
+        if ((Result < 0) && (State->BytesCopied == 0) && ((errno == ENOSYS) || (errno == EINVAL)))
+        {
+            return CFE_STATUS_NOT_IMPLEMENTED;
+        }
+    }
+
+    if (Result < 0)
+    {
+        return OS_ERROR;
+    }
+
+    State->BytesCopied += Result;
+
+    return (int32)Result;
+}
+
+void FM_KernelCopy_Close(FM_KernelCopy_State_t *State)
+{
+    if (State->TgtHandle >= 0)
+    {
+        close(State->TgtHandle);
+        State->TgtHandle = -1;
+    }
+
+    if (State->SrcHandle >= 0)
+    {
+        close(State->SrcHandle);
+        State->SrcHandle = -1;
+    }
+
+    State->Method = FM_KERNEL_COPY_NONE;
+}
@@ -22,7 +22,8 @@
  *  File Manager (FM) Application Table Definitions
  *
  *  Provides functions for the initialization, validation, and
- *  management of the FM File System Free Space Table
+ *  management of the FM File System Free Space Table and the FM
+ *  Retention Table
  */
 
 #include "fm_platform_cfg.h"
@@ -42,18 +43,28 @@ CFE_Status_t FM_TableInit(void)
 {
     CFE_Status_t Status;
 
-    /* Initialize file system free space table pointer */
-    FM_GlobalData.MonitorTablePtr = NULL;
+    /* Initialize file system free space and retention table pointers */
+    FM_GlobalData.MonitorTablePtr   = NULL;
+    FM_GlobalData.RetentionTablePtr = NULL;
 
     /* Register the file system free space table - this must succeed! */
     Status = CFE_TBL_Register(&FM_GlobalData.MonitorTableHandle, FM_TABLE_CFE_NAME, sizeof(FM_MonitorTable_t),
                               (CFE_TBL_OPT_SNGL_BUFFER | CFE_TBL_OPT_LOAD_DUMP),
                               (CFE_TBL_CallbackFuncPtr_t)FM_ValidateTable);
 
+    if (Status == CFE_SUCCESS)
+    {
+        /* Register the retention table - this must succeed as well */
+        Status = CFE_TBL_Register(&FM_GlobalData.RetentionTableHandle, FM_RETENTION_TABLE_CFE_NAME,
+                                  sizeof(FM_RetentionTable_t), (CFE_TBL_OPT_SNGL_BUFFER | CFE_TBL_OPT_LOAD_DUMP),
+                                  (CFE_TBL_CallbackFuncPtr_t)FM_ValidateRetentionTable);
+    }
+
     if (Status == CFE_SUCCESS)
     {
         /* Make an attempt to load the default table data - OK if this fails */
         CFE_TBL_Load(FM_GlobalData.MonitorTableHandle, CFE_TBL_SRC_FILE, FM_TABLE_DEF_NAME);
+        CFE_TBL_Load(FM_GlobalData.RetentionTableHandle, CFE_TBL_SRC_FILE, FM_RETENTION_TABLE_DEF_NAME);
 
         /* Allow cFE a chance to dump, update, etc. */
         FM_AcquireTablePointers();
@@ -183,6 +194,125 @@ CFE_Status_t FM_ValidateTable(FM_MonitorTable_t *TablePtr)
     return Result;
 }
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM table function -- retention table data verification          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+CFE_Status_t FM_ValidateRetentionTable(FM_RetentionTable_t *TablePtr)
+{
+    CFE_Status_t Result  = CFE_SUCCESS;
+    const char * Problem = NULL;
+    int32        i       = 0;
+    int32        j       = 0;
+
+    int32 CountGood   = 0;
+    int32 CountBad    = 0;
+    int32 CountUnused = 0;
+
+    FM_RetentionTableEntry_t *EntryPtr;
+
+    /* Verify the table pointer is valid */
+    if (TablePtr == NULL)
+    {
+        CFE_EVS_SendEvent(FM_RETENTION_TABLE_VERIFY_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Retention Table verify error - null pointer detected");
+
+        return FM_TABLE_VALIDATION_ERR;
+    }
+
+    /*
+    ** Retention table data verification
+    **
+    ** -- entries with an empty directory name are unused and must be disabled
+    **
+    ** -- other entries must have a terminated directory name, a valid
+    **    state and order, a non-zero interval and at least one limit
+    **
+    ** -- priority patterns must be terminated, empty patterns are skipped
+    */
+    EntryPtr = TablePtr->Entries;
+    for (i = 0; i < FM_RETENTION_ENTRY_COUNT; i++)
+    {
+        Problem = NULL;
+
+        if (EntryPtr->Directory[0] == '\0')
+        {
+            if (EntryPtr->Enabled != FM_TABLE_ENTRY_DISABLED)
+            {
+                Problem = "enabled entry has no directory";
+            }
+            else
+            {
+                /* Ignore (but count) unused table entries */
+                CountUnused++;
+            }
+        }
+        else if (memchr(EntryPtr->Directory, '\0', sizeof(EntryPtr->Directory)) == NULL)
+        {
+            Problem = "directory name too long";
+        }
+        else if ((EntryPtr->Enabled != FM_TABLE_ENTRY_ENABLED) && (EntryPtr->Enabled != FM_TABLE_ENTRY_DISABLED))
+        {
+            Problem = "invalid state";
+        }
+        else if ((EntryPtr->Order != FM_RETENTION_ORDER_OLDEST) && (EntryPtr->Order != FM_RETENTION_ORDER_PRIORITY))
+        {
+            Problem = "invalid order";
+        }
+        else if (EntryPtr->Interval == 0)
+        {
+            Problem = "interval is zero";
+        }
+        else if ((EntryPtr->MaxBytes == 0) && (EntryPtr->MaxFiles == 0))
+        {
+            Problem = "no limit set";
+        }
+        else
+        {
+            for (j = 0; j < FM_RETENTION_PATTERN_COUNT; j++)
+            {
+                if (memchr(EntryPtr->Priority[j], '\0', sizeof(EntryPtr->Priority[j])) == NULL)
+                {
+                    Problem = "priority pattern too long";
+                }
+            }
+        }
+
+        if (Problem != NULL)
+        {
+            CountBad++;
+
+            /* Send event describing first error only*/
+            if (CountBad == 1)
+            {
+                CFE_EVS_SendEvent(FM_RETENTION_TABLE_VERIFY_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "Retention Table verify error: index = %d, %s", (int)i, Problem);
+            }
+        }
+        else if (EntryPtr->Directory[0] != '\0')
+        {
+            /* Maintain count of good in-use table entries */
+            CountGood++;
+        }
+
+        ++EntryPtr;
+    }
+
+    /* Display verify results */
+    CFE_EVS_SendEvent(FM_RETENTION_TABLE_VERIFY_EID, CFE_EVS_EventType_INFORMATION,
+                      "Retention Table verify results: good entries = %d, bad = %d, unused = %d", (int)CountGood,
+                      (int)CountBad, (int)CountUnused);
+
+    if (CountBad != 0)
+    {
+        Result = FM_TABLE_VALIDATION_ERR;
+    }
+
+    return Result;
+}
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* FM table function -- acquire table data pointer                 */
@@ -204,6 +334,16 @@ void FM_AcquireTablePointers(void)
         /* Make sure we don't try to use the empty table buffer */
         FM_GlobalData.MonitorTablePtr = NULL;
     }
+
+    /* Same again for the retention table */
+    CFE_TBL_Manage(FM_GlobalData.RetentionTableHandle);
+
+    Status = CFE_TBL_GetAddress((void *)&FM_GlobalData.RetentionTablePtr, FM_GlobalData.RetentionTableHandle);
+
+    if (Status == CFE_TBL_ERR_NEVER_LOADED)
+    {
+        FM_GlobalData.RetentionTablePtr = NULL;
+    }
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
@@ -217,6 +357,10 @@ void FM_ReleaseTablePointers(void)
     /* Release pointer to file system free space table */
     CFE_TBL_ReleaseAddress(FM_GlobalData.MonitorTableHandle);
 
+    /* Release pointer to retention table */
+    CFE_TBL_ReleaseAddress(FM_GlobalData.RetentionTableHandle);
+
     /* Prevent table pointer use while released */
-    FM_GlobalData.MonitorTablePtr = NULL;
+    FM_GlobalData.MonitorTablePtr   = NULL;
+    FM_GlobalData.RetentionTablePtr = NULL;
 }
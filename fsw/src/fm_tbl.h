@@ -40,7 +40,8 @@
  *       This function is invoked during FM application startup initialization to
  *       create and initialize the FM file system free space table.  The purpose
  *       for the table is to define the list of file systems for which free space
- *       must be reported.
+ *       must be reported.  The FM retention table, which lists the directories
+ *       FM holds under size limits, is created and initialized the same way.
  *
  *  \par Assumptions, External Events, and Notes:
  *
@@ -72,6 +73,27 @@ CFE_Status_t FM_TableInit(void);
  */
 CFE_Status_t FM_ValidateTable(FM_MonitorTable_t *TablePtr);
 
+/**
+ *  \brief Retention Table Verification Function
+ *
+ *  \par Description
+ *       This function is called from the CFE Table Services as part of the
+ *       initial table load, and later in response to a Table Validate
+ *       command.  The function verifies that the table data is acceptable
+ *       to populate the FM retention table.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *
+ *  \param [in]  TablePtr - Pointer to table data for verification.
+ *
+ *  \return Validation status
+ *  \retval #CFE_SUCCESS             \copydoc CFE_SUCCESS
+ *  \retval #FM_TABLE_VALIDATION_ERR \copybrief FM_TABLE_VALIDATION_ERR
+ *
+ *  \sa /FM_AppInit
+ */
+CFE_Status_t FM_ValidateRetentionTable(FM_RetentionTable_t *TablePtr);
+
 /**
  *  \brief Acquire Table Data Pointer Function
  *
@@ -79,7 +101,8 @@ CFE_Status_t FM_ValidateTable(FM_MonitorTable_t *TablePtr);
  *       This function is invoked to acquire a pointer to the FM file system free
  *       space table data.  The pointer is maintained in the FM global data
  *       structure.  Note that the table data pointer will be set to NULL if the
- *       table has not yet been successfully loaded.
+ *       table has not yet been successfully loaded.  The retention table data
+ *       pointer is acquired the same way.
  *
  *  \par Assumptions, External Events, and Notes:
  *
@@ -93,7 +116,8 @@ void FM_AcquireTablePointers(void);
  *  \par Description
  *       This function is invoked to release the pointer to the FM file system free
  *       space table data.  The pointer is maintained in the FM global data
- *       structure.  The table data pointer must be periodically released to allow
+ *       structure, along with the retention table data pointer, which is released
+ *       as well.  The table data pointer must be periodically released to allow
  *       CFE Table Services an opportunity to load or dump the table without risk
  *       of interfering with users of the table data.
  *
@@ -92,6 +92,15 @@
 #error FM_DIR_LIST_PKT_ENTRIES cannot be greater than 100
 #endif
 
+/* Number of inline source names in concat list command packet */
+#ifndef FM_CONCAT_LIST_INLINE_MAX
+#error FM_CONCAT_LIST_INLINE_MAX must be defined!
+#elif FM_CONCAT_LIST_INLINE_MAX < 2
+#error FM_CONCAT_LIST_INLINE_MAX cannot be less than 2
+#elif FM_CONCAT_LIST_INLINE_MAX > 32
+#error FM_CONCAT_LIST_INLINE_MAX cannot be greater than 32
+#endif
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* FM platform configuration parameters - child task definitions   */
@@ -107,20 +116,81 @@
 #error FM_CHILD_FILE_BLOCK_SIZE cannot be greater than 32K
 #endif
 
-/* Number of file blocks between task delays */
-#ifndef FM_CHILD_FILE_LOOP_COUNT
-#error FM_CHILD_FILE_LOOP_COUNT must be defined!
-#elif FM_CHILD_FILE_LOOP_COUNT < 1
-#error FM_CHILD_FILE_LOOP_COUNT cannot be less than 1
+/* Default child task data rate */
+#ifndef FM_CHILD_THROTTLE_BYTE_RATE
+#error FM_CHILD_THROTTLE_BYTE_RATE must be defined!
+#elif (FM_CHILD_THROTTLE_BYTE_RATE != 0) && (FM_CHILD_THROTTLE_BYTE_RATE < FM_CHILD_FILE_BLOCK_SIZE)
+#error FM_CHILD_THROTTLE_BYTE_RATE must be zero or no less than FM_CHILD_FILE_BLOCK_SIZE
+#endif
+
+/* Default child task OS_stat rate */
+#ifndef FM_CHILD_THROTTLE_STAT_RATE
+#error FM_CHILD_THROTTLE_STAT_RATE must be defined!
+#elif FM_CHILD_THROTTLE_STAT_RATE < 0
+#error FM_CHILD_THROTTLE_STAT_RATE cannot be less than zero
+#endif
+
+/* Depth of each child task throttle bucket */
+#ifndef FM_CHILD_THROTTLE_BURST_MS
+#error FM_CHILD_THROTTLE_BURST_MS must be defined!
+#elif FM_CHILD_THROTTLE_BURST_MS < 10
+#error FM_CHILD_THROTTLE_BURST_MS cannot be less than 10
+#elif FM_CHILD_THROTTLE_BURST_MS > 1000
+#error FM_CHILD_THROTTLE_BURST_MS cannot be greater than 1000
+#endif
+
+/* Number of volumes with their own child task rates */
+#ifndef FM_CHILD_THROTTLE_VOLUME_COUNT
+#error FM_CHILD_THROTTLE_VOLUME_COUNT must be defined!
+#elif FM_CHILD_THROTTLE_VOLUME_COUNT < 1
+#error FM_CHILD_THROTTLE_VOLUME_COUNT cannot be less than 1
+#elif FM_CHILD_THROTTLE_VOLUME_COUNT > 16
+#error FM_CHILD_THROTTLE_VOLUME_COUNT cannot be greater than 16
+#endif
+
+/* Alignment of the child task copy buffer */
+#ifndef FM_CHILD_COPY_BUFFER_ALIGN
+#error FM_CHILD_COPY_BUFFER_ALIGN must be defined!
+#elif FM_CHILD_COPY_BUFFER_ALIGN < 8
+#error FM_CHILD_COPY_BUFFER_ALIGN cannot be less than 8
+#elif FM_CHILD_COPY_BUFFER_ALIGN > 65536
+#error FM_CHILD_COPY_BUFFER_ALIGN cannot be greater than 64K
+#elif (FM_CHILD_COPY_BUFFER_ALIGN & (FM_CHILD_COPY_BUFFER_ALIGN - 1)) != 0
+#error FM_CHILD_COPY_BUFFER_ALIGN must be a power of two
 #endif
 
-/* Length of time for each task delay */
-#ifndef FM_CHILD_FILE_SLEEP_MS
-#error FM_CHILD_FILE_SLEEP_MS must be defined!
-#elif FM_CHILD_FILE_SLEEP_MS < 0
-#error FM_CHILD_FILE_SLEEP_MS cannot be less than zero
-#elif FM_CHILD_FILE_SLEEP_MS > 100
-#error FM_CHILD_FILE_SLEEP_MS cannot be greater than 100
+/* Size of the child task copy buffer */
+#ifndef FM_CHILD_COPY_BUFFER_SIZE
+#error FM_CHILD_COPY_BUFFER_SIZE must be defined!
+#elif FM_CHILD_COPY_BUFFER_SIZE < FM_CHILD_FILE_BLOCK_SIZE
+#error FM_CHILD_COPY_BUFFER_SIZE cannot be less than FM_CHILD_FILE_BLOCK_SIZE
+#elif FM_CHILD_COPY_BUFFER_SIZE > 1048576
+#error FM_CHILD_COPY_BUFFER_SIZE cannot be greater than 1M
+#elif (FM_CHILD_COPY_BUFFER_SIZE % FM_CHILD_COPY_BUFFER_ALIGN) != 0
+#error FM_CHILD_COPY_BUFFER_SIZE must be a multiple of FM_CHILD_COPY_BUFFER_ALIGN
+#endif
+
+/* Number of copy buffers per child task */
+#ifndef FM_CHILD_COPY_BUFFER_COUNT
+#error FM_CHILD_COPY_BUFFER_COUNT must be defined!
+#elif FM_CHILD_COPY_BUFFER_COUNT < 1
+#error FM_CHILD_COPY_BUFFER_COUNT cannot be less than 1
+#elif FM_CHILD_COPY_BUFFER_COUNT > 4
+#error FM_CHILD_COPY_BUFFER_COUNT cannot be greater than 4
+#endif
+
+/* Child task checkpoint file name */
+#ifndef FM_CHILD_CHECKPOINT_FILE
+#error FM_CHILD_CHECKPOINT_FILE must be defined!
+#endif
+
+/* Source bytes copied between child task checkpoints */
+#ifndef FM_CHILD_CHECKPOINT_INTERVAL
+#error FM_CHILD_CHECKPOINT_INTERVAL must be defined!
+#elif (FM_CHILD_CHECKPOINT_INTERVAL != 0) && (FM_CHILD_CHECKPOINT_INTERVAL < FM_CHILD_COPY_BUFFER_SIZE)
+#error FM_CHILD_CHECKPOINT_INTERVAL must be zero or no less than FM_CHILD_COPY_BUFFER_SIZE
+#elif FM_CHILD_CHECKPOINT_INTERVAL > 268435456
+#error FM_CHILD_CHECKPOINT_INTERVAL cannot be greater than 256M
 #endif
 
 /* Number of entries in the child task command queue */
@@ -128,8 +198,53 @@
 #error FM_CHILD_QUEUE_DEPTH must be defined!
 #elif FM_CHILD_QUEUE_DEPTH < 1
 #error FM_CHILD_QUEUE_DEPTH cannot be less than 1
-#elif FM_CHILD_QUEUE_DEPTH > 10
-#error FM_CHILD_QUEUE_DEPTH cannot be greater than 10
+#elif FM_CHILD_QUEUE_DEPTH > 255
+#error FM_CHILD_QUEUE_DEPTH cannot be greater than 255
+#endif
+
+/* Size of the blocks holding queued command path names */
+#ifndef FM_CHILD_PATH_BLOCK_SIZE
+#error FM_CHILD_PATH_BLOCK_SIZE must be defined!
+#elif FM_CHILD_PATH_BLOCK_SIZE < 8
+#error FM_CHILD_PATH_BLOCK_SIZE cannot be less than 8
+#elif FM_CHILD_PATH_BLOCK_SIZE > OS_MAX_PATH_LEN
+#error FM_CHILD_PATH_BLOCK_SIZE cannot be greater than OS_MAX_PATH_LEN
+#endif
+
+/* Number of blocks holding queued command path names */
+#ifndef FM_CHILD_PATH_BLOCK_COUNT
+#error FM_CHILD_PATH_BLOCK_COUNT must be defined!
+#elif FM_CHILD_PATH_BLOCK_COUNT < (3 * ((OS_MAX_PATH_LEN + FM_CHILD_PATH_BLOCK_SIZE - 1) / FM_CHILD_PATH_BLOCK_SIZE))
+#error FM_CHILD_PATH_BLOCK_COUNT cannot be less than the blocks needed for three OS_MAX_PATH_LEN names
+#elif FM_CHILD_PATH_BLOCK_COUNT > 65535
+#error FM_CHILD_PATH_BLOCK_COUNT cannot be greater than 65535
+#endif
+
+/* Fast lane commands taken in a row while the bulk lane waits */
+#ifndef FM_CHILD_FAST_LANE_BURST
+#error FM_CHILD_FAST_LANE_BURST must be defined!
+#elif FM_CHILD_FAST_LANE_BURST < 1
+#error FM_CHILD_FAST_LANE_BURST cannot be less than 1
+#elif FM_CHILD_FAST_LANE_BURST > 255
+#error FM_CHILD_FAST_LANE_BURST cannot be greater than 255
+#endif
+
+/* Number of child tasks sharing the command queue */
+#ifndef FM_CHILD_TASK_COUNT
+#error FM_CHILD_TASK_COUNT must be defined!
+#elif FM_CHILD_TASK_COUNT < 1
+#error FM_CHILD_TASK_COUNT cannot be less than 1
+#elif FM_CHILD_TASK_COUNT > 8
+#error FM_CHILD_TASK_COUNT cannot be greater than 8
+#endif
+
+/* Interval between checks for a command working on the same names */
+#ifndef FM_CHILD_PATH_WAIT_MS
+#error FM_CHILD_PATH_WAIT_MS must be defined!
+#elif FM_CHILD_PATH_WAIT_MS < 1
+#error FM_CHILD_PATH_WAIT_MS cannot be less than 1
+#elif FM_CHILD_PATH_WAIT_MS > 1000
+#error FM_CHILD_PATH_WAIT_MS cannot be greater than 1000
 #endif
 
 /* Child task name */
@@ -160,6 +275,139 @@
 #error FM_CHILD_SEM_NAME must be defined!
 #endif
 
+/* Child copy writer task name */
+#ifndef FM_CHILD_WRITER_TASK_NAME
+#error FM_CHILD_WRITER_TASK_NAME must be defined!
+#endif
+
+/* Child copy writer task stack size */
+#ifndef FM_CHILD_WRITER_STACK_SIZE
+#error FM_CHILD_WRITER_STACK_SIZE must be defined!
+#elif FM_CHILD_WRITER_STACK_SIZE < 2048
+#error FM_CHILD_WRITER_STACK_SIZE cannot be less than 2048
+#elif FM_CHILD_WRITER_STACK_SIZE > 20480
+#error FM_CHILD_WRITER_STACK_SIZE cannot be greater than 20480
+#endif
+
+/* Child CRC helper task name */
+#ifndef FM_CHILD_CRC_HELPER_TASK_NAME
+#error FM_CHILD_CRC_HELPER_TASK_NAME must be defined!
+#endif
+
+/* Child CRC helper task stack size */
+#ifndef FM_CHILD_CRC_HELPER_STACK_SIZE
+#error FM_CHILD_CRC_HELPER_STACK_SIZE must be defined!
+#elif FM_CHILD_CRC_HELPER_STACK_SIZE < 2048
+#error FM_CHILD_CRC_HELPER_STACK_SIZE cannot be less than 2048
+#elif FM_CHILD_CRC_HELPER_STACK_SIZE > 20480
+#error FM_CHILD_CRC_HELPER_STACK_SIZE cannot be greater than 20480
+#endif
+
+/* Child task verification default */
+#ifndef FM_CHILD_VERIFY_DEFAULT
+#error FM_CHILD_VERIFY_DEFAULT must be defined!
+#elif (FM_CHILD_VERIFY_DEFAULT != 0) && (FM_CHILD_VERIFY_DEFAULT != 1)
+#error FM_CHILD_VERIFY_DEFAULT must be 0 or 1
+#endif
+
+/* Size of the child task delete list */
+#ifndef FM_CHILD_DELETE_LIST_SIZE
+#error FM_CHILD_DELETE_LIST_SIZE must be defined!
+#elif FM_CHILD_DELETE_LIST_SIZE < OS_MAX_PATH_LEN
+#error FM_CHILD_DELETE_LIST_SIZE cannot be less than OS_MAX_PATH_LEN
+#elif FM_CHILD_DELETE_LIST_SIZE > 1048576
+#error FM_CHILD_DELETE_LIST_SIZE cannot be greater than 1M
+#endif
+
+/* Size of the child task delete tree stack */
+#ifndef FM_CHILD_TREE_STACK_SIZE
+#error FM_CHILD_TREE_STACK_SIZE must be defined!
+#elif FM_CHILD_TREE_STACK_SIZE < 1
+#error FM_CHILD_TREE_STACK_SIZE cannot be less than 1
+#elif FM_CHILD_TREE_STACK_SIZE > 4096
+#error FM_CHILD_TREE_STACK_SIZE cannot be greater than 4096
+#endif
+
+/* Child task delete mode default */
+#ifndef FM_CHILD_DELETE_DEFAULT
+#error FM_CHILD_DELETE_DEFAULT must be defined!
+#elif (FM_CHILD_DELETE_DEFAULT != 0) && (FM_CHILD_DELETE_DEFAULT != 1)
+#error FM_CHILD_DELETE_DEFAULT must be 0 or 1
+#endif
+
+/* Child task trash directory name */
+#ifndef FM_CHILD_TRASH_DIR_NAME
+#error FM_CHILD_TRASH_DIR_NAME must be defined!
+#endif
+
+/* Number of child task trash volumes */
+#ifndef FM_CHILD_TRASH_VOLUMES
+#error FM_CHILD_TRASH_VOLUMES must be defined!
+#elif FM_CHILD_TRASH_VOLUMES < 1
+#error FM_CHILD_TRASH_VOLUMES cannot be less than 1
+#elif FM_CHILD_TRASH_VOLUMES > 16
+#error FM_CHILD_TRASH_VOLUMES cannot be greater than 16
+#endif
+
+/* Files removed by a scheduled purge pass */
+#ifndef FM_CHILD_PURGE_BUDGET
+#error FM_CHILD_PURGE_BUDGET must be defined!
+#elif FM_CHILD_PURGE_BUDGET < 1
+#error FM_CHILD_PURGE_BUDGET cannot be less than 1
+#elif FM_CHILD_PURGE_BUDGET > 1000
+#error FM_CHILD_PURGE_BUDGET cannot be greater than 1000
+#endif
+
+/* File CRC results kept by the child tasks */
+#ifndef FM_CHILD_CRC_CACHE_ENTRIES
+#error FM_CHILD_CRC_CACHE_ENTRIES must be defined!
+#elif FM_CHILD_CRC_CACHE_ENTRIES < 1
+#error FM_CHILD_CRC_CACHE_ENTRIES cannot be less than 1
+#elif FM_CHILD_CRC_CACHE_ENTRIES > 256
+#error FM_CHILD_CRC_CACHE_ENTRIES cannot be greater than 256
+#endif
+
+/* CRC helper tasks shared by the child tasks */
+#ifndef FM_CHILD_CRC_HELPERS
+#error FM_CHILD_CRC_HELPERS must be defined!
+#elif FM_CHILD_CRC_HELPERS < 1
+#error FM_CHILD_CRC_HELPERS cannot be less than 1
+#elif FM_CHILD_CRC_HELPERS > 8
+#error FM_CHILD_CRC_HELPERS cannot be greater than 8
+#endif
+
+/* Smallest file whose CRC is split between the helper tasks */
+#ifndef FM_CHILD_CRC_SPLIT_SIZE
+#error FM_CHILD_CRC_SPLIT_SIZE must be defined!
+#elif (FM_CHILD_CRC_SPLIT_SIZE != 0) && \
+    (FM_CHILD_CRC_SPLIT_SIZE < (FM_CHILD_FILE_BLOCK_SIZE * (FM_CHILD_CRC_HELPERS + 1)))
+#error FM_CHILD_CRC_SPLIT_SIZE must be zero or no less than FM_CHILD_FILE_BLOCK_SIZE * (FM_CHILD_CRC_HELPERS + 1)
+#endif
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* FM platform configuration parameters - latency histograms       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/* Number of buckets in each latency histogram */
+#ifndef FM_LATENCY_BUCKET_COUNT
+#error FM_LATENCY_BUCKET_COUNT must be defined!
+#elif FM_LATENCY_BUCKET_COUNT < 2
+#error FM_LATENCY_BUCKET_COUNT cannot be less than 2
+#elif FM_LATENCY_BUCKET_COUNT > 16
+#error FM_LATENCY_BUCKET_COUNT cannot be greater than 16
+#endif
+
+/* Number of command codes with latency histograms */
+#ifndef FM_LATENCY_CC_COUNT
+#error FM_LATENCY_CC_COUNT must be defined!
+#elif FM_LATENCY_CC_COUNT < 1
+#error FM_LATENCY_CC_COUNT cannot be less than 1
+#elif FM_LATENCY_CC_COUNT > 64
+#error FM_LATENCY_CC_COUNT cannot be greater than 64
+#endif
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* FM platform configuration parameters - table definitions        */
@@ -200,4 +448,51 @@
 #error FM_TABLE_VALIDATION_ERR must be defined!
 #endif
 
+/* Retention table object name */
+#ifndef FM_RETENTION_TABLE_CFE_NAME
+#error FM_RETENTION_TABLE_CFE_NAME must be defined!
+#endif
+
+/* Retention table filename - with path */
+#ifndef FM_RETENTION_TABLE_DEF_NAME
+#error FM_RETENTION_TABLE_DEF_NAME must be defined!
+#endif
+
+/* Retention table filename - without path */
+#ifndef FM_RETENTION_TABLE_FILENAME
+#error FM_RETENTION_TABLE_FILENAME must be defined!
+#endif
+
+/* Default description text for retention table */
+#ifndef FM_RETENTION_TABLE_DEF_DESC
+#error FM_RETENTION_TABLE_DEF_DESC must be defined!
+#endif
+
+/* Number of retention table entries */
+#ifndef FM_RETENTION_ENTRY_COUNT
+#error FM_RETENTION_ENTRY_COUNT must be defined!
+#elif FM_RETENTION_ENTRY_COUNT < 1
+#error FM_RETENTION_ENTRY_COUNT cannot be less than 1
+#elif FM_RETENTION_ENTRY_COUNT > 32
+#error FM_RETENTION_ENTRY_COUNT cannot be greater than 32
+#endif
+
+/* Number of priority patterns in each retention table entry */
+#ifndef FM_RETENTION_PATTERN_COUNT
+#error FM_RETENTION_PATTERN_COUNT must be defined!
+#elif FM_RETENTION_PATTERN_COUNT < 1
+#error FM_RETENTION_PATTERN_COUNT cannot be less than 1
+#elif FM_RETENTION_PATTERN_COUNT > 16
+#error FM_RETENTION_PATTERN_COUNT cannot be greater than 16
+#endif
+
+/* Number of files in each retention eviction index */
+#ifndef FM_RETENTION_INDEX_SIZE
+#error FM_RETENTION_INDEX_SIZE must be defined!
+#elif FM_RETENTION_INDEX_SIZE < 1
+#error FM_RETENTION_INDEX_SIZE cannot be less than 1
+#elif FM_RETENTION_INDEX_SIZE > 65536
+#error FM_RETENTION_INDEX_SIZE cannot be greater than 65536
+#endif
+
 #endif
@@ -0,0 +1,78 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,918-1, and identified as “Core Flight
+ * Software System (cFS) File Manager Application Version 2.6.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *  File Manager (FM) Directory Retention Table Data
+ *
+ *  Default table contents
+ */
+
+/*************************************************************************
+**
+** Include section
+**
+**************************************************************************/
+#include "cfe.h"
+#include "cfe_tbl_filedef.h"
+#include "fm_platform_cfg.h"
+#include "fm_msg.h"
+
+/*
+** FM retention table header
+*/
+CFE_TBL_FileDef_t CFE_TBL_FileDef = {"FM_RetentionTable", FM_APP_NAME "." FM_RETENTION_TABLE_CFE_NAME,
+                                     FM_RETENTION_TABLE_DEF_DESC, FM_RETENTION_TABLE_FILENAME,
+                                     sizeof(FM_RetentionTable_t)};
+
+/*
+** FM directory retention table data
+**
+** -- entries with an empty directory name are unused and must be disabled
+**
+** -- other entries need a non-zero interval and at least one limit,
+**    a limit of zero is not applied
+**
+** -- priority patterns are only used with FM_RETENTION_ORDER_PRIORITY,
+**    files matching the first pattern are removed first
+**
+** -- the example entry is disabled, a pass removes files without asking
+*/
+FM_RetentionTable_t FM_RetentionTable = {
+    {{
+         /* - 0 - */
+         .Enabled   = false,                     /* Enforce the limits of this directory */
+         .Order     = FM_RETENTION_ORDER_OLDEST, /* Removal order (oldest first, lowest priority first) */
+         .Interval  = 60,                        /* Seconds between passes */
+         .MaxBytes  = 4194304,                   /* Largest total size, zero for no limit */
+         .MaxFiles  = 0,                         /* Largest number of files, zero for no limit */
+         .Directory = "/ram/rec"                 /* Managed directory */
+     },
+     {
+         /* - 1 - */
+         .Enabled = false /* Unused entry */
+     },
+     {
+         /* - 2 - */
+         .Enabled = false /* Unused entry */
+     },
+     {
+         /* - 3 - */
+         .Enabled = false /* Unused entry */
+     }}};
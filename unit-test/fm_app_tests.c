@@ -52,6 +52,7 @@
 #include "fm_test_utils.h"
 #include <unistd.h>
 #include <stdlib.h>
+#include <string.h>
 #include "cfe.h"
 
 /*********************************************************************************
@@ -282,8 +283,15 @@ void Test_FM_AppInit_TableInitSuccess(void)
     UtAssert_STUB_COUNT(CFE_SB_CreatePipe, 1);
     UtAssert_STUB_COUNT(CFE_SB_Subscribe, 2);
     UtAssert_STUB_COUNT(FM_ChildInit, 1);
+    UtAssert_STUB_COUNT(FM_CrcInit, 1);
+    UtAssert_STUB_COUNT(FM_DigestInit, 1);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_STARTUP_EID);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildCopyBlockSize, FM_CHILD_COPY_BUFFER_SIZE);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildVerifyMode, FM_CHILD_VERIFY_DEFAULT);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildDeleteMode, FM_CHILD_DELETE_DEFAULT);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildThrottle[FM_CHILD_THROTTLE_DEFAULT].ByteRate, FM_CHILD_THROTTLE_BYTE_RATE);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildThrottle[FM_CHILD_THROTTLE_DEFAULT].StatRate, FM_CHILD_THROTTLE_STAT_RATE);
 }
 
 /* ********************************
@@ -297,14 +305,42 @@ void Test_FM_SendHkCmd(void)
     UT_SetDefaultReturnValue(UT_KEY(FM_GetOpenFilesData), 0);
 
     /* Set non-zero values to assert */
-    FM_GlobalData.CommandCounter      = 1;
-    FM_GlobalData.CommandErrCounter   = 2;
-    FM_GlobalData.ChildCmdCounter     = 3;
-    FM_GlobalData.ChildCmdErrCounter  = 4;
-    FM_GlobalData.ChildCmdWarnCounter = 5;
-    FM_GlobalData.ChildQueueCount     = 6;
-    FM_GlobalData.ChildCurrentCC      = 7;
-    FM_GlobalData.ChildPreviousCC     = 8;
+    FM_GlobalData.CommandCounter    = 1;
+    FM_GlobalData.CommandErrCounter = 2;
+    FM_GlobalData.ChildTaskCount    = FM_CHILD_TASK_COUNT;
+
+    FM_GlobalData.ChildWorker[0].CmdCounter     = 3;
+    FM_GlobalData.ChildWorker[0].CmdErrCounter  = 4;
+    FM_GlobalData.ChildWorker[0].CmdWarnCounter = 5;
+    FM_GlobalData.ChildWorker[0].PreviousCC     = 8;
+
+    FM_GlobalData.ChildWorker[FM_CHILD_TASK_COUNT - 1].CurrentCC = 7;
+
+    /* One command waiting in the fast lane and two in the bulk lane */
+    FM_GlobalData.ChildLane[FM_CHILD_LANE_FAST].WriteIndex = 1;
+    FM_GlobalData.ChildLane[FM_CHILD_LANE_BULK].WriteIndex = 0;
+    FM_GlobalData.ChildLane[FM_CHILD_LANE_BULK].ReadIndex  = FM_CHILD_LANE_INDEX_WRAP - 2;
+
+    FM_GlobalData.ChildEnqueueCount  = 9;
+    FM_GlobalData.ChildDequeueCount  = 3;
+    FM_GlobalData.ChildQueueWaitLast = 10;
+    FM_GlobalData.ChildQueueWaitMax  = 11;
+    FM_GlobalData.ChildCopyBlockSize = 4096;
+    FM_GlobalData.ChildVerifyMode    = FM_VERIFY_MODE_CHILD;
+    FM_GlobalData.ChildDeleteMode    = FM_DELETE_MODE_TRASH;
+
+    FM_GlobalData.ChildThrottle[FM_CHILD_THROTTLE_DEFAULT].ByteRate = 8192;
+    FM_GlobalData.ChildThrottle[FM_CHILD_THROTTLE_DEFAULT].StatRate = 50;
+
+    FM_GlobalData.RetentionPassCount = 13;
+    FM_GlobalData.RetentionFileCount = 14;
+    FM_GlobalData.TrashFileCount     = 15;
+    FM_GlobalData.TrashPurgeCount    = 16;
+    FM_GlobalData.CrcCacheHits       = 17;
+    FM_GlobalData.CrcCacheMisses     = 18;
+    FM_GlobalData.CrcAppendCount     = 19;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_GetChildPathBlocksFree), 12);
 
     /* Act */
     UtAssert_VOIDCALL(FM_SendHkCmd(NULL));
@@ -312,21 +348,254 @@ void Test_FM_SendHkCmd(void)
     /* Assert */
     UtAssert_STUB_COUNT(FM_ReleaseTablePointers, 1);
     UtAssert_STUB_COUNT(FM_AcquireTablePointers, 1);
-    UtAssert_STUB_COUNT(CFE_MSG_Init, 1);
     UtAssert_STUB_COUNT(FM_GetOpenFilesData, 1);
-    UtAssert_STUB_COUNT(CFE_SB_TimeStampMsg, 1);
-    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+
+    /* A child task is busy, so the progress packet follows housekeeping */
+    UtAssert_STUB_COUNT(CFE_MSG_Init, 2);
+    UtAssert_STUB_COUNT(CFE_SB_TimeStampMsg, 2);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 2);
 
     ReportPtr = &FM_GlobalData.HousekeepingPkt.Payload;
     UtAssert_INT32_EQ(ReportPtr->CommandCounter, FM_GlobalData.CommandCounter);
     UtAssert_INT32_EQ(ReportPtr->CommandErrCounter, FM_GlobalData.CommandErrCounter);
     UtAssert_INT32_EQ(ReportPtr->NumOpenFiles, 0);
-    UtAssert_INT32_EQ(ReportPtr->ChildCmdCounter, FM_GlobalData.ChildCmdCounter);
-    UtAssert_INT32_EQ(ReportPtr->ChildCmdErrCounter, FM_GlobalData.ChildCmdErrCounter);
-    UtAssert_INT32_EQ(ReportPtr->ChildCmdWarnCounter, FM_GlobalData.ChildCmdWarnCounter);
-    UtAssert_INT32_EQ(ReportPtr->ChildQueueCount, FM_GlobalData.ChildQueueCount);
-    UtAssert_INT32_EQ(ReportPtr->ChildCurrentCC, FM_GlobalData.ChildCurrentCC);
-    UtAssert_INT32_EQ(ReportPtr->ChildPreviousCC, FM_GlobalData.ChildPreviousCC);
+    UtAssert_INT32_EQ(ReportPtr->ChildCmdCounter, 3);
+    UtAssert_INT32_EQ(ReportPtr->ChildCmdErrCounter, 4);
+    UtAssert_INT32_EQ(ReportPtr->ChildCmdWarnCounter, 5);
+    UtAssert_INT32_EQ(ReportPtr->ChildQueueCount, 3);
+    UtAssert_INT32_EQ(ReportPtr->ChildFastQueueCount, 1);
+    UtAssert_UINT32_EQ(ReportPtr->ChildEnqueueCount, 9);
+    UtAssert_UINT32_EQ(ReportPtr->ChildDequeueCount, 3);
+    UtAssert_UINT32_EQ(ReportPtr->ChildQueueWaitLast, 10);
+    UtAssert_UINT32_EQ(ReportPtr->ChildQueueWaitMax, 11);
+    UtAssert_INT32_EQ(ReportPtr->ChildPathBlocksFree, 12);
+    UtAssert_UINT32_EQ(ReportPtr->ChildCopyBlockSize, 4096);
+    UtAssert_UINT32_EQ(ReportPtr->ChildVerifyMode, FM_VERIFY_MODE_CHILD);
+    UtAssert_UINT32_EQ(ReportPtr->ChildDeleteMode, FM_DELETE_MODE_TRASH);
+    UtAssert_UINT32_EQ(ReportPtr->ChildByteRate, 8192);
+    UtAssert_UINT32_EQ(ReportPtr->ChildStatRate, 50);
+    UtAssert_UINT32_EQ(ReportPtr->RetentionPassCount, 13);
+    UtAssert_UINT32_EQ(ReportPtr->RetentionFileCount, 14);
+    UtAssert_UINT32_EQ(ReportPtr->TrashFileCount, 15);
+    UtAssert_UINT32_EQ(ReportPtr->TrashPurgeCount, 16);
+    UtAssert_UINT32_EQ(ReportPtr->CrcCacheHits, 17);
+    UtAssert_UINT32_EQ(ReportPtr->CrcCacheMisses, 18);
+    UtAssert_UINT32_EQ(ReportPtr->CrcAppendCount, 19);
+    UtAssert_INT32_EQ(ReportPtr->ChildCurrentCC, 7);
+    UtAssert_INT32_EQ(ReportPtr->ChildPreviousCC, 8);
+    UtAssert_INT32_EQ(ReportPtr->ChildTaskCount, FM_CHILD_TASK_COUNT);
+    UtAssert_INT32_EQ(ReportPtr->ChildWorker[0].CmdCounter, 3);
+    UtAssert_INT32_EQ(ReportPtr->ChildWorker[0].CmdErrCounter, 4);
+    UtAssert_INT32_EQ(ReportPtr->ChildWorker[0].CmdWarnCounter, 5);
+    UtAssert_INT32_EQ(ReportPtr->ChildWorker[0].PreviousCC, 8);
+    UtAssert_INT32_EQ(ReportPtr->ChildWorker[FM_CHILD_TASK_COUNT - 1].CurrentCC, 7);
+}
+
+/* ********************************
+ * Send Child Progress Tests
+ * *******************************/
+void Test_FM_SendChildProgress_AllIdle(void)
+{
+    /* Act */
+    UtAssert_VOIDCALL(FM_SendChildProgress());
+
+    /* Assert */
+    UtAssert_STUB_COUNT(CFE_MSG_Init, 0);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
+    UtAssert_BOOL_FALSE(FM_GlobalData.ChildProgressBusy);
+}
+
+void Test_FM_SendChildProgress_Busy(void)
+{
+    FM_ChildProgressEntry_t *EntryPtr;
+
+    /* Arrange - 4000 of 10000 bytes copied in 2 seconds */
+    FM_ChildWorker_t *Worker = &FM_GlobalData.ChildWorker[FM_CHILD_TASK_COUNT - 1];
+    OS_time_t         Now    = OS_TimeAssembleFromMilliseconds(12, 0);
+
+    Worker->CurrentCC     = FM_COPY_FILE_CC;
+    Worker->ProgressStart = OS_TimeAssembleFromMilliseconds(10, 0);
+    Worker->ProgressBytes = 4000;
+    Worker->ProgressTotal = 10000;
+    strncpy(Worker->ProgressSource, "source", sizeof(Worker->ProgressSource) - 1);
+    strncpy(Worker->ProgressTarget, "target", sizeof(Worker->ProgressTarget) - 1);
+
+    UT_SetDataBuffer(UT_KEY(OS_GetLocalTime), &Now, sizeof(Now), false);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_SendChildProgress());
+
+    /* Assert */
+    UtAssert_STUB_COUNT(CFE_MSG_Init, 1);
+    UtAssert_STUB_COUNT(CFE_SB_TimeStampMsg, 1);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+    UtAssert_BOOL_TRUE(FM_GlobalData.ChildProgressBusy);
+
+    EntryPtr = &FM_GlobalData.ChildProgressPkt.Payload.ChildWorker[FM_CHILD_TASK_COUNT - 1];
+    UtAssert_INT32_EQ(EntryPtr->CurrentCC, FM_COPY_FILE_CC);
+    UtAssert_UINT32_EQ(EntryPtr->ElapsedTime, 2000);
+    UtAssert_UINT32_EQ(EntryPtr->BytesDone, 4000);
+    UtAssert_UINT32_EQ(EntryPtr->BytesTotal, 10000);
+    UtAssert_UINT32_EQ(EntryPtr->ByteRate, 2000);
+    UtAssert_UINT32_EQ(EntryPtr->TimeRemaining, 3);
+    UtAssert_STRINGBUF_EQ(EntryPtr->Source, sizeof(EntryPtr->Source), "source", -1);
+    UtAssert_STRINGBUF_EQ(EntryPtr->Target, sizeof(EntryPtr->Target), "target", -1);
+
+#if (FM_CHILD_TASK_COUNT > 1)
+    /* The other workers are reported idle */
+    UtAssert_INT32_EQ(FM_GlobalData.ChildProgressPkt.Payload.ChildWorker[0].CurrentCC, 0);
+#endif
+}
+
+void Test_FM_SendChildProgress_NothingTimedYet(void)
+{
+    FM_ChildProgressEntry_t *EntryPtr;
+
+    /* Arrange - the command started at the current time */
+    FM_GlobalData.ChildWorker[0].CurrentCC     = FM_GET_FILE_INFO_CC;
+    FM_GlobalData.ChildWorker[0].ProgressTotal = 10000;
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_SendChildProgress());
+
+    /* Assert */
+    EntryPtr = &FM_GlobalData.ChildProgressPkt.Payload.ChildWorker[0];
+    UtAssert_INT32_EQ(EntryPtr->CurrentCC, FM_GET_FILE_INFO_CC);
+    UtAssert_UINT32_EQ(EntryPtr->ElapsedTime, 0);
+    UtAssert_UINT32_EQ(EntryPtr->ByteRate, 0);
+    UtAssert_UINT32_EQ(EntryPtr->TimeRemaining, 0);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+}
+
+void Test_FM_SendChildProgress_IdleAfterBusy(void)
+{
+    /* Arrange - the previous packet showed a busy child task */
+    FM_GlobalData.ChildProgressBusy = true;
+
+    /* Act - only the first packet after the command ended is sent */
+    UtAssert_VOIDCALL(FM_SendChildProgress());
+    UtAssert_VOIDCALL(FM_SendChildProgress());
+
+    /* Assert */
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+    UtAssert_BOOL_FALSE(FM_GlobalData.ChildProgressBusy);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildProgressPkt.Payload.ChildWorker[0].CurrentCC, 0);
+}
+
+/* ********************************
+ * Retention Schedule Tests
+ * *******************************/
+void Test_FM_RetentionSchedule_NoTable(void)
+{
+    /* Act */
+    UtAssert_VOIDCALL(FM_RetentionSchedule());
+
+    /* Assert */
+    UtAssert_STUB_COUNT(OS_GetLocalTime, 0);
+    UtAssert_STUB_COUNT(FM_StartRetention, 0);
+}
+
+void Test_FM_RetentionSchedule_Due(void)
+{
+    FM_RetentionTable_t RetentionTable;
+    OS_time_t           Now = OS_TimeAssembleFromMilliseconds(100, 0);
+
+    /* Arrange - entry 0 is due, 1 is not, 2 is still busy and 3 is disabled */
+    memset(&RetentionTable, 0, sizeof(RetentionTable));
+    RetentionTable.Entries[0].Enabled  = FM_TABLE_ENTRY_ENABLED;
+    RetentionTable.Entries[0].Interval = 60;
+    RetentionTable.Entries[1].Enabled  = FM_TABLE_ENTRY_ENABLED;
+    RetentionTable.Entries[1].Interval = 60;
+    RetentionTable.Entries[2].Enabled  = FM_TABLE_ENTRY_ENABLED;
+    RetentionTable.Entries[2].Interval = 60;
+    FM_GlobalData.RetentionTablePtr    = &RetentionTable;
+
+    FM_GlobalData.Retention[0].NextTime = 100;
+    FM_GlobalData.Retention[1].NextTime = 130;
+    FM_GlobalData.Retention[2].Busy     = 1;
+
+    UT_SetDataBuffer(UT_KEY(OS_GetLocalTime), &Now, sizeof(Now), false);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_RetentionSchedule());
+
+    /* Assert */
+    UtAssert_STUB_COUNT(FM_StartRetention, 1);
+    UtAssert_UINT32_EQ(FM_GlobalData.Retention[0].NextTime, 160);
+    UtAssert_UINT32_EQ(FM_GlobalData.Retention[1].NextTime, 130);
+    UtAssert_UINT32_EQ(FM_GlobalData.Retention[2].NextTime, 0);
+}
+
+void Test_FM_RetentionSchedule_ClockSetBack(void)
+{
+    FM_RetentionTable_t RetentionTable;
+    OS_time_t           Now = OS_TimeAssembleFromMilliseconds(100, 0);
+
+    /* Arrange - the next pass is further away than one interval */
+    memset(&RetentionTable, 0, sizeof(RetentionTable));
+    RetentionTable.Entries[0].Enabled   = FM_TABLE_ENTRY_ENABLED;
+    RetentionTable.Entries[0].Interval  = 60;
+    FM_GlobalData.RetentionTablePtr     = &RetentionTable;
+    FM_GlobalData.Retention[0].NextTime = 1000;
+
+    UT_SetDataBuffer(UT_KEY(OS_GetLocalTime), &Now, sizeof(Now), false);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_RetentionSchedule());
+
+    /* Assert */
+    UtAssert_STUB_COUNT(FM_StartRetention, 1);
+    UtAssert_UINT32_EQ(FM_GlobalData.Retention[0].NextTime, 160);
+}
+
+/* ********************************
+ * Trash Schedule Tests
+ * *******************************/
+void Test_FM_TrashSchedule_NothingPending(void)
+{
+    /* Act */
+    UtAssert_VOIDCALL(FM_TrashSchedule());
+
+    /* Assert */
+    UtAssert_STUB_COUNT(FM_StartPurge, 0);
+}
+
+void Test_FM_TrashSchedule_Due(void)
+{
+    /* Arrange */
+    FM_GlobalData.Trash[FM_CHILD_TRASH_VOLUMES - 1].Pending = 1;
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_TrashSchedule());
+
+    /* Assert */
+    UtAssert_STUB_COUNT(FM_StartPurge, 1);
+}
+
+void Test_FM_TrashSchedule_Busy(void)
+{
+    /* Arrange - the previous pass is still pending */
+    FM_GlobalData.Trash[0].Pending = 1;
+    FM_GlobalData.TrashPurgeBusy   = 1;
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_TrashSchedule());
+
+    /* Assert */
+    UtAssert_STUB_COUNT(FM_StartPurge, 0);
+}
+
+void Test_FM_TrashSchedule_QueueNotEmpty(void)
+{
+    /* Arrange - a command is waiting for a child task */
+    FM_GlobalData.Trash[0].Pending                         = 1;
+    FM_GlobalData.ChildLane[FM_CHILD_LANE_BULK].WriteIndex = 1;
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_TrashSchedule());
+
+    /* Assert */
+    UtAssert_STUB_COUNT(FM_StartPurge, 0);
 }
 
 /* * * * * * * * * * * * * *
@@ -372,6 +641,35 @@ void add_FM_SendHkCmd_tests(void)
     UtTest_Add(Test_FM_SendHkCmd, FM_Test_Setup, FM_Test_Teardown, "Test_FM_SendHkCmd_Return");
 }
 
+void add_FM_SendChildProgress_tests(void)
+{
+    UtTest_Add(Test_FM_SendChildProgress_AllIdle, FM_Test_Setup, FM_Test_Teardown, "Test_FM_SendChildProgress_AllIdle");
+    UtTest_Add(Test_FM_SendChildProgress_Busy, FM_Test_Setup, FM_Test_Teardown, "Test_FM_SendChildProgress_Busy");
+    UtTest_Add(Test_FM_SendChildProgress_NothingTimedYet, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_SendChildProgress_NothingTimedYet");
+    UtTest_Add(Test_FM_SendChildProgress_IdleAfterBusy, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_SendChildProgress_IdleAfterBusy");
+}
+
+void add_FM_RetentionSchedule_tests(void)
+{
+    UtTest_Add(Test_FM_RetentionSchedule_NoTable, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_RetentionSchedule_NoTable");
+    UtTest_Add(Test_FM_RetentionSchedule_Due, FM_Test_Setup, FM_Test_Teardown, "Test_FM_RetentionSchedule_Due");
+    UtTest_Add(Test_FM_RetentionSchedule_ClockSetBack, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_RetentionSchedule_ClockSetBack");
+}
+
+void add_FM_TrashSchedule_tests(void)
+{
+    UtTest_Add(Test_FM_TrashSchedule_NothingPending, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_TrashSchedule_NothingPending");
+    UtTest_Add(Test_FM_TrashSchedule_Due, FM_Test_Setup, FM_Test_Teardown, "Test_FM_TrashSchedule_Due");
+    UtTest_Add(Test_FM_TrashSchedule_Busy, FM_Test_Setup, FM_Test_Teardown, "Test_FM_TrashSchedule_Busy");
+    UtTest_Add(Test_FM_TrashSchedule_QueueNotEmpty, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_TrashSchedule_QueueNotEmpty");
+}
+
 /*
  * Register the test cases to execute with the unit test tool
  */
@@ -380,4 +678,7 @@ void UtTest_Setup(void)
     add_FM_AppInit_tests();
     add_FM_AppMain_tests();
     add_FM_SendHkCmd_tests();
+    add_FM_SendChildProgress_tests();
+    add_FM_RetentionSchedule_tests();
+    add_FM_TrashSchedule_tests();
 }
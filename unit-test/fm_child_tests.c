@@ -31,6 +31,7 @@
 #include "fm_child.h"
 #include "fm_cmds.h"
 #include "fm_cmd_utils.h"
+#include "fm_kernel_copy.h"
 #include "fm_perfids.h"
 #include "fm_platform_cfg.h"
 #include "fm_verify.h"
@@ -54,14 +55,130 @@
 
 /* Unit test helpers */
 
+/* Child task worker used when invoking handlers directly */
+#define UT_FM_WORKER (&FM_GlobalData.ChildWorker[0])
+
+/* Queue lane taken by FM_ChildProcess when only the bulk lane is loaded */
+#define UT_FM_QUEUE (FM_GlobalData.ChildLane[FM_CHILD_LANE_BULK].Queue)
+
 void UT_FM_Child_Cmd_Assert(int32 cmd_ctr, int32 cmderr_ctr, int32 cmdwarn_ctr, int32 previous_cc)
 {
-    UtAssert_INT32_EQ(FM_GlobalData.ChildCmdCounter, cmd_ctr);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildCmdErrCounter, cmderr_ctr);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildCmdWarnCounter, cmdwarn_ctr);
+    UtAssert_INT32_EQ(UT_FM_WORKER->CmdCounter, cmd_ctr);
+    UtAssert_INT32_EQ(UT_FM_WORKER->CmdErrCounter, cmderr_ctr);
+    UtAssert_INT32_EQ(UT_FM_WORKER->CmdWarnCounter, cmdwarn_ctr);
+
+    UtAssert_INT32_EQ(UT_FM_WORKER->PreviousCC, previous_cc);
+    UtAssert_INT32_EQ(UT_FM_WORKER->CurrentCC, 0);
+}
+
+/*
+ * A directory read by entry offset, as RTEMS IMFS and dosFs read one.  The
+ * offset counts the entries still in the directory, so removing an entry
+ * that was already read moves the unread ones down.  Entry i is named
+ * "f<i>", every 400th is a directory and every 500th cannot be removed.
+ */
+#define UT_FM_OFFSET_DIR_ENTRIES 3000
+
+typedef struct
+{
+    uint32 Offset;
+    bool   Removed[UT_FM_OFFSET_DIR_ENTRIES];
+} UT_FM_OffsetDir_t;
+
+UT_FM_OffsetDir_t UT_FM_OffsetDir;
+
+#define UT_FM_OFFSET_DIR_IS_DIR(i)   (((i) % 400) == 3)
+#define UT_FM_OFFSET_DIR_IS_FIXED(i) (((i) % 500) == 7)
+
+uint32 UT_FM_OffsetDirIndex(const char *Path)
+{
+    const char *Name = strrchr(Path, 'f');
+
+    return (Name == NULL) ? UT_FM_OFFSET_DIR_ENTRIES : (uint32)atoi(&Name[1]);
+}
+
+void UT_Handler_OffsetDirRead(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    os_dirent_t *dirent = UT_Hook_GetArgValueByName(Context, "dirent", os_dirent_t *);
+    int32        Status = OS_ERROR;
+    uint32       Live   = 0;
+    uint32       i;
+
+    for (i = 0; (i < UT_FM_OFFSET_DIR_ENTRIES) && (Status != OS_SUCCESS); i++)
+    {
+        if (UT_FM_OffsetDir.Removed[i] == false)
+        {
+            if (Live == UT_FM_OffsetDir.Offset)
+            {
+                snprintf(dirent->FileName, sizeof(dirent->FileName), "f%u", (unsigned int)i);
+                UT_FM_OffsetDir.Offset++;
+                Status = OS_SUCCESS;
+            }
+
+            Live++;
+        }
+    }
+
+    UT_Stub_SetReturnValue(FuncKey, Status);
+}
+
+void UT_Handler_OffsetDirRewind(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    UT_FM_OffsetDir.Offset = 0;
+}
+
+void UT_Handler_OffsetDirRemove(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    const char *path   = UT_Hook_GetArgValueByName(Context, "path", const char *);
+    uint32      Index  = UT_FM_OffsetDirIndex(path);
+    int32       Status = OS_ERROR;
+
+    if ((Index < UT_FM_OFFSET_DIR_ENTRIES) && !UT_FM_OFFSET_DIR_IS_FIXED(Index) && !UT_FM_OFFSET_DIR_IS_DIR(Index))
+    {
+        UT_FM_OffsetDir.Removed[Index] = true;
+        Status                         = OS_SUCCESS;
+    }
+
+    UT_Stub_SetReturnValue(FuncKey, Status);
+}
+
+void UT_Handler_OffsetDirState(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    const char *Filename = UT_Hook_GetArgValueByName(Context, "Filename", const char *);
+    uint32      State    = FM_NAME_IS_FILE_CLOSED;
+
+    if (UT_FM_OFFSET_DIR_IS_DIR(UT_FM_OffsetDirIndex(Filename)))
+    {
+        State = FM_NAME_IS_DIRECTORY;
+    }
+
+    UT_Stub_SetReturnValue(FuncKey, State);
+}
+
+void UT_FM_OffsetDirSetup(void)
+{
+    memset(&UT_FM_OffsetDir, 0, sizeof(UT_FM_OffsetDir));
+
+    UT_SetHandlerFunction(UT_KEY(OS_DirectoryRead), UT_Handler_OffsetDirRead, NULL);
+    UT_SetHandlerFunction(UT_KEY(OS_DirectoryRewind), UT_Handler_OffsetDirRewind, NULL);
+    UT_SetHandlerFunction(UT_KEY(OS_remove), UT_Handler_OffsetDirRemove, NULL);
+    UT_SetHandlerFunction(UT_KEY(FM_GetFilenameState), UT_Handler_OffsetDirState, NULL);
+}
 
-    UtAssert_INT32_EQ(FM_GlobalData.ChildPreviousCC, previous_cc);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildCurrentCC, 0);
+uint32 UT_FM_OffsetDirRemaining(void)
+{
+    uint32 Count = 0;
+    uint32 i;
+
+    for (i = 0; i < UT_FM_OFFSET_DIR_ENTRIES; i++)
+    {
+        if (UT_FM_OffsetDir.Removed[i] == false)
+        {
+            Count++;
+        }
+    }
+
+    return Count;
 }
 
 /*********************************************************************************
@@ -95,850 +212,884 @@ void Test_FM_ChildInit_MutSemCreateNotSuccess(void)
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHILD_INIT_QSEM_ERR_EID);
 }
 
-void Test_FM_ChildInit_MuteSemCreateSuccess_CreateChildTaskNotSuccess(void)
+void Test_FM_ChildInit_DecompressMutSemCreateNotSuccess(void)
 {
     /* Arrange */
-    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_CreateChildTask), !CFE_SUCCESS);
+    UT_SetDeferredRetcode(UT_KEY(OS_MutSemCreate), 2, !CFE_SUCCESS);
 
     /* Act */
     UtAssert_INT32_EQ(FM_ChildInit(), !CFE_SUCCESS);
 
+    UtAssert_STUB_COUNT(CFE_ES_CreateChildTask, 0);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHILD_INIT_CREATE_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHILD_INIT_DSEM_ERR_EID);
 }
 
-void Test_FM_ChildInit_ReturnSuccess(void)
+void Test_FM_ChildInit_ThrottleMutSemCreateNotSuccess(void)
 {
-    UtAssert_INT32_EQ(FM_ChildInit(), CFE_SUCCESS);
+    /* Arrange */
+    UT_SetDeferredRetcode(UT_KEY(OS_MutSemCreate), 3, !CFE_SUCCESS);
 
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    /* Act */
+    UtAssert_INT32_EQ(FM_ChildInit(), !CFE_SUCCESS);
+
+    UtAssert_STUB_COUNT(CFE_ES_CreateChildTask, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHILD_INIT_TSEM_ERR_EID);
 }
 
-/* ****************
- * ChildTask Tests
- * ***************/
-void Test_FM_ChildTask_ChildLoopCalled(void)
+void Test_FM_ChildInit_TrashMutSemCreateNotSuccess(void)
 {
     /* Arrange */
-    FM_GlobalData.ChildSemaphore = FM_UT_OBJID_1;
-
-    UT_SetDefaultReturnValue(UT_KEY(OS_CountSemTake), !CFE_SUCCESS);
+    UT_SetDeferredRetcode(UT_KEY(OS_MutSemCreate), 4, !CFE_SUCCESS);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildTask());
-
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
-    UtAssert_STUB_COUNT(CFE_ES_ExitChildTask, 1);
+    UtAssert_INT32_EQ(FM_ChildInit(), !CFE_SUCCESS);
 
-    /* Assert */
-    /* SendEvent called once in ChildTask and should be called once in ChildLoop */
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHILD_INIT_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_CHILD_TERM_SEM_ERR_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_STUB_COUNT(CFE_ES_CreateChildTask, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHILD_INIT_TRASH_SEM_ERR_EID);
 }
 
-/* ****************
- * ChildProcess Tests
- * ***************/
-void Test_FM_ChildProcess_ChildReadIndexGreaterChildQDepth(void)
+void Test_FM_ChildInit_CrcCacheMutSemCreateNotSuccess(void)
 {
     /* Arrange */
-    FM_GlobalData.ChildReadIndex                                       = FM_CHILD_QUEUE_DEPTH - 1;
-    FM_GlobalData.ChildQueue[FM_GlobalData.ChildReadIndex].CommandCode = -1;
+    UT_SetDeferredRetcode(UT_KEY(OS_MutSemCreate), 5, !CFE_SUCCESS);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildProcess());
-
-    /* Assert */
-    UT_FM_Child_Cmd_Assert(0, 1, 0, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildReadIndex, 0);
+    UtAssert_INT32_EQ(FM_ChildInit(), !CFE_SUCCESS);
 
+    UtAssert_STUB_COUNT(CFE_ES_CreateChildTask, 0);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHILD_EXE_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHILD_INIT_CRC_SEM_ERR_EID);
 }
 
-void Test_FM_ChildProcess_FMCopyCC(void)
+void Test_FM_ChildInit_CopyEmptySemCreateNotSuccess(void)
 {
     /* Arrange */
-    FM_GlobalData.ChildQueue[0].CommandCode = FM_COPY_FILE_CC;
+    UT_SetDeferredRetcode(UT_KEY(OS_CountSemCreate), 2, !CFE_SUCCESS);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildProcess());
-
-    /* Assert */
-    UT_FM_Child_Cmd_Assert(1, 0, 0, FM_GlobalData.ChildQueue[0].CommandCode);
+    UtAssert_INT32_EQ(FM_ChildInit(), !CFE_SUCCESS);
 
-    UtAssert_STUB_COUNT(OS_cp, 1);
+    UtAssert_STUB_COUNT(CFE_ES_CreateChildTask, 0);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_COPY_CMD_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHILD_INIT_WRITER_ERR_EID);
 }
 
-void Test_FM_ChildProcess_FMMoveCC(void)
+void Test_FM_ChildInit_CopyFilledSemCreateNotSuccess(void)
 {
     /* Arrange */
-    FM_GlobalData.ChildQueue[0].CommandCode = FM_MOVE_FILE_CC;
+    UT_SetDeferredRetcode(UT_KEY(OS_CountSemCreate), 3, !CFE_SUCCESS);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildProcess());
-
-    /* Assert */
-    UT_FM_Child_Cmd_Assert(1, 0, 0, FM_GlobalData.ChildQueue[0].CommandCode);
+    UtAssert_INT32_EQ(FM_ChildInit(), !CFE_SUCCESS);
 
-    UtAssert_STUB_COUNT(OS_mv, 1);
+    UtAssert_STUB_COUNT(CFE_ES_CreateChildTask, 0);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_MOVE_CMD_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHILD_INIT_WRITER_ERR_EID);
 }
 
-void Test_FM_ChildProcess_FMRenameCC(void)
+void Test_FM_ChildInit_CreateWriterTaskNotSuccess(void)
 {
     /* Arrange */
-    FM_GlobalData.ChildQueue[0].CommandCode = FM_RENAME_FILE_CC;
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_CreateChildTask), !CFE_SUCCESS);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildProcess());
-
-    /* Assert */
-    UT_FM_Child_Cmd_Assert(1, 0, 0, FM_GlobalData.ChildQueue[0].CommandCode);
+    UtAssert_INT32_EQ(FM_ChildInit(), !CFE_SUCCESS);
 
-    UtAssert_STUB_COUNT(OS_rename, 1);
+    UtAssert_STUB_COUNT(CFE_ES_CreateChildTask, 1);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_RENAME_CMD_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHILD_INIT_WRITER_ERR_EID);
 }
 
-void Test_FM_ChildProcess_FMDeleteCC(void)
+void Test_FM_ChildInit_CrcDoneSemCreateNotSuccess(void)
 {
-    /* Arrange */
-    FM_GlobalData.ChildQueue[0].CommandCode = FM_DELETE_FILE_CC;
+    /* Arrange - the completion semaphore follows the copy buffer semaphores */
+    UT_SetDeferredRetcode(UT_KEY(OS_CountSemCreate), 2 + (2 * FM_CHILD_TASK_COUNT), !CFE_SUCCESS);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildProcess());
-
-    /* Assert */
-    UT_FM_Child_Cmd_Assert(1, 0, 0, FM_GlobalData.ChildQueue[0].CommandCode);
+    UtAssert_INT32_EQ(FM_ChildInit(), !CFE_SUCCESS);
 
-    UtAssert_STUB_COUNT(OS_remove, 1);
+    UtAssert_STUB_COUNT(CFE_ES_CreateChildTask, FM_CHILD_TASK_COUNT);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_CMD_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHILD_INIT_CRC_HELPER_ERR_EID);
 }
 
-void Test_FM_ChildProcess_FMDeleteAllCC(void)
+void Test_FM_ChildInit_CrcHelperMutSemCreateNotSuccess(void)
 {
-    /* Arrange */
-    FM_GlobalData.ChildQueue[0].CommandCode = FM_DELETE_ALL_FILES_CC;
-
-    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryOpen), !OS_SUCCESS);
+    /* Arrange - the helper mutex follows the CRC cache mutex */
+    UT_SetDeferredRetcode(UT_KEY(OS_MutSemCreate), 6, !CFE_SUCCESS);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildProcess());
-
-    /* Assert */
-    UT_FM_Child_Cmd_Assert(0, 1, 0, FM_GlobalData.ChildQueue[0].CommandCode);
+    UtAssert_INT32_EQ(FM_ChildInit(), !CFE_SUCCESS);
 
-    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryClose, 0);
+    UtAssert_STUB_COUNT(CFE_ES_CreateChildTask, FM_CHILD_TASK_COUNT);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_ALL_OS_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHILD_INIT_CRC_HELPER_ERR_EID);
 }
 
-void Test_FM_ChildProcess_FMDecompressCC(void)
+void Test_FM_ChildInit_CreateCrcHelperTaskNotSuccess(void)
 {
-    /* Arrange */
-    FM_GlobalData.ChildQueue[0].CommandCode = FM_DECOMPRESS_FILE_CC;
-
-    UT_SetDefaultReturnValue(UT_KEY(FM_Decompress_Impl), !CFE_SUCCESS);
+    /* Arrange - the first helper task follows the copy writer tasks */
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_CreateChildTask), FM_CHILD_TASK_COUNT + 1, !CFE_SUCCESS);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildProcess());
-
-    /* Assert */
-    UT_FM_Child_Cmd_Assert(0, 1, 0, FM_GlobalData.ChildQueue[0].CommandCode);
+    UtAssert_INT32_EQ(FM_ChildInit(), !CFE_SUCCESS);
 
-    UtAssert_STUB_COUNT(FM_Decompress_Impl, 1);
+    UtAssert_STUB_COUNT(CFE_ES_CreateChildTask, FM_CHILD_TASK_COUNT + 1);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DECOM_CFE_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHILD_INIT_CRC_HELPER_ERR_EID);
 }
 
-void Test_FM_ChildProcess_FMConcatCC(void)
+void Test_FM_ChildInit_MuteSemCreateSuccess_CreateChildTaskNotSuccess(void)
 {
-    /* Arrange */
-    FM_GlobalData.ChildQueue[0].CommandCode = FM_CONCAT_FILES_CC;
-    FM_GlobalData.ChildCurrentCC            = 1;
-
-    UT_SetDefaultReturnValue(UT_KEY(OS_cp), !OS_SUCCESS);
+    /* Arrange - every copy writer and CRC helper task is created before the first child task */
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_CreateChildTask), FM_CHILD_TASK_COUNT + FM_CHILD_CRC_HELPERS + 1,
+                          !CFE_SUCCESS);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildProcess());
-
-    /* Assert */
-    UT_FM_Child_Cmd_Assert(0, 1, 0, FM_GlobalData.ChildQueue[0].CommandCode);
+    UtAssert_INT32_EQ(FM_ChildInit(), !CFE_SUCCESS);
 
-    UtAssert_STUB_COUNT(OS_cp, 1);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CONCAT_OSCPY_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHILD_INIT_CREATE_ERR_EID);
 }
 
-void Test_FM_ChildProcess_FMCreateDirCC(void)
+void Test_FM_ChildInit_ReturnSuccess(void)
+{
+    UtAssert_INT32_EQ(FM_ChildInit(), CFE_SUCCESS);
+
+    UtAssert_STUB_COUNT(OS_CountSemCreate, 2 + (2 * FM_CHILD_TASK_COUNT) + FM_CHILD_CRC_HELPERS);
+    UtAssert_STUB_COUNT(OS_MutSemCreate, 6);
+    UtAssert_STUB_COUNT(CFE_ES_CreateChildTask, (2 * FM_CHILD_TASK_COUNT) + FM_CHILD_CRC_HELPERS);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+/* ****************
+ * ChildTask Tests
+ * ***************/
+void Test_FM_ChildTask_ChildLoopCalled(void)
 {
     /* Arrange */
-    FM_GlobalData.ChildQueue[0].CommandCode = FM_CREATE_DIRECTORY_CC;
-    FM_GlobalData.ChildCurrentCC            = 1;
+    FM_GlobalData.ChildSemaphore = FM_UT_OBJID_1;
 
-    UT_SetDefaultReturnValue(UT_KEY(OS_mkdir), !OS_SUCCESS);
+    UT_SetDefaultReturnValue(UT_KEY(OS_CountSemTake), !CFE_SUCCESS);
+    UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), !OS_SUCCESS);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildProcess());
+    UtAssert_VOIDCALL(FM_ChildTask());
 
-    /* Assert */
-    UT_FM_Child_Cmd_Assert(0, 1, 0, FM_GlobalData.ChildQueue[0].CommandCode);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_STUB_COUNT(CFE_ES_ExitChildTask, 1);
 
-    UtAssert_STUB_COUNT(OS_mkdir, 1);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CREATE_DIR_OS_ERR_EID);
+    /* Assert */
+    /* SendEvent called once in ChildTask and should be called once in ChildLoop */
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHILD_INIT_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_CHILD_TERM_SEM_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_ERROR);
 }
 
-void Test_FM_ChildProcess_FMDeleteDirCC(void)
+void Test_FM_ChildTask_OtherWorkerRunning(void)
 {
     /* Arrange */
-    FM_GlobalData.ChildQueue[0].CommandCode = FM_DELETE_DIRECTORY_CC;
-    FM_GlobalData.ChildCurrentCC            = 1;
+    FM_GlobalData.ChildSemaphore   = FM_UT_OBJID_1;
+    FM_GlobalData.ChildTaskStarted = FM_CHILD_TASK_COUNT - 1;
+    FM_GlobalData.ChildTaskCount   = 1;
 
-    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryOpen), !OS_SUCCESS);
+    UT_SetDefaultReturnValue(UT_KEY(OS_CountSemTake), !CFE_SUCCESS);
+    UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), !OS_SUCCESS);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildProcess());
+    UtAssert_VOIDCALL(FM_ChildTask());
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(0, 1, 0, FM_GlobalData.ChildQueue[0].CommandCode);
-
-    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_OPENDIR_OS_ERR_EID);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildWorker[FM_CHILD_TASK_COUNT - 1].WorkerIndex, FM_CHILD_TASK_COUNT - 1);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildTaskStarted, FM_CHILD_TASK_COUNT);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildTaskCount, 1);
+    UtAssert_BOOL_TRUE(OS_ObjectIdDefined(FM_GlobalData.ChildSemaphore));
+    UtAssert_STUB_COUNT(CFE_ES_ExitChildTask, 1);
 }
 
-void Test_FM_ChildProcess_FMGetFileInfoCC(void)
+void Test_FM_ChildTask_LastWorker(void)
 {
     /* Arrange */
-    FM_GlobalData.ChildQueue[0].CommandCode   = FM_GET_FILE_INFO_CC;
-    FM_GlobalData.ChildQueue[0].FileInfoCRC   = !FM_IGNORE_CRC;
-    FM_GlobalData.ChildQueue[0].FileInfoState = FM_NAME_IS_FILE_OPEN;
-    FM_GlobalData.ChildCurrentCC              = 1;
+    FM_GlobalData.ChildSemaphore = FM_UT_OBJID_1;
 
-    UT_SetDefaultReturnValue(UT_KEY(CFE_MSG_Init), CFE_SUCCESS);
+    UT_SetDefaultReturnValue(UT_KEY(OS_CountSemTake), !CFE_SUCCESS);
+    UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), !OS_SUCCESS);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildProcess());
+    UtAssert_VOIDCALL(FM_ChildTask());
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(1, 0, 1, FM_GlobalData.ChildQueue[0].CommandCode);
-
-    UtAssert_STUB_COUNT(CFE_MSG_Init, 1);
-    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_FILE_INFO_STATE_WARNING_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_GET_FILE_INFO_CMD_INF_EID);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildTaskCount, 0);
+    UtAssert_BOOL_FALSE(OS_ObjectIdDefined(FM_GlobalData.ChildSemaphore));
 }
 
-void Test_FM_ChildProcess_FMGetDirListsFileCC(void)
+void Test_FM_ChildTask_NoWorkerSlot(void)
 {
     /* Arrange */
-    FM_GlobalData.ChildQueue[0].CommandCode = FM_GET_DIR_LIST_FILE_CC;
-    FM_GlobalData.ChildCurrentCC            = 1;
-
-    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryOpen), !OS_SUCCESS);
+    FM_GlobalData.ChildTaskStarted = FM_CHILD_TASK_COUNT;
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildProcess());
+    UtAssert_VOIDCALL(FM_ChildTask());
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(0, 1, 0, FM_GlobalData.ChildQueue[0].CommandCode);
-
-    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_FILE_OSOPENDIR_ERR_EID);
+    UtAssert_STUB_COUNT(OS_CountSemTake, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UtAssert_STUB_COUNT(CFE_ES_ExitChildTask, 1);
 }
 
-void Test_FM_ChildProcess_FMGetDirListsPktCC(void)
+/* ****************
+ * ChildWriterTask Tests
+ * ***************/
+void Test_FM_ChildWriterTask_WriterLoopReturns(void)
 {
     /* Arrange */
-    FM_GlobalData.ChildQueue[0].CommandCode = FM_GET_DIR_LIST_PKT_CC;
-    FM_GlobalData.ChildCurrentCC            = 1;
-
-    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryRead), !OS_SUCCESS);
+    UT_SetDefaultReturnValue(UT_KEY(OS_CountSemTake), !CFE_SUCCESS);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildProcess());
+    UtAssert_VOIDCALL(FM_ChildWriterTask());
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(1, 0, 0, FM_GlobalData.ChildQueue[0].CommandCode);
-
-    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryRead, 1);
-    UtAssert_STUB_COUNT(CFE_MSG_Init, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildWriterStarted, 1);
+    UtAssert_BOOL_FALSE(UT_FM_WORKER->WriterRunning);
+    UtAssert_BOOL_TRUE(UT_FM_WORKER->CopyWriteFailed);
+    UtAssert_STUB_COUNT(OS_CountSemGive, FM_CHILD_COPY_BUFFER_COUNT);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_PKT_CMD_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHILD_WRITER_TERM_ERR_EID);
+    UtAssert_STUB_COUNT(CFE_ES_ExitChildTask, 1);
 }
 
-void Test_FM_ChildProcess_FMSetFilePermCC(void)
+void Test_FM_ChildWriterTask_NoWorkerSlot(void)
 {
     /* Arrange */
-    FM_GlobalData.ChildQueue[0].CommandCode = FM_SET_PERMISSIONS_CC;
-    FM_GlobalData.ChildCurrentCC            = 1;
-
-    UT_SetDefaultReturnValue(UT_KEY(OS_chmod), !OS_SUCCESS);
+    FM_GlobalData.ChildWriterStarted = FM_CHILD_TASK_COUNT;
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildProcess());
+    UtAssert_VOIDCALL(FM_ChildWriterTask());
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(0, 1, 0, FM_GlobalData.ChildQueue[0].CommandCode);
-
-    UtAssert_STUB_COUNT(OS_chmod, 1);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_SET_PERM_OS_ERR_EID);
+    UtAssert_STUB_COUNT(OS_CountSemTake, 0);
+    UtAssert_STUB_COUNT(OS_CountSemGive, 0);
+    UtAssert_STUB_COUNT(CFE_ES_ExitChildTask, 1);
 }
 
-void Test_FM_ChildProcess_DefaultSwitch(void)
+void Test_FM_ChildWriterLoop_DrainInFillOrder(void)
 {
-    /* Arrange */
-    FM_GlobalData.ChildQueue[0].CommandCode = -1;
+    /* Arrange - drain one buffer, then fail the semaphore take */
+    UT_FM_WORKER->CopyLength[0] = 10;
+    UT_FM_WORKER->CopyLength[1] = 20;
+
+    UT_SetDeferredRetcode(UT_KEY(OS_CountSemTake), 3, !CFE_SUCCESS);
+    UT_SetDeferredRetcode(UT_KEY(OS_write), 1, 10);
+    UT_SetDeferredRetcode(UT_KEY(OS_write), 1, 20);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildProcess());
+    UtAssert_VOIDCALL(FM_ChildWriterLoop(UT_FM_WORKER));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(0, 1, 0, 0);
-
+    UtAssert_STUB_COUNT(OS_write, 2);
+    UtAssert_STUB_COUNT(OS_CountSemGive, 2);
+    UtAssert_UINT32_EQ(UT_FM_WORKER->CopyBytes, 30);
+    UtAssert_BOOL_FALSE(UT_FM_WORKER->CopyWriteFailed);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHILD_EXE_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHILD_WRITER_TERM_ERR_EID);
 }
 
 /* ****************
- * ChildCopyCmd Tests
+ * ChildCrcHelperTask Tests
  * ***************/
-void Test_FM_ChildCopyCmd_OScpIsSuccess(void)
+void Test_FM_ChildCrcHelperTask_HelperLoopReturns(void)
 {
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_COPY_FILE_CC};
+    /* Arrange */
+    UT_SetDefaultReturnValue(UT_KEY(OS_CountSemTake), !CFE_SUCCESS);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildCopyCmd(&queue_entry));
-
-    /* Assert */
-    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+    UtAssert_VOIDCALL(FM_ChildCrcHelperTask());
 
+    /* Assert - no range was waiting on the helper */
+    UtAssert_INT32_EQ(FM_GlobalData.CrcHelperStarted, 1);
+    UtAssert_BOOL_FALSE(FM_GlobalData.CrcHelper[0].Running);
+    UtAssert_STUB_COUNT(OS_CountSemGive, 0);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_COPY_CMD_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHILD_CRC_HELPER_TERM_ERR_EID);
+    UtAssert_STUB_COUNT(CFE_ES_ExitChildTask, 1);
 }
 
-void Test_FM_ChildCopyCmd_OScpNotSuccess(void)
+void Test_FM_ChildCrcHelperTask_RangePending(void)
 {
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_COPY_FILE_CC};
+    /* Arrange - a range was handed over as the helper failed */
+    FM_GlobalData.CrcHelper[0].Pending = 1;
 
-    /* Arrange */
-    UT_SetDefaultReturnValue(UT_KEY(OS_cp), !OS_SUCCESS);
+    UT_SetDefaultReturnValue(UT_KEY(OS_CountSemTake), !CFE_SUCCESS);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildCopyCmd(&queue_entry));
-
-    /* Assert */
-    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+    UtAssert_VOIDCALL(FM_ChildCrcHelperTask());
 
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_COPY_OS_ERR_EID);
+    /* Assert - the child task waiting on the range is released */
+    UtAssert_INT32_EQ(FM_GlobalData.CrcHelper[0].Result, OS_ERROR);
+    UtAssert_UINT32_EQ(FM_GlobalData.CrcHelper[0].Pending, 0);
+    UtAssert_STUB_COUNT(OS_CountSemGive, 1);
 }
 
-/* ****************
- * ChildMoveCmd Tests
- * ***************/
-void Test_FM_ChildMoveCmd_OSmvNotSuccess(void)
+void Test_FM_ChildCrcHelperTask_NoHelperSlot(void)
 {
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_MOVE_FILE_CC};
-
     /* Arrange */
-    UT_SetDefaultReturnValue(UT_KEY(OS_mv), !OS_SUCCESS);
+    FM_GlobalData.CrcHelperStarted = FM_CHILD_CRC_HELPERS;
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildMoveCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildCrcHelperTask());
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
-
-    UtAssert_STUB_COUNT(OS_mv, 1);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_MOVE_OS_ERR_EID);
+    UtAssert_STUB_COUNT(OS_CountSemTake, 0);
+    UtAssert_STUB_COUNT(OS_CountSemGive, 0);
+    UtAssert_STUB_COUNT(CFE_ES_ExitChildTask, 1);
 }
 
-void Test_FM_ChildMoveCmd_OSmvSuccess(void)
+void Test_FM_ChildCrcHelperLoop_OneRange(void)
 {
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_MOVE_FILE_CC};
+    FM_CrcHelper_t *Helper = &FM_GlobalData.CrcHelper[0];
 
-    /* Act */
-    UtAssert_VOIDCALL(FM_ChildMoveCmd(&queue_entry));
+    /* Arrange - compute one range, then fail the semaphore take */
+    strncpy(Helper->Path, "source1", OS_MAX_PATH_LEN - 1);
+    Helper->Offset  = 0;
+    Helper->Length  = FM_CHILD_FILE_BLOCK_SIZE;
+    Helper->Pending = 1;
 
-    /* Assert */
-    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+    UT_SetDeferredRetcode(UT_KEY(OS_CountSemTake), 2, !CFE_SUCCESS);
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), FM_CHILD_FILE_BLOCK_SIZE);
+    UT_SetDefaultReturnValue(UT_KEY(FM_CalculateCRC), 0x55);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildCrcHelperLoop(Helper, 0));
 
-    UtAssert_STUB_COUNT(OS_mv, 1);
+    /* Assert - the range ends at its length */
+    UtAssert_STUB_COUNT(OS_read, 1);
+    UtAssert_INT32_EQ(Helper->Result, OS_SUCCESS);
+    UtAssert_UINT32_EQ(Helper->BytesRead, FM_CHILD_FILE_BLOCK_SIZE);
+    UtAssert_UINT32_EQ(Helper->Crc, 0x55);
+    UtAssert_UINT32_EQ(Helper->Pending, 0);
+    UtAssert_STUB_COUNT(OS_CountSemGive, 1);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_MOVE_CMD_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHILD_CRC_HELPER_TERM_ERR_EID);
 }
 
 /* ****************
- * ChildRenameCmd Tests
+ * ChildSelectLane Tests
  * ***************/
-void Test_FM_ChildRenameCmd_OSRenameSuccess(void)
+void Test_FM_ChildSelectLane_FastFirst(void)
 {
     /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_RENAME_FILE_CC};
+    FM_GlobalData.ChildLane[FM_CHILD_LANE_FAST].WriteIndex = 1;
+    FM_GlobalData.ChildLane[FM_CHILD_LANE_BULK].WriteIndex = 1;
 
-    /* Act */
-    UtAssert_VOIDCALL(FM_ChildRenameCmd(&queue_entry));
+    /* Act/Assert */
+    UtAssert_INT32_EQ(FM_ChildSelectLane(), FM_CHILD_LANE_FAST);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildFastBurst, 1);
+}
 
-    /* Assert */
-    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+void Test_FM_ChildSelectLane_BurstLimit(void)
+{
+    /* Arrange */
+    FM_GlobalData.ChildLane[FM_CHILD_LANE_FAST].WriteIndex = 1;
+    FM_GlobalData.ChildLane[FM_CHILD_LANE_BULK].WriteIndex = 1;
+    FM_GlobalData.ChildFastBurst                           = FM_CHILD_FAST_LANE_BURST;
+
+    /* Act/Assert */
+    UtAssert_INT32_EQ(FM_ChildSelectLane(), FM_CHILD_LANE_BULK);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildFastBurst, 0);
+    UtAssert_STUB_COUNT(FM_ChildLaneOverlaps, 1);
+}
 
-    UtAssert_STUB_COUNT(OS_rename, 1);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_RENAME_CMD_INF_EID);
+void Test_FM_ChildSelectLane_BurstLimitSameNames(void)
+{
+    /* Arrange - the bulk command works on a name a waiting fast command was sent for first */
+    FM_GlobalData.ChildLane[FM_CHILD_LANE_FAST].WriteIndex = 1;
+    FM_GlobalData.ChildLane[FM_CHILD_LANE_BULK].WriteIndex = 1;
+    FM_GlobalData.ChildFastBurst                           = FM_CHILD_FAST_LANE_BURST;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_ChildLaneOverlaps), true);
+
+    /* Act/Assert - the fast command still goes first */
+    UtAssert_INT32_EQ(FM_ChildSelectLane(), FM_CHILD_LANE_FAST);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildFastBurst, FM_CHILD_FAST_LANE_BURST);
+    UtAssert_STUB_COUNT(FM_GetSlotPaths, 1);
 }
 
-void Test_FM_ChildRenameCmd_OSRenameNotSuccess(void)
+void Test_FM_ChildSelectLane_BulkEmpty(void)
 {
     /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_RENAME_FILE_CC};
-
-    UT_SetDefaultReturnValue(UT_KEY(OS_rename), !OS_SUCCESS);
+    FM_GlobalData.ChildLane[FM_CHILD_LANE_FAST].WriteIndex = 1;
+    FM_GlobalData.ChildFastBurst                           = FM_CHILD_FAST_LANE_BURST;
 
-    /* Act */
-    UtAssert_VOIDCALL(FM_ChildRenameCmd(&queue_entry));
+    /* Act/Assert */
+    UtAssert_INT32_EQ(FM_ChildSelectLane(), FM_CHILD_LANE_FAST);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildFastBurst, 0);
+}
 
-    /* Assert */
-    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+void Test_FM_ChildSelectLane_FastEmpty(void)
+{
+    /* Arrange */
+    FM_GlobalData.ChildLane[FM_CHILD_LANE_BULK].WriteIndex = 1;
+    FM_GlobalData.ChildFastBurst                           = 1;
 
-    UtAssert_STUB_COUNT(OS_rename, 1);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_RENAME_OS_ERR_EID);
+    /* Act/Assert */
+    UtAssert_INT32_EQ(FM_ChildSelectLane(), FM_CHILD_LANE_BULK);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildFastBurst, 0);
 }
 
 /* ****************
- * ChildDeleteCmd Tests
+ * ChildLoadPath Tests
  * ***************/
-void Test_FM_ChildDeleteCmd_OSRemoveSuccess(void)
+void Test_FM_ChildLoadPath_Empty(void)
 {
     /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DELETE_FILE_CC};
+    char Path[OS_MAX_PATH_LEN] = "stale";
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildDeleteCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildLoadPath(0, Path, sizeof(Path)));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
-
-    UtAssert_STUB_COUNT(OS_remove, 1);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_CMD_INF_EID);
+    UtAssert_STRINGBUF_EQ(Path, sizeof(Path), "", -1);
 }
 
-void Test_FM_ChildDeleteCmd_OSRemoveNotSuccess(void)
+void Test_FM_ChildLoadPath_Chain(void)
 {
     /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DELETE_FILE_CC};
+    char                 Path[OS_MAX_PATH_LEN];
+    FM_ChildPathBlock_t *First  = &FM_GlobalData.ChildPathBlock[2];
+    FM_ChildPathBlock_t *Second = &FM_GlobalData.ChildPathBlock[0];
 
-    UT_SetDefaultReturnValue(UT_KEY(OS_remove), !OS_SUCCESS);
+    memset(First->Data, 'a', sizeof(First->Data));
+    First->Next  = 1;
+    First->InUse = 1;
+
+    strncpy(Second->Data, "bc", sizeof(Second->Data) - 1);
+    Second->InUse = 1;
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildDeleteCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildLoadPath(3, Path, sizeof(Path)));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+    UtAssert_UINT32_EQ(strlen(Path), FM_CHILD_PATH_BLOCK_SIZE + 2);
+    UtAssert_INT32_EQ(Path[0], 'a');
+    UtAssert_STRINGBUF_EQ(&Path[FM_CHILD_PATH_BLOCK_SIZE], sizeof(Path) - FM_CHILD_PATH_BLOCK_SIZE, "bc", -1);
+    UtAssert_UINT32_EQ(First->InUse, 0);
+    UtAssert_UINT32_EQ(Second->InUse, 0);
+}
 
-    UtAssert_STUB_COUNT(OS_remove, 1);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_OS_ERR_EID);
+void Test_FM_ChildLoadPath_Truncated(void)
+{
+    /* Arrange */
+    char                 Path[4];
+    FM_ChildPathBlock_t *First  = &FM_GlobalData.ChildPathBlock[0];
+    FM_ChildPathBlock_t *Second = &FM_GlobalData.ChildPathBlock[1];
+
+    memset(First->Data, 'a', sizeof(First->Data));
+    First->Next  = 2;
+    First->InUse = 1;
+
+    memset(Second->Data, 'b', sizeof(Second->Data));
+    Second->InUse = 1;
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildLoadPath(1, Path, sizeof(Path)));
+
+    /* Assert - the name is cut short but the whole chain is released */
+    UtAssert_STRINGBUF_EQ(Path, sizeof(Path), "aaa", -1);
+    UtAssert_UINT32_EQ(First->InUse, 0);
+    UtAssert_UINT32_EQ(Second->InUse, 0);
 }
 
 /* ****************
- * ChildDeleteAllFilesCmd Tests
+ * ChildClaimPaths Tests
  * ***************/
-void Test_FM_ChildDeleteAllFilesCmd_DirOpenNotSuccess(void)
+void Test_FM_ChildClaimPaths_SkipsZero(void)
 {
-    /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {
-        .CommandCode = FM_DELETE_ALL_FILES_CC, .Source1 = "source1", .Source2 = "source2"};
-
-    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryOpen), !OS_SUCCESS);
+    /* Arrange - the dispatch number is about to wrap */
+    FM_GlobalData.ChildDispatchSeq = 0xFFFFFFFF;
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildDeleteAllFilesCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildClaimPaths(UT_FM_WORKER));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
-
-    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryClose, 0);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_ALL_OS_ERR_EID);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildDispatchSeq, 1);
+    UtAssert_UINT32_EQ(UT_FM_WORKER->InFlightSeq, 1);
+    UtAssert_STUB_COUNT(FM_GetEntryPaths, 1);
 }
 
-void Test_FM_ChildDeleteAllFilesCmd_DirReadNotSuccess(void)
+/* ****************
+ * ChildPathsBusy Tests
+ * ***************/
+/* A command can only wait for one taken by another worker */
+#if (FM_CHILD_TASK_COUNT > 1)
+void Test_FM_ChildPathsBusy_EarlierOverlap(void)
 {
     /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {
-        .CommandCode = FM_DELETE_ALL_FILES_CC, .Source1 = "source1", .Source2 = "source2"};
+    FM_ChildWorker_t *Other = &FM_GlobalData.ChildWorker[FM_CHILD_TASK_COUNT - 1];
 
-    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryRead), !OS_SUCCESS);
+    /* The other worker took its command just before the number wrapped */
+    Other->InFlightSeq        = 0xFFFFFFFF;
+    UT_FM_WORKER->InFlightSeq = 1;
 
-    /* Act */
-    UtAssert_VOIDCALL(FM_ChildDeleteAllFilesCmd(&queue_entry));
+    UT_SetDefaultReturnValue(UT_KEY(FM_PathSetsOverlap), true);
 
-    /* Assert */
-    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+    /* Act/Assert */
+    UtAssert_BOOL_TRUE(FM_ChildPathsBusy(UT_FM_WORKER));
+    UtAssert_STUB_COUNT(FM_PathSetsOverlap, 1);
+}
 
-    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_ALL_CMD_INF_EID);
+void Test_FM_ChildPathsBusy_EarlierNoOverlap(void)
+{
+    /* Arrange */
+    FM_ChildWorker_t *Other = &FM_GlobalData.ChildWorker[FM_CHILD_TASK_COUNT - 1];
+
+    Other->InFlightSeq        = 1;
+    UT_FM_WORKER->InFlightSeq = 2;
+
+    /* Act/Assert */
+    UtAssert_BOOL_FALSE(FM_ChildPathsBusy(UT_FM_WORKER));
+    UtAssert_STUB_COUNT(FM_PathSetsOverlap, 1);
 }
 
-void Test_FM_ChildDeleteAllFilesCmd_DirEntryThisDirectory(void)
+void Test_FM_ChildPathsBusy_LaterOrIdle(void)
 {
     /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {
-        .CommandCode = FM_DELETE_ALL_FILES_CC, .Source1 = "source1", .Source2 = "source2"};
-    os_dirent_t direntry = {.FileName = FM_THIS_DIRECTORY};
+    FM_ChildWorker_t *Other = &FM_GlobalData.ChildWorker[FM_CHILD_TASK_COUNT - 1];
 
-    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
-    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_PathSetsOverlap), true);
 
+    /* Act/Assert - a command taken later never holds up an earlier one */
+    Other->InFlightSeq        = 3;
+    UT_FM_WORKER->InFlightSeq = 2;
+    UtAssert_BOOL_FALSE(FM_ChildPathsBusy(UT_FM_WORKER));
+
+    /* Act/Assert - nor does an idle worker */
+    Other->InFlightSeq = 0;
+    UtAssert_BOOL_FALSE(FM_ChildPathsBusy(UT_FM_WORKER));
+
+    UtAssert_STUB_COUNT(FM_PathSetsOverlap, 0);
+}
+#endif
+
+void Test_FM_ChildPathsBusy_OwnCommand(void)
+{
+    /* Arrange - the only command in flight is the worker's own */
+    UT_FM_WORKER->InFlightSeq = 2;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_PathSetsOverlap), true);
+
+    /* Act/Assert */
+    UtAssert_BOOL_FALSE(FM_ChildPathsBusy(UT_FM_WORKER));
+    UtAssert_STUB_COUNT(FM_PathSetsOverlap, 0);
+}
+
+/* ****************
+ * ChildWaitForPaths Tests
+ * ***************/
+void Test_FM_ChildWaitForPaths_Free(void)
+{
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildDeleteAllFilesCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildWaitForPaths(UT_FM_WORKER));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
-
-    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
-    UtAssert_STUB_COUNT(FM_GetFilenameState, 0);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_ALL_CMD_INF_EID);
+    UtAssert_STUB_COUNT(OS_MutSemTake, 1);
+    UtAssert_STUB_COUNT(OS_MutSemGive, 1);
+    UtAssert_STUB_COUNT(OS_TaskDelay, 0);
 }
 
-void Test_FM_ChildDeleteAllFilesCmd_DirEntryParentDirectory(void)
+#if (FM_CHILD_TASK_COUNT > 1)
+void Test_FM_ChildWaitForPaths_Busy(void)
 {
     /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {
-        .CommandCode = FM_DELETE_ALL_FILES_CC, .Source1 = "source1", .Source2 = "source2"};
-    os_dirent_t direntry = {.FileName = FM_PARENT_DIRECTORY};
+    FM_ChildWorker_t *Other = &FM_GlobalData.ChildWorker[FM_CHILD_TASK_COUNT - 1];
 
-    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
-    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    Other->InFlightSeq        = 1;
+    UT_FM_WORKER->InFlightSeq = 2;
+
+    /* The earlier command is still running at the first check */
+    UT_SetDeferredRetcode(UT_KEY(FM_PathSetsOverlap), 1, true);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildDeleteAllFilesCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildWaitForPaths(UT_FM_WORKER));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+    UtAssert_STUB_COUNT(FM_PathSetsOverlap, 2);
+    UtAssert_STUB_COUNT(OS_MutSemTake, 2);
+    UtAssert_STUB_COUNT(OS_MutSemGive, 2);
+    UtAssert_STUB_COUNT(OS_TaskDelay, 1);
+}
+#endif
 
-    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
-    UtAssert_STUB_COUNT(FM_GetFilenameState, 0);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_ALL_CMD_INF_EID);
+/* ****************
+ * ChildReleasePaths Tests
+ * ***************/
+void Test_FM_ChildReleasePaths(void)
+{
+    /* Arrange */
+    UT_FM_WORKER->InFlightSeq = 5;
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildReleasePaths(UT_FM_WORKER));
+
+    /* Assert */
+    UtAssert_UINT32_EQ(UT_FM_WORKER->InFlightSeq, 0);
+    UtAssert_STUB_COUNT(OS_MutSemTake, 1);
+    UtAssert_STUB_COUNT(OS_MutSemGive, 1);
 }
 
-void Test_FM_ChildDeleteAllFilesCmd_PathFilenameLengthGreaterMaxPthLen(void)
+/* ****************
+ * ChildProcess Tests
+ * ***************/
+void Test_FM_ChildProcess_DequeueToWorker(void)
 {
     /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DELETE_ALL_FILES_CC,
-                                        .Source1     = "source1",
-                                        .Source2     = "source2HasAReallyReallyLongNameSomeSayTheNameIs42Characters"};
-    os_dirent_t          direntry    = {.FileName = "ThisDirectory"};
+    FM_ChildWorker_t *Worker   = &FM_GlobalData.ChildWorker[FM_CHILD_TASK_COUNT - 1];
+    FM_ChildLane_t *  FastLane = &FM_GlobalData.ChildLane[FM_CHILD_LANE_FAST];
+    FM_ChildLane_t *  BulkLane = &FM_GlobalData.ChildLane[FM_CHILD_LANE_BULK];
 
-    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
-    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    OS_time_t DequeueTime = OS_TimeAssembleFromMilliseconds(0, 5);
+
+    /* A bulk command queued ahead of a fast command */
+    BulkLane->WriteIndex = 1;
+    FastLane->WriteIndex = 1;
+
+    UT_SetDataBuffer(UT_KEY(OS_GetLocalTime), &DequeueTime, sizeof(DequeueTime), false);
+
+    BulkLane->Queue[0].CommandCode = FM_COPY_FILE_CC;
+    FastLane->Queue[0].CommandCode = FM_DELETE_FILE_CC;
+    FastLane->Queue[0].Source1     = 1;
+
+    /* The source name is held in the first path block */
+    strncpy(FM_GlobalData.ChildPathBlock[0].Data, "file", sizeof(FM_GlobalData.ChildPathBlock[0].Data) - 1);
+    FM_GlobalData.ChildPathBlock[0].InUse = 1;
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildDeleteAllFilesCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildProcess(Worker));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(1, 0, 1, queue_entry.CommandCode);
-
-    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
-    UtAssert_STUB_COUNT(FM_GetFilenameState, 0);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_ALL_CMD_INF_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_DELETE_ALL_FILES_ND_WARNING_EID);
+    UtAssert_UINT32_EQ(FM_ChildQueueCount(), 1);
+    UtAssert_UINT32_EQ(FM_ChildLaneCount(FastLane), 0);
+    UtAssert_UINT32_EQ(FastLane->ReadIndex, 1);
+    UtAssert_UINT32_EQ(FM_ChildLaneCount(BulkLane), 1);
+    UtAssert_UINT32_EQ(BulkLane->ReadIndex, 0);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildDequeueCount, 1);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildQueueWaitLast, 5000);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildQueueWaitMax, 5000);
+    UtAssert_INT32_EQ(Worker->CmdArgs.CommandCode, FM_DELETE_FILE_CC);
+    UtAssert_STRINGBUF_EQ(Worker->CmdArgs.Source1, sizeof(Worker->CmdArgs.Source1), "file", -1);
+    UtAssert_STRINGBUF_EQ(Worker->CmdArgs.Target, sizeof(Worker->CmdArgs.Target), "", -1);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildPathBlock[0].InUse, 0);
+    UtAssert_INT32_EQ(Worker->CmdCounter, 1);
+    UtAssert_INT32_EQ(Worker->PreviousCC, FM_DELETE_FILE_CC);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildDispatchSeq, 1);
+    UtAssert_UINT32_EQ(Worker->InFlightSeq, 0);
+    UtAssert_STUB_COUNT(FM_GetEntryPaths, 1);
+    UtAssert_STUB_COUNT(OS_TaskDelay, 0);
+
+    /* Dequeue, check for an earlier command on the same names, and release */
+    UtAssert_STUB_COUNT(OS_MutSemTake, 3);
+    UtAssert_STUB_COUNT(OS_MutSemGive, 3);
 }
 
-void Test_FM_ChildDeleteAllFilesCmd_InvalidFilenameState(void)
+#if (FM_CHILD_TASK_COUNT > 1)
+void Test_FM_ChildProcess_WaitsForEarlierCommand(void)
 {
     /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {
-        .CommandCode = FM_DELETE_ALL_FILES_CC, .Source1 = "source1", .Source2 = "source2"};
-    os_dirent_t direntry = {.FileName = "ThisDirectory"};
+    FM_ChildWorker_t *Other = &FM_GlobalData.ChildWorker[FM_CHILD_TASK_COUNT - 1];
 
-    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
-    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
-    UT_SetDefaultReturnValue(UT_KEY(FM_GetFilenameState), FM_NAME_IS_INVALID);
+    /* Another worker is still copying the file this delete command removes */
+    Other->InFlightSeq             = 1;
+    FM_GlobalData.ChildDispatchSeq = 1;
+    UT_FM_QUEUE[0].CommandCode     = FM_DELETE_FILE_CC;
+
+    UT_SetDeferredRetcode(UT_KEY(FM_PathSetsOverlap), 1, true);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildDeleteAllFilesCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildProcess(UT_FM_WORKER));
 
-    /* Assert */
-    UT_FM_Child_Cmd_Assert(1, 0, 1, queue_entry.CommandCode);
+    /* Assert - the delete ran only after one wait */
+    UT_FM_Child_Cmd_Assert(1, 0, 0, FM_DELETE_FILE_CC);
 
-    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
-    UtAssert_STUB_COUNT(FM_GetFilenameState, 1);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_ALL_CMD_INF_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_DELETE_ALL_FILES_ND_WARNING_EID);
+    UtAssert_STUB_COUNT(OS_TaskDelay, 1);
+    UtAssert_STUB_COUNT(OS_remove, 1);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildDispatchSeq, 2);
+    UtAssert_UINT32_EQ(UT_FM_WORKER->InFlightSeq, 0);
+    UtAssert_UINT32_EQ(Other->InFlightSeq, 1);
 }
+#endif
 
-void Test_FM_ChildDeleteAllFilesCmd_NotInUseFilenameState(void)
+void Test_FM_ChildProcess_FlushedSlotSkipped(void)
 {
     /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {
-        .CommandCode = FM_DELETE_ALL_FILES_CC, .Source1 = "source1", .Source2 = "source2"};
-    os_dirent_t direntry = {.FileName = "ThisDirectory"};
+    FM_ChildLane_t *BulkLane = &FM_GlobalData.ChildLane[FM_CHILD_LANE_BULK];
 
-    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
-    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
-    UT_SetDefaultReturnValue(UT_KEY(FM_GetFilenameState), FM_NAME_IS_NOT_IN_USE);
+    /* A command dropped by a flush queue command */
+    UT_FM_QUEUE[0].CommandCode = FM_DELETE_FILE_CC;
+    UT_FM_QUEUE[0].Flushed     = true;
+    BulkLane->WriteIndex       = 1;
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildDeleteAllFilesCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildProcess(UT_FM_WORKER));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(1, 0, 1, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(0, 0, 0, 0);
 
-    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
-    UtAssert_STUB_COUNT(FM_GetFilenameState, 1);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_ALL_CMD_INF_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_DELETE_ALL_FILES_ND_WARNING_EID);
+    UtAssert_UINT32_EQ(BulkLane->ReadIndex, 1);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildDequeueCount, 1);
+    UtAssert_UINT32_EQ(UT_FM_WORKER->CmdSequence, 0);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildDispatchSeq, 0);
+    UtAssert_STUB_COUNT(OS_remove, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
-void Test_FM_ChildDeleteAllFilesCmd_DirectoryFilenameState(void)
+void Test_FM_ChildProcess_CmdSequenceSkipsZero(void)
 {
     /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {
-        .CommandCode = FM_DELETE_ALL_FILES_CC, .Source1 = "source1", .Source2 = "source2"};
-    os_dirent_t direntry = {.FileName = "ThisDirectory"};
+    UT_FM_QUEUE[0].CommandCode = FM_DELETE_FILE_CC;
 
-    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
-    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
-    UT_SetDefaultReturnValue(UT_KEY(FM_GetFilenameState), FM_NAME_IS_DIRECTORY);
+    /* The previous command was aborted and the sequence number is about to wrap */
+    UT_FM_WORKER->CmdSequence   = 0xFFFFFFFF;
+    UT_FM_WORKER->AbortSequence = 0xFFFFFFFF;
+    UT_FM_WORKER->Aborted       = true;
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildDeleteAllFilesCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildProcess(UT_FM_WORKER));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(1, 0, 1, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(1, 0, 0, FM_DELETE_FILE_CC);
 
-    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
-    UtAssert_STUB_COUNT(FM_GetFilenameState, 1);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_ALL_CMD_INF_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_DELETE_ALL_SKIP_WARNING_EID);
+    UtAssert_UINT32_EQ(UT_FM_WORKER->CmdSequence, 1);
+    UtAssert_BOOL_FALSE(UT_FM_WORKER->Aborted);
+    UtAssert_STUB_COUNT(OS_remove, 1);
 }
 
-void Test_FM_ChildDeleteAllFilesCmd_OpenFilenameState(void)
+void Test_FM_ChildProcess_ChildReadIndexGreaterChildQDepth(void)
 {
     /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {
-        .CommandCode = FM_DELETE_ALL_FILES_CC, .Source1 = "source1", .Source2 = "source2"};
-    os_dirent_t direntry = {.FileName = "ThisDirectory"};
+    FM_ChildLane_t *BulkLane = &FM_GlobalData.ChildLane[FM_CHILD_LANE_BULK];
 
-    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
-    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
-    UT_SetDefaultReturnValue(UT_KEY(FM_GetFilenameState), FM_NAME_IS_FILE_OPEN);
+    /* One command waiting in the last slot before the ring index wraps */
+    BulkLane->ReadIndex                                   = FM_CHILD_LANE_INDEX_WRAP - 1;
+    BulkLane->Queue[FM_CHILD_QUEUE_DEPTH - 1].CommandCode = -1;
+    FM_GlobalData.ChildQueueWaitMax                       = 0xFFFFFFFF;
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildDeleteAllFilesCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildProcess(UT_FM_WORKER));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(1, 0, 1, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(0, 1, 0, 0);
+    UtAssert_UINT32_EQ(BulkLane->ReadIndex, 0);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildQueueWaitMax, 0xFFFFFFFF);
 
-    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
-    UtAssert_STUB_COUNT(FM_GetFilenameState, 1);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_ALL_CMD_INF_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_DELETE_ALL_FILES_ND_WARNING_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHILD_EXE_ERR_EID);
 }
 
-void Test_FM_ChildDeleteAllFilesCmd_ClosedFilename_OSRmNotSuccess(void)
+void Test_FM_ChildProcess_FMCopyCC(void)
 {
     /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {
-        .CommandCode = FM_DELETE_ALL_FILES_CC, .Source1 = "source1", .Source2 = "source2"};
-    os_dirent_t direntry = {.FileName = "ThisDirectory"};
-
-    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
-    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
-    UT_SetDefaultReturnValue(UT_KEY(FM_GetFilenameState), FM_NAME_IS_FILE_CLOSED);
-    UT_SetDefaultReturnValue(UT_KEY(OS_remove), !OS_SUCCESS);
+    UT_FM_QUEUE[0].CommandCode = FM_COPY_FILE_CC;
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildDeleteAllFilesCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildProcess(UT_FM_WORKER));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(1, 0, 1, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(1, 0, 0, UT_FM_QUEUE[0].CommandCode);
 
-    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
-    UtAssert_STUB_COUNT(FM_GetFilenameState, 1);
-    UtAssert_STUB_COUNT(OS_remove, 1);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_STUB_COUNT(OS_cp, 0);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 2);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_ALL_CMD_INF_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_DELETE_ALL_FILES_ND_WARNING_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_COPY_CMD_INF_EID);
 }
 
-void Test_FM_ChildDeleteAllFilesCmd_ClosedFilename_OSrmSuccess(void)
+void Test_FM_ChildProcess_FMMoveCC(void)
 {
     /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {
-        .CommandCode = FM_DELETE_ALL_FILES_CC, .Source1 = "source1", .Source2 = "source2"};
-    os_dirent_t direntry = {.FileName = "ThisDirectory"};
-
-    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
-    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
-    UT_SetDefaultReturnValue(UT_KEY(FM_GetFilenameState), FM_NAME_IS_FILE_CLOSED);
+    UT_FM_QUEUE[0].CommandCode = FM_MOVE_FILE_CC;
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildDeleteAllFilesCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildProcess(UT_FM_WORKER));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(1, 0, 0, UT_FM_QUEUE[0].CommandCode);
 
-    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
-    UtAssert_STUB_COUNT(FM_GetFilenameState, 1);
-    UtAssert_STUB_COUNT(OS_remove, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryRewind, 1);
+    UtAssert_STUB_COUNT(OS_rename, 1);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_ALL_CMD_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_MOVE_CMD_INF_EID);
 }
 
-void Test_FM_ChildDeleteAllFilesCmd_FilenameStateDefaultReturn(void)
+void Test_FM_ChildProcess_FMRenameCC(void)
 {
     /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {
-        .CommandCode = FM_DELETE_ALL_FILES_CC, .Source1 = "source1", .Source2 = "source2"};
-    os_dirent_t direntry = {.FileName = "ThisDirectory"};
-
-    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
-    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
-    UT_SetDefaultReturnValue(UT_KEY(FM_GetFilenameState), -1); /* default case */
+    UT_FM_QUEUE[0].CommandCode = FM_RENAME_FILE_CC;
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildDeleteAllFilesCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildProcess(UT_FM_WORKER));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(1, 0, 1, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(1, 0, 0, UT_FM_QUEUE[0].CommandCode);
 
-    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
-    UtAssert_STUB_COUNT(FM_GetFilenameState, 1);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_STUB_COUNT(OS_rename, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_ALL_CMD_INF_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_DELETE_ALL_FILES_ND_WARNING_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_RENAME_CMD_INF_EID);
 }
 
-/* ****************
- * ChildDecompressFileCmd Tests
- * ***************/
+void Test_FM_ChildProcess_FMDeleteCC(void)
+{
+    /* Arrange */
+    UT_FM_QUEUE[0].CommandCode = FM_DELETE_FILE_CC;
 
-void Test_FM_ChildDecompressFileCmd_FSDecompressSuccess(void)
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildProcess(UT_FM_WORKER));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 0, UT_FM_QUEUE[0].CommandCode);
+
+    UtAssert_STUB_COUNT(OS_remove, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_CMD_INF_EID);
+}
+
+void Test_FM_ChildProcess_FMDeleteAllCC(void)
 {
     /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DECOMPRESS_FILE_CC};
+    UT_FM_QUEUE[0].CommandCode = FM_DELETE_ALL_FILES_CC;
 
-    FM_GlobalData.ChildCurrentCC = 1;
+    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryOpen), !OS_SUCCESS);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildDecompressFileCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildProcess(UT_FM_WORKER));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(0, 1, 0, UT_FM_QUEUE[0].CommandCode);
 
-    UtAssert_STUB_COUNT(FM_Decompress_Impl, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 0);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DECOM_CMD_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_ALL_OS_ERR_EID);
 }
 
-void Test_FM_ChildDecompressFileCmd_FSDecompressNotSuccess(void)
+void Test_FM_ChildProcess_FMDecompressCC(void)
 {
     /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DECOMPRESS_FILE_CC};
+    UT_FM_QUEUE[0].CommandCode = FM_DECOMPRESS_FILE_CC;
 
-    FM_GlobalData.ChildCurrentCC = 1;
     UT_SetDefaultReturnValue(UT_KEY(FM_Decompress_Impl), !CFE_SUCCESS);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildDecompressFileCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildProcess(UT_FM_WORKER));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(0, 1, 0, UT_FM_QUEUE[0].CommandCode);
 
     UtAssert_STUB_COUNT(FM_Decompress_Impl, 1);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
@@ -946,208 +1097,186 @@ void Test_FM_ChildDecompressFileCmd_FSDecompressNotSuccess(void)
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DECOM_CFE_ERR_EID);
 }
 
-/* ****************
- * ChildConcatFilesCmd Tests
- * ***************/
-void Test_FM_ChildConcatFilesCmd_OSCpNotSuccess(void)
+void Test_FM_ChildProcess_FMConcatCC(void)
 {
     /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_CONCAT_FILES_CC, .Source1 = "source1", .Source2 = "source2"};
+    UT_FM_QUEUE[0].CommandCode = FM_CONCAT_FILES_CC;
+    UT_FM_WORKER->CurrentCC                 = 1;
 
-    FM_GlobalData.ChildCurrentCC = 1;
-    UT_SetDefaultReturnValue(UT_KEY(OS_cp), !OS_SUCCESS);
+    UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), !OS_SUCCESS);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildConcatFilesCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildProcess(UT_FM_WORKER));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(0, 1, 0, UT_FM_QUEUE[0].CommandCode);
 
-    UtAssert_STUB_COUNT(OS_cp, 1);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CONCAT_OSCPY_ERR_EID);
 }
 
-void Test_FM_ChildConcatFilesCmd_OSOpenCreateSourceNotSuccess(void)
+void Test_FM_ChildProcess_FMConcatListCC(void)
 {
     /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_CONCAT_FILES_CC, .Source1 = "source1", .Source2 = "source2"};
+    UT_FM_QUEUE[0].CommandCode = FM_CONCAT_LIST_CC;
+    UT_FM_WORKER->CurrentCC    = 1;
 
     UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), !OS_SUCCESS);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildConcatFilesCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildProcess(UT_FM_WORKER));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(0, 1, 0, UT_FM_QUEUE[0].CommandCode);
 
-    UtAssert_STUB_COUNT(OS_cp, 1);
     UtAssert_STUB_COUNT(OS_OpenCreate, 1);
-    UtAssert_STUB_COUNT(OS_remove, 1);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CONCAT_OPEN_SRC2_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CONCAT_LIST_OPEN_TGT_ERR_EID);
 }
 
-void Test_FM_ChildConcatFilesCmd_OSOpenCreateTargetNotSuccess(void)
+void Test_FM_ChildProcess_FMCreateDirCC(void)
 {
     /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_CONCAT_FILES_CC, .Source1 = "source1", .Source2 = "source2"};
+    UT_FM_QUEUE[0].CommandCode = FM_CREATE_DIRECTORY_CC;
+    UT_FM_WORKER->CurrentCC                 = 1;
 
-    UT_SetDeferredRetcode(UT_KEY(OS_OpenCreate), 2, !OS_SUCCESS);
+    UT_SetDefaultReturnValue(UT_KEY(OS_mkdir), !OS_SUCCESS);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildConcatFilesCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildProcess(UT_FM_WORKER));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(0, 1, 0, UT_FM_QUEUE[0].CommandCode);
 
-    UtAssert_STUB_COUNT(OS_cp, 1);
-    UtAssert_STUB_COUNT(OS_OpenCreate, 2);
-    UtAssert_STUB_COUNT(OS_remove, 1);
-    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_STUB_COUNT(OS_mkdir, 1);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CONCAT_OPEN_TGT_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CREATE_DIR_OS_ERR_EID);
 }
 
-void Test_FM_ChildConcatFilesCmd_OSReadBytesZero(void)
+void Test_FM_ChildProcess_FMDeleteDirCC(void)
 {
     /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_CONCAT_FILES_CC, .Source1 = "source1", .Source2 = "source2"};
+    UT_FM_QUEUE[0].CommandCode = FM_DELETE_DIRECTORY_CC;
+    UT_FM_WORKER->CurrentCC                 = 1;
 
-    UT_SetDefaultReturnValue(UT_KEY(OS_read), 0);
+    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryOpen), !OS_SUCCESS);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildConcatFilesCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildProcess(UT_FM_WORKER));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(0, 1, 0, UT_FM_QUEUE[0].CommandCode);
 
-    UtAssert_STUB_COUNT(OS_read, 1);
-    UtAssert_STUB_COUNT(OS_cp, 1);
-    UtAssert_STUB_COUNT(OS_OpenCreate, 2);
-    UtAssert_STUB_COUNT(OS_remove, 0);
-    UtAssert_STUB_COUNT(OS_close, 2);
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CONCAT_CMD_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_OPENDIR_OS_ERR_EID);
 }
 
-void Test_FM_ChildConcatFilesCmd_OSReadBytesLessThanZero(void)
+void Test_FM_ChildProcess_FMDeleteTreeCC(void)
 {
-    /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_CONCAT_FILES_CC, .Source1 = "source1", .Source2 = "source2"};
+    /* Arrange - an empty tree */
+    UT_FM_QUEUE[0].CommandCode = FM_DELETE_TREE_CC;
+    UT_FM_WORKER->CurrentCC    = 1;
 
-    UT_SetDefaultReturnValue(UT_KEY(OS_read), -1);
+    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryRead), !OS_SUCCESS);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildConcatFilesCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildProcess(UT_FM_WORKER));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(1, 0, 0, UT_FM_QUEUE[0].CommandCode);
 
-    UtAssert_STUB_COUNT(OS_read, 1);
-    UtAssert_STUB_COUNT(OS_cp, 1);
-    UtAssert_STUB_COUNT(OS_OpenCreate, 2);
-    UtAssert_STUB_COUNT(OS_remove, 1);
-    UtAssert_STUB_COUNT(OS_close, 2);
+    UtAssert_STUB_COUNT(OS_rmdir, 1);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CONCAT_OSRD_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_TREE_CMD_INF_EID);
 }
 
-void Test_FM_ChildConcatFilesCmd_BytesWrittenNotEqualBytesRead(void)
+void Test_FM_ChildProcess_FMFilterFilesCC(void)
 {
-    /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_CONCAT_FILES_CC, .Source1 = "source1", .Source2 = "source2"};
+    /* Arrange - an empty directory */
+    UT_FM_QUEUE[0].CommandCode    = FM_FILTER_FILES_CC;
+    UT_FM_QUEUE[0].FilterAction   = FM_FILTER_ACTION_MOVE;
+    UT_FM_QUEUE[0].Filter.MaxSize = 100;
+    UT_FM_WORKER->CurrentCC       = 1;
 
-    UT_SetDefaultReturnValue(UT_KEY(OS_read), 1);
-    UT_SetDefaultReturnValue(UT_KEY(OS_write), 0);
+    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryRead), !OS_SUCCESS);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildConcatFilesCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildProcess(UT_FM_WORKER));
 
-    /* Assert */
-    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+    /* Assert - the action and filter are carried by the queue slot */
+    UT_FM_Child_Cmd_Assert(1, 0, 0, UT_FM_QUEUE[0].CommandCode);
 
-    UtAssert_STUB_COUNT(OS_read, 1);
-    UtAssert_STUB_COUNT(OS_cp, 1);
-    UtAssert_STUB_COUNT(OS_OpenCreate, 2);
-    UtAssert_STUB_COUNT(OS_remove, 1);
-    UtAssert_STUB_COUNT(OS_close, 2);
+    UtAssert_INT32_EQ(UT_FM_WORKER->CmdArgs.FilterAction, FM_FILTER_ACTION_MOVE);
+    UtAssert_UINT32_EQ(UT_FM_WORKER->CmdArgs.Filter.MaxSize, 100);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CONCAT_OSWR_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_FILTER_FILES_CMD_INF_EID);
 }
 
-void Test_FM_ChildConcatFilesCmd_CopyInProgressTrueLoopCountEqualChildFileLoopCount(void)
+void Test_FM_ChildProcess_FMEnforceRetentionCC(void)
 {
-    /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_CONCAT_FILES_CC, .Source1 = "source1", .Source2 = "source2"};
+    /* Arrange - a scheduled pass over an empty directory */
+    UT_FM_QUEUE[0].CommandCode      = FM_ENFORCE_RETENTION_CC;
+    UT_FM_QUEUE[0].RetentionIndex   = 1;
+    UT_FM_WORKER->CurrentCC         = 1;
+    FM_GlobalData.Retention[1].Busy = 1;
 
-    UT_SetDefaultReturnValue(UT_KEY(OS_read), 1);
-    UT_SetDefaultReturnValue(UT_KEY(OS_write), 1);
-    UT_SetDeferredRetcode(UT_KEY(OS_read), FM_CHILD_FILE_LOOP_COUNT + 1, -1);
+    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryRead), !OS_SUCCESS);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildConcatFilesCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildProcess(UT_FM_WORKER));
 
-    /* Assert */
-    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+    /* Assert - scheduled passes leave the counters alone and stay quiet */
+    UT_FM_Child_Cmd_Assert(0, 0, 0, UT_FM_QUEUE[0].CommandCode);
 
-    UtAssert_STUB_COUNT(OS_read, FM_CHILD_FILE_LOOP_COUNT + 1);
-    UtAssert_STUB_COUNT(OS_TaskDelay, 1);
-    UtAssert_STUB_COUNT(OS_cp, 1);
-    UtAssert_STUB_COUNT(OS_OpenCreate, 2);
-    UtAssert_STUB_COUNT(OS_remove, 1);
-    UtAssert_STUB_COUNT(OS_close, 2);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CONCAT_OSRD_ERR_EID);
+    UtAssert_UINT32_EQ(UT_FM_WORKER->CmdArgs.RetentionIndex, 1);
+    UtAssert_UINT32_EQ(FM_GlobalData.Retention[1].Busy, 0);
+    UtAssert_UINT32_EQ(FM_GlobalData.RetentionPassCount, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
-/* ****************
- * ChildFileInfoCmd Tests
- * ***************/
-void Test_FM_ChildFileInfoCmd_FileInfoCRCEqualIgnoreCRC(void)
+void Test_FM_ChildProcess_FMPurgeTrashCC(void)
 {
-    /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode   = FM_GET_FILE_INFO_CC,
-                                        .Source1       = "source1",
-                                        .Source2       = "source2",
-                                        .FileInfoCRC   = FM_IGNORE_CRC,
-                                        .FileInfoState = FM_NAME_IS_FILE_CLOSED};
+    /* Arrange - a scheduled pass with no trash directory claimed */
+    UT_FM_QUEUE[0].CommandCode   = FM_PURGE_TRASH_CC;
+    UT_FM_WORKER->CurrentCC      = 1;
+    FM_GlobalData.TrashPurgeBusy = 1;
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildFileInfoCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildProcess(UT_FM_WORKER));
 
-    /* Assert */
-    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+    /* Assert - scheduled passes leave the counters alone and stay quiet */
+    UT_FM_Child_Cmd_Assert(0, 0, 0, UT_FM_QUEUE[0].CommandCode);
 
-    UtAssert_STUB_COUNT(OS_OpenCreate, 0);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_FILE_INFO_CMD_INF_EID);
+    UtAssert_UINT32_EQ(FM_GlobalData.TrashPurgeBusy, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
-void Test_FM_ChildFileInfoCmd_FileInfoStateIsNotFileClosed(void)
+void Test_FM_ChildProcess_FMGetFileInfoCC(void)
 {
     /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode   = FM_GET_FILE_INFO_CC,
-                                        .Source1       = "source1",
-                                        .Source2       = "source2",
-                                        .FileInfoCRC   = CFE_ES_CrcType_CRC_8,
-                                        .FileInfoState = FM_NAME_IS_FILE_OPEN};
+    UT_FM_QUEUE[0].CommandCode   = FM_GET_FILE_INFO_CC;
+    UT_FM_QUEUE[0].FileInfoCRC   = !FM_IGNORE_CRC;
+    UT_FM_QUEUE[0].FileInfoState = FM_NAME_IS_FILE_OPEN;
+    UT_FM_WORKER->CurrentCC                   = 1;
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_MSG_Init), CFE_SUCCESS);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildFileInfoCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildProcess(UT_FM_WORKER));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(1, 0, 1, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(1, 0, 1, UT_FM_QUEUE[0].CommandCode);
 
-    UtAssert_STUB_COUNT(OS_OpenCreate, 0);
+    UtAssert_STUB_COUNT(CFE_MSG_Init, 1);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_FILE_INFO_STATE_WARNING_EID);
@@ -1155,362 +1284,334 @@ void Test_FM_ChildFileInfoCmd_FileInfoStateIsNotFileClosed(void)
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_GET_FILE_INFO_CMD_INF_EID);
 }
 
-void Test_FM_ChildFileInfoCmd_FileInfoCRCEqualMission8(void)
+void Test_FM_ChildProcess_FMGetFileDigestCC(void)
 {
-    /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode   = FM_GET_FILE_INFO_CC,
-                                        .Source1       = "source1",
-                                        .Source2       = "source2",
-                                        .FileInfoCRC   = CFE_ES_CrcType_CRC_8,
-                                        .FileInfoState = FM_NAME_IS_FILE_CLOSED};
-
-    UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), !OS_SUCCESS);
+    /* Arrange - an empty file */
+    UT_FM_QUEUE[0].CommandCode = FM_GET_FILE_DIGEST_CC;
+    UT_FM_QUEUE[0].FileInfoCRC = FM_DIGEST_ALL;
+    UT_FM_WORKER->CurrentCC    = 1;
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildFileInfoCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildProcess(UT_FM_WORKER));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(1, 0, 1, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(1, 0, 0, UT_FM_QUEUE[0].CommandCode);
 
-    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_FILE_INFO_OPEN_ERR_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_GET_FILE_INFO_CMD_INF_EID);
+    UtAssert_STUB_COUNT(FM_DigestFinish, 1);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_FILE_DIGEST_CMD_INF_EID);
 }
 
-void Test_FM_ChildFileInfoCmd_FileInfoCRCEqualMission16(void)
+void Test_FM_ChildProcess_FMGetDirListsFileCC(void)
 {
     /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode   = FM_GET_FILE_INFO_CC,
-                                        .Source1       = "source1",
-                                        .Source2       = "source2",
-                                        .FileInfoCRC   = CFE_ES_CrcType_CRC_16,
-                                        .FileInfoState = FM_NAME_IS_FILE_CLOSED};
+    UT_FM_QUEUE[0].CommandCode = FM_GET_DIR_LIST_FILE_CC;
+    UT_FM_WORKER->CurrentCC                 = 1;
 
-    UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), !OS_SUCCESS);
+    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryOpen), !OS_SUCCESS);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildFileInfoCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildProcess(UT_FM_WORKER));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(1, 0, 1, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(0, 1, 0, UT_FM_QUEUE[0].CommandCode);
 
-    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_FILE_INFO_OPEN_ERR_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_GET_FILE_INFO_CMD_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_FILE_OSOPENDIR_ERR_EID);
 }
 
-void Test_FM_ChildFileInfoCmd_FileInfoCRCEqualMission32(void)
+void Test_FM_ChildProcess_FMGetDirListsPktCC(void)
 {
     /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode   = FM_GET_FILE_INFO_CC,
-                                        .Source1       = "source1",
-                                        .Source2       = "source2",
-                                        .FileInfoCRC   = CFE_ES_CrcType_CRC_32,
-                                        .FileInfoState = FM_NAME_IS_FILE_CLOSED};
+    UT_FM_QUEUE[0].CommandCode = FM_GET_DIR_LIST_PKT_CC;
+    UT_FM_WORKER->CurrentCC                 = 1;
 
-    UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), !OS_SUCCESS);
+    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryRead), !OS_SUCCESS);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildFileInfoCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildProcess(UT_FM_WORKER));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(1, 0, 1, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(1, 0, 0, UT_FM_QUEUE[0].CommandCode);
 
-    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_FILE_INFO_OPEN_ERR_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_GET_FILE_INFO_CMD_INF_EID);
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 1);
+    UtAssert_STUB_COUNT(CFE_MSG_Init, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_PKT_CMD_INF_EID);
 }
 
-void Test_FM_ChildFileInfoCmd_FileInfoCRCNotEqualToAnyMissionES(void)
+void Test_FM_ChildProcess_FMSetFilePermCC(void)
 {
     /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode   = FM_GET_FILE_INFO_CC,
-                                        .Source1       = "source1",
-                                        .Source2       = "source2",
-                                        .FileInfoCRC   = -1,
-                                        .FileInfoState = FM_NAME_IS_FILE_CLOSED};
+    UT_FM_QUEUE[0].CommandCode = FM_SET_PERMISSIONS_CC;
+    UT_FM_WORKER->CurrentCC                 = 1;
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_chmod), !OS_SUCCESS);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildFileInfoCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildProcess(UT_FM_WORKER));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(1, 0, 1, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(0, 1, 0, UT_FM_QUEUE[0].CommandCode);
 
-    UtAssert_STUB_COUNT(OS_OpenCreate, 0);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_FILE_INFO_TYPE_WARNING_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_GET_FILE_INFO_CMD_INF_EID);
+    UtAssert_STUB_COUNT(OS_chmod, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_SET_PERM_OS_ERR_EID);
 }
 
-void Test_FM_ChildFileInfoCmd_OSOpenCreateTrueBytesReadZero(void)
+void Test_FM_ChildProcess_DefaultSwitch(void)
 {
     /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode   = FM_GET_FILE_INFO_CC,
-                                        .Source1       = "source1",
-                                        .Source2       = "source2",
-                                        .FileInfoCRC   = CFE_ES_CrcType_CRC_16,
-                                        .FileInfoState = FM_NAME_IS_FILE_CLOSED};
-
-    UT_SetDefaultReturnValue(UT_KEY(OS_read), 0);
+    UT_FM_QUEUE[0].CommandCode = -1;
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildFileInfoCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildProcess(UT_FM_WORKER));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(0, 1, 0, 0);
 
-    UtAssert_STUB_COUNT(OS_read, 1);
-    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
-    UtAssert_STUB_COUNT(OS_close, 1);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_FILE_INFO_CMD_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHILD_EXE_ERR_EID);
 }
 
-void Test_FM_ChildFileInfoCmd_BytesReadLessThanZero(void)
+void Test_FM_ChildProcess_ChildVerifyFails(void)
 {
-    /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode   = FM_GET_FILE_INFO_CC,
-                                        .Source1       = "source1",
-                                        .Source2       = "source2",
-                                        .FileInfoCRC   = CFE_ES_CrcType_CRC_16,
-                                        .FileInfoState = FM_NAME_IS_FILE_CLOSED};
+    /* Arrange - queued in FM_VERIFY_MODE_CHILD and the source is missing */
+    UT_FM_QUEUE[0].CommandCode = FM_COPY_FILE_CC;
+    UT_FM_QUEUE[0].ChildVerify = true;
 
-    UT_SetDefaultReturnValue(UT_KEY(OS_read), -1);
+    /* A snapshot left by the previous command */
+    UT_FM_WORKER->OpenPaths.Valid = true;
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildProcess(UT_FM_WORKER));
+
+    /* Assert - the copy handler never runs */
+    UT_FM_Child_Cmd_Assert(0, 1, 0, 0);
+
+    UtAssert_STUB_COUNT(FM_VerifyFileState, 1);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 0);
+    UtAssert_BOOL_FALSE(UT_FM_WORKER->OpenPaths.Valid);
+}
+
+/* ****************
+ * ChildCopyCmd Tests
+ * ***************/
+void Test_FM_ChildCopyCmd_CopySuccess(void)
+{
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_COPY_FILE_CC};
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildFileInfoCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildCopyCmd(UT_FM_WORKER, &queue_entry));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(1, 0, 1, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
 
-    UtAssert_STUB_COUNT(OS_read, 1);
-    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
-    UtAssert_STUB_COUNT(OS_close, 1);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_FILE_INFO_READ_WARNING_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_GET_FILE_INFO_CMD_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_COPY_CMD_INF_EID);
 }
 
-void Test_FM_ChildFileInfoCmd_BytesReadGreaterThanZero(void)
+void Test_FM_ChildCopyCmd_CopyNotSuccess(void)
 {
-    /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode   = FM_GET_FILE_INFO_CC,
-                                        .Source1       = "source1",
-                                        .Source2       = "source2",
-                                        .FileInfoCRC   = CFE_ES_CrcType_CRC_8,
-                                        .FileInfoState = FM_NAME_IS_FILE_CLOSED};
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_COPY_FILE_CC};
 
-    UT_SetDefaultReturnValue(UT_KEY(OS_read), 1);
-    UT_SetDeferredRetcode(UT_KEY(OS_read), FM_CHILD_FILE_LOOP_COUNT + 1, 0);
-    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_CalculateCRC), 0);
+    /* Arrange */
+    UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), !OS_SUCCESS);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildFileInfoCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildCopyCmd(UT_FM_WORKER, &queue_entry));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
 
-    UtAssert_STUB_COUNT(OS_read, FM_CHILD_FILE_LOOP_COUNT + 1);
-    UtAssert_STUB_COUNT(OS_TaskDelay, 1);
-    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
-    UtAssert_STUB_COUNT(OS_close, 1);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_FILE_INFO_CMD_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_COPY_OS_ERR_EID);
 }
 
 /* ****************
- * ChildCreateDirectoryCmd Tests
+ * ChildMoveCmd Tests
  * ***************/
-void Test_FM_ChildCreateDirectoryCmd_OSMkDirSuccess(void)
+void Test_FM_ChildMoveCmd_OSRenameNotSuccess_CopyNotSuccess(void)
 {
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_MOVE_FILE_CC};
+
     /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_CREATE_DIRECTORY_CC};
+    UT_SetDefaultReturnValue(UT_KEY(OS_rename), !OS_SUCCESS);
+    UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), !OS_SUCCESS);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildCreateDirectoryCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildMoveCmd(UT_FM_WORKER, &queue_entry));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
 
-    UtAssert_STUB_COUNT(OS_mkdir, 1);
+    UtAssert_STUB_COUNT(OS_rename, 1);
+    UtAssert_STUB_COUNT(OS_remove, 0);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CREATE_DIR_CMD_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_MOVE_OS_ERR_EID);
 }
 
-void Test_FM_ChildCreateDirectoryCmd_OSMkDirNotSuccess(void)
+void Test_FM_ChildMoveCmd_OSRenameNotSuccess_CopySuccess(void)
 {
-    /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_CREATE_DIRECTORY_CC};
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_MOVE_FILE_CC};
 
-    UT_SetDefaultReturnValue(UT_KEY(OS_mkdir), !CFE_SUCCESS);
+    /* Arrange - the target is on another volume */
+    UT_SetDefaultReturnValue(UT_KEY(OS_rename), !OS_SUCCESS);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildCreateDirectoryCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildMoveCmd(UT_FM_WORKER, &queue_entry));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
 
-    UtAssert_STUB_COUNT(OS_mkdir, 1);
+    UtAssert_STUB_COUNT(OS_rename, 1);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 2);
+    UtAssert_STUB_COUNT(OS_remove, 1);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CREATE_DIR_OS_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_MOVE_CMD_INF_EID);
 }
 
-/* ****************
- * ChildDeleteDirectoryCmd Tests
- * ***************/
-void Test_FM_ChildDeleteDirectoryCmd_OSDirectoryOpenNoSuccess(void)
+void Test_FM_ChildMoveCmd_OSRemoveNotSuccess(void)
 {
-    /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DELETE_DIRECTORY_CC};
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_MOVE_FILE_CC};
 
-    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryOpen), !OS_SUCCESS);
+    /* Arrange */
+    UT_SetDefaultReturnValue(UT_KEY(OS_rename), !OS_SUCCESS);
+    UT_SetDefaultReturnValue(UT_KEY(OS_remove), !OS_SUCCESS);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildDeleteDirectoryCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildMoveCmd(UT_FM_WORKER, &queue_entry));
 
     /* Assert */
     UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
 
-    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(OS_remove, 1);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_OPENDIR_OS_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_MOVE_OS_ERR_EID);
 }
 
-void Test_FM_ChildDeleteDirectoryCmd_OSDirectoryReadNoSuccess(void)
+void Test_FM_ChildMoveCmd_OSRenameSuccess(void)
 {
-    /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DELETE_DIRECTORY_CC};
-
-    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryRead), !OS_SUCCESS);
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_MOVE_FILE_CC};
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildDeleteDirectoryCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildMoveCmd(UT_FM_WORKER, &queue_entry));
 
     /* Assert */
     UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
 
-    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryRead, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
+    UtAssert_STUB_COUNT(OS_rename, 1);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 0);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_DIR_CMD_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_MOVE_CMD_INF_EID);
 }
 
-void Test_FM_ChildDeleteDirectoryCmd_StrCmpThisDirectoryZero(void)
+/* ****************
+ * ChildRenameCmd Tests
+ * ***************/
+void Test_FM_ChildRenameCmd_OSRenameSuccess(void)
 {
     /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DELETE_DIRECTORY_CC};
-    os_dirent_t          direntry    = {.FileName = FM_THIS_DIRECTORY};
-
-    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
-    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_RENAME_FILE_CC};
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildDeleteDirectoryCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildRenameCmd(UT_FM_WORKER, &queue_entry));
 
     /* Assert */
     UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
 
-    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
+    UtAssert_STUB_COUNT(OS_rename, 1);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_DIR_CMD_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_RENAME_CMD_INF_EID);
 }
 
-void Test_FM_ChildDeleteDirectoryCmd_StrCmpParentDirectoryZero(void)
+void Test_FM_ChildRenameCmd_OSRenameNotSuccess(void)
 {
     /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DELETE_DIRECTORY_CC};
-    os_dirent_t          direntry    = {.FileName = FM_PARENT_DIRECTORY};
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_RENAME_FILE_CC};
 
-    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDefaultReturnValue(UT_KEY(OS_rename), !OS_SUCCESS);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildDeleteDirectoryCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildRenameCmd(UT_FM_WORKER, &queue_entry));
 
     /* Assert */
     UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
 
-    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryRead, 3);
+    UtAssert_STUB_COUNT(OS_rename, 1);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_DIR_EMPTY_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_RENAME_OS_ERR_EID);
 }
 
-void Test_FM_ChildDeleteDirectoryCmd_RemoveTheDirIsTrueRmDirSuccess(void)
+/* ****************
+ * ChildDeleteCmd Tests
+ * ***************/
+void Test_FM_ChildDeleteCmd_OSRemoveSuccess(void)
 {
     /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DELETE_DIRECTORY_CC};
-
-    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryRead), !OS_SUCCESS);
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DELETE_FILE_CC};
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildDeleteDirectoryCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildDeleteCmd(UT_FM_WORKER, &queue_entry));
 
     /* Assert */
     UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
 
-    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryRead, 1);
+    UtAssert_STUB_COUNT(OS_remove, 1);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_DIR_CMD_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_CMD_INF_EID);
 }
 
-void Test_FM_ChildDeleteDirectoryCmd_RemoveDirTrueOSRmDirNotSuccess(void)
+void Test_FM_ChildDeleteCmd_OSRemoveNotSuccess(void)
 {
     /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DELETE_DIRECTORY_CC};
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DELETE_FILE_CC};
 
-    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryRead), !OS_SUCCESS);
-    UT_SetDefaultReturnValue(UT_KEY(OS_rmdir), !OS_SUCCESS);
+    UT_SetDefaultReturnValue(UT_KEY(OS_remove), !OS_SUCCESS);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildDeleteDirectoryCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildDeleteCmd(UT_FM_WORKER, &queue_entry));
 
     /* Assert */
     UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
 
-    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryRead, 1);
+    UtAssert_STUB_COUNT(OS_remove, 1);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_RMDIR_OS_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_OS_ERR_EID);
 }
 
 /* ****************
- * ChildDirListFileCmd Tests
+ * ChildDeleteAllFilesCmd Tests
  * ***************/
-void Test_FM_ChildDirListFileCmd_OSDirOpenNotSuccess(void)
+void Test_FM_ChildDeleteAllFilesCmd_DirOpenNotSuccess(void)
 {
     /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_GET_DIR_LIST_FILE_CC};
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_DELETE_ALL_FILES_CC, .Source1 = "source1", .Source2 = "source2"};
 
     UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryOpen), !OS_SUCCESS);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildDirListFileCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildDeleteAllFilesCmd(UT_FM_WORKER, &queue_entry));
 
     /* Assert */
     UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
@@ -1519,724 +1620,5079 @@ void Test_FM_ChildDirListFileCmd_OSDirOpenNotSuccess(void)
     UtAssert_STUB_COUNT(OS_DirectoryClose, 0);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_FILE_OSOPENDIR_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_ALL_OS_ERR_EID);
 }
 
-void Test_FM_ChildDirListFileCmd_ChildDirListFileInitFalse(void)
+void Test_FM_ChildDeleteAllFilesCmd_DirReadNotSuccess(void)
 {
     /* Arrange */
     FM_ChildQueueEntry_t queue_entry = {
-        .CommandCode = FM_GET_DIR_LIST_FILE_CC, .Source1 = "source1", .Target = "target"};
+        .CommandCode = FM_DELETE_ALL_FILES_CC, .Source1 = "source1", .Source2 = "source2"};
 
-    UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), !OS_SUCCESS);
+    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryRead), !OS_SUCCESS);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildDirListFileCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildDeleteAllFilesCmd(UT_FM_WORKER, &queue_entry));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
 
     UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
     UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_STUB_COUNT(OS_close, 0);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_FILE_OSCREAT_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_ALL_CMD_INF_EID);
 }
 
-void Test_FM_ChildDirListFileCmd_ChildDirListFileInitTrue(void)
+void Test_FM_ChildDeleteAllFilesCmd_DirEntryThisDirectory(void)
 {
     /* Arrange */
     FM_ChildQueueEntry_t queue_entry = {
-        .CommandCode = FM_GET_DIR_LIST_FILE_CC, .Source1 = "source1", .Target = "target"};
+        .CommandCode = FM_DELETE_ALL_FILES_CC, .Source1 = "source1", .Source2 = "source2"};
+    os_dirent_t direntry = {.FileName = FM_THIS_DIRECTORY};
 
-    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryRead), !OS_SUCCESS);
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildDirListFileCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildDeleteAllFilesCmd(UT_FM_WORKER, &queue_entry));
 
     /* Assert */
     UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
 
     UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
     UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
+    UtAssert_STUB_COUNT(FM_GetFilenameState, 0);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_STUB_COUNT(OS_close, 1);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_FILE_CMD_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_ALL_CMD_INF_EID);
 }
 
-/* ****************
- * ChildDirListPktCmd Tests
- * ***************/
-void Test_FM_ChildDirListPktCmd_OSDirOpenNotSuccess(void)
+void Test_FM_ChildDeleteAllFilesCmd_DirEntryParentDirectory(void)
 {
     /* Arrange */
     FM_ChildQueueEntry_t queue_entry = {
-        .CommandCode = FM_GET_DIR_LIST_PKT_CC, .Source1 = "source1", .Source2 = "source2"};
+        .CommandCode = FM_DELETE_ALL_FILES_CC, .Source1 = "source1", .Source2 = "source2"};
+    os_dirent_t direntry = {.FileName = FM_PARENT_DIRECTORY};
 
-    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryOpen), !OS_SUCCESS);
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildDirListPktCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildDeleteAllFilesCmd(UT_FM_WORKER, &queue_entry));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
 
     UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
+    UtAssert_STUB_COUNT(FM_GetFilenameState, 0);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_PKT_OS_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_ALL_CMD_INF_EID);
 }
 
-void Test_FM_ChildDirListPktCmd_OSDirReadNotSuccess(void)
+void Test_FM_ChildDeleteAllFilesCmd_PathFilenameLengthGreaterMaxPthLen(void)
 {
-    FM_DirListPkt_Payload_t *ReportPtr;
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DELETE_ALL_FILES_CC,
+                                        .Source1     = "source1",
+                                        .Source2     = "source2HasAReallyReallyLongNameSomeSayTheNameIs42Characters"};
+    os_dirent_t          direntry    = {.FileName = "ThisDirectory"};
+
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDeleteAllFilesCmd(UT_FM_WORKER, &queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 1, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
+    UtAssert_STUB_COUNT(FM_GetFilenameState, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_ALL_CMD_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_DELETE_ALL_FILES_ND_WARNING_EID);
+}
 
+void Test_FM_ChildDeleteAllFilesCmd_InvalidFilenameState(void)
+{
     /* Arrange */
     FM_ChildQueueEntry_t queue_entry = {
-        .CommandCode = FM_GET_DIR_LIST_PKT_CC, .Source1 = "source1", .Source2 = "source2"};
+        .CommandCode = FM_DELETE_ALL_FILES_CC, .Source1 = "source1", .Source2 = "source2"};
+    os_dirent_t direntry = {.FileName = "ThisDirectory"};
 
-    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryRead), !OS_SUCCESS);
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_GetFilenameState), FM_NAME_IS_INVALID);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildDirListPktCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildDeleteAllFilesCmd(UT_FM_WORKER, &queue_entry));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+    UT_FM_Child_Cmd_Assert(1, 0, 1, queue_entry.CommandCode);
 
     UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryRead, 1);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
+    UtAssert_STUB_COUNT(FM_GetFilenameState, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_PKT_CMD_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_ALL_CMD_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_DELETE_ALL_FILES_ND_WARNING_EID);
+}
 
-    ReportPtr = &FM_GlobalData.DirListPkt.Payload;
-    UtAssert_UINT32_EQ(ReportPtr->PacketFiles, 0);
+void Test_FM_ChildDeleteAllFilesCmd_NotInUseFilenameState(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_DELETE_ALL_FILES_CC, .Source1 = "source1", .Source2 = "source2"};
+    os_dirent_t direntry = {.FileName = "ThisDirectory"};
+
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_GetFilenameState), FM_NAME_IS_NOT_IN_USE);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDeleteAllFilesCmd(UT_FM_WORKER, &queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 1, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
+    UtAssert_STUB_COUNT(FM_GetFilenameState, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_ALL_CMD_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_DELETE_ALL_FILES_ND_WARNING_EID);
 }
 
-void Test_FM_ChildDirListPktCmd_DirEntryNameThisDirectory(void)
+void Test_FM_ChildDeleteAllFilesCmd_DirectoryFilenameState(void)
 {
-    FM_DirListPkt_Payload_t *ReportPtr;
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_DELETE_ALL_FILES_CC, .Source1 = "source1", .Source2 = "source2"};
+    os_dirent_t direntry = {.FileName = "ThisDirectory"};
+
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_GetFilenameState), FM_NAME_IS_DIRECTORY);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDeleteAllFilesCmd(UT_FM_WORKER, &queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 1, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
+    UtAssert_STUB_COUNT(FM_GetFilenameState, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_ALL_CMD_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_DELETE_ALL_SKIP_WARNING_EID);
+}
 
+void Test_FM_ChildDeleteAllFilesCmd_OpenFilenameState(void)
+{
     /* Arrange */
     FM_ChildQueueEntry_t queue_entry = {
-        .CommandCode = FM_GET_DIR_LIST_PKT_CC, .Source1 = "source1", .Source2 = "source2"};
-    os_dirent_t direntry = {.FileName = FM_THIS_DIRECTORY};
+        .CommandCode = FM_DELETE_ALL_FILES_CC, .Source1 = "source1", .Source2 = "source2"};
+    os_dirent_t direntry = {.FileName = "ThisDirectory"};
+
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_GetFilenameState), FM_NAME_IS_FILE_OPEN);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDeleteAllFilesCmd(UT_FM_WORKER, &queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 1, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
+    UtAssert_STUB_COUNT(FM_GetFilenameState, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_ALL_CMD_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_DELETE_ALL_FILES_ND_WARNING_EID);
+}
+
+void Test_FM_ChildDeleteAllFilesCmd_ClosedFilename_OSRmNotSuccess(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_DELETE_ALL_FILES_CC, .Source1 = "source1", .Source2 = "source2"};
+    os_dirent_t direntry = {.FileName = "ThisDirectory"};
 
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
     UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_GetFilenameState), FM_NAME_IS_FILE_CLOSED);
+    UT_SetDefaultReturnValue(UT_KEY(OS_remove), !OS_SUCCESS);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDeleteAllFilesCmd(UT_FM_WORKER, &queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 1, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
+    UtAssert_STUB_COUNT(FM_GetFilenameState, 1);
+    UtAssert_STUB_COUNT(OS_remove, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_ALL_CMD_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_DELETE_ALL_FILES_ND_WARNING_EID);
+}
+
+void Test_FM_ChildDeleteAllFilesCmd_ClosedFilename_OSrmSuccess(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_DELETE_ALL_FILES_CC, .Source1 = "source1", .Source2 = "source2"};
+    os_dirent_t direntry = {.FileName = "ThisDirectory"};
+
     UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_GetFilenameState), FM_NAME_IS_FILE_CLOSED);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildDirListPktCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildDeleteAllFilesCmd(UT_FM_WORKER, &queue_entry));
 
     /* Assert */
     UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
 
     UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
     UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
+    UtAssert_STUB_COUNT(FM_GetFilenameState, 1);
+    UtAssert_STUB_COUNT(OS_remove, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryRewind, 0);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_PKT_CMD_INF_EID);
-
-    ReportPtr = &FM_GlobalData.DirListPkt.Payload;
-    UtAssert_UINT32_EQ(ReportPtr->PacketFiles, 0);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_ALL_CMD_INF_EID);
 }
 
-void Test_FM_ChildDirListPktCmd_DirEntryNameParentDirectory(void)
+void Test_FM_ChildDeleteAllFilesCmd_Aborted(void)
 {
-    FM_DirListPkt_Payload_t *ReportPtr;
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_DELETE_ALL_FILES_CC, .Source1 = "source1", .Source2 = "source2"};
+
+    /* An abort request for the command in progress */
+    UT_FM_WORKER->CmdSequence   = 1;
+    UT_FM_WORKER->AbortSequence = 1;
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDeleteAllFilesCmd(UT_FM_WORKER, &queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 0);
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHILD_ABORT_ERR_EID);
+}
 
+void Test_FM_ChildDeleteAllFilesCmd_FilenameStateDefaultReturn(void)
+{
     /* Arrange */
     FM_ChildQueueEntry_t queue_entry = {
-        .CommandCode = FM_GET_DIR_LIST_PKT_CC, .Source1 = "source1", .Source2 = "source2"};
-    os_dirent_t direntry = {.FileName = FM_PARENT_DIRECTORY};
+        .CommandCode = FM_DELETE_ALL_FILES_CC, .Source1 = "source1", .Source2 = "source2"};
+    os_dirent_t direntry = {.FileName = "ThisDirectory"};
+
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_GetFilenameState), -1); /* default case */
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDeleteAllFilesCmd(UT_FM_WORKER, &queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 1, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
+    UtAssert_STUB_COUNT(FM_GetFilenameState, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_ALL_CMD_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_DELETE_ALL_FILES_ND_WARNING_EID);
+}
+
+void Test_FM_ChildDeleteAllFilesCmd_OffsetDirectory(void)
+{
+    /* Arrange - a directory read by entry offset and larger than one batch */
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_DELETE_ALL_FILES_CC, .Source1 = "dir", .Source2 = "dir/"};
+
+    UT_FM_OffsetDirSetup();
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDeleteAllFilesCmd(UT_FM_WORKER, &queue_entry));
+
+    /* Assert - every entry is looked at once, only the directories and fixed files are left */
+    UT_FM_Child_Cmd_Assert(1, 0, 2, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(FM_GetFilenameState, UT_FM_OFFSET_DIR_ENTRIES);
+    UtAssert_STUB_COUNT(OS_remove, UT_FM_OFFSET_DIR_ENTRIES - 8);
+    UtAssert_STUB_COUNT(OS_DirectoryRewind, 2);
+    UtAssert_UINT32_EQ(UT_FM_OffsetDirRemaining(), 14);
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 3);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_ALL_CMD_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_DELETE_ALL_FILES_ND_WARNING_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[2].EventID, FM_DELETE_ALL_SKIP_WARNING_EID);
+}
+
+void Test_FM_ChildDeleteAllCollect_ClosedFiles(void)
+{
+    /* Arrange */
+    os_dirent_t direntry[2] = {{.FileName = "file1"}, {.FileName = "file2"}};
+    uint32      not_deleted = 0;
+    uint32      skipped     = 0;
+
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 3, !OS_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), direntry, sizeof(direntry), false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_GetFilenameState), FM_NAME_IS_FILE_CLOSED);
+
+    /* Act */
+    UtAssert_BOOL_TRUE(
+        FM_ChildDeleteAllCollect(UT_FM_WORKER, FM_UT_OBJID_1, "dir/", "Cmd", false, &not_deleted, &skipped));
+
+    /* Assert - entry names only, one after the other */
+    UtAssert_UINT32_EQ(UT_FM_WORKER->DeleteListCount, 2);
+    UtAssert_UINT32_EQ(UT_FM_WORKER->DeleteListLength, 12);
+    UtAssert_MemCmp(UT_FM_WORKER->DeleteList, "file1\0file2", 12, "Delete list names");
+    UtAssert_ZERO(not_deleted);
+    UtAssert_ZERO(skipped);
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 3);
+    UtAssert_STUB_COUNT(OS_remove, 0);
+}
+
+void Test_FM_ChildDeleteAllCollect_ListFull(void)
+{
+    /* Arrange - no room for another name */
+    uint32 not_deleted = 0;
+    uint32 skipped     = 0;
+
+    UT_FM_WORKER->DeleteListLength = FM_CHILD_DELETE_LIST_SIZE - OS_MAX_PATH_LEN + 1;
+
+    /* Act */
+    UtAssert_BOOL_FALSE(
+        FM_ChildDeleteAllCollect(UT_FM_WORKER, FM_UT_OBJID_1, "dir/", "Cmd", false, &not_deleted, &skipped));
+
+    /* Assert - the directory read stops where it is */
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 0);
+}
+
+void Test_FM_ChildDeleteAllCollect_Descend(void)
+{
+    /* Arrange - two sub-directories with room on the stack for only one */
+    os_dirent_t direntry[2] = {{.FileName = "sub1"}, {.FileName = "sub2"}};
+    uint32      not_deleted = 0;
+    uint32      skipped     = 0;
+
+    UT_FM_WORKER->TreeDepth = FM_CHILD_TREE_STACK_SIZE - 1;
+
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 3, !OS_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), direntry, sizeof(direntry), false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_GetFilenameState), FM_NAME_IS_DIRECTORY);
+
+    /* Act */
+    UtAssert_BOOL_TRUE(
+        FM_ChildDeleteAllCollect(UT_FM_WORKER, FM_UT_OBJID_1, "dir/", "Cmd", true, &not_deleted, &skipped));
+
+    /* Assert - the first is pushed with its full name, the second does not fit */
+    UtAssert_UINT32_EQ(UT_FM_WORKER->TreeDepth, FM_CHILD_TREE_STACK_SIZE);
+    UtAssert_STRINGBUF_EQ(UT_FM_WORKER->TreeStack[FM_CHILD_TREE_STACK_SIZE - 1].Path, OS_MAX_PATH_LEN, "dir/sub1", -1);
+    UtAssert_ZERO(UT_FM_WORKER->DeleteListCount);
+    UtAssert_ZERO(not_deleted);
+    UtAssert_UINT32_EQ(skipped, 1);
+}
+
+void Test_FM_ChildDeleteAllRemove_Batch(void)
+{
+    /* Arrange - the second of two removals fails */
+    uint32 not_deleted = 0;
+
+    memcpy(UT_FM_WORKER->DeleteList, "file1\0file2", 12);
+    UT_FM_WORKER->DeleteListLength = 12;
+    UT_FM_WORKER->DeleteListCount  = 2;
+
+    UT_SetDeferredRetcode(UT_KEY(OS_remove), 2, !OS_SUCCESS);
+
+    /* Act */
+    UtAssert_UINT32_EQ(FM_ChildDeleteAllRemove(UT_FM_WORKER, "dir", "dir/", "Cmd Text", &not_deleted), 1);
+
+    /* Assert */
+    UtAssert_UINT32_EQ(not_deleted, 1);
+    UtAssert_STUB_COUNT(OS_remove, 2);
+}
+
+void Test_FM_ChildDeleteAllRemove_OpenedSinceCollect(void)
+{
+    /* Arrange - the first file was opened after the batch was collected */
+    uint32 not_deleted = 0;
+
+    memcpy(UT_FM_WORKER->DeleteList, "file1\0file2", 12);
+    UT_FM_WORKER->DeleteListLength = 12;
+    UT_FM_WORKER->DeleteListCount  = 2;
+    UT_FM_WORKER->OpenPaths.Valid  = true;
+
+    UT_SetDeferredRetcode(UT_KEY(FM_IsPathOpen), 1, true);
+
+    /* Act */
+    UtAssert_UINT32_EQ(FM_ChildDeleteAllRemove(UT_FM_WORKER, "dir", "dir/", "Cmd Text", &not_deleted), 1);
+
+    /* Assert - the batch is checked against a new snapshot and the open file is left alone */
+    UtAssert_BOOL_FALSE(UT_FM_WORKER->OpenPaths.Valid);
+    UtAssert_STUB_COUNT(FM_IsPathOpen, 2);
+    UtAssert_UINT32_EQ(not_deleted, 1);
+    UtAssert_STUB_COUNT(OS_remove, 1);
+}
+
+void Test_FM_ChildDeleteAllRemove_Aborted(void)
+{
+    /* Arrange */
+    uint32 not_deleted = 0;
+
+    memcpy(UT_FM_WORKER->DeleteList, "file1", 6);
+    UT_FM_WORKER->DeleteListLength = 6;
+    UT_FM_WORKER->DeleteListCount  = 1;
+    UT_FM_WORKER->CmdSequence      = 1;
+    UT_FM_WORKER->AbortSequence    = 1;
+
+    /* Act */
+    UtAssert_UINT32_EQ(FM_ChildDeleteAllRemove(UT_FM_WORKER, "dir", "dir/", "Cmd Text", &not_deleted), 0);
+
+    /* Assert */
+    UtAssert_ZERO(not_deleted);
+    UtAssert_STUB_COUNT(OS_remove, 0);
+}
+
+void Test_FM_ChildDirectoryNext_Skip(void)
+{
+    /* Arrange - one entry was read before the read started over */
+    os_dirent_t direntry[3] = {{.FileName = "."}, {.FileName = "file1"}, {.FileName = "file2"}};
+    os_dirent_t entry;
+
+    memset(&entry, 0, sizeof(entry));
+
+    UT_FM_WORKER->DirKeptCount = 1;
+    UT_FM_WORKER->DirSkipCount = 1;
+
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 4, !OS_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), direntry, sizeof(direntry), false);
+
+    /* Act */
+    UtAssert_BOOL_TRUE(FM_ChildDirectoryNext(UT_FM_WORKER, FM_UT_OBJID_1, &entry));
+
+    /* Assert - the dot entry is not counted and the counted entry is passed over */
+    UtAssert_STRINGBUF_EQ(OS_DIRENTRY_NAME(entry), sizeof(entry.FileName), "file2", -1);
+    UtAssert_UINT32_EQ(UT_FM_WORKER->DirKeptCount, 2);
+    UtAssert_ZERO(UT_FM_WORKER->DirSkipCount);
+
+    UtAssert_BOOL_FALSE(FM_ChildDirectoryNext(UT_FM_WORKER, FM_UT_OBJID_1, &entry));
+    UtAssert_UINT32_EQ(UT_FM_WORKER->DirKeptCount, 2);
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 4);
+}
+
+void Test_FM_ChildDirectoryRestart(void)
+{
+    /* Arrange */
+    UT_FM_WORKER->DirKeptCount = 5;
+
+    /* Act - a batch that removed nothing leaves the read where it is */
+    UtAssert_VOIDCALL(FM_ChildDirectoryRestart(UT_FM_WORKER, FM_UT_OBJID_1, 0));
+
+    /* Assert */
+    UtAssert_STUB_COUNT(OS_DirectoryRewind, 0);
+    UtAssert_UINT32_EQ(UT_FM_WORKER->DirKeptCount, 5);
+    UtAssert_ZERO(UT_FM_WORKER->DirSkipCount);
+
+    /* Act - the entries that stayed are passed over after the rewind */
+    UtAssert_VOIDCALL(FM_ChildDirectoryRestart(UT_FM_WORKER, FM_UT_OBJID_1, 2));
+
+    /* Assert */
+    UtAssert_STUB_COUNT(OS_DirectoryRewind, 1);
+    UtAssert_UINT32_EQ(UT_FM_WORKER->DirKeptCount, 3);
+    UtAssert_UINT32_EQ(UT_FM_WORKER->DirSkipCount, 3);
+}
+
+/* ****************
+ * ChildDecompressFileCmd Tests
+ * ***************/
+
+void Test_FM_ChildDecompressFileCmd_FSDecompressSuccess(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DECOMPRESS_FILE_CC};
+
+    UT_FM_WORKER->CurrentCC = 1;
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDecompressFileCmd(UT_FM_WORKER, &queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(FM_Decompress_Impl, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DECOM_CMD_INF_EID);
+}
+
+void Test_FM_ChildDecompressFileCmd_FSDecompressNotSuccess(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DECOMPRESS_FILE_CC};
+
+    UT_FM_WORKER->CurrentCC = 1;
+    UT_SetDefaultReturnValue(UT_KEY(FM_Decompress_Impl), !CFE_SUCCESS);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDecompressFileCmd(UT_FM_WORKER, &queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(FM_Decompress_Impl, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DECOM_CFE_ERR_EID);
+}
+
+/* ****************
+ * ChildConcatFilesCmd Tests
+ * ***************/
+void Test_FM_ChildConcatFilesCmd_CopySource1NotSuccess(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_CONCAT_FILES_CC, .Source1 = "source1", .Source2 = "source2"};
+
+    UT_FM_WORKER->CurrentCC = 1;
+    UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), !OS_SUCCESS);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildConcatFilesCmd(UT_FM_WORKER, &queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_cp, 0);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
+    UtAssert_STUB_COUNT(OS_remove, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CONCAT_OSCPY_ERR_EID);
+}
+
+void Test_FM_ChildConcatFilesCmd_OSOpenCreateSourceNotSuccess(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_CONCAT_FILES_CC, .Source1 = "source1", .Source2 = "source2"};
+
+    UT_SetDeferredRetcode(UT_KEY(OS_OpenCreate), 3, !OS_SUCCESS);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildConcatFilesCmd(UT_FM_WORKER, &queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_OpenCreate, 3);
+    UtAssert_STUB_COUNT(OS_remove, 1);
+    UtAssert_STUB_COUNT(OS_close, 2);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CONCAT_OPEN_SRC2_ERR_EID);
+}
+
+void Test_FM_ChildConcatFilesCmd_OSOpenCreateTargetNotSuccess(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_CONCAT_FILES_CC, .Source1 = "source1", .Source2 = "source2"};
+
+    UT_SetDeferredRetcode(UT_KEY(OS_OpenCreate), 4, !OS_SUCCESS);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildConcatFilesCmd(UT_FM_WORKER, &queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_OpenCreate, 4);
+    UtAssert_STUB_COUNT(OS_remove, 1);
+    UtAssert_STUB_COUNT(OS_close, 3);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CONCAT_OPEN_TGT_ERR_EID);
+}
+
+void Test_FM_ChildConcatFilesCmd_OSReadBytesZero(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_CONCAT_FILES_CC, .Source1 = "source1", .Source2 = "source2"};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), 0);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildConcatFilesCmd(UT_FM_WORKER, &queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_read, 2);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 4);
+    UtAssert_STUB_COUNT(OS_lseek, 1);
+    UtAssert_STUB_COUNT(OS_remove, 0);
+    UtAssert_STUB_COUNT(OS_close, 4);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CONCAT_CMD_INF_EID);
+}
+
+void Test_FM_ChildConcatFilesCmd_OSReadBytesLessThanZero(void)
+{
+    /* Arrange - source file #1 is empty, reading source file #2 fails */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_CONCAT_FILES_CC, .Source1 = "source1", .Source2 = "source2"};
+
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 2, -1);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildConcatFilesCmd(UT_FM_WORKER, &queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_read, 2);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 4);
+    UtAssert_STUB_COUNT(OS_remove, 1);
+    UtAssert_STUB_COUNT(OS_close, 4);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CONCAT_OSRD_ERR_EID);
+}
+
+void Test_FM_ChildConcatFilesCmd_BytesWrittenNotEqualBytesRead(void)
+{
+    /* Arrange - source file #1 is empty, writing source file #2 fails */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_CONCAT_FILES_CC, .Source1 = "source1", .Source2 = "source2"};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), 1);
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 1, 0);
+    UT_SetDefaultReturnValue(UT_KEY(OS_write), 0);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildConcatFilesCmd(UT_FM_WORKER, &queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_read, 2);
+    UtAssert_STUB_COUNT(OS_write, 1);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 4);
+    UtAssert_STUB_COUNT(OS_remove, 1);
+    UtAssert_STUB_COUNT(OS_close, 4);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CONCAT_OSWR_ERR_EID);
+}
+
+void Test_FM_ChildConcatFilesCmd_ThrottleEachBlock(void)
+{
+    /* Arrange - source file #1 is empty, source file #2 fails after two blocks over the byte rate */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_CONCAT_FILES_CC, .Source1 = "source1", .Source2 = "source2"};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), FM_CHILD_FILE_BLOCK_SIZE);
+    UT_SetDefaultReturnValue(UT_KEY(OS_write), FM_CHILD_FILE_BLOCK_SIZE);
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 1, 0);
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 3, -1);
+
+    FM_GlobalData.ChildCopyBlockSize                                = FM_CHILD_FILE_BLOCK_SIZE;
+    FM_GlobalData.ChildThrottle[FM_CHILD_THROTTLE_DEFAULT].ByteRate = FM_CHILD_FILE_BLOCK_SIZE;
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildConcatFilesCmd(UT_FM_WORKER, &queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_read, 4);
+    UtAssert_STUB_COUNT(OS_TaskDelay, 2);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 4);
+    UtAssert_STUB_COUNT(OS_remove, 1);
+    UtAssert_STUB_COUNT(OS_close, 4);
+    UtAssert_UINT32_EQ(UT_FM_WORKER->CopyBytes, 2 * FM_CHILD_FILE_BLOCK_SIZE);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CONCAT_OSRD_ERR_EID);
+}
+
+void Test_FM_ChildConcatFilesCmd_KernelCopySuccess(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_CONCAT_FILES_CC, .Source1 = "source1", .Source2 = "source2"};
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_KernelCopy_Open), CFE_SUCCESS);
+    UT_SetDefaultReturnValue(UT_KEY(FM_KernelCopy_Chunk), 0);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildConcatFilesCmd(UT_FM_WORKER, &queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(FM_KernelCopy_Open, 2);
+    UtAssert_STUB_COUNT(FM_KernelCopy_Close, 2);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 0);
+    UtAssert_STUB_COUNT(OS_remove, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CONCAT_CMD_INF_EID);
+}
+
+void Test_FM_ChildConcatFilesCmd_KernelAppendNotSuccess(void)
+{
+    /* Arrange - source file #1 is empty, appending source file #2 fails */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_CONCAT_FILES_CC, .Source1 = "source1", .Source2 = "source2"};
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_KernelCopy_Open), CFE_SUCCESS);
+    UT_SetDefaultReturnValue(UT_KEY(FM_KernelCopy_Chunk), OS_ERROR);
+    UT_SetDeferredRetcode(UT_KEY(FM_KernelCopy_Chunk), 1, 0);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildConcatFilesCmd(UT_FM_WORKER, &queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(FM_KernelCopy_Chunk, 2);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 0);
+    UtAssert_STUB_COUNT(OS_remove, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CONCAT_OSWR_ERR_EID);
+}
+
+/* ****************
+ * ChildConcatListCmd Tests
+ * ***************/
+void Test_FM_ChildConcatListCmd_InlineSuccess(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_CONCAT_LIST_CC, .Target = "target", .SourceList = "source1\nsource2"};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), 0);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildConcatListCmd(UT_FM_WORKER, &queue_entry));
+
+    /* Assert - the target is opened once and each source is streamed into it */
+    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_OpenCreate, 3);
+    UtAssert_STUB_COUNT(OS_read, 2);
+    UtAssert_STUB_COUNT(OS_lseek, 0);
+    UtAssert_STUB_COUNT(OS_remove, 0);
+    UtAssert_STUB_COUNT(OS_close, 3);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CONCAT_LIST_CMD_INF_EID);
+}
+
+void Test_FM_ChildConcatListCmd_ListFileSuccess(void)
+{
+    /* Arrange - the list file is read in one piece, the sources read as empty files */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_CONCAT_LIST_CC, .Source1 = "list", .Target = "target"};
+    char                 ListText[]  = "source1\n\nsource2\r\n";
+
+    UT_SetDataBuffer(UT_KEY(OS_read), ListText, sizeof(ListText) - 1, false);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildConcatListCmd(UT_FM_WORKER, &queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_OpenCreate, 4);
+    UtAssert_STUB_COUNT(OS_read, 4);
+    UtAssert_STUB_COUNT(OS_remove, 0);
+    UtAssert_STUB_COUNT(OS_close, 4);
+    UtAssert_BOOL_FALSE(OS_ObjectIdDefined(UT_FM_WORKER->ConcatListFile));
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CONCAT_LIST_CMD_INF_EID);
+}
+
+void Test_FM_ChildConcatListCmd_OpenListNotSuccess(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_CONCAT_LIST_CC, .Source1 = "list", .Target = "target"};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), !OS_SUCCESS);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildConcatListCmd(UT_FM_WORKER, &queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
+    UtAssert_STUB_COUNT(OS_remove, 0);
+    UtAssert_STUB_COUNT(OS_close, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CONCAT_LIST_OPEN_LIST_ERR_EID);
+}
+
+void Test_FM_ChildConcatListCmd_OpenTargetNotSuccess(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_CONCAT_LIST_CC, .Source1 = "list", .Target = "target"};
+
+    UT_SetDeferredRetcode(UT_KEY(OS_OpenCreate), 2, !OS_SUCCESS);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildConcatListCmd(UT_FM_WORKER, &queue_entry));
+
+    /* Assert - the list file is still closed */
+    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_OpenCreate, 2);
+    UtAssert_STUB_COUNT(OS_remove, 0);
+    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CONCAT_LIST_OPEN_TGT_ERR_EID);
+}
+
+void Test_FM_ChildConcatListCmd_OpenSourceNotSuccess(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_CONCAT_LIST_CC, .Target = "target", .SourceList = "source1\nsource2"};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), 0);
+    UT_SetDeferredRetcode(UT_KEY(OS_OpenCreate), 3, !OS_SUCCESS);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildConcatListCmd(UT_FM_WORKER, &queue_entry));
+
+    /* Assert - the partial target is removed */
+    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_OpenCreate, 3);
+    UtAssert_STUB_COUNT(OS_read, 1);
+    UtAssert_STUB_COUNT(OS_remove, 1);
+    UtAssert_STUB_COUNT(OS_close, 2);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CONCAT_LIST_OPEN_SRC_ERR_EID);
+}
+
+void Test_FM_ChildConcatListCmd_SourceIsTarget(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_CONCAT_LIST_CC, .Target = "target", .SourceList = "source1\ntarget"};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), 0);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildConcatListCmd(UT_FM_WORKER, &queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_OpenCreate, 2);
+    UtAssert_STUB_COUNT(OS_remove, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CONCAT_LIST_READ_LIST_ERR_EID);
+}
+
+void Test_FM_ChildConcatListCmd_EmptyList(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_CONCAT_LIST_CC, .Source1 = "list", .Target = "target"};
+    char                 ListText[]  = "\n\r\n";
+
+    UT_SetDataBuffer(UT_KEY(OS_read), ListText, sizeof(ListText) - 1, false);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildConcatListCmd(UT_FM_WORKER, &queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_OpenCreate, 2);
+    UtAssert_STUB_COUNT(OS_read, 2);
+    UtAssert_STUB_COUNT(OS_remove, 1);
+    UtAssert_STUB_COUNT(OS_close, 2);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CONCAT_LIST_READ_LIST_ERR_EID);
+}
+
+void Test_FM_ChildConcatListCmd_ResumeListEndsBeforeCheckpoint(void)
+{
+    /* Arrange - the checkpoint names a third source, the list holds two */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_CONCAT_LIST_CC, .Source1 = "list", .Target = "target"};
+    char                 ListText[]  = "source1\nsource2\n";
+
+    UT_FM_WORKER->Resuming               = true;
+    UT_FM_WORKER->CheckpointSaved        = true;
+    UT_FM_WORKER->Checkpoint.SourceIndex = 2;
+
+    UT_SetDataBuffer(UT_KEY(OS_read), ListText, sizeof(ListText) - 1, false);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildConcatListCmd(UT_FM_WORKER, &queue_entry));
+
+    /* Assert - no source is copied, the target and the checkpoint file are removed */
+    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_OpenCreate, 2);
+    UtAssert_STUB_COUNT(OS_remove, 2);
+    UtAssert_BOOL_FALSE(UT_FM_WORKER->Resuming);
+    UtAssert_BOOL_FALSE(UT_FM_WORKER->CheckpointSaved);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHILD_CHECKPOINT_ERR_EID);
+}
+
+void Test_FM_ChildConcatListNext_NameTooLong(void)
+{
+    /* Arrange */
+    char Source[8];
+
+    UT_FM_WORKER->ConcatListFile   = OS_OBJECT_ID_UNDEFINED;
+    UT_FM_WORKER->ConcatListText   = "source1\nsource22";
+    UT_FM_WORKER->ConcatListLength = strlen(UT_FM_WORKER->ConcatListText);
+    UT_FM_WORKER->ConcatListOffset = 0;
+
+    /* Act */
+    UtAssert_INT32_EQ(FM_ChildConcatListNext(UT_FM_WORKER, Source, sizeof(Source)), OS_SUCCESS);
+    UtAssert_STRINGBUF_EQ(Source, sizeof(Source), "source1", -1);
+    UtAssert_INT32_EQ(FM_ChildConcatListNext(UT_FM_WORKER, Source, sizeof(Source)), OS_FS_ERR_PATH_TOO_LONG);
+
+    /* Assert */
+    UtAssert_STUB_COUNT(OS_read, 0);
+}
+
+void Test_FM_ChildConcatListNext_ReadNotSuccess(void)
+{
+    /* Arrange */
+    char Source[OS_MAX_PATH_LEN];
+
+    UT_FM_WORKER->ConcatListFile   = FM_UT_OBJID_1;
+    UT_FM_WORKER->ConcatListLength = 0;
+    UT_FM_WORKER->ConcatListOffset = 0;
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), OS_ERROR);
+
+    /* Act */
+    UtAssert_INT32_EQ(FM_ChildConcatListNext(UT_FM_WORKER, Source, sizeof(Source)), OS_ERROR);
+
+    /* Assert */
+    UtAssert_STUB_COUNT(OS_read, 1);
+    UtAssert_STRINGBUF_EQ(Source, sizeof(Source), "", -1);
+}
+
+/* ****************
+ * ChildFileInfoCmd Tests
+ * ***************/
+void Test_FM_ChildFileInfoCmd_FileInfoCRCEqualIgnoreCRC(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode   = FM_GET_FILE_INFO_CC,
+                                        .Source1       = "source1",
+                                        .Source2       = "source2",
+                                        .FileInfoCRC   = FM_IGNORE_CRC,
+                                        .FileInfoState = FM_NAME_IS_FILE_CLOSED};
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildFileInfoCmd(UT_FM_WORKER, &queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_OpenCreate, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_FILE_INFO_CMD_INF_EID);
+}
+
+void Test_FM_ChildFileInfoCmd_FileInfoStateIsNotFileClosed(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode   = FM_GET_FILE_INFO_CC,
+                                        .Source1       = "source1",
+                                        .Source2       = "source2",
+                                        .FileInfoCRC   = CFE_ES_CrcType_CRC_8,
+                                        .FileInfoState = FM_NAME_IS_FILE_OPEN};
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildFileInfoCmd(UT_FM_WORKER, &queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 1, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_OpenCreate, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_FILE_INFO_STATE_WARNING_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_GET_FILE_INFO_CMD_INF_EID);
+}
+
+void Test_FM_ChildFileInfoCmd_FileInfoCRCEqualMission8(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode   = FM_GET_FILE_INFO_CC,
+                                        .Source1       = "source1",
+                                        .Source2       = "source2",
+                                        .FileInfoCRC   = CFE_ES_CrcType_CRC_8,
+                                        .FileInfoState = FM_NAME_IS_FILE_CLOSED};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), !OS_SUCCESS);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildFileInfoCmd(UT_FM_WORKER, &queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 1, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_FILE_INFO_OPEN_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_GET_FILE_INFO_CMD_INF_EID);
+}
+
+void Test_FM_ChildFileInfoCmd_FileInfoCRCEqualMission16(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode   = FM_GET_FILE_INFO_CC,
+                                        .Source1       = "source1",
+                                        .Source2       = "source2",
+                                        .FileInfoCRC   = CFE_ES_CrcType_CRC_16,
+                                        .FileInfoState = FM_NAME_IS_FILE_CLOSED};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), !OS_SUCCESS);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildFileInfoCmd(UT_FM_WORKER, &queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 1, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_FILE_INFO_OPEN_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_GET_FILE_INFO_CMD_INF_EID);
+}
+
+void Test_FM_ChildFileInfoCmd_FileInfoCRCEqualMission32(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode   = FM_GET_FILE_INFO_CC,
+                                        .Source1       = "source1",
+                                        .Source2       = "source2",
+                                        .FileInfoCRC   = CFE_ES_CrcType_CRC_32,
+                                        .FileInfoState = FM_NAME_IS_FILE_CLOSED};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), !OS_SUCCESS);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildFileInfoCmd(UT_FM_WORKER, &queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 1, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_FILE_INFO_OPEN_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_GET_FILE_INFO_CMD_INF_EID);
+}
+
+void Test_FM_ChildFileInfoCmd_FileInfoCRCNotEqualToAnyMissionES(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode   = FM_GET_FILE_INFO_CC,
+                                        .Source1       = "source1",
+                                        .Source2       = "source2",
+                                        .FileInfoCRC   = -1,
+                                        .FileInfoState = FM_NAME_IS_FILE_CLOSED};
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildFileInfoCmd(UT_FM_WORKER, &queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 1, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_OpenCreate, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_FILE_INFO_TYPE_WARNING_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_GET_FILE_INFO_CMD_INF_EID);
+}
+
+void Test_FM_ChildFileInfoCmd_OSOpenCreateTrueBytesReadZero(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode   = FM_GET_FILE_INFO_CC,
+                                        .Source1       = "source1",
+                                        .Source2       = "source2",
+                                        .FileInfoCRC   = CFE_ES_CrcType_CRC_16,
+                                        .FileInfoState = FM_NAME_IS_FILE_CLOSED};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), 0);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildFileInfoCmd(UT_FM_WORKER, &queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_read, 1);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
+    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_FILE_INFO_CMD_INF_EID);
+}
+
+void Test_FM_ChildFileInfoCmd_BytesReadLessThanZero(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode   = FM_GET_FILE_INFO_CC,
+                                        .Source1       = "source1",
+                                        .Source2       = "source2",
+                                        .FileInfoCRC   = CFE_ES_CrcType_CRC_16,
+                                        .FileInfoState = FM_NAME_IS_FILE_CLOSED};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), -1);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildFileInfoCmd(UT_FM_WORKER, &queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 1, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_read, 1);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
+    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_FILE_INFO_READ_WARNING_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_GET_FILE_INFO_CMD_INF_EID);
+}
+
+void Test_FM_ChildFileInfoCmd_BytesReadGreaterThanZero(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode   = FM_GET_FILE_INFO_CC,
+                                        .Source1       = "source1",
+                                        .Source2       = "source2",
+                                        .FileInfoCRC   = CFE_ES_CrcType_CRC_8,
+                                        .FileInfoState = FM_NAME_IS_FILE_CLOSED,
+                                        .FileInfoSize  = 2 * FM_CHILD_FILE_BLOCK_SIZE};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), FM_CHILD_FILE_BLOCK_SIZE);
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 3, 0);
+    UT_SetDefaultReturnValue(UT_KEY(FM_CalculateCRC), 0);
+
+    /* Each block read is more than the byte bucket holds */
+    FM_GlobalData.ChildThrottle[FM_CHILD_THROTTLE_DEFAULT].ByteRate = FM_CHILD_FILE_BLOCK_SIZE;
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildFileInfoCmd(UT_FM_WORKER, &queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_read, 3);
+    UtAssert_STUB_COUNT(OS_TaskDelay, 2);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
+    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_UINT32_EQ(UT_FM_WORKER->ProgressBytes, 2 * FM_CHILD_FILE_BLOCK_SIZE);
+    UtAssert_UINT32_EQ(UT_FM_WORKER->ProgressTotal, 2 * FM_CHILD_FILE_BLOCK_SIZE);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_FILE_INFO_CMD_INF_EID);
+}
+
+void Test_FM_ChildFileInfoCmd_Aborted(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode   = FM_GET_FILE_INFO_CC,
+                                        .Source1       = "source1",
+                                        .Source2       = "source2",
+                                        .FileInfoCRC   = CFE_ES_CrcType_CRC_8,
+                                        .FileInfoState = FM_NAME_IS_FILE_CLOSED};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), FM_CHILD_FILE_BLOCK_SIZE);
+
+    /* An abort request for the command in progress */
+    UT_FM_WORKER->CmdSequence   = 1;
+    UT_FM_WORKER->AbortSequence = 1;
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildFileInfoCmd(UT_FM_WORKER, &queue_entry));
+
+    /* Assert - no partial CRC is reported */
+    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_read, 1);
+    UtAssert_STUB_COUNT(FM_CalculateCRC, 0);
+    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHILD_ABORT_ERR_EID);
+}
+
+void Test_FM_ChildFileInfoCmd_CrcCacheHit(void)
+{
+    /* Arrange - the CRC of the unchanged file is kept */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode   = FM_GET_FILE_INFO_CC,
+                                        .Source1       = "source1",
+                                        .FileInfoCRC   = CFE_ES_CrcType_CRC_16,
+                                        .FileInfoState = FM_NAME_IS_FILE_CLOSED,
+                                        .FileInfoSize  = 100,
+                                        .FileInfoTime  = 50};
+
+    strncpy(FM_GlobalData.CrcCache[3].Path, "source1", OS_MAX_PATH_LEN - 1);
+    FM_GlobalData.CrcCache[3].Size    = 100;
+    FM_GlobalData.CrcCache[3].Time    = 50;
+    FM_GlobalData.CrcCache[3].CrcType = CFE_ES_CrcType_CRC_16;
+    FM_GlobalData.CrcCache[3].Crc     = 0x1234;
+    FM_GlobalData.CrcCacheClock       = 7;
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildFileInfoCmd(UT_FM_WORKER, &queue_entry));
+
+    /* Assert - the file is not read */
+    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_OpenCreate, 0);
+    UtAssert_STUB_COUNT(OS_read, 0);
+    UtAssert_BOOL_TRUE(UT_FM_WORKER->FileInfoPkt.Payload.CRC_Computed);
+    UtAssert_UINT32_EQ(UT_FM_WORKER->FileInfoPkt.Payload.CRC, 0x1234);
+    UtAssert_UINT32_EQ(FM_GlobalData.CrcCacheHits, 1);
+    UtAssert_UINT32_EQ(FM_GlobalData.CrcCacheMisses, 0);
+    UtAssert_UINT32_EQ(FM_GlobalData.CrcCache[3].LastUse, 7);
+    UtAssert_UINT32_EQ(FM_GlobalData.CrcCacheClock, 8);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_FILE_INFO_CMD_INF_EID);
+}
+
+void Test_FM_ChildFileInfoCmd_CrcCacheChanged(void)
+{
+    /* Arrange - the file has been written since its CRC was kept */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode   = FM_GET_FILE_INFO_CC,
+                                        .Source1       = "source1",
+                                        .FileInfoCRC   = CFE_ES_CrcType_CRC_16,
+                                        .FileInfoState = FM_NAME_IS_FILE_CLOSED,
+                                        .FileInfoSize  = 100,
+                                        .FileInfoTime  = 50};
+
+    strncpy(FM_GlobalData.CrcCache[0].Path, "source1", OS_MAX_PATH_LEN - 1);
+    FM_GlobalData.CrcCache[0].Size    = 100;
+    FM_GlobalData.CrcCache[0].Time    = 49;
+    FM_GlobalData.CrcCache[0].CrcType = CFE_ES_CrcType_CRC_16;
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), 0);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildFileInfoCmd(UT_FM_WORKER, &queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
+    UtAssert_UINT32_EQ(FM_GlobalData.CrcCacheHits, 0);
+    UtAssert_UINT32_EQ(FM_GlobalData.CrcCacheMisses, 1);
+}
+
+void Test_FM_ChildFileInfoCmd_CrcCacheStore(void)
+{
+    /* Arrange - the file was last modified well before it is read */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode   = FM_GET_FILE_INFO_CC,
+                                        .Source1       = "source1",
+                                        .FileInfoCRC   = CFE_ES_CrcType_CRC_16,
+                                        .FileInfoState = FM_NAME_IS_FILE_CLOSED,
+                                        .FileInfoSize  = FM_CHILD_FILE_BLOCK_SIZE,
+                                        .FileInfoTime  = 50};
+    OS_time_t            Now         = OS_TimeAssembleFromMilliseconds(100, 0);
+
+    UT_SetDataBuffer(UT_KEY(OS_GetLocalTime), &Now, sizeof(Now), false);
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), FM_CHILD_FILE_BLOCK_SIZE);
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 2, 0);
+    UT_SetDefaultReturnValue(UT_KEY(FM_CalculateCRC), 0x4321);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildFileInfoCmd(UT_FM_WORKER, &queue_entry));
+
+    /* Assert - the CRC is kept in the first free entry */
+    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+
+    UtAssert_UINT32_EQ(UT_FM_WORKER->FileInfoPkt.Payload.CRC, 0x4321);
+    UtAssert_UINT32_EQ(FM_GlobalData.CrcCacheMisses, 1);
+    UtAssert_STRINGBUF_EQ(FM_GlobalData.CrcCache[0].Path, OS_MAX_PATH_LEN, "source1", -1);
+    UtAssert_UINT32_EQ(FM_GlobalData.CrcCache[0].Size, FM_CHILD_FILE_BLOCK_SIZE);
+    UtAssert_UINT32_EQ(FM_GlobalData.CrcCache[0].Time, 50);
+    UtAssert_UINT32_EQ(FM_GlobalData.CrcCache[0].CrcType, CFE_ES_CrcType_CRC_16);
+    UtAssert_UINT32_EQ(FM_GlobalData.CrcCache[0].Crc, 0x4321);
+
+    /* Act - the same request again */
+    queue_entry.FileInfoCRC = CFE_ES_CrcType_CRC_16;
+    UtAssert_VOIDCALL(FM_ChildFileInfoCmd(UT_FM_WORKER, &queue_entry));
+
+    /* Assert - reported without reading the file again */
+    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
+    UtAssert_UINT32_EQ(UT_FM_WORKER->FileInfoPkt.Payload.CRC, 0x4321);
+    UtAssert_UINT32_EQ(FM_GlobalData.CrcCacheHits, 1);
+}
+
+void Test_FM_ChildFileInfoCmd_CrcCacheRecentlyModified(void)
+{
+    /* Arrange - the file was modified in the second its CRC is read */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode   = FM_GET_FILE_INFO_CC,
+                                        .Source1       = "source1",
+                                        .FileInfoCRC   = CFE_ES_CrcType_CRC_16,
+                                        .FileInfoState = FM_NAME_IS_FILE_CLOSED,
+                                        .FileInfoTime  = 100};
+    OS_time_t            Now         = OS_TimeAssembleFromMilliseconds(100, 500);
+
+    UT_SetDataBuffer(UT_KEY(OS_GetLocalTime), &Now, sizeof(Now), false);
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), 0);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildFileInfoCmd(UT_FM_WORKER, &queue_entry));
+
+    /* Assert - the CRC is reported but not kept */
+    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+
+    UtAssert_BOOL_TRUE(UT_FM_WORKER->FileInfoPkt.Payload.CRC_Computed);
+    UtAssert_STRINGBUF_EQ(FM_GlobalData.CrcCache[0].Path, OS_MAX_PATH_LEN, "", -1);
+    UtAssert_STUB_COUNT(OS_MutSemGive, 1);
+}
+
+void Test_FM_ChildCrcCacheStore_Replace(void)
+{
+    FM_ChildQueueEntry_t queue_entry = {.Source1 = "new", .FileInfoCRC = CFE_ES_CrcType_CRC_16, .FileInfoTime = 1};
+    uint32               i;
+
+    /* Arrange - a full cache where entry 2 was used least recently */
+    for (i = 0; i < FM_CHILD_CRC_CACHE_ENTRIES; i++)
+    {
+        snprintf(FM_GlobalData.CrcCache[i].Path, OS_MAX_PATH_LEN, "file%u", (unsigned int)i);
+        FM_GlobalData.CrcCache[i].CrcType = CFE_ES_CrcType_CRC_16;
+        FM_GlobalData.CrcCache[i].LastUse = i + 10;
+    }
+
+    FM_GlobalData.CrcCache[2].LastUse = 5;
+    FM_GlobalData.CrcCacheClock       = FM_CHILD_CRC_CACHE_ENTRIES + 10;
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildCrcCacheStore(UT_FM_WORKER, &queue_entry, 0x1111, 2));
+
+    /* Assert */
+    UtAssert_STRINGBUF_EQ(FM_GlobalData.CrcCache[2].Path, OS_MAX_PATH_LEN, "new", -1);
+    UtAssert_UINT32_EQ(FM_GlobalData.CrcCache[2].Crc, 0x1111);
+
+    /* Act - a newer CRC of a file already kept replaces its entry */
+    strncpy(queue_entry.Source1, "file0", sizeof(queue_entry.Source1) - 1);
+    UtAssert_VOIDCALL(FM_ChildCrcCacheStore(UT_FM_WORKER, &queue_entry, 0x2222, 2));
+
+    /* Assert */
+    UtAssert_UINT32_EQ(FM_GlobalData.CrcCache[0].Crc, 0x2222);
+    UtAssert_UINT32_EQ(FM_GlobalData.CrcCache[0].Time, 1);
+    UtAssert_STRINGBUF_EQ(FM_GlobalData.CrcCache[2].Path, OS_MAX_PATH_LEN, "new", -1);
+
+    /* Act - the same file with another CRC type is kept separately */
+    queue_entry.FileInfoCRC = CFE_ES_CrcType_CRC_32;
+    UtAssert_VOIDCALL(FM_ChildCrcCacheStore(UT_FM_WORKER, &queue_entry, 0x3333, 2));
+
+    /* Assert - entry 1 was now used least recently */
+    UtAssert_UINT32_EQ(FM_GlobalData.CrcCache[0].Crc, 0x2222);
+    UtAssert_UINT32_EQ(FM_GlobalData.CrcCache[1].Crc, 0x3333);
+    UtAssert_UINT32_EQ(FM_GlobalData.CrcCache[1].CrcType, CFE_ES_CrcType_CRC_32);
+}
+
+void Test_FM_ChildCrcCacheStore_CheckCrc(void)
+{
+    FM_ChildQueueEntry_t queue_entry = {
+        .Source1 = "source1", .FileInfoCRC = CFE_ES_CrcType_CRC_16, .FileInfoSize = 100};
+
+    /* Arrange - the whole file was read in one block */
+    UT_FM_WORKER->ProgressBytes = 100;
+    UT_FM_WORKER->CrcLastBytes  = 100;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_CalculateCRC), 0x5555);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildCrcCacheStore(UT_FM_WORKER, &queue_entry, 0x1111, 2));
+
+    /* Assert - kept with the CRC of the block still in the buffer as its first and last block */
+    UtAssert_UINT32_EQ(FM_GlobalData.CrcCache[0].Crc, 0x1111);
+    UtAssert_UINT32_EQ(FM_GlobalData.CrcCache[0].CheckLength, 100);
+    UtAssert_UINT32_EQ(FM_GlobalData.CrcCache[0].HeadCrc, 0x5555);
+    UtAssert_UINT32_EQ(FM_GlobalData.CrcCache[0].CheckCrc, 0x5555);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 0);
+
+    /* Act - a CRC-32 can not be continued */
+    queue_entry.FileInfoCRC = CFE_ES_CrcType_CRC_32;
+    UtAssert_VOIDCALL(FM_ChildCrcCacheStore(UT_FM_WORKER, &queue_entry, 0x2222, 2));
+
+    /* Assert */
+    UtAssert_UINT32_EQ(FM_GlobalData.CrcCache[1].Crc, 0x2222);
+    UtAssert_UINT32_EQ(FM_GlobalData.CrcCache[1].CheckLength, 0);
+    UtAssert_STUB_COUNT(FM_CalculateCRC, 1);
+}
+
+void Test_FM_ChildCrcCacheStore_ShortFinalRead(void)
+{
+    FM_ChildQueueEntry_t queue_entry = {.Source1      = "source1",
+                                        .FileInfoCRC  = CFE_ES_CrcType_CRC_16,
+                                        .FileInfoSize = FM_CHILD_FILE_BLOCK_SIZE + 1};
+
+    /* Arrange - the last read was a single byte */
+    UT_FM_WORKER->ProgressBytes = FM_CHILD_FILE_BLOCK_SIZE + 1;
+    UT_FM_WORKER->CrcLastBytes  = 1;
+
+    UT_SetDeferredRetcode(UT_KEY(OS_lseek), 2, 1);
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), FM_CHILD_FILE_BLOCK_SIZE);
+    UT_SetDeferredRetcode(UT_KEY(FM_CalculateCRC), 1, 0x6666);
+    UT_SetDeferredRetcode(UT_KEY(FM_CalculateCRC), 1, 0x7777);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildCrcCacheStore(UT_FM_WORKER, &queue_entry, 0x1111, 2));
+
+    /* Assert - a whole first and last block were read again */
+    UtAssert_UINT32_EQ(FM_GlobalData.CrcCache[0].CheckLength, FM_CHILD_FILE_BLOCK_SIZE);
+    UtAssert_UINT32_EQ(FM_GlobalData.CrcCache[0].HeadCrc, 0x6666);
+    UtAssert_UINT32_EQ(FM_GlobalData.CrcCache[0].CheckCrc, 0x7777);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
+    UtAssert_STUB_COUNT(OS_read, 2);
+    UtAssert_STUB_COUNT(OS_close, 1);
+
+    /* Arrange - the file can no longer be read */
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), 0);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildCrcCacheStore(UT_FM_WORKER, &queue_entry, 0x2222, 2));
+
+    /* Assert - the CRC is kept, but can not be continued */
+    UtAssert_UINT32_EQ(FM_GlobalData.CrcCache[0].Crc, 0x2222);
+    UtAssert_UINT32_EQ(FM_GlobalData.CrcCache[0].CheckLength, 0);
+    UtAssert_STUB_COUNT(OS_close, 2);
+}
+
+void Test_FM_ChildCrcCacheStore_NotReadToSize(void)
+{
+    FM_ChildQueueEntry_t queue_entry = {
+        .Source1 = "source1", .FileInfoCRC = CFE_ES_CrcType_CRC_16, .FileInfoSize = 100};
+
+    /* Arrange - the file shrank while it was read */
+    UT_FM_WORKER->ProgressBytes = 60;
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildCrcCacheStore(UT_FM_WORKER, &queue_entry, 0x1111, 2));
+
+    /* Assert */
+    UtAssert_STRINGBUF_EQ(FM_GlobalData.CrcCache[0].Path, OS_MAX_PATH_LEN, "", -1);
+    UtAssert_STUB_COUNT(OS_MutSemTake, 0);
+}
+
+void Test_FM_ChildCrcCacheBase_Conditions(void)
+{
+    FM_ChildQueueEntry_t queue_entry = {.Source1      = "source1",
+                                        .FileInfoCRC  = CFE_ES_CrcType_CRC_16,
+                                        .FileInfoSize = 200,
+                                        .FileInfoTime = 60};
+    FM_CrcCacheEntry_t   base;
+
+    memset(&base, 0, sizeof(base));
+
+    /* Arrange - a CRC kept for the first 100 bytes of the file */
+    strncpy(FM_GlobalData.CrcCache[1].Path, "source1", OS_MAX_PATH_LEN - 1);
+    FM_GlobalData.CrcCache[1].Size        = 100;
+    FM_GlobalData.CrcCache[1].Time        = 50;
+    FM_GlobalData.CrcCache[1].CrcType     = CFE_ES_CrcType_CRC_16;
+    FM_GlobalData.CrcCache[1].Crc         = 0x1234;
+    FM_GlobalData.CrcCache[1].CheckLength = 100;
+    FM_GlobalData.CrcCacheClock           = 7;
+
+    /* Act/Assert - the file grew */
+    UtAssert_BOOL_TRUE(FM_ChildCrcCacheBase(&queue_entry, &base));
+    UtAssert_UINT32_EQ(base.Crc, 0x1234);
+    UtAssert_UINT32_EQ(base.Size, 100);
+    UtAssert_UINT32_EQ(FM_GlobalData.CrcCache[1].LastUse, 7);
+
+    /* Act/Assert - the file is no larger */
+    queue_entry.FileInfoSize = 100;
+    UtAssert_BOOL_FALSE(FM_ChildCrcCacheBase(&queue_entry, &base));
+
+    /* Act/Assert - the file has an older modify time */
+    queue_entry.FileInfoSize = 200;
+    queue_entry.FileInfoTime = 40;
+    UtAssert_BOOL_FALSE(FM_ChildCrcCacheBase(&queue_entry, &base));
+
+    /* Act/Assert - no check CRC was kept */
+    queue_entry.FileInfoTime              = 60;
+    FM_GlobalData.CrcCache[1].CheckLength = 0;
+    UtAssert_BOOL_FALSE(FM_ChildCrcCacheBase(&queue_entry, &base));
+
+    /* Act/Assert - another CRC type, without taking the cache mutex */
+    FM_GlobalData.CrcCache[1].CheckLength = 100;
+    queue_entry.FileInfoCRC               = CFE_ES_CrcType_CRC_32;
+    UtAssert_BOOL_FALSE(FM_ChildCrcCacheBase(&queue_entry, &base));
+
+    UtAssert_STUB_COUNT(OS_MutSemTake, 4);
+}
+
+void Test_FM_ChildCrcResume_Appended(void)
+{
+    FM_CrcCacheEntry_t base = {.Size        = FM_CHILD_FILE_BLOCK_SIZE + 1,
+                               .Crc         = 0x1234,
+                               .CheckLength = FM_CHILD_FILE_BLOCK_SIZE,
+                               .HeadCrc     = 0x4444,
+                               .CheckCrc    = 0x5555};
+
+    /* Arrange - the kept size ended with a one byte read, the first and last block are unchanged */
+    UT_SetDeferredRetcode(UT_KEY(OS_lseek), 2, 1);
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), FM_CHILD_FILE_BLOCK_SIZE);
+    UT_SetDeferredRetcode(UT_KEY(FM_CalculateCRC), 1, 0x4444);
+    UT_SetDeferredRetcode(UT_KEY(FM_CalculateCRC), 1, 0x5555);
+
+    /* Act */
+    UtAssert_INT32_EQ(FM_ChildCrcResume(UT_FM_WORKER, OS_OBJECT_ID_UNDEFINED, &base), OS_SUCCESS);
+
+    /* Assert - read on from the kept size */
+    UtAssert_UINT32_EQ(UT_FM_WORKER->ProgressBytes, FM_CHILD_FILE_BLOCK_SIZE + 1);
+    UtAssert_UINT32_EQ(UT_FM_WORKER->CrcLastBytes, FM_CHILD_FILE_BLOCK_SIZE);
+    UtAssert_STUB_COUNT(OS_lseek, 2);
+    UtAssert_STUB_COUNT(OS_read, 2);
+}
+
+void Test_FM_ChildCrcResume_Rewritten(void)
+{
+    FM_CrcCacheEntry_t base = {.Size        = FM_CHILD_FILE_BLOCK_SIZE + 1,
+                               .Crc         = 0x1234,
+                               .CheckLength = FM_CHILD_FILE_BLOCK_SIZE,
+                               .HeadCrc     = 0x4444,
+                               .CheckCrc    = 0x5555};
+
+    /* Arrange - the file was rewritten from its start */
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), FM_CHILD_FILE_BLOCK_SIZE);
+    UT_SetDeferredRetcode(UT_KEY(FM_CalculateCRC), 1, 0x6666);
+
+    /* Act/Assert - moved back to the start of the file without reading the last block */
+    UtAssert_INT32_EQ(FM_ChildCrcResume(UT_FM_WORKER, OS_OBJECT_ID_UNDEFINED, &base), CFE_STATUS_NOT_IMPLEMENTED);
+    UtAssert_UINT32_EQ(UT_FM_WORKER->ProgressBytes, 0);
+    UtAssert_STUB_COUNT(OS_lseek, 2);
+    UtAssert_STUB_COUNT(OS_read, 1);
+
+    /* Arrange - the block before the one byte final read has changed */
+    UT_SetDeferredRetcode(UT_KEY(OS_lseek), 2, 1);
+    UT_SetDeferredRetcode(UT_KEY(FM_CalculateCRC), 1, 0x4444);
+    UT_SetDeferredRetcode(UT_KEY(FM_CalculateCRC), 1, 0x6666);
+
+    /* Act/Assert */
+    UtAssert_INT32_EQ(FM_ChildCrcResume(UT_FM_WORKER, OS_OBJECT_ID_UNDEFINED, &base), CFE_STATUS_NOT_IMPLEMENTED);
+    UtAssert_STUB_COUNT(OS_lseek, 5);
+    UtAssert_STUB_COUNT(OS_read, 3);
+
+    /* Arrange - the file can not be moved */
+    UT_SetDefaultReturnValue(UT_KEY(OS_lseek), OS_ERROR);
+
+    /* Act/Assert - nothing is read */
+    UtAssert_INT32_EQ(FM_ChildCrcResume(UT_FM_WORKER, OS_OBJECT_ID_UNDEFINED, &base), OS_ERROR);
+    UtAssert_STUB_COUNT(OS_read, 3);
+}
+
+void Test_FM_ChildFileInfoCmd_CrcAppended(void)
+{
+    /* Arrange - the file grew by a block since the CRC of its first 100 bytes was kept */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode   = FM_GET_FILE_INFO_CC,
+                                        .Source1       = "source1",
+                                        .FileInfoCRC   = CFE_ES_CrcType_CRC_16,
+                                        .FileInfoState = FM_NAME_IS_FILE_CLOSED,
+                                        .FileInfoSize  = 100 + FM_CHILD_FILE_BLOCK_SIZE,
+                                        .FileInfoTime  = 50};
+    OS_time_t            Now         = OS_TimeAssembleFromMilliseconds(100, 0);
+
+    strncpy(FM_GlobalData.CrcCache[0].Path, "source1", OS_MAX_PATH_LEN - 1);
+    FM_GlobalData.CrcCache[0].Size        = 100;
+    FM_GlobalData.CrcCache[0].Time        = 40;
+    FM_GlobalData.CrcCache[0].CrcType     = CFE_ES_CrcType_CRC_16;
+    FM_GlobalData.CrcCache[0].Crc         = 0x1234;
+    FM_GlobalData.CrcCache[0].CheckLength = 100;
+    FM_GlobalData.CrcCache[0].HeadCrc     = 0x5555;
+    FM_GlobalData.CrcCache[0].CheckCrc    = 0x5555;
+
+    UT_SetDataBuffer(UT_KEY(OS_GetLocalTime), &Now, sizeof(Now), false);
+    UT_SetDefaultReturnValue(UT_KEY(OS_lseek), 0);
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 1, 100);
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 1, 100);
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 1, FM_CHILD_FILE_BLOCK_SIZE);
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 1, 0);
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 1, FM_CHILD_FILE_BLOCK_SIZE);
+    UT_SetDeferredRetcode(UT_KEY(FM_CalculateCRC), 1, 0x5555);
+    UT_SetDeferredRetcode(UT_KEY(FM_CalculateCRC), 1, 0x5555);
+    UT_SetDeferredRetcode(UT_KEY(FM_CalculateCRC), 1, 0x4321);
+    UT_SetDeferredRetcode(UT_KEY(FM_CalculateCRC), 1, 0x6666);
+    UT_SetDeferredRetcode(UT_KEY(FM_CalculateCRC), 1, 0x7777);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildFileInfoCmd(UT_FM_WORKER, &queue_entry));
+
+    /* Assert - only the check blocks and the appended block were read, and the grown file is kept */
+    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+
+    UtAssert_UINT32_EQ(UT_FM_WORKER->FileInfoPkt.Payload.CRC, 0x4321);
+    UtAssert_UINT32_EQ(FM_GlobalData.CrcAppendCount, 1);
+    UtAssert_STUB_COUNT(OS_read, 5);
+    UtAssert_STUB_COUNT(FM_CrcCombine, 0);
+    UtAssert_UINT32_EQ(FM_GlobalData.CrcCache[0].Size, 100 + FM_CHILD_FILE_BLOCK_SIZE);
+    UtAssert_UINT32_EQ(FM_GlobalData.CrcCache[0].Crc, 0x4321);
+
+    /* Assert - the last block came from the buffer, the first was read again */
+    UtAssert_UINT32_EQ(FM_GlobalData.CrcCache[0].CheckLength, FM_CHILD_FILE_BLOCK_SIZE);
+    UtAssert_UINT32_EQ(FM_GlobalData.CrcCache[0].CheckCrc, 0x6666);
+    UtAssert_UINT32_EQ(FM_GlobalData.CrcCache[0].HeadCrc, 0x7777);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 2);
+}
+
+void Test_FM_ChildFileInfoCmd_CrcAppendFails(void)
+{
+    /* Arrange - the file can not be moved to the end of the kept CRC */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode   = FM_GET_FILE_INFO_CC,
+                                        .Source1       = "source1",
+                                        .FileInfoCRC   = CFE_ES_CrcType_CRC_16,
+                                        .FileInfoState = FM_NAME_IS_FILE_CLOSED,
+                                        .FileInfoSize  = 200,
+                                        .FileInfoTime  = 50};
+
+    strncpy(FM_GlobalData.CrcCache[0].Path, "source1", OS_MAX_PATH_LEN - 1);
+    FM_GlobalData.CrcCache[0].Size        = 100;
+    FM_GlobalData.CrcCache[0].Time        = 40;
+    FM_GlobalData.CrcCache[0].CrcType     = CFE_ES_CrcType_CRC_16;
+    FM_GlobalData.CrcCache[0].CheckLength = 100;
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_lseek), OS_ERROR);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildFileInfoCmd(UT_FM_WORKER, &queue_entry));
+
+    /* Assert - no CRC is reported */
+    UT_FM_Child_Cmd_Assert(1, 0, 1, queue_entry.CommandCode);
+
+    UtAssert_BOOL_FALSE(UT_FM_WORKER->FileInfoPkt.Payload.CRC_Computed);
+    UtAssert_UINT32_EQ(FM_GlobalData.CrcAppendCount, 0);
+    UtAssert_STUB_COUNT(OS_read, 0);
+    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_FILE_INFO_READ_WARNING_EID);
+}
+
+/* Range read by each CRC helper when a file of the split size is split */
+#define UT_FM_CRC_RANGE_SIZE \
+    (((FM_CHILD_CRC_SPLIT_SIZE / (FM_CHILD_CRC_HELPERS + 1)) / FM_CHILD_FILE_BLOCK_SIZE) * FM_CHILD_FILE_BLOCK_SIZE)
+
+/* Every helper running, each as if it had read its whole range */
+void UT_FM_CrcHelpersReady(void)
+{
+    uint32 i;
+
+    FM_GlobalData.Crc.Method = FM_CRC_METHOD_SLICE8;
+
+    for (i = 0; i < FM_CHILD_CRC_HELPERS; i++)
+    {
+        FM_GlobalData.CrcHelper[i].Running   = true;
+        FM_GlobalData.CrcHelper[i].Result    = OS_SUCCESS;
+        FM_GlobalData.CrcHelper[i].BytesRead = UT_FM_CRC_RANGE_SIZE;
+    }
+}
+
+void Test_FM_ChildFileInfoCmd_CrcParallel(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode   = FM_GET_FILE_INFO_CC,
+                                        .Source1       = "source1",
+                                        .FileInfoCRC   = CFE_ES_CrcType_CRC_16,
+                                        .FileInfoState = FM_NAME_IS_FILE_CLOSED,
+                                        .FileInfoSize  = FM_CHILD_CRC_SPLIT_SIZE,
+                                        .FileInfoTime  = 50};
+    OS_time_t            Now         = OS_TimeAssembleFromMilliseconds(100, 0);
+
+    UT_FM_CrcHelpersReady();
+
+    UT_SetDataBuffer(UT_KEY(OS_GetLocalTime), &Now, sizeof(Now), false);
+    /* The child task reads the rest of the file after the helper ranges */
+    UT_SetDefaultReturnValue(UT_KEY(OS_lseek), FM_CHILD_CRC_HELPERS * UT_FM_CRC_RANGE_SIZE);
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), FM_CHILD_FILE_BLOCK_SIZE);
+    UT_SetDeferredRetcode(UT_KEY(OS_read),
+                          ((FM_CHILD_CRC_SPLIT_SIZE - (FM_CHILD_CRC_HELPERS * UT_FM_CRC_RANGE_SIZE)) /
+                           FM_CHILD_FILE_BLOCK_SIZE) + 1,
+                          0);
+    UT_SetDefaultReturnValue(UT_KEY(FM_CrcCombine), 0x7777);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildFileInfoCmd(UT_FM_WORKER, &queue_entry));
+
+    /* Assert - the combined CRC is reported and kept */
+    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+
+    UtAssert_BOOL_TRUE(UT_FM_WORKER->FileInfoPkt.Payload.CRC_Computed);
+    UtAssert_UINT32_EQ(UT_FM_WORKER->FileInfoPkt.Payload.CRC, 0x7777);
+    UtAssert_UINT32_EQ(FM_GlobalData.CrcCache[0].Crc, 0x7777);
+
+    /* Assert - opened once more to read the first block for the check CRCs */
+    UtAssert_STUB_COUNT(OS_OpenCreate, 2);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_FILE_INFO_CMD_INF_EID);
+}
+
+void Test_FM_ChildFileInfoCmd_CrcParallelFails(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode   = FM_GET_FILE_INFO_CC,
+                                        .Source1       = "source1",
+                                        .FileInfoCRC   = CFE_ES_CrcType_CRC_16,
+                                        .FileInfoState = FM_NAME_IS_FILE_CLOSED,
+                                        .FileInfoSize  = FM_CHILD_CRC_SPLIT_SIZE};
+
+    UT_FM_CrcHelpersReady();
+
+    FM_GlobalData.CrcHelper[0].Result = OS_ERROR;
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_lseek), FM_CHILD_CRC_HELPERS * UT_FM_CRC_RANGE_SIZE);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildFileInfoCmd(UT_FM_WORKER, &queue_entry));
+
+    /* Assert - no CRC is reported and the file is not read again */
+    UT_FM_Child_Cmd_Assert(1, 0, 1, queue_entry.CommandCode);
+
+    UtAssert_BOOL_FALSE(UT_FM_WORKER->FileInfoPkt.Payload.CRC_Computed);
+    UtAssert_UINT32_EQ(UT_FM_WORKER->FileInfoPkt.Payload.CRC, 0);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_FILE_INFO_READ_WARNING_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_GET_FILE_INFO_CMD_INF_EID);
+}
+
+void Test_FM_ChildFileInfoCmd_CrcParallelAborted(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode   = FM_GET_FILE_INFO_CC,
+                                        .Source1       = "source1",
+                                        .FileInfoCRC   = CFE_ES_CrcType_CRC_16,
+                                        .FileInfoState = FM_NAME_IS_FILE_CLOSED,
+                                        .FileInfoSize  = FM_CHILD_CRC_SPLIT_SIZE};
+
+    UT_FM_CrcHelpersReady();
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_lseek), FM_CHILD_CRC_HELPERS * UT_FM_CRC_RANGE_SIZE);
+
+    /* An abort request for the command in progress */
+    UT_FM_WORKER->CmdSequence   = 1;
+    UT_FM_WORKER->AbortSequence = 1;
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildFileInfoCmd(UT_FM_WORKER, &queue_entry));
+
+    /* Assert - the helpers are told to stop */
+    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+
+    UtAssert_UINT32_EQ(FM_GlobalData.CrcHelperStop, 1);
+    UtAssert_STUB_COUNT(OS_CountSemTake, FM_CHILD_CRC_HELPERS);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHILD_ABORT_ERR_EID);
+}
+
+void Test_FM_ChildCrcParallel_Split(void)
+{
+    FM_ChildQueueEntry_t queue_entry = {.Source1       = "source1",
+                                        .FileInfoCRC   = CFE_ES_CrcType_CRC_16,
+                                        .FileInfoSize  = FM_CHILD_CRC_SPLIT_SIZE};
+    uint32               crc         = 0;
+    uint32               i;
+
+    /* Arrange - the child task reads a block past the helper ranges */
+    UT_FM_CrcHelpersReady();
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_lseek), FM_CHILD_CRC_HELPERS * UT_FM_CRC_RANGE_SIZE);
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 1, FM_CHILD_FILE_BLOCK_SIZE);
+    UT_SetDefaultReturnValue(UT_KEY(FM_CrcCombine), 0x7777);
+
+    /* Act */
+    UtAssert_INT32_EQ(FM_ChildCrcParallel(UT_FM_WORKER, &queue_entry, &crc), OS_SUCCESS);
+
+    /* Assert - each helper was handed the next range */
+    for (i = 0; i < FM_CHILD_CRC_HELPERS; i++)
+    {
+        UtAssert_STRINGBUF_EQ(FM_GlobalData.CrcHelper[i].Path, OS_MAX_PATH_LEN, "source1", -1);
+        UtAssert_UINT32_EQ(FM_GlobalData.CrcHelper[i].Offset, i * UT_FM_CRC_RANGE_SIZE);
+        UtAssert_UINT32_EQ(FM_GlobalData.CrcHelper[i].Length, UT_FM_CRC_RANGE_SIZE);
+    }
+
+    UtAssert_UINT32_EQ(crc, 0x7777);
+    UtAssert_STUB_COUNT(OS_CountSemGive, FM_CHILD_CRC_HELPERS);
+    UtAssert_STUB_COUNT(OS_CountSemTake, FM_CHILD_CRC_HELPERS);
+    UtAssert_STUB_COUNT(FM_CrcCombine, FM_CHILD_CRC_HELPERS + 1);
+    UtAssert_UINT32_EQ(UT_FM_WORKER->ProgressBytes,
+                       (FM_CHILD_CRC_HELPERS * UT_FM_CRC_RANGE_SIZE) + FM_CHILD_FILE_BLOCK_SIZE);
+    UtAssert_BOOL_FALSE(FM_GlobalData.CrcHelperBusy);
+    UtAssert_UINT32_EQ(FM_GlobalData.CrcHelperStop, 0);
+}
+
+void Test_FM_ChildCrcParallel_Shrunk(void)
+{
+    FM_ChildQueueEntry_t queue_entry = {.Source1       = "source1",
+                                        .FileInfoCRC   = CFE_ES_CrcType_CRC_16,
+                                        .FileInfoSize  = FM_CHILD_CRC_SPLIT_SIZE};
+    uint32               crc         = 0;
+
+    /* Arrange - the file ended inside the first range */
+    UT_FM_CrcHelpersReady();
+
+    FM_GlobalData.CrcHelper[0].BytesRead = 100;
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_lseek), FM_CHILD_CRC_HELPERS * UT_FM_CRC_RANGE_SIZE);
+    UT_SetDefaultReturnValue(UT_KEY(FM_CrcCombine), 0x7777);
+
+    /* Act */
+    UtAssert_INT32_EQ(FM_ChildCrcParallel(UT_FM_WORKER, &queue_entry, &crc), CFE_STATUS_NOT_IMPLEMENTED);
+
+    /* Assert - left to a single pass */
+    UtAssert_UINT32_EQ(crc, 0);
+    UtAssert_UINT32_EQ(UT_FM_WORKER->ProgressBytes, 0);
+    UtAssert_BOOL_FALSE(FM_GlobalData.CrcHelperBusy);
+}
+
+void Test_FM_ChildCrcParallel_NotSplit(void)
+{
+    FM_ChildQueueEntry_t queue_entry = {.Source1       = "source1",
+                                        .FileInfoCRC   = CFE_ES_CrcType_CRC_16,
+                                        .FileInfoSize  = FM_CHILD_CRC_SPLIT_SIZE - 1};
+    uint32               crc         = 0;
+
+    UT_FM_CrcHelpersReady();
+
+    /* Act/Assert - a small file */
+    UtAssert_INT32_EQ(FM_ChildCrcParallel(UT_FM_WORKER, &queue_entry, &crc), CFE_STATUS_NOT_IMPLEMENTED);
+
+    /* Act/Assert - another CRC type */
+    queue_entry.FileInfoSize = FM_CHILD_CRC_SPLIT_SIZE;
+    queue_entry.FileInfoCRC  = CFE_ES_CrcType_CRC_32;
+    UtAssert_INT32_EQ(FM_ChildCrcParallel(UT_FM_WORKER, &queue_entry, &crc), CFE_STATUS_NOT_IMPLEMENTED);
+
+    /* Act/Assert - cFE computes the CRC */
+    queue_entry.FileInfoCRC  = CFE_ES_CrcType_CRC_16;
+    FM_GlobalData.Crc.Method = FM_CRC_METHOD_CFE;
+    UtAssert_INT32_EQ(FM_ChildCrcParallel(UT_FM_WORKER, &queue_entry, &crc), CFE_STATUS_NOT_IMPLEMENTED);
+
+    UtAssert_STUB_COUNT(OS_MutSemTake, 0);
+
+    /* Act/Assert - the helpers are in use by another child task */
+    FM_GlobalData.Crc.Method    = FM_CRC_METHOD_SLICE8;
+    FM_GlobalData.CrcHelperBusy = true;
+    UtAssert_INT32_EQ(FM_ChildCrcParallel(UT_FM_WORKER, &queue_entry, &crc), CFE_STATUS_NOT_IMPLEMENTED);
+    UtAssert_BOOL_TRUE(FM_GlobalData.CrcHelperBusy);
+
+    /* Act/Assert - no helper is running */
+    memset(FM_GlobalData.CrcHelper, 0, sizeof(FM_GlobalData.CrcHelper));
+    FM_GlobalData.CrcHelperBusy = false;
+    UtAssert_INT32_EQ(FM_ChildCrcParallel(UT_FM_WORKER, &queue_entry, &crc), CFE_STATUS_NOT_IMPLEMENTED);
+    UtAssert_BOOL_FALSE(FM_GlobalData.CrcHelperBusy);
+
+    UtAssert_STUB_COUNT(OS_OpenCreate, 0);
+    UtAssert_STUB_COUNT(OS_CountSemGive, 0);
+}
+
+void Test_FM_ChildCrcRange_Offset(void)
+{
+    uint8  buffer[FM_CHILD_FILE_BLOCK_SIZE];
+    uint32 crc   = 0;
+    uint32 bytes = 0;
+
+    /* Arrange - a range of one block and a part */
+    UT_SetDefaultReturnValue(UT_KEY(OS_lseek), FM_CHILD_FILE_BLOCK_SIZE);
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), FM_CHILD_FILE_BLOCK_SIZE);
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 2, 100);
+    UT_SetDefaultReturnValue(UT_KEY(FM_CalculateCRC), 0x55);
+
+    /* Act */
+    UtAssert_INT32_EQ(FM_ChildCrcRange(UT_FM_WORKER, "source1", FM_CHILD_FILE_BLOCK_SIZE,
+                                       FM_CHILD_FILE_BLOCK_SIZE + 100, buffer, &crc, &bytes),
+                      OS_SUCCESS);
+
+    /* Assert */
+    UtAssert_STUB_COUNT(OS_lseek, 1);
+    UtAssert_STUB_COUNT(OS_read, 2);
+    UtAssert_STUB_COUNT(FM_CalculateCRC, 2);
+    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_UINT32_EQ(crc, 0x55);
+    UtAssert_UINT32_EQ(bytes, FM_CHILD_FILE_BLOCK_SIZE + 100);
+    UtAssert_UINT32_EQ(UT_FM_WORKER->ProgressBytes, FM_CHILD_FILE_BLOCK_SIZE + 100);
+}
+
+void Test_FM_ChildCrcRange_Fails(void)
+{
+    uint8  buffer[FM_CHILD_FILE_BLOCK_SIZE];
+    uint32 crc   = 0;
+    uint32 bytes = 0;
+
+    /* Act/Assert - the seek falls short */
+    UtAssert_INT32_EQ(FM_ChildCrcRange(NULL, "source1", 100, 0, buffer, &crc, &bytes), OS_ERROR);
+    UtAssert_STUB_COUNT(OS_read, 0);
+    UtAssert_STUB_COUNT(OS_close, 1);
+
+    /* Act/Assert - a read error */
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 1, -1);
+    UtAssert_INT32_EQ(FM_ChildCrcRange(NULL, "source1", 0, 0, buffer, &crc, &bytes), -1);
+
+    /* Act/Assert - the rest of the file CRC has failed */
+    FM_GlobalData.CrcHelperStop = 1;
+    UtAssert_INT32_EQ(FM_ChildCrcRange(NULL, "source1", 0, 0, buffer, &crc, &bytes), OS_ERROR);
+    UtAssert_STUB_COUNT(OS_read, 1);
+
+    /* Act/Assert - the file cannot be opened */
+    UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), OS_ERROR);
+    UtAssert_INT32_EQ(FM_ChildCrcRange(NULL, "source1", 0, 0, buffer, &crc, &bytes), OS_ERROR);
+    UtAssert_STUB_COUNT(OS_close, 3);
+
+    UtAssert_UINT32_EQ(bytes, 0);
+    UtAssert_STUB_COUNT(FM_CalculateCRC, 0);
+}
+
+/* ****************
+ * ChildFileDigestCmd Tests
+ * ***************/
+void Test_FM_ChildFileDigestCmd_Success(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_GET_FILE_DIGEST_CC, .Source1 = "source1", .FileInfoCRC = FM_DIGEST_XXH64};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), FM_CHILD_FILE_BLOCK_SIZE);
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 3, 0);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildFileDigestCmd(UT_FM_WORKER, &queue_entry));
+
+    /* Assert - each block is read once for every digest */
+    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_read, 3);
+    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_STUB_COUNT(FM_DigestStart, 1);
+    UtAssert_STUB_COUNT(FM_DigestUpdate, 2);
+    UtAssert_STUB_COUNT(FM_DigestFinish, 1);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+    UtAssert_UINT32_EQ(UT_FM_WORKER->FileDigestPkt.Payload.Digests, FM_DIGEST_XXH64);
+    UtAssert_UINT32_EQ(UT_FM_WORKER->FileDigestPkt.Payload.FileSize, 2 * FM_CHILD_FILE_BLOCK_SIZE);
+    UtAssert_STRINGBUF_EQ(UT_FM_WORKER->FileDigestPkt.Payload.Filename,
+                          sizeof(UT_FM_WORKER->FileDigestPkt.Payload.Filename), "source1", sizeof("source1"));
+    UtAssert_UINT32_EQ(UT_FM_WORKER->ProgressBytes, 2 * FM_CHILD_FILE_BLOCK_SIZE);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_FILE_DIGEST_CMD_INF_EID);
+}
+
+void Test_FM_ChildFileDigestCmd_OpenFails(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_GET_FILE_DIGEST_CC, .Source1 = "source1", .FileInfoCRC = FM_DIGEST_ALL};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), OS_ERROR);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildFileDigestCmd(UT_FM_WORKER, &queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_read, 0);
+    UtAssert_STUB_COUNT(OS_close, 0);
+    UtAssert_STUB_COUNT(FM_DigestFinish, 0);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_FILE_DIGEST_OPEN_ERR_EID);
+}
+
+void Test_FM_ChildFileDigestCmd_ReadFails(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_GET_FILE_DIGEST_CC, .Source1 = "source1", .FileInfoCRC = FM_DIGEST_ALL};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), FM_CHILD_FILE_BLOCK_SIZE);
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 2, -1);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildFileDigestCmd(UT_FM_WORKER, &queue_entry));
+
+    /* Assert - no digests of part of the file are reported */
+    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_read, 2);
+    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_STUB_COUNT(FM_DigestUpdate, 1);
+    UtAssert_STUB_COUNT(FM_DigestFinish, 0);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_FILE_DIGEST_READ_ERR_EID);
+}
+
+void Test_FM_ChildFileDigestCmd_Aborted(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_GET_FILE_DIGEST_CC, .Source1 = "source1", .FileInfoCRC = FM_DIGEST_ALL};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), FM_CHILD_FILE_BLOCK_SIZE);
+
+    /* An abort request for the command in progress */
+    UT_FM_WORKER->CmdSequence   = 1;
+    UT_FM_WORKER->AbortSequence = 1;
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildFileDigestCmd(UT_FM_WORKER, &queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_read, 1);
+    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_STUB_COUNT(FM_DigestUpdate, 0);
+    UtAssert_STUB_COUNT(FM_DigestFinish, 0);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHILD_ABORT_ERR_EID);
+}
+
+/* ****************
+ * ChildCreateDirectoryCmd Tests
+ * ***************/
+void Test_FM_ChildCreateDirectoryCmd_OSMkDirSuccess(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_CREATE_DIRECTORY_CC};
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildCreateDirectoryCmd(UT_FM_WORKER, &queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_mkdir, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CREATE_DIR_CMD_INF_EID);
+}
+
+void Test_FM_ChildCreateDirectoryCmd_OSMkDirNotSuccess(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_CREATE_DIRECTORY_CC};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_mkdir), !CFE_SUCCESS);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildCreateDirectoryCmd(UT_FM_WORKER, &queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_mkdir, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CREATE_DIR_OS_ERR_EID);
+}
+
+/* ****************
+ * ChildDeleteDirectoryCmd Tests
+ * ***************/
+void Test_FM_ChildDeleteDirectoryCmd_OSDirectoryOpenNoSuccess(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DELETE_DIRECTORY_CC};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryOpen), !OS_SUCCESS);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDeleteDirectoryCmd(UT_FM_WORKER, &queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_OPENDIR_OS_ERR_EID);
+}
+
+void Test_FM_ChildDeleteDirectoryCmd_OSDirectoryReadNoSuccess(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DELETE_DIRECTORY_CC};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryRead), !OS_SUCCESS);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDeleteDirectoryCmd(UT_FM_WORKER, &queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_DIR_CMD_INF_EID);
+}
+
+void Test_FM_ChildDeleteDirectoryCmd_StrCmpThisDirectoryZero(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DELETE_DIRECTORY_CC};
+    os_dirent_t          direntry    = {.FileName = FM_THIS_DIRECTORY};
+
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDeleteDirectoryCmd(UT_FM_WORKER, &queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_DIR_CMD_INF_EID);
+}
+
+void Test_FM_ChildDeleteDirectoryCmd_StrCmpParentDirectoryZero(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DELETE_DIRECTORY_CC};
+    os_dirent_t          direntry    = {.FileName = FM_PARENT_DIRECTORY};
+
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDeleteDirectoryCmd(UT_FM_WORKER, &queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 3);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_DIR_EMPTY_ERR_EID);
+}
+
+void Test_FM_ChildDeleteDirectoryCmd_RemoveTheDirIsTrueRmDirSuccess(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DELETE_DIRECTORY_CC};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryRead), !OS_SUCCESS);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDeleteDirectoryCmd(UT_FM_WORKER, &queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_DIR_CMD_INF_EID);
+}
+
+void Test_FM_ChildDeleteDirectoryCmd_RemoveDirTrueOSRmDirNotSuccess(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DELETE_DIRECTORY_CC};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryRead), !OS_SUCCESS);
+    UT_SetDefaultReturnValue(UT_KEY(OS_rmdir), !OS_SUCCESS);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDeleteDirectoryCmd(UT_FM_WORKER, &queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_RMDIR_OS_ERR_EID);
+}
+
+/* ****************
+ * ChildDeleteTreeCmd Tests
+ * ***************/
+
+void Test_FM_ChildDeleteTreeCmd_Nested(void)
+{
+    /* Arrange - "dir" holds the sub-directory "sub" and the closed file "file1" */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DELETE_TREE_CC, .Source1 = "dir"};
+    os_dirent_t          direntry[2] = {{.FileName = "sub"}, {.FileName = "file1"}};
+
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 3, !OS_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), direntry, sizeof(direntry), false);
+    UT_SetDeferredRetcode(UT_KEY(FM_GetFilenameState), 1, FM_NAME_IS_DIRECTORY);
+    UT_SetDefaultReturnValue(UT_KEY(FM_GetFilenameState), FM_NAME_IS_FILE_CLOSED);
+
+    /* "sub" cannot be read, which leaves it for OS_rmdir */
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryOpen), 2, !OS_SUCCESS);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDeleteTreeCmd(UT_FM_WORKER, &queue_entry));
+
+    /* Assert - the file and both directories, the sub-directory first */
+    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+
+    UtAssert_ZERO(UT_FM_WORKER->TreeDepth);
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 2);
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
+    UtAssert_STUB_COUNT(OS_remove, 1);
+    UtAssert_STUB_COUNT(OS_rmdir, 2);
+    UtAssert_STRINGBUF_EQ(UT_FM_WORKER->TreeStack[1].Path, OS_MAX_PATH_LEN, "dir/sub", -1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_TREE_CMD_INF_EID);
+}
+
+void Test_FM_ChildDeleteTreeCmd_OpenFile(void)
+{
+    /* Arrange - an open file keeps the directory */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DELETE_TREE_CC, .Source1 = "dir"};
+    os_dirent_t          direntry    = {.FileName = "file1"};
+
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_GetFilenameState), FM_NAME_IS_FILE_OPEN);
+    UT_SetDefaultReturnValue(UT_KEY(OS_rmdir), !OS_SUCCESS);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDeleteTreeCmd(UT_FM_WORKER, &queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_remove, 0);
+    UtAssert_STUB_COUNT(OS_rmdir, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_TREE_INCOMPLETE_ERR_EID);
+}
+
+void Test_FM_ChildDeleteTreeCmd_Aborted(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DELETE_TREE_CC, .Source1 = "dir"};
+
+    /* An abort request for the command in progress */
+    UT_FM_WORKER->CmdSequence   = 1;
+    UT_FM_WORKER->AbortSequence = 1;
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDeleteTreeCmd(UT_FM_WORKER, &queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 0);
+    UtAssert_STUB_COUNT(OS_rmdir, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHILD_ABORT_ERR_EID);
+}
+
+void Test_FM_ChildDeleteTreeScan_OpenFails(void)
+{
+    /* Arrange */
+    uint32 not_deleted = 0;
+    uint32 skipped     = 0;
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryOpen), !OS_SUCCESS);
+
+    /* Act */
+    UtAssert_ZERO(FM_ChildDeleteTreeScan(UT_FM_WORKER, "dir", "Cmd Text", &not_deleted, &skipped));
+
+    /* Assert - the directory is left for OS_rmdir to report */
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 0);
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 0);
+    UtAssert_STRINGBUF_EQ(UT_FM_WORKER->ProgressSource, sizeof(UT_FM_WORKER->ProgressSource), "dir", -1);
+}
+
+void Test_FM_ChildDeleteTreeScan_OffsetDirectory(void)
+{
+    /* Arrange - a directory read by entry offset and larger than one batch */
+    uint32 not_deleted = 0;
+    uint32 skipped     = 0;
+
+    UT_FM_OffsetDirSetup();
+
+    /* Act */
+    UtAssert_UINT32_EQ(FM_ChildDeleteTreeScan(UT_FM_WORKER, "dir", "Cmd Text", &not_deleted, &skipped),
+                       UT_FM_OFFSET_DIR_ENTRIES - 14);
+
+    /* Assert - each file is counted once and each sub-directory is pushed once */
+    UtAssert_UINT32_EQ(not_deleted, 6);
+    UtAssert_ZERO(skipped);
+    UtAssert_UINT32_EQ(UT_FM_WORKER->TreeDepth, 8);
+    UtAssert_UINT32_EQ(UT_FM_OffsetDirRemaining(), 14);
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
+}
+
+void Test_FM_ChildDeleteTreePush_Full(void)
+{
+    /* Act */
+    UtAssert_BOOL_TRUE(FM_ChildDeleteTreePush(UT_FM_WORKER, "dir"));
+
+    /* Assert */
+    UtAssert_UINT32_EQ(UT_FM_WORKER->TreeDepth, 1);
+    UtAssert_BOOL_FALSE(UT_FM_WORKER->TreeStack[0].Scanned);
+    UtAssert_STRINGBUF_EQ(UT_FM_WORKER->TreeStack[0].Path, OS_MAX_PATH_LEN, "dir", -1);
+
+    /* A full stack is left as it is */
+    UT_FM_WORKER->TreeDepth = FM_CHILD_TREE_STACK_SIZE;
+
+    UtAssert_BOOL_FALSE(FM_ChildDeleteTreePush(UT_FM_WORKER, "dir2"));
+    UtAssert_UINT32_EQ(UT_FM_WORKER->TreeDepth, FM_CHILD_TREE_STACK_SIZE);
+}
+
+/* ****************
+ * ChildFilterFilesCmd Tests
+ * ***************/
+
+void Test_FM_ChildFilterFilesCmd_Delete(void)
+{
+    /* Arrange - "a.dat" passes, "b.txt" does not match and "sub" is a directory */
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_FILTER_FILES_CC, .FilterAction = FM_FILTER_ACTION_DELETE, .Source1 = "dir", .Source2 = "*"};
+    os_dirent_t          direntry[3] = {{.FileName = "a.dat"}, {.FileName = "b.txt"}, {.FileName = "sub"}};
+    os_fstat_t           filestats[2];
+
+    memset(filestats, 0, sizeof(filestats));
+    filestats[0].FileSize     = 10;
+    filestats[1].FileModeBits = OS_FILESTAT_MODE_DIR;
+
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 4, !OS_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), direntry, sizeof(direntry), false);
+    UT_SetDeferredRetcode(UT_KEY(FM_MatchPattern), 2, false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_MatchPattern), true);
+    UT_SetDataBuffer(UT_KEY(OS_stat), filestats, sizeof(filestats), false);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildFilterFilesCmd(UT_FM_WORKER, &queue_entry));
+
+    /* Assert - only the names that match are passed to OS_stat */
+    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_stat, 2);
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
+    UtAssert_STUB_COUNT(OS_remove, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_FILTER_FILES_CMD_INF_EID);
+}
+
+void Test_FM_ChildFilterFilesCmd_MoveTargetExists(void)
+{
+    /* Arrange - the target file exists and overwrite is not set */
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_FILTER_FILES_CC, .FilterAction = FM_FILTER_ACTION_MOVE, .Source1 = "dir", .Target = "tgt"};
+    os_dirent_t          direntry    = {.FileName = "a.dat"};
+
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_MatchPattern), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_GetFilenameState), FM_NAME_IS_FILE_CLOSED);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildFilterFilesCmd(UT_FM_WORKER, &queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 1, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(FM_GetFilenameState, 1);
+    UtAssert_STUB_COUNT(OS_rename, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_FILTER_FILES_CMD_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_FILTER_FILES_WARNING_EID);
+}
+
+void Test_FM_ChildFilterFilesCmd_OpenFails(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_FILTER_FILES_CC, .Source1 = "dir"};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryOpen), !OS_SUCCESS);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildFilterFilesCmd(UT_FM_WORKER, &queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_FILTER_FILES_OS_ERR_EID);
+}
+
+/* ****************
+ * ChildRetentionCmd Tests
+ * ***************/
+
+void Test_FM_ChildRetentionCmd_EvictOldest(void)
+{
+    /* Arrange - three files against a limit of one, "sub" is a directory */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_ENFORCE_RETENTION_CC, .Source1 = "dir"};
+    FM_RetentionState_t *State       = &FM_GlobalData.Retention[0];
+    os_dirent_t          direntry[4] = {{.FileName = "a"}, {.FileName = "b"}, {.FileName = "c"}, {.FileName = "sub"}};
+    os_fstat_t           filestats[4];
+
+    memset(filestats, 0, sizeof(filestats));
+    filestats[0].FileTime     = OS_TimeAssembleFromMilliseconds(30, 0);
+    filestats[0].FileSize     = 1;
+    filestats[1].FileTime     = OS_TimeAssembleFromMilliseconds(10, 0);
+    filestats[1].FileSize     = 2;
+    filestats[2].FileTime     = OS_TimeAssembleFromMilliseconds(20, 0);
+    filestats[2].FileSize     = 4;
+    filestats[3].FileModeBits = OS_FILESTAT_MODE_DIR;
+
+    State->Busy            = 1;
+    State->Commanded       = true;
+    State->Policy.MaxFiles = 1;
+
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 5, !OS_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), direntry, sizeof(direntry), false);
+    UT_SetDataBuffer(UT_KEY(OS_stat), filestats, sizeof(filestats), false);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildRetentionCmd(UT_FM_WORKER, &queue_entry));
+
+    /* Assert - the two oldest files are removed */
+    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_stat, 4);
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
+    UtAssert_STUB_COUNT(OS_remove, 2);
+    UtAssert_UINT32_EQ(State->FileCount, 1);
+    UtAssert_UINT32_EQ(State->ByteCount, 1);
+    UtAssert_UINT32_EQ(State->Busy, 0);
+    UtAssert_UINT32_EQ(FM_GlobalData.RetentionPassCount, 1);
+    UtAssert_UINT32_EQ(FM_GlobalData.RetentionFileCount, 2);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_ENFORCE_RETENTION_CMD_INF_EID);
+}
+
+void Test_FM_ChildRetentionCmd_StillOver(void)
+{
+    /* Arrange - the only file cannot be removed */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_ENFORCE_RETENTION_CC, .Source1 = "dir"};
+    FM_RetentionState_t *State       = &FM_GlobalData.Retention[0];
+    os_dirent_t          direntry    = {.FileName = "a"};
+    os_fstat_t           filestats;
+
+    memset(&filestats, 0, sizeof(filestats));
+    filestats.FileSize = 100;
+
+    State->Busy            = 1;
+    State->Commanded       = false;
+    State->Policy.MaxBytes = 10;
+
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDataBuffer(UT_KEY(OS_stat), &filestats, sizeof(filestats), false);
+    UT_SetDefaultReturnValue(UT_KEY(OS_remove), !OS_SUCCESS);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildRetentionCmd(UT_FM_WORKER, &queue_entry));
+
+    /* Assert - a scheduled pass only warns */
+    UT_FM_Child_Cmd_Assert(0, 0, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_remove, 1);
+    UtAssert_UINT32_EQ(State->Busy, 0);
+    UtAssert_UINT32_EQ(FM_GlobalData.RetentionFileCount, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_ENFORCE_RETENTION_WARNING_EID);
+}
+
+void Test_FM_ChildRetentionCmd_OpenFails(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_ENFORCE_RETENTION_CC, .Source1 = "dir"};
+
+    FM_GlobalData.Retention[0].Busy      = 1;
+    FM_GlobalData.Retention[0].Commanded = true;
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryOpen), !OS_SUCCESS);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildRetentionCmd(UT_FM_WORKER, &queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 0);
+    UtAssert_UINT32_EQ(FM_GlobalData.Retention[0].Busy, 0);
+    UtAssert_UINT32_EQ(FM_GlobalData.RetentionPassCount, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_ENFORCE_RETENTION_OS_ERR_EID);
+}
+
+void Test_FM_ChildRetentionOffer_Bounded(void)
+{
+    /* Arrange - newest first, one file more than the index holds */
+    FM_RetentionState_t *State = &FM_GlobalData.Retention[0];
+    FM_RetentionFile_t   File;
+    uint32               i;
+
+    memset(&File, 0, sizeof(File));
+
+    /* Act */
+    for (i = FM_RETENTION_INDEX_SIZE + 1; i > 0; i--)
+    {
+        File.Time = i;
+        UtAssert_VOIDCALL(FM_ChildRetentionOffer(State, &File));
+    }
+
+    /* Assert - the newest file dropped out and the newest kept is on top */
+    UtAssert_UINT32_EQ(State->IndexCount, FM_RETENTION_INDEX_SIZE);
+    UtAssert_UINT32_EQ(State->Index[0].Time, FM_RETENTION_INDEX_SIZE);
+
+    /* Turned over, the files come off the top oldest first */
+    for (i = State->IndexCount / 2; i > 0; i--)
+    {
+        FM_ChildRetentionSift(State->Index, State->IndexCount, i - 1, true);
+    }
+
+    for (i = 1; i <= FM_RETENTION_INDEX_SIZE; i++)
+    {
+        UtAssert_UINT32_EQ(State->Index[0].Time, i);
+
+        State->IndexCount--;
+        State->Index[0] = State->Index[State->IndexCount];
+        FM_ChildRetentionSift(State->Index, State->IndexCount, 0, true);
+    }
+}
+
+void Test_FM_ChildRetentionPriority(void)
+{
+    FM_RetentionTableEntry_t Policy;
+
+    memset(&Policy, 0, sizeof(Policy));
+    snprintf(Policy.Priority[1], sizeof(Policy.Priority[1]), "*.tmp");
+    snprintf(Policy.Priority[2], sizeof(Policy.Priority[2]), "*.log");
+
+    /* Oldest first order ignores the patterns */
+    Policy.Order = FM_RETENTION_ORDER_OLDEST;
+    UtAssert_UINT32_EQ(FM_ChildRetentionPriority(&Policy, "a.log"), 0);
+    UtAssert_STUB_COUNT(FM_MatchPattern, 0);
+
+    /* First matching pattern, empty patterns are skipped */
+    Policy.Order = FM_RETENTION_ORDER_PRIORITY;
+    UT_SetDeferredRetcode(UT_KEY(FM_MatchPattern), 2, true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_MatchPattern), false);
+    UtAssert_UINT32_EQ(FM_ChildRetentionPriority(&Policy, "a.log"), 2);
+    UtAssert_STUB_COUNT(FM_MatchPattern, 2);
+
+    /* No match */
+    UtAssert_UINT32_EQ(FM_ChildRetentionPriority(&Policy, "a.dat"), FM_RETENTION_PATTERN_COUNT);
+}
+
+void Test_FM_ChildRetentionAbove(void)
+{
+    FM_RetentionFile_t Old  = {.Priority = 1, .Time = 10};
+    FM_RetentionFile_t New  = {.Priority = 1, .Time = 20};
+    FM_RetentionFile_t Temp = {.Priority = 0, .Time = 30};
+
+    /* Priority first, then age */
+    UtAssert_BOOL_TRUE(FM_ChildRetentionAbove(&Old, &New, true));
+    UtAssert_BOOL_TRUE(FM_ChildRetentionAbove(&Temp, &Old, true));
+    UtAssert_BOOL_FALSE(FM_ChildRetentionAbove(&Old, &Old, true));
+
+    /* Reversed while the directory is read */
+    UtAssert_BOOL_TRUE(FM_ChildRetentionAbove(&New, &Old, false));
+    UtAssert_BOOL_FALSE(FM_ChildRetentionAbove(&Temp, &Old, false));
+}
+
+void Test_FM_ChildRetentionEvict_OpenFile(void)
+{
+    /* Arrange - the first file to go is open */
+    FM_RetentionState_t *State         = &FM_GlobalData.Retention[0];
+    uint64               bytes_removed = 0;
+
+    State->Policy.MaxFiles = 1;
+    State->FileCount       = 3;
+    State->ByteCount       = 30;
+    State->IndexCount      = 2;
+    State->Index[0].Size   = 10;
+    State->Index[1].Size   = 10;
+
+    UT_FM_WORKER->OpenPaths.Valid = true;
+
+    UT_SetDeferredRetcode(UT_KEY(FM_IsPathOpen), 1, true);
+
+    /* Act */
+    UtAssert_UINT32_EQ(FM_ChildRetentionEvict(UT_FM_WORKER, State, "dir/", "Cmd Text", &bytes_removed), 1);
+
+    /* Assert - each file is checked against a new snapshot, the open file stays counted */
+    UtAssert_BOOL_FALSE(UT_FM_WORKER->OpenPaths.Valid);
+    UtAssert_STUB_COUNT(FM_IsPathOpen, 2);
+    UtAssert_STUB_COUNT(OS_remove, 1);
+    UtAssert_UINT32_EQ(State->IndexCount, 0);
+    UtAssert_UINT32_EQ(State->FileCount, 2);
+    UtAssert_UINT32_EQ(State->ByteCount, 20);
+    UtAssert_UINT32_EQ(bytes_removed, 10);
+}
+
+void Test_FM_ChildRetentionOver(void)
+{
+    FM_RetentionState_t *State = &FM_GlobalData.Retention[0];
+
+    State->FileCount = 5;
+    State->ByteCount = 500;
+
+    /* No limits */
+    UtAssert_BOOL_FALSE(FM_ChildRetentionOver(State));
+
+    State->Policy.MaxFiles = 5;
+    State->Policy.MaxBytes = 500;
+    UtAssert_BOOL_FALSE(FM_ChildRetentionOver(State));
+
+    State->Policy.MaxBytes = 499;
+    UtAssert_BOOL_TRUE(FM_ChildRetentionOver(State));
+
+    State->Policy.MaxFiles = 4;
+    State->Policy.MaxBytes = 0;
+    UtAssert_BOOL_TRUE(FM_ChildRetentionOver(State));
+}
+
+/* ****************
+ * ChildPurgeCmd Tests
+ * ***************/
+
+#define UT_FM_TRASH_DIR "/ram/" FM_CHILD_TRASH_DIR_NAME
+
+void Test_FM_ChildPurgeCmd_Commanded(void)
+{
+    /* Arrange - two files in the trash of a claimed volume */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_PURGE_TRASH_CC};
+    os_dirent_t          direntry[2] = {{.FileName = "00000000"}, {.FileName = "00000001"}};
+
+    strncpy(FM_GlobalData.Trash[0].Path, UT_FM_TRASH_DIR, OS_MAX_PATH_LEN - 1);
+    FM_GlobalData.TrashPurgeCommanded = true;
+    FM_GlobalData.TrashPurgeBusy      = 1;
+
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 3, !OS_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), direntry, sizeof(direntry), false);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildPurgeCmd(UT_FM_WORKER, &queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
+    UtAssert_STUB_COUNT(OS_remove, 2);
+    UtAssert_UINT32_EQ(FM_GlobalData.TrashPurgeCount, 2);
+    UtAssert_UINT32_EQ(FM_GlobalData.TrashPurgeBusy, 0);
+    UtAssert_UINT32_EQ(FM_GlobalData.Trash[0].Pending, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_PURGE_TRASH_CMD_INF_EID);
+}
+
+void Test_FM_ChildPurgeCmd_NotPurged(void)
+{
+    /* Arrange - the only file cannot be removed */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_PURGE_TRASH_CC};
+    os_dirent_t          direntry    = {.FileName = "00000000"};
+
+    strncpy(FM_GlobalData.Trash[0].Path, UT_FM_TRASH_DIR, OS_MAX_PATH_LEN - 1);
+    FM_GlobalData.TrashPurgeCommanded = true;
+
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDefaultReturnValue(UT_KEY(OS_remove), !OS_SUCCESS);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildPurgeCmd(UT_FM_WORKER, &queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 1, queue_entry.CommandCode);
+
+    UtAssert_UINT32_EQ(FM_GlobalData.TrashPurgeCount, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_PURGE_TRASH_CMD_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_PURGE_TRASH_WARNING_EID);
+}
+
+void Test_FM_ChildPurgeCmd_OpenFails(void)
+{
+    /* Arrange - a scheduled pass */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_PURGE_TRASH_CC};
+
+    strncpy(FM_GlobalData.Trash[0].Path, UT_FM_TRASH_DIR, OS_MAX_PATH_LEN - 1);
+    FM_GlobalData.Trash[0].Pending = 1;
+    FM_GlobalData.TrashPurgeBusy   = 1;
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryOpen), !OS_SUCCESS);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildPurgeCmd(UT_FM_WORKER, &queue_entry));
+
+    /* Assert - the directory is not tried again until more files are put in it */
+    UT_FM_Child_Cmd_Assert(0, 0, 0, queue_entry.CommandCode);
+
+    UtAssert_UINT32_EQ(FM_GlobalData.Trash[0].Pending, 0);
+    UtAssert_UINT32_EQ(FM_GlobalData.TrashPurgeBusy, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_PURGE_TRASH_OS_ERR_EID);
+}
+
+void Test_FM_ChildPurgeCmd_NotPending(void)
+{
+    /* Arrange - a scheduled pass skips trash directories known to be empty */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_PURGE_TRASH_CC};
+
+    strncpy(FM_GlobalData.Trash[0].Path, UT_FM_TRASH_DIR, OS_MAX_PATH_LEN - 1);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildPurgeCmd(UT_FM_WORKER, &queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(0, 0, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_FM_ChildPurgeCmd_Budget(void)
+{
+    /* Arrange - a scheduled pass over a trash directory that never ends */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_PURGE_TRASH_CC};
+
+    strncpy(FM_GlobalData.Trash[0].Path, UT_FM_TRASH_DIR, OS_MAX_PATH_LEN - 1);
+    FM_GlobalData.Trash[0].Pending = 1;
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildPurgeCmd(UT_FM_WORKER, &queue_entry));
+
+    /* Assert - the rest is left for the next pass */
+    UT_FM_Child_Cmd_Assert(0, 0, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_DirectoryRead, FM_CHILD_PURGE_BUDGET);
+    UtAssert_STUB_COUNT(OS_remove, FM_CHILD_PURGE_BUDGET);
+    UtAssert_UINT32_EQ(FM_GlobalData.TrashPurgeCount, FM_CHILD_PURGE_BUDGET);
+    UtAssert_UINT32_EQ(FM_GlobalData.Trash[0].Pending, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_FM_ChildPurgeCollect_MaxCount(void)
+{
+    /* Arrange */
+    os_dirent_t direntry[3] = {{.FileName = "."}, {.FileName = "00000000"}, {.FileName = "00000001"}};
+
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), direntry, sizeof(direntry), false);
+
+    /* Act */
+    UtAssert_BOOL_FALSE(FM_ChildPurgeCollect(UT_FM_WORKER, FM_UT_OBJID_1, "Cmd Text", 1));
+
+    /* Assert - no OS_stat is spent on trash entries */
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
+    UtAssert_STUB_COUNT(OS_stat, 0);
+    UtAssert_UINT32_EQ(UT_FM_WORKER->DeleteListCount, 1);
+    UtAssert_STRINGBUF_EQ(UT_FM_WORKER->DeleteList, FM_CHILD_DELETE_LIST_SIZE, "00000000", -1);
+}
+
+void Test_FM_ChildPurgeVolume_OffsetDirectory(void)
+{
+    /* Arrange - a commanded pass over a trash directory read by entry offset */
+    uint32 purged     = 0;
+    uint32 not_purged = 0;
+
+    UT_FM_OffsetDirSetup();
+
+    /* Act */
+    UtAssert_BOOL_TRUE(FM_ChildPurgeVolume(UT_FM_WORKER, FM_UT_OBJID_1, UT_FM_TRASH_DIR, 0, &purged, &not_purged));
+
+    /* Assert - no entry is read past and none is counted twice */
+    UtAssert_UINT32_EQ(purged, UT_FM_OFFSET_DIR_ENTRIES - 14);
+    UtAssert_UINT32_EQ(not_purged, 14);
+    UtAssert_STUB_COUNT(OS_remove, UT_FM_OFFSET_DIR_ENTRIES);
+    UtAssert_UINT32_EQ(UT_FM_OffsetDirRemaining(), 14);
+}
+
+/* ****************
+ * ChildTrashFile Tests
+ * ***************/
+
+void Test_FM_ChildTrashFile_DirectMode(void)
+{
+    /* Act */
+    UtAssert_BOOL_FALSE(FM_ChildTrashFile("/ram/file"));
+
+    /* Assert */
+    UtAssert_STUB_COUNT(OS_rename, 0);
+    UtAssert_STUB_COUNT(OS_MutSemTake, 0);
+}
+
+void Test_FM_ChildTrashFile_Renamed(void)
+{
+    /* Arrange */
+    FM_GlobalData.ChildDeleteMode = FM_DELETE_MODE_TRASH;
+    strncpy(FM_GlobalData.Trash[0].Path, UT_FM_TRASH_DIR, OS_MAX_PATH_LEN - 1);
+
+    /* Act */
+    UtAssert_BOOL_TRUE(FM_ChildTrashFile("/ram/dir/file"));
+
+    /* Assert */
+    UtAssert_STUB_COUNT(OS_rename, 1);
+    UtAssert_STUB_COUNT(OS_mkdir, 0);
+    UtAssert_UINT32_EQ(FM_GlobalData.Trash[0].Pending, 1);
+    UtAssert_UINT32_EQ(FM_GlobalData.TrashFileCount, 1);
+    UtAssert_UINT32_EQ(FM_GlobalData.TrashSequence, 1);
+}
+
+void Test_FM_ChildTrashFile_RenameFails(void)
+{
+    /* Arrange */
+    FM_GlobalData.ChildDeleteMode = FM_DELETE_MODE_TRASH;
+    strncpy(FM_GlobalData.Trash[0].Path, UT_FM_TRASH_DIR, OS_MAX_PATH_LEN - 1);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_rename), !OS_SUCCESS);
+
+    /* Act */
+    UtAssert_BOOL_FALSE(FM_ChildTrashFile("/ram/file"));
+
+    /* Assert - the caller removes the file */
+    UtAssert_UINT32_EQ(FM_GlobalData.Trash[0].Pending, 0);
+    UtAssert_UINT32_EQ(FM_GlobalData.TrashFileCount, 0);
+}
+
+void Test_FM_ChildDeleteCmd_Trashed(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DELETE_FILE_CC, .Source1 = "/ram/file"};
+
+    FM_GlobalData.ChildDeleteMode = FM_DELETE_MODE_TRASH;
+    strncpy(FM_GlobalData.Trash[0].Path, UT_FM_TRASH_DIR, OS_MAX_PATH_LEN - 1);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDeleteCmd(UT_FM_WORKER, &queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_rename, 1);
+    UtAssert_STUB_COUNT(OS_remove, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_DELETE_CMD_INF_EID);
+}
+
+/* ****************
+ * ChildTrashVolume Tests
+ * ***************/
+
+void Test_FM_ChildTrashVolume_NoVolume(void)
+{
+    char trash_dir[OS_MAX_PATH_LEN];
+
+    /* Act - neither name has a volume component */
+    UtAssert_UINT32_EQ(FM_ChildTrashVolume("file", trash_dir, sizeof(trash_dir)), FM_CHILD_TRASH_VOLUMES);
+    UtAssert_UINT32_EQ(FM_ChildTrashVolume("/file", trash_dir, sizeof(trash_dir)), FM_CHILD_TRASH_VOLUMES);
+
+    /* Assert */
+    UtAssert_STUB_COUNT(OS_MutSemTake, 0);
+}
+
+void Test_FM_ChildTrashVolume_InTrash(void)
+{
+    char trash_dir[OS_MAX_PATH_LEN];
+
+    /* Act */
+    UtAssert_UINT32_EQ(FM_ChildTrashVolume(UT_FM_TRASH_DIR "/00000000", trash_dir, sizeof(trash_dir)),
+                       FM_CHILD_TRASH_VOLUMES);
+
+    /* Assert */
+    UtAssert_STRINGBUF_EQ(trash_dir, sizeof(trash_dir), UT_FM_TRASH_DIR, -1);
+    UtAssert_STUB_COUNT(OS_MutSemTake, 0);
+}
+
+void Test_FM_ChildTrashVolume_Claim(void)
+{
+    char       trash_dir[OS_MAX_PATH_LEN];
+    os_fstat_t filestats;
+
+    /* Arrange - the first entry belongs to another volume */
+    memset(&filestats, 0, sizeof(filestats));
+    filestats.FileModeBits = OS_FILESTAT_MODE_DIR;
+    strncpy(FM_GlobalData.Trash[0].Path, "/cf/" FM_CHILD_TRASH_DIR_NAME, OS_MAX_PATH_LEN - 1);
+
+    UT_SetDataBuffer(UT_KEY(OS_stat), &filestats, sizeof(filestats), false);
+
+    /* Act */
+    UtAssert_UINT32_EQ(FM_ChildTrashVolume("/ram/dir/file", trash_dir, sizeof(trash_dir)), 1);
+
+    /* Assert - files left by an earlier run will be purged */
+    UtAssert_STUB_COUNT(OS_mkdir, 1);
+    UtAssert_STRINGBUF_EQ(FM_GlobalData.Trash[1].Path, OS_MAX_PATH_LEN, UT_FM_TRASH_DIR, -1);
+    UtAssert_UINT32_EQ(FM_GlobalData.Trash[1].Pending, 1);
+    UtAssert_STUB_COUNT(OS_MutSemGive, 1);
+
+    /* Act - the volume is found again without creating the directory */
+    UtAssert_UINT32_EQ(FM_ChildTrashVolume("/ram/file", trash_dir, sizeof(trash_dir)), 1);
+
+    /* Assert */
+    UtAssert_STUB_COUNT(OS_mkdir, 1);
+    UtAssert_STUB_COUNT(OS_stat, 1);
+}
+
+void Test_FM_ChildTrashVolume_NotDirectory(void)
+{
+    char trash_dir[OS_MAX_PATH_LEN];
+
+    /* Act - the trash name is taken by a file */
+    UtAssert_UINT32_EQ(FM_ChildTrashVolume("/ram/file", trash_dir, sizeof(trash_dir)), FM_CHILD_TRASH_VOLUMES);
+
+    /* Assert */
+    UtAssert_STUB_COUNT(OS_stat, 1);
+    UtAssert_STRINGBUF_EQ(FM_GlobalData.Trash[0].Path, OS_MAX_PATH_LEN, "", -1);
+}
+
+void Test_FM_ChildTrashVolume_Full(void)
+{
+    char   trash_dir[OS_MAX_PATH_LEN];
+    uint32 i;
+
+    /* Arrange - every entry belongs to another volume */
+    for (i = 0; i < FM_CHILD_TRASH_VOLUMES; i++)
+    {
+        snprintf(FM_GlobalData.Trash[i].Path, OS_MAX_PATH_LEN, "/vol%u/trash", (unsigned int)i);
+    }
+
+    /* Act */
+    UtAssert_UINT32_EQ(FM_ChildTrashVolume("/ram/file", trash_dir, sizeof(trash_dir)), FM_CHILD_TRASH_VOLUMES);
+
+    /* Assert */
+    UtAssert_STUB_COUNT(OS_mkdir, 0);
+}
+
+void Test_FM_ChildFilterCollect_OpenFile(void)
+{
+    /* Arrange - a matching file that is open */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_FILTER_FILES_CC};
+    os_dirent_t          direntry    = {.FileName = "a.dat"};
+    uint32               not_done    = 0;
+
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_MatchPattern), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_IsPathOpen), true);
+
+    /* Act */
+    UtAssert_BOOL_TRUE(
+        FM_ChildFilterCollect(UT_FM_WORKER, FM_UT_OBJID_1, "dir/", &queue_entry, 0, "Cmd Text", &not_done));
+
+    /* Assert */
+    UtAssert_ZERO(UT_FM_WORKER->DeleteListCount);
+    UtAssert_UINT32_EQ(not_done, 1);
+}
+
+void Test_FM_ChildFilterPass_Limits(void)
+{
+    FM_FileFilter_t filter = {.MinAge = 10, .MaxAge = 100, .MinSize = 5, .MaxSize = 50};
+
+    /* Age 50 and size 20 are inside every limit */
+    UtAssert_BOOL_TRUE(FM_ChildFilterPass(&filter, 20, 950, 1000));
+
+    UtAssert_BOOL_FALSE(FM_ChildFilterPass(&filter, 4, 950, 1000));
+    UtAssert_BOOL_FALSE(FM_ChildFilterPass(&filter, 51, 950, 1000));
+    UtAssert_BOOL_FALSE(FM_ChildFilterPass(&filter, 20, 995, 1000));
+    UtAssert_BOOL_FALSE(FM_ChildFilterPass(&filter, 20, 899, 1000));
+
+    /* A file stamped in the future has no age */
+    UtAssert_BOOL_FALSE(FM_ChildFilterPass(&filter, 20, 2000, 1000));
+
+    /* Zero limits are not applied */
+    memset(&filter, 0, sizeof(filter));
+    UtAssert_BOOL_TRUE(FM_ChildFilterPass(&filter, 0xFFFFFFFF, 0, 1000));
+}
+
+void Test_FM_ChildFilterApply_Copy(void)
+{
+    /* Arrange - the second of two copies fails to open its source */
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_FILTER_FILES_CC, .FilterAction = FM_FILTER_ACTION_COPY, .Source1 = "dir", .Target = "tgt"};
+    uint32               not_done    = 0;
+
+    memcpy(UT_FM_WORKER->DeleteList, "file1\0file2", 12);
+    UT_FM_WORKER->DeleteListLength = 12;
+    UT_FM_WORKER->DeleteListCount  = 2;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_GetFilenameState), FM_NAME_IS_NOT_IN_USE);
+    UT_SetDeferredRetcode(UT_KEY(OS_OpenCreate), 3, !OS_SUCCESS);
+
+    /* Act */
+    UtAssert_UINT32_EQ(FM_ChildFilterApply(UT_FM_WORKER, &queue_entry, "dir/", "tgt/", "Cmd Text", &not_done), 1);
+
+    /* Assert */
+    UtAssert_UINT32_EQ(not_done, 1);
+    UtAssert_STUB_COUNT(OS_rename, 0);
+    UtAssert_STRINGBUF_EQ(UT_FM_WORKER->ProgressTarget, sizeof(UT_FM_WORKER->ProgressTarget), "tgt/file2", -1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_FILTER_FILES_OS_ERR_EID);
+}
+
+void Test_FM_ChildFilterApply_OpenedSinceCollect(void)
+{
+    /* Arrange - the first file was opened after the batch was collected */
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_FILTER_FILES_CC, .FilterAction = FM_FILTER_ACTION_MOVE, .Source1 = "dir", .Target = "tgt"};
+    uint32               not_done    = 0;
+
+    memcpy(UT_FM_WORKER->DeleteList, "file1\0file2", 12);
+    UT_FM_WORKER->DeleteListLength = 12;
+    UT_FM_WORKER->DeleteListCount  = 2;
+    UT_FM_WORKER->OpenPaths.Valid  = true;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_GetFilenameState), FM_NAME_IS_NOT_IN_USE);
+    UT_SetDeferredRetcode(UT_KEY(FM_IsPathOpen), 1, true);
+
+    /* Act */
+    UtAssert_UINT32_EQ(FM_ChildFilterApply(UT_FM_WORKER, &queue_entry, "dir/", "tgt/", "Cmd Text", &not_done), 1);
+
+    /* Assert - only the closed file is moved */
+    UtAssert_BOOL_FALSE(UT_FM_WORKER->OpenPaths.Valid);
+    UtAssert_UINT32_EQ(not_done, 1);
+    UtAssert_STUB_COUNT(OS_rename, 1);
+    UtAssert_STRINGBUF_EQ(UT_FM_WORKER->ProgressTarget, sizeof(UT_FM_WORKER->ProgressTarget), "tgt/file2", -1);
+}
+
+void Test_FM_ChildFilterTransfer_MoveAcrossVolumes(void)
+{
+    /* Arrange - the rename fails, so the file is copied and the source removed */
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_FILTER_FILES_CC, .FilterAction = FM_FILTER_ACTION_MOVE, .Overwrite = 1};
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_GetFilenameState), FM_NAME_IS_FILE_CLOSED);
+    UT_SetDefaultReturnValue(UT_KEY(OS_rename), !OS_SUCCESS);
+
+    /* Act */
+    UtAssert_BOOL_TRUE(FM_ChildFilterTransfer(UT_FM_WORKER, &queue_entry, "dir/a", "tgt/a", "Cmd Text"));
+
+    /* Assert */
+    UtAssert_STUB_COUNT(OS_rename, 1);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 2);
+    UtAssert_STUB_COUNT(OS_remove, 1);
+}
+
+void Test_FM_ChildFilterTransfer_SameFile(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_FILTER_FILES_CC, .FilterAction = FM_FILTER_ACTION_COPY, .Overwrite = 1};
+
+    /* Act */
+    UtAssert_BOOL_FALSE(FM_ChildFilterTransfer(UT_FM_WORKER, &queue_entry, "dir/a", "dir/a", "Cmd Text"));
+
+    /* Assert - the file is never opened, so it cannot be truncated */
+    UtAssert_STUB_COUNT(FM_GetFilenameState, 0);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 0);
+}
+
+/* ****************
+ * ChildDirListFileCmd Tests
+ * ***************/
+void Test_FM_ChildDirListFileCmd_OSDirOpenNotSuccess(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_GET_DIR_LIST_FILE_CC};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryOpen), !OS_SUCCESS);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDirListFileCmd(UT_FM_WORKER, &queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_FILE_OSOPENDIR_ERR_EID);
+}
+
+void Test_FM_ChildDirListFileCmd_ChildDirListFileInitFalse(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_GET_DIR_LIST_FILE_CC, .Source1 = "source1", .Target = "target"};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), !OS_SUCCESS);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDirListFileCmd(UT_FM_WORKER, &queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_STUB_COUNT(OS_close, 0);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_FILE_OSCREAT_ERR_EID);
+}
+
+void Test_FM_ChildDirListFileCmd_ChildDirListFileInitTrue(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_GET_DIR_LIST_FILE_CC, .Source1 = "source1", .Target = "target"};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryRead), !OS_SUCCESS);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDirListFileCmd(UT_FM_WORKER, &queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_FILE_CMD_INF_EID);
+}
+
+void Test_FM_ChildDirListFileCmd_Aborted(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_GET_DIR_LIST_FILE_CC, .Source1 = "source1", .Target = "target"};
+
+    /* An abort request for the command in progress */
+    UT_FM_WORKER->CmdSequence   = 1;
+    UT_FM_WORKER->AbortSequence = 1;
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDirListFileCmd(UT_FM_WORKER, &queue_entry));
+
+    /* Assert - the partial output file is removed */
+    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 0);
+    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_STUB_COUNT(OS_remove, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHILD_ABORT_ERR_EID);
+}
+
+/* ****************
+ * ChildDirListPktCmd Tests
+ * ***************/
+void Test_FM_ChildDirListPktCmd_OSDirOpenNotSuccess(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_GET_DIR_LIST_PKT_CC, .Source1 = "source1", .Source2 = "source2"};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryOpen), !OS_SUCCESS);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDirListPktCmd(UT_FM_WORKER, &queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_PKT_OS_ERR_EID);
+}
+
+void Test_FM_ChildDirListPktCmd_OSDirReadNotSuccess(void)
+{
+    FM_DirListPkt_Payload_t *ReportPtr;
+
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_GET_DIR_LIST_PKT_CC, .Source1 = "source1", .Source2 = "source2"};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryRead), !OS_SUCCESS);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDirListPktCmd(UT_FM_WORKER, &queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_PKT_CMD_INF_EID);
+
+    ReportPtr = &UT_FM_WORKER->DirListPkt.Payload;
+    UtAssert_UINT32_EQ(ReportPtr->PacketFiles, 0);
+}
+
+void Test_FM_ChildDirListPktCmd_DirEntryNameThisDirectory(void)
+{
+    FM_DirListPkt_Payload_t *ReportPtr;
+
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_GET_DIR_LIST_PKT_CC, .Source1 = "source1", .Source2 = "source2"};
+    os_dirent_t direntry = {.FileName = FM_THIS_DIRECTORY};
+
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDirListPktCmd(UT_FM_WORKER, &queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_PKT_CMD_INF_EID);
+
+    ReportPtr = &UT_FM_WORKER->DirListPkt.Payload;
+    UtAssert_UINT32_EQ(ReportPtr->PacketFiles, 0);
+}
+
+void Test_FM_ChildDirListPktCmd_DirEntryNameParentDirectory(void)
+{
+    FM_DirListPkt_Payload_t *ReportPtr;
+
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_GET_DIR_LIST_PKT_CC, .Source1 = "source1", .Source2 = "source2"};
+    os_dirent_t direntry = {.FileName = FM_PARENT_DIRECTORY};
+
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDirListPktCmd(UT_FM_WORKER, &queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_PKT_CMD_INF_EID);
+
+    ReportPtr = &UT_FM_WORKER->DirListPkt.Payload;
+    UtAssert_UINT32_EQ(ReportPtr->PacketFiles, 0);
+}
+
+void Test_FM_ChildDirListPktCmd_DirListOffsetNotExceeded(void)
+{
+    FM_DirListPkt_Payload_t *ReportPtr;
+
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_GET_DIR_LIST_PKT_CC, .Source1 = "source1", .Source2 = "source2", .DirListOffset = 1};
+    os_dirent_t direntry = {.FileName = "filename"};
+
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDirListPktCmd(UT_FM_WORKER, &queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_PKT_CMD_INF_EID);
+
+    ReportPtr = &UT_FM_WORKER->DirListPkt.Payload;
+    UtAssert_UINT32_EQ(ReportPtr->FirstFile, 1);
+    UtAssert_UINT32_EQ(ReportPtr->TotalFiles, 1);
+    UtAssert_UINT32_EQ(ReportPtr->PacketFiles, 0);
+}
+
+void Test_FM_ChildDirListPktCmd_Aborted(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_GET_DIR_LIST_PKT_CC, .Source1 = "source1", .Source2 = "source2"};
+
+    /* An abort request for the command in progress */
+    UT_FM_WORKER->CmdSequence   = 1;
+    UT_FM_WORKER->AbortSequence = 1;
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDirListPktCmd(UT_FM_WORKER, &queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 0);
+    UtAssert_STUB_COUNT(OS_DirectoryClose, 1);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHILD_ABORT_ERR_EID);
+}
+
+void Test_FM_ChildDirListPktCmd_DirListOffsetExceeded(void)
+{
+    FM_DirListPkt_Payload_t *ReportPtr;
+
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_GET_DIR_LIST_PKT_CC, .Source1 = "source1", .Source2 = "source2"};
+    os_dirent_t direntry[FM_DIR_LIST_PKT_ENTRIES + 1];
+
+    /* Unit under test doesn't really care if the entry name is empty */
+    memset(direntry, 0, sizeof(direntry));
+
+    /* Will fill the entire packet and have one more */
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), sizeof(direntry) / sizeof(direntry[0]) + 1, !OS_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDirListPktCmd(UT_FM_WORKER, &queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryRead, sizeof(direntry) / sizeof(direntry[0]) + 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_PKT_CMD_INF_EID);
+
+    ReportPtr = &UT_FM_WORKER->DirListPkt.Payload;
+    UtAssert_UINT32_EQ(ReportPtr->FirstFile, 0);
+    UtAssert_UINT32_EQ(ReportPtr->TotalFiles, sizeof(direntry) / sizeof(direntry[0]));
+    UtAssert_UINT32_EQ(ReportPtr->PacketFiles, FM_DIR_LIST_PKT_ENTRIES);
+}
+
+void Test_FM_ChildDirListPktCmd_PathAndEntryLengthGreaterMaxPathLength(void)
+{
+    FM_DirListPkt_Payload_t *ReportPtr;
+
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DELETE_ALL_FILES_CC,
+                                        .Source1     = "source1",
+                                        .Source2 = "source2_has_quite_a_long_name_to_make_path_length_longer_than_64"};
+    os_dirent_t          direntry    = {.FileName = "direntry_long"};
+
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildDirListPktCmd(UT_FM_WORKER, &queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 1, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_PKT_WARNING_EID);
+
+    ReportPtr = &UT_FM_WORKER->DirListPkt.Payload;
+    UtAssert_UINT32_EQ(ReportPtr->FirstFile, 0);
+    UtAssert_UINT32_EQ(ReportPtr->TotalFiles, 1);
+    UtAssert_UINT32_EQ(ReportPtr->PacketFiles, 0);
+}
+
+/* ****************
+ * ChildSetPermissionsCmd Tests
+ * ***************/
+void Test_FM_ChildSetPermissionsCmd_OSChmodSuccess(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_SET_PERMISSIONS_CC};
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildSetPermissionsCmd(UT_FM_WORKER, &queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_chmod, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_SET_PERM_CMD_INF_EID);
+}
+
+void Test_FM_ChildSetPermissionsCmd_OSChmodNotSuccess(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_SET_PERMISSIONS_CC};
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_chmod), !OS_SUCCESS);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildSetPermissionsCmd(UT_FM_WORKER, &queue_entry));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
+
+    UtAssert_STUB_COUNT(OS_chmod, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_SET_PERM_OS_ERR_EID);
+}
+
+/* ****************
+ * ChildDirListFileInit Tests
+ * ***************/
+void Test_FM_ChildDirListFileInit_OSOpenCreateFail(void)
+{
+    /* Arrange */
+    osal_id_t   fileid;
+    const char *directory = "directory";
+    const char *filename  = "filename";
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), !OS_SUCCESS);
+
+    /* Act */
+    UtAssert_BOOL_FALSE(FM_ChildDirListFileInit(UT_FM_WORKER, &fileid, directory, filename));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(0, 1, 0, 0);
+
+    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
+    UtAssert_STUB_COUNT(OS_close, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_FILE_OSCREAT_ERR_EID);
+    UtAssert_INT32_EQ(UT_FM_WORKER->CmdErrCounter, 1);
+}
+
+void Test_FM_ChildDirListFileInit_FSWriteHeaderNotSameSizeFSHeadert(void)
+{
+    /* Arrange */
+    osal_id_t   fileid;
+    osal_id_t   LocalFileHandle = FM_UT_OBJID_1;
+    const char *directory       = "directory";
+    const char *filename        = "filename";
+
+    UT_SetDataBuffer(UT_KEY(OS_OpenCreate), &LocalFileHandle, sizeof(osal_id_t), false);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_FS_WriteHeader), sizeof(CFE_FS_Header_t) - 1);
+
+    /* Act */
+    UtAssert_BOOL_FALSE(FM_ChildDirListFileInit(UT_FM_WORKER, &fileid, directory, filename));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(0, 1, 0, 0);
+
+    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
+    UtAssert_STUB_COUNT(CFE_FS_WriteHeader, 1);
+    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_FILE_WRHDR_ERR_EID);
+}
+
+void Test_FM_ChildDirListFileInit_OSWriteNotSameSizeDirListFileStatst(void)
+{
+    /* Arrange */
+    osal_id_t   fileid;
+    const char *directory       = "directory";
+    const char *filename        = "filename";
+    osal_id_t   LocalFileHandle = FM_UT_OBJID_1;
+
+    UT_SetDataBuffer(UT_KEY(OS_OpenCreate), &LocalFileHandle, sizeof(osal_id_t), false);
+    UT_SetDefaultReturnValue(UT_KEY(OS_write), sizeof(FM_DirListFileStats_t) - 1);
+
+    /* Act */
+    UtAssert_BOOL_FALSE(FM_ChildDirListFileInit(UT_FM_WORKER, &fileid, directory, filename));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(0, 1, 0, 0);
+
+    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
+    UtAssert_STUB_COUNT(CFE_FS_WriteHeader, 1);
+    UtAssert_STUB_COUNT(OS_write, 1);
+    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_FILE_WRBLANK_ERR_EID);
+}
+
+void Test_FM_ChildDirListFileInit_OSWriteSameSizeDirListFileStatst(void)
+{
+    /* Arrange */
+    osal_id_t   fileid;
+    const char *directory = "directory";
+    const char *filename  = "filename";
+
+    /* Act */
+    UtAssert_BOOL_TRUE(FM_ChildDirListFileInit(UT_FM_WORKER, &fileid, directory, filename));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(0, 0, 0, 0);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
+    UtAssert_STUB_COUNT(CFE_FS_WriteHeader, 1);
+    UtAssert_STUB_COUNT(OS_write, 1);
+    UtAssert_STUB_COUNT(OS_close, 0);
+}
+
+/* ****************
+ * ChildDirListFileLoop Tests
+ * ***************/
+void Test_FM_ChildDirListFileLoop_OSDirReadNotSuccess(void)
+{
+    /* Arrange */
+    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryRead), !OS_SUCCESS);
+
+    /* Act */
+    UtAssert_VOIDCALL(
+        FM_ChildDirListFileLoop(UT_FM_WORKER, FM_UT_OBJID_1, FM_UT_OBJID_2, "dir", "dir/", "fname", false));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 0, 0);
+
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 1);
+    UtAssert_STUB_COUNT(OS_write, 0);
+    UtAssert_STUB_COUNT(OS_lseek, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_FILE_CMD_INF_EID);
+
+    UtAssert_UINT32_EQ(UT_FM_WORKER->DirListFileStats.DirEntries, 0);
+    UtAssert_UINT32_EQ(UT_FM_WORKER->DirListFileStats.FileEntries, 0);
+}
+
+void Test_FM_ChildDirListFileLoop_Aborted(void)
+{
+    /* Arrange */
+    UT_FM_WORKER->CmdSequence   = 1;
+    UT_FM_WORKER->AbortSequence = 1;
+
+    /* Act */
+    UtAssert_VOIDCALL(
+        FM_ChildDirListFileLoop(UT_FM_WORKER, FM_UT_OBJID_1, FM_UT_OBJID_2, "dir", "dir/", "fname", false));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(0, 1, 0, 0);
+
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 0);
+    UtAssert_STUB_COUNT(OS_write, 0);
+    UtAssert_STUB_COUNT(OS_lseek, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHILD_ABORT_ERR_EID);
+}
+
+void Test_FM_ChildDirListFileLoop_OSDirEntryNameIsThisDirectory(void)
+{
+    /* Arrange */
+    os_dirent_t direntry = {.FileName = FM_THIS_DIRECTORY};
+
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+
+    /* Act */
+    UtAssert_VOIDCALL(
+        FM_ChildDirListFileLoop(UT_FM_WORKER, FM_UT_OBJID_1, FM_UT_OBJID_2, "dir", "dir/", "fname", false));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 0, 0);
+
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
+    UtAssert_STUB_COUNT(OS_write, 0);
+    UtAssert_STUB_COUNT(OS_lseek, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_FILE_CMD_INF_EID);
+
+    UtAssert_UINT32_EQ(UT_FM_WORKER->DirListFileStats.DirEntries, 0);
+    UtAssert_UINT32_EQ(UT_FM_WORKER->DirListFileStats.FileEntries, 0);
+}
+
+void Test_FM_ChildDirListFileLoop_OSDirEntryNameIsParentDirectory(void)
+{
+    /* Arrange */
+    os_dirent_t direntry = {.FileName = FM_PARENT_DIRECTORY};
+
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+
+    /* Act */
+    UtAssert_VOIDCALL(
+        FM_ChildDirListFileLoop(UT_FM_WORKER, FM_UT_OBJID_1, FM_UT_OBJID_2, "dir", "dir/", "fname", false));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 0, 0);
+
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
+    UtAssert_STUB_COUNT(OS_write, 0);
+    UtAssert_STUB_COUNT(OS_lseek, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_FILE_CMD_INF_EID);
+}
+
+void Test_FM_ChildDirListFileLoop_PathLengthAndEntryLengthGreaterMaxPathLen(void)
+{
+    /* Arrange */
+    char        dirwithsep[OS_MAX_PATH_LEN];
+    os_dirent_t direntry = {.FileName = "directory_nam"};
+
+    memset(dirwithsep, 0xFF, sizeof(dirwithsep));
+    dirwithsep[sizeof(dirwithsep) - 1] = '\0';
+
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+
+    /* Act */
+    UtAssert_VOIDCALL(
+        FM_ChildDirListFileLoop(UT_FM_WORKER, FM_UT_OBJID_1, FM_UT_OBJID_2, "dir", dirwithsep, "fname", false));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 1, 0);
+
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
+    UtAssert_STUB_COUNT(OS_write, 1);
+    UtAssert_STUB_COUNT(OS_lseek, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_FILE_WARNING_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_GET_DIR_FILE_CMD_INF_EID);
+
+    UtAssert_INT32_EQ(UT_FM_WORKER->DirListFileStats.DirEntries, 1);
+    UtAssert_INT32_EQ(UT_FM_WORKER->DirListFileStats.FileEntries, 0);
+}
+
+void Test_FM_ChildDirListFileLoop_FileEntriesGreaterFMDirListFileEntries(void)
+{
+    os_dirent_t direntry = {.FileName = "directory_nam"};
+    uint32      entrycnt = FM_DIR_LIST_FILE_ENTRIES + 1;
+
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), entrycnt + 1, !OS_SUCCESS);
+
+    /* Act */
+    UtAssert_VOIDCALL(
+        FM_ChildDirListFileLoop(UT_FM_WORKER, FM_UT_OBJID_1, FM_UT_OBJID_2, "dir", "dir/", "fname", false));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(1, 0, 0, 0);
+
+    UtAssert_STUB_COUNT(OS_DirectoryRead, entrycnt + 1);
+    UtAssert_STUB_COUNT(OS_write, FM_DIR_LIST_FILE_ENTRIES + 1);
+    UtAssert_STUB_COUNT(OS_lseek, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_FILE_CMD_INF_EID);
+
+    UtAssert_INT32_EQ(UT_FM_WORKER->DirListFileStats.DirEntries, entrycnt);
+    UtAssert_INT32_EQ(UT_FM_WORKER->DirListFileStats.FileEntries, FM_DIR_LIST_FILE_ENTRIES);
+}
+
+void Test_FM_ChildDirListFileLoop_BytesWrittenNotEqualWriteLength(void)
+{
+    /* Arrange */
+    os_dirent_t direntry = {.FileName = "directory_nam"};
+
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDefaultReturnValue(UT_KEY(OS_write), sizeof(FM_DirListEntry_t));
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+
+    /* Act */
+    UtAssert_VOIDCALL(
+        FM_ChildDirListFileLoop(UT_FM_WORKER, FM_UT_OBJID_1, FM_UT_OBJID_2, "dir", "dir/", "fname", false));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(0, 1, 0, 0);
+
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
+    UtAssert_STUB_COUNT(OS_write, 2);
+    UtAssert_STUB_COUNT(OS_lseek, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_FILE_UPSTATS_ERR_EID);
+
+    UtAssert_INT32_EQ(UT_FM_WORKER->DirListFileStats.DirEntries, 1);
+    UtAssert_INT32_EQ(UT_FM_WORKER->DirListFileStats.FileEntries, 1);
+}
+
+void Test_FM_ChildDirListFileLoop_BytesWrittenNotEqualWriteLengthInLoop(void)
+{
+    /* Arrange */
+    os_dirent_t direntry = {.FileName = "directory_nam"};
+
+    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+    UT_SetDefaultReturnValue(UT_KEY(OS_write), sizeof(FM_DirListEntry_t) - 1);
+
+    /* Act */
+    UtAssert_VOIDCALL(
+        FM_ChildDirListFileLoop(UT_FM_WORKER, FM_UT_OBJID_1, FM_UT_OBJID_2, "dir", "dir/", "fname", false));
+
+    /* Assert */
+    UT_FM_Child_Cmd_Assert(0, 1, 0, 0);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 1);
+    UtAssert_STUB_COUNT(OS_write, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_FILE_WRENTRY_ERR_EID);
+
+    UtAssert_INT32_EQ(UT_FM_WORKER->DirListFileStats.DirEntries, 0);
+    UtAssert_INT32_EQ(UT_FM_WORKER->DirListFileStats.FileEntries, 0);
+}
+
+/* ****************
+ * ChildCopyFile Tests
+ * ***************/
+void Test_FM_ChildCopyFile_OpenSourceNotSuccess(void)
+{
+    /* Arrange */
+    UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), !OS_SUCCESS);
+
+    /* Act */
+    UtAssert_BOOL_FALSE(FM_ChildCopyFile(UT_FM_WORKER, "source", "target", FM_COPY_OS_ERR_EID, "Copy File"));
+
+    /* Assert */
+    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
+    UtAssert_STUB_COUNT(OS_read, 0);
+    UtAssert_STUB_COUNT(OS_close, 0);
+    UtAssert_STUB_COUNT(OS_remove, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_COPY_OS_ERR_EID);
+}
+
+void Test_FM_ChildCopyFile_OpenTargetNotSuccess(void)
+{
+    /* Arrange */
+    UT_SetDeferredRetcode(UT_KEY(OS_OpenCreate), 2, !OS_SUCCESS);
+
+    /* Act */
+    UtAssert_BOOL_FALSE(FM_ChildCopyFile(UT_FM_WORKER, "source", "target", FM_COPY_OS_ERR_EID, "Copy File"));
+
+    /* Assert */
+    UtAssert_STUB_COUNT(OS_OpenCreate, 2);
+    UtAssert_STUB_COUNT(OS_read, 0);
+    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_STUB_COUNT(OS_remove, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_COPY_OS_ERR_EID);
+}
+
+void Test_FM_ChildCopyFile_ReadNotSuccess(void)
+{
+    /* Arrange */
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), -1);
+
+    /* Act */
+    UtAssert_BOOL_FALSE(FM_ChildCopyFile(UT_FM_WORKER, "source", "target", FM_COPY_OS_ERR_EID, "Copy File"));
+
+    /* Assert */
+    UtAssert_STUB_COUNT(OS_read, 1);
+    UtAssert_STUB_COUNT(OS_write, 0);
+    UtAssert_STUB_COUNT(OS_close, 2);
+    UtAssert_STUB_COUNT(OS_remove, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_COPY_OS_ERR_EID);
+}
+
+void Test_FM_ChildCopyFile_WriteNotSuccess(void)
+{
+    /* Arrange */
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), 10);
+    UT_SetDefaultReturnValue(UT_KEY(OS_write), 9);
+
+    /* Act */
+    UtAssert_BOOL_FALSE(FM_ChildCopyFile(UT_FM_WORKER, "source", "target", FM_COPY_OS_ERR_EID, "Copy File"));
+
+    /* Assert */
+    UtAssert_STUB_COUNT(OS_read, 1);
+    UtAssert_STUB_COUNT(OS_write, 1);
+    UtAssert_STUB_COUNT(OS_close, 2);
+    UtAssert_STUB_COUNT(OS_remove, 1);
+    UtAssert_UINT32_EQ(UT_FM_WORKER->CopyBytes, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_COPY_OS_ERR_EID);
+}
+
+void Test_FM_ChildCopyFile_LargeBlocks(void)
+{
+    /* Arrange - two full copy buffers then end of file */
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), FM_CHILD_COPY_BUFFER_SIZE);
+    UT_SetDefaultReturnValue(UT_KEY(OS_write), FM_CHILD_COPY_BUFFER_SIZE);
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 3, 0);
+
+    FM_GlobalData.ChildCopyBlockSize = FM_CHILD_COPY_BUFFER_SIZE;
+
+    /* Act */
+    UtAssert_BOOL_TRUE(FM_ChildCopyFile(UT_FM_WORKER, "source", "target", FM_COPY_OS_ERR_EID, "Copy File"));
+
+    /* Assert */
+    UtAssert_STUB_COUNT(OS_read, 3);
+    UtAssert_STUB_COUNT(OS_write, 2);
+    UtAssert_STUB_COUNT(OS_close, 2);
+    UtAssert_STUB_COUNT(OS_remove, 0);
+    UtAssert_UINT32_EQ(UT_FM_WORKER->CopyBytes, 2 * FM_CHILD_COPY_BUFFER_SIZE);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_FM_ChildCopyFile_ThrottleEachBlock(void)
+{
+    /* Arrange - every block is more than the byte bucket holds */
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), FM_CHILD_FILE_BLOCK_SIZE);
+    UT_SetDefaultReturnValue(UT_KEY(OS_write), FM_CHILD_FILE_BLOCK_SIZE);
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 3, 0);
+
+    FM_GlobalData.ChildCopyBlockSize                                = FM_CHILD_FILE_BLOCK_SIZE;
+    FM_GlobalData.ChildThrottle[FM_CHILD_THROTTLE_DEFAULT].ByteRate = FM_CHILD_FILE_BLOCK_SIZE;
+
+    /* Act */
+    UtAssert_BOOL_TRUE(FM_ChildCopyFile(UT_FM_WORKER, "source", "target", FM_COPY_OS_ERR_EID, "Copy File"));
+
+    /* Assert */
+    UtAssert_STUB_COUNT(OS_read, 3);
+    UtAssert_STUB_COUNT(OS_TaskDelay, 2);
+    UtAssert_UINT32_EQ(UT_FM_WORKER->CopyBytes, 2 * FM_CHILD_FILE_BLOCK_SIZE);
+}
+
+void Test_FM_ChildCopyFile_Unthrottled(void)
+{
+    /* Arrange - no byte rate limit */
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), FM_CHILD_FILE_BLOCK_SIZE);
+    UT_SetDefaultReturnValue(UT_KEY(OS_write), FM_CHILD_FILE_BLOCK_SIZE);
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 3, 0);
+
+    FM_GlobalData.ChildCopyBlockSize = FM_CHILD_FILE_BLOCK_SIZE;
+
+    /* Act */
+    UtAssert_BOOL_TRUE(FM_ChildCopyFile(UT_FM_WORKER, "source", "target", FM_COPY_OS_ERR_EID, "Copy File"));
+
+    /* Assert */
+    UtAssert_STUB_COUNT(OS_read, 3);
+    UtAssert_STUB_COUNT(OS_TaskDelay, 0);
+    UtAssert_UINT32_EQ(UT_FM_WORKER->CopyBytes, 2 * FM_CHILD_FILE_BLOCK_SIZE);
+}
+
+void Test_FM_ChildCopyFile_KernelCopySuccess(void)
+{
+    /* Arrange */
+    UT_SetDefaultReturnValue(UT_KEY(FM_KernelCopy_Open), CFE_SUCCESS);
+    UT_SetDefaultReturnValue(UT_KEY(FM_KernelCopy_Chunk), 0);
+
+    /* Act */
+    UtAssert_BOOL_TRUE(FM_ChildCopyFile(UT_FM_WORKER, "source", "target", FM_COPY_OS_ERR_EID, "Copy File"));
+
+    /* Assert */
+    UtAssert_STUB_COUNT(OS_OpenCreate, 0);
+    UtAssert_STUB_COUNT(OS_read, 0);
+    UtAssert_STUB_COUNT(OS_remove, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_FM_ChildCopyFile_KernelCopyNotSuccess(void)
+{
+    /* Arrange */
+    UT_SetDefaultReturnValue(UT_KEY(FM_KernelCopy_Open), CFE_SUCCESS);
+    UT_SetDefaultReturnValue(UT_KEY(FM_KernelCopy_Chunk), OS_ERROR);
+
+    /* Act */
+    UtAssert_BOOL_FALSE(FM_ChildCopyFile(UT_FM_WORKER, "source", "target", FM_COPY_OS_ERR_EID, "Copy File"));
+
+    /* Assert */
+    UtAssert_STUB_COUNT(OS_OpenCreate, 0);
+    UtAssert_STUB_COUNT(OS_remove, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_COPY_OS_ERR_EID);
+}
+
+/* ****************
+ * ChildKernelCopy Tests
+ * ***************/
+void Test_FM_ChildKernelCopy_NotImplemented(void)
+{
+    /* Act */
+    UtAssert_INT32_EQ(FM_ChildKernelCopy(UT_FM_WORKER, "source", "target", false, FM_COPY_OS_ERR_EID, "Copy File"),
+                      CFE_STATUS_NOT_IMPLEMENTED);
+
+    /* Assert */
+    UtAssert_STUB_COUNT(FM_KernelCopy_Chunk, 0);
+    UtAssert_STUB_COUNT(FM_KernelCopy_Close, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UtAssert_BOOL_FALSE(UT_FM_WORKER->KernelCopyOpen);
+    UtAssert_STUB_COUNT(OS_MutSemTake, 2);
+    UtAssert_STUB_COUNT(OS_MutSemGive, 2);
+}
+
+void Test_FM_ChildKernelCopy_ThrottleEachChunk(void)
+{
+    /* Arrange - two chunks over the byte rate, then end of file */
+    UT_SetDefaultReturnValue(UT_KEY(FM_KernelCopy_Open), CFE_SUCCESS);
+    UT_SetDefaultReturnValue(UT_KEY(FM_KernelCopy_Chunk), FM_CHILD_FILE_BLOCK_SIZE);
+    UT_SetDeferredRetcode(UT_KEY(FM_KernelCopy_Chunk), 3, 0);
+
+    FM_GlobalData.ChildCopyBlockSize                                = FM_CHILD_FILE_BLOCK_SIZE;
+    FM_GlobalData.ChildThrottle[FM_CHILD_THROTTLE_DEFAULT].ByteRate = FM_CHILD_FILE_BLOCK_SIZE;
+
+    /* Act */
+    UtAssert_INT32_EQ(FM_ChildKernelCopy(UT_FM_WORKER, "source", "target", true, FM_COPY_OS_ERR_EID, "Copy File"),
+                      CFE_SUCCESS);
+
+    /* Assert */
+    UtAssert_STUB_COUNT(FM_KernelCopy_Chunk, 3);
+    UtAssert_STUB_COUNT(OS_TaskDelay, 2);
+    UtAssert_STUB_COUNT(FM_KernelCopy_Close, 1);
+    UtAssert_UINT32_EQ(UT_FM_WORKER->CopyBytes, 2 * FM_CHILD_FILE_BLOCK_SIZE);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+
+    /* The open file checks saw both files while the copy ran */
+    UtAssert_STRINGBUF_EQ(UT_FM_WORKER->KernelCopyPaths.Path[0], OS_MAX_PATH_LEN, "source", -1);
+    UtAssert_STRINGBUF_EQ(UT_FM_WORKER->KernelCopyPaths.Path[2], OS_MAX_PATH_LEN, "target", -1);
+    UtAssert_BOOL_FALSE(UT_FM_WORKER->KernelCopyOpen);
+}
+
+void Test_FM_ChildKernelCopy_ChunkNotImplemented(void)
+{
+    /* Arrange */
+    UT_SetDefaultReturnValue(UT_KEY(FM_KernelCopy_Open), CFE_SUCCESS);
+
+    /* Act */
+    UtAssert_INT32_EQ(FM_ChildKernelCopy(UT_FM_WORKER, "source", "target", false, FM_COPY_OS_ERR_EID, "Copy File"),
+                      CFE_STATUS_NOT_IMPLEMENTED);
+
+    /* Assert */
+    UtAssert_STUB_COUNT(FM_KernelCopy_Close, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_FM_ChildKernelCopy_ChunkNotSuccess(void)
+{
+    /* Arrange */
+    UT_SetDefaultReturnValue(UT_KEY(FM_KernelCopy_Open), CFE_SUCCESS);
+    UT_SetDefaultReturnValue(UT_KEY(FM_KernelCopy_Chunk), OS_ERROR);
+
+    /* Act */
+    UtAssert_INT32_EQ(FM_ChildKernelCopy(UT_FM_WORKER, "source", "target", false, FM_COPY_OS_ERR_EID, "Copy File"),
+                      OS_ERROR);
+
+    /* Assert */
+    UtAssert_STUB_COUNT(FM_KernelCopy_Close, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_COPY_OS_ERR_EID);
+}
+
+void Test_FM_ChildKernelCopy_Aborted(void)
+{
+    /* Arrange */
+    UT_SetDefaultReturnValue(UT_KEY(FM_KernelCopy_Open), CFE_SUCCESS);
+
+    UT_FM_WORKER->CmdSequence   = 1;
+    UT_FM_WORKER->AbortSequence = 1;
+
+    /* Act */
+    UtAssert_INT32_EQ(FM_ChildKernelCopy(UT_FM_WORKER, "source", "target", false, FM_COPY_OS_ERR_EID, "Copy File"),
+                      OS_ERROR);
+
+    /* Assert - only the abort is reported */
+    UtAssert_STUB_COUNT(FM_KernelCopy_Chunk, 0);
+    UtAssert_STUB_COUNT(FM_KernelCopy_Close, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHILD_ABORT_ERR_EID);
+}
+
+/* ****************
+ * ChildCopyStream Tests
+ * ***************/
+void Test_FM_ChildCopyStream_Pipelined(void)
+{
+    /* Arrange - two buffers go to the writer task, then end of file */
+    UT_FM_WORKER->WriterRunning = true;
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), FM_CHILD_FILE_BLOCK_SIZE);
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 3, 0);
+
+    /* Act */
+    UtAssert_BOOL_TRUE(FM_ChildCopyStream(UT_FM_WORKER, FM_UT_OBJID_1, FM_UT_OBJID_2, "source", "target",
+                                          FM_COPY_OS_ERR_EID, FM_COPY_OS_ERR_EID, "Copy File"));
+
+    /* Assert - the child task itself writes nothing and waits for every buffer to drain */
+    UtAssert_STUB_COUNT(OS_read, 3);
+    UtAssert_STUB_COUNT(OS_write, 0);
+    UtAssert_STUB_COUNT(OS_CountSemTake, 3 + (FM_CHILD_COPY_BUFFER_COUNT - 1));
+    UtAssert_STUB_COUNT(OS_CountSemGive, 2 + FM_CHILD_COPY_BUFFER_COUNT);
+    UtAssert_INT32_EQ(UT_FM_WORKER->CopyLength[0], FM_CHILD_FILE_BLOCK_SIZE);
+    UtAssert_INT32_EQ(UT_FM_WORKER->CopyFillSlot, 2 % FM_CHILD_COPY_BUFFER_COUNT);
+    UtAssert_BOOL_TRUE(OS_ObjectIdEqual(UT_FM_WORKER->CopyTarget, FM_UT_OBJID_2));
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_FM_ChildCopyStream_PipelinedSemTakeNotSuccess(void)
+{
+    /* Arrange */
+    UT_FM_WORKER->WriterRunning = true;
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_CountSemTake), !CFE_SUCCESS);
+
+    /* Act */
+    UtAssert_BOOL_FALSE(FM_ChildCopyStream(UT_FM_WORKER, FM_UT_OBJID_1, FM_UT_OBJID_2, "source", "target",
+                                           FM_CONCAT_OSRD_ERR_EID, FM_CONCAT_OSWR_ERR_EID, "Concat Files"));
+
+    /* Assert */
+    UtAssert_STUB_COUNT(OS_read, 0);
+    UtAssert_STUB_COUNT(OS_CountSemGive, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CONCAT_OSRD_ERR_EID);
+}
+
+void Test_FM_ChildCopyStream_WriteEventID(void)
+{
+    /* Arrange */
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), 10);
+    UT_SetDefaultReturnValue(UT_KEY(OS_write), -1);
+
+    /* Act */
+    UtAssert_BOOL_FALSE(FM_ChildCopyStream(UT_FM_WORKER, FM_UT_OBJID_1, FM_UT_OBJID_2, "source", "target",
+                                           FM_CONCAT_OSRD_ERR_EID, FM_CONCAT_OSWR_ERR_EID, "Concat Files"));
+
+    /* Assert */
+    UtAssert_STUB_COUNT(OS_read, 1);
+    UtAssert_STUB_COUNT(OS_write, 1);
+    UtAssert_STUB_COUNT(OS_CountSemTake, 0);
+    UtAssert_INT32_EQ(UT_FM_WORKER->CopyWriteResult, -1);
+    UtAssert_INT32_EQ(UT_FM_WORKER->CopyWriteExpected, 10);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CONCAT_OSWR_ERR_EID);
+}
+
+void Test_FM_ChildCopyStream_Aborted(void)
+{
+    /* Arrange */
+    UT_FM_WORKER->CmdSequence   = 1;
+    UT_FM_WORKER->AbortSequence = 1;
+
+    /* Act */
+    UtAssert_BOOL_FALSE(FM_ChildCopyStream(UT_FM_WORKER, FM_UT_OBJID_1, FM_UT_OBJID_2, "source", "target",
+                                           FM_COPY_OS_ERR_EID, FM_COPY_OS_ERR_EID, "Copy File"));
+
+    /* Assert */
+    UtAssert_STUB_COUNT(OS_read, 0);
+    UtAssert_STUB_COUNT(OS_write, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHILD_ABORT_ERR_EID);
+}
+
+void Test_FM_ChildCopyWrite_SkipAfterFailedWrite(void)
+{
+    /* Arrange */
+    UT_FM_WORKER->CopyLength[0]   = 10;
+    UT_FM_WORKER->CopyWriteFailed = true;
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildCopyWrite(UT_FM_WORKER, 0));
+
+    /* Assert */
+    UtAssert_STUB_COUNT(OS_write, 0);
+    UtAssert_UINT32_EQ(UT_FM_WORKER->CopyBytes, 0);
+}
+
+/* ****************
+ * ChildSizeTimeMode Tests
+ * ***************/
+void Test_FM_ChildSizeTimeMode_OsStatNoSuccess(void)
+{
+    /* Arrange */
+    uint32 filesize = 1;
+    uint32 filetime = 1;
+    uint32 filemode = 1;
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_stat), !OS_SUCCESS);
+
+    /* Act */
+    UtAssert_INT32_EQ(FM_ChildSizeTimeMode("fname", &filesize, &filetime, &filemode), !OS_SUCCESS);
+
+    /* Assert */
+    UtAssert_STUB_COUNT(OS_stat, 1);
+    UtAssert_UINT32_EQ(filesize, 0);
+    UtAssert_UINT32_EQ(filetime, 0);
+    UtAssert_UINT32_EQ(filemode, 0);
+}
+
+void Test_FM_ChildSizeTimeMode_OSFilestateTimeDefined(void)
+{
+    /* Arrange */
+    uint32 filesize = 0;
+    uint32 filetime = 0;
+    uint32 filemode = 0;
+
+    OS_time_t  ostime     = {.ticks = 1};
+    os_fstat_t filestatus = {.FileModeBits = 2, .FileTime = ostime, .FileSize = 3};
+
+    UT_SetDataBuffer(UT_KEY(OS_stat), &filestatus, sizeof(filestatus), false);
+
+    /* Act */
+    UtAssert_INT32_EQ(FM_ChildSizeTimeMode("fname", &filesize, &filetime, &filemode), OS_SUCCESS);
+
+    /* Assert */
+    UtAssert_STUB_COUNT(OS_stat, 1);
+    UtAssert_UINT32_EQ(filetime, OS_FILESTAT_TIME(filestatus));
+    UtAssert_UINT32_EQ(filesize, OS_FILESTAT_SIZE(filestatus));
+    UtAssert_UINT32_EQ(filemode, OS_FILESTAT_MODE(filestatus));
+}
+
+/* ****************
+ * ChildLoop Tests
+ * ***************/
+void Test_FM_ChildLoop_CountSemTakeNotSuccess(void)
+{
+    /* Arrange */
+    UT_SetDefaultReturnValue(UT_KEY(OS_CountSemTake), !CFE_SUCCESS);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildLoop(UT_FM_WORKER));
+
+    /* Assert */
+    UtAssert_STUB_COUNT(OS_CountSemTake, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHILD_TERM_SEM_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(UT_FM_WORKER->CmdErrCounter, 0);
+}
+
+void Test_FM_ChildLoop_ChildQCountEqualZero(void)
+{
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildLoop(UT_FM_WORKER));
+
+    /* Assert */
+    UtAssert_STUB_COUNT(OS_CountSemTake, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHILD_TERM_EMPTYQ_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(UT_FM_WORKER->CmdErrCounter, 1);
+}
+
+void Test_FM_ChildLoop_ChildReadIndexEqualChildQDepth(void)
+{
+    /* Arrange */
+    FM_GlobalData.ChildLane[FM_CHILD_LANE_BULK].WriteIndex = 1;
+    FM_GlobalData.ChildLane[FM_CHILD_LANE_BULK].ReadIndex  = FM_CHILD_LANE_INDEX_WRAP;
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildLoop(UT_FM_WORKER));
+
+    /* Assert */
+    UtAssert_STUB_COUNT(OS_CountSemTake, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHILD_TERM_QIDX_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(UT_FM_WORKER->CmdErrCounter, 1);
+}
+
+void Test_FM_ChildLoop_CountSemTakeSuccessDefault(void)
+{
+    /* Arrange */
+    FM_ChildQueueSlot_t queue_slot = {.CommandCode = -1};
+
+    FM_GlobalData.ChildLane[FM_CHILD_LANE_BULK].WriteIndex = 1;
+
+    UT_FM_QUEUE[0] = queue_slot;
+    UT_SetDeferredRetcode(UT_KEY(OS_CountSemTake), 2, !CFE_SUCCESS);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildLoop(UT_FM_WORKER));
+
+    /* Assert */
+    UtAssert_STUB_COUNT(OS_CountSemTake, 2);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHILD_EXE_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_CHILD_TERM_SEM_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(UT_FM_WORKER->CmdErrCounter, 1);
+}
+
+/* ****************
+ * ChildSleepStat Tests
+ * ***************/
+
+void Test_FM_ChildSleepStat_getSizeTimeModeFalse(void)
+{
+    /* Arrange */
+    FM_DirListEntry_t DirListData = {.EntrySize = 1, .ModifyTime = 1, .Mode = 1};
+
+    /* Assert */
+    UtAssert_VOIDCALL(FM_ChildSleepStat("fname", &DirListData, false));
+    UtAssert_INT32_EQ(DirListData.EntrySize, 0);
+    UtAssert_INT32_EQ(DirListData.ModifyTime, 0);
+    UtAssert_INT32_EQ(DirListData.Mode, 0);
+    UtAssert_STUB_COUNT(OS_stat, 0);
+}
+
+void Test_FM_ChildSleepStat_Unthrottled(void)
+{
+    /* Arrange */
+    FM_DirListEntry_t DirListData = {.EntrySize = 1, .ModifyTime = 1, .Mode = 1};
+
+    /* Assert */
+    UtAssert_VOIDCALL(FM_ChildSleepStat("fname", &DirListData, true));
+    UtAssert_STUB_COUNT(OS_stat, 1);
+    UtAssert_STUB_COUNT(OS_TaskDelay, 0);
+}
+
+void Test_FM_ChildSleepStat_OverStatRate(void)
+{
+    /* Arrange - one OS_stat per second fills the stat bucket to less than one call */
+    FM_DirListEntry_t DirListData = {.EntrySize = 1, .ModifyTime = 1, .Mode = 1};
+
+    FM_GlobalData.ChildThrottle[FM_CHILD_THROTTLE_DEFAULT].StatRate = 1;
+
+    /* Assert */
+    UtAssert_VOIDCALL(FM_ChildSleepStat("fname", &DirListData, true));
+    UtAssert_STUB_COUNT(OS_stat, 1);
+    UtAssert_STUB_COUNT(OS_TaskDelay, 1);
+}
+
+/* ****************
+ * ChildThrottle Tests
+ * ***************/
+void Test_FM_ChildThrottle_Unlimited(void)
+{
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildThrottle("/ram/source", "/cf/target", FM_CHILD_FILE_BLOCK_SIZE, 1));
+
+    /* Assert */
+    UtAssert_STUB_COUNT(OS_MutSemTake, 1);
+    UtAssert_STUB_COUNT(OS_MutSemGive, 1);
+    UtAssert_STUB_COUNT(OS_TaskDelay, 0);
+}
+
+void Test_FM_ChildThrottle_ChargeBothVolumes(void)
+{
+    /* Arrange */
+    OS_time_t Now = OS_TimeAssembleFromMilliseconds(0, 0);
+
+    UT_SetDataBuffer(UT_KEY(OS_GetLocalTime), &Now, sizeof(Now), false);
+
+    strncpy(FM_GlobalData.ChildThrottle[1].Volume, "/ram", sizeof(FM_GlobalData.ChildThrottle[1].Volume) - 1);
+    FM_GlobalData.ChildThrottle[1].ByteRate = 2048;
+    strncpy(FM_GlobalData.ChildThrottle[2].Volume, "/cf", sizeof(FM_GlobalData.ChildThrottle[2].Volume) - 1);
+    FM_GlobalData.ChildThrottle[2].ByteRate = 4096;
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildThrottle("/ram/source", "/cf/target", 4096, 0));
+
+    /* Assert - the slower volume sets the delay */
+    UtAssert_INT32_EQ(FM_GlobalData.ChildThrottle[1].ByteTokens / 1000000, -4096);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildThrottle[2].ByteTokens / 1000000, -4096);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildThrottle[FM_CHILD_THROTTLE_DEFAULT].ByteTokens, 0);
+    UtAssert_STUB_COUNT(OS_TaskDelay, 1);
+}
+
+void Test_FM_ChildThrottle_ChargeSameVolumeOnce(void)
+{
+    /* Arrange */
+    OS_time_t Now = OS_TimeAssembleFromMilliseconds(0, 0);
+
+    UT_SetDataBuffer(UT_KEY(OS_GetLocalTime), &Now, sizeof(Now), false);
+
+    strncpy(FM_GlobalData.ChildThrottle[1].Volume, "/ram", sizeof(FM_GlobalData.ChildThrottle[1].Volume) - 1);
+    FM_GlobalData.ChildThrottle[1].ByteRate = 2048;
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildThrottle("/ram/source", "/ram/target", 2048, 0));
+
+    /* Assert */
+    UtAssert_INT32_EQ(FM_GlobalData.ChildThrottle[1].ByteTokens / 1000000, -2048);
+    UtAssert_STUB_COUNT(OS_TaskDelay, 1);
+}
+
+void Test_FM_ChildThrottleSelect_LongestVolume(void)
+{
+    /* Arrange */
+    strncpy(FM_GlobalData.ChildThrottle[1].Volume, "/ram", sizeof(FM_GlobalData.ChildThrottle[1].Volume) - 1);
+    strncpy(FM_GlobalData.ChildThrottle[2].Volume, "/ram/logs", sizeof(FM_GlobalData.ChildThrottle[2].Volume) - 1);
+
+    /* Act and Assert */
+    UtAssert_UINT32_EQ(FM_ChildThrottleSelect("/ram"), 1);
+    UtAssert_UINT32_EQ(FM_ChildThrottleSelect("/ram/file"), 1);
+    UtAssert_UINT32_EQ(FM_ChildThrottleSelect("/ram/logs/file"), 2);
+    UtAssert_UINT32_EQ(FM_ChildThrottleSelect("/ramdisk/file"), FM_CHILD_THROTTLE_DEFAULT);
+    UtAssert_UINT32_EQ(FM_ChildThrottleSelect("/cf/file"), FM_CHILD_THROTTLE_DEFAULT);
+}
+
+void Test_FM_ChildThrottleCharge_FollowDefaultRate(void)
+{
+    /* Arrange */
+    OS_time_t Now = OS_TimeAssembleFromMilliseconds(0, 0);
+
+    FM_GlobalData.ChildThrottle[FM_CHILD_THROTTLE_DEFAULT].ByteRate = 2048;
+    FM_GlobalData.ChildThrottle[FM_CHILD_THROTTLE_DEFAULT].StatRate = 10;
+    FM_GlobalData.ChildThrottle[1].ByteRate                         = FM_THROTTLE_RATE_DEFAULT;
+    FM_GlobalData.ChildThrottle[1].StatRate                         = FM_THROTTLE_RATE_UNLIMITED;
+
+    /* Act - 4096 bytes at 2048 bytes per second */
+    UtAssert_UINT32_EQ(FM_ChildThrottleCharge(1, Now, 4096, 5), 2000);
+
+    /* Assert */
+    UtAssert_INT32_EQ(FM_GlobalData.ChildThrottle[1].StatTokens, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildThrottle[FM_CHILD_THROTTLE_DEFAULT].ByteTokens, 0);
+}
+
+void Test_FM_ChildThrottleBucket_Unlimited(void)
+{
+    /* Arrange */
+    int64 Tokens = -5;
+
+    /* Act and Assert */
+    UtAssert_UINT32_EQ(FM_ChildThrottleBucket(&Tokens, FM_THROTTLE_RATE_UNLIMITED, 0, 1000), 0);
+    UtAssert_INT32_EQ(Tokens, 0);
+}
+
+void Test_FM_ChildThrottleBucket_RefillToBurst(void)
+{
+    /* Arrange */
+    int64 Tokens = 0;
+
+    /* Act - a long idle time refills no more than one burst */
+    UtAssert_UINT32_EQ(FM_ChildThrottleBucket(&Tokens, 1000, 10 * 1000000, 0), 0);
+
+    /* Assert */
+    UtAssert_INT32_EQ(Tokens, (int64)1000 * FM_CHILD_THROTTLE_BURST_MS * 1000);
+}
+
+void Test_FM_ChildThrottleBucket_WithinBurst(void)
+{
+    /* Arrange */
+    int64 Tokens = (int64)1000 * FM_CHILD_THROTTLE_BURST_MS * 1000;
+
+    /* Act - use half of the burst */
+    UtAssert_UINT32_EQ(FM_ChildThrottleBucket(&Tokens, 1000, 0, FM_CHILD_THROTTLE_BURST_MS / 2), 0);
+
+    /* Assert */
+    UtAssert_INT32_EQ(Tokens, (int64)1000 * (FM_CHILD_THROTTLE_BURST_MS - (FM_CHILD_THROTTLE_BURST_MS / 2)) * 1000);
+}
+
+void Test_FM_ChildThrottleBucket_OverRate(void)
+{
+    /* Arrange */
+    int64 Tokens = 0;
+
+    /* Act - 1500 units at 1000 units per second, the clock stepped backwards */
+    UtAssert_UINT32_EQ(FM_ChildThrottleBucket(&Tokens, 1000, -5, 1500), 1500);
+
+    /* Assert */
+    UtAssert_INT32_EQ(Tokens, -1500 * (int64)1000000);
+}
+
+void Test_FM_ChildThrottleBucket_PartialMillisecond(void)
+{
+    /* Arrange */
+    int64 Tokens = 0;
+
+    /* Act - one unit at 3 units per second is 333.3 ms, rounded up */
+    UtAssert_UINT32_EQ(FM_ChildThrottleBucket(&Tokens, 3, 0, 1), 334);
+}
+
+/* ****************
+ * ChildAbortCheck Tests
+ * ***************/
+void Test_FM_ChildAbortCheck_NoRequest(void)
+{
+    /* Arrange */
+    UT_FM_WORKER->CmdSequence = 1;
+
+    /* Act */
+    UtAssert_BOOL_FALSE(FM_ChildAbortCheck(UT_FM_WORKER, "Copy File"));
+
+    /* Assert */
+    UtAssert_BOOL_FALSE(UT_FM_WORKER->Aborted);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_FM_ChildAbortCheck_Requested(void)
+{
+    /* Arrange */
+    UT_FM_WORKER->CmdSequence   = 7;
+    UT_FM_WORKER->AbortSequence = 7;
+
+    /* Act - the second check reports the same abort without a new event */
+    UtAssert_BOOL_TRUE(FM_ChildAbortCheck(UT_FM_WORKER, "Copy File"));
+    UtAssert_BOOL_TRUE(FM_ChildAbortCheck(UT_FM_WORKER, "Copy File"));
+
+    /* Assert */
+    UtAssert_BOOL_TRUE(UT_FM_WORKER->Aborted);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHILD_ABORT_ERR_EID);
+}
+
+void Test_FM_ChildAbortCheck_StaleRequest(void)
+{
+    /* Arrange - the request named the previous command */
+    UT_FM_WORKER->CmdSequence   = 8;
+    UT_FM_WORKER->AbortSequence = 7;
+
+    /* Act */
+    UtAssert_BOOL_FALSE(FM_ChildAbortCheck(UT_FM_WORKER, "Copy File"));
+
+    /* Assert */
+    UtAssert_BOOL_FALSE(UT_FM_WORKER->Aborted);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_FM_ChildAbortCheck_SequenceZero(void)
+{
+    /* Arrange - a worker that has not started a command */
+    UT_FM_WORKER->CmdSequence   = 0;
+    UT_FM_WORKER->AbortSequence = 0;
+
+    /* Act */
+    UtAssert_BOOL_FALSE(FM_ChildAbortCheck(UT_FM_WORKER, "Copy File"));
+
+    /* Assert */
+    UtAssert_BOOL_FALSE(UT_FM_WORKER->Aborted);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
 
-    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
-    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+/* ****************
+ * ChildCheckpointResume Tests
+ * ***************/
+void Test_FM_ChildCheckpointResume_NoFile(void)
+{
+    /* Arrange */
+    UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), !OS_SUCCESS);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildDirListPktCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildCheckpointResume(UT_FM_WORKER));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
-
-    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_PKT_CMD_INF_EID);
-
-    ReportPtr = &FM_GlobalData.DirListPkt.Payload;
-    UtAssert_UINT32_EQ(ReportPtr->PacketFiles, 0);
+    UtAssert_STUB_COUNT(OS_read, 0);
+    UtAssert_STUB_COUNT(OS_remove, 0);
+    UtAssert_BOOL_FALSE(UT_FM_WORKER->Resuming);
+    UtAssert_INT32_EQ(UT_FM_WORKER->CmdSequence, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
-void Test_FM_ChildDirListPktCmd_DirListOffsetNotExceeded(void)
+void Test_FM_ChildCheckpointResume_InvalidFile(void)
 {
-    FM_DirListPkt_Payload_t *ReportPtr;
-
-    /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {
-        .CommandCode = FM_GET_DIR_LIST_PKT_CC, .Source1 = "source1", .Source2 = "source2", .DirListOffset = 1};
-    os_dirent_t direntry = {.FileName = "filename"};
-
-    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
-    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    /* Arrange - the stub reads an empty file */
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildDirListPktCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildCheckpointResume(UT_FM_WORKER));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
-
-    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
+    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_STUB_COUNT(OS_remove, 1);
+    UtAssert_BOOL_FALSE(UT_FM_WORKER->Resuming);
+    UtAssert_BOOL_FALSE(UT_FM_WORKER->CheckpointSaved);
+    UtAssert_INT32_EQ(UT_FM_WORKER->CmdSequence, 0);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_PKT_CMD_INF_EID);
-
-    ReportPtr = &FM_GlobalData.DirListPkt.Payload;
-    UtAssert_UINT32_EQ(ReportPtr->FirstFile, 1);
-    UtAssert_UINT32_EQ(ReportPtr->TotalFiles, 1);
-    UtAssert_UINT32_EQ(ReportPtr->PacketFiles, 0);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHILD_CHECKPOINT_ERR_EID);
 }
 
-void Test_FM_ChildDirListPktCmd_DirListOffsetExceeded(void)
+void Test_FM_ChildCheckpointResume_UnknownCommand(void)
 {
-    FM_DirListPkt_Payload_t *ReportPtr;
-
     /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {
-        .CommandCode = FM_GET_DIR_LIST_PKT_CC, .Source1 = "source1", .Source2 = "source2"};
-    os_dirent_t direntry[FM_DIR_LIST_PKT_ENTRIES + 1];
+    FM_ChildCheckpoint_t Checkpoint;
 
-    /* Unit under test doesn't really care if the entry name is empty */
-    memset(direntry, 0, sizeof(direntry));
+    memset(&Checkpoint, 0, sizeof(Checkpoint));
+    Checkpoint.Signature           = FM_CHILD_CHECKPOINT_SIGNATURE;
+    Checkpoint.CmdArgs.CommandCode = FM_DELETE_FILE_CC;
 
-    /* Will fill the entire packet and have one more */
-    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), sizeof(direntry) / sizeof(direntry[0]) + 1, !OS_SUCCESS);
-    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDataBuffer(UT_KEY(OS_read), &Checkpoint, sizeof(Checkpoint), false);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildDirListPktCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildCheckpointResume(UT_FM_WORKER));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
-
-    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryRead, sizeof(direntry) / sizeof(direntry[0]) + 1);
+    UtAssert_STUB_COUNT(OS_remove, 1);
+    UtAssert_INT32_EQ(UT_FM_WORKER->CmdSequence, 0);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_PKT_CMD_INF_EID);
-
-    ReportPtr = &FM_GlobalData.DirListPkt.Payload;
-    UtAssert_UINT32_EQ(ReportPtr->FirstFile, 0);
-    UtAssert_UINT32_EQ(ReportPtr->TotalFiles, sizeof(direntry) / sizeof(direntry[0]));
-    UtAssert_UINT32_EQ(ReportPtr->PacketFiles, FM_DIR_LIST_PKT_ENTRIES);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHILD_CHECKPOINT_ERR_EID);
 }
 
-void Test_FM_ChildDirListPktCmd_PathAndEntryLengthGreaterMaxPathLength(void)
+void Test_FM_ChildCheckpointResume_CopyRecord(void)
 {
-    FM_DirListPkt_Payload_t *ReportPtr;
+    /* Arrange - the source has changed size since the checkpoint was saved */
+    FM_ChildCheckpoint_t Checkpoint;
 
-    /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DELETE_ALL_FILES_CC,
-                                        .Source1     = "source1",
-                                        .Source2 = "source2_has_quite_a_long_name_to_make_path_length_longer_than_64"};
-    os_dirent_t          direntry    = {.FileName = "direntry_long"};
+    memset(&Checkpoint, 0, sizeof(Checkpoint));
+    Checkpoint.Signature           = FM_CHILD_CHECKPOINT_SIGNATURE;
+    Checkpoint.SourceSize          = 100;
+    Checkpoint.CmdArgs.CommandCode = FM_COPY_FILE_CC;
+    strncpy(Checkpoint.CmdArgs.Source1, "source", sizeof(Checkpoint.CmdArgs.Source1) - 1);
+    strncpy(Checkpoint.CmdArgs.Target, "target", sizeof(Checkpoint.CmdArgs.Target) - 1);
 
-    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
-    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
+    UT_SetDataBuffer(UT_KEY(OS_read), &Checkpoint, sizeof(Checkpoint), false);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildDirListPktCmd(&queue_entry));
-
-    /* Assert */
-    UT_FM_Child_Cmd_Assert(1, 0, 1, queue_entry.CommandCode);
-
-    UtAssert_STUB_COUNT(OS_DirectoryOpen, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_PKT_WARNING_EID);
-
-    ReportPtr = &FM_GlobalData.DirListPkt.Payload;
-    UtAssert_UINT32_EQ(ReportPtr->FirstFile, 0);
-    UtAssert_UINT32_EQ(ReportPtr->TotalFiles, 1);
-    UtAssert_UINT32_EQ(ReportPtr->PacketFiles, 0);
+    UtAssert_VOIDCALL(FM_ChildCheckpointResume(UT_FM_WORKER));
+
+    /* Assert - the command runs, fails and removes both the target and the checkpoint file */
+    UT_FM_Child_Cmd_Assert(0, 1, 0, FM_COPY_FILE_CC);
+
+    UtAssert_INT32_EQ(UT_FM_WORKER->CmdSequence, 1);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildDispatchSeq, 1);
+    UtAssert_UINT32_EQ(UT_FM_WORKER->InFlightSeq, 0);
+    UtAssert_STUB_COUNT(OS_stat, 2);
+    UtAssert_STUB_COUNT(OS_remove, 2);
+    UtAssert_BOOL_FALSE(UT_FM_WORKER->Resuming);
+    UtAssert_BOOL_FALSE(UT_FM_WORKER->CheckpointSaved);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHILD_CHECKPOINT_ERR_EID);
 }
 
 /* ****************
- * ChildSetPermissionsCmd Tests
+ * ChildCheckpointBegin Tests
  * ***************/
-void Test_FM_ChildSetPermissionsCmd_OSChmodSuccess(void)
+void Test_FM_ChildCheckpointBegin_NewCommand(void)
 {
     /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_SET_PERMISSIONS_CC};
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_COPY_FILE_CC, .Source1 = "source", .Target = "target"};
+
+    UT_FM_WORKER->Checkpoint.SourceOffset = 5;
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildSetPermissionsCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildCheckpointBegin(UT_FM_WORKER, &queue_entry));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(1, 0, 0, queue_entry.CommandCode);
-
-    UtAssert_STUB_COUNT(OS_chmod, 1);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_SET_PERM_CMD_INF_EID);
+    UtAssert_UINT32_EQ(UT_FM_WORKER->Checkpoint.Signature, FM_CHILD_CHECKPOINT_SIGNATURE);
+    UtAssert_UINT32_EQ(UT_FM_WORKER->Checkpoint.SourceOffset, 0);
+    UtAssert_INT32_EQ(UT_FM_WORKER->Checkpoint.CmdArgs.CommandCode, FM_COPY_FILE_CC);
+    UtAssert_STRINGBUF_EQ(UT_FM_WORKER->Checkpoint.CmdArgs.Target, sizeof(UT_FM_WORKER->Checkpoint.CmdArgs.Target),
+                          "target", -1);
 }
 
-void Test_FM_ChildSetPermissionsCmd_OSChmodNotSuccess(void)
+void Test_FM_ChildCheckpointBegin_Resuming(void)
 {
     /* Arrange */
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_SET_PERMISSIONS_CC};
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_COPY_FILE_CC, .Source1 = "source", .Target = "target"};
 
-    UT_SetDefaultReturnValue(UT_KEY(OS_chmod), !OS_SUCCESS);
+    UT_FM_WORKER->Resuming                = true;
+    UT_FM_WORKER->Checkpoint.SourceOffset = 5;
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildSetPermissionsCmd(&queue_entry));
+    UtAssert_VOIDCALL(FM_ChildCheckpointBegin(UT_FM_WORKER, &queue_entry));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(0, 1, 0, queue_entry.CommandCode);
-
-    UtAssert_STUB_COUNT(OS_chmod, 1);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_SET_PERM_OS_ERR_EID);
+    UtAssert_UINT32_EQ(UT_FM_WORKER->Checkpoint.SourceOffset, 5);
+    UtAssert_INT32_EQ(UT_FM_WORKER->Checkpoint.CmdArgs.CommandCode, 0);
 }
 
 /* ****************
- * ChildDirListFileInit Tests
+ * ChildCheckpointSource Tests
  * ***************/
-void Test_FM_ChildDirListFileInit_OSOpenCreateFail(void)
+void Test_FM_ChildCheckpointSource_NewSource(void)
 {
     /* Arrange */
-    osal_id_t   fileid;
-    const char *directory = "directory";
-    const char *filename  = "filename";
+    uint32 ResumeOffset = 1;
 
-    UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), !OS_SUCCESS);
+    UT_FM_WORKER->CopyBytes = 10;
 
     /* Act */
-    UtAssert_BOOL_FALSE(FM_ChildDirListFileInit(&fileid, directory, filename));
+    UtAssert_BOOL_TRUE(FM_ChildCheckpointSource(UT_FM_WORKER, 2, "source", "target", "Concat List", &ResumeOffset));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(0, 1, 0, 0);
-
-    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
-    UtAssert_STUB_COUNT(OS_close, 0);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_FILE_OSCREAT_ERR_EID);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildCmdErrCounter, 1);
+    UtAssert_UINT32_EQ(ResumeOffset, 0);
+    UtAssert_UINT32_EQ(UT_FM_WORKER->Checkpoint.SourceIndex, 2);
+    UtAssert_UINT32_EQ(UT_FM_WORKER->Checkpoint.TargetBase, 10);
+    UtAssert_UINT32_EQ(UT_FM_WORKER->CheckpointNext, FM_CHILD_CHECKPOINT_INTERVAL);
+    UtAssert_STUB_COUNT(OS_stat, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
-void Test_FM_ChildDirListFileInit_FSWriteHeaderNotSameSizeFSHeadert(void)
+void Test_FM_ChildCheckpointSource_BeyondMaxOffset(void)
 {
     /* Arrange */
-    osal_id_t   fileid;
-    osal_id_t   LocalFileHandle = FM_UT_OBJID_1;
-    const char *directory       = "directory";
-    const char *filename        = "filename";
+    uint32 ResumeOffset = 0;
 
-    UT_SetDataBuffer(UT_KEY(OS_OpenCreate), &LocalFileHandle, sizeof(osal_id_t), false);
-    UT_SetDefaultReturnValue(UT_KEY(CFE_FS_WriteHeader), sizeof(CFE_FS_Header_t) - 1);
+    UT_FM_WORKER->CopyBytes = (uint64)FM_CHILD_CHECKPOINT_MAX_OFFSET + 1;
 
     /* Act */
-    UtAssert_BOOL_FALSE(FM_ChildDirListFileInit(&fileid, directory, filename));
+    UtAssert_BOOL_TRUE(FM_ChildCheckpointSource(UT_FM_WORKER, 1, "source", "target", "Concat List", &ResumeOffset));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(0, 1, 0, 0);
+    UtAssert_UINT32_EQ(UT_FM_WORKER->CheckpointNext, 0);
+}
 
-    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
-    UtAssert_STUB_COUNT(CFE_FS_WriteHeader, 1);
-    UtAssert_STUB_COUNT(OS_close, 1);
+void Test_FM_ChildCheckpointSource_ResumeMatch(void)
+{
+    /* Arrange - source then target */
+    uint32     ResumeOffset = 0;
+    os_fstat_t FileStats[2];
+
+    memset(FileStats, 0, sizeof(FileStats));
+    FileStats[0].FileSize = 100;
+    FileStats[1].FileSize = 150;
+
+    UT_FM_WORKER->Resuming                = true;
+    UT_FM_WORKER->Checkpoint.SourceSize   = 100;
+    UT_FM_WORKER->Checkpoint.TargetBase   = 50;
+    UT_FM_WORKER->Checkpoint.SourceOffset = 40;
+
+    UT_SetDataBuffer(UT_KEY(OS_stat), FileStats, sizeof(FileStats), false);
+
+    /* Act */
+    UtAssert_BOOL_TRUE(FM_ChildCheckpointSource(UT_FM_WORKER, 0, "source", "target", "Copy File", &ResumeOffset));
+
+    /* Assert */
+    UtAssert_UINT32_EQ(ResumeOffset, 40);
+    UtAssert_UINT32_EQ(UT_FM_WORKER->CopyBytes, 90);
+    UtAssert_UINT32_EQ(UT_FM_WORKER->CheckpointNext, 40 + FM_CHILD_CHECKPOINT_INTERVAL);
+    UtAssert_BOOL_FALSE(UT_FM_WORKER->Resuming);
+    UtAssert_STUB_COUNT(OS_stat, 2);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_FILE_WRHDR_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHILD_RESUME_INF_EID);
 }
 
-void Test_FM_ChildDirListFileInit_OSWriteNotSameSizeDirListFileStatst(void)
+void Test_FM_ChildCheckpointSource_ResumeMismatch(void)
 {
-    /* Arrange */
-    osal_id_t   fileid;
-    const char *directory       = "directory";
-    const char *filename        = "filename";
-    osal_id_t   LocalFileHandle = FM_UT_OBJID_1;
+    /* Arrange - the stub reports an empty source */
+    uint32 ResumeOffset = 0;
 
-    UT_SetDataBuffer(UT_KEY(OS_OpenCreate), &LocalFileHandle, sizeof(osal_id_t), false);
-    UT_SetDefaultReturnValue(UT_KEY(OS_write), sizeof(FM_DirListFileStats_t) - 1);
+    UT_FM_WORKER->Resuming              = true;
+    UT_FM_WORKER->Checkpoint.SourceSize = 100;
 
     /* Act */
-    UtAssert_BOOL_FALSE(FM_ChildDirListFileInit(&fileid, directory, filename));
+    UtAssert_BOOL_FALSE(FM_ChildCheckpointSource(UT_FM_WORKER, 0, "source", "target", "Copy File", &ResumeOffset));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(0, 1, 0, 0);
-
-    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
-    UtAssert_STUB_COUNT(CFE_FS_WriteHeader, 1);
-    UtAssert_STUB_COUNT(OS_write, 1);
-    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_UINT32_EQ(ResumeOffset, 0);
+    UtAssert_UINT32_EQ(UT_FM_WORKER->CheckpointNext, 0);
+    UtAssert_BOOL_FALSE(UT_FM_WORKER->Resuming);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_FILE_WRBLANK_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHILD_CHECKPOINT_ERR_EID);
 }
 
-void Test_FM_ChildDirListFileInit_OSWriteSameSizeDirListFileStatst(void)
+void Test_FM_ChildCheckpointSource_ResumeWrongSource(void)
 {
     /* Arrange */
-    osal_id_t   fileid;
-    const char *directory = "directory";
-    const char *filename  = "filename";
+    uint32 ResumeOffset = 0;
+
+    UT_FM_WORKER->Resuming               = true;
+    UT_FM_WORKER->Checkpoint.SourceIndex = 1;
 
     /* Act */
-    UtAssert_BOOL_TRUE(FM_ChildDirListFileInit(&fileid, directory, filename));
+    UtAssert_BOOL_FALSE(FM_ChildCheckpointSource(UT_FM_WORKER, 0, "source", "target", "Concat Files", &ResumeOffset));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(0, 0, 0, 0);
-
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
-    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
-    UtAssert_STUB_COUNT(CFE_FS_WriteHeader, 1);
-    UtAssert_STUB_COUNT(OS_write, 1);
-    UtAssert_STUB_COUNT(OS_close, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHILD_CHECKPOINT_ERR_EID);
 }
 
 /* ****************
- * ChildDirListFileLoop Tests
+ * ChildCheckpointSeek Tests
  * ***************/
-void Test_FM_ChildDirListFileLoop_OSDirReadNotSuccess(void)
+void Test_FM_ChildCheckpointSeek_Success(void)
 {
-    /* Arrange */
-    UT_SetDefaultReturnValue(UT_KEY(OS_DirectoryRead), !OS_SUCCESS);
+    /* Arrange - the stub seeks to offset zero */
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildDirListFileLoop(FM_UT_OBJID_1, FM_UT_OBJID_2, "dir", "dir/", "fname", false));
+    UtAssert_BOOL_TRUE(FM_ChildCheckpointSeek(UT_FM_WORKER, FM_UT_OBJID_1, FM_UT_OBJID_2, "Copy File"));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(1, 0, 0, 0);
-
-    UtAssert_STUB_COUNT(OS_DirectoryRead, 1);
-    UtAssert_STUB_COUNT(OS_write, 0);
-    UtAssert_STUB_COUNT(OS_lseek, 0);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_FILE_CMD_INF_EID);
-
-    UtAssert_UINT32_EQ(FM_GlobalData.DirListFileStats.DirEntries, 0);
-    UtAssert_UINT32_EQ(FM_GlobalData.DirListFileStats.FileEntries, 0);
+    UtAssert_STUB_COUNT(OS_lseek, 2);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
-void Test_FM_ChildDirListFileLoop_OSDirEntryNameIsThisDirectory(void)
+void Test_FM_ChildCheckpointSeek_SeekNotSuccess(void)
 {
     /* Arrange */
-    os_dirent_t direntry = {.FileName = FM_THIS_DIRECTORY};
-
-    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
-    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+    UT_SetDeferredRetcode(UT_KEY(OS_lseek), 2, OS_ERROR);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildDirListFileLoop(FM_UT_OBJID_1, FM_UT_OBJID_2, "dir", "dir/", "fname", false));
+    UtAssert_BOOL_FALSE(FM_ChildCheckpointSeek(UT_FM_WORKER, FM_UT_OBJID_1, FM_UT_OBJID_2, "Copy File"));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(1, 0, 0, 0);
-
-    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
-    UtAssert_STUB_COUNT(OS_write, 0);
-    UtAssert_STUB_COUNT(OS_lseek, 0);
+    UtAssert_STUB_COUNT(OS_lseek, 2);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_FILE_CMD_INF_EID);
-
-    UtAssert_UINT32_EQ(FM_GlobalData.DirListFileStats.DirEntries, 0);
-    UtAssert_UINT32_EQ(FM_GlobalData.DirListFileStats.FileEntries, 0);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHILD_CHECKPOINT_ERR_EID);
 }
 
-void Test_FM_ChildDirListFileLoop_OSDirEntryNameIsParentDirectory(void)
+/* ****************
+ * ChildCheckpointSave Tests
+ * ***************/
+void Test_FM_ChildCheckpointSave_Disabled(void)
 {
     /* Arrange */
-    os_dirent_t direntry = {.FileName = FM_PARENT_DIRECTORY};
-
-    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
-    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+    UT_FM_WORKER->CheckpointNext = 0;
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildDirListFileLoop(FM_UT_OBJID_1, FM_UT_OBJID_2, "dir", "dir/", "fname", false));
-
-    /* Assert */
-    UT_FM_Child_Cmd_Assert(1, 0, 0, 0);
+    UtAssert_VOIDCALL(FM_ChildCheckpointSave(UT_FM_WORKER, FM_CHILD_CHECKPOINT_INTERVAL));
 
-    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
-    UtAssert_STUB_COUNT(OS_write, 0);
-    UtAssert_STUB_COUNT(OS_lseek, 0);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_FILE_CMD_INF_EID);
+    /* Assert - written bytes are still counted */
+    UtAssert_UINT32_EQ(UT_FM_WORKER->Checkpoint.SourceOffset, FM_CHILD_CHECKPOINT_INTERVAL);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 0);
 }
 
-void Test_FM_ChildDirListFileLoop_PathLengthAndEntryLengthGreaterMaxPathLen(void)
+void Test_FM_ChildCheckpointSave_NotDue(void)
 {
     /* Arrange */
-    char        dirwithsep[OS_MAX_PATH_LEN];
-    os_dirent_t direntry = {.FileName = "directory_nam"};
-
-    memset(dirwithsep, 0xFF, sizeof(dirwithsep));
-    dirwithsep[sizeof(dirwithsep) - 1] = '\0';
-
-    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
-    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+    UT_FM_WORKER->CheckpointNext = FM_CHILD_CHECKPOINT_INTERVAL;
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildDirListFileLoop(FM_UT_OBJID_1, FM_UT_OBJID_2, "dir", dirwithsep, "fname", false));
+    UtAssert_VOIDCALL(FM_ChildCheckpointSave(UT_FM_WORKER, FM_CHILD_CHECKPOINT_INTERVAL - 1));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(1, 0, 1, 0);
-
-    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
-    UtAssert_STUB_COUNT(OS_write, 1);
-    UtAssert_STUB_COUNT(OS_lseek, 1);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_FILE_WARNING_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_GET_DIR_FILE_CMD_INF_EID);
-
-    UtAssert_INT32_EQ(FM_GlobalData.DirListFileStats.DirEntries, 1);
-    UtAssert_INT32_EQ(FM_GlobalData.DirListFileStats.FileEntries, 0);
+    UtAssert_UINT32_EQ(UT_FM_WORKER->Checkpoint.SourceOffset, FM_CHILD_CHECKPOINT_INTERVAL - 1);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 0);
+    UtAssert_BOOL_FALSE(UT_FM_WORKER->CheckpointSaved);
 }
 
-void Test_FM_ChildDirListFileLoop_FileEntriesGreaterFMDirListFileEntries(void)
+void Test_FM_ChildCheckpointSave_Due(void)
 {
-    os_dirent_t direntry = {.FileName = "directory_nam"};
-    uint32      entrycnt = FM_DIR_LIST_FILE_ENTRIES + 1;
+    /* Arrange */
+    UT_FM_WORKER->CheckpointNext = FM_CHILD_CHECKPOINT_INTERVAL;
 
-    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
-    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), entrycnt + 1, !OS_SUCCESS);
+    UT_SetDefaultReturnValue(UT_KEY(OS_write), sizeof(FM_ChildCheckpoint_t));
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildDirListFileLoop(FM_UT_OBJID_1, FM_UT_OBJID_2, "dir", "dir/", "fname", false));
+    UtAssert_VOIDCALL(FM_ChildCheckpointSave(UT_FM_WORKER, FM_CHILD_CHECKPOINT_INTERVAL));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(1, 0, 0, 0);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
+    UtAssert_STUB_COUNT(OS_write, 1);
+    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_BOOL_TRUE(UT_FM_WORKER->CheckpointSaved);
+    UtAssert_UINT32_EQ(UT_FM_WORKER->CheckpointNext, 2 * FM_CHILD_CHECKPOINT_INTERVAL);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
 
-    UtAssert_STUB_COUNT(OS_DirectoryRead, entrycnt + 1);
-    UtAssert_STUB_COUNT(OS_write, FM_DIR_LIST_FILE_ENTRIES + 1);
-    UtAssert_STUB_COUNT(OS_lseek, 1);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_FILE_CMD_INF_EID);
+void Test_FM_ChildCheckpointSave_BeyondMaxOffset(void)
+{
+    /* Arrange */
+    UT_FM_WORKER->CheckpointNext        = FM_CHILD_CHECKPOINT_INTERVAL;
+    UT_FM_WORKER->Checkpoint.TargetBase = FM_CHILD_CHECKPOINT_MAX_OFFSET;
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_write), sizeof(FM_ChildCheckpoint_t));
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildCheckpointSave(UT_FM_WORKER, FM_CHILD_CHECKPOINT_INTERVAL));
 
-    UtAssert_INT32_EQ(FM_GlobalData.DirListFileStats.DirEntries, entrycnt);
-    UtAssert_INT32_EQ(FM_GlobalData.DirListFileStats.FileEntries, FM_DIR_LIST_FILE_ENTRIES);
+    /* Assert - this checkpoint is saved, there will be no next one */
+    UtAssert_STUB_COUNT(OS_write, 1);
+    UtAssert_BOOL_TRUE(UT_FM_WORKER->CheckpointSaved);
+    UtAssert_UINT32_EQ(UT_FM_WORKER->CheckpointNext, 0);
 }
 
-void Test_FM_ChildDirListFileLoop_BytesWrittenNotEqualWriteLength(void)
+void Test_FM_ChildCheckpointSave_OpenNotSuccess(void)
 {
     /* Arrange */
-    os_dirent_t direntry = {.FileName = "directory_nam"};
+    UT_FM_WORKER->CheckpointNext = FM_CHILD_CHECKPOINT_INTERVAL;
 
-    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
-    UT_SetDefaultReturnValue(UT_KEY(OS_write), sizeof(FM_DirListEntry_t));
-    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
+    UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), !OS_SUCCESS);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildDirListFileLoop(FM_UT_OBJID_1, FM_UT_OBJID_2, "dir", "dir/", "fname", false));
+    UtAssert_VOIDCALL(FM_ChildCheckpointSave(UT_FM_WORKER, FM_CHILD_CHECKPOINT_INTERVAL));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(0, 1, 0, 0);
-
-    UtAssert_STUB_COUNT(OS_DirectoryRead, 2);
-    UtAssert_STUB_COUNT(OS_write, 2);
-    UtAssert_STUB_COUNT(OS_lseek, 1);
+    UtAssert_STUB_COUNT(OS_write, 0);
+    UtAssert_BOOL_FALSE(UT_FM_WORKER->CheckpointSaved);
+    UtAssert_UINT32_EQ(UT_FM_WORKER->CheckpointNext, 0);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_FILE_UPSTATS_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHILD_CHECKPOINT_SAVE_ERR_EID);
+}
+
+void Test_FM_ChildCheckpointSave_WriteNotSuccess(void)
+{
+    /* Arrange - the stub writes nothing */
+    UT_FM_WORKER->CheckpointNext = FM_CHILD_CHECKPOINT_INTERVAL;
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildCheckpointSave(UT_FM_WORKER, FM_CHILD_CHECKPOINT_INTERVAL));
 
-    UtAssert_INT32_EQ(FM_GlobalData.DirListFileStats.DirEntries, 1);
-    UtAssert_INT32_EQ(FM_GlobalData.DirListFileStats.FileEntries, 1);
+    /* Assert - the partial file is removed when the command ends */
+    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_BOOL_TRUE(UT_FM_WORKER->CheckpointSaved);
+    UtAssert_UINT32_EQ(UT_FM_WORKER->CheckpointNext, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHILD_CHECKPOINT_SAVE_ERR_EID);
 }
 
-void Test_FM_ChildDirListFileLoop_BytesWrittenNotEqualWriteLengthInLoop(void)
+/* ****************
+ * ChildCheckpointEnd Tests
+ * ***************/
+void Test_FM_ChildCheckpointEnd_Saved(void)
 {
     /* Arrange */
-    os_dirent_t direntry = {.FileName = "directory_nam"};
-
-    UT_SetDataBuffer(UT_KEY(OS_DirectoryRead), &direntry, sizeof(direntry), false);
-    UT_SetDeferredRetcode(UT_KEY(OS_DirectoryRead), 2, !OS_SUCCESS);
-    UT_SetDefaultReturnValue(UT_KEY(OS_write), sizeof(FM_DirListEntry_t) - 1);
+    UT_FM_WORKER->Resuming        = true;
+    UT_FM_WORKER->CheckpointSaved = true;
+    UT_FM_WORKER->CheckpointNext  = FM_CHILD_CHECKPOINT_INTERVAL;
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildDirListFileLoop(FM_UT_OBJID_1, FM_UT_OBJID_2, "dir", "dir/", "fname", false));
+    UtAssert_VOIDCALL(FM_ChildCheckpointEnd(UT_FM_WORKER));
 
     /* Assert */
-    UT_FM_Child_Cmd_Assert(0, 1, 0, 0);
+    UtAssert_STUB_COUNT(OS_remove, 1);
+    UtAssert_BOOL_FALSE(UT_FM_WORKER->Resuming);
+    UtAssert_BOOL_FALSE(UT_FM_WORKER->CheckpointSaved);
+    UtAssert_UINT32_EQ(UT_FM_WORKER->CheckpointNext, 0);
+}
 
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_STUB_COUNT(OS_DirectoryRead, 1);
-    UtAssert_STUB_COUNT(OS_write, 1);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_DIR_FILE_WRENTRY_ERR_EID);
+void Test_FM_ChildCheckpointEnd_NotSaved(void)
+{
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildCheckpointEnd(UT_FM_WORKER));
 
-    UtAssert_INT32_EQ(FM_GlobalData.DirListFileStats.DirEntries, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.DirListFileStats.FileEntries, 0);
+    /* Assert */
+    UtAssert_STUB_COUNT(OS_remove, 0);
 }
 
 /* ****************
- * ChildSizeTimeMode Tests
+ * ChildCheckpointName Tests
  * ***************/
-void Test_FM_ChildSizeTimeMode_OsStatNoSuccess(void)
+void Test_FM_ChildCheckpointName_WorkerIndex(void)
 {
     /* Arrange */
-    uint32 filesize = 1;
-    uint32 filetime = 1;
-    uint32 filemode = 1;
+    char FileName[OS_MAX_PATH_LEN];
 
-    UT_SetDefaultReturnValue(UT_KEY(OS_stat), !OS_SUCCESS);
+    UT_FM_WORKER->WorkerIndex = 1;
 
     /* Act */
-    UtAssert_INT32_EQ(FM_ChildSizeTimeMode("fname", &filesize, &filetime, &filemode), !OS_SUCCESS);
+    UtAssert_VOIDCALL(FM_ChildCheckpointName(UT_FM_WORKER, FileName, sizeof(FileName)));
 
     /* Assert */
-    UtAssert_STUB_COUNT(OS_stat, 1);
-    UtAssert_UINT32_EQ(filesize, 0);
-    UtAssert_UINT32_EQ(filetime, 0);
-    UtAssert_UINT32_EQ(filemode, 0);
+    UtAssert_STRINGBUF_EQ(FileName, sizeof(FileName), FM_CHILD_CHECKPOINT_FILE "1", -1);
 }
 
-void Test_FM_ChildSizeTimeMode_OSFilestateTimeDefined(void)
+/* ****************
+ * ChildProgress Tests
+ * ***************/
+void Test_FM_ChildProgressBegin_CommandArgs(void)
 {
-    /* Arrange */
-    uint32 filesize = 0;
-    uint32 filetime = 0;
-    uint32 filemode = 0;
+    /* Arrange - counts left over from the previous command */
+    OS_time_t Now = OS_TimeAssembleFromMilliseconds(5, 0);
 
-    OS_time_t  ostime     = {.ticks = 1};
-    os_fstat_t filestatus = {.FileModeBits = 2, .FileTime = ostime, .FileSize = 3};
+    UT_FM_WORKER->ProgressBytes = 10;
+    UT_FM_WORKER->ProgressTotal = 20;
+    strncpy(UT_FM_WORKER->CmdArgs.Source1, "source", sizeof(UT_FM_WORKER->CmdArgs.Source1) - 1);
+    strncpy(UT_FM_WORKER->CmdArgs.Target, "target", sizeof(UT_FM_WORKER->CmdArgs.Target) - 1);
 
-    UT_SetDataBuffer(UT_KEY(OS_stat), &filestatus, sizeof(filestatus), false);
+    UT_SetDataBuffer(UT_KEY(OS_GetLocalTime), &Now, sizeof(Now), false);
 
     /* Act */
-    UtAssert_INT32_EQ(FM_ChildSizeTimeMode("fname", &filesize, &filetime, &filemode), OS_SUCCESS);
+    UtAssert_VOIDCALL(FM_ChildProgressBegin(UT_FM_WORKER));
 
     /* Assert */
-    UtAssert_STUB_COUNT(OS_stat, 1);
-    UtAssert_UINT32_EQ(filetime, OS_FILESTAT_TIME(filestatus));
-    UtAssert_UINT32_EQ(filesize, OS_FILESTAT_SIZE(filestatus));
-    UtAssert_UINT32_EQ(filemode, OS_FILESTAT_MODE(filestatus));
+    UtAssert_UINT32_EQ(UT_FM_WORKER->ProgressBytes, 0);
+    UtAssert_UINT32_EQ(UT_FM_WORKER->ProgressTotal, 0);
+    UtAssert_STRINGBUF_EQ(UT_FM_WORKER->ProgressSource, sizeof(UT_FM_WORKER->ProgressSource), "source", -1);
+    UtAssert_STRINGBUF_EQ(UT_FM_WORKER->ProgressTarget, sizeof(UT_FM_WORKER->ProgressTarget), "target", -1);
+    UtAssert_INT32_EQ(OS_TimeGetTotalMilliseconds(UT_FM_WORKER->ProgressStart), 5000);
+}
+
+void Test_FM_ChildProgressSource_AddsToTotal(void)
+{
+    /* Arrange - a second concat source */
+    UT_FM_WORKER->ProgressBytes = 100;
+    UT_FM_WORKER->ProgressTotal = 100;
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ChildProgressSource(UT_FM_WORKER, "source2", "target", 50));
+
+    /* Assert */
+    UtAssert_UINT32_EQ(UT_FM_WORKER->ProgressBytes, 100);
+    UtAssert_UINT32_EQ(UT_FM_WORKER->ProgressTotal, 150);
+    UtAssert_STRINGBUF_EQ(UT_FM_WORKER->ProgressSource, sizeof(UT_FM_WORKER->ProgressSource), "source2", -1);
+    UtAssert_STRINGBUF_EQ(UT_FM_WORKER->ProgressTarget, sizeof(UT_FM_WORKER->ProgressTarget), "target", -1);
 }
 
 /* ****************
- * ChildLoop Tests
+ * ChildVerifyCmd Tests
  * ***************/
-void Test_FM_ChildLoop_CountSemTakeNotSuccess(void)
+void Test_FM_ChildVerifyCmd_CopyOverwrite(void)
 {
     /* Arrange */
-    UT_SetDefaultReturnValue(UT_KEY(OS_CountSemTake), !CFE_SUCCESS);
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_COPY_FILE_CC, .Overwrite = true};
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileState), true);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildLoop());
+    UtAssert_BOOL_TRUE(FM_ChildVerifyCmd(UT_FM_WORKER, &queue_entry));
 
-    /* Assert */
-    UtAssert_STUB_COUNT(OS_CountSemTake, 1);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHILD_TERM_SEM_ERR_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildCmdErrCounter, 0);
+    /* Assert - source and target are both checked */
+    UtAssert_STUB_COUNT(FM_VerifyFileState, 2);
 }
 
-void Test_FM_ChildLoop_ChildQCountEqualZero(void)
+void Test_FM_ChildVerifyCmd_ConcatListInlineSources(void)
 {
+    /* Arrange - the second of three inline sources fails */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_CONCAT_LIST_CC};
+
+    strncpy(queue_entry.SourceList, "/cf/a\n/cf/b\n/cf/c", sizeof(queue_entry.SourceList) - 1);
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileState), true);
+    UT_SetDeferredRetcode(UT_KEY(FM_VerifyFileState), 2, false);
+
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildLoop());
+    UtAssert_BOOL_FALSE(FM_ChildVerifyCmd(UT_FM_WORKER, &queue_entry));
 
     /* Assert */
-    UtAssert_STUB_COUNT(OS_CountSemTake, 1);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHILD_TERM_EMPTYQ_ERR_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildCmdErrCounter, 1);
+    UtAssert_STUB_COUNT(FM_VerifyFileState, 2);
+
+    /* Every source and then the target when all pass */
+    UT_ResetState(UT_KEY(FM_VerifyFileState));
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileState), true);
+
+    UtAssert_BOOL_TRUE(FM_ChildVerifyCmd(UT_FM_WORKER, &queue_entry));
+    UtAssert_STUB_COUNT(FM_VerifyFileState, 4);
 }
 
-void Test_FM_ChildLoop_ChildReadIndexEqualChildQDepth(void)
+void Test_FM_ChildVerifyCmd_FileInfoState(void)
 {
-    /* Arrange */
-    FM_GlobalData.ChildQueueCount = 1;
-    FM_GlobalData.ChildReadIndex  = FM_CHILD_QUEUE_DEPTH;
+    /* Arrange - the parent task only checked the name */
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_GET_FILE_INFO_CC, .FileInfoState = FM_NAME_IS_NOT_IN_USE};
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_GetFilenameState), FM_NAME_IS_FILE_CLOSED);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildLoop());
+    UtAssert_BOOL_TRUE(FM_ChildVerifyCmd(UT_FM_WORKER, &queue_entry));
 
     /* Assert */
-    UtAssert_STUB_COUNT(OS_CountSemTake, 1);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHILD_TERM_QIDX_ERR_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildCmdErrCounter, 1);
+    UtAssert_UINT32_EQ(queue_entry.FileInfoState, FM_NAME_IS_FILE_CLOSED);
+    UtAssert_STUB_COUNT(OS_stat, 1);
+    UtAssert_STUB_COUNT(FM_VerifyFileState, 0);
 }
 
-void Test_FM_ChildLoop_CountSemTakeSuccessDefault(void)
+void Test_FM_ChildVerifyCmd_FileDigest(void)
 {
     /* Arrange */
-    FM_GlobalData.ChildQueueCount    = 1;
-    FM_GlobalData.ChildReadIndex     = 0;
-    FM_ChildQueueEntry_t queue_entry = {.CommandCode = -1};
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_GET_FILE_DIGEST_CC, .Source1 = "source1"};
 
-    FM_GlobalData.ChildQueue[0] = queue_entry;
-    UT_SetDeferredRetcode(UT_KEY(OS_CountSemTake), 2, !CFE_SUCCESS);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileState), true);
 
     /* Act */
-    UtAssert_VOIDCALL(FM_ChildLoop());
+    UtAssert_BOOL_TRUE(FM_ChildVerifyCmd(UT_FM_WORKER, &queue_entry));
 
-    /* Assert */
-    UtAssert_STUB_COUNT(OS_CountSemTake, 2);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHILD_EXE_ERR_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_CHILD_TERM_SEM_ERR_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_ERROR);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildCmdErrCounter, 1);
+    /* Assert - the file is still closed */
+    UtAssert_STUB_COUNT(FM_VerifyFileState, 1);
 }
 
-/* ****************
- * ChildSleepStat Tests
- * ***************/
-
-void Test_FM_ChildSleepStat_getSizeTimeModeFalse(void)
+void Test_FM_ChildVerifyCmd_SetPermissions(void)
 {
     /* Arrange */
-    FM_DirListEntry_t DirListData    = {.EntrySize = 1, .ModifyTime = 1, .Mode = 1};
-    int32             FilesTillSleep = 1;
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_SET_PERMISSIONS_CC};
 
-    /* Assert */
-    UtAssert_VOIDCALL(FM_ChildSleepStat("fname", &DirListData, &FilesTillSleep, false));
-    UtAssert_INT32_EQ(DirListData.EntrySize, 0);
-    UtAssert_INT32_EQ(DirListData.ModifyTime, 0);
-    UtAssert_INT32_EQ(DirListData.Mode, 0);
+    /* Act */
+    UtAssert_BOOL_TRUE(FM_ChildVerifyCmd(UT_FM_WORKER, &queue_entry));
+
+    /* Assert - a valid name is all the command needs */
+    UtAssert_STUB_COUNT(FM_VerifyFileState, 0);
+    UtAssert_STUB_COUNT(FM_GetFilenameState, 0);
 }
 
-void Test_FM_ChildSleepStat_FilesTillSleepPositive(void)
+void Test_FM_ChildVerifyCmd_DeleteTree(void)
 {
     /* Arrange */
-    FM_DirListEntry_t DirListData           = {.EntrySize = 1, .ModifyTime = 1, .Mode = 1};
-    int32             FilesTillSleep        = FM_CHILD_STAT_SLEEP_FILECOUNT + 1;
-    int32             FilesTillSleep_before = FilesTillSleep;
+    FM_ChildQueueEntry_t queue_entry = {.CommandCode = FM_DELETE_TREE_CC, .Source1 = "dir"};
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileState), false);
+
+    /* Act */
+    UtAssert_BOOL_FALSE(FM_ChildVerifyCmd(UT_FM_WORKER, &queue_entry));
 
     /* Assert */
-    UtAssert_VOIDCALL(FM_ChildSleepStat("fname", &DirListData, &FilesTillSleep, true));
-    UtAssert_INT32_EQ(FilesTillSleep, FilesTillSleep_before - 1);
+    UtAssert_STUB_COUNT(FM_VerifyFileState, 1);
 }
 
-void Test_FM_ChildSleepStat_FilesTillSleepLTEQZero(void)
+void Test_FM_ChildVerifyCmd_FilterFiles(void)
 {
-    /* Arrange */
-    FM_DirListEntry_t DirListData    = {.EntrySize = 1, .ModifyTime = 1, .Mode = 1};
-    int32             FilesTillSleep = 0;
+    /* Arrange - the target directory of a copy is checked after the directory */
+    FM_ChildQueueEntry_t queue_entry = {
+        .CommandCode = FM_FILTER_FILES_CC, .FilterAction = FM_FILTER_ACTION_COPY, .Source1 = "dir", .Target = "tgt"};
+
+    UT_SetDeferredRetcode(UT_KEY(FM_VerifyFileState), 2, false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileState), true);
+
+    /* Act */
+    UtAssert_BOOL_FALSE(FM_ChildVerifyCmd(UT_FM_WORKER, &queue_entry));
 
     /* Assert */
-    UtAssert_VOIDCALL(FM_ChildSleepStat("fname", &DirListData, &FilesTillSleep, true));
-    UtAssert_STUB_COUNT(OS_TaskDelay, 1);
-    UtAssert_INT32_EQ(FilesTillSleep, FM_CHILD_STAT_SLEEP_FILECOUNT - 1);
+    UtAssert_STUB_COUNT(FM_VerifyFileState, 2);
 }
 
 /* * * * * * * * * * * * * *
@@ -2250,6 +6706,36 @@ void add_FM_ChildInit_tests(void)
     UtTest_Add(Test_FM_ChildInit_MutSemCreateNotSuccess, FM_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildInit_MutSemCreateNotSuccess");
 
+    UtTest_Add(Test_FM_ChildInit_DecompressMutSemCreateNotSuccess, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildInit_DecompressMutSemCreateNotSuccess");
+
+    UtTest_Add(Test_FM_ChildInit_ThrottleMutSemCreateNotSuccess, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildInit_ThrottleMutSemCreateNotSuccess");
+
+    UtTest_Add(Test_FM_ChildInit_TrashMutSemCreateNotSuccess, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildInit_TrashMutSemCreateNotSuccess");
+
+    UtTest_Add(Test_FM_ChildInit_CrcCacheMutSemCreateNotSuccess, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildInit_CrcCacheMutSemCreateNotSuccess");
+
+    UtTest_Add(Test_FM_ChildInit_CopyEmptySemCreateNotSuccess, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildInit_CopyEmptySemCreateNotSuccess");
+
+    UtTest_Add(Test_FM_ChildInit_CopyFilledSemCreateNotSuccess, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildInit_CopyFilledSemCreateNotSuccess");
+
+    UtTest_Add(Test_FM_ChildInit_CreateWriterTaskNotSuccess, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildInit_CreateWriterTaskNotSuccess");
+
+    UtTest_Add(Test_FM_ChildInit_CrcDoneSemCreateNotSuccess, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildInit_CrcDoneSemCreateNotSuccess");
+
+    UtTest_Add(Test_FM_ChildInit_CrcHelperMutSemCreateNotSuccess, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildInit_CrcHelperMutSemCreateNotSuccess");
+
+    UtTest_Add(Test_FM_ChildInit_CreateCrcHelperTaskNotSuccess, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildInit_CreateCrcHelperTaskNotSuccess");
+
     UtTest_Add(Test_FM_ChildInit_MuteSemCreateSuccess_CreateChildTaskNotSuccess, FM_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildInit_MuteSemCreateSuccess_CreateChildTaskNotSuccess");
 
@@ -2259,10 +6745,81 @@ void add_FM_ChildInit_tests(void)
 void add_FM_ChildTask_tests(void)
 {
     UtTest_Add(Test_FM_ChildTask_ChildLoopCalled, FM_Test_Setup, FM_Test_Teardown, "FM_ChildTask_ChildLoopCalled");
+
+    UtTest_Add(Test_FM_ChildTask_OtherWorkerRunning, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildTask_OtherWorkerRunning");
+
+    UtTest_Add(Test_FM_ChildTask_LastWorker, FM_Test_Setup, FM_Test_Teardown, "Test_FM_ChildTask_LastWorker");
+
+    UtTest_Add(Test_FM_ChildTask_NoWorkerSlot, FM_Test_Setup, FM_Test_Teardown, "Test_FM_ChildTask_NoWorkerSlot");
+}
+
+void add_FM_ChildWriterTask_tests(void)
+{
+    UtTest_Add(Test_FM_ChildWriterTask_WriterLoopReturns, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildWriterTask_WriterLoopReturns");
+
+    UtTest_Add(Test_FM_ChildWriterTask_NoWorkerSlot, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildWriterTask_NoWorkerSlot");
+
+    UtTest_Add(Test_FM_ChildWriterLoop_DrainInFillOrder, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildWriterLoop_DrainInFillOrder");
+}
+
+void add_FM_ChildCrcHelperTask_tests(void)
+{
+    UtTest_Add(Test_FM_ChildCrcHelperTask_HelperLoopReturns, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCrcHelperTask_HelperLoopReturns");
+
+    UtTest_Add(Test_FM_ChildCrcHelperTask_RangePending, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCrcHelperTask_RangePending");
+
+    UtTest_Add(Test_FM_ChildCrcHelperTask_NoHelperSlot, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCrcHelperTask_NoHelperSlot");
+
+    UtTest_Add(Test_FM_ChildCrcHelperLoop_OneRange, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCrcHelperLoop_OneRange");
 }
 
 void add_FM_ChildProcess_tests(void)
 {
+    UtTest_Add(Test_FM_ChildSelectLane_FastFirst, FM_Test_Setup, FM_Test_Teardown, "Test_FM_ChildSelectLane_FastFirst");
+    UtTest_Add(Test_FM_ChildSelectLane_BurstLimit, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildSelectLane_BurstLimit");
+    UtTest_Add(Test_FM_ChildSelectLane_BurstLimitSameNames, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildSelectLane_BurstLimitSameNames");
+    UtTest_Add(Test_FM_ChildSelectLane_BulkEmpty, FM_Test_Setup, FM_Test_Teardown, "Test_FM_ChildSelectLane_BulkEmpty");
+    UtTest_Add(Test_FM_ChildSelectLane_FastEmpty, FM_Test_Setup, FM_Test_Teardown, "Test_FM_ChildSelectLane_FastEmpty");
+    UtTest_Add(Test_FM_ChildLoadPath_Empty, FM_Test_Setup, FM_Test_Teardown, "Test_FM_ChildLoadPath_Empty");
+    UtTest_Add(Test_FM_ChildLoadPath_Chain, FM_Test_Setup, FM_Test_Teardown, "Test_FM_ChildLoadPath_Chain");
+    UtTest_Add(Test_FM_ChildLoadPath_Truncated, FM_Test_Setup, FM_Test_Teardown, "Test_FM_ChildLoadPath_Truncated");
+    UtTest_Add(Test_FM_ChildClaimPaths_SkipsZero, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildClaimPaths_SkipsZero");
+#if (FM_CHILD_TASK_COUNT > 1)
+    UtTest_Add(Test_FM_ChildPathsBusy_EarlierOverlap, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildPathsBusy_EarlierOverlap");
+    UtTest_Add(Test_FM_ChildPathsBusy_EarlierNoOverlap, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildPathsBusy_EarlierNoOverlap");
+    UtTest_Add(Test_FM_ChildPathsBusy_LaterOrIdle, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildPathsBusy_LaterOrIdle");
+#endif
+    UtTest_Add(Test_FM_ChildPathsBusy_OwnCommand, FM_Test_Setup, FM_Test_Teardown, "Test_FM_ChildPathsBusy_OwnCommand");
+    UtTest_Add(Test_FM_ChildWaitForPaths_Free, FM_Test_Setup, FM_Test_Teardown, "Test_FM_ChildWaitForPaths_Free");
+#if (FM_CHILD_TASK_COUNT > 1)
+    UtTest_Add(Test_FM_ChildWaitForPaths_Busy, FM_Test_Setup, FM_Test_Teardown, "Test_FM_ChildWaitForPaths_Busy");
+#endif
+    UtTest_Add(Test_FM_ChildReleasePaths, FM_Test_Setup, FM_Test_Teardown, "Test_FM_ChildReleasePaths");
+    UtTest_Add(Test_FM_ChildProcess_DequeueToWorker, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildProcess_DequeueToWorker");
+#if (FM_CHILD_TASK_COUNT > 1)
+    UtTest_Add(Test_FM_ChildProcess_WaitsForEarlierCommand, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildProcess_WaitsForEarlierCommand");
+#endif
+    UtTest_Add(Test_FM_ChildProcess_FlushedSlotSkipped, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildProcess_FlushedSlotSkipped");
+    UtTest_Add(Test_FM_ChildProcess_CmdSequenceSkipsZero, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildProcess_CmdSequenceSkipsZero");
+
     UtTest_Add(Test_FM_ChildProcess_FMCopyCC, FM_Test_Setup, FM_Test_Teardown, "Test_FM_ChildProcess_FMCopyCC");
 
     UtTest_Add(Test_FM_ChildProcess_FMMoveCC, FM_Test_Setup, FM_Test_Teardown, "Test_FM_ChildProcess_FMMoveCC");
@@ -2279,14 +6836,29 @@ void add_FM_ChildProcess_tests(void)
 
     UtTest_Add(Test_FM_ChildProcess_FMConcatCC, FM_Test_Setup, FM_Test_Teardown, "Test_FM_ChildProcess_FMConcatCC");
 
+    UtTest_Add(Test_FM_ChildProcess_FMConcatListCC, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildProcess_FMConcatListCC");
+
     UtTest_Add(Test_FM_ChildProcess_FMCreateDirCC, FM_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildProcess_FMCreateDirCC");
 
     UtTest_Add(Test_FM_ChildProcess_FMDeleteDirCC, FM_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildProcess_FMDeleteDirCC");
 
+    UtTest_Add(Test_FM_ChildProcess_FMDeleteTreeCC, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildProcess_FMDeleteTreeCC");
+    UtTest_Add(Test_FM_ChildProcess_FMFilterFilesCC, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildProcess_FMFilterFilesCC");
+    UtTest_Add(Test_FM_ChildProcess_FMEnforceRetentionCC, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildProcess_FMEnforceRetentionCC");
+
+    UtTest_Add(Test_FM_ChildProcess_FMPurgeTrashCC, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildProcess_FMPurgeTrashCC");
+
     UtTest_Add(Test_FM_ChildProcess_FMGetFileInfoCC, FM_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildProcess_FMGetFileInfoCC");
+    UtTest_Add(Test_FM_ChildProcess_FMGetFileDigestCC, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildProcess_FMGetFileDigestCC");
 
     UtTest_Add(Test_FM_ChildProcess_FMGetDirListsFileCC, FM_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildProcess_FMGetDirListsFileCC");
@@ -2300,25 +6872,34 @@ void add_FM_ChildProcess_tests(void)
     UtTest_Add(Test_FM_ChildProcess_DefaultSwitch, FM_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildProcess_DefaultSwitch");
 
+    UtTest_Add(Test_FM_ChildProcess_ChildVerifyFails, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildProcess_ChildVerifyFails");
+
     UtTest_Add(Test_FM_ChildProcess_ChildReadIndexGreaterChildQDepth, FM_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildProcess_ChildReadIndexGreaterChildQDepth");
 }
 
 void add_FM_ChildCopyCmd_tests(void)
 {
-    UtTest_Add(Test_FM_ChildCopyCmd_OScpIsSuccess, FM_Test_Setup, FM_Test_Teardown,
-               "Test_FM_ChildCopyCmd_OScpIsSuccess");
+    UtTest_Add(Test_FM_ChildCopyCmd_CopySuccess, FM_Test_Setup, FM_Test_Teardown, "Test_FM_ChildCopyCmd_CopySuccess");
 
-    UtTest_Add(Test_FM_ChildCopyCmd_OScpNotSuccess, FM_Test_Setup, FM_Test_Teardown,
-               "Test_FM_ChildCopyCmd_OScpNotSuccess");
+    UtTest_Add(Test_FM_ChildCopyCmd_CopyNotSuccess, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCopyCmd_CopyNotSuccess");
 }
 
 void add_FM_ChildMoveCmd_tests(void)
 {
-    UtTest_Add(Test_FM_ChildMoveCmd_OSmvNotSuccess, FM_Test_Setup, FM_Test_Teardown,
-               "Test_FM_ChildMoveCmd_OSmvNotSuccess");
+    UtTest_Add(Test_FM_ChildMoveCmd_OSRenameNotSuccess_CopyNotSuccess, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildMoveCmd_OSRenameNotSuccess_CopyNotSuccess");
+
+    UtTest_Add(Test_FM_ChildMoveCmd_OSRenameNotSuccess_CopySuccess, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildMoveCmd_OSRenameNotSuccess_CopySuccess");
 
-    UtTest_Add(Test_FM_ChildMoveCmd_OSmvSuccess, FM_Test_Setup, FM_Test_Teardown, "Test_FM_ChildMoveCmd_OSmvSuccess");
+    UtTest_Add(Test_FM_ChildMoveCmd_OSRemoveNotSuccess, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildMoveCmd_OSRemoveNotSuccess");
+
+    UtTest_Add(Test_FM_ChildMoveCmd_OSRenameSuccess, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildMoveCmd_OSRenameSuccess");
 }
 
 void add_FM_ChildRenameCmd_tests(void)
@@ -2373,9 +6954,37 @@ void add_FM_ChildDeleteAllFilesCmd_tests(void)
 
     UtTest_Add(Test_FM_ChildDeleteAllFilesCmd_ClosedFilename_OSrmSuccess, FM_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildDeleteAllFilesCmd_ClosedFilename_OSrmSuccess");
+    UtTest_Add(Test_FM_ChildDeleteAllFilesCmd_Aborted, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDeleteAllFilesCmd_Aborted");
 
     UtTest_Add(Test_FM_ChildDeleteAllFilesCmd_FilenameStateDefaultReturn, FM_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildDeleteAllFilesCmd_FilenameStateDefaultReturn");
+
+    UtTest_Add(Test_FM_ChildDeleteAllFilesCmd_OffsetDirectory, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDeleteAllFilesCmd_OffsetDirectory");
+
+    UtTest_Add(Test_FM_ChildDeleteAllCollect_ClosedFiles, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDeleteAllCollect_ClosedFiles");
+
+    UtTest_Add(Test_FM_ChildDeleteAllCollect_ListFull, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDeleteAllCollect_ListFull");
+
+    UtTest_Add(Test_FM_ChildDeleteAllCollect_Descend, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDeleteAllCollect_Descend");
+
+    UtTest_Add(Test_FM_ChildDeleteAllRemove_Batch, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDeleteAllRemove_Batch");
+    UtTest_Add(Test_FM_ChildDeleteAllRemove_OpenedSinceCollect, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDeleteAllRemove_OpenedSinceCollect");
+
+    UtTest_Add(Test_FM_ChildDeleteAllRemove_Aborted, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDeleteAllRemove_Aborted");
+
+    UtTest_Add(Test_FM_ChildDirectoryNext_Skip, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDirectoryNext_Skip");
+
+    UtTest_Add(Test_FM_ChildDirectoryRestart, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDirectoryRestart");
 }
 
 void add_FM_ChildDecompressFileCmd_tests(void)
@@ -2389,8 +6998,8 @@ void add_FM_ChildDecompressFileCmd_tests(void)
 
 void add_FM_ChildConcatFilesCmd_tests(void)
 {
-    UtTest_Add(Test_FM_ChildConcatFilesCmd_OSCpNotSuccess, FM_Test_Setup, FM_Test_Teardown,
-               "Test_FM_ChildConcatFilesCmd_OSCpNotSuccess");
+    UtTest_Add(Test_FM_ChildConcatFilesCmd_CopySource1NotSuccess, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildConcatFilesCmd_CopySource1NotSuccess");
 
     UtTest_Add(Test_FM_ChildConcatFilesCmd_OSOpenCreateSourceNotSuccess, FM_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildConcatFilesCmd_OSOpenCreateSourceNotSuccess");
@@ -2407,8 +7016,47 @@ void add_FM_ChildConcatFilesCmd_tests(void)
     UtTest_Add(Test_FM_ChildConcatFilesCmd_BytesWrittenNotEqualBytesRead, FM_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildConcatFilesCmd_BytesWrittenNotEqualBytesRead");
 
-    UtTest_Add(Test_FM_ChildConcatFilesCmd_CopyInProgressTrueLoopCountEqualChildFileLoopCount, FM_Test_Setup,
-               FM_Test_Teardown, "Test_FM_ChildConcatFilesCmd_CopyInProgressTrueLoopCountEqualChildFileLoopCount");
+    UtTest_Add(Test_FM_ChildConcatFilesCmd_ThrottleEachBlock, FM_Test_Setup,
+               FM_Test_Teardown, "Test_FM_ChildConcatFilesCmd_ThrottleEachBlock");
+
+    UtTest_Add(Test_FM_ChildConcatFilesCmd_KernelCopySuccess, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildConcatFilesCmd_KernelCopySuccess");
+
+    UtTest_Add(Test_FM_ChildConcatFilesCmd_KernelAppendNotSuccess, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildConcatFilesCmd_KernelAppendNotSuccess");
+}
+
+void add_FM_ChildConcatListCmd_tests(void)
+{
+    UtTest_Add(Test_FM_ChildConcatListCmd_InlineSuccess, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildConcatListCmd_InlineSuccess");
+
+    UtTest_Add(Test_FM_ChildConcatListCmd_ListFileSuccess, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildConcatListCmd_ListFileSuccess");
+
+    UtTest_Add(Test_FM_ChildConcatListCmd_OpenListNotSuccess, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildConcatListCmd_OpenListNotSuccess");
+
+    UtTest_Add(Test_FM_ChildConcatListCmd_OpenTargetNotSuccess, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildConcatListCmd_OpenTargetNotSuccess");
+
+    UtTest_Add(Test_FM_ChildConcatListCmd_OpenSourceNotSuccess, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildConcatListCmd_OpenSourceNotSuccess");
+
+    UtTest_Add(Test_FM_ChildConcatListCmd_SourceIsTarget, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildConcatListCmd_SourceIsTarget");
+
+    UtTest_Add(Test_FM_ChildConcatListCmd_EmptyList, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildConcatListCmd_EmptyList");
+
+    UtTest_Add(Test_FM_ChildConcatListCmd_ResumeListEndsBeforeCheckpoint, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildConcatListCmd_ResumeListEndsBeforeCheckpoint");
+
+    UtTest_Add(Test_FM_ChildConcatListNext_NameTooLong, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildConcatListNext_NameTooLong");
+
+    UtTest_Add(Test_FM_ChildConcatListNext_ReadNotSuccess, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildConcatListNext_ReadNotSuccess");
 }
 
 void add_FM_ChildFileInfoCmd_tests(void)
@@ -2439,6 +7087,57 @@ void add_FM_ChildFileInfoCmd_tests(void)
 
     UtTest_Add(Test_FM_ChildFileInfoCmd_BytesReadGreaterThanZero, FM_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildFileInfoCmd_BytesReadGreaterThanZero");
+    UtTest_Add(Test_FM_ChildFileInfoCmd_Aborted, FM_Test_Setup, FM_Test_Teardown, "Test_FM_ChildFileInfoCmd_Aborted");
+    UtTest_Add(Test_FM_ChildFileInfoCmd_CrcCacheHit, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildFileInfoCmd_CrcCacheHit");
+    UtTest_Add(Test_FM_ChildFileInfoCmd_CrcCacheChanged, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildFileInfoCmd_CrcCacheChanged");
+    UtTest_Add(Test_FM_ChildFileInfoCmd_CrcCacheStore, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildFileInfoCmd_CrcCacheStore");
+    UtTest_Add(Test_FM_ChildFileInfoCmd_CrcCacheRecentlyModified, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildFileInfoCmd_CrcCacheRecentlyModified");
+    UtTest_Add(Test_FM_ChildCrcCacheStore_Replace, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCrcCacheStore_Replace");
+    UtTest_Add(Test_FM_ChildCrcCacheStore_CheckCrc, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCrcCacheStore_CheckCrc");
+    UtTest_Add(Test_FM_ChildCrcCacheStore_ShortFinalRead, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCrcCacheStore_ShortFinalRead");
+    UtTest_Add(Test_FM_ChildCrcCacheStore_NotReadToSize, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCrcCacheStore_NotReadToSize");
+    UtTest_Add(Test_FM_ChildCrcCacheBase_Conditions, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCrcCacheBase_Conditions");
+    UtTest_Add(Test_FM_ChildCrcResume_Appended, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCrcResume_Appended");
+    UtTest_Add(Test_FM_ChildCrcResume_Rewritten, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCrcResume_Rewritten");
+    UtTest_Add(Test_FM_ChildFileInfoCmd_CrcAppended, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildFileInfoCmd_CrcAppended");
+    UtTest_Add(Test_FM_ChildFileInfoCmd_CrcAppendFails, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildFileInfoCmd_CrcAppendFails");
+    UtTest_Add(Test_FM_ChildFileInfoCmd_CrcParallel, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildFileInfoCmd_CrcParallel");
+    UtTest_Add(Test_FM_ChildFileInfoCmd_CrcParallelFails, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildFileInfoCmd_CrcParallelFails");
+    UtTest_Add(Test_FM_ChildFileInfoCmd_CrcParallelAborted, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildFileInfoCmd_CrcParallelAborted");
+    UtTest_Add(Test_FM_ChildCrcParallel_Split, FM_Test_Setup, FM_Test_Teardown, "Test_FM_ChildCrcParallel_Split");
+    UtTest_Add(Test_FM_ChildCrcParallel_Shrunk, FM_Test_Setup, FM_Test_Teardown, "Test_FM_ChildCrcParallel_Shrunk");
+    UtTest_Add(Test_FM_ChildCrcParallel_NotSplit, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCrcParallel_NotSplit");
+    UtTest_Add(Test_FM_ChildCrcRange_Offset, FM_Test_Setup, FM_Test_Teardown, "Test_FM_ChildCrcRange_Offset");
+    UtTest_Add(Test_FM_ChildCrcRange_Fails, FM_Test_Setup, FM_Test_Teardown, "Test_FM_ChildCrcRange_Fails");
+}
+
+void add_FM_ChildFileDigestCmd_tests(void)
+{
+    UtTest_Add(Test_FM_ChildFileDigestCmd_Success, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildFileDigestCmd_Success");
+    UtTest_Add(Test_FM_ChildFileDigestCmd_OpenFails, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildFileDigestCmd_OpenFails");
+    UtTest_Add(Test_FM_ChildFileDigestCmd_ReadFails, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildFileDigestCmd_ReadFails");
+    UtTest_Add(Test_FM_ChildFileDigestCmd_Aborted, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildFileDigestCmd_Aborted");
 }
 
 void add_FM_ChildCreateDirectoryCmd_tests(void)
@@ -2471,6 +7170,88 @@ void add_FM_ChildDeleteDirectoryCmd_tests(void)
                "Test_FM_ChildDeleteDirectoryCmd_RemoveDirTrueOSRmDirNotSuccess");
 }
 
+void add_FM_ChildDeleteTreeCmd_tests(void)
+{
+    UtTest_Add(Test_FM_ChildDeleteTreeCmd_Nested, FM_Test_Setup, FM_Test_Teardown, "Test_FM_ChildDeleteTreeCmd_Nested");
+    UtTest_Add(Test_FM_ChildDeleteTreeCmd_OpenFile, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDeleteTreeCmd_OpenFile");
+    UtTest_Add(Test_FM_ChildDeleteTreeCmd_Aborted, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDeleteTreeCmd_Aborted");
+    UtTest_Add(Test_FM_ChildDeleteTreeScan_OpenFails, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDeleteTreeScan_OpenFails");
+
+    UtTest_Add(Test_FM_ChildDeleteTreeScan_OffsetDirectory, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDeleteTreeScan_OffsetDirectory");
+    UtTest_Add(Test_FM_ChildDeleteTreePush_Full, FM_Test_Setup, FM_Test_Teardown, "Test_FM_ChildDeleteTreePush_Full");
+}
+
+void add_FM_ChildRetentionCmd_tests(void)
+{
+    UtTest_Add(Test_FM_ChildRetentionCmd_EvictOldest, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildRetentionCmd_EvictOldest");
+    UtTest_Add(Test_FM_ChildRetentionCmd_StillOver, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildRetentionCmd_StillOver");
+    UtTest_Add(Test_FM_ChildRetentionCmd_OpenFails, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildRetentionCmd_OpenFails");
+    UtTest_Add(Test_FM_ChildRetentionOffer_Bounded, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildRetentionOffer_Bounded");
+    UtTest_Add(Test_FM_ChildRetentionPriority, FM_Test_Setup, FM_Test_Teardown, "Test_FM_ChildRetentionPriority");
+    UtTest_Add(Test_FM_ChildRetentionAbove, FM_Test_Setup, FM_Test_Teardown, "Test_FM_ChildRetentionAbove");
+    UtTest_Add(Test_FM_ChildRetentionEvict_OpenFile, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildRetentionEvict_OpenFile");
+    UtTest_Add(Test_FM_ChildRetentionOver, FM_Test_Setup, FM_Test_Teardown, "Test_FM_ChildRetentionOver");
+}
+
+void add_FM_ChildPurgeCmd_tests(void)
+{
+    UtTest_Add(Test_FM_ChildPurgeCmd_Commanded, FM_Test_Setup, FM_Test_Teardown, "Test_FM_ChildPurgeCmd_Commanded");
+    UtTest_Add(Test_FM_ChildPurgeCmd_NotPurged, FM_Test_Setup, FM_Test_Teardown, "Test_FM_ChildPurgeCmd_NotPurged");
+    UtTest_Add(Test_FM_ChildPurgeCmd_OpenFails, FM_Test_Setup, FM_Test_Teardown, "Test_FM_ChildPurgeCmd_OpenFails");
+    UtTest_Add(Test_FM_ChildPurgeCmd_NotPending, FM_Test_Setup, FM_Test_Teardown, "Test_FM_ChildPurgeCmd_NotPending");
+    UtTest_Add(Test_FM_ChildPurgeCmd_Budget, FM_Test_Setup, FM_Test_Teardown, "Test_FM_ChildPurgeCmd_Budget");
+    UtTest_Add(Test_FM_ChildPurgeCollect_MaxCount, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildPurgeCollect_MaxCount");
+
+    UtTest_Add(Test_FM_ChildPurgeVolume_OffsetDirectory, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildPurgeVolume_OffsetDirectory");
+}
+
+void add_FM_ChildTrash_tests(void)
+{
+    UtTest_Add(Test_FM_ChildTrashFile_DirectMode, FM_Test_Setup, FM_Test_Teardown, "Test_FM_ChildTrashFile_DirectMode");
+    UtTest_Add(Test_FM_ChildTrashFile_Renamed, FM_Test_Setup, FM_Test_Teardown, "Test_FM_ChildTrashFile_Renamed");
+    UtTest_Add(Test_FM_ChildTrashFile_RenameFails, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildTrashFile_RenameFails");
+    UtTest_Add(Test_FM_ChildDeleteCmd_Trashed, FM_Test_Setup, FM_Test_Teardown, "Test_FM_ChildDeleteCmd_Trashed");
+    UtTest_Add(Test_FM_ChildTrashVolume_NoVolume, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildTrashVolume_NoVolume");
+    UtTest_Add(Test_FM_ChildTrashVolume_InTrash, FM_Test_Setup, FM_Test_Teardown, "Test_FM_ChildTrashVolume_InTrash");
+    UtTest_Add(Test_FM_ChildTrashVolume_Claim, FM_Test_Setup, FM_Test_Teardown, "Test_FM_ChildTrashVolume_Claim");
+    UtTest_Add(Test_FM_ChildTrashVolume_NotDirectory, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildTrashVolume_NotDirectory");
+    UtTest_Add(Test_FM_ChildTrashVolume_Full, FM_Test_Setup, FM_Test_Teardown, "Test_FM_ChildTrashVolume_Full");
+}
+
+void add_FM_ChildFilterFilesCmd_tests(void)
+{
+    UtTest_Add(Test_FM_ChildFilterFilesCmd_Delete, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildFilterFilesCmd_Delete");
+    UtTest_Add(Test_FM_ChildFilterFilesCmd_MoveTargetExists, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildFilterFilesCmd_MoveTargetExists");
+    UtTest_Add(Test_FM_ChildFilterFilesCmd_OpenFails, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildFilterFilesCmd_OpenFails");
+    UtTest_Add(Test_FM_ChildFilterCollect_OpenFile, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildFilterCollect_OpenFile");
+    UtTest_Add(Test_FM_ChildFilterPass_Limits, FM_Test_Setup, FM_Test_Teardown, "Test_FM_ChildFilterPass_Limits");
+    UtTest_Add(Test_FM_ChildFilterApply_Copy, FM_Test_Setup, FM_Test_Teardown, "Test_FM_ChildFilterApply_Copy");
+    UtTest_Add(Test_FM_ChildFilterApply_OpenedSinceCollect, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildFilterApply_OpenedSinceCollect");
+    UtTest_Add(Test_FM_ChildFilterTransfer_MoveAcrossVolumes, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildFilterTransfer_MoveAcrossVolumes");
+    UtTest_Add(Test_FM_ChildFilterTransfer_SameFile, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildFilterTransfer_SameFile");
+}
+
 void add_FM_ChildDirListFileCmd_tests(void)
 {
     UtTest_Add(Test_FM_ChildDirListFileCmd_OSDirOpenNotSuccess, FM_Test_Setup, FM_Test_Teardown,
@@ -2481,6 +7262,8 @@ void add_FM_ChildDirListFileCmd_tests(void)
 
     UtTest_Add(Test_FM_ChildDirListFileCmd_ChildDirListFileInitTrue, FM_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildDirListFileCmd_ChildDirListFileInitTrue");
+    UtTest_Add(Test_FM_ChildDirListFileCmd_Aborted, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDirListFileCmd_Aborted");
 }
 
 void add_FM_ChildDirListPktCmd_tests(void)
@@ -2499,6 +7282,8 @@ void add_FM_ChildDirListPktCmd_tests(void)
 
     UtTest_Add(Test_FM_ChildDirListPktCmd_DirListOffsetNotExceeded, FM_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildDirListPktCmd_DirListOffsetNotExceeded");
+    UtTest_Add(Test_FM_ChildDirListPktCmd_Aborted, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDirListPktCmd_Aborted");
 
     UtTest_Add(Test_FM_ChildDirListPktCmd_DirListOffsetExceeded, FM_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildDirListPktCmd_DirListOffsetExceeded");
@@ -2535,6 +7320,8 @@ void add_FM_ChildDirListFileLoop_tests(void)
 {
     UtTest_Add(Test_FM_ChildDirListFileLoop_OSDirReadNotSuccess, FM_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildDirListFileLoop_OSDirReadNotSuccess");
+    UtTest_Add(Test_FM_ChildDirListFileLoop_Aborted, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildDirListFileLoop_Aborted");
 
     UtTest_Add(Test_FM_ChildDirListFileLoop_OSDirEntryNameIsThisDirectory, FM_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildDirListFileLoop_OSDirEntryNameIsThisDirectory");
@@ -2555,6 +7342,65 @@ void add_FM_ChildDirListFileLoop_tests(void)
                "Test_FM_ChildDirListFileLoop_BytesWrittenNotEqualWriteLengthInLoop");
 }
 
+void add_FM_ChildCopyFile_tests(void)
+{
+    UtTest_Add(Test_FM_ChildCopyFile_OpenSourceNotSuccess, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCopyFile_OpenSourceNotSuccess");
+
+    UtTest_Add(Test_FM_ChildCopyFile_OpenTargetNotSuccess, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCopyFile_OpenTargetNotSuccess");
+
+    UtTest_Add(Test_FM_ChildCopyFile_ReadNotSuccess, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCopyFile_ReadNotSuccess");
+
+    UtTest_Add(Test_FM_ChildCopyFile_WriteNotSuccess, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCopyFile_WriteNotSuccess");
+
+    UtTest_Add(Test_FM_ChildCopyFile_LargeBlocks, FM_Test_Setup, FM_Test_Teardown, "Test_FM_ChildCopyFile_LargeBlocks");
+
+    UtTest_Add(Test_FM_ChildCopyFile_ThrottleEachBlock, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCopyFile_ThrottleEachBlock");
+
+    UtTest_Add(Test_FM_ChildCopyFile_Unthrottled, FM_Test_Setup, FM_Test_Teardown, "Test_FM_ChildCopyFile_Unthrottled");
+
+    UtTest_Add(Test_FM_ChildCopyFile_KernelCopySuccess, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCopyFile_KernelCopySuccess");
+
+    UtTest_Add(Test_FM_ChildCopyFile_KernelCopyNotSuccess, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCopyFile_KernelCopyNotSuccess");
+}
+
+void add_FM_ChildKernelCopy_tests(void)
+{
+    UtTest_Add(Test_FM_ChildKernelCopy_NotImplemented, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildKernelCopy_NotImplemented");
+
+    UtTest_Add(Test_FM_ChildKernelCopy_ThrottleEachChunk, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildKernelCopy_ThrottleEachChunk");
+
+    UtTest_Add(Test_FM_ChildKernelCopy_ChunkNotImplemented, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildKernelCopy_ChunkNotImplemented");
+
+    UtTest_Add(Test_FM_ChildKernelCopy_ChunkNotSuccess, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildKernelCopy_ChunkNotSuccess");
+    UtTest_Add(Test_FM_ChildKernelCopy_Aborted, FM_Test_Setup, FM_Test_Teardown, "Test_FM_ChildKernelCopy_Aborted");
+}
+
+void add_FM_ChildCopyStream_tests(void)
+{
+    UtTest_Add(Test_FM_ChildCopyStream_Pipelined, FM_Test_Setup, FM_Test_Teardown, "Test_FM_ChildCopyStream_Pipelined");
+
+    UtTest_Add(Test_FM_ChildCopyStream_PipelinedSemTakeNotSuccess, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCopyStream_PipelinedSemTakeNotSuccess");
+
+    UtTest_Add(Test_FM_ChildCopyStream_WriteEventID, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCopyStream_WriteEventID");
+    UtTest_Add(Test_FM_ChildCopyStream_Aborted, FM_Test_Setup, FM_Test_Teardown, "Test_FM_ChildCopyStream_Aborted");
+
+    UtTest_Add(Test_FM_ChildCopyWrite_SkipAfterFailedWrite, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCopyWrite_SkipAfterFailedWrite");
+}
+
 void add_FM_ChildSizeTimeMode_tests(void)
 {
     UtTest_Add(Test_FM_ChildSizeTimeMode_OsStatNoSuccess, FM_Test_Setup, FM_Test_Teardown,
@@ -2569,11 +7415,124 @@ void add_FM_ChildSleepStat_tests(void)
     UtTest_Add(Test_FM_ChildSleepStat_getSizeTimeModeFalse, FM_Test_Setup, FM_Test_Teardown,
                "Test_FM_ChildSleepStat_getSizeTimeModeFalse");
 
-    UtTest_Add(Test_FM_ChildSleepStat_FilesTillSleepPositive, FM_Test_Setup, FM_Test_Teardown,
-               "Test_FM_ChildSleepStat_FilesTillSleepPositive");
+    UtTest_Add(Test_FM_ChildSleepStat_Unthrottled, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildSleepStat_Unthrottled");
+
+    UtTest_Add(Test_FM_ChildSleepStat_OverStatRate, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildSleepStat_OverStatRate");
+}
+
+void add_FM_ChildThrottle_tests(void)
+{
+    UtTest_Add(Test_FM_ChildThrottle_Unlimited, FM_Test_Setup, FM_Test_Teardown, "Test_FM_ChildThrottle_Unlimited");
+
+    UtTest_Add(Test_FM_ChildThrottle_ChargeBothVolumes, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildThrottle_ChargeBothVolumes");
+
+    UtTest_Add(Test_FM_ChildThrottle_ChargeSameVolumeOnce, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildThrottle_ChargeSameVolumeOnce");
+
+    UtTest_Add(Test_FM_ChildThrottleSelect_LongestVolume, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildThrottleSelect_LongestVolume");
+
+    UtTest_Add(Test_FM_ChildThrottleCharge_FollowDefaultRate, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildThrottleCharge_FollowDefaultRate");
 
-    UtTest_Add(Test_FM_ChildSleepStat_FilesTillSleepLTEQZero, FM_Test_Setup, FM_Test_Teardown,
-               "Test_FM_ChildSleepStat_FilesTillSleepLTEQZero");
+    UtTest_Add(Test_FM_ChildThrottleBucket_Unlimited, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildThrottleBucket_Unlimited");
+
+    UtTest_Add(Test_FM_ChildThrottleBucket_RefillToBurst, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildThrottleBucket_RefillToBurst");
+
+    UtTest_Add(Test_FM_ChildThrottleBucket_WithinBurst, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildThrottleBucket_WithinBurst");
+
+    UtTest_Add(Test_FM_ChildThrottleBucket_OverRate, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildThrottleBucket_OverRate");
+
+    UtTest_Add(Test_FM_ChildThrottleBucket_PartialMillisecond, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildThrottleBucket_PartialMillisecond");
+}
+
+void add_FM_ChildAbortCheck_tests(void)
+{
+    UtTest_Add(Test_FM_ChildAbortCheck_NoRequest, FM_Test_Setup, FM_Test_Teardown, "Test_FM_ChildAbortCheck_NoRequest");
+    UtTest_Add(Test_FM_ChildAbortCheck_Requested, FM_Test_Setup, FM_Test_Teardown, "Test_FM_ChildAbortCheck_Requested");
+    UtTest_Add(Test_FM_ChildAbortCheck_StaleRequest, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildAbortCheck_StaleRequest");
+    UtTest_Add(Test_FM_ChildAbortCheck_SequenceZero, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildAbortCheck_SequenceZero");
+}
+
+void add_FM_ChildCheckpoint_tests(void)
+{
+    UtTest_Add(Test_FM_ChildCheckpointResume_NoFile, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCheckpointResume_NoFile");
+    UtTest_Add(Test_FM_ChildCheckpointResume_InvalidFile, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCheckpointResume_InvalidFile");
+    UtTest_Add(Test_FM_ChildCheckpointResume_UnknownCommand, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCheckpointResume_UnknownCommand");
+    UtTest_Add(Test_FM_ChildCheckpointResume_CopyRecord, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCheckpointResume_CopyRecord");
+    UtTest_Add(Test_FM_ChildCheckpointBegin_NewCommand, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCheckpointBegin_NewCommand");
+    UtTest_Add(Test_FM_ChildCheckpointBegin_Resuming, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCheckpointBegin_Resuming");
+    UtTest_Add(Test_FM_ChildCheckpointSource_NewSource, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCheckpointSource_NewSource");
+    UtTest_Add(Test_FM_ChildCheckpointSource_BeyondMaxOffset, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCheckpointSource_BeyondMaxOffset");
+    UtTest_Add(Test_FM_ChildCheckpointSource_ResumeMatch, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCheckpointSource_ResumeMatch");
+    UtTest_Add(Test_FM_ChildCheckpointSource_ResumeMismatch, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCheckpointSource_ResumeMismatch");
+    UtTest_Add(Test_FM_ChildCheckpointSource_ResumeWrongSource, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCheckpointSource_ResumeWrongSource");
+    UtTest_Add(Test_FM_ChildCheckpointSeek_Success, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCheckpointSeek_Success");
+    UtTest_Add(Test_FM_ChildCheckpointSeek_SeekNotSuccess, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCheckpointSeek_SeekNotSuccess");
+    UtTest_Add(Test_FM_ChildCheckpointSave_Disabled, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCheckpointSave_Disabled");
+    UtTest_Add(Test_FM_ChildCheckpointSave_NotDue, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCheckpointSave_NotDue");
+    UtTest_Add(Test_FM_ChildCheckpointSave_Due, FM_Test_Setup, FM_Test_Teardown, "Test_FM_ChildCheckpointSave_Due");
+    UtTest_Add(Test_FM_ChildCheckpointSave_BeyondMaxOffset, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCheckpointSave_BeyondMaxOffset");
+    UtTest_Add(Test_FM_ChildCheckpointSave_OpenNotSuccess, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCheckpointSave_OpenNotSuccess");
+    UtTest_Add(Test_FM_ChildCheckpointSave_WriteNotSuccess, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCheckpointSave_WriteNotSuccess");
+    UtTest_Add(Test_FM_ChildCheckpointEnd_Saved, FM_Test_Setup, FM_Test_Teardown, "Test_FM_ChildCheckpointEnd_Saved");
+    UtTest_Add(Test_FM_ChildCheckpointEnd_NotSaved, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCheckpointEnd_NotSaved");
+    UtTest_Add(Test_FM_ChildCheckpointName_WorkerIndex, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildCheckpointName_WorkerIndex");
+}
+
+void add_FM_ChildProgress_tests(void)
+{
+    UtTest_Add(Test_FM_ChildProgressBegin_CommandArgs, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildProgressBegin_CommandArgs");
+    UtTest_Add(Test_FM_ChildProgressSource_AddsToTotal, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildProgressSource_AddsToTotal");
+}
+
+void add_FM_ChildVerifyCmd_tests(void)
+{
+    UtTest_Add(Test_FM_ChildVerifyCmd_CopyOverwrite, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildVerifyCmd_CopyOverwrite");
+    UtTest_Add(Test_FM_ChildVerifyCmd_ConcatListInlineSources, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildVerifyCmd_ConcatListInlineSources");
+    UtTest_Add(Test_FM_ChildVerifyCmd_FileInfoState, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildVerifyCmd_FileInfoState");
+    UtTest_Add(Test_FM_ChildVerifyCmd_FileDigest, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildVerifyCmd_FileDigest");
+    UtTest_Add(Test_FM_ChildVerifyCmd_SetPermissions, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildVerifyCmd_SetPermissions");
+    UtTest_Add(Test_FM_ChildVerifyCmd_DeleteTree, FM_Test_Setup, FM_Test_Teardown, "Test_FM_ChildVerifyCmd_DeleteTree");
+    UtTest_Add(Test_FM_ChildVerifyCmd_FilterFiles, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ChildVerifyCmd_FilterFiles");
 }
 
 void add_FM_ChildLoop_tests(void)
@@ -2604,6 +7563,8 @@ void UtTest_Setup(void)
 {
     add_FM_ChildInit_tests();
     add_FM_ChildTask_tests();
+    add_FM_ChildWriterTask_tests();
+    add_FM_ChildCrcHelperTask_tests();
     add_FM_ChildProcess_tests();
     add_FM_ChildCopyCmd_tests();
     add_FM_ChildMoveCmd_tests();
@@ -2612,15 +7573,30 @@ void UtTest_Setup(void)
     add_FM_ChildDeleteAllFilesCmd_tests();
     add_FM_ChildDecompressFileCmd_tests();
     add_FM_ChildConcatFilesCmd_tests();
+    add_FM_ChildConcatListCmd_tests();
     add_FM_ChildFileInfoCmd_tests();
+    add_FM_ChildFileDigestCmd_tests();
     add_FM_ChildCreateDirectoryCmd_tests();
     add_FM_ChildDeleteDirectoryCmd_tests();
+    add_FM_ChildDeleteTreeCmd_tests();
+    add_FM_ChildFilterFilesCmd_tests();
+    add_FM_ChildRetentionCmd_tests();
+    add_FM_ChildPurgeCmd_tests();
+    add_FM_ChildTrash_tests();
     add_FM_ChildDirListFileCmd_tests();
     add_FM_ChildDirListPktCmd_tests();
     add_FM_ChildSetPermissionsCmd_tests();
     add_FM_ChildDirListFileInit_tests();
     add_FM_ChildDirListFileLoop_tests();
+    add_FM_ChildCopyFile_tests();
+    add_FM_ChildKernelCopy_tests();
+    add_FM_ChildCopyStream_tests();
     add_FM_ChildSizeTimeMode_tests();
     add_FM_ChildSleepStat_tests();
+    add_FM_ChildThrottle_tests();
+    add_FM_ChildAbortCheck_tests();
+    add_FM_ChildCheckpoint_tests();
+    add_FM_ChildProgress_tests();
+    add_FM_ChildVerifyCmd_tests();
     add_FM_ChildLoop_tests();
 }
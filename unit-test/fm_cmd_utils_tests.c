@@ -24,6 +24,7 @@
 
 #include "cfe.h"
 #include "fm_cmd_utils.h"
+#include "fm_msgdefs.h"
 #include "fm_app.h"
 #include "fm_child.h"
 #include "fm_perfids.h"
@@ -123,70 +124,176 @@ void Test_FM_GetOpenFilesData(void)
     UtAssert_STRINGBUF_EQ(files_entry.AppName, sizeof(files_entry.AppName), task_prop.name, sizeof(task_prop.name));
 }
 
+/* **************************
+ * BuildOpenPathSet Tests
+ * *************************/
+void Test_FM_BuildOpenPathSet(void)
+{
+    FM_OpenPathSet_t open_paths;
+    osal_id_t        id[FM_OPEN_PATH_SET_ENTRIES + 1];
+    uint32           i;
+
+    memset(&open_paths, 0, sizeof(open_paths));
+
+    /* No objects */
+    UtAssert_VOIDCALL(FM_BuildOpenPathSet(&open_paths));
+    UtAssert_BOOL_TRUE(open_paths.Valid);
+    UtAssert_ZERO(open_paths.Count);
+    UtAssert_BOOL_FALSE(open_paths.Overflow);
+
+    /* OS_FDGetInfo fail */
+    OS_OpenCreate(&id[0], NULL, 0, 0);
+    UT_SetDataBuffer(UT_KEY(OS_ForEachObject), &id[0], sizeof(id[0]), false);
+    UT_SetDeferredRetcode(UT_KEY(OS_FDGetInfo), 1, !OS_SUCCESS);
+    UtAssert_VOIDCALL(FM_BuildOpenPathSet(&open_paths));
+    UtAssert_ZERO(open_paths.Count);
+
+    /* More streams than the set can hold */
+    for (i = 1; i < FM_OPEN_PATH_SET_ENTRIES + 1; i++)
+    {
+        id[i] = id[0];
+    }
+
+    UT_SetDataBuffer(UT_KEY(OS_ForEachObject), id, sizeof(id), false);
+    UtAssert_VOIDCALL(FM_BuildOpenPathSet(&open_paths));
+    UtAssert_UINT32_EQ(open_paths.Count, FM_OPEN_PATH_SET_ENTRIES);
+    UtAssert_BOOL_TRUE(open_paths.Overflow);
+
+    /* A new snapshot clears the overflow */
+    UtAssert_VOIDCALL(FM_BuildOpenPathSet(&open_paths));
+    UtAssert_ZERO(open_paths.Count);
+    UtAssert_BOOL_FALSE(open_paths.Overflow);
+}
+
+void Test_FM_BuildOpenPathSet_KernelCopy(void)
+{
+    FM_OpenPathSet_t  open_paths;
+    FM_ChildWorker_t *worker = &FM_GlobalData.ChildWorker[FM_CHILD_TASK_COUNT - 1];
+
+    memset(&open_paths, 0, sizeof(open_paths));
+
+    /* A kernel copy has its files open outside of OSAL */
+    strncpy(worker->KernelCopyPaths.Path[0], "/cf/src", sizeof(worker->KernelCopyPaths.Path[0]) - 1);
+    strncpy(worker->KernelCopyPaths.Path[2], "/cf/tgt", sizeof(worker->KernelCopyPaths.Path[2]) - 1);
+    worker->KernelCopyOpen = true;
+
+    UtAssert_VOIDCALL(FM_BuildOpenPathSet(&open_paths));
+    UtAssert_UINT32_EQ(open_paths.Count, 2);
+    UtAssert_BOOL_TRUE(FM_IsPathOpen(&open_paths, "/cf/src"));
+    UtAssert_BOOL_TRUE(FM_IsPathOpen(&open_paths, "/cf/tgt"));
+    UtAssert_BOOL_FALSE(FM_IsPathOpen(&open_paths, "/cf/other"));
+    UtAssert_STUB_COUNT(OS_MutSemTake, 1);
+    UtAssert_STUB_COUNT(OS_MutSemGive, 1);
+
+    /* Names left behind by a finished kernel copy are ignored */
+    worker->KernelCopyOpen = false;
+
+    UtAssert_VOIDCALL(FM_BuildOpenPathSet(&open_paths));
+    UtAssert_ZERO(open_paths.Count);
+}
+
+/* **************************
+ * IsPathOpen Tests
+ * *************************/
+void Test_FM_IsPathOpen(void)
+{
+    FM_OpenPathSet_t open_paths;
+    osal_id_t        id[2];
+    OS_file_prop_t   file_prop[2];
+
+    memset(&open_paths, 0, sizeof(open_paths));
+    memset(file_prop, 0, sizeof(file_prop));
+    strncpy(file_prop[0].Path, "/ram/open1", sizeof(file_prop[0].Path));
+    strncpy(file_prop[1].Path, "/ram/open2", sizeof(file_prop[1].Path));
+    OS_OpenCreate(&id[0], NULL, 0, 0);
+    OS_OpenCreate(&id[1], NULL, 0, 0);
+
+    UT_SetDataBuffer(UT_KEY(OS_ForEachObject), id, sizeof(id), false);
+    UT_SetDataBuffer(UT_KEY(OS_FDGetInfo), file_prop, sizeof(file_prop), false);
+
+    /* The first lookup takes the snapshot and the others reuse it */
+    UtAssert_BOOL_TRUE(FM_IsPathOpen(&open_paths, "/ram/open1"));
+    UtAssert_BOOL_TRUE(FM_IsPathOpen(&open_paths, "/ram/open2"));
+    UtAssert_BOOL_FALSE(FM_IsPathOpen(&open_paths, "/ram/closed"));
+    UtAssert_BOOL_FALSE(FM_IsPathOpen(&open_paths, "/ram/open"));
+    UtAssert_STUB_COUNT(OS_ForEachObject, 1);
+    UtAssert_UINT32_EQ(open_paths.Count, 2);
+
+    /* Every name might be open when the set overflowed */
+    open_paths.Overflow = true;
+    UtAssert_BOOL_TRUE(FM_IsPathOpen(&open_paths, "/ram/closed"));
+}
+
 /* **************************
  * GetFilenameState Tests
  * *************************/
 void Test_FM_GetFilenameState(void)
 {
-    char           filename[OS_MAX_FILE_NAME] = {0};
-    os_fstat_t     fstat;
-    osal_id_t      id = OS_OBJECT_ID_UNDEFINED;
-    OS_file_prop_t file_prop;
+    char             filename[OS_MAX_FILE_NAME] = {0};
+    os_fstat_t       fstat;
+    osal_id_t        id = OS_OBJECT_ID_UNDEFINED;
+    OS_file_prop_t   file_prop;
+    FM_OpenPathSet_t open_paths;
 
     memset(&fstat, 0, sizeof(fstat));
     memset(&file_prop, 0, sizeof(file_prop));
+    memset(&open_paths, 0, sizeof(open_paths));
 
     /* NULL filename */
-    UtAssert_UINT32_EQ(FM_GetFilenameState(NULL, 0, false), FM_NAME_IS_INVALID);
+    UtAssert_UINT32_EQ(FM_GetFilenameState(NULL, 0, false, &open_paths), FM_NAME_IS_INVALID);
 
     /* Empty string */
-    UtAssert_UINT32_EQ(FM_GetFilenameState(filename, 1, false), FM_NAME_IS_INVALID);
+    UtAssert_UINT32_EQ(FM_GetFilenameState(filename, 1, false, &open_paths), FM_NAME_IS_INVALID);
 
     /* Unterminated string */
     strncpy(filename, "File", sizeof(filename));
-    UtAssert_UINT32_EQ(FM_GetFilenameState(filename, 1, false), FM_NAME_IS_INVALID);
+    UtAssert_UINT32_EQ(FM_GetFilenameState(filename, 1, false, &open_paths), FM_NAME_IS_INVALID);
 
     /* OS_stat failure, file info false */
     UT_SetDeferredRetcode(UT_KEY(OS_stat), 1, !OS_SUCCESS);
     FM_GlobalData.FileStatSize = 1;
-    UtAssert_UINT32_EQ(FM_GetFilenameState(filename, sizeof(filename), false), FM_NAME_IS_NOT_IN_USE);
+    UtAssert_UINT32_EQ(FM_GetFilenameState(filename, sizeof(filename), false, &open_paths), FM_NAME_IS_NOT_IN_USE);
     UtAssert_UINT32_EQ(FM_GlobalData.FileStatSize, 1);
 
     /* OS_stat failure, file info true */
     UT_SetDeferredRetcode(UT_KEY(OS_stat), 1, !OS_SUCCESS);
-    UtAssert_UINT32_EQ(FM_GetFilenameState(filename, sizeof(filename), true), FM_NAME_IS_NOT_IN_USE);
+    UtAssert_UINT32_EQ(FM_GetFilenameState(filename, sizeof(filename), true, &open_paths), FM_NAME_IS_NOT_IN_USE);
     UtAssert_UINT32_EQ(FM_GlobalData.FileStatSize, 0);
 
     /* File is directory, file info true */
     fstat.FileModeBits = OS_FILESTAT_MODE_DIR;
     fstat.FileSize     = 2;
     UT_SetDataBuffer(UT_KEY(OS_stat), &fstat, sizeof(fstat), false);
-    UtAssert_UINT32_EQ(FM_GetFilenameState(filename, sizeof(filename), true), FM_NAME_IS_DIRECTORY);
+    UtAssert_UINT32_EQ(FM_GetFilenameState(filename, sizeof(filename), true, &open_paths), FM_NAME_IS_DIRECTORY);
     UtAssert_UINT32_EQ(FM_GlobalData.FileStatSize, 2);
 
     /* File is file, file info false, no objects */
-    UtAssert_UINT32_EQ(FM_GetFilenameState(filename, sizeof(filename), false), FM_NAME_IS_FILE_CLOSED);
+    UtAssert_UINT32_EQ(FM_GetFilenameState(filename, sizeof(filename), false, &open_paths), FM_NAME_IS_FILE_CLOSED);
     UtAssert_UINT32_EQ(FM_GlobalData.FileStatSize, 2);
 
     /* File is file, undefined object */
+    open_paths.Valid = false;
     UT_SetDataBuffer(UT_KEY(OS_ForEachObject), &id, sizeof(id), false);
-    UtAssert_UINT32_EQ(FM_GetFilenameState(filename, sizeof(filename), false), FM_NAME_IS_FILE_CLOSED);
+    UtAssert_UINT32_EQ(FM_GetFilenameState(filename, sizeof(filename), false, &open_paths), FM_NAME_IS_FILE_CLOSED);
 
     /* File is file, OS_FDGetInfo fail */
+    open_paths.Valid = false;
     OS_OpenCreate(&id, NULL, 0, 0);
     UT_SetDataBuffer(UT_KEY(OS_ForEachObject), &id, sizeof(id), false);
     UT_SetDeferredRetcode(UT_KEY(OS_FDGetInfo), 1, !OS_SUCCESS);
-    UtAssert_UINT32_EQ(FM_GetFilenameState(filename, sizeof(filename), false), FM_NAME_IS_FILE_CLOSED);
+    UtAssert_UINT32_EQ(FM_GetFilenameState(filename, sizeof(filename), false, &open_paths), FM_NAME_IS_FILE_CLOSED);
 
-    /* File is file, strcmp fail */
+    /* File is file, name not in the set */
+    open_paths.Valid = false;
     UT_SetDataBuffer(UT_KEY(OS_ForEachObject), &id, sizeof(id), false);
-    UtAssert_UINT32_EQ(FM_GetFilenameState(filename, sizeof(filename), false), FM_NAME_IS_FILE_CLOSED);
+    UtAssert_UINT32_EQ(FM_GetFilenameState(filename, sizeof(filename), false, &open_paths), FM_NAME_IS_FILE_CLOSED);
 
-    /* File is file, strcmp match */
+    /* File is file, name in the set */
+    open_paths.Valid = false;
     strncpy(file_prop.Path, filename, sizeof(file_prop.Path));
     UT_SetDataBuffer(UT_KEY(OS_ForEachObject), &id, sizeof(id), false);
     UT_SetDataBuffer(UT_KEY(OS_FDGetInfo), &file_prop, sizeof(file_prop), false);
-    UtAssert_UINT32_EQ(FM_GetFilenameState(filename, sizeof(filename), false), FM_NAME_IS_FILE_OPEN);
+    UtAssert_UINT32_EQ(FM_GetFilenameState(filename, sizeof(filename), false, &open_paths), FM_NAME_IS_FILE_OPEN);
 }
 
 /* **************************
@@ -207,6 +314,53 @@ void Test_FM_VerifyNameValid(void)
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, eventid);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    /* Child verify mode does not query the file system */
+    FM_GlobalData.ChildVerifyMode = FM_VERIFY_MODE_CHILD;
+    UtAssert_UINT32_EQ(FM_VerifyNameValid(filename, sizeof(filename), 0, NULL), FM_NAME_IS_NOT_IN_USE);
+    UtAssert_UINT32_EQ(FM_VerifyNameValid(filename, 1, eventid, "Cmd text"), FM_NAME_IS_INVALID);
+    UtAssert_STUB_COUNT(OS_stat, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+}
+
+/* **************************
+ * FM_IsValidNameString Tests
+ * *************************/
+void Test_FM_IsValidNameString(void)
+{
+    char name[8] = "abc";
+
+    UtAssert_BOOL_TRUE(FM_IsValidNameString(name, sizeof(name)));
+    UtAssert_BOOL_FALSE(FM_IsValidNameString(NULL, sizeof(name)));
+    UtAssert_BOOL_FALSE(FM_IsValidNameString("", sizeof(name)));
+
+    /* No terminator within the buffer */
+    UtAssert_BOOL_FALSE(FM_IsValidNameString(name, 3));
+}
+
+/* **************************
+ * FM_VerifyFileStateOrDefer Tests
+ * *************************/
+void Test_FM_VerifyFileStateOrDefer(void)
+{
+    char filename[OS_MAX_FILE_NAME] = "Filename";
+
+    /* Main task verify mode queries the file system */
+    UT_SetDefaultReturnValue(UT_KEY(OS_stat), !OS_SUCCESS);
+    UtAssert_BOOL_TRUE(FM_VerifyFileStateOrDefer(FM_FILE_NOEXIST, filename, sizeof(filename), 0, "Cmd text"));
+    UtAssert_STUB_COUNT(OS_stat, 1);
+
+    /* Child verify mode only checks the name */
+    FM_GlobalData.ChildVerifyMode = FM_VERIFY_MODE_CHILD;
+    UtAssert_BOOL_TRUE(FM_VerifyFileStateOrDefer(FM_FILE_EXISTS, filename, sizeof(filename), 0, "Cmd text"));
+    UtAssert_STUB_COUNT(OS_stat, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+
+    /* An invalid name gets the same event as in main task verify mode */
+    UtAssert_BOOL_FALSE(FM_VerifyFileStateOrDefer(FM_FILE_EXISTS, filename, 1, FM_COPY_SRC_BASE_EID, "Cmd text"));
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_COPY_SRC_INVALID_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
 }
 
 /* **************************
@@ -214,22 +368,25 @@ void Test_FM_VerifyNameValid(void)
  * *************************/
 void Test_FM_VerifyFileState(void)
 {
-    char           filename[OS_MAX_FILE_NAME] = "Filename";
-    osal_id_t      id                         = OS_OBJECT_ID_UNDEFINED;
-    OS_file_prop_t file_prop;
+    char             filename[OS_MAX_FILE_NAME] = "Filename";
+    osal_id_t        id                         = OS_OBJECT_ID_UNDEFINED;
+    OS_file_prop_t   file_prop;
+    FM_OpenPathSet_t open_paths;
 
     memset(&file_prop, 0, sizeof(file_prop));
+    memset(&open_paths, 0, sizeof(open_paths));
     strncpy(file_prop.Path, filename, sizeof(file_prop.Path));
     OS_OpenCreate(&id, NULL, 0, 0);
 
     /* FM_NAME_IS_CLOSED */
-    UtAssert_BOOL_TRUE(FM_VerifyFileState(FM_FILE_CLOSED, filename, sizeof(filename), 0, "Cmd Text"));
+    UtAssert_BOOL_TRUE(FM_VerifyFileState(FM_FILE_CLOSED, filename, sizeof(filename), 0, "Cmd Text", &open_paths));
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 
     /* FM_NAME_IS_OPEN */
+    open_paths.Valid = false;
     UT_SetDataBuffer(UT_KEY(OS_ForEachObject), &id, sizeof(id), false);
     UT_SetDataBuffer(UT_KEY(OS_FDGetInfo), &file_prop, sizeof(file_prop), false);
-    UtAssert_BOOL_FALSE(FM_VerifyFileState(FM_FILE_CLOSED, filename, sizeof(filename), 0, "Cmd Text"));
+    UtAssert_BOOL_FALSE(FM_VerifyFileState(FM_FILE_CLOSED, filename, sizeof(filename), 0, "Cmd Text", &open_paths));
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_FNAME_ISOPEN_EID_OFFSET);
 }
@@ -264,7 +421,8 @@ void Test_FM_VerifyFileClosed(void)
     UtAssert_BOOL_TRUE(FM_VerifyFileClosed(filename, sizeof(filename), 0, "Cmd Text"));
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
 
-    /* FM_NAME_IS_OPEN */
+    /* FM_NAME_IS_OPEN, seen by the next command */
+    FM_GlobalData.OpenPaths.Valid = false;
     UT_SetDataBuffer(UT_KEY(OS_ForEachObject), &id, sizeof(id), false);
     UT_SetDataBuffer(UT_KEY(OS_FDGetInfo), &file_prop, sizeof(file_prop), false);
     UtAssert_BOOL_FALSE(FM_VerifyFileClosed(filename, sizeof(filename), 0, "Cmd Text"));
@@ -307,7 +465,8 @@ void Test_FM_VerifyFileExists(void)
     UtAssert_BOOL_TRUE(FM_VerifyFileExists(filename, sizeof(filename), 0, "Cmd Text"));
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
 
-    /* FM_NAME_IS_OPEN */
+    /* FM_NAME_IS_OPEN, seen by the next command */
+    FM_GlobalData.OpenPaths.Valid = false;
     UT_SetDataBuffer(UT_KEY(OS_ForEachObject), &id, sizeof(id), false);
     UT_SetDataBuffer(UT_KEY(OS_FDGetInfo), &file_prop, sizeof(file_prop), false);
     UtAssert_BOOL_TRUE(FM_VerifyFileExists(filename, sizeof(filename), 0, "Cmd Text"));
@@ -349,7 +508,8 @@ void Test_FM_VerifyFileNoExist(void)
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_FNAME_EXIST_EID_OFFSET);
 
-    /* FM_NAME_IS_OPEN */
+    /* FM_NAME_IS_OPEN, seen by the next command */
+    FM_GlobalData.OpenPaths.Valid = false;
     UT_SetDataBuffer(UT_KEY(OS_ForEachObject), &id, sizeof(id), false);
     UT_SetDataBuffer(UT_KEY(OS_FDGetInfo), &file_prop, sizeof(file_prop), false);
     UtAssert_BOOL_FALSE(FM_VerifyFileNoExist(filename, sizeof(filename), 0, "Cmd Text"));
@@ -391,7 +551,8 @@ void Test_FM_VerifyFileNotOpen(void)
     UtAssert_BOOL_TRUE(FM_VerifyFileNotOpen(filename, sizeof(filename), 0, "Cmd Text"));
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
 
-    /* FM_NAME_IS_OPEN */
+    /* FM_NAME_IS_OPEN, seen by the next command */
+    FM_GlobalData.OpenPaths.Valid = false;
     UT_SetDataBuffer(UT_KEY(OS_ForEachObject), &id, sizeof(id), false);
     UT_SetDataBuffer(UT_KEY(OS_FDGetInfo), &file_prop, sizeof(file_prop), false);
     UtAssert_BOOL_FALSE(FM_VerifyFileNotOpen(filename, sizeof(filename), 0, "Cmd Text"));
@@ -434,7 +595,8 @@ void Test_FM_VerifyDirExists(void)
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_FNAME_ISFILE_EID_OFFSET);
 
-    /* FM_NAME_IS_OPEN */
+    /* FM_NAME_IS_OPEN, seen by the next command */
+    FM_GlobalData.OpenPaths.Valid = false;
     UT_SetDataBuffer(UT_KEY(OS_ForEachObject), &id, sizeof(id), false);
     UT_SetDataBuffer(UT_KEY(OS_FDGetInfo), &file_prop, sizeof(file_prop), false);
     UtAssert_BOOL_FALSE(FM_VerifyDirExists(filename, sizeof(filename), 0, "Cmd Text"));
@@ -477,7 +639,8 @@ void Test_FM_VerifyDirNoExist(void)
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_FNAME_DNE_EID_OFFSET);
 
-    /* FM_NAME_IS_OPEN */
+    /* FM_NAME_IS_OPEN, seen by the next command */
+    FM_GlobalData.OpenPaths.Valid = false;
     UT_SetDataBuffer(UT_KEY(OS_ForEachObject), &id, sizeof(id), false);
     UT_SetDataBuffer(UT_KEY(OS_FDGetInfo), &file_prop, sizeof(file_prop), false);
     UtAssert_BOOL_FALSE(FM_VerifyDirNoExist(filename, sizeof(filename), 0, "Cmd Text"));
@@ -495,35 +658,263 @@ void Test_FM_VerifyDirNoExist(void)
  * *********************/
 void Test_FM_VerifyChildTask(void)
 {
+    uint32 i;
+
     /* ChildSemaphore not defined */
     UtAssert_BOOL_FALSE(FM_VerifyChildTask(0, "Cmd Text"));
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CHILD_DISABLED_EID_OFFSET);
 
     /* LocalQueueCount equal to FM_CHILD_QUEUE_DEPTH */
-    FM_GlobalData.ChildSemaphore  = FM_UT_OBJID_1;
-    FM_GlobalData.ChildQueueCount = FM_CHILD_QUEUE_DEPTH;
+    FM_GlobalData.ChildSemaphore                           = FM_UT_OBJID_1;
+    FM_GlobalData.ChildLane[FM_CHILD_LANE_FAST].WriteIndex = FM_CHILD_QUEUE_DEPTH;
     UtAssert_BOOL_FALSE(FM_VerifyChildTask(0, "Cmd Text"));
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_CHILD_Q_FULL_EID_OFFSET);
 
     /* LocalQueueCount greater than FM_CHILD_QUEUE_DEPTH */
-    FM_GlobalData.ChildQueueCount = FM_CHILD_QUEUE_DEPTH + 1;
+    FM_GlobalData.ChildLane[FM_CHILD_LANE_BULK].WriteIndex = 1;
     UtAssert_BOOL_FALSE(FM_VerifyChildTask(0, "Cmd Text"));
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 3);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[2].EventID, FM_CHILD_BROKEN_EID_OFFSET);
 
-    /* ChildWriteIndex equal to FM_CHILD_QUEUE_DEPTH */
-    FM_GlobalData.ChildQueueCount = FM_CHILD_QUEUE_DEPTH - 1;
-    FM_GlobalData.ChildWriteIndex = FM_CHILD_QUEUE_DEPTH;
+    /* Fast lane WriteIndex equal to FM_CHILD_LANE_INDEX_WRAP */
+    FM_GlobalData.ChildLane[FM_CHILD_LANE_FAST].WriteIndex = FM_CHILD_LANE_INDEX_WRAP;
+    FM_GlobalData.ChildLane[FM_CHILD_LANE_BULK].WriteIndex = 0;
     UtAssert_BOOL_FALSE(FM_VerifyChildTask(0, "Cmd Text"));
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 4);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[3].EventID, FM_CHILD_BROKEN_EID_OFFSET);
 
-    /* Success */
-    FM_GlobalData.ChildWriteIndex = FM_CHILD_QUEUE_DEPTH - 1;
+    /* Bulk lane WriteIndex equal to FM_CHILD_LANE_INDEX_WRAP */
+    FM_GlobalData.ChildLane[FM_CHILD_LANE_FAST].WriteIndex = 0;
+    FM_GlobalData.ChildLane[FM_CHILD_LANE_BULK].WriteIndex = FM_CHILD_LANE_INDEX_WRAP;
+    UtAssert_BOOL_FALSE(FM_VerifyChildTask(0, "Cmd Text"));
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 5);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[4].EventID, FM_CHILD_BROKEN_EID_OFFSET);
+
+    /* No room left in the path block pool for a worst case command */
+    FM_GlobalData.ChildLane[FM_CHILD_LANE_BULK].WriteIndex = 0;
+    for (i = FM_CHILD_PATH_BLOCKS_PER_CMD - 1; i < FM_CHILD_PATH_BLOCK_COUNT; i++)
+    {
+        FM_GlobalData.ChildPathBlock[i].InUse = 1;
+    }
+    UtAssert_BOOL_FALSE(FM_VerifyChildTask(0, "Cmd Text"));
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 6);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[5].EventID, FM_CHILD_Q_FULL_EID_OFFSET);
+    FM_GlobalData.ChildPathBlock[FM_CHILD_PATH_BLOCK_COUNT - 1].InUse = 0;
+
+    /* Success - one command waiting in a bulk lane that has wrapped */
+    FM_GlobalData.ChildLane[FM_CHILD_LANE_BULK].WriteIndex = 0;
+    FM_GlobalData.ChildLane[FM_CHILD_LANE_BULK].ReadIndex  = FM_CHILD_LANE_INDEX_WRAP - 1;
+    FM_GlobalData.ChildStagingEntry.CommandCode            = FM_COPY_FILE_CC;
     UtAssert_BOOL_TRUE(FM_VerifyChildTask(0, "Cmd Text"));
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 4);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 6);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildStagingEntry.CommandCode, 0);
+}
+
+/* **********************
+ * GetChildLane tests
+ * *********************/
+void Test_FM_GetChildLane(void)
+{
+    FM_ChildQueueEntry_t CmdArgs;
+
+    memset(&CmdArgs, 0, sizeof(CmdArgs));
+
+    /* Metadata commands use the fast lane */
+    CmdArgs.CommandCode = FM_RENAME_FILE_CC;
+    UtAssert_INT32_EQ(FM_GetChildLane(&CmdArgs), FM_CHILD_LANE_FAST);
+    CmdArgs.CommandCode = FM_DELETE_FILE_CC;
+    UtAssert_INT32_EQ(FM_GetChildLane(&CmdArgs), FM_CHILD_LANE_FAST);
+    CmdArgs.CommandCode = FM_CREATE_DIRECTORY_CC;
+    UtAssert_INT32_EQ(FM_GetChildLane(&CmdArgs), FM_CHILD_LANE_FAST);
+    CmdArgs.CommandCode = FM_DELETE_DIRECTORY_CC;
+    UtAssert_INT32_EQ(FM_GetChildLane(&CmdArgs), FM_CHILD_LANE_FAST);
+    CmdArgs.CommandCode = FM_SET_PERMISSIONS_CC;
+    UtAssert_INT32_EQ(FM_GetChildLane(&CmdArgs), FM_CHILD_LANE_FAST);
+
+    /* File info is only a bulk command when a CRC is requested */
+    CmdArgs.CommandCode = FM_GET_FILE_INFO_CC;
+    CmdArgs.FileInfoCRC = FM_IGNORE_CRC;
+    UtAssert_INT32_EQ(FM_GetChildLane(&CmdArgs), FM_CHILD_LANE_FAST);
+    CmdArgs.FileInfoCRC = FM_IGNORE_CRC + 1;
+    UtAssert_INT32_EQ(FM_GetChildLane(&CmdArgs), FM_CHILD_LANE_BULK);
+
+    /* Data commands use the bulk lane */
+    CmdArgs.CommandCode = FM_COPY_FILE_CC;
+    UtAssert_INT32_EQ(FM_GetChildLane(&CmdArgs), FM_CHILD_LANE_BULK);
+    CmdArgs.CommandCode = FM_CONCAT_FILES_CC;
+    UtAssert_INT32_EQ(FM_GetChildLane(&CmdArgs), FM_CHILD_LANE_BULK);
+    CmdArgs.CommandCode = FM_GET_DIR_LIST_FILE_CC;
+    UtAssert_INT32_EQ(FM_GetChildLane(&CmdArgs), FM_CHILD_LANE_BULK);
+
+    /* Only the fast lane commands search the bulk lane */
+    UtAssert_STUB_COUNT(OS_MutSemTake, 6);
+    UtAssert_STUB_COUNT(OS_MutSemGive, 6);
+}
+
+void Test_FM_GetChildLane_BulkPending(void)
+{
+    FM_ChildLane_t *     BulkLane = &FM_GlobalData.ChildLane[FM_CHILD_LANE_BULK];
+    FM_ChildQueueEntry_t CmdArgs;
+
+    memset(&CmdArgs, 0, sizeof(CmdArgs));
+
+    /* A copy of /cf/dir/a is waiting in the bulk lane */
+    BulkLane->Queue[0].CommandCode = FM_COPY_FILE_CC;
+    BulkLane->Queue[0].Source1     = FM_StoreChildPath("/cf/dir/a");
+    BulkLane->WriteIndex           = 1;
+
+    /* A delete of another file still uses the fast lane */
+    CmdArgs.CommandCode = FM_DELETE_FILE_CC;
+    strncpy(CmdArgs.Source1, "/cf/dir/b", sizeof(CmdArgs.Source1) - 1);
+    UtAssert_INT32_EQ(FM_GetChildLane(&CmdArgs), FM_CHILD_LANE_FAST);
+
+    /* Removing the directory holding the file waits behind the copy */
+    CmdArgs.CommandCode = FM_DELETE_DIRECTORY_CC;
+    strncpy(CmdArgs.Source1, "/cf/dir", sizeof(CmdArgs.Source1) - 1);
+    UtAssert_INT32_EQ(FM_GetChildLane(&CmdArgs), FM_CHILD_LANE_BULK);
+
+    /* Unless the copy was flushed */
+    BulkLane->Queue[0].Flushed = true;
+    UtAssert_INT32_EQ(FM_GetChildLane(&CmdArgs), FM_CHILD_LANE_FAST);
+
+    /* The names of the waiting copy are left in use */
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildPathBlock[0].InUse, 1);
+}
+
+/* **********************
+ * Child path block pool tests
+ * *********************/
+void Test_FM_GetChildPathBlocksFree(void)
+{
+    /* Every block free */
+    UtAssert_UINT32_EQ(FM_GetChildPathBlocksFree(FM_CHILD_PATH_BLOCK_COUNT), FM_CHILD_PATH_BLOCK_COUNT);
+
+    /* Search stops at the limit */
+    UtAssert_UINT32_EQ(FM_GetChildPathBlocksFree(2), 2);
+
+    /* Blocks in use are not counted */
+    FM_GlobalData.ChildPathBlock[0].InUse                             = 1;
+    FM_GlobalData.ChildPathBlock[FM_CHILD_PATH_BLOCK_COUNT - 1].InUse = 1;
+    UtAssert_UINT32_EQ(FM_GetChildPathBlocksFree(FM_CHILD_PATH_BLOCK_COUNT), FM_CHILD_PATH_BLOCK_COUNT - 2);
+}
+
+void Test_FM_StoreChildPath(void)
+{
+    char   LongPath[FM_CHILD_PATH_BLOCK_SIZE + 3];
+    uint16 PathRef;
+
+    /* Empty names use no blocks */
+    UtAssert_UINT32_EQ(FM_StoreChildPath(""), 0);
+    UtAssert_UINT32_EQ(FM_GetChildPathBlocksFree(FM_CHILD_PATH_BLOCK_COUNT), FM_CHILD_PATH_BLOCK_COUNT);
+
+    /* Short name fits in one block */
+    PathRef = FM_StoreChildPath("/cf/a");
+    UtAssert_UINT32_EQ(PathRef, 1);
+    UtAssert_STRINGBUF_EQ(FM_GlobalData.ChildPathBlock[0].Data, sizeof(FM_GlobalData.ChildPathBlock[0].Data), "/cf/a",
+                          -1);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildPathBlock[0].InUse, 1);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildPathBlock[0].Next, 0);
+
+    /* Longer name is chained, skipping blocks still in use */
+    memset(LongPath, 'x', sizeof(LongPath) - 1);
+    LongPath[sizeof(LongPath) - 1]        = '\0';
+    FM_GlobalData.ChildPathBlock[2].InUse = 1;
+
+    PathRef = FM_StoreChildPath(LongPath);
+    UtAssert_UINT32_EQ(PathRef, 2);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildPathBlock[1].Next, 4);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildPathBlock[3].InUse, 1);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildPathBlock[3].Next, 0);
+    UtAssert_STRINGBUF_EQ(FM_GlobalData.ChildPathBlock[3].Data, sizeof(FM_GlobalData.ChildPathBlock[3].Data), "xx",
+                          -1);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildPathCursor, 4);
+}
+
+void Test_FM_ReleaseChildPath(void)
+{
+    /* Empty name releases nothing */
+    FM_GlobalData.ChildPathBlock[0].InUse = 1;
+    UtAssert_VOIDCALL(FM_ReleaseChildPath(0));
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildPathBlock[0].InUse, 1);
+
+    /* Every block of a chained name is released */
+    FM_GlobalData.ChildPathBlock[1].InUse = 1;
+    FM_GlobalData.ChildPathBlock[1].Next  = 4;
+    FM_GlobalData.ChildPathBlock[3].InUse = 1;
+    UtAssert_VOIDCALL(FM_ReleaseChildPath(2));
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildPathBlock[1].InUse, 0);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildPathBlock[3].InUse, 0);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildPathBlock[0].InUse, 1);
+
+    /* Invalid reference is ignored */
+    UtAssert_VOIDCALL(FM_ReleaseChildPath(FM_CHILD_PATH_BLOCK_COUNT + 1));
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildPathBlock[0].InUse, 1);
+}
+
+void Test_FM_PeekChildPath(void)
+{
+    char Path[OS_MAX_PATH_LEN] = "stale";
+    char LongPath[FM_CHILD_PATH_BLOCK_SIZE + 3];
+
+    /* Empty name */
+    UtAssert_VOIDCALL(FM_PeekChildPath(0, Path, sizeof(Path)));
+    UtAssert_STRINGBUF_EQ(Path, sizeof(Path), "", -1);
+
+    /* Chained name is read and every block stays in use */
+    memset(LongPath, 'x', sizeof(LongPath) - 1);
+    LongPath[sizeof(LongPath) - 1] = '\0';
+
+    UtAssert_VOIDCALL(FM_PeekChildPath(FM_StoreChildPath(LongPath), Path, sizeof(Path)));
+    UtAssert_STRINGBUF_EQ(Path, sizeof(Path), LongPath, -1);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildPathBlock[0].InUse, 1);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildPathBlock[1].InUse, 1);
+
+    /* Name cut short to fit the buffer */
+    UtAssert_VOIDCALL(FM_PeekChildPath(1, Path, 4));
+    UtAssert_STRINGBUF_EQ(Path, 4, "xxx", -1);
+}
+
+void Test_FM_GetSlotPaths(void)
+{
+    FM_ChildQueueSlot_t Slot;
+    FM_ChildPathSet_t   Paths;
+
+    memset(&Slot, 0, sizeof(Slot));
+    memset(&Paths, 'x', sizeof(Paths));
+
+    Slot.Source1 = FM_StoreChildPath("/cf/a");
+    Slot.Target  = FM_StoreChildPath("/cf/b");
+
+    UtAssert_VOIDCALL(FM_GetSlotPaths(&Slot, &Paths));
+    UtAssert_STRINGBUF_EQ(Paths.Path[0], sizeof(Paths.Path[0]), "/cf/a", -1);
+    UtAssert_STRINGBUF_EQ(Paths.Path[1], sizeof(Paths.Path[1]), "", -1);
+    UtAssert_STRINGBUF_EQ(Paths.Path[2], sizeof(Paths.Path[2]), "/cf/b", -1);
+}
+
+void Test_FM_ChildLaneOverlaps(void)
+{
+    FM_ChildLane_t *  BulkLane = &FM_GlobalData.ChildLane[FM_CHILD_LANE_BULK];
+    FM_ChildPathSet_t Paths;
+
+    memset(&Paths, 0, sizeof(Paths));
+    strncpy(Paths.Path[0], "/cf/b", sizeof(Paths.Path[0]) - 1);
+
+    /* Empty lane */
+    UtAssert_BOOL_FALSE(FM_ChildLaneOverlaps(BulkLane, &Paths));
+
+    /* Two commands waiting across the ring wrap, the second copies to /cf/b */
+    BulkLane->ReadIndex                               = FM_CHILD_LANE_INDEX_WRAP - 1;
+    BulkLane->WriteIndex                              = 1;
+    BulkLane->Queue[FM_CHILD_QUEUE_DEPTH - 1].Source1 = FM_StoreChildPath("/cf/c");
+    BulkLane->Queue[0].Source1                        = FM_StoreChildPath("/cf/a");
+    BulkLane->Queue[0].Target                         = FM_StoreChildPath("/cf/b");
+    UtAssert_BOOL_TRUE(FM_ChildLaneOverlaps(BulkLane, &Paths));
+
+    /* Flushed slots are skipped */
+    BulkLane->Queue[0].Flushed = true;
+    UtAssert_BOOL_FALSE(FM_ChildLaneOverlaps(BulkLane, &Paths));
 }
 
 /* **********************
@@ -531,22 +922,207 @@ void Test_FM_VerifyChildTask(void)
  * *********************/
 void Test_FM_InvokeChildTask(void)
 {
-    /* Conditions true */
-    FM_GlobalData.ChildWriteIndex = FM_CHILD_QUEUE_DEPTH - 1;
-    FM_GlobalData.ChildSemaphore  = FM_UT_OBJID_1;
+    FM_ChildLane_t *FastLane = &FM_GlobalData.ChildLane[FM_CHILD_LANE_FAST];
+    FM_ChildLane_t *BulkLane = &FM_GlobalData.ChildLane[FM_CHILD_LANE_BULK];
+
+    /* Slot last held a flushed command */
+    BulkLane->Queue[FM_CHILD_QUEUE_DEPTH - 1].Flushed = true;
+
+    /* Conditions true - bulk command queued in the bulk lane */
+    BulkLane->WriteIndex                        = FM_CHILD_LANE_INDEX_WRAP - 1;
+    BulkLane->ReadIndex                         = FM_CHILD_LANE_INDEX_WRAP - 1;
+    FM_GlobalData.ChildSemaphore                = FM_UT_OBJID_1;
+    FM_GlobalData.ChildStagingEntry.CommandCode = FM_COPY_FILE_CC;
+    FM_GlobalData.ChildStagingEntry.Overwrite   = true;
+    FM_GlobalData.ChildVerifyMode               = FM_VERIFY_MODE_CHILD;
     UtAssert_VOIDCALL(FM_InvokeChildTask());
-    UtAssert_INT32_EQ(FM_GlobalData.ChildWriteIndex, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueCount, 1);
+    UtAssert_UINT32_EQ(BulkLane->WriteIndex, 0);
+    UtAssert_BOOL_TRUE(BulkLane->Queue[FM_CHILD_QUEUE_DEPTH - 1].ChildVerify);
+    UtAssert_BOOL_TRUE(BulkLane->Queue[FM_CHILD_QUEUE_DEPTH - 1].Overwrite);
+    UtAssert_UINT32_EQ(FM_ChildLaneCount(BulkLane), 1);
+    UtAssert_INT32_EQ(BulkLane->Queue[FM_CHILD_QUEUE_DEPTH - 1].CommandCode, FM_COPY_FILE_CC);
+    UtAssert_BOOL_FALSE(BulkLane->Queue[FM_CHILD_QUEUE_DEPTH - 1].Flushed);
+    UtAssert_UINT32_EQ(FM_ChildLaneCount(FastLane), 0);
+    UtAssert_UINT32_EQ(FM_ChildQueueCount(), 1);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildEnqueueCount, 1);
+    UtAssert_STUB_COUNT(OS_GetLocalTime, 1);
+    UtAssert_STUB_COUNT(OS_MutSemTake, 0);
     UtAssert_STUB_COUNT(OS_CountSemGive, 1);
 
-    /* Conditions false */
-    FM_GlobalData.ChildSemaphore = OS_OBJECT_ID_UNDEFINED;
+    /* Conditions false - metadata command queued in the fast lane */
+    FM_GlobalData.ChildSemaphore                = OS_OBJECT_ID_UNDEFINED;
+    FM_GlobalData.ChildStagingEntry.CommandCode = FM_DELETE_FILE_CC;
+    FM_GlobalData.ChildStagingEntry.Overwrite   = false;
+    FM_GlobalData.ChildVerifyMode               = FM_VERIFY_MODE_MAIN;
+    strncpy(FM_GlobalData.ChildStagingEntry.Source1, "/cf/a", sizeof(FM_GlobalData.ChildStagingEntry.Source1) - 1);
     UtAssert_VOIDCALL(FM_InvokeChildTask());
-    UtAssert_INT32_EQ(FM_GlobalData.ChildWriteIndex, 1);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueueCount, 2);
+    UtAssert_UINT32_EQ(FastLane->WriteIndex, 1);
+    UtAssert_UINT32_EQ(FM_ChildLaneCount(FastLane), 1);
+    UtAssert_INT32_EQ(FastLane->Queue[0].CommandCode, FM_DELETE_FILE_CC);
+    UtAssert_BOOL_FALSE(FastLane->Queue[0].ChildVerify);
+    UtAssert_UINT32_EQ(FastLane->Queue[0].Source1, 1);
+    UtAssert_UINT32_EQ(FastLane->Queue[0].Source2, 0);
+    UtAssert_UINT32_EQ(FastLane->Queue[0].Target, 0);
+    UtAssert_STRINGBUF_EQ(FM_GlobalData.ChildPathBlock[0].Data, sizeof(FM_GlobalData.ChildPathBlock[0].Data), "/cf/a",
+                          -1);
+    UtAssert_UINT32_EQ(FM_ChildLaneCount(BulkLane), 1);
+    UtAssert_UINT32_EQ(FM_ChildQueueCount(), 2);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildEnqueueCount, 2);
     UtAssert_STUB_COUNT(OS_CountSemGive, 1);
 }
 
+void Test_FM_InvokeChildTask_CopyThenDelete(void)
+{
+    FM_ChildQueueEntry_t *CmdArgs  = &FM_GlobalData.ChildStagingEntry;
+    FM_ChildLane_t *      FastLane = &FM_GlobalData.ChildLane[FM_CHILD_LANE_FAST];
+    FM_ChildLane_t *      BulkLane = &FM_GlobalData.ChildLane[FM_CHILD_LANE_BULK];
+
+    /* Copy /cf/a to /cf/b */
+    memset(CmdArgs, 0, sizeof(*CmdArgs));
+    CmdArgs->CommandCode = FM_COPY_FILE_CC;
+    strncpy(CmdArgs->Source1, "/cf/a", sizeof(CmdArgs->Source1) - 1);
+    strncpy(CmdArgs->Target, "/cf/b", sizeof(CmdArgs->Target) - 1);
+    UtAssert_VOIDCALL(FM_InvokeChildTask());
+
+    /* Then delete /cf/a - it must not overtake the copy */
+    memset(CmdArgs, 0, sizeof(*CmdArgs));
+    CmdArgs->CommandCode = FM_DELETE_FILE_CC;
+    strncpy(CmdArgs->Source1, "/cf/a", sizeof(CmdArgs->Source1) - 1);
+    UtAssert_VOIDCALL(FM_InvokeChildTask());
+
+    /* A delete of an unrelated file still takes the fast lane */
+    memset(CmdArgs, 0, sizeof(*CmdArgs));
+    CmdArgs->CommandCode = FM_DELETE_FILE_CC;
+    strncpy(CmdArgs->Source1, "/cf/c", sizeof(CmdArgs->Source1) - 1);
+    UtAssert_VOIDCALL(FM_InvokeChildTask());
+
+    /* Both commands on /cf/a wait in the bulk lane, in the order sent */
+    UtAssert_UINT32_EQ(FM_ChildLaneCount(BulkLane), 2);
+    UtAssert_INT32_EQ(BulkLane->Queue[0].CommandCode, FM_COPY_FILE_CC);
+    UtAssert_INT32_EQ(BulkLane->Queue[1].CommandCode, FM_DELETE_FILE_CC);
+    UtAssert_UINT32_EQ(FM_ChildLaneCount(FastLane), 1);
+    UtAssert_INT32_EQ(FastLane->Queue[0].CommandCode, FM_DELETE_FILE_CC);
+}
+
+/* **********************
+ * FlushChildQueue tests
+ * *********************/
+void Test_FM_FlushChildQueue(void)
+{
+    FM_ChildLane_t *FastLane = &FM_GlobalData.ChildLane[FM_CHILD_LANE_FAST];
+    FM_ChildLane_t *BulkLane = &FM_GlobalData.ChildLane[FM_CHILD_LANE_BULK];
+
+    /* Empty queue */
+    UtAssert_UINT32_EQ(FM_FlushChildQueue(), 0);
+    UtAssert_STUB_COUNT(OS_MutSemTake, 1);
+    UtAssert_STUB_COUNT(OS_MutSemGive, 1);
+
+    /* One waiting command in each lane, the bulk one wrapping the ring */
+    FastLane->ReadIndex  = 1;
+    FastLane->WriteIndex = 2;
+    BulkLane->ReadIndex  = FM_CHILD_LANE_INDEX_WRAP - 1;
+    BulkLane->WriteIndex = 0;
+
+    FastLane->Queue[1].Source1                       = 1;
+    BulkLane->Queue[FM_CHILD_QUEUE_DEPTH - 1].Target = 2;
+    FM_GlobalData.ChildPathBlock[0].InUse            = 1;
+    FM_GlobalData.ChildPathBlock[1].InUse            = 1;
+
+    /* A slot already executing is not touched */
+    FastLane->Queue[0].Source1 = 3;
+
+    UtAssert_UINT32_EQ(FM_FlushChildQueue(), 2);
+    UtAssert_BOOL_TRUE(FastLane->Queue[1].Flushed);
+    UtAssert_UINT32_EQ(FastLane->Queue[1].Source1, 0);
+    UtAssert_BOOL_TRUE(BulkLane->Queue[FM_CHILD_QUEUE_DEPTH - 1].Flushed);
+    UtAssert_UINT32_EQ(BulkLane->Queue[FM_CHILD_QUEUE_DEPTH - 1].Target, 0);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildPathBlock[0].InUse, 0);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildPathBlock[1].InUse, 0);
+    UtAssert_BOOL_FALSE(FastLane->Queue[0].Flushed);
+    UtAssert_UINT32_EQ(FastLane->Queue[0].Source1, 3);
+
+    /* Lane indices are left for the child tasks */
+    UtAssert_UINT32_EQ(FM_ChildQueueCount(), 2);
+
+    /* Slots flushed earlier are not counted again */
+    UtAssert_UINT32_EQ(FM_FlushChildQueue(), 0);
+
+    /* A flushed retention pass frees its table entry */
+    FastLane->ReadIndex               = 2;
+    FastLane->WriteIndex              = 3;
+    FastLane->Queue[2].CommandCode    = FM_ENFORCE_RETENTION_CC;
+    FastLane->Queue[2].RetentionIndex = 1;
+    FM_GlobalData.Retention[1].Busy   = 1;
+    UtAssert_UINT32_EQ(FM_FlushChildQueue(), 1);
+    UtAssert_UINT32_EQ(FM_GlobalData.Retention[1].Busy, 0);
+
+    /* As does a flushed purge pass */
+    FastLane->ReadIndex            = 3;
+    FastLane->WriteIndex           = 4;
+    FastLane->Queue[3].CommandCode = FM_PURGE_TRASH_CC;
+    FM_GlobalData.TrashPurgeBusy   = 1;
+    UtAssert_UINT32_EQ(FM_FlushChildQueue(), 1);
+    UtAssert_UINT32_EQ(FM_GlobalData.TrashPurgeBusy, 0);
+}
+
+/* **********************
+ * StartRetention tests
+ * *********************/
+void Test_FM_StartRetention(void)
+{
+    FM_RetentionTable_t RetentionTable;
+    FM_ChildLane_t *    BulkLane = &FM_GlobalData.ChildLane[FM_CHILD_LANE_BULK];
+
+    memset(&RetentionTable, 0, sizeof(RetentionTable));
+    RetentionTable.Entries[2].Enabled  = FM_TABLE_ENTRY_ENABLED;
+    RetentionTable.Entries[2].MaxFiles = 10;
+    strncpy(RetentionTable.Entries[2].Directory, "/ram/rec", sizeof(RetentionTable.Entries[2].Directory) - 1);
+    FM_GlobalData.RetentionTablePtr = &RetentionTable;
+
+    /* Child task not running - nothing is queued */
+    UtAssert_BOOL_FALSE(FM_StartRetention(2, false));
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID,
+                      FM_ENFORCE_RETENTION_CHILD_BASE_EID + FM_CHILD_DISABLED_EID_OFFSET);
+    UtAssert_UINT32_EQ(FM_GlobalData.Retention[2].Busy, 0);
+    UtAssert_UINT32_EQ(FM_ChildQueueCount(), 0);
+
+    /* Pass queued in the bulk lane with a copy of the table entry */
+    FM_GlobalData.ChildSemaphore = FM_UT_OBJID_1;
+    UtAssert_BOOL_TRUE(FM_StartRetention(2, true));
+    UtAssert_UINT32_EQ(FM_GlobalData.Retention[2].Busy, 1);
+    UtAssert_BOOL_TRUE(FM_GlobalData.Retention[2].Commanded);
+    UtAssert_UINT32_EQ(FM_GlobalData.Retention[2].Policy.MaxFiles, 10);
+    UtAssert_UINT32_EQ(FM_ChildLaneCount(BulkLane), 1);
+    UtAssert_INT32_EQ(BulkLane->Queue[0].CommandCode, FM_ENFORCE_RETENTION_CC);
+    UtAssert_UINT32_EQ(BulkLane->Queue[0].RetentionIndex, 2);
+    UtAssert_STRINGBUF_EQ(FM_GlobalData.ChildPathBlock[0].Data, sizeof(FM_GlobalData.ChildPathBlock[0].Data),
+                          "/ram/rec", -1);
+}
+
+/* **********************
+ * StartPurge tests
+ * *********************/
+void Test_FM_StartPurge(void)
+{
+    FM_ChildLane_t *BulkLane = &FM_GlobalData.ChildLane[FM_CHILD_LANE_BULK];
+
+    /* Child task not running - nothing is queued */
+    UtAssert_BOOL_FALSE(FM_StartPurge(false));
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_PURGE_TRASH_CHILD_DISABLED_ERR_EID);
+    UtAssert_UINT32_EQ(FM_GlobalData.TrashPurgeBusy, 0);
+    UtAssert_UINT32_EQ(FM_ChildQueueCount(), 0);
+
+    /* Pass queued in the bulk lane */
+    FM_GlobalData.ChildSemaphore = FM_UT_OBJID_1;
+    UtAssert_BOOL_TRUE(FM_StartPurge(true));
+    UtAssert_UINT32_EQ(FM_GlobalData.TrashPurgeBusy, 1);
+    UtAssert_BOOL_TRUE(FM_GlobalData.TrashPurgeCommanded);
+    UtAssert_UINT32_EQ(FM_ChildLaneCount(BulkLane), 1);
+    UtAssert_INT32_EQ(BulkLane->Queue[0].CommandCode, FM_PURGE_TRASH_CC);
+}
+
 /* **********************
  * AppendPathSep Tests
  * *********************/
@@ -572,6 +1148,102 @@ void Test_FM_AppendPathSep(void)
     UtAssert_UINT32_EQ(strncmp(directory, "a/", sizeof(directory)), 0);
 }
 
+/* **********************
+ * PathsOverlap Tests
+ * *********************/
+void Test_FM_PathsOverlap(void)
+{
+    /* The same name, with or without a trailing separator */
+    UtAssert_BOOL_TRUE(FM_PathsOverlap("/cf/a", "/cf/a"));
+    UtAssert_BOOL_TRUE(FM_PathsOverlap("/cf/dir/", "/cf/dir"));
+
+    /* A directory and a name inside it, either way round */
+    UtAssert_BOOL_TRUE(FM_PathsOverlap("/cf/dir", "/cf/dir/file"));
+    UtAssert_BOOL_TRUE(FM_PathsOverlap("/cf/dir/sub/file", "/cf/dir/"));
+    UtAssert_BOOL_TRUE(FM_PathsOverlap("/", "/cf/a"));
+
+    /* Names that only share a prefix */
+    UtAssert_BOOL_FALSE(FM_PathsOverlap("/cf/a", "/cf/ab"));
+    UtAssert_BOOL_FALSE(FM_PathsOverlap("/cf/ab", "/cf/a"));
+    UtAssert_BOOL_FALSE(FM_PathsOverlap("/cf/a", "/cf/b"));
+
+    /* Unused arguments */
+    UtAssert_BOOL_FALSE(FM_PathsOverlap("", "/cf/a"));
+    UtAssert_BOOL_FALSE(FM_PathsOverlap("/cf/a", ""));
+    UtAssert_BOOL_FALSE(FM_PathsOverlap("", ""));
+}
+
+/* **********************
+ * GetEntryPaths Tests
+ * *********************/
+void Test_FM_GetEntryPaths(void)
+{
+    /* Arrange */
+    FM_ChildQueueEntry_t CmdArgs;
+    FM_ChildPathSet_t    Paths;
+
+    memset(&CmdArgs, 0, sizeof(CmdArgs));
+    memset(&Paths, 'x', sizeof(Paths));
+
+    strncpy(CmdArgs.Source1, "/cf/a", sizeof(CmdArgs.Source1) - 1);
+    strncpy(CmdArgs.Target, "/cf/b", sizeof(CmdArgs.Target) - 1);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_GetEntryPaths(&CmdArgs, &Paths));
+
+    /* Assert */
+    UtAssert_STRINGBUF_EQ(Paths.Path[0], sizeof(Paths.Path[0]), "/cf/a", -1);
+    UtAssert_STRINGBUF_EQ(Paths.Path[1], sizeof(Paths.Path[1]), "", -1);
+    UtAssert_STRINGBUF_EQ(Paths.Path[2], sizeof(Paths.Path[2]), "/cf/b", -1);
+}
+
+/* **********************
+ * PathSetsOverlap Tests
+ * *********************/
+void Test_FM_PathSetsOverlap(void)
+{
+    /* Arrange */
+    FM_ChildPathSet_t Copy;
+    FM_ChildPathSet_t Delete;
+
+    memset(&Copy, 0, sizeof(Copy));
+    memset(&Delete, 0, sizeof(Delete));
+
+    strncpy(Copy.Path[0], "/cf/a", sizeof(Copy.Path[0]) - 1);
+    strncpy(Copy.Path[2], "/cf/b", sizeof(Copy.Path[2]) - 1);
+
+    /* Act/Assert - the target of one command is the source of the other */
+    strncpy(Delete.Path[0], "/cf/b", sizeof(Delete.Path[0]) - 1);
+    UtAssert_BOOL_TRUE(FM_PathSetsOverlap(&Copy, &Delete));
+    UtAssert_BOOL_TRUE(FM_PathSetsOverlap(&Delete, &Copy));
+
+    /* Act/Assert - no name in common */
+    strncpy(Delete.Path[0], "/cf/c", sizeof(Delete.Path[0]) - 1);
+    UtAssert_BOOL_FALSE(FM_PathSetsOverlap(&Copy, &Delete));
+}
+
+/* **********************
+ * MatchPattern Tests
+ * *********************/
+void Test_FM_MatchPattern(void)
+{
+    /* Empty pattern matches every name */
+    UtAssert_BOOL_TRUE(FM_MatchPattern("", "file.dat"));
+
+    /* Literal characters and '?' */
+    UtAssert_BOOL_TRUE(FM_MatchPattern("file?.dat", "file1.dat"));
+    UtAssert_BOOL_FALSE(FM_MatchPattern("file?.dat", "file.dat"));
+    UtAssert_BOOL_FALSE(FM_MatchPattern("file.dat", "file.dat.bak"));
+    UtAssert_BOOL_FALSE(FM_MatchPattern("file.dat.bak", "file.dat"));
+
+    /* A star widens until the rest of the pattern matches */
+    UtAssert_BOOL_TRUE(FM_MatchPattern("*.dat", "log.2.dat"));
+    UtAssert_BOOL_FALSE(FM_MatchPattern("*.dat", "log.dat.bak"));
+    UtAssert_BOOL_TRUE(FM_MatchPattern("log*_*.dat", "log_a_b.dat"));
+    UtAssert_BOOL_TRUE(FM_MatchPattern("file**", "file"));
+    UtAssert_BOOL_FALSE(FM_MatchPattern("a*", ""));
+}
+
 void Test_FM_GetVolumeFreeSpace(void)
 {
     /*
@@ -669,6 +1341,48 @@ void Test_FM_GetDirectorySpaceEstimate(void)
     UtAssert_STUB_COUNT(OS_DirectoryRead, 0);
 }
 
+void Test_FM_LatencyBucket(void)
+{
+    /*
+     * Test case for:
+     * uint32 FM_LatencyBucket(int64 Microseconds)
+     */
+
+    UtAssert_UINT32_EQ(FM_LatencyBucket(-1), 0);
+    UtAssert_UINT32_EQ(FM_LatencyBucket(0), 0);
+    UtAssert_UINT32_EQ(FM_LatencyBucket(3), 0);
+    UtAssert_UINT32_EQ(FM_LatencyBucket(4), 1);
+    UtAssert_UINT32_EQ(FM_LatencyBucket(15), 1);
+    UtAssert_UINT32_EQ(FM_LatencyBucket(16), 2);
+
+    /* Anything too long for the histogram lands in the last bucket */
+    UtAssert_UINT32_EQ(FM_LatencyBucket(0x7FFFFFFFFFFFFFFF), FM_LATENCY_BUCKET_COUNT - 1);
+}
+
+void Test_FM_RecordLatency(void)
+{
+    /*
+     * Test case for:
+     * void FM_RecordLatency(FM_LatencyHistogram_t *Histograms, CFE_MSG_FcnCode_t CommandCode, OS_time_t StartTime,
+     *                       OS_time_t EndTime)
+     */
+
+    OS_time_t StartTime = OS_TimeAssembleFromMilliseconds(1, 0);
+    OS_time_t EndTime   = OS_TimeAssembleFromMilliseconds(1, 10);
+
+    /* 10 ms is 10000 us, which is in [4^6, 4^7) */
+    FM_RecordLatency(FM_GlobalData.Latency.Execute, FM_COPY_FILE_CC, StartTime, EndTime);
+    UtAssert_UINT32_EQ(FM_GlobalData.Latency.Execute[FM_COPY_FILE_CC].Bucket[6], 1);
+
+    FM_RecordLatency(FM_GlobalData.Latency.Execute, FM_COPY_FILE_CC, StartTime, StartTime);
+    UtAssert_UINT32_EQ(FM_GlobalData.Latency.Execute[FM_COPY_FILE_CC].Bucket[0], 1);
+
+    /* Command codes past the end of the table are not counted */
+    memset(&FM_GlobalData.Latency, 0, sizeof(FM_GlobalData.Latency));
+    FM_RecordLatency(FM_GlobalData.Latency.Execute, FM_LATENCY_CC_COUNT, StartTime, EndTime);
+    UtAssert_MemCmpValue(&FM_GlobalData.Latency, 0, sizeof(FM_GlobalData.Latency), "Latency histograms unchanged");
+}
+
 /*
  * Register the test cases to execute with the unit test tool
  */
@@ -676,8 +1390,14 @@ void UtTest_Setup(void)
 {
     UtTest_Add(Test_FM_VerifyOverwrite, FM_Test_Setup, FM_Test_Teardown, "Test_FM_VerifyOverwrite");
     UtTest_Add(Test_FM_GetOpenFilesData, FM_Test_Setup, FM_Test_Teardown, "Test_FM_GetOpenFilesData");
+    UtTest_Add(Test_FM_BuildOpenPathSet, FM_Test_Setup, FM_Test_Teardown, "Test_FM_BuildOpenPathSet");
+    UtTest_Add(Test_FM_BuildOpenPathSet_KernelCopy, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_BuildOpenPathSet_KernelCopy");
+    UtTest_Add(Test_FM_IsPathOpen, FM_Test_Setup, FM_Test_Teardown, "Test_FM_IsPathOpen");
     UtTest_Add(Test_FM_GetFilenameState, FM_Test_Setup, FM_Test_Teardown, "Test_FM_GetFilenameState");
     UtTest_Add(Test_FM_VerifyNameValid, FM_Test_Setup, FM_Test_Teardown, "Test_FM_VerifyNameValid");
+    UtTest_Add(Test_FM_IsValidNameString, FM_Test_Setup, FM_Test_Teardown, "Test_FM_IsValidNameString");
+    UtTest_Add(Test_FM_VerifyFileStateOrDefer, FM_Test_Setup, FM_Test_Teardown, "Test_FM_VerifyFileStateOrDefer");
     UtTest_Add(Test_FM_VerifyFileState, FM_Test_Setup, FM_Test_Teardown, "Test_FM_VerifyFileState");
     UtTest_Add(Test_FM_VerifyFileClosed, FM_Test_Setup, FM_Test_Teardown, "Test_FM_VerifyFileClosed");
     UtTest_Add(Test_FM_VerifyFileExists, FM_Test_Setup, FM_Test_Teardown, "Test_FM_VerifyFileExists");
@@ -686,8 +1406,27 @@ void UtTest_Setup(void)
     UtTest_Add(Test_FM_VerifyDirExists, FM_Test_Setup, FM_Test_Teardown, "Test_FM_VerifyDirExists");
     UtTest_Add(Test_FM_VerifyDirNoExist, FM_Test_Setup, FM_Test_Teardown, "Test_FM_VerifyDirNoExist");
     UtTest_Add(Test_FM_VerifyChildTask, FM_Test_Setup, FM_Test_Teardown, "Test_FM_VerifyChildTask");
+    UtTest_Add(Test_FM_GetChildLane, FM_Test_Setup, FM_Test_Teardown, "Test_FM_GetChildLane");
+    UtTest_Add(Test_FM_GetChildLane_BulkPending, FM_Test_Setup, FM_Test_Teardown, "Test_FM_GetChildLane_BulkPending");
+    UtTest_Add(Test_FM_GetChildPathBlocksFree, FM_Test_Setup, FM_Test_Teardown, "Test_FM_GetChildPathBlocksFree");
+    UtTest_Add(Test_FM_StoreChildPath, FM_Test_Setup, FM_Test_Teardown, "Test_FM_StoreChildPath");
+    UtTest_Add(Test_FM_ReleaseChildPath, FM_Test_Setup, FM_Test_Teardown, "Test_FM_ReleaseChildPath");
+    UtTest_Add(Test_FM_PeekChildPath, FM_Test_Setup, FM_Test_Teardown, "Test_FM_PeekChildPath");
+    UtTest_Add(Test_FM_GetSlotPaths, FM_Test_Setup, FM_Test_Teardown, "Test_FM_GetSlotPaths");
+    UtTest_Add(Test_FM_ChildLaneOverlaps, FM_Test_Setup, FM_Test_Teardown, "Test_FM_ChildLaneOverlaps");
     UtTest_Add(Test_FM_InvokeChildTask, FM_Test_Setup, FM_Test_Teardown, "Test_FM_InvokeChildTask");
+    UtTest_Add(Test_FM_InvokeChildTask_CopyThenDelete, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_InvokeChildTask_CopyThenDelete");
+    UtTest_Add(Test_FM_FlushChildQueue, FM_Test_Setup, FM_Test_Teardown, "Test_FM_FlushChildQueue");
+    UtTest_Add(Test_FM_StartRetention, FM_Test_Setup, FM_Test_Teardown, "Test_FM_StartRetention");
+    UtTest_Add(Test_FM_StartPurge, FM_Test_Setup, FM_Test_Teardown, "Test_FM_StartPurge");
     UtTest_Add(Test_FM_AppendPathSep, FM_Test_Setup, FM_Test_Teardown, "Test_FM_AppendPathSep");
+    UtTest_Add(Test_FM_PathsOverlap, FM_Test_Setup, FM_Test_Teardown, "Test_FM_PathsOverlap");
+    UtTest_Add(Test_FM_GetEntryPaths, FM_Test_Setup, FM_Test_Teardown, "Test_FM_GetEntryPaths");
+    UtTest_Add(Test_FM_PathSetsOverlap, FM_Test_Setup, FM_Test_Teardown, "Test_FM_PathSetsOverlap");
+    UtTest_Add(Test_FM_MatchPattern, FM_Test_Setup, FM_Test_Teardown, "Test_FM_MatchPattern");
     UtTest_Add(Test_FM_GetVolumeFreeSpace, FM_Test_Setup, FM_Test_Teardown, "Test_FM_GetVolumeFreeSpace");
     UtTest_Add(Test_FM_GetDirectorySpaceEstimate, FM_Test_Setup, FM_Test_Teardown, "Test_FM_GetDirectorySpaceEstimate");
+    UtTest_Add(Test_FM_LatencyBucket, FM_Test_Setup, FM_Test_Teardown, "Test_FM_LatencyBucket");
+    UtTest_Add(Test_FM_RecordLatency, FM_Test_Setup, FM_Test_Teardown, "Test_FM_RecordLatency");
 }
@@ -99,11 +99,17 @@ void Test_FM_ResetCountersCmd_Success(void)
     bool  Result;
     snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH, "%%s command");
 
-    FM_GlobalData.CommandCounter      = 1;
-    FM_GlobalData.CommandErrCounter   = 1;
-    FM_GlobalData.ChildCmdCounter     = 1;
-    FM_GlobalData.ChildCmdErrCounter  = 1;
-    FM_GlobalData.ChildCmdWarnCounter = 1;
+    FM_GlobalData.CommandCounter    = 1;
+    FM_GlobalData.CommandErrCounter = 1;
+
+    FM_GlobalData.ChildWorker[FM_CHILD_TASK_COUNT - 1].CmdCounter     = 1;
+    FM_GlobalData.ChildWorker[FM_CHILD_TASK_COUNT - 1].CmdErrCounter  = 1;
+    FM_GlobalData.ChildWorker[FM_CHILD_TASK_COUNT - 1].CmdWarnCounter = 1;
+
+    FM_GlobalData.ChildEnqueueCount  = 1;
+    FM_GlobalData.ChildDequeueCount  = 1;
+    FM_GlobalData.ChildQueueWaitLast = 1;
+    FM_GlobalData.ChildQueueWaitMax  = 1;
 
     Result = FM_ResetCountersCmd(&UT_CmdBuf.Buf);
 
@@ -124,9 +130,13 @@ void Test_FM_ResetCountersCmd_Success(void)
 
     UtAssert_INT32_EQ(FM_GlobalData.CommandCounter, 0);
     UtAssert_INT32_EQ(FM_GlobalData.CommandErrCounter, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildCmdCounter, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildCmdErrCounter, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildCmdWarnCounter, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildWorker[FM_CHILD_TASK_COUNT - 1].CmdCounter, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildWorker[FM_CHILD_TASK_COUNT - 1].CmdErrCounter, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildWorker[FM_CHILD_TASK_COUNT - 1].CmdWarnCounter, 0);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildEnqueueCount, 0);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildDequeueCount, 0);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildQueueWaitLast, 0);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildQueueWaitMax, 0);
 }
 
 void add_FM_ResetCountersCmd_tests(void)
@@ -147,8 +157,7 @@ void Test_FM_CopyFileCmd_Success(void)
 
     strncpy(CmdPtr->Source, "src1", sizeof(CmdPtr->Source) - 1);
     strncpy(CmdPtr->Target, "tgt", sizeof(CmdPtr->Target) - 1);
-    FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildStagingEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyOverwrite), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileExists), true);
@@ -164,15 +173,14 @@ void Test_FM_CopyFileCmd_Success(void)
     UtAssert_True(Result == true, "FM_CopyFileCmd returned true");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, FM_COPY_FILE_CC);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildStagingEntry.CommandCode, FM_COPY_FILE_CC);
 }
 
 void Test_FM_CopyFileCmd_BadOverwrite(void)
 {
     bool Result;
 
-    FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildStagingEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyOverwrite), false);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileExists), true);
@@ -188,15 +196,14 @@ void Test_FM_CopyFileCmd_BadOverwrite(void)
     UtAssert_True(Result == false, "FM_CopyFileCmd returned false");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildStagingEntry.CommandCode, 0);
 }
 
 void Test_FM_CopyFileCmd_SourceNotExist(void)
 {
     bool Result;
 
-    FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildStagingEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyOverwrite), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileExists), false);
@@ -212,15 +219,14 @@ void Test_FM_CopyFileCmd_SourceNotExist(void)
     UtAssert_True(Result == false, "FM_CopyFileCmd returned false");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildStagingEntry.CommandCode, 0);
 }
 
 void Test_FM_CopyFileCmd_NoOverwriteTargetExists(void)
 {
     bool Result;
 
-    FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildStagingEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyOverwrite), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileExists), true);
@@ -236,7 +242,7 @@ void Test_FM_CopyFileCmd_NoOverwriteTargetExists(void)
     UtAssert_True(Result == false, "FM_CopyFileCmd returned false");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildStagingEntry.CommandCode, 0);
 }
 
 void Test_FM_CopyFileCmd_OverwriteFileOpen(void)
@@ -247,8 +253,7 @@ void Test_FM_CopyFileCmd_OverwriteFileOpen(void)
     CmdPtr = &UT_CmdBuf.CopyFileCmd.Payload;
 
     CmdPtr->Overwrite                       = 1;
-    FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildStagingEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyOverwrite), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileExists), true);
@@ -264,15 +269,14 @@ void Test_FM_CopyFileCmd_OverwriteFileOpen(void)
     UtAssert_True(Result == false, "FM_CopyFileCmd returned false");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildStagingEntry.CommandCode, 0);
 }
 
 void Test_FM_CopyFileCmd_NoChildTask(void)
 {
     bool Result;
 
-    FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildStagingEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyOverwrite), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileExists), true);
@@ -288,7 +292,7 @@ void Test_FM_CopyFileCmd_NoChildTask(void)
     UtAssert_True(Result == false, "FM_CopyFileCmd returned false");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildStagingEntry.CommandCode, 0);
 }
 
 void add_FM_CopyFileCmd_tests(void)
@@ -317,8 +321,7 @@ void Test_FM_MoveFileCmd_Success(void)
 {
     bool Result;
 
-    FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildStagingEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyOverwrite), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileExists), true);
@@ -334,15 +337,14 @@ void Test_FM_MoveFileCmd_Success(void)
     UtAssert_True(Result == true, "FM_MoveFileCmd returned true");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, FM_MOVE_FILE_CC);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildStagingEntry.CommandCode, FM_MOVE_FILE_CC);
 }
 
 void Test_FM_MoveFileCmd_BadOverwrite(void)
 {
     bool Result;
 
-    FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildStagingEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyOverwrite), false);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileExists), true);
@@ -358,15 +360,14 @@ void Test_FM_MoveFileCmd_BadOverwrite(void)
     UtAssert_True(Result == false, "FM_MoveFileCmd returned false");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildStagingEntry.CommandCode, 0);
 }
 
 void Test_FM_MoveFileCmd_SourceNotExist(void)
 {
     bool Result;
 
-    FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildStagingEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyOverwrite), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileExists), false);
@@ -382,15 +383,14 @@ void Test_FM_MoveFileCmd_SourceNotExist(void)
     UtAssert_True(Result == false, "FM_MoveFileCmd returned false");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildStagingEntry.CommandCode, 0);
 }
 
 void Test_FM_MoveFileCmd_NoOverwriteTargetExists(void)
 {
     bool Result;
 
-    FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildStagingEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyOverwrite), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileExists), true);
@@ -406,7 +406,7 @@ void Test_FM_MoveFileCmd_NoOverwriteTargetExists(void)
     UtAssert_True(Result == false, "FM_MoveFileCmd returned false");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildStagingEntry.CommandCode, 0);
 }
 
 void Test_FM_MoveFileCmd_OverwriteFileOpen(void)
@@ -417,8 +417,7 @@ void Test_FM_MoveFileCmd_OverwriteFileOpen(void)
     CmdPtr = &UT_CmdBuf.MoveFileCmd.Payload;
 
     CmdPtr->Overwrite                       = 1;
-    FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildStagingEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyOverwrite), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileExists), true);
@@ -434,15 +433,14 @@ void Test_FM_MoveFileCmd_OverwriteFileOpen(void)
     UtAssert_True(Result == false, "FM_MoveFileCmd returned false");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildStagingEntry.CommandCode, 0);
 }
 
 void Test_FM_MoveFileCmd_NoChildTask(void)
 {
     bool Result;
 
-    FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildStagingEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyOverwrite), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileExists), true);
@@ -458,7 +456,7 @@ void Test_FM_MoveFileCmd_NoChildTask(void)
     UtAssert_True(Result == false, "FM_MoveFileCmd returned false");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildStagingEntry.CommandCode, 0);
 }
 
 void add_FM_MoveFileCmd_tests(void)
@@ -493,8 +491,7 @@ void Test_FM_RenameFileCmd_Success(void)
     strncpy(CmdPtr->Source, "src1", sizeof(CmdPtr->Source) - 1);
     strncpy(CmdPtr->Target, "tgt", sizeof(CmdPtr->Target) - 1);
 
-    FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildStagingEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileExists), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileNoExist), true);
@@ -508,15 +505,14 @@ void Test_FM_RenameFileCmd_Success(void)
     UtAssert_True(Result == true, "FM_RenameFileCmd returned true");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, FM_RENAME_FILE_CC);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildStagingEntry.CommandCode, FM_RENAME_FILE_CC);
 }
 
 void Test_FM_RenameFileCmd_SourceNotExist(void)
 {
     bool Result;
 
-    FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildStagingEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileExists), false);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileNoExist), true);
@@ -530,15 +526,14 @@ void Test_FM_RenameFileCmd_SourceNotExist(void)
     UtAssert_True(Result == false, "FM_RenameFileCmd returned false");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildStagingEntry.CommandCode, 0);
 }
 
 void Test_FM_RenameFileCmd_TargetExists(void)
 {
     bool Result;
 
-    FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildStagingEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileExists), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileNoExist), false);
@@ -552,15 +547,14 @@ void Test_FM_RenameFileCmd_TargetExists(void)
     UtAssert_True(Result == false, "FM_RenameFileCmd returned false");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildStagingEntry.CommandCode, 0);
 }
 
 void Test_FM_RenameFileCmd_NoChildTask(void)
 {
     bool Result;
 
-    FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildStagingEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileExists), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileNoExist), true);
@@ -574,7 +568,7 @@ void Test_FM_RenameFileCmd_NoChildTask(void)
     UtAssert_True(Result == false, "FM_RenameFileCmd returned false");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildStagingEntry.CommandCode, 0);
 }
 
 void add_FM_RenameFileCmd_tests(void)
@@ -598,8 +592,7 @@ void Test_FM_DeleteFileCmd_Success(void)
 {
     bool Result;
 
-    FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildStagingEntry.CommandCode = 0;
 
     CFE_MSG_FcnCode_t forced_CmdCode = FM_DELETE_FILE_CC;
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &forced_CmdCode, sizeof(forced_CmdCode), false);
@@ -615,15 +608,14 @@ void Test_FM_DeleteFileCmd_Success(void)
     UtAssert_True(Result == true, "FM_DeleteFileCmd returned true");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, FM_DELETE_FILE_CC);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildStagingEntry.CommandCode, FM_DELETE_FILE_CC);
 }
 
 void Test_FM_DeleteFileCmd_FileNotClosed(void)
 {
     bool Result;
 
-    FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildStagingEntry.CommandCode = 0;
 
     CFE_MSG_FcnCode_t forced_CmdCode = FM_DELETE_FILE_CC;
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &forced_CmdCode, sizeof(forced_CmdCode), false);
@@ -639,15 +631,14 @@ void Test_FM_DeleteFileCmd_FileNotClosed(void)
     UtAssert_True(Result == false, "FM_DeleteFileCmd returned false");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildStagingEntry.CommandCode, 0);
 }
 
 void Test_FM_DeleteFileCmd_NoChildTask(void)
 {
     bool Result;
 
-    FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildStagingEntry.CommandCode = 0;
 
     CFE_MSG_FcnCode_t forced_CmdCode = FM_DELETE_FILE_CC;
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &forced_CmdCode, sizeof(forced_CmdCode), false);
@@ -663,7 +654,7 @@ void Test_FM_DeleteFileCmd_NoChildTask(void)
     UtAssert_True(Result == false, "FM_DeleteFileCmd returned false");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildStagingEntry.CommandCode, 0);
 }
 
 void add_FM_DeleteFileCmd_tests(void)
@@ -689,8 +680,7 @@ void Test_FM_DeleteAllFilesCmd_Success(void)
 
     strncpy(CmdPtr->Directory, "dir", sizeof(CmdPtr->Directory) - 1);
 
-    FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildStagingEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyDirExists), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyChildTask), true);
@@ -703,15 +693,14 @@ void Test_FM_DeleteAllFilesCmd_Success(void)
     UtAssert_True(Result == true, "FM_DeleteAllFilesCmd returned true");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, FM_DELETE_ALL_FILES_CC);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildStagingEntry.CommandCode, FM_DELETE_ALL_FILES_CC);
 }
 
 void Test_FM_DeleteAllFilesCmd_DirNoExist(void)
 {
     bool Result;
 
-    FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildStagingEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyDirExists), false);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyChildTask), true);
@@ -724,7 +713,7 @@ void Test_FM_DeleteAllFilesCmd_DirNoExist(void)
     UtAssert_True(Result == false, "FM_DeleteAllFilesCmd returned false");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildStagingEntry.CommandCode, 0);
 }
 
 void Test_FM_DeleteAllFilesCmd_NoChildTask(void)
@@ -735,8 +724,7 @@ void Test_FM_DeleteAllFilesCmd_NoChildTask(void)
     CmdPtr = &UT_CmdBuf.DeleteAllFilesCmd.Payload;
 
     strncpy(CmdPtr->Directory, "dir", sizeof(CmdPtr->Directory) - 1);
-    FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildStagingEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyDirExists), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyChildTask), false);
@@ -749,7 +737,7 @@ void Test_FM_DeleteAllFilesCmd_NoChildTask(void)
     UtAssert_True(Result == false, "FM_DeleteAllFilesCmd returned false");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildStagingEntry.CommandCode, 0);
 }
 
 void add_FM_DeleteAllFilesCmd_tests(void)
@@ -771,8 +759,7 @@ void Test_FM_DecompressFileCmd_Success(void)
 {
     bool Result;
 
-    FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildStagingEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileClosed), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileNoExist), true);
@@ -786,15 +773,14 @@ void Test_FM_DecompressFileCmd_Success(void)
     UtAssert_True(Result == true, "FM_DecompressFileCmd returned true");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, FM_DECOMPRESS_FILE_CC);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildStagingEntry.CommandCode, FM_DECOMPRESS_FILE_CC);
 }
 
 void Test_FM_DecompressFileCmd_SourceFileOpen(void)
 {
     bool Result;
 
-    FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildStagingEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileClosed), false);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileNoExist), true);
@@ -808,15 +794,14 @@ void Test_FM_DecompressFileCmd_SourceFileOpen(void)
     UtAssert_True(Result == false, "FM_DecompressFileCmd returned false");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildStagingEntry.CommandCode, 0);
 }
 
 void Test_FM_DecompressFileCmd_TargetFileExists(void)
 {
     bool Result;
 
-    FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildStagingEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileClosed), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileNoExist), false);
@@ -830,15 +815,14 @@ void Test_FM_DecompressFileCmd_TargetFileExists(void)
     UtAssert_True(Result == false, "FM_DecompressFileCmd returned false");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildStagingEntry.CommandCode, 0);
 }
 
 void Test_FM_DecompressFileCmd_NoChildTask(void)
 {
     bool Result;
 
-    FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildStagingEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileClosed), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileNoExist), true);
@@ -852,7 +836,7 @@ void Test_FM_DecompressFileCmd_NoChildTask(void)
     UtAssert_True(Result == false, "FM_DecompressFileCmd returned false");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildStagingEntry.CommandCode, 0);
 }
 
 void add_FM_DecompressFileCmd_tests(void)
@@ -884,8 +868,7 @@ void Test_FM_ConcatFilesCmd_Success(void)
     strncpy(CmdPtr->Source2, "src2", sizeof(CmdPtr->Source2) - 1);
     strncpy(CmdPtr->Target, "tgt", sizeof(CmdPtr->Target) - 1);
 
-    FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildStagingEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileClosed), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileNoExist), true);
@@ -899,15 +882,14 @@ void Test_FM_ConcatFilesCmd_Success(void)
     UtAssert_True(Result == true, "FM_ConcatFilesCmd returned true");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, FM_CONCAT_FILES_CC);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildStagingEntry.CommandCode, FM_CONCAT_FILES_CC);
 }
 
 void Test_FM_ConcatFilesCmd_SourceFile1NotClosed(void)
 {
     bool Result;
 
-    FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildStagingEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileClosed), false);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileNoExist), true);
@@ -920,15 +902,14 @@ void Test_FM_ConcatFilesCmd_SourceFile1NotClosed(void)
     UtAssert_True(Result == false, "FM_ConcatFilesCmd returned false");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildStagingEntry.CommandCode, 0);
 }
 
 void Test_FM_ConcatFilesCmd_SourceFile2NotClosed(void)
 {
     bool Result;
 
-    FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildStagingEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileClosed), true);
     UT_SetDeferredRetcode(UT_KEY(FM_VerifyFileClosed), 2, false);
@@ -942,15 +923,14 @@ void Test_FM_ConcatFilesCmd_SourceFile2NotClosed(void)
     UtAssert_True(Result == false, "FM_ConcatFilesCmd returned false");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildStagingEntry.CommandCode, 0);
 }
 
 void Test_FM_ConcatFilesCmd_TargetFileExists(void)
 {
     bool Result;
 
-    FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildStagingEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileClosed), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileNoExist), false);
@@ -963,15 +943,14 @@ void Test_FM_ConcatFilesCmd_TargetFileExists(void)
     UtAssert_True(Result == false, "FM_ConcatFilesCmd returned false");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildStagingEntry.CommandCode, 0);
 }
 
 void Test_FM_ConcatFilesCmd_NoChildTask(void)
 {
     bool Result;
 
-    FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildStagingEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileClosed), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileNoExist), true);
@@ -984,7 +963,7 @@ void Test_FM_ConcatFilesCmd_NoChildTask(void)
     UtAssert_True(Result == false, "FM_ConcatFilesCmd returned false");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildStagingEntry.CommandCode, 0);
 }
 
 void add_FM_ConcatFilesCmd_tests(void)
@@ -1017,8 +996,7 @@ void Test_FM_GetFileInfoCmd_Success(void)
 
     strncpy(CmdPtr->Filename, "file", sizeof(CmdPtr->Filename) - 1);
 
-    FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildStagingEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyNameValid), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyChildTask), true);
@@ -1031,15 +1009,14 @@ void Test_FM_GetFileInfoCmd_Success(void)
     UtAssert_True(Result == true, "FM_GetFileInfoCmd returned true");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, FM_GET_FILE_INFO_CC);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildStagingEntry.CommandCode, FM_GET_FILE_INFO_CC);
 }
 
 void Test_FM_GetFileInfoCmd_InvalidName(void)
 {
     bool Result;
 
-    FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildStagingEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyNameValid), false);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyChildTask), true);
@@ -1052,15 +1029,14 @@ void Test_FM_GetFileInfoCmd_InvalidName(void)
     UtAssert_True(Result == false, "FM_GetFileInfoCmd returned false");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildStagingEntry.CommandCode, 0);
 }
 
 void Test_FM_GetFileInfoCmd_NoChildTask(void)
 {
     bool Result;
 
-    FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildStagingEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyNameValid), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyChildTask), false);
@@ -1073,7 +1049,7 @@ void Test_FM_GetFileInfoCmd_NoChildTask(void)
     UtAssert_True(Result == false, "FM_GetFileInfoCmd returned false");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildStagingEntry.CommandCode, 0);
 }
 
 void add_FM_GetFileInfoCmd_tests(void)
@@ -1132,8 +1108,7 @@ void Test_FM_CreateDirectoryCmd_Success(void)
     CmdPtr = &UT_CmdBuf.CreateDirectoryCmd.Payload;
 
     strncpy(CmdPtr->Directory, "dir", sizeof(CmdPtr->Directory) - 1);
-    FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildStagingEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyDirNoExist), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyChildTask), true);
@@ -1146,15 +1121,14 @@ void Test_FM_CreateDirectoryCmd_Success(void)
     UtAssert_True(Result == true, "FM_CreateDirectoryCmd returned true");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, FM_CREATE_DIRECTORY_CC);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildStagingEntry.CommandCode, FM_CREATE_DIRECTORY_CC);
 }
 
 void Test_FM_CreateDirectoryCmd_DirExists(void)
 {
     bool Result;
 
-    FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildStagingEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyDirNoExist), false);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyChildTask), true);
@@ -1167,15 +1141,14 @@ void Test_FM_CreateDirectoryCmd_DirExists(void)
     UtAssert_True(Result == false, "FM_CreateDirectoryCmd returned false");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildStagingEntry.CommandCode, 0);
 }
 
 void Test_FM_CreateDirectoryCmd_NoChildTask(void)
 {
     bool Result;
 
-    FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildStagingEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyDirNoExist), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyChildTask), false);
@@ -1188,7 +1161,7 @@ void Test_FM_CreateDirectoryCmd_NoChildTask(void)
     UtAssert_True(Result == false, "FM_CreateDirectoryCmd returned false");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildStagingEntry.CommandCode, 0);
 }
 
 void add_FM_CreateDirectoryCmd_tests(void)
@@ -1215,8 +1188,7 @@ void Test_FM_DeleteDirectoryCmd_Success(void)
     CmdPtr = &UT_CmdBuf.DeleteDirectoryCmd.Payload;
 
     strncpy(CmdPtr->Directory, "dir", sizeof(CmdPtr->Directory) - 1);
-    FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildStagingEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyDirExists), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyChildTask), true);
@@ -1229,15 +1201,14 @@ void Test_FM_DeleteDirectoryCmd_Success(void)
     UtAssert_True(Result == true, "FM_DeleteDirectoryCmd returned true");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, FM_DELETE_DIRECTORY_CC);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildStagingEntry.CommandCode, FM_DELETE_DIRECTORY_CC);
 }
 
 void Test_FM_DeleteDirectoryCmd_DirNoExist(void)
 {
     bool Result;
 
-    FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildStagingEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyDirExists), false);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyChildTask), true);
@@ -1250,15 +1221,14 @@ void Test_FM_DeleteDirectoryCmd_DirNoExist(void)
     UtAssert_True(Result == false, "FM_DeleteDirectoryCmd returned false");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildStagingEntry.CommandCode, 0);
 }
 
 void Test_FM_DeleteDirectoryCmd_NoChildTask(void)
 {
     bool Result;
 
-    FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildStagingEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyDirExists), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyChildTask), false);
@@ -1271,7 +1241,7 @@ void Test_FM_DeleteDirectoryCmd_NoChildTask(void)
     UtAssert_True(Result == false, "FM_DeleteDirectoryCmd returned false");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildStagingEntry.CommandCode, 0);
 }
 
 void add_FM_DeleteDirectoryCmd_tests(void)
@@ -1299,8 +1269,7 @@ void Test_FM_GetDirListFileCmd_Success(void)
 
     strncpy(CmdPtr->Filename, "file", sizeof(CmdPtr->Filename) - 1);
     strncpy(CmdPtr->Directory, "dir", sizeof(CmdPtr->Directory) - 1);
-    FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildStagingEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyDirExists), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileNotOpen), true);
@@ -1314,7 +1283,7 @@ void Test_FM_GetDirListFileCmd_Success(void)
     UtAssert_True(Result == true, "FM_GetDirListFileCmd returned true");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, FM_GET_DIR_LIST_FILE_CC);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildStagingEntry.CommandCode, FM_GET_DIR_LIST_FILE_CC);
 }
 
 void Test_FM_GetDirListFileCmd_SuccessDefaultPath(void)
@@ -1326,8 +1295,7 @@ void Test_FM_GetDirListFileCmd_SuccessDefaultPath(void)
 
     strncpy(CmdPtr->Directory, "dir", sizeof(CmdPtr->Directory) - 1);
     CmdPtr->Filename[0]                     = '\0';
-    FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildStagingEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyDirExists), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileNotOpen), true);
@@ -1341,15 +1309,14 @@ void Test_FM_GetDirListFileCmd_SuccessDefaultPath(void)
     UtAssert_True(Result == true, "FM_GetDirListFileCmd returned true");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, FM_GET_DIR_LIST_FILE_CC);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildStagingEntry.CommandCode, FM_GET_DIR_LIST_FILE_CC);
 }
 
 void Test_FM_GetDirListFileCmd_SourceNotExist(void)
 {
     bool Result;
 
-    FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildStagingEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyDirExists), false);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileNotOpen), true);
@@ -1363,7 +1330,7 @@ void Test_FM_GetDirListFileCmd_SourceNotExist(void)
     UtAssert_True(Result == false, "FM_GetDirListFileCmd returned false");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildStagingEntry.CommandCode, 0);
 }
 
 void Test_FM_GetDirListFileCmd_TargetFileOpen(void)
@@ -1376,8 +1343,7 @@ void Test_FM_GetDirListFileCmd_TargetFileOpen(void)
     strncpy(CmdPtr->Filename, "file", sizeof(CmdPtr->Filename) - 1);
     strncpy(CmdPtr->Directory, "dir", sizeof(CmdPtr->Directory) - 1);
 
-    FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildStagingEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyDirExists), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileNotOpen), false);
@@ -1391,7 +1357,7 @@ void Test_FM_GetDirListFileCmd_TargetFileOpen(void)
     UtAssert_True(Result == false, "FM_GetDirListFileCmd returned false");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildStagingEntry.CommandCode, 0);
 }
 
 void Test_FM_GetDirListFileCmd_NoChildTask(void)
@@ -1404,8 +1370,7 @@ void Test_FM_GetDirListFileCmd_NoChildTask(void)
     strncpy(CmdPtr->Filename, "file", sizeof(CmdPtr->Filename) - 1);
     strncpy(CmdPtr->Directory, "dir", sizeof(CmdPtr->Directory) - 1);
 
-    FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildStagingEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyDirExists), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileNotOpen), true);
@@ -1419,7 +1384,7 @@ void Test_FM_GetDirListFileCmd_NoChildTask(void)
     UtAssert_True(Result == false, "FM_GetDirListFileCmd returned false");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildStagingEntry.CommandCode, 0);
 }
 
 void add_FM_GetDirListFileCmd_tests(void)
@@ -1452,8 +1417,7 @@ void Test_FM_GetDirListPktCmd_Success(void)
 
     strncpy(CmdPtr->Directory, "dir", sizeof(CmdPtr->Directory) - 1);
 
-    FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildStagingEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyDirExists), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyChildTask), true);
@@ -1466,15 +1430,14 @@ void Test_FM_GetDirListPktCmd_Success(void)
     UtAssert_True(Result == true, "FM_GetDirListPktCmd returned true");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, FM_GET_DIR_LIST_PKT_CC);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildStagingEntry.CommandCode, FM_GET_DIR_LIST_PKT_CC);
 }
 
 void Test_FM_GetDirListPktCmd_SourceNotExist(void)
 {
     bool Result;
 
-    FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildStagingEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyDirExists), false);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyChildTask), true);
@@ -1487,15 +1450,14 @@ void Test_FM_GetDirListPktCmd_SourceNotExist(void)
     UtAssert_True(Result == false, "FM_GetDirListPktCmd returned false");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildStagingEntry.CommandCode, 0);
 }
 
 void Test_FM_GetDirListPktCmd_NoChildTask(void)
 {
     bool Result;
 
-    FM_GlobalData.ChildWriteIndex           = 0;
-    FM_GlobalData.ChildQueue[0].CommandCode = 0;
+    FM_GlobalData.ChildStagingEntry.CommandCode = 0;
 
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyDirExists), true);
     UT_SetDefaultReturnValue(UT_KEY(FM_VerifyChildTask), false);
@@ -1508,7 +1470,7 @@ void Test_FM_GetDirListPktCmd_NoChildTask(void)
     UtAssert_True(Result == false, "FM_GetDirListPktCmd returned false");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildStagingEntry.CommandCode, 0);
 }
 
 void add_FM_GetDirListPktCmd_tests(void)
@@ -1942,7 +1904,7 @@ void Test_FM_SetPermissionsCmd_Success(void)
     UtAssert_True(Result == true, "FM_SetPermissionsCmd returned true");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, FM_SET_PERMISSIONS_CC);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildStagingEntry.CommandCode, FM_SET_PERMISSIONS_CC);
 }
 
 void Test_FM_SetPermissionsCmd_BadName(void)
@@ -1960,7 +1922,7 @@ void Test_FM_SetPermissionsCmd_BadName(void)
     UtAssert_True(Result == false, "FM_SetPermissionsCmd returned false");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildStagingEntry.CommandCode, 0);
 }
 
 void Test_FM_SetPermissionsCmd_NoChildTask(void)
@@ -1978,7 +1940,7 @@ void Test_FM_SetPermissionsCmd_NoChildTask(void)
     UtAssert_True(Result == false, "FM_SetPermissionsCmd returned false");
 
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
-    UtAssert_INT32_EQ(FM_GlobalData.ChildQueue[0].CommandCode, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildStagingEntry.CommandCode, 0);
 }
 
 void add_FM_SetPermissionsCmd_tests(void)
@@ -1991,6 +1953,1130 @@ void add_FM_SetPermissionsCmd_tests(void)
                "Test_FM_SetPermissionsCmd_NoChildTask");
 }
 
+/****************************/
+/* Set Copy Block Size      */
+/****************************/
+
+void Test_FM_SetCopyBlockSizeCmd_Success(void)
+{
+    FM_CopyBlockSize_Payload_t *CmdPtr = &UT_CmdBuf.SetCopyBlockSizeCmd.Payload;
+
+    CmdPtr->BlockSize = FM_CHILD_FILE_BLOCK_SIZE;
+
+    /* Act */
+    UtAssert_BOOL_TRUE(FM_SetCopyBlockSizeCmd(&UT_CmdBuf.Buf));
+
+    /* Assert */
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildCopyBlockSize, FM_CHILD_FILE_BLOCK_SIZE);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_SET_COPY_BLOCK_CMD_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+}
+
+void Test_FM_SetCopyBlockSizeCmd_TooSmall(void)
+{
+    FM_CopyBlockSize_Payload_t *CmdPtr = &UT_CmdBuf.SetCopyBlockSizeCmd.Payload;
+
+    CmdPtr->BlockSize                = FM_CHILD_FILE_BLOCK_SIZE - 1;
+    FM_GlobalData.ChildCopyBlockSize = FM_CHILD_COPY_BUFFER_SIZE;
+
+    /* Act */
+    UtAssert_BOOL_FALSE(FM_SetCopyBlockSizeCmd(&UT_CmdBuf.Buf));
+
+    /* Assert */
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildCopyBlockSize, FM_CHILD_COPY_BUFFER_SIZE);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_SET_COPY_BLOCK_ARG_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void Test_FM_SetCopyBlockSizeCmd_TooLarge(void)
+{
+    FM_CopyBlockSize_Payload_t *CmdPtr = &UT_CmdBuf.SetCopyBlockSizeCmd.Payload;
+
+    CmdPtr->BlockSize                = FM_CHILD_COPY_BUFFER_SIZE + 1;
+    FM_GlobalData.ChildCopyBlockSize = FM_CHILD_COPY_BUFFER_SIZE;
+
+    /* Act */
+    UtAssert_BOOL_FALSE(FM_SetCopyBlockSizeCmd(&UT_CmdBuf.Buf));
+
+    /* Assert */
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildCopyBlockSize, FM_CHILD_COPY_BUFFER_SIZE);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_SET_COPY_BLOCK_ARG_ERR_EID);
+}
+
+void add_FM_SetCopyBlockSizeCmd_tests(void)
+{
+    UtTest_Add(Test_FM_SetCopyBlockSizeCmd_Success, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_SetCopyBlockSizeCmd_Success");
+
+    UtTest_Add(Test_FM_SetCopyBlockSizeCmd_TooSmall, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_SetCopyBlockSizeCmd_TooSmall");
+
+    UtTest_Add(Test_FM_SetCopyBlockSizeCmd_TooLarge, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_SetCopyBlockSizeCmd_TooLarge");
+}
+
+/****************************/
+/* Concat List              */
+/****************************/
+
+void Test_FM_ConcatListCmd_InlineSuccess(void)
+{
+    FM_ConcatList_Payload_t *CmdPtr = &UT_CmdBuf.ConcatListCmd.Payload;
+
+    CmdPtr->SourceCount = 2;
+    strncpy(CmdPtr->Source[0], "src1", sizeof(CmdPtr->Source[0]) - 1);
+    strncpy(CmdPtr->Source[1], "src2", sizeof(CmdPtr->Source[1]) - 1);
+    strncpy(CmdPtr->Target, "tgt", sizeof(CmdPtr->Target) - 1);
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileClosed), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileNoExist), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyChildTask), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_GetChildPathBlocksFree), FM_CHILD_PATH_BLOCK_COUNT);
+
+    /* Act */
+    UtAssert_BOOL_TRUE(FM_ConcatListCmd(&UT_CmdBuf.Buf));
+
+    /* Assert - the inline names are queued as one list */
+    UtAssert_STUB_COUNT(FM_VerifyFileClosed, 2);
+    UtAssert_STUB_COUNT(FM_InvokeChildTask, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildStagingEntry.CommandCode, FM_CONCAT_LIST_CC);
+    UtAssert_STRINGBUF_EQ(FM_GlobalData.ChildStagingEntry.Source1, sizeof(FM_GlobalData.ChildStagingEntry.Source1),
+                          "", -1);
+    UtAssert_STRINGBUF_EQ(FM_GlobalData.ChildStagingEntry.SourceList,
+                          sizeof(FM_GlobalData.ChildStagingEntry.SourceList), "src1\nsrc2", -1);
+}
+
+void Test_FM_ConcatListCmd_ListFileSuccess(void)
+{
+    FM_ConcatList_Payload_t *CmdPtr = &UT_CmdBuf.ConcatListCmd.Payload;
+
+    strncpy(CmdPtr->ListFile, "list", sizeof(CmdPtr->ListFile) - 1);
+    strncpy(CmdPtr->Target, "tgt", sizeof(CmdPtr->Target) - 1);
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileClosed), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileNoExist), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyChildTask), true);
+
+    /* Act */
+    UtAssert_BOOL_TRUE(FM_ConcatListCmd(&UT_CmdBuf.Buf));
+
+    /* Assert - the inline source count is ignored */
+    UtAssert_STUB_COUNT(FM_VerifyFileClosed, 1);
+    UtAssert_STUB_COUNT(FM_GetChildPathBlocksFree, 0);
+    UtAssert_STUB_COUNT(FM_InvokeChildTask, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildStagingEntry.CommandCode, FM_CONCAT_LIST_CC);
+    UtAssert_STRINGBUF_EQ(FM_GlobalData.ChildStagingEntry.Source1, sizeof(FM_GlobalData.ChildStagingEntry.Source1),
+                          "list", -1);
+}
+
+void Test_FM_ConcatListCmd_BadSourceCount(void)
+{
+    FM_ConcatList_Payload_t *CmdPtr = &UT_CmdBuf.ConcatListCmd.Payload;
+
+    CmdPtr->SourceCount = FM_CONCAT_LIST_INLINE_MAX + 1;
+
+    /* Act */
+    UtAssert_BOOL_FALSE(FM_ConcatListCmd(&UT_CmdBuf.Buf));
+
+    /* Assert */
+    UtAssert_STUB_COUNT(FM_InvokeChildTask, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CONCAT_LIST_ARG_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void Test_FM_ConcatListCmd_SourceNotClosed(void)
+{
+    FM_ConcatList_Payload_t *CmdPtr = &UT_CmdBuf.ConcatListCmd.Payload;
+
+    CmdPtr->SourceCount = 3;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileClosed), true);
+    UT_SetDeferredRetcode(UT_KEY(FM_VerifyFileClosed), 2, false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileNoExist), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyChildTask), true);
+
+    /* Act */
+    UtAssert_BOOL_FALSE(FM_ConcatListCmd(&UT_CmdBuf.Buf));
+
+    /* Assert - verification stops at the first unusable source */
+    UtAssert_STUB_COUNT(FM_VerifyFileClosed, 2);
+    UtAssert_STUB_COUNT(FM_VerifyFileNoExist, 0);
+    UtAssert_STUB_COUNT(FM_InvokeChildTask, 0);
+}
+
+void Test_FM_ConcatListCmd_TargetFileExists(void)
+{
+    FM_ConcatList_Payload_t *CmdPtr = &UT_CmdBuf.ConcatListCmd.Payload;
+
+    CmdPtr->SourceCount = 2;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileClosed), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileNoExist), false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyChildTask), true);
+
+    /* Act */
+    UtAssert_BOOL_FALSE(FM_ConcatListCmd(&UT_CmdBuf.Buf));
+
+    /* Assert */
+    UtAssert_STUB_COUNT(FM_VerifyChildTask, 0);
+    UtAssert_STUB_COUNT(FM_InvokeChildTask, 0);
+}
+
+void Test_FM_ConcatListCmd_NoChildTask(void)
+{
+    FM_ConcatList_Payload_t *CmdPtr = &UT_CmdBuf.ConcatListCmd.Payload;
+
+    CmdPtr->SourceCount = 2;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileClosed), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileNoExist), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyChildTask), false);
+
+    /* Act */
+    UtAssert_BOOL_FALSE(FM_ConcatListCmd(&UT_CmdBuf.Buf));
+
+    /* Assert */
+    UtAssert_STUB_COUNT(FM_InvokeChildTask, 0);
+}
+
+void Test_FM_ConcatListCmd_NoFreePathBlocks(void)
+{
+    FM_ConcatList_Payload_t *CmdPtr = &UT_CmdBuf.ConcatListCmd.Payload;
+
+    CmdPtr->SourceCount = 2;
+    strncpy(CmdPtr->Source[0], "src1", sizeof(CmdPtr->Source[0]) - 1);
+    strncpy(CmdPtr->Source[1], "src2", sizeof(CmdPtr->Source[1]) - 1);
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileClosed), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileNoExist), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyChildTask), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_GetChildPathBlocksFree), FM_CHILD_PATH_BLOCKS_PER_CMD);
+
+    /* Act */
+    UtAssert_BOOL_FALSE(FM_ConcatListCmd(&UT_CmdBuf.Buf));
+
+    /* Assert */
+    UtAssert_STUB_COUNT(FM_InvokeChildTask, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_CONCAT_LIST_CHILD_FULL_ERR_EID);
+}
+
+void add_FM_ConcatListCmd_tests(void)
+{
+    UtTest_Add(Test_FM_ConcatListCmd_InlineSuccess, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ConcatListCmd_InlineSuccess");
+
+    UtTest_Add(Test_FM_ConcatListCmd_ListFileSuccess, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ConcatListCmd_ListFileSuccess");
+
+    UtTest_Add(Test_FM_ConcatListCmd_BadSourceCount, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ConcatListCmd_BadSourceCount");
+
+    UtTest_Add(Test_FM_ConcatListCmd_SourceNotClosed, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ConcatListCmd_SourceNotClosed");
+
+    UtTest_Add(Test_FM_ConcatListCmd_TargetFileExists, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ConcatListCmd_TargetFileExists");
+
+    UtTest_Add(Test_FM_ConcatListCmd_NoChildTask, FM_Test_Setup, FM_Test_Teardown, "Test_FM_ConcatListCmd_NoChildTask");
+
+    UtTest_Add(Test_FM_ConcatListCmd_NoFreePathBlocks, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ConcatListCmd_NoFreePathBlocks");
+}
+
+/****************************/
+/* Set Throttle             */
+/****************************/
+
+void Test_FM_SetThrottleCmd_Default(void)
+{
+    FM_Throttle_Payload_t *CmdPtr = &UT_CmdBuf.SetThrottleCmd.Payload;
+
+    CmdPtr->ByteRate = FM_THROTTLE_RATE_UNLIMITED;
+    CmdPtr->StatRate = 100;
+
+    FM_GlobalData.ChildThrottle[FM_CHILD_THROTTLE_DEFAULT].ByteRate = FM_CHILD_THROTTLE_BYTE_RATE;
+
+    /* Act */
+    UtAssert_BOOL_TRUE(FM_SetThrottleCmd(&UT_CmdBuf.Buf));
+
+    /* Assert */
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildThrottle[FM_CHILD_THROTTLE_DEFAULT].ByteRate, FM_THROTTLE_RATE_UNLIMITED);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildThrottle[FM_CHILD_THROTTLE_DEFAULT].StatRate, 100);
+    UtAssert_STUB_COUNT(OS_MutSemTake, 1);
+    UtAssert_STUB_COUNT(OS_MutSemGive, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_SET_THROTTLE_CMD_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+}
+
+void Test_FM_SetThrottleCmd_NewVolume(void)
+{
+    FM_Throttle_Payload_t *CmdPtr = &UT_CmdBuf.SetThrottleCmd.Payload;
+
+    strncpy(CmdPtr->Volume, "/cf", sizeof(CmdPtr->Volume) - 1);
+    CmdPtr->ByteRate = FM_CHILD_FILE_BLOCK_SIZE;
+    CmdPtr->StatRate = FM_THROTTLE_RATE_DEFAULT;
+
+    /* The first volume entry is in use by another volume */
+    strncpy(FM_GlobalData.ChildThrottle[1].Volume, "/ram", sizeof(FM_GlobalData.ChildThrottle[1].Volume) - 1);
+
+    /* Act */
+    UtAssert_BOOL_TRUE(FM_SetThrottleCmd(&UT_CmdBuf.Buf));
+
+    /* Assert */
+    UtAssert_STRINGBUF_EQ(FM_GlobalData.ChildThrottle[2].Volume, sizeof(FM_GlobalData.ChildThrottle[2].Volume), "/cf",
+                          -1);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildThrottle[2].ByteRate, FM_CHILD_FILE_BLOCK_SIZE);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildThrottle[2].StatRate, FM_THROTTLE_RATE_DEFAULT);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_SET_THROTTLE_CMD_INF_EID);
+}
+
+void Test_FM_SetThrottleCmd_UpdateVolume(void)
+{
+    FM_Throttle_Payload_t *CmdPtr = &UT_CmdBuf.SetThrottleCmd.Payload;
+
+    strncpy(CmdPtr->Volume, "/cf", sizeof(CmdPtr->Volume) - 1);
+    CmdPtr->ByteRate = FM_THROTTLE_RATE_UNLIMITED;
+    CmdPtr->StatRate = 10;
+
+    /* A free entry ahead of the entry already used by the volume */
+    strncpy(FM_GlobalData.ChildThrottle[2].Volume, "/cf", sizeof(FM_GlobalData.ChildThrottle[2].Volume) - 1);
+    FM_GlobalData.ChildThrottle[2].ByteRate = FM_CHILD_FILE_BLOCK_SIZE;
+
+    /* Act */
+    UtAssert_BOOL_TRUE(FM_SetThrottleCmd(&UT_CmdBuf.Buf));
+
+    /* Assert */
+    UtAssert_STRINGBUF_EQ(FM_GlobalData.ChildThrottle[1].Volume, sizeof(FM_GlobalData.ChildThrottle[1].Volume), "",
+                          -1);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildThrottle[2].ByteRate, FM_THROTTLE_RATE_UNLIMITED);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildThrottle[2].StatRate, 10);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_SET_THROTTLE_CMD_INF_EID);
+}
+
+void Test_FM_SetThrottleCmd_RemoveVolume(void)
+{
+    FM_Throttle_Payload_t *CmdPtr = &UT_CmdBuf.SetThrottleCmd.Payload;
+
+    strncpy(CmdPtr->Volume, "/cf", sizeof(CmdPtr->Volume) - 1);
+    CmdPtr->ByteRate = FM_THROTTLE_RATE_DEFAULT;
+    CmdPtr->StatRate = FM_THROTTLE_RATE_DEFAULT;
+
+    strncpy(FM_GlobalData.ChildThrottle[1].Volume, "/cf", sizeof(FM_GlobalData.ChildThrottle[1].Volume) - 1);
+    FM_GlobalData.ChildThrottle[1].ByteRate   = FM_CHILD_FILE_BLOCK_SIZE;
+    FM_GlobalData.ChildThrottle[1].ByteTokens = -1;
+
+    /* Act */
+    UtAssert_BOOL_TRUE(FM_SetThrottleCmd(&UT_CmdBuf.Buf));
+
+    /* Assert */
+    UtAssert_STRINGBUF_EQ(FM_GlobalData.ChildThrottle[1].Volume, sizeof(FM_GlobalData.ChildThrottle[1].Volume), "",
+                          -1);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildThrottle[1].ByteRate, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildThrottle[1].ByteTokens, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_SET_THROTTLE_CMD_INF_EID);
+}
+
+void Test_FM_SetThrottleCmd_VolumeTableFull(void)
+{
+    FM_Throttle_Payload_t *CmdPtr = &UT_CmdBuf.SetThrottleCmd.Payload;
+    uint32                 i;
+
+    strncpy(CmdPtr->Volume, "/cf", sizeof(CmdPtr->Volume) - 1);
+    CmdPtr->ByteRate = FM_CHILD_FILE_BLOCK_SIZE;
+
+    for (i = FM_CHILD_THROTTLE_DEFAULT + 1; i < FM_CHILD_THROTTLE_ENTRIES; i++)
+    {
+        snprintf(FM_GlobalData.ChildThrottle[i].Volume, sizeof(FM_GlobalData.ChildThrottle[i].Volume), "/ram%u",
+                 (unsigned int)i);
+    }
+
+    /* Act */
+    UtAssert_BOOL_FALSE(FM_SetThrottleCmd(&UT_CmdBuf.Buf));
+
+    /* Assert */
+    UtAssert_STUB_COUNT(OS_MutSemGive, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_SET_THROTTLE_ARG_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void Test_FM_SetThrottleCmd_BadVolume(void)
+{
+    FM_Throttle_Payload_t *CmdPtr = &UT_CmdBuf.SetThrottleCmd.Payload;
+
+    strncpy(CmdPtr->Volume, "cf", sizeof(CmdPtr->Volume) - 1);
+
+    /* Act */
+    UtAssert_BOOL_FALSE(FM_SetThrottleCmd(&UT_CmdBuf.Buf));
+
+    /* Assert */
+    UtAssert_STUB_COUNT(OS_MutSemTake, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_SET_THROTTLE_ARG_ERR_EID);
+}
+
+void Test_FM_SetThrottleCmd_VolumeNotTerminated(void)
+{
+    FM_Throttle_Payload_t *CmdPtr = &UT_CmdBuf.SetThrottleCmd.Payload;
+
+    memset(CmdPtr->Volume, '/', sizeof(CmdPtr->Volume));
+
+    /* Act */
+    UtAssert_BOOL_FALSE(FM_SetThrottleCmd(&UT_CmdBuf.Buf));
+
+    /* Assert */
+    UtAssert_STUB_COUNT(OS_MutSemTake, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_SET_THROTTLE_ARG_ERR_EID);
+}
+
+void Test_FM_SetThrottleCmd_DefaultFollowsDefault(void)
+{
+    FM_Throttle_Payload_t *CmdPtr = &UT_CmdBuf.SetThrottleCmd.Payload;
+
+    CmdPtr->ByteRate = FM_CHILD_FILE_BLOCK_SIZE;
+    CmdPtr->StatRate = FM_THROTTLE_RATE_DEFAULT;
+
+    /* Act */
+    UtAssert_BOOL_FALSE(FM_SetThrottleCmd(&UT_CmdBuf.Buf));
+
+    /* Assert */
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildThrottle[FM_CHILD_THROTTLE_DEFAULT].ByteRate, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_SET_THROTTLE_ARG_ERR_EID);
+}
+
+void Test_FM_SetThrottleCmd_ByteRateTooSmall(void)
+{
+    FM_Throttle_Payload_t *CmdPtr = &UT_CmdBuf.SetThrottleCmd.Payload;
+
+    CmdPtr->ByteRate = FM_CHILD_FILE_BLOCK_SIZE - 1;
+
+    /* Act */
+    UtAssert_BOOL_FALSE(FM_SetThrottleCmd(&UT_CmdBuf.Buf));
+
+    /* Assert */
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildThrottle[FM_CHILD_THROTTLE_DEFAULT].ByteRate, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_SET_THROTTLE_ARG_ERR_EID);
+}
+
+void add_FM_SetThrottleCmd_tests(void)
+{
+    UtTest_Add(Test_FM_SetThrottleCmd_Default, FM_Test_Setup, FM_Test_Teardown, "Test_FM_SetThrottleCmd_Default");
+
+    UtTest_Add(Test_FM_SetThrottleCmd_NewVolume, FM_Test_Setup, FM_Test_Teardown, "Test_FM_SetThrottleCmd_NewVolume");
+
+    UtTest_Add(Test_FM_SetThrottleCmd_UpdateVolume, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_SetThrottleCmd_UpdateVolume");
+
+    UtTest_Add(Test_FM_SetThrottleCmd_RemoveVolume, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_SetThrottleCmd_RemoveVolume");
+
+    UtTest_Add(Test_FM_SetThrottleCmd_VolumeTableFull, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_SetThrottleCmd_VolumeTableFull");
+
+    UtTest_Add(Test_FM_SetThrottleCmd_BadVolume, FM_Test_Setup, FM_Test_Teardown, "Test_FM_SetThrottleCmd_BadVolume");
+
+    UtTest_Add(Test_FM_SetThrottleCmd_VolumeNotTerminated, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_SetThrottleCmd_VolumeNotTerminated");
+
+    UtTest_Add(Test_FM_SetThrottleCmd_DefaultFollowsDefault, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_SetThrottleCmd_DefaultFollowsDefault");
+
+    UtTest_Add(Test_FM_SetThrottleCmd_ByteRateTooSmall, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_SetThrottleCmd_ByteRateTooSmall");
+}
+
+/****************************/
+/* Abort                    */
+/****************************/
+
+void Test_FM_AbortCmd_AllChildTasks(void)
+{
+    FM_Abort_Payload_t *CmdPtr = &UT_CmdBuf.AbortCmd.Payload;
+    FM_ChildWorker_t *  Busy   = &FM_GlobalData.ChildWorker[FM_CHILD_TASK_COUNT - 1];
+
+    CmdPtr->ChildTask = FM_ABORT_ALL_CHILD_TASKS;
+
+    Busy->CurrentCC   = FM_GET_FILE_INFO_CC;
+    Busy->CmdSequence = 7;
+
+    /* Act */
+    UtAssert_BOOL_TRUE(FM_AbortCmd(&UT_CmdBuf.Buf));
+
+    /* Assert */
+    UtAssert_UINT32_EQ(Busy->AbortSequence, 7);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_ABORT_CMD_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+}
+
+#if (FM_CHILD_TASK_COUNT > 1)
+void Test_FM_AbortCmd_OneChildTask(void)
+{
+    FM_Abort_Payload_t *CmdPtr = &UT_CmdBuf.AbortCmd.Payload;
+    FM_ChildWorker_t *  Target = &FM_GlobalData.ChildWorker[0];
+    FM_ChildWorker_t *  Other  = &FM_GlobalData.ChildWorker[FM_CHILD_TASK_COUNT - 1];
+
+    CmdPtr->ChildTask = 0;
+
+    Target->CurrentCC   = FM_COPY_FILE_CC;
+    Target->CmdSequence = 3;
+    Other->CurrentCC    = FM_CONCAT_FILES_CC;
+    Other->CmdSequence  = 5;
+
+    /* Act */
+    UtAssert_BOOL_TRUE(FM_AbortCmd(&UT_CmdBuf.Buf));
+
+    /* Assert */
+    UtAssert_UINT32_EQ(Target->AbortSequence, 3);
+    UtAssert_UINT32_EQ(Other->AbortSequence, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_ABORT_CMD_INF_EID);
+}
+#endif
+
+void Test_FM_AbortCmd_Idle(void)
+{
+    FM_Abort_Payload_t *CmdPtr = &UT_CmdBuf.AbortCmd.Payload;
+    FM_ChildWorker_t *  Idle   = &FM_GlobalData.ChildWorker[0];
+
+    CmdPtr->ChildTask = 0;
+
+    /* The previous command of the child task has finished */
+    Idle->CmdSequence = 4;
+
+    /* Act */
+    UtAssert_BOOL_TRUE(FM_AbortCmd(&UT_CmdBuf.Buf));
+
+    /* Assert */
+    UtAssert_UINT32_EQ(Idle->AbortSequence, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_ABORT_CMD_INF_EID);
+}
+
+void Test_FM_AbortCmd_BadChildTask(void)
+{
+    FM_Abort_Payload_t *CmdPtr = &UT_CmdBuf.AbortCmd.Payload;
+
+    CmdPtr->ChildTask = FM_CHILD_TASK_COUNT;
+
+    FM_GlobalData.ChildWorker[0].CurrentCC   = FM_COPY_FILE_CC;
+    FM_GlobalData.ChildWorker[0].CmdSequence = 2;
+
+    /* Act */
+    UtAssert_BOOL_FALSE(FM_AbortCmd(&UT_CmdBuf.Buf));
+
+    /* Assert */
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildWorker[0].AbortSequence, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_ABORT_ARG_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void add_FM_AbortCmd_tests(void)
+{
+    UtTest_Add(Test_FM_AbortCmd_AllChildTasks, FM_Test_Setup, FM_Test_Teardown, "Test_FM_AbortCmd_AllChildTasks");
+
+#if (FM_CHILD_TASK_COUNT > 1)
+    UtTest_Add(Test_FM_AbortCmd_OneChildTask, FM_Test_Setup, FM_Test_Teardown, "Test_FM_AbortCmd_OneChildTask");
+#endif
+
+    UtTest_Add(Test_FM_AbortCmd_Idle, FM_Test_Setup, FM_Test_Teardown, "Test_FM_AbortCmd_Idle");
+
+    UtTest_Add(Test_FM_AbortCmd_BadChildTask, FM_Test_Setup, FM_Test_Teardown, "Test_FM_AbortCmd_BadChildTask");
+}
+
+/****************************/
+/* Flush Queue              */
+/****************************/
+
+void Test_FM_FlushQueueCmd_Success(void)
+{
+    UT_SetDefaultReturnValue(UT_KEY(FM_FlushChildQueue), 3);
+
+    /* Act */
+    UtAssert_BOOL_TRUE(FM_FlushQueueCmd(&UT_CmdBuf.Buf));
+
+    /* Assert */
+    UtAssert_STUB_COUNT(FM_FlushChildQueue, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_FLUSH_QUEUE_CMD_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+}
+
+void add_FM_FlushQueueCmd_tests(void)
+{
+    UtTest_Add(Test_FM_FlushQueueCmd_Success, FM_Test_Setup, FM_Test_Teardown, "Test_FM_FlushQueueCmd_Success");
+}
+
+/****************************/
+/* Send Latency             */
+/****************************/
+
+void Test_FM_SendLatencyCmd_Success(void)
+{
+    /* Arrange */
+    FM_GlobalData.Latency.Verify[FM_NOOP_CC].Bucket[0]         = 1;
+    FM_GlobalData.Latency.QueueWait[FM_COPY_FILE_CC].Bucket[2] = 2;
+    FM_GlobalData.Latency.Execute[FM_COPY_FILE_CC].Bucket[7]   = 3;
+
+    /* Act */
+    UtAssert_BOOL_TRUE(FM_SendLatencyCmd(&UT_CmdBuf.Buf));
+
+    /* Assert */
+    UtAssert_MemCmp(&FM_GlobalData.LatencyPkt.Payload, &FM_GlobalData.Latency, sizeof(FM_GlobalData.Latency),
+                    "Latency packet payload");
+    UtAssert_STUB_COUNT(CFE_MSG_Init, 1);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_SEND_LATENCY_CMD_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+}
+
+void add_FM_SendLatencyCmd_tests(void)
+{
+    UtTest_Add(Test_FM_SendLatencyCmd_Success, FM_Test_Setup, FM_Test_Teardown, "Test_FM_SendLatencyCmd_Success");
+}
+
+/****************************/
+/* Reset Latency            */
+/****************************/
+
+void Test_FM_ResetLatencyCmd_Success(void)
+{
+    /* Arrange */
+    FM_GlobalData.Latency.Execute[FM_COPY_FILE_CC].Bucket[7] = 3;
+    FM_GlobalData.ChildQueueWaitLast                         = 10;
+    FM_GlobalData.ChildQueueWaitMax                          = 20;
+
+    /* Act */
+    UtAssert_BOOL_TRUE(FM_ResetLatencyCmd(&UT_CmdBuf.Buf));
+
+    /* Assert */
+    UtAssert_MemCmpValue(&FM_GlobalData.Latency, 0, sizeof(FM_GlobalData.Latency), "Latency histograms zeroed");
+    UtAssert_ZERO(FM_GlobalData.ChildQueueWaitLast);
+    UtAssert_ZERO(FM_GlobalData.ChildQueueWaitMax);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_RESET_LATENCY_CMD_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+}
+
+void add_FM_ResetLatencyCmd_tests(void)
+{
+    UtTest_Add(Test_FM_ResetLatencyCmd_Success, FM_Test_Setup, FM_Test_Teardown, "Test_FM_ResetLatencyCmd_Success");
+}
+
+/****************************/
+/* Set Verify Mode          */
+/****************************/
+
+void Test_FM_SetVerifyModeCmd_Success(void)
+{
+    FM_VerifyMode_Payload_t *CmdPtr = &UT_CmdBuf.SetVerifyModeCmd.Payload;
+
+    CmdPtr->Mode = FM_VERIFY_MODE_CHILD;
+
+    /* Act */
+    UtAssert_BOOL_TRUE(FM_SetVerifyModeCmd(&UT_CmdBuf.Buf));
+
+    /* Assert */
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildVerifyMode, FM_VERIFY_MODE_CHILD);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_SET_VERIFY_MODE_CMD_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+}
+
+void Test_FM_SetVerifyModeCmd_BadMode(void)
+{
+    FM_VerifyMode_Payload_t *CmdPtr = &UT_CmdBuf.SetVerifyModeCmd.Payload;
+
+    CmdPtr->Mode                  = FM_VERIFY_MODE_CHILD + 1;
+    FM_GlobalData.ChildVerifyMode = FM_VERIFY_MODE_MAIN;
+
+    /* Act */
+    UtAssert_BOOL_FALSE(FM_SetVerifyModeCmd(&UT_CmdBuf.Buf));
+
+    /* Assert */
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildVerifyMode, FM_VERIFY_MODE_MAIN);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_SET_VERIFY_MODE_ARG_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void add_FM_SetVerifyModeCmd_tests(void)
+{
+    UtTest_Add(Test_FM_SetVerifyModeCmd_Success, FM_Test_Setup, FM_Test_Teardown, "Test_FM_SetVerifyModeCmd_Success");
+    UtTest_Add(Test_FM_SetVerifyModeCmd_BadMode, FM_Test_Setup, FM_Test_Teardown, "Test_FM_SetVerifyModeCmd_BadMode");
+}
+
+/****************************/
+/* Delete Tree Tests        */
+/****************************/
+
+void Test_FM_DeleteTreeCmd_Success(void)
+{
+    FM_DirectoryName_Payload_t *CmdPtr = &UT_CmdBuf.DeleteTreeCmd.Payload;
+
+    strncpy(CmdPtr->Directory, "dir", sizeof(CmdPtr->Directory) - 1);
+    FM_GlobalData.ChildStagingEntry.CommandCode = 0;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyDirExists), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyChildTask), true);
+
+    /* Act */
+    UtAssert_BOOL_TRUE(FM_DeleteTreeCmd(&UT_CmdBuf.Buf));
+
+    /* Assert */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UtAssert_STUB_COUNT(FM_InvokeChildTask, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildStagingEntry.CommandCode, FM_DELETE_TREE_CC);
+    UtAssert_STRINGBUF_EQ(FM_GlobalData.ChildStagingEntry.Source1, OS_MAX_PATH_LEN, "dir", -1);
+}
+
+void Test_FM_DeleteTreeCmd_DirNoExist(void)
+{
+    FM_GlobalData.ChildStagingEntry.CommandCode = 0;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyDirExists), false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyChildTask), true);
+
+    /* Act */
+    UtAssert_BOOL_FALSE(FM_DeleteTreeCmd(&UT_CmdBuf.Buf));
+
+    /* Assert */
+    UtAssert_STUB_COUNT(FM_VerifyChildTask, 0);
+    UtAssert_STUB_COUNT(FM_InvokeChildTask, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildStagingEntry.CommandCode, 0);
+}
+
+void Test_FM_DeleteTreeCmd_NoChildTask(void)
+{
+    FM_GlobalData.ChildStagingEntry.CommandCode = 0;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyDirExists), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyChildTask), false);
+
+    /* Act */
+    UtAssert_BOOL_FALSE(FM_DeleteTreeCmd(&UT_CmdBuf.Buf));
+
+    /* Assert */
+    UtAssert_STUB_COUNT(FM_InvokeChildTask, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildStagingEntry.CommandCode, 0);
+}
+
+void add_FM_DeleteTreeCmd_tests(void)
+{
+    UtTest_Add(Test_FM_DeleteTreeCmd_Success, FM_Test_Setup, FM_Test_Teardown, "Test_FM_DeleteTreeCmd_Success");
+    UtTest_Add(Test_FM_DeleteTreeCmd_DirNoExist, FM_Test_Setup, FM_Test_Teardown, "Test_FM_DeleteTreeCmd_DirNoExist");
+    UtTest_Add(Test_FM_DeleteTreeCmd_NoChildTask, FM_Test_Setup, FM_Test_Teardown, "Test_FM_DeleteTreeCmd_NoChildTask");
+}
+
+/****************************/
+/* Filter Files Tests       */
+/****************************/
+
+void Test_FM_FilterFilesCmd_Move(void)
+{
+    FM_FilterFiles_Payload_t *CmdPtr = &UT_CmdBuf.FilterFilesCmd.Payload;
+
+    strncpy(CmdPtr->Directory, "dir", sizeof(CmdPtr->Directory) - 1);
+    strncpy(CmdPtr->Target, "tgt", sizeof(CmdPtr->Target) - 1);
+    strncpy(CmdPtr->Pattern, "*.dat", sizeof(CmdPtr->Pattern) - 1);
+    CmdPtr->Filter.MinAge = 60;
+    CmdPtr->Action        = FM_FILTER_ACTION_MOVE;
+    CmdPtr->Overwrite     = 1;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyOverwrite), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyDirExists), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyChildTask), true);
+
+    /* Act */
+    UtAssert_BOOL_TRUE(FM_FilterFilesCmd(&UT_CmdBuf.Buf));
+
+    /* Assert */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UtAssert_STUB_COUNT(FM_VerifyDirExists, 2);
+    UtAssert_STUB_COUNT(FM_InvokeChildTask, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildStagingEntry.CommandCode, FM_FILTER_FILES_CC);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildStagingEntry.FilterAction, FM_FILTER_ACTION_MOVE);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildStagingEntry.Overwrite, 1);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildStagingEntry.Filter.MinAge, 60);
+    UtAssert_STRINGBUF_EQ(FM_GlobalData.ChildStagingEntry.Source1, OS_MAX_PATH_LEN, "dir", -1);
+    UtAssert_STRINGBUF_EQ(FM_GlobalData.ChildStagingEntry.Source2, OS_MAX_PATH_LEN, "*.dat", -1);
+    UtAssert_STRINGBUF_EQ(FM_GlobalData.ChildStagingEntry.Target, OS_MAX_PATH_LEN, "tgt", -1);
+}
+
+void Test_FM_FilterFilesCmd_Delete(void)
+{
+    FM_FilterFiles_Payload_t *CmdPtr = &UT_CmdBuf.FilterFilesCmd.Payload;
+
+    strncpy(CmdPtr->Directory, "dir", sizeof(CmdPtr->Directory) - 1);
+    strncpy(CmdPtr->Target, "tgt", sizeof(CmdPtr->Target) - 1);
+    CmdPtr->Action = FM_FILTER_ACTION_DELETE;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyOverwrite), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyDirExists), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyChildTask), true);
+
+    /* Act */
+    UtAssert_BOOL_TRUE(FM_FilterFilesCmd(&UT_CmdBuf.Buf));
+
+    /* Assert */
+    UtAssert_STUB_COUNT(FM_VerifyDirExists, 1);
+    UtAssert_STUB_COUNT(FM_InvokeChildTask, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildStagingEntry.FilterAction, FM_FILTER_ACTION_DELETE);
+    UtAssert_STRINGBUF_EQ(FM_GlobalData.ChildStagingEntry.Target, OS_MAX_PATH_LEN, "", -1);
+}
+
+void Test_FM_FilterFilesCmd_BadAction(void)
+{
+    FM_FilterFiles_Payload_t *CmdPtr = &UT_CmdBuf.FilterFilesCmd.Payload;
+
+    CmdPtr->Action = FM_FILTER_ACTION_COPY + 1;
+
+    /* Act */
+    UtAssert_BOOL_FALSE(FM_FilterFilesCmd(&UT_CmdBuf.Buf));
+
+    /* Assert */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_FILTER_FILES_ACTION_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_STUB_COUNT(FM_VerifyOverwrite, 0);
+    UtAssert_STUB_COUNT(FM_InvokeChildTask, 0);
+}
+
+void Test_FM_FilterFilesCmd_TargetNoExist(void)
+{
+    FM_FilterFiles_Payload_t *CmdPtr = &UT_CmdBuf.FilterFilesCmd.Payload;
+
+    CmdPtr->Action = FM_FILTER_ACTION_COPY;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyOverwrite), true);
+    UT_SetDeferredRetcode(UT_KEY(FM_VerifyDirExists), 2, false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyDirExists), true);
+
+    /* Act */
+    UtAssert_BOOL_FALSE(FM_FilterFilesCmd(&UT_CmdBuf.Buf));
+
+    /* Assert */
+    UtAssert_STUB_COUNT(FM_VerifyDirExists, 2);
+    UtAssert_STUB_COUNT(FM_VerifyChildTask, 0);
+    UtAssert_STUB_COUNT(FM_InvokeChildTask, 0);
+}
+
+void Test_FM_FilterFilesCmd_NoChildTask(void)
+{
+    FM_GlobalData.ChildStagingEntry.CommandCode = 0;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyOverwrite), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyDirExists), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyChildTask), false);
+
+    /* Act */
+    UtAssert_BOOL_FALSE(FM_FilterFilesCmd(&UT_CmdBuf.Buf));
+
+    /* Assert */
+    UtAssert_STUB_COUNT(FM_InvokeChildTask, 0);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildStagingEntry.CommandCode, 0);
+}
+
+void add_FM_FilterFilesCmd_tests(void)
+{
+    UtTest_Add(Test_FM_FilterFilesCmd_Move, FM_Test_Setup, FM_Test_Teardown, "Test_FM_FilterFilesCmd_Move");
+    UtTest_Add(Test_FM_FilterFilesCmd_Delete, FM_Test_Setup, FM_Test_Teardown, "Test_FM_FilterFilesCmd_Delete");
+    UtTest_Add(Test_FM_FilterFilesCmd_BadAction, FM_Test_Setup, FM_Test_Teardown, "Test_FM_FilterFilesCmd_BadAction");
+    UtTest_Add(Test_FM_FilterFilesCmd_TargetNoExist, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_FilterFilesCmd_TargetNoExist");
+    UtTest_Add(Test_FM_FilterFilesCmd_NoChildTask, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_FilterFilesCmd_NoChildTask");
+}
+
+/****************************/
+/* Enforce Retention Tests  */
+/****************************/
+
+void Test_FM_EnforceRetentionCmd_Success(void)
+{
+    FM_RetentionTable_t RetentionTable;
+
+    memset(&RetentionTable, 0, sizeof(RetentionTable));
+    RetentionTable.Entries[1].Enabled                     = FM_TABLE_ENTRY_ENABLED;
+    FM_GlobalData.RetentionTablePtr                       = &RetentionTable;
+    UT_CmdBuf.EnforceRetentionCmd.Payload.TableEntryIndex = 1;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_StartRetention), true);
+
+    /* Act */
+    UtAssert_BOOL_TRUE(FM_EnforceRetentionCmd(&UT_CmdBuf.Buf));
+
+    /* Assert */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UtAssert_STUB_COUNT(FM_StartRetention, 1);
+}
+
+void Test_FM_EnforceRetentionCmd_NoTable(void)
+{
+    FM_GlobalData.RetentionTablePtr = NULL;
+
+    /* Act */
+    UtAssert_BOOL_FALSE(FM_EnforceRetentionCmd(&UT_CmdBuf.Buf));
+
+    /* Assert */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_ENFORCE_RETENTION_TBL_ERR_EID);
+    UtAssert_STUB_COUNT(FM_StartRetention, 0);
+}
+
+void Test_FM_EnforceRetentionCmd_BadIndex(void)
+{
+    FM_RetentionTable_t RetentionTable;
+
+    memset(&RetentionTable, 0, sizeof(RetentionTable));
+    FM_GlobalData.RetentionTablePtr                       = &RetentionTable;
+    UT_CmdBuf.EnforceRetentionCmd.Payload.TableEntryIndex = FM_RETENTION_ENTRY_COUNT;
+
+    /* Act */
+    UtAssert_BOOL_FALSE(FM_EnforceRetentionCmd(&UT_CmdBuf.Buf));
+
+    /* Assert */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_ENFORCE_RETENTION_IDX_ERR_EID);
+    UtAssert_STUB_COUNT(FM_StartRetention, 0);
+}
+
+void Test_FM_EnforceRetentionCmd_Disabled(void)
+{
+    FM_RetentionTable_t RetentionTable;
+
+    memset(&RetentionTable, 0, sizeof(RetentionTable));
+    FM_GlobalData.RetentionTablePtr = &RetentionTable;
+
+    /* Act */
+    UtAssert_BOOL_FALSE(FM_EnforceRetentionCmd(&UT_CmdBuf.Buf));
+
+    /* Assert */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_ENFORCE_RETENTION_DISABLED_ERR_EID);
+    UtAssert_STUB_COUNT(FM_StartRetention, 0);
+}
+
+void Test_FM_EnforceRetentionCmd_Busy(void)
+{
+    FM_RetentionTable_t RetentionTable;
+
+    memset(&RetentionTable, 0, sizeof(RetentionTable));
+    RetentionTable.Entries[0].Enabled = FM_TABLE_ENTRY_ENABLED;
+    FM_GlobalData.RetentionTablePtr   = &RetentionTable;
+    FM_GlobalData.Retention[0].Busy   = 1;
+
+    /* Act */
+    UtAssert_BOOL_FALSE(FM_EnforceRetentionCmd(&UT_CmdBuf.Buf));
+
+    /* Assert */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_ENFORCE_RETENTION_BUSY_ERR_EID);
+    UtAssert_STUB_COUNT(FM_StartRetention, 0);
+}
+
+void add_FM_EnforceRetentionCmd_tests(void)
+{
+    UtTest_Add(Test_FM_EnforceRetentionCmd_Success, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_EnforceRetentionCmd_Success");
+    UtTest_Add(Test_FM_EnforceRetentionCmd_NoTable, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_EnforceRetentionCmd_NoTable");
+    UtTest_Add(Test_FM_EnforceRetentionCmd_BadIndex, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_EnforceRetentionCmd_BadIndex");
+    UtTest_Add(Test_FM_EnforceRetentionCmd_Disabled, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_EnforceRetentionCmd_Disabled");
+    UtTest_Add(Test_FM_EnforceRetentionCmd_Busy, FM_Test_Setup, FM_Test_Teardown, "Test_FM_EnforceRetentionCmd_Busy");
+}
+
+/****************************/
+/* Set Delete Mode          */
+/****************************/
+
+void Test_FM_SetDeleteModeCmd_Success(void)
+{
+    FM_DeleteMode_Payload_t *CmdPtr = &UT_CmdBuf.SetDeleteModeCmd.Payload;
+
+    CmdPtr->Mode = FM_DELETE_MODE_TRASH;
+
+    /* Act */
+    UtAssert_BOOL_TRUE(FM_SetDeleteModeCmd(&UT_CmdBuf.Buf));
+
+    /* Assert */
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildDeleteMode, FM_DELETE_MODE_TRASH);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_SET_DELETE_MODE_CMD_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+}
+
+void Test_FM_SetDeleteModeCmd_BadMode(void)
+{
+    FM_DeleteMode_Payload_t *CmdPtr = &UT_CmdBuf.SetDeleteModeCmd.Payload;
+
+    CmdPtr->Mode                  = FM_DELETE_MODE_TRASH + 1;
+    FM_GlobalData.ChildDeleteMode = FM_DELETE_MODE_DIRECT;
+
+    /* Act */
+    UtAssert_BOOL_FALSE(FM_SetDeleteModeCmd(&UT_CmdBuf.Buf));
+
+    /* Assert */
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildDeleteMode, FM_DELETE_MODE_DIRECT);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_SET_DELETE_MODE_ARG_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void add_FM_SetDeleteModeCmd_tests(void)
+{
+    UtTest_Add(Test_FM_SetDeleteModeCmd_Success, FM_Test_Setup, FM_Test_Teardown, "Test_FM_SetDeleteModeCmd_Success");
+    UtTest_Add(Test_FM_SetDeleteModeCmd_BadMode, FM_Test_Setup, FM_Test_Teardown, "Test_FM_SetDeleteModeCmd_BadMode");
+}
+
+/****************************/
+/* Purge Trash Tests        */
+/****************************/
+
+void Test_FM_PurgeTrashCmd_Success(void)
+{
+    UT_SetDefaultReturnValue(UT_KEY(FM_StartPurge), true);
+
+    /* Act */
+    UtAssert_BOOL_TRUE(FM_PurgeTrashCmd(&UT_CmdBuf.Buf));
+
+    /* Assert */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UtAssert_STUB_COUNT(FM_StartPurge, 1);
+}
+
+void Test_FM_PurgeTrashCmd_Busy(void)
+{
+    FM_GlobalData.TrashPurgeBusy = 1;
+
+    /* Act */
+    UtAssert_BOOL_FALSE(FM_PurgeTrashCmd(&UT_CmdBuf.Buf));
+
+    /* Assert */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_PURGE_TRASH_BUSY_ERR_EID);
+    UtAssert_STUB_COUNT(FM_StartPurge, 0);
+}
+
+void add_FM_PurgeTrashCmd_tests(void)
+{
+    UtTest_Add(Test_FM_PurgeTrashCmd_Success, FM_Test_Setup, FM_Test_Teardown, "Test_FM_PurgeTrashCmd_Success");
+    UtTest_Add(Test_FM_PurgeTrashCmd_Busy, FM_Test_Setup, FM_Test_Teardown, "Test_FM_PurgeTrashCmd_Busy");
+}
+
+/****************************/
+/* Get File Digest Tests    */
+/****************************/
+
+void Test_FM_GetFileDigestCmd_Success(void)
+{
+    FM_FilenameAndDigests_Payload_t *CmdPtr = &UT_CmdBuf.GetFileDigestCmd.Payload;
+
+    strncpy(CmdPtr->Filename, "file", sizeof(CmdPtr->Filename));
+    CmdPtr->Digests = FM_DIGEST_CRC32C | FM_DIGEST_SHA256;
+
+    FM_GlobalData.ChildStagingEntry.CommandCode = 0;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileClosed), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyChildTask), true);
+
+    /* Act */
+    UtAssert_BOOL_TRUE(FM_GetFileDigestCmd(&UT_CmdBuf.Buf));
+
+    /* Assert */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UtAssert_STUB_COUNT(FM_InvokeChildTask, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.ChildStagingEntry.CommandCode, FM_GET_FILE_DIGEST_CC);
+    UtAssert_UINT32_EQ(FM_GlobalData.ChildStagingEntry.FileInfoCRC, FM_DIGEST_CRC32C | FM_DIGEST_SHA256);
+    UtAssert_STRINGBUF_EQ(FM_GlobalData.ChildStagingEntry.Source1, sizeof(FM_GlobalData.ChildStagingEntry.Source1),
+                          "file", sizeof("file"));
+}
+
+void Test_FM_GetFileDigestCmd_BadDigests(void)
+{
+    FM_FilenameAndDigests_Payload_t *CmdPtr = &UT_CmdBuf.GetFileDigestCmd.Payload;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileClosed), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyChildTask), true);
+
+    /* Act - no digest */
+    CmdPtr->Digests = 0;
+    UtAssert_BOOL_FALSE(FM_GetFileDigestCmd(&UT_CmdBuf.Buf));
+
+    /* Act - an unknown digest */
+    CmdPtr->Digests = FM_DIGEST_CRC32C | (FM_DIGEST_ALL + 1);
+    UtAssert_BOOL_FALSE(FM_GetFileDigestCmd(&UT_CmdBuf.Buf));
+
+    /* Assert */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_GET_FILE_DIGEST_TYPE_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_GET_FILE_DIGEST_TYPE_ERR_EID);
+    UtAssert_STUB_COUNT(FM_VerifyFileClosed, 0);
+    UtAssert_STUB_COUNT(FM_InvokeChildTask, 0);
+}
+
+void Test_FM_GetFileDigestCmd_FileNotClosed(void)
+{
+    FM_FilenameAndDigests_Payload_t *CmdPtr = &UT_CmdBuf.GetFileDigestCmd.Payload;
+
+    CmdPtr->Digests = FM_DIGEST_ALL;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileClosed), false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyChildTask), true);
+
+    /* Act */
+    UtAssert_BOOL_FALSE(FM_GetFileDigestCmd(&UT_CmdBuf.Buf));
+
+    /* Assert */
+    UtAssert_STUB_COUNT(FM_VerifyChildTask, 0);
+    UtAssert_STUB_COUNT(FM_InvokeChildTask, 0);
+}
+
+void Test_FM_GetFileDigestCmd_NoChildTask(void)
+{
+    FM_FilenameAndDigests_Payload_t *CmdPtr = &UT_CmdBuf.GetFileDigestCmd.Payload;
+
+    CmdPtr->Digests = FM_DIGEST_XXH64;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyFileClosed), true);
+    UT_SetDefaultReturnValue(UT_KEY(FM_VerifyChildTask), false);
+
+    /* Act */
+    UtAssert_BOOL_FALSE(FM_GetFileDigestCmd(&UT_CmdBuf.Buf));
+
+    /* Assert */
+    UtAssert_STUB_COUNT(FM_InvokeChildTask, 0);
+}
+
+void add_FM_GetFileDigestCmd_tests(void)
+{
+    UtTest_Add(Test_FM_GetFileDigestCmd_Success, FM_Test_Setup, FM_Test_Teardown, "Test_FM_GetFileDigestCmd_Success");
+    UtTest_Add(Test_FM_GetFileDigestCmd_BadDigests, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_GetFileDigestCmd_BadDigests");
+    UtTest_Add(Test_FM_GetFileDigestCmd_FileNotClosed, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_GetFileDigestCmd_FileNotClosed");
+    UtTest_Add(Test_FM_GetFileDigestCmd_NoChildTask, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_GetFileDigestCmd_NoChildTask");
+}
+
 /*
  * Register the test cases to execute with the unit test tool
  */
@@ -2014,4 +3100,18 @@ void UtTest_Setup(void)
     add_FM_MonitorFilesystemSpaceCmd_tests();
     add_FM_SetTableStateCmd_tests();
     add_FM_SetPermissionsCmd_tests();
+    add_FM_SetCopyBlockSizeCmd_tests();
+    add_FM_ConcatListCmd_tests();
+    add_FM_SetThrottleCmd_tests();
+    add_FM_AbortCmd_tests();
+    add_FM_FlushQueueCmd_tests();
+    add_FM_SendLatencyCmd_tests();
+    add_FM_ResetLatencyCmd_tests();
+    add_FM_SetVerifyModeCmd_tests();
+    add_FM_DeleteTreeCmd_tests();
+    add_FM_FilterFilesCmd_tests();
+    add_FM_EnforceRetentionCmd_tests();
+    add_FM_SetDeleteModeCmd_tests();
+    add_FM_PurgeTrashCmd_tests();
+    add_FM_GetFileDigestCmd_tests();
 }
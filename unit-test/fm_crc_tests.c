@@ -0,0 +1,269 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,918-1, and identified as “Core Flight
+ * Software System (cFS) File Manager Application Version 2.6.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *  File Manager (FM) CRC kernel unit tests
+ */
+
+#include "cfe.h"
+#include "fm_app.h"
+#include "fm_crc.h"
+
+#include <string.h>
+
+/*
+ * UT Assert
+ */
+#include "fm_test_utils.h"
+
+/*
+ * UT includes
+ */
+#include "uttest.h"
+#include "utassert.h"
+#include "utstubs.h"
+
+/*
+**********************************************************************************
+**          TEST CASE FUNCTIONS
+**********************************************************************************
+*/
+
+/* CRC-16/ARC check value of "123456789", and the same value as returned by a sign extending cFE */
+#define UT_FM_CRC16_CHECK          0xBB3D
+#define UT_FM_CRC16_CHECK_EXTENDED 0xFFFFBB3D
+
+/* Byte at a time CRC-16, as computed by cFE */
+uint16 UT_FM_Crc16Bytewise(const uint8 *DataPtr, size_t DataLength, uint16 Crc)
+{
+    size_t i;
+
+    for (i = 0; i < DataLength; i++)
+    {
+        Crc = (Crc >> 8) ^ FM_GlobalData.Crc.Table[0][(Crc ^ DataPtr[i]) & 0xFF];
+    }
+
+    return Crc;
+}
+
+/* ****************
+ * CrcInit Tests
+ * ***************/
+
+void Test_FM_CrcInit_SignExtend(void)
+{
+    /* Arrange */
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_CalculateCRC), (int32)UT_FM_CRC16_CHECK_EXTENDED);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_CrcInit(&FM_GlobalData.Crc));
+
+    /* Assert */
+    UtAssert_STUB_COUNT(CFE_ES_CalculateCRC, 1);
+    UtAssert_UINT32_EQ(FM_GlobalData.Crc.Method, FM_CRC_METHOD_SLICE8);
+    UtAssert_BOOL_TRUE(FM_GlobalData.Crc.SignExtend);
+    UtAssert_UINT32_EQ(FM_GlobalData.Crc.Table[0][1], 0xC0C1);
+    UtAssert_UINT32_EQ(FM_GlobalData.Crc.Table[0][255], 0x4040);
+}
+
+void Test_FM_CrcInit_Unsigned(void)
+{
+    /* Arrange */
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_CalculateCRC), UT_FM_CRC16_CHECK);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_CrcInit(&FM_GlobalData.Crc));
+
+    /* Assert */
+    UtAssert_UINT32_EQ(FM_GlobalData.Crc.Method, FM_CRC_METHOD_SLICE8);
+    UtAssert_BOOL_FALSE(FM_GlobalData.Crc.SignExtend);
+}
+
+void Test_FM_CrcInit_Mismatch(void)
+{
+    /* Arrange */
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_CalculateCRC), 0x1234);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_CrcInit(&FM_GlobalData.Crc));
+
+    /* Assert - cFE keeps computing every CRC */
+    UtAssert_UINT32_EQ(FM_GlobalData.Crc.Method, FM_CRC_METHOD_CFE);
+    UtAssert_BOOL_FALSE(FM_GlobalData.Crc.SignExtend);
+}
+
+/* ****************
+ * CalculateCRC Tests
+ * ***************/
+
+void Test_FM_CalculateCRC_Slice8(void)
+{
+    /* Arrange */
+    const char *data = "123456789";
+    uint32      crc;
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_CalculateCRC), (int32)UT_FM_CRC16_CHECK_EXTENDED);
+    FM_CrcInit(&FM_GlobalData.Crc);
+
+    /* Act */
+    UtAssert_UINT32_EQ(FM_CalculateCRC(&FM_GlobalData.Crc, data, 9, 0, CFE_ES_CrcType_CRC_16),
+                       UT_FM_CRC16_CHECK_EXTENDED);
+
+    /* Act - a sign extended result carries forward into the next block */
+    crc = FM_CalculateCRC(&FM_GlobalData.Crc, data, 4, 0, CFE_ES_CrcType_CRC_16);
+    crc = FM_CalculateCRC(&FM_GlobalData.Crc, &data[4], 5, crc, CFE_ES_CrcType_CRC_16);
+    UtAssert_UINT32_EQ(crc, UT_FM_CRC16_CHECK_EXTENDED);
+
+    /* Act - an unsigned cFE */
+    FM_GlobalData.Crc.SignExtend = false;
+    UtAssert_UINT32_EQ(FM_CalculateCRC(&FM_GlobalData.Crc, data, 9, 0, CFE_ES_CrcType_CRC_16), UT_FM_CRC16_CHECK);
+
+    /* Assert - only the check value was passed to cFE */
+    UtAssert_STUB_COUNT(CFE_ES_CalculateCRC, 1);
+}
+
+void Test_FM_CalculateCRC_OtherType(void)
+{
+    /* Arrange */
+    FM_GlobalData.Crc.Method = FM_CRC_METHOD_SLICE8;
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_CalculateCRC), 0x5678);
+
+    /* Act */
+    UtAssert_UINT32_EQ(FM_CalculateCRC(&FM_GlobalData.Crc, "data", 4, 0, CFE_ES_CrcType_CRC_32), 0x5678);
+    UtAssert_UINT32_EQ(FM_CalculateCRC(&FM_GlobalData.Crc, "data", 4, 0, CFE_ES_CrcType_CRC_8), 0x5678);
+
+    /* Assert */
+    UtAssert_STUB_COUNT(CFE_ES_CalculateCRC, 2);
+}
+
+void Test_FM_CalculateCRC_CfeMethod(void)
+{
+    /* Arrange */
+    FM_GlobalData.Crc.Method = FM_CRC_METHOD_CFE;
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_CalculateCRC), 0x5678);
+
+    /* Act */
+    UtAssert_UINT32_EQ(FM_CalculateCRC(&FM_GlobalData.Crc, "data", 4, 0, CFE_ES_CrcType_CRC_16), 0x5678);
+
+    /* Assert */
+    UtAssert_STUB_COUNT(CFE_ES_CalculateCRC, 1);
+}
+
+/* ****************
+ * CrcSlice8 Tests
+ * ***************/
+
+void Test_FM_CrcSlice8_Bytewise(void)
+{
+    /* Arrange */
+    uint8  data[1000];
+    size_t i;
+
+    for (i = 0; i < sizeof(data); i++)
+    {
+        data[i] = (uint8)((i * 131) ^ (i >> 3));
+    }
+
+    FM_CrcInit(&FM_GlobalData.Crc);
+
+    /* Act - every length up to a few steps, from an unaligned start, with a running CRC */
+    for (i = 0; i < 40; i++)
+    {
+        UtAssert_UINT32_EQ(FM_CrcSlice8(&FM_GlobalData.Crc, &data[1], i, 0x8005),
+                           UT_FM_Crc16Bytewise(&data[1], i, 0x8005));
+    }
+
+    /* Act - a long block */
+    UtAssert_UINT32_EQ(FM_CrcSlice8(&FM_GlobalData.Crc, data, sizeof(data), 0),
+                       UT_FM_Crc16Bytewise(data, sizeof(data), 0));
+}
+
+/* ****************
+ * CrcCombine Tests
+ * ***************/
+
+void Test_FM_CrcCombine_Serial(void)
+{
+    /* Arrange */
+    uint8  data[3000];
+    uint32 crc_a;
+    uint32 crc_b;
+    size_t i;
+
+    for (i = 0; i < sizeof(data); i++)
+    {
+        data[i] = (uint8)((i * 197) ^ (i >> 5));
+    }
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_CalculateCRC), (int32)UT_FM_CRC16_CHECK_EXTENDED);
+    FM_CrcInit(&FM_GlobalData.Crc);
+
+    /* Act - split points either side of each power of two, sign extended values carry through */
+    for (i = 0; i < sizeof(data); i = (i * 2) + 1)
+    {
+        crc_a = FM_CalculateCRC(&FM_GlobalData.Crc, data, i, 0, CFE_ES_CrcType_CRC_16);
+        crc_b = FM_CalculateCRC(&FM_GlobalData.Crc, &data[i], sizeof(data) - i, 0, CFE_ES_CrcType_CRC_16);
+
+        UtAssert_UINT32_EQ(FM_CrcCombine(&FM_GlobalData.Crc, crc_a, crc_b, sizeof(data) - i),
+                           FM_CalculateCRC(&FM_GlobalData.Crc, data, sizeof(data), 0, CFE_ES_CrcType_CRC_16));
+    }
+
+    /* Act - an unsigned cFE */
+    FM_GlobalData.Crc.SignExtend = false;
+
+    crc_a = FM_CalculateCRC(&FM_GlobalData.Crc, data, 1000, 0, CFE_ES_CrcType_CRC_16);
+    crc_b = FM_CalculateCRC(&FM_GlobalData.Crc, &data[1000], 2000, 0, CFE_ES_CrcType_CRC_16);
+
+    UtAssert_UINT32_EQ(FM_CrcCombine(&FM_GlobalData.Crc, crc_a, crc_b, 2000),
+                       UT_FM_Crc16Bytewise(data, sizeof(data), 0));
+}
+
+void Test_FM_CrcCombine_Empty(void)
+{
+    /* Arrange */
+    FM_CrcInit(&FM_GlobalData.Crc);
+
+    /* Act - an empty second range leaves the first CRC as it was */
+    UtAssert_UINT32_EQ(FM_CrcCombine(&FM_GlobalData.Crc, UT_FM_CRC16_CHECK, 0, 0), UT_FM_CRC16_CHECK);
+
+    /* Act - an empty first range gives the second CRC */
+    UtAssert_UINT32_EQ(FM_CrcCombine(&FM_GlobalData.Crc, 0, UT_FM_CRC16_CHECK, 9), UT_FM_CRC16_CHECK);
+}
+
+/*
+ * Register the test cases to execute with the unit test tool
+ */
+void UtTest_Setup(void)
+{
+    UtTest_Add(Test_FM_CrcInit_SignExtend, FM_Test_Setup, FM_Test_Teardown, "Test_FM_CrcInit_SignExtend");
+    UtTest_Add(Test_FM_CrcInit_Unsigned, FM_Test_Setup, FM_Test_Teardown, "Test_FM_CrcInit_Unsigned");
+    UtTest_Add(Test_FM_CrcInit_Mismatch, FM_Test_Setup, FM_Test_Teardown, "Test_FM_CrcInit_Mismatch");
+
+    UtTest_Add(Test_FM_CalculateCRC_Slice8, FM_Test_Setup, FM_Test_Teardown, "Test_FM_CalculateCRC_Slice8");
+    UtTest_Add(Test_FM_CalculateCRC_OtherType, FM_Test_Setup, FM_Test_Teardown, "Test_FM_CalculateCRC_OtherType");
+    UtTest_Add(Test_FM_CalculateCRC_CfeMethod, FM_Test_Setup, FM_Test_Teardown, "Test_FM_CalculateCRC_CfeMethod");
+
+    UtTest_Add(Test_FM_CrcSlice8_Bytewise, FM_Test_Setup, FM_Test_Teardown, "Test_FM_CrcSlice8_Bytewise");
+
+    UtTest_Add(Test_FM_CrcCombine_Serial, FM_Test_Setup, FM_Test_Teardown, "Test_FM_CrcCombine_Serial");
+    UtTest_Add(Test_FM_CrcCombine_Empty, FM_Test_Setup, FM_Test_Teardown, "Test_FM_CrcCombine_Empty");
+}
@@ -0,0 +1,305 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,918-1, and identified as “Core Flight
+ * Software System (cFS) File Manager Application Version 2.6.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *  File Manager (FM) file digest kernel unit tests
+ */
+
+#include "cfe.h"
+#include "fm_app.h"
+#include "fm_digest.h"
+
+#include <string.h>
+
+/*
+ * UT Assert
+ */
+#include "fm_test_utils.h"
+
+/*
+ * UT includes
+ */
+#include "uttest.h"
+#include "utassert.h"
+#include "utstubs.h"
+
+/*
+**********************************************************************************
+**          TEST CASE FUNCTIONS
+**********************************************************************************
+*/
+
+/* CRC-32C check value of "123456789" */
+#define UT_FM_CRC32C_CHECK 0xE3069283
+
+/* Digests of a block in a single update */
+void UT_FM_Digest(const void *DataPtr, size_t DataLength, uint32 Digests, uint32 *Crc32c, uint8 *Xxh64,
+                  uint8 *Sha256)
+{
+    FM_Digest_Context_t Context;
+
+    FM_DigestStart(&Context, Digests);
+    FM_DigestUpdate(&FM_GlobalData.Digest, &Context, DataPtr, DataLength);
+    FM_DigestFinish(&Context, Crc32c, Xxh64, Sha256);
+}
+
+/* Byte at a time CRC-32C, before the final inversion */
+uint32 UT_FM_Crc32cBytewise(const uint8 *DataPtr, size_t DataLength, uint32 Crc)
+{
+    size_t i;
+
+    for (i = 0; i < DataLength; i++)
+    {
+        Crc = (Crc >> 8) ^ FM_GlobalData.Digest.Table[0][(Crc ^ DataPtr[i]) & 0xFF];
+    }
+
+    return Crc;
+}
+
+/* ****************
+ * DigestInit Tests
+ * ***************/
+
+void Test_FM_DigestInit_Tables(void)
+{
+    /* Act */
+    UtAssert_VOIDCALL(FM_DigestInit(&FM_GlobalData.Digest));
+
+    /* Assert */
+    UtAssert_UINT32_EQ(FM_GlobalData.Digest.Table[0][1], 0xF26B8303);
+    UtAssert_UINT32_EQ(FM_GlobalData.Digest.Table[0][128], 0x82F63B78);
+    UtAssert_UINT32_EQ(FM_GlobalData.Digest.Table[0][255], 0xAD7D5351);
+
+    /* Assert - a byte followed by a zero byte */
+    UtAssert_UINT32_EQ(FM_GlobalData.Digest.Table[1][1], UT_FM_Crc32cBytewise((const uint8 *)"\0", 1, 0xF26B8303));
+}
+
+/* ****************
+ * DigestFinish Tests
+ * ***************/
+
+void Test_FM_DigestFinish_Check(void)
+{
+    /* Arrange */
+    const uint8 xxh64[FM_DIGEST_XXH64_LEN]   = {0x8C, 0xB8, 0x41, 0xDB, 0x40, 0xE6, 0xAE, 0x83};
+    const uint8 sha256[FM_DIGEST_SHA256_LEN] = {
+        0x15, 0xE2, 0xB0, 0xD3, 0xC3, 0x38, 0x91, 0xEB, 0xB0, 0xF1, 0xEF, 0x60, 0x9E, 0xC4, 0x19, 0x42,
+        0x0C, 0x20, 0xE3, 0x20, 0xCE, 0x94, 0xC6, 0x5F, 0xBC, 0x8C, 0x33, 0x12, 0x44, 0x8E, 0xB2, 0x25};
+    uint32      crc = 0;
+    uint8       xxh[FM_DIGEST_XXH64_LEN];
+    uint8       sha[FM_DIGEST_SHA256_LEN];
+
+    FM_DigestInit(&FM_GlobalData.Digest);
+
+    /* Act */
+    UT_FM_Digest("123456789", 9, FM_DIGEST_ALL, &crc, xxh, sha);
+
+    /* Assert */
+    UtAssert_UINT32_EQ(crc, UT_FM_CRC32C_CHECK);
+    UtAssert_MemCmp(xxh, xxh64, sizeof(xxh), "xxHash64 of check string");
+    UtAssert_MemCmp(sha, sha256, sizeof(sha), "SHA-256 of check string");
+}
+
+void Test_FM_DigestFinish_Vectors(void)
+{
+    /* Arrange */
+    const uint8 xxh64_empty[FM_DIGEST_XXH64_LEN]   = {0xEF, 0x46, 0xDB, 0x37, 0x51, 0xD8, 0xE9, 0x99};
+    const uint8 xxh64_abc[FM_DIGEST_XXH64_LEN]     = {0x44, 0xBC, 0x2C, 0xF5, 0xAD, 0x77, 0x09, 0x99};
+    const uint8 sha256_empty[FM_DIGEST_SHA256_LEN] = {
+        0xE3, 0xB0, 0xC4, 0x42, 0x98, 0xFC, 0x1C, 0x14, 0x9A, 0xFB, 0xF4, 0xC8, 0x99, 0x6F, 0xB9, 0x24,
+        0x27, 0xAE, 0x41, 0xE4, 0x64, 0x9B, 0x93, 0x4C, 0xA4, 0x95, 0x99, 0x1B, 0x78, 0x52, 0xB8, 0x55};
+    const uint8 sha256_abc[FM_DIGEST_SHA256_LEN]   = {
+        0xBA, 0x78, 0x16, 0xBF, 0x8F, 0x01, 0xCF, 0xEA, 0x41, 0x41, 0x40, 0xDE, 0x5D, 0xAE, 0x22, 0x23,
+        0xB0, 0x03, 0x61, 0xA3, 0x96, 0x17, 0x7A, 0x9C, 0xB4, 0x10, 0xFF, 0x61, 0xF2, 0x00, 0x15, 0xAD};
+    uint32      crc = 0xFFFFFFFF;
+    uint8       xxh[FM_DIGEST_XXH64_LEN];
+    uint8       sha[FM_DIGEST_SHA256_LEN];
+
+    FM_DigestInit(&FM_GlobalData.Digest);
+
+    /* Act - an empty file */
+    UT_FM_Digest("", 0, FM_DIGEST_ALL, &crc, xxh, sha);
+
+    /* Assert */
+    UtAssert_UINT32_EQ(crc, 0);
+    UtAssert_MemCmp(xxh, xxh64_empty, sizeof(xxh), "xxHash64 of empty file");
+    UtAssert_MemCmp(sha, sha256_empty, sizeof(sha), "SHA-256 of empty file");
+
+    /* Act - shorter than a stripe or a block */
+    UT_FM_Digest("abc", 3, FM_DIGEST_ALL, &crc, xxh, sha);
+
+    /* Assert */
+    UtAssert_UINT32_EQ(crc, 0x364B3FB7);
+    UtAssert_MemCmp(xxh, xxh64_abc, sizeof(xxh), "xxHash64 of abc");
+    UtAssert_MemCmp(sha, sha256_abc, sizeof(sha), "SHA-256 of abc");
+}
+
+void Test_FM_DigestFinish_ShaPadding(void)
+{
+    /* Arrange */
+    const uint8 sha256_55[FM_DIGEST_SHA256_LEN] = {
+        0x9F, 0x43, 0x90, 0xF8, 0xD3, 0x0C, 0x2D, 0xD9, 0x2E, 0xC9, 0xF0, 0x95, 0xB6, 0x5E, 0x2B, 0x9A,
+        0xE9, 0xB0, 0xA9, 0x25, 0xA5, 0x25, 0x8E, 0x24, 0x1C, 0x9F, 0x1E, 0x91, 0x0F, 0x73, 0x43, 0x18};
+    const uint8 sha256_56[FM_DIGEST_SHA256_LEN] = {
+        0xB3, 0x54, 0x39, 0xA4, 0xAC, 0x6F, 0x09, 0x48, 0xB6, 0xD6, 0xF9, 0xE3, 0xC6, 0xAF, 0x0F, 0x5F,
+        0x59, 0x0C, 0xE2, 0x0F, 0x1B, 0xDE, 0x70, 0x90, 0xEF, 0x79, 0x70, 0x68, 0x6E, 0xC6, 0x73, 0x8A};
+    const uint8 sha256_64[FM_DIGEST_SHA256_LEN] = {
+        0xFF, 0xE0, 0x54, 0xFE, 0x7A, 0xE0, 0xCB, 0x6D, 0xC6, 0x5C, 0x3A, 0xF9, 0xB6, 0x1D, 0x52, 0x09,
+        0xF4, 0x39, 0x85, 0x1D, 0xB4, 0x3D, 0x0B, 0xA5, 0x99, 0x73, 0x37, 0xDF, 0x15, 0x46, 0x68, 0xEB};
+    uint8       data[FM_DIGEST_SHA256_BLOCK];
+    uint32      crc = 0;
+    uint8       xxh[FM_DIGEST_XXH64_LEN];
+    uint8       sha[FM_DIGEST_SHA256_LEN];
+
+    memset(data, 'a', sizeof(data));
+
+    FM_DigestInit(&FM_GlobalData.Digest);
+
+    /* Act - the length still fits in the last block */
+    UT_FM_Digest(data, 55, FM_DIGEST_SHA256, &crc, xxh, sha);
+    UtAssert_MemCmp(sha, sha256_55, sizeof(sha), "SHA-256 of 55 bytes");
+
+    /* Act - the length takes another block */
+    UT_FM_Digest(data, 56, FM_DIGEST_SHA256, &crc, xxh, sha);
+    UtAssert_MemCmp(sha, sha256_56, sizeof(sha), "SHA-256 of 56 bytes");
+
+    /* Act - a whole block */
+    UT_FM_Digest(data, 64, FM_DIGEST_SHA256, &crc, xxh, sha);
+    UtAssert_MemCmp(sha, sha256_64, sizeof(sha), "SHA-256 of 64 bytes");
+}
+
+void Test_FM_DigestFinish_Unselected(void)
+{
+    /* Arrange */
+    uint32 crc = 0;
+    uint8  xxh[FM_DIGEST_XXH64_LEN];
+    uint8  sha[FM_DIGEST_SHA256_LEN];
+
+    memset(xxh, 0xAA, sizeof(xxh));
+    memset(sha, 0xAA, sizeof(sha));
+
+    FM_DigestInit(&FM_GlobalData.Digest);
+
+    /* Act - unknown digest bits are ignored */
+    UT_FM_Digest("123456789", 9, FM_DIGEST_CRC32C | 0x80, &crc, xxh, sha);
+
+    /* Assert */
+    UtAssert_UINT32_EQ(crc, UT_FM_CRC32C_CHECK);
+    UtAssert_MemCmpValue(xxh, 0xAA, sizeof(xxh), "xxHash64 not computed");
+    UtAssert_MemCmpValue(sha, 0xAA, sizeof(sha), "SHA-256 not computed");
+}
+
+/* ****************
+ * DigestUpdate Tests
+ * ***************/
+
+void Test_FM_DigestUpdate_Split(void)
+{
+    /* Arrange */
+    FM_Digest_Context_t context;
+    uint8               data[1000];
+    uint32              crc_whole = 0;
+    uint32              crc_split = 0;
+    uint8               xxh_whole[FM_DIGEST_XXH64_LEN];
+    uint8               xxh_split[FM_DIGEST_XXH64_LEN];
+    uint8               sha_whole[FM_DIGEST_SHA256_LEN];
+    uint8               sha_split[FM_DIGEST_SHA256_LEN];
+    size_t              offset = 0;
+    size_t              length = 1;
+    size_t              i;
+
+    for (i = 0; i < sizeof(data); i++)
+    {
+        data[i] = (uint8)((i * 131) ^ (i >> 3));
+    }
+
+    FM_DigestInit(&FM_GlobalData.Digest);
+
+    UT_FM_Digest(data, sizeof(data), FM_DIGEST_ALL, &crc_whole, xxh_whole, sha_whole);
+
+    /* Act - blocks that end inside, on and across stripe and block boundaries */
+    FM_DigestStart(&context, FM_DIGEST_ALL);
+
+    while (offset < sizeof(data))
+    {
+        if (length > (sizeof(data) - offset))
+        {
+            length = sizeof(data) - offset;
+        }
+
+        FM_DigestUpdate(&FM_GlobalData.Digest, &context, &data[offset], length);
+
+        offset += length;
+        length = (length * 3) + 1;
+    }
+
+    FM_DigestFinish(&context, &crc_split, xxh_split, sha_split);
+
+    /* Assert */
+    UtAssert_UINT32_EQ(crc_split, crc_whole);
+    UtAssert_MemCmp(xxh_split, xxh_whole, sizeof(xxh_whole), "xxHash64 of split blocks");
+    UtAssert_MemCmp(sha_split, sha_whole, sizeof(sha_whole), "SHA-256 of split blocks");
+}
+
+/* ****************
+ * DigestCrc32c Tests
+ * ***************/
+
+void Test_FM_DigestCrc32c_Bytewise(void)
+{
+    /* Arrange */
+    uint8  data[1000];
+    size_t i;
+
+    for (i = 0; i < sizeof(data); i++)
+    {
+        data[i] = (uint8)((i * 197) ^ (i >> 5));
+    }
+
+    FM_DigestInit(&FM_GlobalData.Digest);
+
+    /* Act - every length up to a few steps, from an unaligned start, with a running CRC */
+    for (i = 0; i < 40; i++)
+    {
+        UtAssert_UINT32_EQ(FM_DigestCrc32c(&FM_GlobalData.Digest, &data[1], i, 0x1EDC6F41),
+                           UT_FM_Crc32cBytewise(&data[1], i, 0x1EDC6F41));
+    }
+
+    /* Act - a long block */
+    UtAssert_UINT32_EQ(FM_DigestCrc32c(&FM_GlobalData.Digest, data, sizeof(data), 0xFFFFFFFF),
+                       UT_FM_Crc32cBytewise(data, sizeof(data), 0xFFFFFFFF));
+}
+
+/*
+ * Register the test cases to execute with the unit test tool
+ */
+void UtTest_Setup(void)
+{
+    UtTest_Add(Test_FM_DigestInit_Tables, FM_Test_Setup, FM_Test_Teardown, "Test_FM_DigestInit_Tables");
+
+    UtTest_Add(Test_FM_DigestFinish_Check, FM_Test_Setup, FM_Test_Teardown, "Test_FM_DigestFinish_Check");
+    UtTest_Add(Test_FM_DigestFinish_Vectors, FM_Test_Setup, FM_Test_Teardown, "Test_FM_DigestFinish_Vectors");
+    UtTest_Add(Test_FM_DigestFinish_ShaPadding, FM_Test_Setup, FM_Test_Teardown, "Test_FM_DigestFinish_ShaPadding");
+    UtTest_Add(Test_FM_DigestFinish_Unselected, FM_Test_Setup, FM_Test_Teardown, "Test_FM_DigestFinish_Unselected");
+
+    UtTest_Add(Test_FM_DigestUpdate_Split, FM_Test_Setup, FM_Test_Teardown, "Test_FM_DigestUpdate_Split");
+
+    UtTest_Add(Test_FM_DigestCrc32c_Bytewise, FM_Test_Setup, FM_Test_Teardown, "Test_FM_DigestCrc32c_Bytewise");
+}
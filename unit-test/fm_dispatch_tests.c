@@ -65,6 +65,9 @@ void Test_FM_ProcessCmd_NoopCmdCCReturn(void)
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &length, sizeof(length), false);
     UT_SetDefaultReturnValue(UT_KEY(FM_NoopCmd), true);
 
+    /* A snapshot left by the previous command */
+    FM_GlobalData.OpenPaths.Valid = true;
+
     /* Act */
     UtAssert_VOIDCALL(FM_ProcessCmd(NULL));
 
@@ -73,6 +76,7 @@ void Test_FM_ProcessCmd_NoopCmdCCReturn(void)
     UtAssert_STUB_COUNT(FM_NoopCmd, 1);
     UtAssert_INT32_EQ(FM_GlobalData.CommandCounter, 1);
     UtAssert_INT32_EQ(FM_GlobalData.CommandErrCounter, 0);
+    UtAssert_BOOL_FALSE(FM_GlobalData.OpenPaths.Valid);
 }
 
 void Test_FM_ProcessCmd_ResetCountersCCReturn(void)
@@ -449,6 +453,314 @@ void Test_FM_ProcessCmd_SetPermissionsCCReturn(void)
     UtAssert_INT32_EQ(FM_GlobalData.CommandErrCounter, 0);
 }
 
+void Test_FM_ProcessCmd_SetCopyBlockSizeCCReturn(void)
+{
+    /* Arrange */
+    CFE_MSG_FcnCode_t fcn_code;
+    size_t            length;
+
+    fcn_code = FM_SET_COPY_BLOCK_SIZE_CC;
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &fcn_code, sizeof(fcn_code), false);
+    length = sizeof(FM_SetCopyBlockSizeCmd_t);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &length, sizeof(length), false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_SetCopyBlockSizeCmd), true);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ProcessCmd(NULL));
+
+    /* Assert */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UtAssert_STUB_COUNT(FM_SetCopyBlockSizeCmd, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.CommandCounter, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.CommandErrCounter, 0);
+}
+
+void Test_FM_ProcessCmd_ConcatListCCReturn(void)
+{
+    /* Arrange */
+    CFE_MSG_FcnCode_t fcn_code;
+    size_t            length;
+
+    fcn_code = FM_CONCAT_LIST_CC;
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &fcn_code, sizeof(fcn_code), false);
+    length = sizeof(FM_ConcatListCmd_t);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &length, sizeof(length), false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_ConcatListCmd), true);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ProcessCmd(NULL));
+
+    /* Assert */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UtAssert_STUB_COUNT(FM_ConcatListCmd, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.CommandCounter, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.CommandErrCounter, 0);
+}
+
+void Test_FM_ProcessCmd_SetThrottleCCReturn(void)
+{
+    /* Arrange */
+    CFE_MSG_FcnCode_t fcn_code;
+    size_t            length;
+
+    fcn_code = FM_SET_THROTTLE_CC;
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &fcn_code, sizeof(fcn_code), false);
+    length = sizeof(FM_SetThrottleCmd_t);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &length, sizeof(length), false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_SetThrottleCmd), true);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ProcessCmd(NULL));
+
+    /* Assert */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UtAssert_STUB_COUNT(FM_SetThrottleCmd, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.CommandCounter, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.CommandErrCounter, 0);
+}
+
+void Test_FM_ProcessCmd_AbortCCReturn(void)
+{
+    /* Arrange */
+    CFE_MSG_FcnCode_t fcn_code;
+    size_t            length;
+
+    fcn_code = FM_ABORT_CC;
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &fcn_code, sizeof(fcn_code), false);
+    length = sizeof(FM_AbortCmd_t);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &length, sizeof(length), false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_AbortCmd), true);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ProcessCmd(NULL));
+
+    /* Assert */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UtAssert_STUB_COUNT(FM_AbortCmd, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.CommandCounter, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.CommandErrCounter, 0);
+}
+
+void Test_FM_ProcessCmd_FlushQueueCCReturn(void)
+{
+    /* Arrange */
+    CFE_MSG_FcnCode_t fcn_code;
+    size_t            length;
+
+    fcn_code = FM_FLUSH_QUEUE_CC;
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &fcn_code, sizeof(fcn_code), false);
+    length = sizeof(FM_FlushQueueCmd_t);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &length, sizeof(length), false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_FlushQueueCmd), true);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ProcessCmd(NULL));
+
+    /* Assert */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UtAssert_STUB_COUNT(FM_FlushQueueCmd, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.CommandCounter, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.CommandErrCounter, 0);
+}
+
+void Test_FM_ProcessCmd_SendLatencyCCReturn(void)
+{
+    /* Arrange */
+    CFE_MSG_FcnCode_t fcn_code;
+    size_t            length;
+
+    fcn_code = FM_SEND_LATENCY_CC;
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &fcn_code, sizeof(fcn_code), false);
+    length = sizeof(FM_SendLatencyCmd_t);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &length, sizeof(length), false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_SendLatencyCmd), true);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ProcessCmd(NULL));
+
+    /* Assert */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UtAssert_STUB_COUNT(FM_SendLatencyCmd, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.CommandCounter, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.CommandErrCounter, 0);
+}
+
+void Test_FM_ProcessCmd_ResetLatencyCCReturn(void)
+{
+    /* Arrange */
+    CFE_MSG_FcnCode_t fcn_code;
+    size_t            length;
+
+    fcn_code = FM_RESET_LATENCY_CC;
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &fcn_code, sizeof(fcn_code), false);
+    length = sizeof(FM_ResetLatencyCmd_t);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &length, sizeof(length), false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_ResetLatencyCmd), true);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ProcessCmd(NULL));
+
+    /* Assert */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UtAssert_STUB_COUNT(FM_ResetLatencyCmd, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.CommandCounter, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.CommandErrCounter, 0);
+}
+
+void Test_FM_ProcessCmd_SetVerifyModeCCReturn(void)
+{
+    /* Arrange */
+    CFE_MSG_FcnCode_t fcn_code;
+    size_t            length;
+
+    fcn_code = FM_SET_VERIFY_MODE_CC;
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &fcn_code, sizeof(fcn_code), false);
+    length = sizeof(FM_SetVerifyModeCmd_t);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &length, sizeof(length), false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_SetVerifyModeCmd), true);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ProcessCmd(NULL));
+
+    /* Assert */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UtAssert_STUB_COUNT(FM_SetVerifyModeCmd, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.CommandCounter, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.CommandErrCounter, 0);
+}
+
+void Test_FM_ProcessCmd_DeleteTreeCCReturn(void)
+{
+    /* Arrange */
+    CFE_MSG_FcnCode_t fcn_code;
+    size_t            length;
+
+    fcn_code = FM_DELETE_TREE_CC;
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &fcn_code, sizeof(fcn_code), false);
+    length = sizeof(FM_DeleteTreeCmd_t);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &length, sizeof(length), false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_DeleteTreeCmd), true);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ProcessCmd(NULL));
+
+    /* Assert */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UtAssert_STUB_COUNT(FM_DeleteTreeCmd, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.CommandCounter, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.CommandErrCounter, 0);
+}
+
+void Test_FM_ProcessCmd_FilterFilesCCReturn(void)
+{
+    /* Arrange */
+    CFE_MSG_FcnCode_t fcn_code;
+    size_t            length;
+
+    fcn_code = FM_FILTER_FILES_CC;
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &fcn_code, sizeof(fcn_code), false);
+    length = sizeof(FM_FilterFilesCmd_t);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &length, sizeof(length), false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_FilterFilesCmd), true);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ProcessCmd(NULL));
+
+    /* Assert */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UtAssert_STUB_COUNT(FM_FilterFilesCmd, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.CommandCounter, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.CommandErrCounter, 0);
+}
+
+void Test_FM_ProcessCmd_EnforceRetentionCCReturn(void)
+{
+    /* Arrange */
+    CFE_MSG_FcnCode_t fcn_code;
+    size_t            length;
+
+    fcn_code = FM_ENFORCE_RETENTION_CC;
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &fcn_code, sizeof(fcn_code), false);
+    length = sizeof(FM_EnforceRetentionCmd_t);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &length, sizeof(length), false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_EnforceRetentionCmd), true);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ProcessCmd(NULL));
+
+    /* Assert */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UtAssert_STUB_COUNT(FM_EnforceRetentionCmd, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.CommandCounter, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.CommandErrCounter, 0);
+}
+
+void Test_FM_ProcessCmd_SetDeleteModeCCReturn(void)
+{
+    /* Arrange */
+    CFE_MSG_FcnCode_t fcn_code;
+    size_t            length;
+
+    fcn_code = FM_SET_DELETE_MODE_CC;
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &fcn_code, sizeof(fcn_code), false);
+    length = sizeof(FM_SetDeleteModeCmd_t);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &length, sizeof(length), false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_SetDeleteModeCmd), true);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ProcessCmd(NULL));
+
+    /* Assert */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UtAssert_STUB_COUNT(FM_SetDeleteModeCmd, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.CommandCounter, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.CommandErrCounter, 0);
+}
+
+void Test_FM_ProcessCmd_PurgeTrashCCReturn(void)
+{
+    /* Arrange */
+    CFE_MSG_FcnCode_t fcn_code;
+    size_t            length;
+
+    fcn_code = FM_PURGE_TRASH_CC;
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &fcn_code, sizeof(fcn_code), false);
+    length = sizeof(FM_PurgeTrashCmd_t);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &length, sizeof(length), false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_PurgeTrashCmd), true);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ProcessCmd(NULL));
+
+    /* Assert */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UtAssert_STUB_COUNT(FM_PurgeTrashCmd, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.CommandCounter, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.CommandErrCounter, 0);
+}
+
+void Test_FM_ProcessCmd_GetFileDigestCCReturn(void)
+{
+    /* Arrange */
+    CFE_MSG_FcnCode_t fcn_code;
+    size_t            length;
+
+    fcn_code = FM_GET_FILE_DIGEST_CC;
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &fcn_code, sizeof(fcn_code), false);
+    length = sizeof(FM_GetFileDigestCmd_t);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &length, sizeof(length), false);
+    UT_SetDefaultReturnValue(UT_KEY(FM_GetFileDigestCmd), true);
+
+    /* Act */
+    UtAssert_VOIDCALL(FM_ProcessCmd(NULL));
+
+    /* Assert */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UtAssert_STUB_COUNT(FM_GetFileDigestCmd, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.CommandCounter, 1);
+    UtAssert_INT32_EQ(FM_GlobalData.CommandErrCounter, 0);
+}
+
 void Test_FM_ProcessCmd_DefaultReturn(void)
 {
     /* Arrange */
@@ -524,6 +836,42 @@ void add_FM_ProcessCmd_tests(void)
     UtTest_Add(Test_FM_ProcessCmd_SetPermissionsCCReturn, FM_Test_Setup, FM_Test_Teardown,
                "Test_FM_ProcessCmd_SetPermissionsCCReturn");
 
+    UtTest_Add(Test_FM_ProcessCmd_SetCopyBlockSizeCCReturn, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ProcessCmd_SetCopyBlockSizeCCReturn");
+
+    UtTest_Add(Test_FM_ProcessCmd_ConcatListCCReturn, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ProcessCmd_ConcatListCCReturn");
+
+    UtTest_Add(Test_FM_ProcessCmd_SetThrottleCCReturn, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ProcessCmd_SetThrottleCCReturn");
+
+    UtTest_Add(Test_FM_ProcessCmd_AbortCCReturn, FM_Test_Setup, FM_Test_Teardown, "Test_FM_ProcessCmd_AbortCCReturn");
+
+    UtTest_Add(Test_FM_ProcessCmd_FlushQueueCCReturn, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ProcessCmd_FlushQueueCCReturn");
+
+    UtTest_Add(Test_FM_ProcessCmd_SendLatencyCCReturn, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ProcessCmd_SendLatencyCCReturn");
+
+    UtTest_Add(Test_FM_ProcessCmd_ResetLatencyCCReturn, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ProcessCmd_ResetLatencyCCReturn");
+
+    UtTest_Add(Test_FM_ProcessCmd_SetVerifyModeCCReturn, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ProcessCmd_SetVerifyModeCCReturn");
+
+    UtTest_Add(Test_FM_ProcessCmd_DeleteTreeCCReturn, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ProcessCmd_DeleteTreeCCReturn");
+    UtTest_Add(Test_FM_ProcessCmd_FilterFilesCCReturn, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ProcessCmd_FilterFilesCCReturn");
+    UtTest_Add(Test_FM_ProcessCmd_EnforceRetentionCCReturn, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ProcessCmd_EnforceRetentionCCReturn");
+    UtTest_Add(Test_FM_ProcessCmd_SetDeleteModeCCReturn, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ProcessCmd_SetDeleteModeCCReturn");
+    UtTest_Add(Test_FM_ProcessCmd_PurgeTrashCCReturn, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ProcessCmd_PurgeTrashCCReturn");
+    UtTest_Add(Test_FM_ProcessCmd_GetFileDigestCCReturn, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ProcessCmd_GetFileDigestCCReturn");
+
     UtTest_Add(Test_FM_ProcessCmd_DefaultReturn, FM_Test_Setup, FM_Test_Teardown, "Test_FM_ProcessCmd_DefaultReturn");
 }
 
@@ -898,6 +1246,216 @@ void Test_FM_SetPermissionsVerifyDispatch(void)
     UtAssert_BOOL_TRUE(FM_SetPermissionsVerifyDispatch(&UT_CmdBuf.Buf));
 }
 
+void Test_FM_SetCopyBlockSizeVerifyDispatch(void)
+{
+    size_t length;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_SetCopyBlockSizeCmd), true);
+
+    length = 1; /* bad size for any message */
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &length, sizeof(length), false);
+    UtAssert_BOOL_FALSE(FM_SetCopyBlockSizeVerifyDispatch(&UT_CmdBuf.Buf));
+
+    length = sizeof(FM_SetCopyBlockSizeCmd_t);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &length, sizeof(length), false);
+    UtAssert_BOOL_TRUE(FM_SetCopyBlockSizeVerifyDispatch(&UT_CmdBuf.Buf));
+}
+
+void Test_FM_ConcatListVerifyDispatch(void)
+{
+    size_t length;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_ConcatListCmd), true);
+
+    length = 1; /* bad size for any message */
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &length, sizeof(length), false);
+    UtAssert_BOOL_FALSE(FM_ConcatListVerifyDispatch(&UT_CmdBuf.Buf));
+
+    length = sizeof(FM_ConcatListCmd_t);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &length, sizeof(length), false);
+    UtAssert_BOOL_TRUE(FM_ConcatListVerifyDispatch(&UT_CmdBuf.Buf));
+}
+
+void Test_FM_SetThrottleVerifyDispatch(void)
+{
+    size_t length;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_SetThrottleCmd), true);
+
+    length = 1; /* bad size for any message */
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &length, sizeof(length), false);
+    UtAssert_BOOL_FALSE(FM_SetThrottleVerifyDispatch(&UT_CmdBuf.Buf));
+
+    length = sizeof(FM_SetThrottleCmd_t);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &length, sizeof(length), false);
+    UtAssert_BOOL_TRUE(FM_SetThrottleVerifyDispatch(&UT_CmdBuf.Buf));
+}
+
+void Test_FM_AbortVerifyDispatch(void)
+{
+    size_t length;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_AbortCmd), true);
+
+    length = 1; /* bad size for any message */
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &length, sizeof(length), false);
+    UtAssert_BOOL_FALSE(FM_AbortVerifyDispatch(&UT_CmdBuf.Buf));
+
+    length = sizeof(FM_AbortCmd_t);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &length, sizeof(length), false);
+    UtAssert_BOOL_TRUE(FM_AbortVerifyDispatch(&UT_CmdBuf.Buf));
+}
+
+void Test_FM_FlushQueueVerifyDispatch(void)
+{
+    size_t length;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_FlushQueueCmd), true);
+
+    length = 1; /* bad size for any message */
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &length, sizeof(length), false);
+    UtAssert_BOOL_FALSE(FM_FlushQueueVerifyDispatch(&UT_CmdBuf.Buf));
+
+    length = sizeof(FM_FlushQueueCmd_t);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &length, sizeof(length), false);
+    UtAssert_BOOL_TRUE(FM_FlushQueueVerifyDispatch(&UT_CmdBuf.Buf));
+}
+
+void Test_FM_SendLatencyVerifyDispatch(void)
+{
+    size_t length;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_SendLatencyCmd), true);
+
+    length = 1; /* bad size for any message */
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &length, sizeof(length), false);
+    UtAssert_BOOL_FALSE(FM_SendLatencyVerifyDispatch(&UT_CmdBuf.Buf));
+
+    length = sizeof(FM_SendLatencyCmd_t);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &length, sizeof(length), false);
+    UtAssert_BOOL_TRUE(FM_SendLatencyVerifyDispatch(&UT_CmdBuf.Buf));
+}
+
+void Test_FM_ResetLatencyVerifyDispatch(void)
+{
+    size_t length;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_ResetLatencyCmd), true);
+
+    length = 1; /* bad size for any message */
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &length, sizeof(length), false);
+    UtAssert_BOOL_FALSE(FM_ResetLatencyVerifyDispatch(&UT_CmdBuf.Buf));
+
+    length = sizeof(FM_ResetLatencyCmd_t);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &length, sizeof(length), false);
+    UtAssert_BOOL_TRUE(FM_ResetLatencyVerifyDispatch(&UT_CmdBuf.Buf));
+}
+
+void Test_FM_SetVerifyModeVerifyDispatch(void)
+{
+    size_t length;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_SetVerifyModeCmd), true);
+
+    length = 1; /* bad size for any message */
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &length, sizeof(length), false);
+    UtAssert_BOOL_FALSE(FM_SetVerifyModeVerifyDispatch(&UT_CmdBuf.Buf));
+
+    length = sizeof(FM_SetVerifyModeCmd_t);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &length, sizeof(length), false);
+    UtAssert_BOOL_TRUE(FM_SetVerifyModeVerifyDispatch(&UT_CmdBuf.Buf));
+}
+
+void Test_FM_DeleteTreeVerifyDispatch(void)
+{
+    size_t length;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_DeleteTreeCmd), true);
+
+    length = 1; /* bad size for any message */
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &length, sizeof(length), false);
+    UtAssert_BOOL_FALSE(FM_DeleteTreeVerifyDispatch(&UT_CmdBuf.Buf));
+
+    length = sizeof(FM_DeleteTreeCmd_t);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &length, sizeof(length), false);
+    UtAssert_BOOL_TRUE(FM_DeleteTreeVerifyDispatch(&UT_CmdBuf.Buf));
+}
+
+void Test_FM_FilterFilesVerifyDispatch(void)
+{
+    size_t length;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_FilterFilesCmd), true);
+
+    length = 1; /* bad size for any message */
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &length, sizeof(length), false);
+    UtAssert_BOOL_FALSE(FM_FilterFilesVerifyDispatch(&UT_CmdBuf.Buf));
+
+    length = sizeof(FM_FilterFilesCmd_t);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &length, sizeof(length), false);
+    UtAssert_BOOL_TRUE(FM_FilterFilesVerifyDispatch(&UT_CmdBuf.Buf));
+}
+
+void Test_FM_EnforceRetentionVerifyDispatch(void)
+{
+    size_t length;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_EnforceRetentionCmd), true);
+
+    length = 1; /* bad size for any message */
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &length, sizeof(length), false);
+    UtAssert_BOOL_FALSE(FM_EnforceRetentionVerifyDispatch(&UT_CmdBuf.Buf));
+
+    length = sizeof(FM_EnforceRetentionCmd_t);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &length, sizeof(length), false);
+    UtAssert_BOOL_TRUE(FM_EnforceRetentionVerifyDispatch(&UT_CmdBuf.Buf));
+}
+
+void Test_FM_SetDeleteModeVerifyDispatch(void)
+{
+    size_t length;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_SetDeleteModeCmd), true);
+
+    length = 1; /* bad size for any message */
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &length, sizeof(length), false);
+    UtAssert_BOOL_FALSE(FM_SetDeleteModeVerifyDispatch(&UT_CmdBuf.Buf));
+
+    length = sizeof(FM_SetDeleteModeCmd_t);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &length, sizeof(length), false);
+    UtAssert_BOOL_TRUE(FM_SetDeleteModeVerifyDispatch(&UT_CmdBuf.Buf));
+}
+
+void Test_FM_PurgeTrashVerifyDispatch(void)
+{
+    size_t length;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_PurgeTrashCmd), true);
+
+    length = 1; /* bad size for any message */
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &length, sizeof(length), false);
+    UtAssert_BOOL_FALSE(FM_PurgeTrashVerifyDispatch(&UT_CmdBuf.Buf));
+
+    length = sizeof(FM_PurgeTrashCmd_t);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &length, sizeof(length), false);
+    UtAssert_BOOL_TRUE(FM_PurgeTrashVerifyDispatch(&UT_CmdBuf.Buf));
+}
+
+void Test_FM_GetFileDigestVerifyDispatch(void)
+{
+    size_t length;
+
+    UT_SetDefaultReturnValue(UT_KEY(FM_GetFileDigestCmd), true);
+
+    length = 1; /* bad size for any message */
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &length, sizeof(length), false);
+    UtAssert_BOOL_FALSE(FM_GetFileDigestVerifyDispatch(&UT_CmdBuf.Buf));
+
+    length = sizeof(FM_GetFileDigestCmd_t);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &length, sizeof(length), false);
+    UtAssert_BOOL_TRUE(FM_GetFileDigestVerifyDispatch(&UT_CmdBuf.Buf));
+}
+
 void Test_FM_SendHkVerifyDispatch(void)
 {
     size_t length;
@@ -964,5 +1522,28 @@ void UtTest_Setup(void)
     UtTest_Add(Test_FM_SetPermissionsVerifyDispatch, FM_Test_Setup, FM_Test_Teardown,
                "Test_FM_SetPermissionsVerifyDispatch");
 
+    UtTest_Add(Test_FM_SetCopyBlockSizeVerifyDispatch, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_SetCopyBlockSizeVerifyDispatch");
+
+    UtTest_Add(Test_FM_ConcatListVerifyDispatch, FM_Test_Setup, FM_Test_Teardown, "Test_FM_ConcatListVerifyDispatch");
+
+    UtTest_Add(Test_FM_SetThrottleVerifyDispatch, FM_Test_Setup, FM_Test_Teardown, "Test_FM_SetThrottleVerifyDispatch");
+    UtTest_Add(Test_FM_AbortVerifyDispatch, FM_Test_Setup, FM_Test_Teardown, "Test_FM_AbortVerifyDispatch");
+    UtTest_Add(Test_FM_FlushQueueVerifyDispatch, FM_Test_Setup, FM_Test_Teardown, "Test_FM_FlushQueueVerifyDispatch");
+    UtTest_Add(Test_FM_SendLatencyVerifyDispatch, FM_Test_Setup, FM_Test_Teardown, "Test_FM_SendLatencyVerifyDispatch");
+    UtTest_Add(Test_FM_ResetLatencyVerifyDispatch, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ResetLatencyVerifyDispatch");
+    UtTest_Add(Test_FM_SetVerifyModeVerifyDispatch, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_SetVerifyModeVerifyDispatch");
+    UtTest_Add(Test_FM_DeleteTreeVerifyDispatch, FM_Test_Setup, FM_Test_Teardown, "Test_FM_DeleteTreeVerifyDispatch");
+    UtTest_Add(Test_FM_FilterFilesVerifyDispatch, FM_Test_Setup, FM_Test_Teardown, "Test_FM_FilterFilesVerifyDispatch");
+    UtTest_Add(Test_FM_EnforceRetentionVerifyDispatch, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_EnforceRetentionVerifyDispatch");
+    UtTest_Add(Test_FM_SetDeleteModeVerifyDispatch, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_SetDeleteModeVerifyDispatch");
+    UtTest_Add(Test_FM_PurgeTrashVerifyDispatch, FM_Test_Setup, FM_Test_Teardown, "Test_FM_PurgeTrashVerifyDispatch");
+    UtTest_Add(Test_FM_GetFileDigestVerifyDispatch, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_GetFileDigestVerifyDispatch");
+
     UtTest_Add(Test_FM_SendHkVerifyDispatch, FM_Test_Setup, FM_Test_Teardown, "Test_FM_SendHkVerifyDispatch");
 }
@@ -81,6 +81,21 @@ void Test_FM_TableInit_Fail(void)
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
 }
 
+void Test_FM_TableInit_RetentionFail(void)
+{
+    CFE_Status_t Result;
+
+    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_Register), 2, -1);
+
+    Result = FM_TableInit();
+
+    /* Assert */
+    UtAssert_INT32_EQ(Result, -1);
+    UtAssert_STUB_COUNT(CFE_TBL_Register, 2);
+    UtAssert_STUB_COUNT(CFE_TBL_Load, 0);
+    UtAssert_NULL(FM_GlobalData.RetentionTablePtr);
+}
+
 /************************/
 /* Table Init Tests     */
 /************************/
@@ -378,6 +393,92 @@ void Test_FM_ValidateTable_NameTooLong(void)
     UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[1].Spec);
 }
 
+/******************************/
+/* Retention Table Tests      */
+/******************************/
+
+void Test_FM_ValidateRetentionTable_Success(void)
+{
+    FM_RetentionTable_t Table;
+
+    memset(&Table, 0, sizeof(Table));
+    Table.Entries[0].Enabled  = FM_TABLE_ENTRY_ENABLED;
+    Table.Entries[0].Order    = FM_RETENTION_ORDER_PRIORITY;
+    Table.Entries[0].Interval = 60;
+    Table.Entries[0].MaxFiles = 100;
+    snprintf(Table.Entries[0].Directory, sizeof(Table.Entries[0].Directory), "/ram/rec");
+    snprintf(Table.Entries[0].Priority[0], sizeof(Table.Entries[0].Priority[0]), "*.tmp");
+    Table.Entries[1].Enabled  = FM_TABLE_ENTRY_DISABLED;
+    Table.Entries[1].Interval = 10;
+    Table.Entries[1].MaxBytes = 1000;
+    snprintf(Table.Entries[1].Directory, sizeof(Table.Entries[1].Directory), "/ram/log");
+
+    /* Act */
+    UtAssert_INT32_EQ(FM_ValidateRetentionTable(&Table), CFE_SUCCESS);
+
+    /* Assert */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_RETENTION_TABLE_VERIFY_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+}
+
+void Test_FM_ValidateRetentionTable_NullTable(void)
+{
+    /* Act */
+    UtAssert_INT32_EQ(FM_ValidateRetentionTable(NULL), FM_TABLE_VALIDATION_ERR);
+
+    /* Assert */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_RETENTION_TABLE_VERIFY_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void Test_FM_ValidateRetentionTable_BadEntries(void)
+{
+    FM_RetentionTable_t Table;
+    uint32              i;
+
+    /* Every entry breaks a different rule */
+    memset(&Table, 0, sizeof(Table));
+    for (i = 0; i < FM_RETENTION_ENTRY_COUNT; i++)
+    {
+        Table.Entries[i].Enabled  = FM_TABLE_ENTRY_ENABLED;
+        Table.Entries[i].Interval = 60;
+        Table.Entries[i].MaxFiles = 100;
+        snprintf(Table.Entries[i].Directory, sizeof(Table.Entries[i].Directory), "/ram/rec");
+    }
+    Table.Entries[0].Directory[0] = '\0';
+    memset(Table.Entries[1].Directory, 'a', sizeof(Table.Entries[1].Directory));
+    Table.Entries[2].Enabled = 2;
+    Table.Entries[3].Order   = FM_RETENTION_ORDER_PRIORITY + 1;
+
+    /* Act */
+    UtAssert_INT32_EQ(FM_ValidateRetentionTable(&Table), FM_TABLE_VALIDATION_ERR);
+
+    /* Assert - only the first bad entry is reported */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, FM_RETENTION_TABLE_VERIFY_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, FM_RETENTION_TABLE_VERIFY_EID);
+
+    /* Remaining rules, one entry at a time */
+    memset(&Table, 0, sizeof(Table));
+    Table.Entries[0].Enabled  = FM_TABLE_ENTRY_ENABLED;
+    Table.Entries[0].MaxFiles = 100;
+    snprintf(Table.Entries[0].Directory, sizeof(Table.Entries[0].Directory), "/ram/rec");
+    UtAssert_INT32_EQ(FM_ValidateRetentionTable(&Table), FM_TABLE_VALIDATION_ERR);
+
+    Table.Entries[0].Interval = 60;
+    Table.Entries[0].MaxFiles = 0;
+    UtAssert_INT32_EQ(FM_ValidateRetentionTable(&Table), FM_TABLE_VALIDATION_ERR);
+
+    Table.Entries[0].MaxFiles = 100;
+    memset(Table.Entries[0].Priority[FM_RETENTION_PATTERN_COUNT - 1], 'a', sizeof(Table.Entries[0].Priority[0]));
+    UtAssert_INT32_EQ(FM_ValidateRetentionTable(&Table), FM_TABLE_VALIDATION_ERR);
+
+    Table.Entries[0].Priority[FM_RETENTION_PATTERN_COUNT - 1][0] = '\0';
+    UtAssert_INT32_EQ(FM_ValidateRetentionTable(&Table), CFE_SUCCESS);
+}
+
 void Test_FM_AcquireTablePointers_Success(void)
 {
     FM_MonitorTable_t Table;
@@ -389,6 +490,7 @@ void Test_FM_AcquireTablePointers_Success(void)
     FM_AcquireTablePointers();
 
     UtAssert_NOT_NULL(FM_GlobalData.MonitorTablePtr);
+    UtAssert_STUB_COUNT(CFE_TBL_GetAddress, 2);
 }
 
 void Test_FM_AcquireTablePointers_Fail(void)
@@ -402,17 +504,22 @@ void Test_FM_AcquireTablePointers_Fail(void)
     FM_AcquireTablePointers();
 
     UtAssert_NULL(FM_GlobalData.MonitorTablePtr);
+    UtAssert_NULL(FM_GlobalData.RetentionTablePtr);
 }
 
 void Test_FM_ReleaseTablePointers(void)
 {
-    FM_MonitorTable_t Table;
+    FM_MonitorTable_t   Table;
+    FM_RetentionTable_t RetentionTable;
 
-    FM_GlobalData.MonitorTablePtr = &Table;
+    FM_GlobalData.MonitorTablePtr   = &Table;
+    FM_GlobalData.RetentionTablePtr = &RetentionTable;
 
     FM_ReleaseTablePointers();
 
     UtAssert_NULL(FM_GlobalData.MonitorTablePtr);
+    UtAssert_NULL(FM_GlobalData.RetentionTablePtr);
+    UtAssert_STUB_COUNT(CFE_TBL_ReleaseAddress, 2);
 }
 
 /*
@@ -424,6 +531,8 @@ void UtTest_Setup(void)
 
     UtTest_Add(Test_FM_TableInit_Fail, FM_Test_Setup, FM_Test_Teardown, "Test_FM_TableInit_Fail");
 
+    UtTest_Add(Test_FM_TableInit_RetentionFail, FM_Test_Setup, FM_Test_Teardown, "Test_FM_TableInit_RetentionFail");
+
     UtTest_Add(Test_FM_ValidateTable_Success, FM_Test_Setup, FM_Test_Teardown, "Test_FM_ValidateTable_Success");
 
     UtTest_Add(Test_FM_ValidateTable_NullTable, FM_Test_Setup, FM_Test_Teardown, "Test_FM_ValidateTable_NullTable");
@@ -437,6 +546,15 @@ void UtTest_Setup(void)
 
     UtTest_Add(Test_FM_ValidateTable_NameTooLong, FM_Test_Setup, FM_Test_Teardown, "Test_FM_ValidateTable_NameTooLong");
 
+    UtTest_Add(Test_FM_ValidateRetentionTable_Success, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ValidateRetentionTable_Success");
+
+    UtTest_Add(Test_FM_ValidateRetentionTable_NullTable, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ValidateRetentionTable_NullTable");
+
+    UtTest_Add(Test_FM_ValidateRetentionTable_BadEntries, FM_Test_Setup, FM_Test_Teardown,
+               "Test_FM_ValidateRetentionTable_BadEntries");
+
     UtTest_Add(Test_FM_AcquireTablePointers_Success, FM_Test_Setup, FM_Test_Teardown,
                "Test_FM_AcquireTablePointers_Success");
 
@@ -51,6 +51,26 @@ void FM_AppMain(void)
     UT_GenStub_Execute(FM_AppMain, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_RetentionSchedule()
+ * ----------------------------------------------------
+ */
+void FM_RetentionSchedule(void)
+{
+    UT_GenStub_Execute(FM_RetentionSchedule, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_SendChildProgress()
+ * ----------------------------------------------------
+ */
+void FM_SendChildProgress(void)
+{
+    UT_GenStub_Execute(FM_SendChildProgress, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for FM_SendHkCmd()
@@ -62,3 +82,13 @@ void FM_SendHkCmd(const CFE_SB_Buffer_t *BufPtr)
 
     UT_GenStub_Execute(FM_SendHkCmd, Basic, NULL);
 }
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_TrashSchedule()
+ * ----------------------------------------------------
+ */
+void FM_TrashSchedule(void)
+{
+    UT_GenStub_Execute(FM_TrashSchedule, Basic, NULL);
+}
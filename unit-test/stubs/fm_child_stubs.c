@@ -26,208 +26,1059 @@
 #include "fm_child.h"
 #include "utgenstub.h"
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildAbortCheck()
+ * ----------------------------------------------------
+ */
+bool FM_ChildAbortCheck(FM_ChildWorker_t *Worker, const char *CmdText)
+{
+    UT_GenStub_SetupReturnBuffer(FM_ChildAbortCheck, bool);
+
+    UT_GenStub_AddParam(FM_ChildAbortCheck, FM_ChildWorker_t *, Worker);
+    UT_GenStub_AddParam(FM_ChildAbortCheck, const char *, CmdText);
+
+    UT_GenStub_Execute(FM_ChildAbortCheck, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_ChildAbortCheck, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildCheckpointBegin()
+ * ----------------------------------------------------
+ */
+void FM_ChildCheckpointBegin(FM_ChildWorker_t *Worker, const FM_ChildQueueEntry_t *CmdArgs)
+{
+    UT_GenStub_AddParam(FM_ChildCheckpointBegin, FM_ChildWorker_t *, Worker);
+    UT_GenStub_AddParam(FM_ChildCheckpointBegin, const FM_ChildQueueEntry_t *, CmdArgs);
+
+    UT_GenStub_Execute(FM_ChildCheckpointBegin, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildCheckpointEnd()
+ * ----------------------------------------------------
+ */
+void FM_ChildCheckpointEnd(FM_ChildWorker_t *Worker)
+{
+    UT_GenStub_AddParam(FM_ChildCheckpointEnd, FM_ChildWorker_t *, Worker);
+
+    UT_GenStub_Execute(FM_ChildCheckpointEnd, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildCheckpointName()
+ * ----------------------------------------------------
+ */
+void FM_ChildCheckpointName(const FM_ChildWorker_t *Worker, char *FileName, uint32 BufferSize)
+{
+    UT_GenStub_AddParam(FM_ChildCheckpointName, const FM_ChildWorker_t *, Worker);
+    UT_GenStub_AddParam(FM_ChildCheckpointName, char *, FileName);
+    UT_GenStub_AddParam(FM_ChildCheckpointName, uint32, BufferSize);
+
+    UT_GenStub_Execute(FM_ChildCheckpointName, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildCheckpointResume()
+ * ----------------------------------------------------
+ */
+void FM_ChildCheckpointResume(FM_ChildWorker_t *Worker)
+{
+    UT_GenStub_AddParam(FM_ChildCheckpointResume, FM_ChildWorker_t *, Worker);
+
+    UT_GenStub_Execute(FM_ChildCheckpointResume, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildCheckpointSave()
+ * ----------------------------------------------------
+ */
+void FM_ChildCheckpointSave(FM_ChildWorker_t *Worker, uint32 Bytes)
+{
+    UT_GenStub_AddParam(FM_ChildCheckpointSave, FM_ChildWorker_t *, Worker);
+    UT_GenStub_AddParam(FM_ChildCheckpointSave, uint32, Bytes);
+
+    UT_GenStub_Execute(FM_ChildCheckpointSave, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildCheckpointSeek()
+ * ----------------------------------------------------
+ */
+bool FM_ChildCheckpointSeek(FM_ChildWorker_t *Worker, osal_id_t FileHandleSrc, osal_id_t FileHandleTgt,
+                            const char *CmdText)
+{
+    UT_GenStub_SetupReturnBuffer(FM_ChildCheckpointSeek, bool);
+
+    UT_GenStub_AddParam(FM_ChildCheckpointSeek, FM_ChildWorker_t *, Worker);
+    UT_GenStub_AddParam(FM_ChildCheckpointSeek, osal_id_t, FileHandleSrc);
+    UT_GenStub_AddParam(FM_ChildCheckpointSeek, osal_id_t, FileHandleTgt);
+    UT_GenStub_AddParam(FM_ChildCheckpointSeek, const char *, CmdText);
+
+    UT_GenStub_Execute(FM_ChildCheckpointSeek, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_ChildCheckpointSeek, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildCheckpointSource()
+ * ----------------------------------------------------
+ */
+bool FM_ChildCheckpointSource(FM_ChildWorker_t *Worker, uint32 SourceIndex, const char *Source, const char *Target,
+                              const char *CmdText, uint32 *ResumeOffset)
+{
+    UT_GenStub_SetupReturnBuffer(FM_ChildCheckpointSource, bool);
+
+    UT_GenStub_AddParam(FM_ChildCheckpointSource, FM_ChildWorker_t *, Worker);
+    UT_GenStub_AddParam(FM_ChildCheckpointSource, uint32, SourceIndex);
+    UT_GenStub_AddParam(FM_ChildCheckpointSource, const char *, Source);
+    UT_GenStub_AddParam(FM_ChildCheckpointSource, const char *, Target);
+    UT_GenStub_AddParam(FM_ChildCheckpointSource, const char *, CmdText);
+    UT_GenStub_AddParam(FM_ChildCheckpointSource, uint32 *, ResumeOffset);
+
+    UT_GenStub_Execute(FM_ChildCheckpointSource, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_ChildCheckpointSource, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildClaimPaths()
+ * ----------------------------------------------------
+ */
+void FM_ChildClaimPaths(FM_ChildWorker_t *Worker)
+{
+    UT_GenStub_AddParam(FM_ChildClaimPaths, FM_ChildWorker_t *, Worker);
+
+    UT_GenStub_Execute(FM_ChildClaimPaths, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildConcatAppend()
+ * ----------------------------------------------------
+ */
+bool FM_ChildConcatAppend(FM_ChildWorker_t *Worker, const FM_ChildQueueEntry_t *CmdArgs, uint32 ResumeOffset,
+                          const char *CmdText)
+{
+    UT_GenStub_SetupReturnBuffer(FM_ChildConcatAppend, bool);
+
+    UT_GenStub_AddParam(FM_ChildConcatAppend, FM_ChildWorker_t *, Worker);
+    UT_GenStub_AddParam(FM_ChildConcatAppend, const FM_ChildQueueEntry_t *, CmdArgs);
+    UT_GenStub_AddParam(FM_ChildConcatAppend, uint32, ResumeOffset);
+    UT_GenStub_AddParam(FM_ChildConcatAppend, const char *, CmdText);
+
+    UT_GenStub_Execute(FM_ChildConcatAppend, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_ChildConcatAppend, bool);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for FM_ChildConcatFilesCmd()
  * ----------------------------------------------------
  */
-void FM_ChildConcatFilesCmd(const FM_ChildQueueEntry_t *CmdArgs)
+void FM_ChildConcatFilesCmd(FM_ChildWorker_t *Worker, const FM_ChildQueueEntry_t *CmdArgs)
+{
+    UT_GenStub_AddParam(FM_ChildConcatFilesCmd, FM_ChildWorker_t *, Worker);
+    UT_GenStub_AddParam(FM_ChildConcatFilesCmd, const FM_ChildQueueEntry_t *, CmdArgs);
+
+    UT_GenStub_Execute(FM_ChildConcatFilesCmd, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildConcatListCmd()
+ * ----------------------------------------------------
+ */
+void FM_ChildConcatListCmd(FM_ChildWorker_t *Worker, const FM_ChildQueueEntry_t *CmdArgs)
+{
+    UT_GenStub_AddParam(FM_ChildConcatListCmd, FM_ChildWorker_t *, Worker);
+    UT_GenStub_AddParam(FM_ChildConcatListCmd, const FM_ChildQueueEntry_t *, CmdArgs);
+
+    UT_GenStub_Execute(FM_ChildConcatListCmd, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildConcatListNext()
+ * ----------------------------------------------------
+ */
+int32 FM_ChildConcatListNext(FM_ChildWorker_t *Worker, char *Source, uint32 BufferSize)
+{
+    UT_GenStub_SetupReturnBuffer(FM_ChildConcatListNext, int32);
+
+    UT_GenStub_AddParam(FM_ChildConcatListNext, FM_ChildWorker_t *, Worker);
+    UT_GenStub_AddParam(FM_ChildConcatListNext, char *, Source);
+    UT_GenStub_AddParam(FM_ChildConcatListNext, uint32, BufferSize);
+
+    UT_GenStub_Execute(FM_ChildConcatListNext, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_ChildConcatListNext, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildConcatListSource()
+ * ----------------------------------------------------
+ */
+bool FM_ChildConcatListSource(FM_ChildWorker_t *Worker, osal_id_t FileHandleTgt, const char *Source, uint32 SourceIndex,
+                              const char *Target, const char *CmdText)
+{
+    UT_GenStub_SetupReturnBuffer(FM_ChildConcatListSource, bool);
+
+    UT_GenStub_AddParam(FM_ChildConcatListSource, FM_ChildWorker_t *, Worker);
+    UT_GenStub_AddParam(FM_ChildConcatListSource, osal_id_t, FileHandleTgt);
+    UT_GenStub_AddParam(FM_ChildConcatListSource, const char *, Source);
+    UT_GenStub_AddParam(FM_ChildConcatListSource, uint32, SourceIndex);
+    UT_GenStub_AddParam(FM_ChildConcatListSource, const char *, Target);
+    UT_GenStub_AddParam(FM_ChildConcatListSource, const char *, CmdText);
+
+    UT_GenStub_Execute(FM_ChildConcatListSource, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_ChildConcatListSource, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildCopyCmd()
+ * ----------------------------------------------------
+ */
+void FM_ChildCopyCmd(FM_ChildWorker_t *Worker, const FM_ChildQueueEntry_t *CmdArgs)
+{
+    UT_GenStub_AddParam(FM_ChildCopyCmd, FM_ChildWorker_t *, Worker);
+    UT_GenStub_AddParam(FM_ChildCopyCmd, const FM_ChildQueueEntry_t *, CmdArgs);
+
+    UT_GenStub_Execute(FM_ChildCopyCmd, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildCopyFile()
+ * ----------------------------------------------------
+ */
+bool FM_ChildCopyFile(FM_ChildWorker_t *Worker, const char *Source, const char *Target, uint32 EventID,
+                      const char *CmdText)
+{
+    UT_GenStub_SetupReturnBuffer(FM_ChildCopyFile, bool);
+
+    UT_GenStub_AddParam(FM_ChildCopyFile, FM_ChildWorker_t *, Worker);
+    UT_GenStub_AddParam(FM_ChildCopyFile, const char *, Source);
+    UT_GenStub_AddParam(FM_ChildCopyFile, const char *, Target);
+    UT_GenStub_AddParam(FM_ChildCopyFile, uint32, EventID);
+    UT_GenStub_AddParam(FM_ChildCopyFile, const char *, CmdText);
+
+    UT_GenStub_Execute(FM_ChildCopyFile, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_ChildCopyFile, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildCopyStream()
+ * ----------------------------------------------------
+ */
+bool FM_ChildCopyStream(FM_ChildWorker_t *Worker, osal_id_t FileHandleSrc, osal_id_t FileHandleTgt,
+                        const char *Source, const char *Target, uint32 ReadEventID, uint32 WriteEventID,
+                        const char *CmdText)
+{
+    UT_GenStub_SetupReturnBuffer(FM_ChildCopyStream, bool);
+
+    UT_GenStub_AddParam(FM_ChildCopyStream, FM_ChildWorker_t *, Worker);
+    UT_GenStub_AddParam(FM_ChildCopyStream, osal_id_t, FileHandleSrc);
+    UT_GenStub_AddParam(FM_ChildCopyStream, osal_id_t, FileHandleTgt);
+    UT_GenStub_AddParam(FM_ChildCopyStream, const char *, Source);
+    UT_GenStub_AddParam(FM_ChildCopyStream, const char *, Target);
+    UT_GenStub_AddParam(FM_ChildCopyStream, uint32, ReadEventID);
+    UT_GenStub_AddParam(FM_ChildCopyStream, uint32, WriteEventID);
+    UT_GenStub_AddParam(FM_ChildCopyStream, const char *, CmdText);
+
+    UT_GenStub_Execute(FM_ChildCopyStream, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_ChildCopyStream, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildCopyWrite()
+ * ----------------------------------------------------
+ */
+void FM_ChildCopyWrite(FM_ChildWorker_t *Worker, uint8 Slot)
+{
+    UT_GenStub_AddParam(FM_ChildCopyWrite, FM_ChildWorker_t *, Worker);
+    UT_GenStub_AddParam(FM_ChildCopyWrite, uint8, Slot);
+
+    UT_GenStub_Execute(FM_ChildCopyWrite, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildCrcCacheBase()
+ * ----------------------------------------------------
+ */
+bool FM_ChildCrcCacheBase(const FM_ChildQueueEntry_t *CmdArgs, FM_CrcCacheEntry_t *Base)
+{
+    UT_GenStub_SetupReturnBuffer(FM_ChildCrcCacheBase, bool);
+
+    UT_GenStub_AddParam(FM_ChildCrcCacheBase, const FM_ChildQueueEntry_t *, CmdArgs);
+    UT_GenStub_AddParam(FM_ChildCrcCacheBase, FM_CrcCacheEntry_t *, Base);
+
+    UT_GenStub_Execute(FM_ChildCrcCacheBase, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_ChildCrcCacheBase, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildCrcCacheLookup()
+ * ----------------------------------------------------
+ */
+bool FM_ChildCrcCacheLookup(const FM_ChildQueueEntry_t *CmdArgs, uint32 *Crc)
+{
+    UT_GenStub_SetupReturnBuffer(FM_ChildCrcCacheLookup, bool);
+
+    UT_GenStub_AddParam(FM_ChildCrcCacheLookup, const FM_ChildQueueEntry_t *, CmdArgs);
+    UT_GenStub_AddParam(FM_ChildCrcCacheLookup, uint32 *, Crc);
+
+    UT_GenStub_Execute(FM_ChildCrcCacheLookup, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_ChildCrcCacheLookup, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildCrcCacheStore()
+ * ----------------------------------------------------
+ */
+void FM_ChildCrcCacheStore(FM_ChildWorker_t *Worker, const FM_ChildQueueEntry_t *CmdArgs, uint32 Crc, uint32 StartTime)
+{
+    UT_GenStub_AddParam(FM_ChildCrcCacheStore, FM_ChildWorker_t *, Worker);
+    UT_GenStub_AddParam(FM_ChildCrcCacheStore, const FM_ChildQueueEntry_t *, CmdArgs);
+    UT_GenStub_AddParam(FM_ChildCrcCacheStore, uint32, Crc);
+    UT_GenStub_AddParam(FM_ChildCrcCacheStore, uint32, StartTime);
+
+    UT_GenStub_Execute(FM_ChildCrcCacheStore, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildCrcCheckRead()
+ * ----------------------------------------------------
+ */
+bool FM_ChildCrcCheckRead(FM_ChildWorker_t *Worker, osal_id_t FileHandle, uint32 Offset, uint32 Length, uint32 *Crc)
+{
+    UT_GenStub_SetupReturnBuffer(FM_ChildCrcCheckRead, bool);
+
+    UT_GenStub_AddParam(FM_ChildCrcCheckRead, FM_ChildWorker_t *, Worker);
+    UT_GenStub_AddParam(FM_ChildCrcCheckRead, osal_id_t, FileHandle);
+    UT_GenStub_AddParam(FM_ChildCrcCheckRead, uint32, Offset);
+    UT_GenStub_AddParam(FM_ChildCrcCheckRead, uint32, Length);
+    UT_GenStub_AddParam(FM_ChildCrcCheckRead, uint32 *, Crc);
+
+    UT_GenStub_Execute(FM_ChildCrcCheckRead, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_ChildCrcCheckRead, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildCrcCheckWindows()
+ * ----------------------------------------------------
+ */
+bool FM_ChildCrcCheckWindows(FM_ChildWorker_t *Worker, const char *Filename, uint32 Size, uint32 Length,
+                             uint32 *HeadCrc, uint32 *TailCrc)
+{
+    UT_GenStub_SetupReturnBuffer(FM_ChildCrcCheckWindows, bool);
+
+    UT_GenStub_AddParam(FM_ChildCrcCheckWindows, FM_ChildWorker_t *, Worker);
+    UT_GenStub_AddParam(FM_ChildCrcCheckWindows, const char *, Filename);
+    UT_GenStub_AddParam(FM_ChildCrcCheckWindows, uint32, Size);
+    UT_GenStub_AddParam(FM_ChildCrcCheckWindows, uint32, Length);
+    UT_GenStub_AddParam(FM_ChildCrcCheckWindows, uint32 *, HeadCrc);
+    UT_GenStub_AddParam(FM_ChildCrcCheckWindows, uint32 *, TailCrc);
+
+    UT_GenStub_Execute(FM_ChildCrcCheckWindows, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_ChildCrcCheckWindows, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildCrcHelperLoop()
+ * ----------------------------------------------------
+ */
+void FM_ChildCrcHelperLoop(FM_CrcHelper_t *Helper, uint8 HelperIndex)
+{
+    UT_GenStub_AddParam(FM_ChildCrcHelperLoop, FM_CrcHelper_t *, Helper);
+    UT_GenStub_AddParam(FM_ChildCrcHelperLoop, uint8, HelperIndex);
+
+    UT_GenStub_Execute(FM_ChildCrcHelperLoop, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildCrcHelperTask()
+ * ----------------------------------------------------
+ */
+void FM_ChildCrcHelperTask(void)
+{
+    UT_GenStub_Execute(FM_ChildCrcHelperTask, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildCrcParallel()
+ * ----------------------------------------------------
+ */
+int32 FM_ChildCrcParallel(FM_ChildWorker_t *Worker, const FM_ChildQueueEntry_t *CmdArgs, uint32 *Crc)
+{
+    UT_GenStub_SetupReturnBuffer(FM_ChildCrcParallel, int32);
+
+    UT_GenStub_AddParam(FM_ChildCrcParallel, FM_ChildWorker_t *, Worker);
+    UT_GenStub_AddParam(FM_ChildCrcParallel, const FM_ChildQueueEntry_t *, CmdArgs);
+    UT_GenStub_AddParam(FM_ChildCrcParallel, uint32 *, Crc);
+
+    UT_GenStub_Execute(FM_ChildCrcParallel, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_ChildCrcParallel, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildCrcRange()
+ * ----------------------------------------------------
+ */
+int32 FM_ChildCrcRange(FM_ChildWorker_t *Worker, const char *Filename, uint32 Offset, uint32 Length, uint8 *Buffer,
+                       uint32 *Crc, uint32 *BytesDone)
+{
+    UT_GenStub_SetupReturnBuffer(FM_ChildCrcRange, int32);
+
+    UT_GenStub_AddParam(FM_ChildCrcRange, FM_ChildWorker_t *, Worker);
+    UT_GenStub_AddParam(FM_ChildCrcRange, const char *, Filename);
+    UT_GenStub_AddParam(FM_ChildCrcRange, uint32, Offset);
+    UT_GenStub_AddParam(FM_ChildCrcRange, uint32, Length);
+    UT_GenStub_AddParam(FM_ChildCrcRange, uint8 *, Buffer);
+    UT_GenStub_AddParam(FM_ChildCrcRange, uint32 *, Crc);
+    UT_GenStub_AddParam(FM_ChildCrcRange, uint32 *, BytesDone);
+
+    UT_GenStub_Execute(FM_ChildCrcRange, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_ChildCrcRange, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildCrcResume()
+ * ----------------------------------------------------
+ */
+int32 FM_ChildCrcResume(FM_ChildWorker_t *Worker, osal_id_t FileHandle, const FM_CrcCacheEntry_t *Base)
+{
+    UT_GenStub_SetupReturnBuffer(FM_ChildCrcResume, int32);
+
+    UT_GenStub_AddParam(FM_ChildCrcResume, FM_ChildWorker_t *, Worker);
+    UT_GenStub_AddParam(FM_ChildCrcResume, osal_id_t, FileHandle);
+    UT_GenStub_AddParam(FM_ChildCrcResume, const FM_CrcCacheEntry_t *, Base);
+
+    UT_GenStub_Execute(FM_ChildCrcResume, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_ChildCrcResume, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildCreateDirectoryCmd()
+ * ----------------------------------------------------
+ */
+void FM_ChildCreateDirectoryCmd(FM_ChildWorker_t *Worker, const FM_ChildQueueEntry_t *CmdArgs)
+{
+    UT_GenStub_AddParam(FM_ChildCreateDirectoryCmd, FM_ChildWorker_t *, Worker);
+    UT_GenStub_AddParam(FM_ChildCreateDirectoryCmd, const FM_ChildQueueEntry_t *, CmdArgs);
+
+    UT_GenStub_Execute(FM_ChildCreateDirectoryCmd, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildDecompressFileCmd()
+ * ----------------------------------------------------
+ */
+void FM_ChildDecompressFileCmd(FM_ChildWorker_t *Worker, const FM_ChildQueueEntry_t *CmdArgs)
+{
+    UT_GenStub_AddParam(FM_ChildDecompressFileCmd, FM_ChildWorker_t *, Worker);
+    UT_GenStub_AddParam(FM_ChildDecompressFileCmd, const FM_ChildQueueEntry_t *, CmdArgs);
+
+    UT_GenStub_Execute(FM_ChildDecompressFileCmd, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildDeleteAllCollect()
+ * ----------------------------------------------------
+ */
+bool FM_ChildDeleteAllCollect(FM_ChildWorker_t *Worker, osal_id_t DirId, const char *DirWithSep, const char *CmdText,
+                              bool Descend, uint32 *NotDeletedCount, uint32 *SkippedCount)
+{
+    UT_GenStub_SetupReturnBuffer(FM_ChildDeleteAllCollect, bool);
+
+    UT_GenStub_AddParam(FM_ChildDeleteAllCollect, FM_ChildWorker_t *, Worker);
+    UT_GenStub_AddParam(FM_ChildDeleteAllCollect, osal_id_t, DirId);
+    UT_GenStub_AddParam(FM_ChildDeleteAllCollect, const char *, DirWithSep);
+    UT_GenStub_AddParam(FM_ChildDeleteAllCollect, const char *, CmdText);
+    UT_GenStub_AddParam(FM_ChildDeleteAllCollect, bool, Descend);
+    UT_GenStub_AddParam(FM_ChildDeleteAllCollect, uint32 *, NotDeletedCount);
+    UT_GenStub_AddParam(FM_ChildDeleteAllCollect, uint32 *, SkippedCount);
+
+    UT_GenStub_Execute(FM_ChildDeleteAllCollect, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_ChildDeleteAllCollect, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildDeleteAllFilesCmd()
+ * ----------------------------------------------------
+ */
+void FM_ChildDeleteAllFilesCmd(FM_ChildWorker_t *Worker, FM_ChildQueueEntry_t *CmdArgs)
+{
+    UT_GenStub_AddParam(FM_ChildDeleteAllFilesCmd, FM_ChildWorker_t *, Worker);
+    UT_GenStub_AddParam(FM_ChildDeleteAllFilesCmd, FM_ChildQueueEntry_t *, CmdArgs);
+
+    UT_GenStub_Execute(FM_ChildDeleteAllFilesCmd, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildDeleteAllRemove()
+ * ----------------------------------------------------
+ */
+uint32 FM_ChildDeleteAllRemove(FM_ChildWorker_t *Worker, const char *Directory, const char *DirWithSep,
+                               const char *CmdText, uint32 *NotDeletedCount)
+{
+    UT_GenStub_SetupReturnBuffer(FM_ChildDeleteAllRemove, uint32);
+
+    UT_GenStub_AddParam(FM_ChildDeleteAllRemove, FM_ChildWorker_t *, Worker);
+    UT_GenStub_AddParam(FM_ChildDeleteAllRemove, const char *, Directory);
+    UT_GenStub_AddParam(FM_ChildDeleteAllRemove, const char *, DirWithSep);
+    UT_GenStub_AddParam(FM_ChildDeleteAllRemove, const char *, CmdText);
+    UT_GenStub_AddParam(FM_ChildDeleteAllRemove, uint32 *, NotDeletedCount);
+
+    UT_GenStub_Execute(FM_ChildDeleteAllRemove, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_ChildDeleteAllRemove, uint32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildDeleteCmd()
+ * ----------------------------------------------------
+ */
+void FM_ChildDeleteCmd(FM_ChildWorker_t *Worker, const FM_ChildQueueEntry_t *CmdArgs)
+{
+    UT_GenStub_AddParam(FM_ChildDeleteCmd, FM_ChildWorker_t *, Worker);
+    UT_GenStub_AddParam(FM_ChildDeleteCmd, const FM_ChildQueueEntry_t *, CmdArgs);
+
+    UT_GenStub_Execute(FM_ChildDeleteCmd, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildDeleteDirectoryCmd()
+ * ----------------------------------------------------
+ */
+void FM_ChildDeleteDirectoryCmd(FM_ChildWorker_t *Worker, const FM_ChildQueueEntry_t *CmdArgs)
+{
+    UT_GenStub_AddParam(FM_ChildDeleteDirectoryCmd, FM_ChildWorker_t *, Worker);
+    UT_GenStub_AddParam(FM_ChildDeleteDirectoryCmd, const FM_ChildQueueEntry_t *, CmdArgs);
+
+    UT_GenStub_Execute(FM_ChildDeleteDirectoryCmd, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildDeleteTreeCmd()
+ * ----------------------------------------------------
+ */
+void FM_ChildDeleteTreeCmd(FM_ChildWorker_t *Worker, const FM_ChildQueueEntry_t *CmdArgs)
+{
+    UT_GenStub_AddParam(FM_ChildDeleteTreeCmd, FM_ChildWorker_t *, Worker);
+    UT_GenStub_AddParam(FM_ChildDeleteTreeCmd, const FM_ChildQueueEntry_t *, CmdArgs);
+
+    UT_GenStub_Execute(FM_ChildDeleteTreeCmd, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildDeleteTreePush()
+ * ----------------------------------------------------
+ */
+bool FM_ChildDeleteTreePush(FM_ChildWorker_t *Worker, const char *Directory)
+{
+    UT_GenStub_SetupReturnBuffer(FM_ChildDeleteTreePush, bool);
+
+    UT_GenStub_AddParam(FM_ChildDeleteTreePush, FM_ChildWorker_t *, Worker);
+    UT_GenStub_AddParam(FM_ChildDeleteTreePush, const char *, Directory);
+
+    UT_GenStub_Execute(FM_ChildDeleteTreePush, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_ChildDeleteTreePush, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildDeleteTreeScan()
+ * ----------------------------------------------------
+ */
+uint32 FM_ChildDeleteTreeScan(FM_ChildWorker_t *Worker, const char *Directory, const char *CmdText,
+                              uint32 *NotDeletedCount, uint32 *SkippedCount)
+{
+    UT_GenStub_SetupReturnBuffer(FM_ChildDeleteTreeScan, uint32);
+
+    UT_GenStub_AddParam(FM_ChildDeleteTreeScan, FM_ChildWorker_t *, Worker);
+    UT_GenStub_AddParam(FM_ChildDeleteTreeScan, const char *, Directory);
+    UT_GenStub_AddParam(FM_ChildDeleteTreeScan, const char *, CmdText);
+    UT_GenStub_AddParam(FM_ChildDeleteTreeScan, uint32 *, NotDeletedCount);
+    UT_GenStub_AddParam(FM_ChildDeleteTreeScan, uint32 *, SkippedCount);
+
+    UT_GenStub_Execute(FM_ChildDeleteTreeScan, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_ChildDeleteTreeScan, uint32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildDirListFileCmd()
+ * ----------------------------------------------------
+ */
+void FM_ChildDirListFileCmd(FM_ChildWorker_t *Worker, const FM_ChildQueueEntry_t *CmdArgs)
+{
+    UT_GenStub_AddParam(FM_ChildDirListFileCmd, FM_ChildWorker_t *, Worker);
+    UT_GenStub_AddParam(FM_ChildDirListFileCmd, const FM_ChildQueueEntry_t *, CmdArgs);
+
+    UT_GenStub_Execute(FM_ChildDirListFileCmd, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildDirListFileInit()
+ * ----------------------------------------------------
+ */
+bool FM_ChildDirListFileInit(FM_ChildWorker_t *Worker, osal_id_t *FileHandlePtr, const char *Directory,
+                             const char *Filename)
+{
+    UT_GenStub_SetupReturnBuffer(FM_ChildDirListFileInit, bool);
+
+    UT_GenStub_AddParam(FM_ChildDirListFileInit, FM_ChildWorker_t *, Worker);
+    UT_GenStub_AddParam(FM_ChildDirListFileInit, osal_id_t *, FileHandlePtr);
+    UT_GenStub_AddParam(FM_ChildDirListFileInit, const char *, Directory);
+    UT_GenStub_AddParam(FM_ChildDirListFileInit, const char *, Filename);
+
+    UT_GenStub_Execute(FM_ChildDirListFileInit, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_ChildDirListFileInit, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildDirListFileLoop()
+ * ----------------------------------------------------
+ */
+void FM_ChildDirListFileLoop(FM_ChildWorker_t *Worker, osal_id_t DirId, osal_id_t FileHandle, const char *Directory,
+                             const char *DirWithSep, const char *Filename, uint8 GetSizeTimeMode)
+{
+    UT_GenStub_AddParam(FM_ChildDirListFileLoop, FM_ChildWorker_t *, Worker);
+    UT_GenStub_AddParam(FM_ChildDirListFileLoop, osal_id_t, DirId);
+    UT_GenStub_AddParam(FM_ChildDirListFileLoop, osal_id_t, FileHandle);
+    UT_GenStub_AddParam(FM_ChildDirListFileLoop, const char *, Directory);
+    UT_GenStub_AddParam(FM_ChildDirListFileLoop, const char *, DirWithSep);
+    UT_GenStub_AddParam(FM_ChildDirListFileLoop, const char *, Filename);
+    UT_GenStub_AddParam(FM_ChildDirListFileLoop, uint8, GetSizeTimeMode);
+
+    UT_GenStub_Execute(FM_ChildDirListFileLoop, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildDirListPktCmd()
+ * ----------------------------------------------------
+ */
+void FM_ChildDirListPktCmd(FM_ChildWorker_t *Worker, const FM_ChildQueueEntry_t *CmdArgs)
+{
+    UT_GenStub_AddParam(FM_ChildDirListPktCmd, FM_ChildWorker_t *, Worker);
+    UT_GenStub_AddParam(FM_ChildDirListPktCmd, const FM_ChildQueueEntry_t *, CmdArgs);
+
+    UT_GenStub_Execute(FM_ChildDirListPktCmd, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildDirectoryNext()
+ * ----------------------------------------------------
+ */
+bool FM_ChildDirectoryNext(FM_ChildWorker_t *Worker, osal_id_t DirId, os_dirent_t *DirEntry)
+{
+    UT_GenStub_SetupReturnBuffer(FM_ChildDirectoryNext, bool);
+
+    UT_GenStub_AddParam(FM_ChildDirectoryNext, FM_ChildWorker_t *, Worker);
+    UT_GenStub_AddParam(FM_ChildDirectoryNext, osal_id_t, DirId);
+    UT_GenStub_AddParam(FM_ChildDirectoryNext, os_dirent_t *, DirEntry);
+
+    UT_GenStub_Execute(FM_ChildDirectoryNext, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_ChildDirectoryNext, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildDirectoryRestart()
+ * ----------------------------------------------------
+ */
+void FM_ChildDirectoryRestart(FM_ChildWorker_t *Worker, osal_id_t DirId, uint32 RemovedCount)
+{
+    UT_GenStub_AddParam(FM_ChildDirectoryRestart, FM_ChildWorker_t *, Worker);
+    UT_GenStub_AddParam(FM_ChildDirectoryRestart, osal_id_t, DirId);
+    UT_GenStub_AddParam(FM_ChildDirectoryRestart, uint32, RemovedCount);
+
+    UT_GenStub_Execute(FM_ChildDirectoryRestart, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildExecute()
+ * ----------------------------------------------------
+ */
+void FM_ChildExecute(FM_ChildWorker_t *Worker)
+{
+    UT_GenStub_AddParam(FM_ChildExecute, FM_ChildWorker_t *, Worker);
+
+    UT_GenStub_Execute(FM_ChildExecute, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildFileDigestCmd()
+ * ----------------------------------------------------
+ */
+void FM_ChildFileDigestCmd(FM_ChildWorker_t *Worker, const FM_ChildQueueEntry_t *CmdArgs)
+{
+    UT_GenStub_AddParam(FM_ChildFileDigestCmd, FM_ChildWorker_t *, Worker);
+    UT_GenStub_AddParam(FM_ChildFileDigestCmd, const FM_ChildQueueEntry_t *, CmdArgs);
+
+    UT_GenStub_Execute(FM_ChildFileDigestCmd, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildFileInfoCmd()
+ * ----------------------------------------------------
+ */
+void FM_ChildFileInfoCmd(FM_ChildWorker_t *Worker, FM_ChildQueueEntry_t *CmdArgs)
+{
+    UT_GenStub_AddParam(FM_ChildFileInfoCmd, FM_ChildWorker_t *, Worker);
+    UT_GenStub_AddParam(FM_ChildFileInfoCmd, FM_ChildQueueEntry_t *, CmdArgs);
+
+    UT_GenStub_Execute(FM_ChildFileInfoCmd, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildFilterApply()
+ * ----------------------------------------------------
+ */
+uint32 FM_ChildFilterApply(FM_ChildWorker_t *Worker, const FM_ChildQueueEntry_t *CmdArgs, const char *DirWithSep,
+                           const char *TgtWithSep, const char *CmdText, uint32 *NotDoneCount)
+{
+    UT_GenStub_SetupReturnBuffer(FM_ChildFilterApply, uint32);
+
+    UT_GenStub_AddParam(FM_ChildFilterApply, FM_ChildWorker_t *, Worker);
+    UT_GenStub_AddParam(FM_ChildFilterApply, const FM_ChildQueueEntry_t *, CmdArgs);
+    UT_GenStub_AddParam(FM_ChildFilterApply, const char *, DirWithSep);
+    UT_GenStub_AddParam(FM_ChildFilterApply, const char *, TgtWithSep);
+    UT_GenStub_AddParam(FM_ChildFilterApply, const char *, CmdText);
+    UT_GenStub_AddParam(FM_ChildFilterApply, uint32 *, NotDoneCount);
+
+    UT_GenStub_Execute(FM_ChildFilterApply, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_ChildFilterApply, uint32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildFilterCollect()
+ * ----------------------------------------------------
+ */
+bool FM_ChildFilterCollect(FM_ChildWorker_t *Worker, osal_id_t DirId, const char *DirWithSep,
+                           const FM_ChildQueueEntry_t *CmdArgs, uint32 Now, const char *CmdText, uint32 *NotDoneCount)
+{
+    UT_GenStub_SetupReturnBuffer(FM_ChildFilterCollect, bool);
+
+    UT_GenStub_AddParam(FM_ChildFilterCollect, FM_ChildWorker_t *, Worker);
+    UT_GenStub_AddParam(FM_ChildFilterCollect, osal_id_t, DirId);
+    UT_GenStub_AddParam(FM_ChildFilterCollect, const char *, DirWithSep);
+    UT_GenStub_AddParam(FM_ChildFilterCollect, const FM_ChildQueueEntry_t *, CmdArgs);
+    UT_GenStub_AddParam(FM_ChildFilterCollect, uint32, Now);
+    UT_GenStub_AddParam(FM_ChildFilterCollect, const char *, CmdText);
+    UT_GenStub_AddParam(FM_ChildFilterCollect, uint32 *, NotDoneCount);
+
+    UT_GenStub_Execute(FM_ChildFilterCollect, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_ChildFilterCollect, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildFilterFilesCmd()
+ * ----------------------------------------------------
+ */
+void FM_ChildFilterFilesCmd(FM_ChildWorker_t *Worker, const FM_ChildQueueEntry_t *CmdArgs)
 {
-    UT_GenStub_AddParam(FM_ChildConcatFilesCmd, const FM_ChildQueueEntry_t *, CmdArgs);
+    UT_GenStub_AddParam(FM_ChildFilterFilesCmd, FM_ChildWorker_t *, Worker);
+    UT_GenStub_AddParam(FM_ChildFilterFilesCmd, const FM_ChildQueueEntry_t *, CmdArgs);
 
-    UT_GenStub_Execute(FM_ChildConcatFilesCmd, Basic, NULL);
+    UT_GenStub_Execute(FM_ChildFilterFilesCmd, Basic, NULL);
 }
 
 /*
  * ----------------------------------------------------
- * Generated stub function for FM_ChildCopyCmd()
+ * Generated stub function for FM_ChildFilterPass()
  * ----------------------------------------------------
  */
-void FM_ChildCopyCmd(const FM_ChildQueueEntry_t *CmdArgs)
+bool FM_ChildFilterPass(const FM_FileFilter_t *Filter, uint32 FileSize, uint32 FileTime, uint32 Now)
 {
-    UT_GenStub_AddParam(FM_ChildCopyCmd, const FM_ChildQueueEntry_t *, CmdArgs);
+    UT_GenStub_SetupReturnBuffer(FM_ChildFilterPass, bool);
 
-    UT_GenStub_Execute(FM_ChildCopyCmd, Basic, NULL);
+    UT_GenStub_AddParam(FM_ChildFilterPass, const FM_FileFilter_t *, Filter);
+    UT_GenStub_AddParam(FM_ChildFilterPass, uint32, FileSize);
+    UT_GenStub_AddParam(FM_ChildFilterPass, uint32, FileTime);
+    UT_GenStub_AddParam(FM_ChildFilterPass, uint32, Now);
+
+    UT_GenStub_Execute(FM_ChildFilterPass, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_ChildFilterPass, bool);
 }
 
 /*
  * ----------------------------------------------------
- * Generated stub function for FM_ChildCreateDirectoryCmd()
+ * Generated stub function for FM_ChildFilterTransfer()
  * ----------------------------------------------------
  */
-void FM_ChildCreateDirectoryCmd(const FM_ChildQueueEntry_t *CmdArgs)
+bool FM_ChildFilterTransfer(FM_ChildWorker_t *Worker, const FM_ChildQueueEntry_t *CmdArgs, const char *Source,
+                            const char *Target, const char *CmdText)
 {
-    UT_GenStub_AddParam(FM_ChildCreateDirectoryCmd, const FM_ChildQueueEntry_t *, CmdArgs);
+    UT_GenStub_SetupReturnBuffer(FM_ChildFilterTransfer, bool);
 
-    UT_GenStub_Execute(FM_ChildCreateDirectoryCmd, Basic, NULL);
+    UT_GenStub_AddParam(FM_ChildFilterTransfer, FM_ChildWorker_t *, Worker);
+    UT_GenStub_AddParam(FM_ChildFilterTransfer, const FM_ChildQueueEntry_t *, CmdArgs);
+    UT_GenStub_AddParam(FM_ChildFilterTransfer, const char *, Source);
+    UT_GenStub_AddParam(FM_ChildFilterTransfer, const char *, Target);
+    UT_GenStub_AddParam(FM_ChildFilterTransfer, const char *, CmdText);
+
+    UT_GenStub_Execute(FM_ChildFilterTransfer, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_ChildFilterTransfer, bool);
 }
 
 /*
  * ----------------------------------------------------
- * Generated stub function for FM_ChildDecompressFileCmd()
+ * Generated stub function for FM_ChildInit()
  * ----------------------------------------------------
  */
-void FM_ChildDecompressFileCmd(const FM_ChildQueueEntry_t *CmdArgs)
+CFE_Status_t FM_ChildInit(void)
 {
-    UT_GenStub_AddParam(FM_ChildDecompressFileCmd, const FM_ChildQueueEntry_t *, CmdArgs);
+    UT_GenStub_SetupReturnBuffer(FM_ChildInit, CFE_Status_t);
 
-    UT_GenStub_Execute(FM_ChildDecompressFileCmd, Basic, NULL);
+    UT_GenStub_Execute(FM_ChildInit, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_ChildInit, CFE_Status_t);
 }
 
 /*
  * ----------------------------------------------------
- * Generated stub function for FM_ChildDeleteAllFilesCmd()
+ * Generated stub function for FM_ChildKernelCopy()
  * ----------------------------------------------------
  */
-void FM_ChildDeleteAllFilesCmd(FM_ChildQueueEntry_t *CmdArgs)
+int32 FM_ChildKernelCopy(FM_ChildWorker_t *Worker, const char *Source, const char *Target, bool Append,
+                         uint32 EventID, const char *CmdText)
 {
-    UT_GenStub_AddParam(FM_ChildDeleteAllFilesCmd, FM_ChildQueueEntry_t *, CmdArgs);
+    UT_GenStub_SetupReturnBuffer(FM_ChildKernelCopy, int32);
 
-    UT_GenStub_Execute(FM_ChildDeleteAllFilesCmd, Basic, NULL);
+    UT_GenStub_AddParam(FM_ChildKernelCopy, FM_ChildWorker_t *, Worker);
+    UT_GenStub_AddParam(FM_ChildKernelCopy, const char *, Source);
+    UT_GenStub_AddParam(FM_ChildKernelCopy, const char *, Target);
+    UT_GenStub_AddParam(FM_ChildKernelCopy, bool, Append);
+    UT_GenStub_AddParam(FM_ChildKernelCopy, uint32, EventID);
+    UT_GenStub_AddParam(FM_ChildKernelCopy, const char *, CmdText);
+
+    UT_GenStub_Execute(FM_ChildKernelCopy, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_ChildKernelCopy, int32);
 }
 
 /*
  * ----------------------------------------------------
- * Generated stub function for FM_ChildDeleteCmd()
+ * Generated stub function for FM_ChildLoadPath()
  * ----------------------------------------------------
  */
-void FM_ChildDeleteCmd(const FM_ChildQueueEntry_t *CmdArgs)
+void FM_ChildLoadPath(uint16 PathRef, char *Path, uint32 BufferSize)
 {
-    UT_GenStub_AddParam(FM_ChildDeleteCmd, const FM_ChildQueueEntry_t *, CmdArgs);
+    UT_GenStub_AddParam(FM_ChildLoadPath, uint16, PathRef);
+    UT_GenStub_AddParam(FM_ChildLoadPath, char *, Path);
+    UT_GenStub_AddParam(FM_ChildLoadPath, uint32, BufferSize);
 
-    UT_GenStub_Execute(FM_ChildDeleteCmd, Basic, NULL);
+    UT_GenStub_Execute(FM_ChildLoadPath, Basic, NULL);
 }
 
 /*
  * ----------------------------------------------------
- * Generated stub function for FM_ChildDeleteDirectoryCmd()
+ * Generated stub function for FM_ChildLoop()
  * ----------------------------------------------------
  */
-void FM_ChildDeleteDirectoryCmd(const FM_ChildQueueEntry_t *CmdArgs)
+void FM_ChildLoop(FM_ChildWorker_t *Worker)
 {
-    UT_GenStub_AddParam(FM_ChildDeleteDirectoryCmd, const FM_ChildQueueEntry_t *, CmdArgs);
+    UT_GenStub_AddParam(FM_ChildLoop, FM_ChildWorker_t *, Worker);
 
-    UT_GenStub_Execute(FM_ChildDeleteDirectoryCmd, Basic, NULL);
+    UT_GenStub_Execute(FM_ChildLoop, Basic, NULL);
 }
 
 /*
  * ----------------------------------------------------
- * Generated stub function for FM_ChildDirListFileCmd()
+ * Generated stub function for FM_ChildMoveCmd()
  * ----------------------------------------------------
  */
-void FM_ChildDirListFileCmd(const FM_ChildQueueEntry_t *CmdArgs)
+void FM_ChildMoveCmd(FM_ChildWorker_t *Worker, const FM_ChildQueueEntry_t *CmdArgs)
 {
-    UT_GenStub_AddParam(FM_ChildDirListFileCmd, const FM_ChildQueueEntry_t *, CmdArgs);
+    UT_GenStub_AddParam(FM_ChildMoveCmd, FM_ChildWorker_t *, Worker);
+    UT_GenStub_AddParam(FM_ChildMoveCmd, const FM_ChildQueueEntry_t *, CmdArgs);
 
-    UT_GenStub_Execute(FM_ChildDirListFileCmd, Basic, NULL);
+    UT_GenStub_Execute(FM_ChildMoveCmd, Basic, NULL);
 }
 
 /*
  * ----------------------------------------------------
- * Generated stub function for FM_ChildDirListFileInit()
+ * Generated stub function for FM_ChildPathsBusy()
  * ----------------------------------------------------
  */
-bool FM_ChildDirListFileInit(osal_id_t *FileHandlePtr, const char *Directory, const char *Filename)
+bool FM_ChildPathsBusy(const FM_ChildWorker_t *Worker)
 {
-    UT_GenStub_SetupReturnBuffer(FM_ChildDirListFileInit, bool);
+    UT_GenStub_SetupReturnBuffer(FM_ChildPathsBusy, bool);
 
-    UT_GenStub_AddParam(FM_ChildDirListFileInit, osal_id_t *, FileHandlePtr);
-    UT_GenStub_AddParam(FM_ChildDirListFileInit, const char *, Directory);
-    UT_GenStub_AddParam(FM_ChildDirListFileInit, const char *, Filename);
+    UT_GenStub_AddParam(FM_ChildPathsBusy, const FM_ChildWorker_t *, Worker);
 
-    UT_GenStub_Execute(FM_ChildDirListFileInit, Basic, NULL);
+    UT_GenStub_Execute(FM_ChildPathsBusy, Basic, NULL);
 
-    return UT_GenStub_GetReturnValue(FM_ChildDirListFileInit, bool);
+    return UT_GenStub_GetReturnValue(FM_ChildPathsBusy, bool);
 }
 
 /*
  * ----------------------------------------------------
- * Generated stub function for FM_ChildDirListFileLoop()
+ * Generated stub function for FM_ChildProcess()
  * ----------------------------------------------------
  */
-void FM_ChildDirListFileLoop(osal_id_t DirId, osal_id_t FileHandle, const char *Directory, const char *DirWithSep,
-                             const char *Filename, uint8 GetSizeTimeMode)
+void FM_ChildProcess(FM_ChildWorker_t *Worker)
 {
-    UT_GenStub_AddParam(FM_ChildDirListFileLoop, osal_id_t, DirId);
-    UT_GenStub_AddParam(FM_ChildDirListFileLoop, osal_id_t, FileHandle);
-    UT_GenStub_AddParam(FM_ChildDirListFileLoop, const char *, Directory);
-    UT_GenStub_AddParam(FM_ChildDirListFileLoop, const char *, DirWithSep);
-    UT_GenStub_AddParam(FM_ChildDirListFileLoop, const char *, Filename);
-    UT_GenStub_AddParam(FM_ChildDirListFileLoop, uint8, GetSizeTimeMode);
+    UT_GenStub_AddParam(FM_ChildProcess, FM_ChildWorker_t *, Worker);
 
-    UT_GenStub_Execute(FM_ChildDirListFileLoop, Basic, NULL);
+    UT_GenStub_Execute(FM_ChildProcess, Basic, NULL);
 }
 
 /*
  * ----------------------------------------------------
- * Generated stub function for FM_ChildDirListPktCmd()
+ * Generated stub function for FM_ChildProgressBegin()
  * ----------------------------------------------------
  */
-void FM_ChildDirListPktCmd(const FM_ChildQueueEntry_t *CmdArgs)
+void FM_ChildProgressBegin(FM_ChildWorker_t *Worker)
 {
-    UT_GenStub_AddParam(FM_ChildDirListPktCmd, const FM_ChildQueueEntry_t *, CmdArgs);
+    UT_GenStub_AddParam(FM_ChildProgressBegin, FM_ChildWorker_t *, Worker);
 
-    UT_GenStub_Execute(FM_ChildDirListPktCmd, Basic, NULL);
+    UT_GenStub_Execute(FM_ChildProgressBegin, Basic, NULL);
 }
 
 /*
  * ----------------------------------------------------
- * Generated stub function for FM_ChildFileInfoCmd()
+ * Generated stub function for FM_ChildProgressSource()
  * ----------------------------------------------------
  */
-void FM_ChildFileInfoCmd(FM_ChildQueueEntry_t *CmdArgs)
+void FM_ChildProgressSource(FM_ChildWorker_t *Worker, const char *Source, const char *Target, uint32 Bytes)
 {
-    UT_GenStub_AddParam(FM_ChildFileInfoCmd, FM_ChildQueueEntry_t *, CmdArgs);
+    UT_GenStub_AddParam(FM_ChildProgressSource, FM_ChildWorker_t *, Worker);
+    UT_GenStub_AddParam(FM_ChildProgressSource, const char *, Source);
+    UT_GenStub_AddParam(FM_ChildProgressSource, const char *, Target);
+    UT_GenStub_AddParam(FM_ChildProgressSource, uint32, Bytes);
 
-    UT_GenStub_Execute(FM_ChildFileInfoCmd, Basic, NULL);
+    UT_GenStub_Execute(FM_ChildProgressSource, Basic, NULL);
 }
 
 /*
  * ----------------------------------------------------
- * Generated stub function for FM_ChildInit()
+ * Generated stub function for FM_ChildPurgeCmd()
  * ----------------------------------------------------
  */
-CFE_Status_t FM_ChildInit(void)
+void FM_ChildPurgeCmd(FM_ChildWorker_t *Worker, const FM_ChildQueueEntry_t *CmdArgs)
 {
-    UT_GenStub_SetupReturnBuffer(FM_ChildInit, CFE_Status_t);
-
-    UT_GenStub_Execute(FM_ChildInit, Basic, NULL);
+    UT_GenStub_AddParam(FM_ChildPurgeCmd, FM_ChildWorker_t *, Worker);
+    UT_GenStub_AddParam(FM_ChildPurgeCmd, const FM_ChildQueueEntry_t *, CmdArgs);
 
-    return UT_GenStub_GetReturnValue(FM_ChildInit, CFE_Status_t);
+    UT_GenStub_Execute(FM_ChildPurgeCmd, Basic, NULL);
 }
 
 /*
  * ----------------------------------------------------
- * Generated stub function for FM_ChildLoop()
+ * Generated stub function for FM_ChildPurgeCollect()
  * ----------------------------------------------------
  */
-void FM_ChildLoop(void)
+bool FM_ChildPurgeCollect(FM_ChildWorker_t *Worker, osal_id_t DirId, const char *CmdText, uint32 MaxCount)
 {
+    UT_GenStub_SetupReturnBuffer(FM_ChildPurgeCollect, bool);
 
-    UT_GenStub_Execute(FM_ChildLoop, Basic, NULL);
+    UT_GenStub_AddParam(FM_ChildPurgeCollect, FM_ChildWorker_t *, Worker);
+    UT_GenStub_AddParam(FM_ChildPurgeCollect, osal_id_t, DirId);
+    UT_GenStub_AddParam(FM_ChildPurgeCollect, const char *, CmdText);
+    UT_GenStub_AddParam(FM_ChildPurgeCollect, uint32, MaxCount);
+
+    UT_GenStub_Execute(FM_ChildPurgeCollect, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_ChildPurgeCollect, bool);
 }
 
 /*
  * ----------------------------------------------------
- * Generated stub function for FM_ChildMoveCmd()
+ * Generated stub function for FM_ChildPurgeVolume()
  * ----------------------------------------------------
  */
-void FM_ChildMoveCmd(const FM_ChildQueueEntry_t *CmdArgs)
+bool FM_ChildPurgeVolume(FM_ChildWorker_t *Worker, osal_id_t DirId, const char *TrashDir, uint32 Budget,
+                         uint32 *PurgeCount, uint32 *NotPurgedCount)
 {
-    UT_GenStub_AddParam(FM_ChildMoveCmd, const FM_ChildQueueEntry_t *, CmdArgs);
+    UT_GenStub_SetupReturnBuffer(FM_ChildPurgeVolume, bool);
 
-    UT_GenStub_Execute(FM_ChildMoveCmd, Basic, NULL);
+    UT_GenStub_AddParam(FM_ChildPurgeVolume, FM_ChildWorker_t *, Worker);
+    UT_GenStub_AddParam(FM_ChildPurgeVolume, osal_id_t, DirId);
+    UT_GenStub_AddParam(FM_ChildPurgeVolume, const char *, TrashDir);
+    UT_GenStub_AddParam(FM_ChildPurgeVolume, uint32, Budget);
+    UT_GenStub_AddParam(FM_ChildPurgeVolume, uint32 *, PurgeCount);
+    UT_GenStub_AddParam(FM_ChildPurgeVolume, uint32 *, NotPurgedCount);
+
+    UT_GenStub_Execute(FM_ChildPurgeVolume, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_ChildPurgeVolume, bool);
 }
 
 /*
  * ----------------------------------------------------
- * Generated stub function for FM_ChildProcess()
+ * Generated stub function for FM_ChildReleasePaths()
  * ----------------------------------------------------
  */
-void FM_ChildProcess(void)
+void FM_ChildReleasePaths(FM_ChildWorker_t *Worker)
 {
+    UT_GenStub_AddParam(FM_ChildReleasePaths, FM_ChildWorker_t *, Worker);
 
-    UT_GenStub_Execute(FM_ChildProcess, Basic, NULL);
+    UT_GenStub_Execute(FM_ChildReleasePaths, Basic, NULL);
 }
 
 /*
@@ -235,20 +1086,165 @@ void FM_ChildProcess(void)
  * Generated stub function for FM_ChildRenameCmd()
  * ----------------------------------------------------
  */
-void FM_ChildRenameCmd(const FM_ChildQueueEntry_t *CmdArgs)
+void FM_ChildRenameCmd(FM_ChildWorker_t *Worker, const FM_ChildQueueEntry_t *CmdArgs)
 {
+    UT_GenStub_AddParam(FM_ChildRenameCmd, FM_ChildWorker_t *, Worker);
     UT_GenStub_AddParam(FM_ChildRenameCmd, const FM_ChildQueueEntry_t *, CmdArgs);
 
     UT_GenStub_Execute(FM_ChildRenameCmd, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildRetentionAbove()
+ * ----------------------------------------------------
+ */
+bool FM_ChildRetentionAbove(const FM_RetentionFile_t *Upper, const FM_RetentionFile_t *Lower, bool EvictFirst)
+{
+    UT_GenStub_SetupReturnBuffer(FM_ChildRetentionAbove, bool);
+
+    UT_GenStub_AddParam(FM_ChildRetentionAbove, const FM_RetentionFile_t *, Upper);
+    UT_GenStub_AddParam(FM_ChildRetentionAbove, const FM_RetentionFile_t *, Lower);
+    UT_GenStub_AddParam(FM_ChildRetentionAbove, bool, EvictFirst);
+
+    UT_GenStub_Execute(FM_ChildRetentionAbove, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_ChildRetentionAbove, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildRetentionCmd()
+ * ----------------------------------------------------
+ */
+void FM_ChildRetentionCmd(FM_ChildWorker_t *Worker, const FM_ChildQueueEntry_t *CmdArgs)
+{
+    UT_GenStub_AddParam(FM_ChildRetentionCmd, FM_ChildWorker_t *, Worker);
+    UT_GenStub_AddParam(FM_ChildRetentionCmd, const FM_ChildQueueEntry_t *, CmdArgs);
+
+    UT_GenStub_Execute(FM_ChildRetentionCmd, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildRetentionEvict()
+ * ----------------------------------------------------
+ */
+uint32 FM_ChildRetentionEvict(FM_ChildWorker_t *Worker, FM_RetentionState_t *State, const char *DirWithSep,
+                              const char *CmdText, uint64 *BytesRemoved)
+{
+    UT_GenStub_SetupReturnBuffer(FM_ChildRetentionEvict, uint32);
+
+    UT_GenStub_AddParam(FM_ChildRetentionEvict, FM_ChildWorker_t *, Worker);
+    UT_GenStub_AddParam(FM_ChildRetentionEvict, FM_RetentionState_t *, State);
+    UT_GenStub_AddParam(FM_ChildRetentionEvict, const char *, DirWithSep);
+    UT_GenStub_AddParam(FM_ChildRetentionEvict, const char *, CmdText);
+    UT_GenStub_AddParam(FM_ChildRetentionEvict, uint64 *, BytesRemoved);
+
+    UT_GenStub_Execute(FM_ChildRetentionEvict, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_ChildRetentionEvict, uint32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildRetentionOffer()
+ * ----------------------------------------------------
+ */
+void FM_ChildRetentionOffer(FM_RetentionState_t *State, const FM_RetentionFile_t *File)
+{
+    UT_GenStub_AddParam(FM_ChildRetentionOffer, FM_RetentionState_t *, State);
+    UT_GenStub_AddParam(FM_ChildRetentionOffer, const FM_RetentionFile_t *, File);
+
+    UT_GenStub_Execute(FM_ChildRetentionOffer, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildRetentionOver()
+ * ----------------------------------------------------
+ */
+bool FM_ChildRetentionOver(const FM_RetentionState_t *State)
+{
+    UT_GenStub_SetupReturnBuffer(FM_ChildRetentionOver, bool);
+
+    UT_GenStub_AddParam(FM_ChildRetentionOver, const FM_RetentionState_t *, State);
+
+    UT_GenStub_Execute(FM_ChildRetentionOver, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_ChildRetentionOver, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildRetentionPriority()
+ * ----------------------------------------------------
+ */
+uint32 FM_ChildRetentionPriority(const FM_RetentionTableEntry_t *Policy, const char *Name)
+{
+    UT_GenStub_SetupReturnBuffer(FM_ChildRetentionPriority, uint32);
+
+    UT_GenStub_AddParam(FM_ChildRetentionPriority, const FM_RetentionTableEntry_t *, Policy);
+    UT_GenStub_AddParam(FM_ChildRetentionPriority, const char *, Name);
+
+    UT_GenStub_Execute(FM_ChildRetentionPriority, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_ChildRetentionPriority, uint32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildRetentionScan()
+ * ----------------------------------------------------
+ */
+void FM_ChildRetentionScan(FM_ChildWorker_t *Worker, FM_RetentionState_t *State, osal_id_t DirId,
+                           const char *DirWithSep)
+{
+    UT_GenStub_AddParam(FM_ChildRetentionScan, FM_ChildWorker_t *, Worker);
+    UT_GenStub_AddParam(FM_ChildRetentionScan, FM_RetentionState_t *, State);
+    UT_GenStub_AddParam(FM_ChildRetentionScan, osal_id_t, DirId);
+    UT_GenStub_AddParam(FM_ChildRetentionScan, const char *, DirWithSep);
+
+    UT_GenStub_Execute(FM_ChildRetentionScan, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildRetentionSift()
+ * ----------------------------------------------------
+ */
+void FM_ChildRetentionSift(FM_RetentionFile_t *Index, uint32 Count, uint32 Root, bool EvictFirst)
+{
+    UT_GenStub_AddParam(FM_ChildRetentionSift, FM_RetentionFile_t *, Index);
+    UT_GenStub_AddParam(FM_ChildRetentionSift, uint32, Count);
+    UT_GenStub_AddParam(FM_ChildRetentionSift, uint32, Root);
+    UT_GenStub_AddParam(FM_ChildRetentionSift, bool, EvictFirst);
+
+    UT_GenStub_Execute(FM_ChildRetentionSift, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildSelectLane()
+ * ----------------------------------------------------
+ */
+uint8 FM_ChildSelectLane(void)
+{
+    UT_GenStub_SetupReturnBuffer(FM_ChildSelectLane, uint8);
+
+    UT_GenStub_Execute(FM_ChildSelectLane, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_ChildSelectLane, uint8);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for FM_ChildSetPermissionsCmd()
  * ----------------------------------------------------
  */
-void FM_ChildSetPermissionsCmd(const FM_ChildQueueEntry_t *CmdArgs)
+void FM_ChildSetPermissionsCmd(FM_ChildWorker_t *Worker, const FM_ChildQueueEntry_t *CmdArgs)
 {
+    UT_GenStub_AddParam(FM_ChildSetPermissionsCmd, FM_ChildWorker_t *, Worker);
     UT_GenStub_AddParam(FM_ChildSetPermissionsCmd, const FM_ChildQueueEntry_t *, CmdArgs);
 
     UT_GenStub_Execute(FM_ChildSetPermissionsCmd, Basic, NULL);
@@ -278,12 +1274,10 @@ int32 FM_ChildSizeTimeMode(const char *Filename, uint32 *FileSize, uint32 *FileT
  * Generated stub function for FM_ChildSleepStat()
  * ----------------------------------------------------
  */
-void FM_ChildSleepStat(const char *Filename, FM_DirListEntry_t *DirListData, int32 *FilesTillSleep,
-                       bool GetSizeTimeMode)
+void FM_ChildSleepStat(const char *Filename, FM_DirListEntry_t *DirListData, bool GetSizeTimeMode)
 {
     UT_GenStub_AddParam(FM_ChildSleepStat, const char *, Filename);
     UT_GenStub_AddParam(FM_ChildSleepStat, FM_DirListEntry_t *, DirListData);
-    UT_GenStub_AddParam(FM_ChildSleepStat, int32 *, FilesTillSleep);
     UT_GenStub_AddParam(FM_ChildSleepStat, bool, GetSizeTimeMode);
 
     UT_GenStub_Execute(FM_ChildSleepStat, Basic, NULL);
@@ -299,3 +1293,158 @@ void FM_ChildTask(void)
 
     UT_GenStub_Execute(FM_ChildTask, Basic, NULL);
 }
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildThrottle()
+ * ----------------------------------------------------
+ */
+void FM_ChildThrottle(const char *Source, const char *Target, uint32 Bytes, uint32 Stats)
+{
+    UT_GenStub_AddParam(FM_ChildThrottle, const char *, Source);
+    UT_GenStub_AddParam(FM_ChildThrottle, const char *, Target);
+    UT_GenStub_AddParam(FM_ChildThrottle, uint32, Bytes);
+    UT_GenStub_AddParam(FM_ChildThrottle, uint32, Stats);
+
+    UT_GenStub_Execute(FM_ChildThrottle, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildThrottleBucket()
+ * ----------------------------------------------------
+ */
+uint32 FM_ChildThrottleBucket(int64 *Tokens, uint32 Rate, int64 ElapsedUs, uint32 Used)
+{
+    UT_GenStub_SetupReturnBuffer(FM_ChildThrottleBucket, uint32);
+
+    UT_GenStub_AddParam(FM_ChildThrottleBucket, int64 *, Tokens);
+    UT_GenStub_AddParam(FM_ChildThrottleBucket, uint32, Rate);
+    UT_GenStub_AddParam(FM_ChildThrottleBucket, int64, ElapsedUs);
+    UT_GenStub_AddParam(FM_ChildThrottleBucket, uint32, Used);
+
+    UT_GenStub_Execute(FM_ChildThrottleBucket, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_ChildThrottleBucket, uint32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildThrottleCharge()
+ * ----------------------------------------------------
+ */
+uint32 FM_ChildThrottleCharge(uint32 Index, OS_time_t Now, uint32 Bytes, uint32 Stats)
+{
+    UT_GenStub_SetupReturnBuffer(FM_ChildThrottleCharge, uint32);
+
+    UT_GenStub_AddParam(FM_ChildThrottleCharge, uint32, Index);
+    UT_GenStub_AddParam(FM_ChildThrottleCharge, OS_time_t, Now);
+    UT_GenStub_AddParam(FM_ChildThrottleCharge, uint32, Bytes);
+    UT_GenStub_AddParam(FM_ChildThrottleCharge, uint32, Stats);
+
+    UT_GenStub_Execute(FM_ChildThrottleCharge, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_ChildThrottleCharge, uint32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildThrottleSelect()
+ * ----------------------------------------------------
+ */
+uint32 FM_ChildThrottleSelect(const char *Path)
+{
+    UT_GenStub_SetupReturnBuffer(FM_ChildThrottleSelect, uint32);
+
+    UT_GenStub_AddParam(FM_ChildThrottleSelect, const char *, Path);
+
+    UT_GenStub_Execute(FM_ChildThrottleSelect, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_ChildThrottleSelect, uint32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildTrashFile()
+ * ----------------------------------------------------
+ */
+bool FM_ChildTrashFile(const char *Filename)
+{
+    UT_GenStub_SetupReturnBuffer(FM_ChildTrashFile, bool);
+
+    UT_GenStub_AddParam(FM_ChildTrashFile, const char *, Filename);
+
+    UT_GenStub_Execute(FM_ChildTrashFile, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_ChildTrashFile, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildTrashVolume()
+ * ----------------------------------------------------
+ */
+uint32 FM_ChildTrashVolume(const char *Filename, char *TrashDir, uint32 BufferSize)
+{
+    UT_GenStub_SetupReturnBuffer(FM_ChildTrashVolume, uint32);
+
+    UT_GenStub_AddParam(FM_ChildTrashVolume, const char *, Filename);
+    UT_GenStub_AddParam(FM_ChildTrashVolume, char *, TrashDir);
+    UT_GenStub_AddParam(FM_ChildTrashVolume, uint32, BufferSize);
+
+    UT_GenStub_Execute(FM_ChildTrashVolume, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_ChildTrashVolume, uint32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildVerifyCmd()
+ * ----------------------------------------------------
+ */
+bool FM_ChildVerifyCmd(FM_ChildWorker_t *Worker, FM_ChildQueueEntry_t *CmdArgs)
+{
+    UT_GenStub_SetupReturnBuffer(FM_ChildVerifyCmd, bool);
+
+    UT_GenStub_AddParam(FM_ChildVerifyCmd, FM_ChildWorker_t *, Worker);
+    UT_GenStub_AddParam(FM_ChildVerifyCmd, FM_ChildQueueEntry_t *, CmdArgs);
+
+    UT_GenStub_Execute(FM_ChildVerifyCmd, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_ChildVerifyCmd, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildWaitForPaths()
+ * ----------------------------------------------------
+ */
+void FM_ChildWaitForPaths(FM_ChildWorker_t *Worker)
+{
+    UT_GenStub_AddParam(FM_ChildWaitForPaths, FM_ChildWorker_t *, Worker);
+
+    UT_GenStub_Execute(FM_ChildWaitForPaths, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildWriterLoop()
+ * ----------------------------------------------------
+ */
+void FM_ChildWriterLoop(FM_ChildWorker_t *Worker)
+{
+    UT_GenStub_AddParam(FM_ChildWriterLoop, FM_ChildWorker_t *, Worker);
+
+    UT_GenStub_Execute(FM_ChildWriterLoop, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildWriterTask()
+ * ----------------------------------------------------
+ */
+void FM_ChildWriterTask(void)
+{
+
+    UT_GenStub_Execute(FM_ChildWriterTask, Basic, NULL);
+}
@@ -49,6 +49,81 @@ void FM_AppendPathSep(char *Directory, uint32 BufferSize)
     UT_GenStub_Execute(FM_AppendPathSep, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_BuildOpenPathSet()
+ * ----------------------------------------------------
+ */
+void FM_BuildOpenPathSet(FM_OpenPathSet_t *OpenPaths)
+{
+    UT_GenStub_AddParam(FM_BuildOpenPathSet, FM_OpenPathSet_t *, OpenPaths);
+
+    UT_GenStub_Execute(FM_BuildOpenPathSet, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ChildLaneOverlaps()
+ * ----------------------------------------------------
+ */
+bool FM_ChildLaneOverlaps(const FM_ChildLane_t *Lane, const FM_ChildPathSet_t *Paths)
+{
+    UT_GenStub_SetupReturnBuffer(FM_ChildLaneOverlaps, bool);
+
+    UT_GenStub_AddParam(FM_ChildLaneOverlaps, const FM_ChildLane_t *, Lane);
+    UT_GenStub_AddParam(FM_ChildLaneOverlaps, const FM_ChildPathSet_t *, Paths);
+
+    UT_GenStub_Execute(FM_ChildLaneOverlaps, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_ChildLaneOverlaps, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_FlushChildQueue()
+ * ----------------------------------------------------
+ */
+uint32 FM_FlushChildQueue(void)
+{
+    UT_GenStub_SetupReturnBuffer(FM_FlushChildQueue, uint32);
+
+    UT_GenStub_Execute(FM_FlushChildQueue, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_FlushChildQueue, uint32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_GetChildLane()
+ * ----------------------------------------------------
+ */
+uint8 FM_GetChildLane(const FM_ChildQueueEntry_t *CmdArgs)
+{
+    UT_GenStub_SetupReturnBuffer(FM_GetChildLane, uint8);
+
+    UT_GenStub_AddParam(FM_GetChildLane, const FM_ChildQueueEntry_t *, CmdArgs);
+
+    UT_GenStub_Execute(FM_GetChildLane, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_GetChildLane, uint8);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_GetChildPathBlocksFree()
+ * ----------------------------------------------------
+ */
+uint32 FM_GetChildPathBlocksFree(uint32 Limit)
+{
+    UT_GenStub_SetupReturnBuffer(FM_GetChildPathBlocksFree, uint32);
+
+    UT_GenStub_AddParam(FM_GetChildPathBlocksFree, uint32, Limit);
+
+    UT_GenStub_Execute(FM_GetChildPathBlocksFree, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_GetChildPathBlocksFree, uint32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for FM_GetDirectorySpaceEstimate()
@@ -67,18 +142,32 @@ CFE_Status_t FM_GetDirectorySpaceEstimate(const char *Directory, uint64 *BlockCo
     return UT_GenStub_GetReturnValue(FM_GetDirectorySpaceEstimate, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_GetEntryPaths()
+ * ----------------------------------------------------
+ */
+void FM_GetEntryPaths(const FM_ChildQueueEntry_t *CmdArgs, FM_ChildPathSet_t *Paths)
+{
+    UT_GenStub_AddParam(FM_GetEntryPaths, const FM_ChildQueueEntry_t *, CmdArgs);
+    UT_GenStub_AddParam(FM_GetEntryPaths, FM_ChildPathSet_t *, Paths);
+
+    UT_GenStub_Execute(FM_GetEntryPaths, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for FM_GetFilenameState()
  * ----------------------------------------------------
  */
-uint32 FM_GetFilenameState(const char *Filename, size_t BufferSize, bool FileInfoCmd)
+uint32 FM_GetFilenameState(const char *Filename, size_t BufferSize, bool FileInfoCmd, FM_OpenPathSet_t *OpenPaths)
 {
     UT_GenStub_SetupReturnBuffer(FM_GetFilenameState, uint32);
 
     UT_GenStub_AddParam(FM_GetFilenameState, const char *, Filename);
     UT_GenStub_AddParam(FM_GetFilenameState, uint32, BufferSize);
     UT_GenStub_AddParam(FM_GetFilenameState, bool, FileInfoCmd);
+    UT_GenStub_AddParam(FM_GetFilenameState, FM_OpenPathSet_t *, OpenPaths);
 
     UT_GenStub_Execute(FM_GetFilenameState, Basic, NULL);
 
@@ -101,6 +190,19 @@ uint32 FM_GetOpenFilesData(FM_OpenFilesEntry_t *OpenFilesData)
     return UT_GenStub_GetReturnValue(FM_GetOpenFilesData, uint32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_GetSlotPaths()
+ * ----------------------------------------------------
+ */
+void FM_GetSlotPaths(const FM_ChildQueueSlot_t *Slot, FM_ChildPathSet_t *Paths)
+{
+    UT_GenStub_AddParam(FM_GetSlotPaths, const FM_ChildQueueSlot_t *, Slot);
+    UT_GenStub_AddParam(FM_GetSlotPaths, FM_ChildPathSet_t *, Paths);
+
+    UT_GenStub_Execute(FM_GetSlotPaths, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for FM_GetVolumeFreeSpace()
@@ -130,6 +232,198 @@ void FM_InvokeChildTask(void)
     UT_GenStub_Execute(FM_InvokeChildTask, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_IsPathOpen()
+ * ----------------------------------------------------
+ */
+bool FM_IsPathOpen(FM_OpenPathSet_t *OpenPaths, const char *Path)
+{
+    UT_GenStub_SetupReturnBuffer(FM_IsPathOpen, bool);
+
+    UT_GenStub_AddParam(FM_IsPathOpen, FM_OpenPathSet_t *, OpenPaths);
+    UT_GenStub_AddParam(FM_IsPathOpen, const char *, Path);
+
+    UT_GenStub_Execute(FM_IsPathOpen, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_IsPathOpen, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_IsValidNameString()
+ * ----------------------------------------------------
+ */
+bool FM_IsValidNameString(const char *Name, size_t BufferSize)
+{
+    UT_GenStub_SetupReturnBuffer(FM_IsValidNameString, bool);
+
+    UT_GenStub_AddParam(FM_IsValidNameString, const char *, Name);
+    UT_GenStub_AddParam(FM_IsValidNameString, size_t, BufferSize);
+
+    UT_GenStub_Execute(FM_IsValidNameString, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_IsValidNameString, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_LatencyBucket()
+ * ----------------------------------------------------
+ */
+uint32 FM_LatencyBucket(int64 Microseconds)
+{
+    UT_GenStub_SetupReturnBuffer(FM_LatencyBucket, uint32);
+
+    UT_GenStub_AddParam(FM_LatencyBucket, int64, Microseconds);
+
+    UT_GenStub_Execute(FM_LatencyBucket, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_LatencyBucket, uint32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_MatchPattern()
+ * ----------------------------------------------------
+ */
+bool FM_MatchPattern(const char *Pattern, const char *Name)
+{
+    UT_GenStub_SetupReturnBuffer(FM_MatchPattern, bool);
+
+    UT_GenStub_AddParam(FM_MatchPattern, const char *, Pattern);
+    UT_GenStub_AddParam(FM_MatchPattern, const char *, Name);
+
+    UT_GenStub_Execute(FM_MatchPattern, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_MatchPattern, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_PathSetsOverlap()
+ * ----------------------------------------------------
+ */
+bool FM_PathSetsOverlap(const FM_ChildPathSet_t *Paths1, const FM_ChildPathSet_t *Paths2)
+{
+    UT_GenStub_SetupReturnBuffer(FM_PathSetsOverlap, bool);
+
+    UT_GenStub_AddParam(FM_PathSetsOverlap, const FM_ChildPathSet_t *, Paths1);
+    UT_GenStub_AddParam(FM_PathSetsOverlap, const FM_ChildPathSet_t *, Paths2);
+
+    UT_GenStub_Execute(FM_PathSetsOverlap, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_PathSetsOverlap, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_PathsOverlap()
+ * ----------------------------------------------------
+ */
+bool FM_PathsOverlap(const char *Path1, const char *Path2)
+{
+    UT_GenStub_SetupReturnBuffer(FM_PathsOverlap, bool);
+
+    UT_GenStub_AddParam(FM_PathsOverlap, const char *, Path1);
+    UT_GenStub_AddParam(FM_PathsOverlap, const char *, Path2);
+
+    UT_GenStub_Execute(FM_PathsOverlap, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_PathsOverlap, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_PeekChildPath()
+ * ----------------------------------------------------
+ */
+void FM_PeekChildPath(uint16 PathRef, char *Path, uint32 BufferSize)
+{
+    UT_GenStub_AddParam(FM_PeekChildPath, uint16, PathRef);
+    UT_GenStub_AddParam(FM_PeekChildPath, char *, Path);
+    UT_GenStub_AddParam(FM_PeekChildPath, uint32, BufferSize);
+
+    UT_GenStub_Execute(FM_PeekChildPath, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_RecordLatency()
+ * ----------------------------------------------------
+ */
+void FM_RecordLatency(FM_LatencyHistogram_t *Histograms, CFE_MSG_FcnCode_t CommandCode, OS_time_t StartTime,
+                      OS_time_t EndTime)
+{
+    UT_GenStub_AddParam(FM_RecordLatency, FM_LatencyHistogram_t *, Histograms);
+    UT_GenStub_AddParam(FM_RecordLatency, CFE_MSG_FcnCode_t, CommandCode);
+    UT_GenStub_AddParam(FM_RecordLatency, OS_time_t, StartTime);
+    UT_GenStub_AddParam(FM_RecordLatency, OS_time_t, EndTime);
+
+    UT_GenStub_Execute(FM_RecordLatency, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ReleaseChildPath()
+ * ----------------------------------------------------
+ */
+void FM_ReleaseChildPath(uint16 PathRef)
+{
+    UT_GenStub_AddParam(FM_ReleaseChildPath, uint16, PathRef);
+
+    UT_GenStub_Execute(FM_ReleaseChildPath, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_StartPurge()
+ * ----------------------------------------------------
+ */
+bool FM_StartPurge(bool Commanded)
+{
+    UT_GenStub_SetupReturnBuffer(FM_StartPurge, bool);
+
+    UT_GenStub_AddParam(FM_StartPurge, bool, Commanded);
+
+    UT_GenStub_Execute(FM_StartPurge, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_StartPurge, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_StartRetention()
+ * ----------------------------------------------------
+ */
+bool FM_StartRetention(uint32 TableEntryIndex, bool Commanded)
+{
+    UT_GenStub_SetupReturnBuffer(FM_StartRetention, bool);
+
+    UT_GenStub_AddParam(FM_StartRetention, uint32, TableEntryIndex);
+    UT_GenStub_AddParam(FM_StartRetention, bool, Commanded);
+
+    UT_GenStub_Execute(FM_StartRetention, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_StartRetention, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_StoreChildPath()
+ * ----------------------------------------------------
+ */
+uint16 FM_StoreChildPath(const char *Path)
+{
+    UT_GenStub_SetupReturnBuffer(FM_StoreChildPath, uint16);
+
+    UT_GenStub_AddParam(FM_StoreChildPath, const char *, Path);
+
+    UT_GenStub_Execute(FM_StoreChildPath, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_StoreChildPath, uint16);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for FM_VerifyChildTask()
@@ -267,7 +561,7 @@ bool FM_VerifyFileNotOpen(const char *Filename, size_t BufferSize, uint32 EventI
  * ----------------------------------------------------
  */
 bool FM_VerifyFileState(FM_File_States State, const char *Filename, size_t BufferSize, uint32 EventID,
-                        const char *CmdText)
+                        const char *CmdText, FM_OpenPathSet_t *OpenPaths)
 {
     UT_GenStub_SetupReturnBuffer(FM_VerifyFileState, bool);
 
@@ -276,12 +570,34 @@ bool FM_VerifyFileState(FM_File_States State, const char *Filename, size_t Buffe
     UT_GenStub_AddParam(FM_VerifyFileState, uint32, BufferSize);
     UT_GenStub_AddParam(FM_VerifyFileState, uint32, EventID);
     UT_GenStub_AddParam(FM_VerifyFileState, const char *, CmdText);
+    UT_GenStub_AddParam(FM_VerifyFileState, FM_OpenPathSet_t *, OpenPaths);
 
     UT_GenStub_Execute(FM_VerifyFileState, Basic, UT_DefaultHandler_FM_VerifyFileState);
 
     return UT_GenStub_GetReturnValue(FM_VerifyFileState, bool);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_VerifyFileStateOrDefer()
+ * ----------------------------------------------------
+ */
+bool FM_VerifyFileStateOrDefer(FM_File_States State, const char *Filename, size_t BufferSize, uint32 EventID,
+                               const char *CmdText)
+{
+    UT_GenStub_SetupReturnBuffer(FM_VerifyFileStateOrDefer, bool);
+
+    UT_GenStub_AddParam(FM_VerifyFileStateOrDefer, FM_File_States, State);
+    UT_GenStub_AddParam(FM_VerifyFileStateOrDefer, const char *, Filename);
+    UT_GenStub_AddParam(FM_VerifyFileStateOrDefer, size_t, BufferSize);
+    UT_GenStub_AddParam(FM_VerifyFileStateOrDefer, uint32, EventID);
+    UT_GenStub_AddParam(FM_VerifyFileStateOrDefer, const char *, CmdText);
+
+    UT_GenStub_Execute(FM_VerifyFileStateOrDefer, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_VerifyFileStateOrDefer, bool);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for FM_VerifyNameValid()
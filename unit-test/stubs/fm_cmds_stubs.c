@@ -26,6 +26,22 @@
 #include "fm_cmds.h"
 #include "utgenstub.h"
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_AbortCmd()
+ * ----------------------------------------------------
+ */
+bool FM_AbortCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    UT_GenStub_SetupReturnBuffer(FM_AbortCmd, bool);
+
+    UT_GenStub_AddParam(FM_AbortCmd, const CFE_SB_Buffer_t *, BufPtr);
+
+    UT_GenStub_Execute(FM_AbortCmd, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_AbortCmd, bool);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for FM_ConcatFilesCmd()
@@ -42,6 +58,22 @@ bool FM_ConcatFilesCmd(const CFE_SB_Buffer_t *BufPtr)
     return UT_GenStub_GetReturnValue(FM_ConcatFilesCmd, bool);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ConcatListCmd()
+ * ----------------------------------------------------
+ */
+bool FM_ConcatListCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    UT_GenStub_SetupReturnBuffer(FM_ConcatListCmd, bool);
+
+    UT_GenStub_AddParam(FM_ConcatListCmd, const CFE_SB_Buffer_t *, BufPtr);
+
+    UT_GenStub_Execute(FM_ConcatListCmd, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_ConcatListCmd, bool);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for FM_CopyFileCmd()
@@ -138,6 +170,70 @@ bool FM_DeleteFileCmd(const CFE_SB_Buffer_t *BufPtr)
     return UT_GenStub_GetReturnValue(FM_DeleteFileCmd, bool);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_DeleteTreeCmd()
+ * ----------------------------------------------------
+ */
+bool FM_DeleteTreeCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    UT_GenStub_SetupReturnBuffer(FM_DeleteTreeCmd, bool);
+
+    UT_GenStub_AddParam(FM_DeleteTreeCmd, const CFE_SB_Buffer_t *, BufPtr);
+
+    UT_GenStub_Execute(FM_DeleteTreeCmd, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_DeleteTreeCmd, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_EnforceRetentionCmd()
+ * ----------------------------------------------------
+ */
+bool FM_EnforceRetentionCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    UT_GenStub_SetupReturnBuffer(FM_EnforceRetentionCmd, bool);
+
+    UT_GenStub_AddParam(FM_EnforceRetentionCmd, const CFE_SB_Buffer_t *, BufPtr);
+
+    UT_GenStub_Execute(FM_EnforceRetentionCmd, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_EnforceRetentionCmd, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_FilterFilesCmd()
+ * ----------------------------------------------------
+ */
+bool FM_FilterFilesCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    UT_GenStub_SetupReturnBuffer(FM_FilterFilesCmd, bool);
+
+    UT_GenStub_AddParam(FM_FilterFilesCmd, const CFE_SB_Buffer_t *, BufPtr);
+
+    UT_GenStub_Execute(FM_FilterFilesCmd, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_FilterFilesCmd, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_FlushQueueCmd()
+ * ----------------------------------------------------
+ */
+bool FM_FlushQueueCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    UT_GenStub_SetupReturnBuffer(FM_FlushQueueCmd, bool);
+
+    UT_GenStub_AddParam(FM_FlushQueueCmd, const CFE_SB_Buffer_t *, BufPtr);
+
+    UT_GenStub_Execute(FM_FlushQueueCmd, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_FlushQueueCmd, bool);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for FM_GetDirListFileCmd()
@@ -170,6 +266,22 @@ bool FM_GetDirListPktCmd(const CFE_SB_Buffer_t *BufPtr)
     return UT_GenStub_GetReturnValue(FM_GetDirListPktCmd, bool);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_GetFileDigestCmd()
+ * ----------------------------------------------------
+ */
+bool FM_GetFileDigestCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    UT_GenStub_SetupReturnBuffer(FM_GetFileDigestCmd, bool);
+
+    UT_GenStub_AddParam(FM_GetFileDigestCmd, const CFE_SB_Buffer_t *, BufPtr);
+
+    UT_GenStub_Execute(FM_GetFileDigestCmd, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_GetFileDigestCmd, bool);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for FM_GetFileInfoCmd()
@@ -250,6 +362,22 @@ bool FM_NoopCmd(const CFE_SB_Buffer_t *BufPtr)
     return UT_GenStub_GetReturnValue(FM_NoopCmd, bool);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_PurgeTrashCmd()
+ * ----------------------------------------------------
+ */
+bool FM_PurgeTrashCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    UT_GenStub_SetupReturnBuffer(FM_PurgeTrashCmd, bool);
+
+    UT_GenStub_AddParam(FM_PurgeTrashCmd, const CFE_SB_Buffer_t *, BufPtr);
+
+    UT_GenStub_Execute(FM_PurgeTrashCmd, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_PurgeTrashCmd, bool);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for FM_RenameFileCmd()
@@ -282,6 +410,70 @@ bool FM_ResetCountersCmd(const CFE_SB_Buffer_t *BufPtr)
     return UT_GenStub_GetReturnValue(FM_ResetCountersCmd, bool);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ResetLatencyCmd()
+ * ----------------------------------------------------
+ */
+bool FM_ResetLatencyCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    UT_GenStub_SetupReturnBuffer(FM_ResetLatencyCmd, bool);
+
+    UT_GenStub_AddParam(FM_ResetLatencyCmd, const CFE_SB_Buffer_t *, BufPtr);
+
+    UT_GenStub_Execute(FM_ResetLatencyCmd, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_ResetLatencyCmd, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_SendLatencyCmd()
+ * ----------------------------------------------------
+ */
+bool FM_SendLatencyCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    UT_GenStub_SetupReturnBuffer(FM_SendLatencyCmd, bool);
+
+    UT_GenStub_AddParam(FM_SendLatencyCmd, const CFE_SB_Buffer_t *, BufPtr);
+
+    UT_GenStub_Execute(FM_SendLatencyCmd, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_SendLatencyCmd, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_SetCopyBlockSizeCmd()
+ * ----------------------------------------------------
+ */
+bool FM_SetCopyBlockSizeCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    UT_GenStub_SetupReturnBuffer(FM_SetCopyBlockSizeCmd, bool);
+
+    UT_GenStub_AddParam(FM_SetCopyBlockSizeCmd, const CFE_SB_Buffer_t *, BufPtr);
+
+    UT_GenStub_Execute(FM_SetCopyBlockSizeCmd, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_SetCopyBlockSizeCmd, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_SetDeleteModeCmd()
+ * ----------------------------------------------------
+ */
+bool FM_SetDeleteModeCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    UT_GenStub_SetupReturnBuffer(FM_SetDeleteModeCmd, bool);
+
+    UT_GenStub_AddParam(FM_SetDeleteModeCmd, const CFE_SB_Buffer_t *, BufPtr);
+
+    UT_GenStub_Execute(FM_SetDeleteModeCmd, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_SetDeleteModeCmd, bool);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for FM_SetPermissionsCmd()
@@ -313,3 +505,35 @@ bool FM_SetTableStateCmd(const CFE_SB_Buffer_t *BufPtr)
 
     return UT_GenStub_GetReturnValue(FM_SetTableStateCmd, bool);
 }
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_SetThrottleCmd()
+ * ----------------------------------------------------
+ */
+bool FM_SetThrottleCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    UT_GenStub_SetupReturnBuffer(FM_SetThrottleCmd, bool);
+
+    UT_GenStub_AddParam(FM_SetThrottleCmd, const CFE_SB_Buffer_t *, BufPtr);
+
+    UT_GenStub_Execute(FM_SetThrottleCmd, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_SetThrottleCmd, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_SetVerifyModeCmd()
+ * ----------------------------------------------------
+ */
+bool FM_SetVerifyModeCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    UT_GenStub_SetupReturnBuffer(FM_SetVerifyModeCmd, bool);
+
+    UT_GenStub_AddParam(FM_SetVerifyModeCmd, const CFE_SB_Buffer_t *, BufPtr);
+
+    UT_GenStub_Execute(FM_SetVerifyModeCmd, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_SetVerifyModeCmd, bool);
+}
@@ -0,0 +1,102 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,918-1, and identified as “Core Flight
+ * Software System (cFS) File Manager Application Version 2.6.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Auto-Generated stub implementations for functions defined in fm_digest header
+ */
+
+#include "fm_digest.h"
+#include "utgenstub.h"
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_DigestCrc32c()
+ * ----------------------------------------------------
+ */
+uint32 FM_DigestCrc32c(const FM_Digest_State_t *State, const uint8 *DataPtr, size_t DataLength, uint32 Crc)
+{
+    UT_GenStub_SetupReturnBuffer(FM_DigestCrc32c, uint32);
+
+    UT_GenStub_AddParam(FM_DigestCrc32c, const FM_Digest_State_t *, State);
+    UT_GenStub_AddParam(FM_DigestCrc32c, const uint8 *, DataPtr);
+    UT_GenStub_AddParam(FM_DigestCrc32c, size_t, DataLength);
+    UT_GenStub_AddParam(FM_DigestCrc32c, uint32, Crc);
+
+    UT_GenStub_Execute(FM_DigestCrc32c, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_DigestCrc32c, uint32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_DigestFinish()
+ * ----------------------------------------------------
+ */
+void FM_DigestFinish(FM_Digest_Context_t *Context, uint32 *Crc32c, uint8 *Xxh64, uint8 *Sha256)
+{
+    UT_GenStub_AddParam(FM_DigestFinish, FM_Digest_Context_t *, Context);
+    UT_GenStub_AddParam(FM_DigestFinish, uint32 *, Crc32c);
+    UT_GenStub_AddParam(FM_DigestFinish, uint8 *, Xxh64);
+    UT_GenStub_AddParam(FM_DigestFinish, uint8 *, Sha256);
+
+    UT_GenStub_Execute(FM_DigestFinish, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_DigestInit()
+ * ----------------------------------------------------
+ */
+void FM_DigestInit(FM_Digest_State_t *State)
+{
+    UT_GenStub_AddParam(FM_DigestInit, FM_Digest_State_t *, State);
+
+    UT_GenStub_Execute(FM_DigestInit, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_DigestStart()
+ * ----------------------------------------------------
+ */
+void FM_DigestStart(FM_Digest_Context_t *Context, uint32 Digests)
+{
+    UT_GenStub_AddParam(FM_DigestStart, FM_Digest_Context_t *, Context);
+    UT_GenStub_AddParam(FM_DigestStart, uint32, Digests);
+
+    UT_GenStub_Execute(FM_DigestStart, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_DigestUpdate()
+ * ----------------------------------------------------
+ */
+void FM_DigestUpdate(const FM_Digest_State_t *State, FM_Digest_Context_t *Context, const void *DataPtr,
+                     size_t DataLength)
+{
+    UT_GenStub_AddParam(FM_DigestUpdate, const FM_Digest_State_t *, State);
+    UT_GenStub_AddParam(FM_DigestUpdate, FM_Digest_Context_t *, Context);
+    UT_GenStub_AddParam(FM_DigestUpdate, const void *, DataPtr);
+    UT_GenStub_AddParam(FM_DigestUpdate, size_t, DataLength);
+
+    UT_GenStub_Execute(FM_DigestUpdate, Basic, NULL);
+}
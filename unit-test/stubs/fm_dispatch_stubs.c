@@ -26,6 +26,22 @@
 #include "fm_dispatch.h"
 #include "utgenstub.h"
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_GetFileDigestVerifyDispatch()
+ * ----------------------------------------------------
+ */
+bool FM_GetFileDigestVerifyDispatch(const CFE_SB_Buffer_t *BufPtr)
+{
+    UT_GenStub_SetupReturnBuffer(FM_GetFileDigestVerifyDispatch, bool);
+
+    UT_GenStub_AddParam(FM_GetFileDigestVerifyDispatch, const CFE_SB_Buffer_t *, BufPtr);
+
+    UT_GenStub_Execute(FM_GetFileDigestVerifyDispatch, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_GetFileDigestVerifyDispatch, bool);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for FM_IsValidCmdPktLength()
@@ -68,3 +84,35 @@ void FM_ProcessPkt(const CFE_SB_Buffer_t *BufPtr)
 
     UT_GenStub_Execute(FM_ProcessPkt, Basic, NULL);
 }
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_PurgeTrashVerifyDispatch()
+ * ----------------------------------------------------
+ */
+bool FM_PurgeTrashVerifyDispatch(const CFE_SB_Buffer_t *BufPtr)
+{
+    UT_GenStub_SetupReturnBuffer(FM_PurgeTrashVerifyDispatch, bool);
+
+    UT_GenStub_AddParam(FM_PurgeTrashVerifyDispatch, const CFE_SB_Buffer_t *, BufPtr);
+
+    UT_GenStub_Execute(FM_PurgeTrashVerifyDispatch, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_PurgeTrashVerifyDispatch, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_SetDeleteModeVerifyDispatch()
+ * ----------------------------------------------------
+ */
+bool FM_SetDeleteModeVerifyDispatch(const CFE_SB_Buffer_t *BufPtr)
+{
+    UT_GenStub_SetupReturnBuffer(FM_SetDeleteModeVerifyDispatch, bool);
+
+    UT_GenStub_AddParam(FM_SetDeleteModeVerifyDispatch, const CFE_SB_Buffer_t *, BufPtr);
+
+    UT_GenStub_Execute(FM_SetDeleteModeVerifyDispatch, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_SetDeleteModeVerifyDispatch, bool);
+}
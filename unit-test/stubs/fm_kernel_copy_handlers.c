@@ -0,0 +1,52 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+ * Includes
+ */
+#include "osapi.h"
+#include "cfe.h"
+#include "utstubs.h"
+
+/*
+ * Unless a test sets a return value, the kernel copy stubs behave like the
+ * "none" implementation so the child tasks copy the data themselves.
+ */
+static void UT_fm_kernel_copy_not_implemented(UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    int32 status_code;
+
+    if (!UT_Stub_GetInt32StatusCode(Context, &status_code))
+    {
+        status_code = CFE_STATUS_NOT_IMPLEMENTED;
+    }
+
+    UT_Stub_SetReturnValue(FuncKey, status_code);
+}
+
+/*------------------------------------------------------------*/
+void UT_DefaultHandler_FM_KernelCopy_Chunk(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    UT_fm_kernel_copy_not_implemented(FuncKey, Context);
+}
+
+/*------------------------------------------------------------*/
+void UT_DefaultHandler_FM_KernelCopy_Open(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    UT_fm_kernel_copy_not_implemented(FuncKey, Context);
+}
@@ -0,0 +1,79 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,918-1, and identified as “Core Flight
+ * Software System (cFS) File Manager Application Version 2.6.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Auto-Generated stub implementations for functions defined in fm_kernel_copy header
+ */
+
+#include "fm_kernel_copy.h"
+#include "utgenstub.h"
+
+void UT_DefaultHandler_FM_KernelCopy_Chunk(void *, UT_EntryKey_t, const UT_StubContext_t *);
+void UT_DefaultHandler_FM_KernelCopy_Open(void *, UT_EntryKey_t, const UT_StubContext_t *);
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_KernelCopy_Chunk()
+ * ----------------------------------------------------
+ */
+int32 FM_KernelCopy_Chunk(FM_KernelCopy_State_t *State, uint32 Length)
+{
+    UT_GenStub_SetupReturnBuffer(FM_KernelCopy_Chunk, int32);
+
+    UT_GenStub_AddParam(FM_KernelCopy_Chunk, FM_KernelCopy_State_t *, State);
+    UT_GenStub_AddParam(FM_KernelCopy_Chunk, uint32, Length);
+
+    UT_GenStub_Execute(FM_KernelCopy_Chunk, Basic, UT_DefaultHandler_FM_KernelCopy_Chunk);
+
+    return UT_GenStub_GetReturnValue(FM_KernelCopy_Chunk, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_KernelCopy_Close()
+ * ----------------------------------------------------
+ */
+void FM_KernelCopy_Close(FM_KernelCopy_State_t *State)
+{
+    UT_GenStub_AddParam(FM_KernelCopy_Close, FM_KernelCopy_State_t *, State);
+
+    UT_GenStub_Execute(FM_KernelCopy_Close, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_KernelCopy_Open()
+ * ----------------------------------------------------
+ */
+CFE_Status_t FM_KernelCopy_Open(FM_KernelCopy_State_t *State, const char *SrcFileName, const char *DstFileName,
+                                bool Append)
+{
+    UT_GenStub_SetupReturnBuffer(FM_KernelCopy_Open, CFE_Status_t);
+
+    UT_GenStub_AddParam(FM_KernelCopy_Open, FM_KernelCopy_State_t *, State);
+    UT_GenStub_AddParam(FM_KernelCopy_Open, const char *, SrcFileName);
+    UT_GenStub_AddParam(FM_KernelCopy_Open, const char *, DstFileName);
+    UT_GenStub_AddParam(FM_KernelCopy_Open, bool, Append);
+
+    UT_GenStub_Execute(FM_KernelCopy_Open, Basic, UT_DefaultHandler_FM_KernelCopy_Open);
+
+    return UT_GenStub_GetReturnValue(FM_KernelCopy_Open, CFE_Status_t);
+}
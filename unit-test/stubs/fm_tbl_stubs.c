@@ -62,6 +62,22 @@ CFE_Status_t FM_TableInit(void)
     return UT_GenStub_GetReturnValue(FM_TableInit, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for FM_ValidateRetentionTable()
+ * ----------------------------------------------------
+ */
+CFE_Status_t FM_ValidateRetentionTable(FM_RetentionTable_t *TablePtr)
+{
+    UT_GenStub_SetupReturnBuffer(FM_ValidateRetentionTable, CFE_Status_t);
+
+    UT_GenStub_AddParam(FM_ValidateRetentionTable, FM_RetentionTable_t *, TablePtr);
+
+    UT_GenStub_Execute(FM_ValidateRetentionTable, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(FM_ValidateRetentionTable, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for FM_ValidateTable()
@@ -60,6 +60,18 @@ typedef union
     FM_MonitorFilesystemSpaceCmd_t GetFreeSpaceCmd;
     FM_SetTableStateCmd_t          SetTableStateCmd;
     FM_SetPermissionsCmd_t         SetPermissionsCmd;
+    FM_SetCopyBlockSizeCmd_t       SetCopyBlockSizeCmd;
+    FM_ConcatListCmd_t             ConcatListCmd;
+    FM_SetThrottleCmd_t            SetThrottleCmd;
+    FM_AbortCmd_t                  AbortCmd;
+    FM_FlushQueueCmd_t             FlushQueueCmd;
+    FM_SetVerifyModeCmd_t          SetVerifyModeCmd;
+    FM_DeleteTreeCmd_t             DeleteTreeCmd;
+    FM_FilterFilesCmd_t            FilterFilesCmd;
+    FM_EnforceRetentionCmd_t       EnforceRetentionCmd;
+    FM_SetDeleteModeCmd_t          SetDeleteModeCmd;
+    FM_PurgeTrashCmd_t             PurgeTrashCmd;
+    FM_GetFileDigestCmd_t          GetFileDigestCmd;
 } UT_CmdBuf_t;
 
 extern UT_CmdBuf_t UT_CmdBuf;